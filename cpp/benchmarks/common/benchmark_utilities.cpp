@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,10 @@
 
 #include "benchmark_utilities.hpp"
 
+#include <cudf/utilities/error.hpp>
+
+#include <map>
+
 void set_items_processed(::benchmark::State& state, int64_t items_processed_per_iteration)
 {
   state.SetItemsProcessed(state.iterations() * items_processed_per_iteration);
@@ -25,3 +29,30 @@ void set_bytes_processed(::benchmark::State& state, int64_t bytes_processed_per_
 {
   state.SetBytesProcessed(state.iterations() * bytes_processed_per_iteration);
 }
+
+double peak_memory_bandwidth()
+{
+  static std::map<int, double> peak_bandwidths;
+  int device{};
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  auto found = peak_bandwidths.find(device);
+  if (found == peak_bandwidths.end()) {
+    cudaDeviceProp prop{};
+    CUDF_CUDA_TRY(cudaGetDeviceProperties(&prop, device));
+    // memory clock is in kHz; bus width in bits; factor 2 for double data rate
+    auto const bandwidth =
+      2.0 * (prop.memoryClockRate * 1000.0) * (prop.memoryBusWidth / 8.0);
+    found = peak_bandwidths.emplace(device, bandwidth).first;
+  }
+  return found->second;
+}
+
+void set_peak_bandwidth_utilization(::benchmark::State& state,
+                                    int64_t bytes_processed_per_iteration)
+{
+  // kIsRate divides by the elapsed (manual) time, yielding achieved bytes/s over peak bytes/s
+  state.counters["peak_bw_util"] = ::benchmark::Counter(
+    static_cast<double>(state.iterations() * bytes_processed_per_iteration) /
+      peak_memory_bandwidth(),
+    ::benchmark::Counter::kIsRate);
+}
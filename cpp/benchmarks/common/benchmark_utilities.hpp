@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -39,3 +39,25 @@ void set_items_processed(::benchmark::State& state, int64_t items_processed_per_
  * @param bytes_processed_per_iteration number of bytes processed per iteration
  */
 void set_bytes_processed(::benchmark::State& state, int64_t bytes_processed_per_iteration);
+
+/**
+ * @brief Returns the theoretical peak global memory bandwidth of the current device, in bytes/s.
+ *
+ * Computed from the device's memory clock rate and bus width, matching the figure nvbench uses
+ * for its `BWUtil` summary. The value is queried once per device and cached.
+ */
+[[nodiscard]] double peak_memory_bandwidth();
+
+/**
+ * @brief Reports the achieved fraction of peak global memory bandwidth as a counter.
+ *
+ * Adds a `peak_bw_util` counter to the benchmark state, computed from the bytes moved per
+ * iteration and the elapsed (manual) time. For bandwidth-bound kernels this fraction of the
+ * roofline is comparable across GPU models, unlike raw times or absolute throughput. Call this
+ * alongside set_bytes_processed() with the same per-iteration byte count.
+ *
+ * @param state the benchmark state
+ * @param bytes_processed_per_iteration number of bytes read and written per iteration
+ */
+void set_peak_bandwidth_utilization(::benchmark::State& state,
+                                    int64_t bytes_processed_per_iteration);
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <thrust/execution_policy.h>
+#include <thrust/random.h>
+#include <thrust/shuffle.h>
+
+#include <nvbench/nvbench.cuh>
+
+namespace {
+
+/**
+ * @brief Generates a single list<...list<struct<int32, float64>>> column.
+ *
+ * The depth, list_size and nulls axes control the list nesting depth, the mean list length
+ * (lengths are uniform in [0, 2 * list_size]) and the null density at every nesting level.
+ * These copies run completely different code paths (lists/copying, structs) than the flat
+ * gather/scatter benchmarks.
+ */
+std::unique_ptr<cudf::table> create_nested_input(nvbench::state& state, cudf::size_type num_rows)
+{
+  auto const depth     = static_cast<cudf::size_type>(state.get_int64("depth"));
+  auto const list_size = static_cast<cudf::size_type>(state.get_int64("list_size"));
+  auto const nulls     = state.get_float64("nulls");
+
+  auto const leaf_types = std::vector<cudf::type_id>{cudf::type_id::INT32, cudf::type_id::FLOAT64};
+  data_profile const profile =
+    data_profile_builder()
+      .list_depth(depth)
+      .list_type(cudf::type_id::STRUCT)
+      .struct_depth(1)
+      .struct_types(leaf_types)
+      .distribution(cudf::type_id::LIST, distribution_id::UNIFORM, 0, 2 * list_size)
+      .null_probability(nulls > 0 ? std::optional<double>{nulls} : std::nullopt);
+  return create_random_table({cudf::type_id::LIST}, row_count{num_rows}, profile);
+}
+
+// Random permutation of [0, num_rows), usable as either a gather or a scatter map
+std::unique_ptr<cudf::column> create_shuffled_map(cudf::size_type num_rows)
+{
+  auto map_table =
+    create_sequence_table({cudf::type_to_id<cudf::size_type>()}, row_count{num_rows});
+  auto map = map_table->get_column(0).mutable_view();
+  thrust::shuffle(thrust::device,
+                  map.begin<cudf::size_type>(),
+                  map.end<cudf::size_type>(),
+                  thrust::default_random_engine());
+  return std::move(map_table->release().front());
+}
+
+void nested_gather(nvbench::state& state)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const input    = create_nested_input(state, num_rows);
+  auto const map      = create_shuffled_map(num_rows);
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch&) { auto result = cudf::gather(input->view(), map->view()); });
+}
+
+void nested_scatter(nvbench::state& state)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const source   = create_nested_input(state, num_rows);
+  auto const target   = create_nested_input(state, num_rows);
+  auto const map      = create_shuffled_map(num_rows);
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result = cudf::scatter(source->view(), map->view(), target->view());
+  });
+}
+
+void nested_copy_if_else(nvbench::state& state)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const lhs      = create_nested_input(state, num_rows);
+  auto const rhs      = create_nested_input(state, num_rows);
+  auto const decision =
+    create_random_column(cudf::type_id::BOOL8,
+                         row_count{num_rows},
+                         data_profile_builder().no_validity().distribution(
+                           cudf::type_id::BOOL8, distribution_id::UNIFORM, 0, 1));
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result =
+      cudf::copy_if_else(lhs->view().column(0), rhs->view().column(0), decision->view());
+  });
+}
+
+}  // namespace
+
+NVBENCH_BENCH(nested_gather)
+  .set_name("nested_gather")
+  .add_int64_axis("num_rows", {32768, 1048576})
+  .add_int64_axis("depth", {1, 2})
+  .add_int64_axis("list_size", {4, 64})
+  .add_float64_axis("nulls", {0.0, 0.3});
+
+NVBENCH_BENCH(nested_scatter)
+  .set_name("nested_scatter")
+  .add_int64_axis("num_rows", {32768, 1048576})
+  .add_int64_axis("depth", {1, 2})
+  .add_int64_axis("list_size", {4, 64})
+  .add_float64_axis("nulls", {0.0, 0.3});
+
+NVBENCH_BENCH(nested_copy_if_else)
+  .set_name("nested_copy_if_else")
+  .add_int64_axis("num_rows", {32768, 1048576})
+  .add_int64_axis("depth", {1, 2})
+  .add_int64_axis("list_size", {4, 64})
+  .add_float64_axis("nulls", {0.0, 0.3});
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <benchmarks/common/benchmark_utilities.hpp>
 #include <benchmarks/common/generate_input.hpp>
 #include <benchmarks/fixture/benchmark_fixture.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
@@ -60,8 +61,10 @@ void BM_scatter(benchmark::State& state)
     cudf::scatter(*source_table, scatter_map, *target_table);
   }
 
-  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * n_cols * 2 *
-                          sizeof(TypeParam));
+  auto const bytes_per_iteration =
+    static_cast<int64_t>(state.range(0)) * n_cols * 2 * sizeof(TypeParam);
+  state.SetBytesProcessed(state.iterations() * bytes_per_iteration);
+  set_peak_bandwidth_utilization(state, bytes_per_iteration);
 }
 
 #define SBM_BENCHMARK_DEFINE(name, type, coalesce)              \
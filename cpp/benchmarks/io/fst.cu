@@ -63,6 +63,33 @@ auto make_test_json_data(nvbench::state& state)
   return cudf::strings::repeat_string(d_string_scalar, repeat_times);
 }
 
+auto make_escaped_json_data(nvbench::state& state)
+{
+  auto const string_size{cudf::size_type(state.get_int64("string_size"))};
+  auto const field_size{state.get_int64("field_size")};
+  auto const escape_percent{state.get_int64("escape_percent")};
+
+  // One string field per record, where approximately `escape_percent` percent of the value's
+  // characters start a two-character escape sequence. Dense escapes maximize the state
+  // transitions through TT_ESC, which is the adversarial case for the FST.
+  std::string value;
+  value.reserve(field_size);
+  auto const escape_stride = escape_percent > 0 ? 100 / escape_percent : 0;
+  for (int64_t i = 0; i < field_size; ++i) {
+    if (escape_stride > 0 && i % escape_stride == 0) {
+      value += R"(\")";
+    } else {
+      value += 'a';
+    }
+  }
+  std::string input = R"( {"key": ")" + value + R"("})";
+
+  auto d_input_scalar                = cudf::make_string_scalar(input);
+  auto& d_string_scalar              = static_cast<cudf::string_scalar&>(*d_input_scalar);
+  cudf::size_type const repeat_times = string_size / input.size();
+  return cudf::strings::repeat_string(d_string_scalar, repeat_times);
+}
+
 // Type used to represent the atomic symbol type used within the finite-state machine
 using SymbolT = char;
 // Type sufficiently large to index symbols within the input and output (may be unsigned)
@@ -233,10 +260,56 @@ void BM_FST_JSON_no_str(nvbench::state& state)
   });
 }
 
+void BM_FST_JSON_escapes(nvbench::state& state)
+{
+  CUDF_EXPECTS(state.get_int64("string_size") <= std::numeric_limits<cudf::size_type>::max(),
+               "Benchmarks only support up to size_type's maximum number of items");
+  // Prepare cuda stream for data transfers & kernels
+  rmm::cuda_stream stream{};
+  rmm::cuda_stream_view stream_view(stream);
+
+  auto input_string = make_escaped_json_data(state);
+  auto& d_input     = static_cast<cudf::scalar_type_t<std::string>&>(*input_string);
+
+  state.add_element_count(d_input.size());
+
+  // Prepare input & output buffers
+  cudf::detail::hostdevice_vector<SymbolT> output_gpu(d_input.size(), stream_view);
+  cudf::detail::hostdevice_vector<SymbolOffsetT> output_gpu_size(single_item, stream_view);
+  cudf::detail::hostdevice_vector<SymbolOffsetT> out_indexes_gpu(d_input.size(), stream_view);
+
+  // Run algorithm
+  auto parser = cudf::io::fst::detail::make_fst(
+    cudf::io::fst::detail::make_symbol_group_lut(pda_sgs),
+    cudf::io::fst::detail::make_transition_table(pda_state_tt),
+    cudf::io::fst::detail::make_translation_table<max_translation_table_size,
+                                                  min_translated_out,
+                                                  max_translated_out>(pda_out_tt),
+    stream);
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    // Allocate device-side temporary storage & run algorithm
+    parser.Transduce(d_input.data(),
+                     static_cast<SymbolOffsetT>(d_input.size()),
+                     output_gpu.device_ptr(),
+                     out_indexes_gpu.device_ptr(),
+                     output_gpu_size.device_ptr(),
+                     start_state,
+                     stream.value());
+  });
+}
+
 NVBENCH_BENCH(BM_FST_JSON)
   .set_name("FST_JSON")
   .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
 
+NVBENCH_BENCH(BM_FST_JSON_escapes)
+  .set_name("FST_JSON_escapes")
+  .add_int64_power_of_two_axis("string_size", nvbench::range(24, 28, 2))
+  .add_int64_axis("field_size", {16, 256, 4096})
+  .add_int64_axis("escape_percent", {0, 10, 50});
+
 NVBENCH_BENCH(BM_FST_JSON_no_outidx)
   .set_name("FST_JSON_no_outidx")
   .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
@@ -152,6 +152,39 @@ auto make_test_json_data(cudf::size_type string_size, rmm::cuda_stream_view stre
 
   return d_scalar;
 }
+
+auto make_escaped_json_data(cudf::size_type string_size,
+                            cudf::size_type field_size,
+                            cudf::size_type escape_percent,
+                            rmm::cuda_stream_view stream)
+{
+  // One string field per record, where approximately `escape_percent` percent of the value's
+  // characters start a two-character escape sequence; dense escapes are the adversarial case
+  // for the tokenizer's string handling
+  std::string value;
+  value.reserve(field_size);
+  auto const escape_stride = escape_percent > 0 ? 100 / escape_percent : 0;
+  for (cudf::size_type i = 0; i < field_size; ++i) {
+    if (escape_stride > 0 && i % escape_stride == 0) {
+      value += R"(\")";
+    } else {
+      value += 'a';
+    }
+  }
+  std::string input = R"( {"a": ")" + value + R"("},)";
+
+  cudf::size_type const repeat_times = string_size / input.size();
+
+  auto d_input_scalar   = cudf::make_string_scalar(input, stream);
+  auto& d_string_scalar = static_cast<cudf::string_scalar&>(*d_input_scalar);
+  auto d_scalar         = cudf::strings::repeat_string(d_string_scalar, repeat_times);
+
+  auto data = const_cast<char*>(d_scalar->data());
+  CUDF_CUDA_TRY(cudaMemsetAsync(data, '[', 1, stream.value()));
+  CUDF_CUDA_TRY(cudaMemsetAsync(data + d_scalar->size() - 1, ']', 1, stream.value()));
+
+  return d_scalar;
+}
 }  // namespace
 
 void BM_NESTED_JSON(nvbench::state& state)
@@ -184,6 +217,41 @@ NVBENCH_BENCH(BM_NESTED_JSON)
   .set_name("nested_json_gpu_parser")
   .add_int64_power_of_two_axis("string_size", nvbench::range(20, 30, 1));
 
+void BM_JSON_TOKENIZER_ESCAPES(nvbench::state& state)
+{
+  auto const string_size{cudf::size_type(state.get_int64("string_size"))};
+  auto const field_size{cudf::size_type(state.get_int64("field_size"))};
+  auto const escape_percent{cudf::size_type(state.get_int64("escape_percent"))};
+  auto const default_options = cudf::io::json_reader_options{};
+
+  auto input =
+    make_escaped_json_data(string_size, field_size, escape_percent, cudf::get_default_stream());
+  state.add_element_count(input->size());
+
+  // Run algorithm
+  auto const mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    // Allocate device-side temporary storage & run algorithm
+    auto const [tokens, token_indices] = cudf::io::json::detail::get_token_stream(
+      cudf::device_span<char const>{input->data(), static_cast<size_t>(input->size())},
+      default_options,
+      cudf::get_default_stream(),
+      cudf::get_current_device_resource_ref());
+  });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(string_size) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+}
+
+NVBENCH_BENCH(BM_JSON_TOKENIZER_ESCAPES)
+  .set_name("json_tokenizer_escapes")
+  .add_int64_power_of_two_axis("string_size", nvbench::range(24, 28, 2))
+  .add_int64_axis("field_size", {16, 256, 4096})
+  .add_int64_axis("escape_percent", {0, 10, 50});
+
 void BM_NESTED_JSON_DEPTH(nvbench::state& state)
 {
   auto const string_size{cudf::size_type(state.get_int64("string_size"))};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -41,10 +41,30 @@ CUDF_KERNEL void init_curand(curandState* state, int const nstates)
   if (ithread < nstates) { curand_init(1234ULL, ithread, 0, state + ithread); }
 }
 
+/**
+ * @brief Draws a zero-based key rank from a zipf distribution over [0, key_range).
+ *
+ * Uses inverse-CDF sampling of the continuous approximation of the zipf distribution,
+ * so rank 0 is the hottest key. An exponent of 1.0 gives classic zipf; larger exponents
+ * concentrate more of the draws on the hottest keys.
+ */
+template <typename key_type>
+__device__ key_type zipf_rank(curandState& state, double const exponent, key_type const key_range)
+{
+  double const u = curand_uniform_double(&state);
+  double const n = static_cast<double>(key_range);
+  double const rank =
+    exponent == 1.0 ? pow(n, u)
+                    : pow(u * (pow(n, 1.0 - exponent) - 1.0) + 1.0, 1.0 / (1.0 - exponent));
+  auto const idx = static_cast<key_type>(rank) - 1;
+  return idx < 0 ? key_type{0} : (idx >= key_range ? key_range - 1 : idx);
+}
+
 template <typename key_type, typename size_type>
 CUDF_KERNEL void init_build_tbl(key_type* const build_tbl,
                                 size_type const build_tbl_size,
                                 int const multiplicity,
+                                double const zipf_exponent,
                                 curandState* state,
                                 int const num_states)
 {
@@ -54,11 +74,16 @@ CUDF_KERNEL void init_build_tbl(key_type* const build_tbl,
 
   curandState localState = state[start_idx];
 
+  auto const key_range = static_cast<key_type>(build_tbl_size / multiplicity);
   for (cudf::thread_index_type tidx = start_idx; tidx < build_tbl_size; tidx += stride) {
     auto const idx = static_cast<size_type>(tidx);
-    double const x = curand_uniform_double(&localState);
 
-    build_tbl[idx] = static_cast<key_type>(x * (build_tbl_size / multiplicity));
+    if (zipf_exponent > 0.0) {
+      build_tbl[idx] = zipf_rank(localState, zipf_exponent, key_range);
+    } else {
+      double const x = curand_uniform_double(&localState);
+      build_tbl[idx] = static_cast<key_type>(x * key_range);
+    }
   }
 
   state[start_idx] = localState;
@@ -71,6 +96,7 @@ CUDF_KERNEL void init_probe_tbl(key_type* const probe_tbl,
                                 key_type const rand_max,
                                 double const selectivity,
                                 int const multiplicity,
+                                double const zipf_exponent,
                                 curandState* state,
                                 int const num_states)
 {
@@ -88,8 +114,13 @@ CUDF_KERNEL void init_probe_tbl(key_type* const probe_tbl,
     if (x <= selectivity) {
       // x <= selectivity means this key in the probe table should be present in the build table, so
       // we pick a key from [0, build_tbl_size / multiplicity]
-      x   = curand_uniform_double(&localState);
-      val = static_cast<key_type>(x * (build_tbl_size / multiplicity));
+      auto const key_range = static_cast<key_type>(build_tbl_size / multiplicity);
+      if (zipf_exponent > 0.0) {
+        val = zipf_rank(localState, zipf_exponent, key_range);
+      } else {
+        x   = curand_uniform_double(&localState);
+        val = static_cast<key_type>(x * key_range);
+      }
     } else {
       // This key in the probe table should not be present in the build table, so we pick a key from
       // [build_tbl_size, rand_max].
@@ -125,6 +156,11 @@ CUDF_KERNEL void init_probe_tbl(key_type* const probe_tbl,
  * @param[in] selectivity           probability with which an element of the probe table is
  *                                  present in the build table.
  * @param[in] multiplicity          number of matches for each key.
+ * @param[in] zipf_exponent         exponent of the zipf distribution used to draw keys; 0 (the
+ *                                  default) keeps the original uniform key distribution. With a
+ *                                  positive exponent low-numbered keys are drawn far more often,
+ *                                  modeling skewed workloads where a few hot keys dominate the
+ *                                  join output.
  */
 template <typename key_type, typename size_type>
 void generate_input_tables(key_type* const build_tbl,
@@ -132,7 +168,8 @@ void generate_input_tables(key_type* const build_tbl,
                            key_type* const probe_tbl,
                            size_type const probe_tbl_size,
                            double const selectivity,
-                           int const multiplicity)
+                           int const multiplicity,
+                           double const zipf_exponent = 0.0)
 {
   // With large values of rand_max the a lot of temporary storage is needed for the lottery. At the
   // expense of not being that accurate with applying the selectivity an especially more memory
@@ -161,7 +198,7 @@ void generate_input_tables(key_type* const build_tbl,
   CUDF_CHECK_CUDA(0);
 
   init_build_tbl<key_type, size_type><<<num_sms * num_blocks_init_build_tbl, block_size>>>(
-    build_tbl, build_tbl_size, multiplicity, devStates.data(), num_states);
+    build_tbl, build_tbl_size, multiplicity, zipf_exponent, devStates.data(), num_states);
 
   CUDF_CHECK_CUDA(0);
 
@@ -174,6 +211,7 @@ void generate_input_tables(key_type* const build_tbl,
                                                           rand_max,
                                                           selectivity,
                                                           multiplicity,
+                                                          zipf_exponent,
                                                           devStates.data(),
                                                           num_states);
 
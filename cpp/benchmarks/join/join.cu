@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -56,6 +56,18 @@ NVBENCH_BENCH_TYPES(nvbench_inner_join, NVBENCH_TYPE_AXES(JOIN_KEY_TYPE_RANGE, J
   .add_int64_axis("left_size", JOIN_SIZE_RANGE)
   .add_int64_axis("right_size", JOIN_SIZE_RANGE);
 
+// Skewed variant: zipf-distributed probe keys and duplicated build keys, so joins where a few
+// hot keys dominate the output (and its size-estimation/gather cost) are measured explicitly
+NVBENCH_BENCH_TYPES(nvbench_inner_join,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t>,
+                                      nvbench::enum_type_list<false>))
+  .set_name("inner_join_skewed")
+  .set_type_axes_names({"Key", "Nullable"})
+  .add_int64_axis("left_size", {10'000'000})
+  .add_int64_axis("right_size", {100'000, 10'000'000})
+  .add_int64_axis("multiplicity", {1, 16, 256})
+  .add_float64_axis("skew", {0.5, 1.0, 1.5});
+
 NVBENCH_BENCH_TYPES(nvbench_left_join, NVBENCH_TYPE_AXES(JOIN_KEY_TYPE_RANGE, JOIN_NULLABLE_RANGE))
   .set_name("left_join")
   .set_type_axes_names({"Key", "Nullable"})
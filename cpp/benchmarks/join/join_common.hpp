@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -31,6 +31,8 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
+#include <rmm/device_uvector.hpp>
+
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -39,6 +41,8 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 using JOIN_KEY_TYPE_RANGE = nvbench::type_list<nvbench::int32_t, nvbench::int64_t>;
@@ -60,6 +64,21 @@ struct null75_generator {
 
 enum class join_t { CONDITIONAL, MIXED, HASH };
 
+// Number of rows a join produced, whichever index-vector form the join API returns. Used to
+// report the output size next to the timing so output-driven cost (e.g. under heavy key skew)
+// is distinguishable from probe-side cost.
+inline std::size_t output_row_count(
+  std::unique_ptr<rmm::device_uvector<cudf::size_type>> const& result)
+{
+  return result->size();
+}
+
+template <typename Left, typename Right>
+std::size_t output_row_count(std::pair<Left, Right> const& result)
+{
+  return output_row_count(result.first);
+}
+
 template <typename Key,
           bool Nullable,
           join_t join_type = join_t::HASH,
@@ -76,7 +95,9 @@ void BM_join(state_type& state, Join JoinFunc)
   }
 
   double const selectivity = 0.3;
-  int const multiplicity   = 1;
+  // Optional axes: benchmarks without them keep the original uniform, unique-key behavior
+  auto const multiplicity = static_cast<int>(state.get_int64_or_default("multiplicity", 1));
+  auto const skew         = state.get_float64_or_default("skew", 0.0);
 
   // Generate build and probe tables
   auto right_random_null_mask = [](int size) {
@@ -115,7 +136,8 @@ void BM_join(state_type& state, Join JoinFunc)
                                               left_key_column0->mutable_view().data<Key>(),
                                               left_size,
                                               selectivity,
-                                              multiplicity);
+                                              multiplicity,
+                                              skew);
 
   // Copy right_key_column0 and left_key_column0 into new columns.
   // If Nullable, the new columns will be assigned new nullmasks.
@@ -155,6 +177,10 @@ void BM_join(state_type& state, Join JoinFunc)
     auto const col_ref_right_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
     auto left_zero_eq_right_zero =
       cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_left_0, col_ref_right_0);
+    state.add_element_count(
+      output_row_count(
+        JoinFunc(left_table, right_table, left_zero_eq_right_zero, cudf::null_equality::UNEQUAL)),
+      "output_rows");
     state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       auto result =
         JoinFunc(left_table, right_table, left_zero_eq_right_zero, cudf::null_equality::UNEQUAL);
@@ -166,6 +192,13 @@ void BM_join(state_type& state, Join JoinFunc)
     auto const col_ref_right_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
     auto left_zero_eq_right_zero =
       cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_left_0, col_ref_right_0);
+    state.add_element_count(output_row_count(JoinFunc(left_table.select(columns_to_join),
+                                                      right_table.select(columns_to_join),
+                                                      left_table.select({1}),
+                                                      right_table.select({1}),
+                                                      left_zero_eq_right_zero,
+                                                      cudf::null_equality::UNEQUAL)),
+                            "output_rows");
     state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       auto result = JoinFunc(left_table.select(columns_to_join),
                              right_table.select(columns_to_join),
@@ -176,6 +209,10 @@ void BM_join(state_type& state, Join JoinFunc)
     });
   }
   if constexpr (join_type == join_t::HASH) {
+    state.add_element_count(output_row_count(JoinFunc(left_table.select(columns_to_join),
+                                                      right_table.select(columns_to_join),
+                                                      cudf::null_equality::UNEQUAL)),
+                            "output_rows");
     state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       auto result = JoinFunc(left_table.select(columns_to_join),
                              right_table.select(columns_to_join),
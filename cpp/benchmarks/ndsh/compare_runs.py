@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024, NVIDIA CORPORATION.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compare two NDS-H benchmark runs and flag regressions.
+
+Produce the inputs by running each NDS-H benchmark binary with ``--json``:
+
+    NDSH_Q03_NVBENCH --json baseline_q03.json
+
+Multiple result files per run can be passed by repeating the arguments, e.g.
+after sweeping scale factors with ``--axis scale_factor=[0.01,0.1,1]``.
+Entries are matched on benchmark name and axis values; the compared metric is
+the mean cold GPU time. Exits with a nonzero status if any benchmark slowed
+down by more than the threshold (5% by default).
+"""
+
+import argparse
+import json
+import sys
+
+GPU_TIME_TAG = "nv/cold/time/gpu/mean"
+
+
+def load_results(paths):
+    """Map (benchmark name, axis values) -> mean GPU time in seconds."""
+    results = {}
+    for path in paths:
+        with open(path) as f:
+            doc = json.load(f)
+        for bench in doc.get("benchmarks", []):
+            for state in bench.get("states", []):
+                axes = tuple(
+                    (axis["name"], axis["value"]) for axis in state.get("axis_values", [])
+                )
+                time = None
+                for summary in state.get("summaries", []):
+                    if summary.get("tag") == GPU_TIME_TAG:
+                        for item in summary.get("data", []):
+                            if item.get("name") == "value":
+                                time = float(item["value"])
+                if time is not None:
+                    results[(bench["name"], axes)] = time
+    return results
+
+
+def format_key(key):
+    name, axes = key
+    if not axes:
+        return name
+    return "{} [{}]".format(name, ", ".join(f"{k}={v}" for k, v in axes))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", nargs="+", help="nvbench JSON files for the baseline run")
+    parser.add_argument(
+        "--contender",
+        nargs="+",
+        required=True,
+        help="nvbench JSON files for the contender run",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative slowdown treated as a regression (default: 0.05)",
+    )
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    contender = load_results(args.contender)
+
+    common = sorted(baseline.keys() & contender.keys())
+    if not common:
+        sys.exit("No common benchmark entries between the two runs")
+
+    regressions = []
+    for key in common:
+        ref, cmp = baseline[key], contender[key]
+        diff = (cmp - ref) / ref
+        status = "OK"
+        if diff > args.threshold:
+            status = "REGRESSED"
+            regressions.append(key)
+        print(
+            f"{format_key(key):<60} {ref * 1e3:>10.3f} ms {cmp * 1e3:>10.3f} ms "
+            f"{diff:>+8.1%}  {status}"
+        )
+
+    for key in sorted(baseline.keys() ^ contender.keys()):
+        which = "baseline" if key in baseline else "contender"
+        print(f"{format_key(key):<60} only in {which}, skipped")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) regressed more than {args.threshold:.0%}")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
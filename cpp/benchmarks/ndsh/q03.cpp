@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities.hpp"
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+/**
+ * @file q03.cpp
+ * @brief Implement query 3 of the NDS-H benchmark.
+ *
+ * create view customer as select * from '/tables/scale-1/customer.parquet';
+ * create view orders as select * from '/tables/scale-1/orders.parquet';
+ * create view lineitem as select * from '/tables/scale-1/lineitem.parquet';
+ *
+ * select
+ *    l_orderkey,
+ *    sum(l_extendedprice * (1 - l_discount)) as revenue,
+ *    o_orderdate,
+ *    o_shippriority
+ * from
+ *    customer,
+ *    orders,
+ *    lineitem
+ * where
+ *    c_mktsegment = 'BUILDING'
+ *    and c_custkey = o_custkey
+ *    and l_orderkey = o_orderkey
+ *    and o_orderdate < date '1995-03-15'
+ *    and l_shipdate > date '1995-03-15'
+ * group by
+ *    l_orderkey,
+ *    o_orderdate,
+ *    o_shippriority
+ * order by
+ *    revenue desc,
+ *    o_orderdate;
+ */
+
+/**
+ * @brief Calculate the revenue column
+ *
+ * @param extendedprice The extended price column
+ * @param discount The discount column
+ * @param stream The CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ */
+[[nodiscard]] std::unique_ptr<cudf::column> calculate_revenue(
+  cudf::column_view const& extendedprice,
+  cudf::column_view const& discount,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref())
+{
+  auto const one = cudf::numeric_scalar<double>(1);
+  auto const one_minus_discount =
+    cudf::binary_operation(one, discount, cudf::binary_operator::SUB, discount.type(), stream, mr);
+  auto const revenue_type = cudf::data_type{cudf::type_id::FLOAT64};
+  auto revenue            = cudf::binary_operation(extendedprice,
+                                        one_minus_discount->view(),
+                                        cudf::binary_operator::MUL,
+                                        revenue_type,
+                                        stream,
+                                        mr);
+  return revenue;
+}
+
+void run_ndsh_q3(nvbench::state& state,
+                 std::unordered_map<std::string, cuio_source_sink_pair>& sources)
+{
+  // Define the column projection and filter predicate for the `customer` table
+  std::vector<std::string> const customer_cols = {"c_custkey", "c_mktsegment"};
+  auto const c_mktsegment_ref                  = cudf::ast::column_reference(
+    std::distance(customer_cols.begin(),
+                  std::find(customer_cols.begin(), customer_cols.end(), "c_mktsegment")));
+  auto c_mktsegment_value           = cudf::string_scalar("BUILDING");
+  auto const c_mktsegment_literal   = cudf::ast::literal(c_mktsegment_value);
+  auto const customer_pred          = std::make_unique<cudf::ast::operation>(
+    cudf::ast::ast_operator::EQUAL, c_mktsegment_ref, c_mktsegment_literal);
+
+  // Define the column projection and filter predicate for the `orders` table
+  std::vector<std::string> const orders_cols = {
+    "o_custkey", "o_orderkey", "o_orderdate", "o_shippriority"};
+  auto const o_orderdate_ref = cudf::ast::column_reference(std::distance(
+    orders_cols.begin(), std::find(orders_cols.begin(), orders_cols.end(), "o_orderdate")));
+  auto o_orderdate_upper =
+    cudf::timestamp_scalar<cudf::timestamp_D>(days_since_epoch(1995, 3, 15), true);
+  auto const o_orderdate_upper_limit = cudf::ast::literal(o_orderdate_upper);
+  auto const orders_pred             = std::make_unique<cudf::ast::operation>(
+    cudf::ast::ast_operator::LESS, o_orderdate_ref, o_orderdate_upper_limit);
+
+  // Define the column projection and filter predicate for the `lineitem` table
+  std::vector<std::string> const lineitem_cols = {
+    "l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"};
+  auto const l_shipdate_ref = cudf::ast::column_reference(std::distance(
+    lineitem_cols.begin(), std::find(lineitem_cols.begin(), lineitem_cols.end(), "l_shipdate")));
+  auto l_shipdate_lower =
+    cudf::timestamp_scalar<cudf::timestamp_D>(days_since_epoch(1995, 3, 15), true);
+  auto const l_shipdate_lower_limit = cudf::ast::literal(l_shipdate_lower);
+  auto const lineitem_pred          = std::make_unique<cudf::ast::operation>(
+    cudf::ast::ast_operator::GREATER, l_shipdate_ref, l_shipdate_lower_limit);
+
+  // Read out the tables from parquet files
+  // while pushing down the column projections and filter predicates
+  auto const customer = read_parquet(
+    sources.at("customer").make_source_info(), customer_cols, std::move(customer_pred));
+  auto const orders =
+    read_parquet(sources.at("orders").make_source_info(), orders_cols, std::move(orders_pred));
+  auto const lineitem =
+    read_parquet(sources.at("lineitem").make_source_info(), lineitem_cols, std::move(lineitem_pred));
+
+  // Perform the joins
+  auto const join_a       = apply_inner_join(customer, orders, {"c_custkey"}, {"o_custkey"});
+  auto const joined_table = apply_inner_join(lineitem, join_a, {"l_orderkey"}, {"o_orderkey"});
+
+  // Calculate and append the `revenue` column
+  auto revenue =
+    calculate_revenue(joined_table->column("l_extendedprice"), joined_table->column("l_discount"));
+  (*joined_table).append(revenue, "revenue");
+
+  // Perform the groupby operation
+  auto const groupedby_table =
+    apply_groupby(joined_table,
+                  groupby_context_t{{"l_orderkey", "o_orderdate", "o_shippriority"},
+                                    {
+                                      {"revenue", {{cudf::aggregation::Kind::SUM, "revenue"}}},
+                                    }});
+
+  // Perform the order by operation
+  auto const orderedby_table = apply_orderby(groupedby_table,
+                                             {"revenue", "o_orderdate"},
+                                             {cudf::order::DESCENDING, cudf::order::ASCENDING});
+
+  // Write query result to a parquet file
+  orderedby_table->to_parquet("q3.parquet");
+}
+
+void ndsh_q3(nvbench::state& state)
+{
+  // Generate the required parquet files in device buffers
+  double const scale_factor = state.get_float64("scale_factor");
+  std::unordered_map<std::string, cuio_source_sink_pair> sources;
+  generate_parquet_data_sources(scale_factor, {"customer", "orders", "lineitem"}, sources);
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) { run_ndsh_q3(state, sources); });
+}
+
+NVBENCH_BENCH(ndsh_q3).set_name("ndsh_q3").add_float64_axis("scale_factor", {0.01, 0.1, 1});
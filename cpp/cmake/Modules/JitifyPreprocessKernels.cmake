@@ -60,8 +60,8 @@ if(NOT (EXISTS "${CUDF_GENERATED_INCLUDE_DIR}/include"))
 endif()
 
 jit_preprocess_files(
-  SOURCE_DIRECTORY ${CUDF_SOURCE_DIR}/src FILES binaryop/jit/kernel.cu transform/jit/kernel.cu
-  rolling/jit/kernel.cu
+  SOURCE_DIRECTORY ${CUDF_SOURCE_DIR}/src FILES binaryop/jit/kernel.cu groupby/jit/kernel.cu
+  transform/jit/kernel.cu transform/jit/row_kernel.cu rolling/jit/kernel.cu
 )
 
 add_custom_target(
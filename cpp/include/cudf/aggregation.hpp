@@ -120,8 +120,11 @@ class aggregation {
     CORRELATION,     ///< correlation between two sets of elements
     TDIGEST,         ///< create a tdigest from a set of input values
     MERGE_TDIGEST,   ///< create a tdigest by merging multiple tdigests together
-    HISTOGRAM,       ///< compute frequency of each element
-    MERGE_HISTOGRAM  ///< merge partial values of HISTOGRAM aggregation
+    HISTOGRAM,        ///< compute frequency of each element
+    MERGE_HISTOGRAM,  ///< merge partial values of HISTOGRAM aggregation
+    MAX_BY,           ///< payload of the row with the maximum ordering value
+    MIN_BY,           ///< payload of the row with the minimum ordering value
+    TOP_K_BY          ///< payloads of the k rows with the most extreme ordering values
   };
 
   aggregation() = delete;
@@ -589,6 +592,10 @@ std::unique_ptr<Base> make_lead_aggregation(size_type offset);
 /**
  * @brief Factory to create an aggregation base on UDF for PTX or CUDA
  *
+ * The aggregator is JIT-compiled and runs entirely on the device. In rolling it is invoked once
+ * per window; in sort-based groupby it is invoked once per group over that group's contiguous
+ * values, so custom aggregates do not round-trip through host logic.
+ *
  * @param[in] type: either udf_type::PTX or udf_type::CUDA
  * @param[in] user_defined_aggregator A string containing the aggregator code
  * @param[in] output_type expected output type
@@ -681,6 +688,48 @@ std::unique_ptr<Base> make_merge_m2_aggregation();
 template <typename Base = aggregation>
 std::unique_ptr<Base> make_merge_histogram_aggregation();
 
+/**
+ * @brief Factory to create a MAX_BY aggregation
+ *
+ * Emits, for each group, the payload of the row whose ordering value is the group's maximum.
+ * The input column must be a non-nullable struct column whose first child is the ordering column
+ * and whose remaining children are the payload; the output is a struct of the payload children
+ * with one row per group. Null ordering values are ignored; a group whose ordering values are all
+ * null produces a null row.
+ *
+ * @return A MAX_BY aggregation object
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_max_by_aggregation();
+
+/**
+ * @brief Factory to create a MIN_BY aggregation
+ *
+ * Equivalent to `MAX_BY` except that the row with the group's minimum ordering value is emitted.
+ *
+ * @return A MIN_BY aggregation object
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_min_by_aggregation();
+
+/**
+ * @brief Factory to create a TOP_K_BY aggregation
+ *
+ * Emits, for each group, a list of the payloads of the `k` rows with the most extreme ordering
+ * values, ordered best first. The input column must be a non-nullable struct column whose first
+ * child is the ordering column and whose remaining children are the payload; the output is a list
+ * column of payload structs with one list row per group. Groups smaller than `k` emit all their
+ * rows; null ordering values rank last.
+ *
+ * @param k The number of rows to keep per group
+ * @param topk_order Whether the rows with the largest (`DESCENDING`, the default) or smallest
+ *        (`ASCENDING`) ordering values are kept
+ * @return A TOP_K_BY aggregation object
+ */
+template <typename Base = aggregation>
+std::unique_ptr<Base> make_top_k_by_aggregation(size_type k,
+                                                order topk_order = order::DESCENDING);
+
 /**
  * @brief Factory to create a COVARIANCE aggregation
  *
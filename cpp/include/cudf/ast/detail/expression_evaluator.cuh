@@ -261,9 +261,10 @@ struct expression_evaluator {
   /**
    * @brief Resolves an input data reference into a value.
    *
-   * Only input columns (COLUMN), literal values (LITERAL), and intermediates (INTERMEDIATE) are
-   * supported as input data references. Intermediates must be of fixed width less than or equal to
-   * sizeof(std::int64_t). This requirement on intermediates is enforced by the linearizer.
+   * Input columns (COLUMN), literal values (LITERAL), intermediates (INTERMEDIATE) and row
+   * indices (ROW_INDEX) are supported as input data references. Intermediates must be of fixed
+   * width less than or equal to sizeof(std::int64_t). This requirement on intermediates is
+   * enforced by the linearizer.
    *
    * @tparam Element Type of element to return.
    * @tparam has_nulls Whether or not the result data is nullable.
@@ -298,6 +299,14 @@ struct expression_evaluator {
       } else {
         return ReturnType(table.column(input_reference.data_index).element<Element>(row_index));
       }
+    } else if (input_reference.reference_type == detail::device_data_reference_type::ROW_INDEX) {
+      auto const row_index =
+        (input_reference.table_source == table_reference::LEFT) ? left_row_index : right_row_index;
+      if constexpr (std::is_same_v<Element, cudf::size_type>) {
+        return ReturnType(row_index);
+      } else {
+        CUDF_UNREACHABLE("Row index references must resolve to size_type.");
+      }
     } else if (input_reference.reference_type == detail::device_data_reference_type::LITERAL) {
       if constexpr (has_nulls) {
         return plan.literals[input_reference.data_index].is_valid()
@@ -38,9 +38,10 @@ namespace ast::detail {
  * linearization process but cannot be explicitly created by the user.
  */
 enum class device_data_reference_type {
-  COLUMN,       ///< A value in a table column
-  LITERAL,      ///< A literal value
-  INTERMEDIATE  ///< An internal temporary value
+  COLUMN,        ///< A value in a table column
+  LITERAL,       ///< A literal value
+  INTERMEDIATE,  ///< An internal temporary value
+  ROW_INDEX      ///< The index of the row being evaluated
 };
 
 /**
@@ -182,6 +183,14 @@ class expression_parser {
    * @return cudf::size_type Index of device data reference for the expression.
    */
   cudf::size_type visit(column_name_reference const& expr);
+
+  /**
+   * @brief Visit a row index reference expression.
+   *
+   * @param expr Row index reference expression.
+   * @return cudf::size_type Index of device data reference for the expression.
+   */
+  cudf::size_type visit(row_index_reference const& expr);
   /**
    * @brief Internal class used to track the utilization of intermediate storage locations.
    *
@@ -60,6 +60,20 @@ class expression_transformer {
    */
   virtual std::reference_wrapper<expression const> visit(column_name_reference const& expr) = 0;
 
+  /**
+   * @brief Visit a row index reference expression.
+   *
+   * Not pure virtual so that transformers written before row index references existed do
+   * not need to handle them; the default rejects the expression.
+   *
+   * @param expr Row index reference expression
+   * @return Reference wrapper of transformed expression
+   */
+  virtual std::reference_wrapper<expression const> visit(row_index_reference const& expr)
+  {
+    CUDF_FAIL("Row index references are not supported by this expression transformer.");
+  }
+
   virtual ~expression_transformer() {}
 };
 
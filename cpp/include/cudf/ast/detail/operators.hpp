@@ -16,6 +16,8 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/error.hpp>
@@ -141,6 +143,18 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::NULL_LOGICAL_OR:
       f.template operator()<ast_operator::NULL_LOGICAL_OR>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::CONTAINS:
+      f.template operator()<ast_operator::CONTAINS>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::STARTS_WITH:
+      f.template operator()<ast_operator::STARTS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::ENDS_WITH:
+      f.template operator()<ast_operator::ENDS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::LIKE:
+      f.template operator()<ast_operator::LIKE>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::IDENTITY:
       f.template operator()<ast_operator::IDENTITY>(std::forward<Ts>(args)...);
       break;
@@ -213,6 +227,9 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::NOT:
       f.template operator()<ast_operator::NOT>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::LENGTH:
+      f.template operator()<ast_operator::LENGTH>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::CAST_TO_INT64:
       f.template operator()<ast_operator::CAST_TO_INT64>(std::forward<Ts>(args)...);
       break;
@@ -546,6 +563,110 @@ template <>
 struct operator_functor<ast_operator::NULL_LOGICAL_OR, false>
   : public operator_functor<ast_operator::LOGICAL_OR, false> {};
 
+template <>
+struct operator_functor<ast_operator::CONTAINS, false> {
+  static constexpr auto arity{2};
+
+  __device__ inline bool operator()(cudf::string_view lhs, cudf::string_view rhs)
+  {
+    return lhs.find(rhs) != cudf::string_view::npos;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::STARTS_WITH, false> {
+  static constexpr auto arity{2};
+
+  __device__ inline bool operator()(cudf::string_view lhs, cudf::string_view rhs)
+  {
+    return rhs.size_bytes() <= lhs.size_bytes() && rhs.compare(lhs.data(), rhs.size_bytes()) == 0;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::ENDS_WITH, false> {
+  static constexpr auto arity{2};
+
+  __device__ inline bool operator()(cudf::string_view lhs, cudf::string_view rhs)
+  {
+    return rhs.size_bytes() <= lhs.size_bytes() &&
+           rhs.compare(lhs.data() + lhs.size_bytes() - rhs.size_bytes(), rhs.size_bytes()) == 0;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::LIKE, false> {
+  static constexpr auto arity{2};
+
+  /**
+   * @brief Matches `target` against the SQL LIKE pattern `pattern`
+   *
+   * Follows the same algorithm as `cudf::strings::like`: the pattern is walked by
+   * character while the target is walked by bytes, backtracking to the position saved
+   * at the last '%' on a mismatch. No escape character is supported.
+   */
+  __device__ inline bool operator()(cudf::string_view target, cudf::string_view pattern)
+  {
+    auto target_itr  = target.data();
+    auto pattern_itr = pattern.begin();
+
+    auto const target_end  = target_itr + target.size_bytes();
+    auto const pattern_end = pattern.end();
+
+    auto last_target_itr  = target_end;
+    auto last_pattern_itr = pattern_end;
+
+    bool result = true;
+    while (true) {
+      // walk through the pattern and check against the current character
+      while (pattern_itr < pattern_end) {
+        auto const pattern_char = *pattern_itr;
+
+        if (pattern_char != '%') {
+          size_type char_width = 0;
+          // check match with the current character
+          result = (target_itr != target_end);
+          if (result) {
+            if (pattern_char != '_') {
+              char_utf8 target_char = 0;
+              // retrieve the target character to compare with the current pattern_char
+              char_width = strings::detail::to_char_utf8(target_itr, target_char);
+              result     = (pattern_char == target_char);
+            }
+          }
+          if (!result) { break; }
+          ++pattern_itr;
+          target_itr +=
+            char_width ? char_width : strings::detail::bytes_in_utf8_byte(*target_itr);
+        } else {
+          // process wildcard '%'
+          result = true;
+          ++pattern_itr;
+          if (pattern_itr == pattern_end) {  // pattern ends with '%' so we are done
+            target_itr = target_end;
+            break;
+          }
+          // save positions
+          last_pattern_itr = pattern_itr;
+          last_target_itr  = target_itr;
+        }  // next pattern character
+      }
+
+      if (result && (target_itr == target_end)) { break; }  // success
+
+      result = false;
+      // check if exhausted either the pattern or the target string
+      if (last_pattern_itr == pattern_end || last_target_itr == target_end) { break; }
+
+      // restore saved positions
+      pattern_itr = last_pattern_itr;
+      last_target_itr += strings::detail::bytes_in_utf8_byte(*last_target_itr);
+      target_itr = last_target_itr;
+    }
+    return result;
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::IDENTITY, false> {
   static constexpr auto arity{1};
@@ -817,6 +938,13 @@ struct operator_functor<ast_operator::NOT, false> {
   }
 };
 
+template <>
+struct operator_functor<ast_operator::LENGTH, false> {
+  static constexpr auto arity{1};
+
+  __device__ inline size_type operator()(cudf::string_view input) { return input.length(); }
+};
+
 template <typename To>
 struct cast {
   static constexpr auto arity{1};
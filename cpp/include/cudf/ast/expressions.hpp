@@ -127,6 +127,12 @@ enum class ast_operator : int32_t {
                      ///< NULL_LOGICAL_OR(null, true) is true,
                      ///< NULL_LOGICAL_OR(null, false) is null, and NULL_LOGICAL_OR(valid, valid) ==
                      ///< LOGICAL_OR(valid, valid)
+  CONTAINS,          ///< Check if the left string contains the right string
+  STARTS_WITH,       ///< Check if the left string starts with the right string
+  ENDS_WITH,         ///< Check if the left string ends with the right string
+  LIKE,              ///< Match the left string against the right SQL LIKE pattern, where '%'
+                     ///< matches any sequence of characters and '_' matches any single
+                     ///< character; no escape character is supported
   // Unary operators
   IDENTITY,        ///< Identity function
   IS_NULL,         ///< Check if operand is null
@@ -152,6 +158,7 @@ enum class ast_operator : int32_t {
   RINT,            ///< Rounds the floating-point argument arg to an integer value
   BIT_INVERT,      ///< Bitwise Not (~)
   NOT,             ///< Logical Not (!)
+  LENGTH,          ///< Number of characters in a string
   CAST_TO_INT64,   ///< Cast value to int64_t
   CAST_TO_UINT64,  ///< Cast value to uint64_t
   CAST_TO_FLOAT64  ///< Cast value to double
@@ -188,6 +195,13 @@ class generic_scalar_device_view : public cudf::detail::scalar_device_view_base
     return *static_cast<T const*>(_data);
   }
 
+  /**
+   * @brief Returns the pointer to the value in device memory.
+   *
+   * @returns Pointer to the device memory containing the value
+   */
+  [[nodiscard]] void const* data() const noexcept { return _data; }
+
   /** @brief Construct a new generic scalar device view object from a numeric scalar
    *
    * @param s The numeric scalar to construct from
@@ -439,6 +453,65 @@ class column_reference : public expression {
   table_reference table_source;
 };
 
+/**
+ * @brief An expression that evaluates to the current row index.
+ *
+ * The index is generated directly by the expression evaluator rather than read from a
+ * column, so sequence-like inputs (e.g. `init + step * row_index`) can be written as part
+ * of a larger expression and fused into the single `compute_column` or conditional join
+ * kernel instead of materializing a counting column first. The result type is `INT32`.
+ */
+class row_index_reference : public expression {
+ public:
+  /**
+   * @brief Construct a new row index reference object
+   *
+   * @param table_source Which table's row index to use in cases with two tables (e.g. joins)
+   */
+  row_index_reference(table_reference table_source = table_reference::LEFT)
+    : table_source(table_source)
+  {
+  }
+
+  /**
+   * @brief Get the table source.
+   *
+   * @return table_reference The reference to the table whose row index is produced
+   */
+  [[nodiscard]] table_reference get_table_source() const { return table_source; }
+
+  /**
+   * @brief Get the data type.
+   *
+   * @return The data type of the row index
+   */
+  [[nodiscard]] cudf::data_type get_data_type() const
+  {
+    return cudf::data_type{cudf::type_id::INT32};
+  }
+
+  /**
+   * @copydoc expression::accept
+   */
+  cudf::size_type accept(detail::expression_parser& visitor) const override;
+
+  /**
+   * @copydoc expression::accept
+   */
+  std::reference_wrapper<expression const> accept(
+    detail::expression_transformer& visitor) const override;
+
+  [[nodiscard]] bool may_evaluate_null(table_view const& left,
+                                       table_view const& right,
+                                       rmm::cuda_stream_view stream) const override
+  {
+    return false;
+  }
+
+ private:
+  table_reference table_source;
+};
+
 /**
  * @brief An operation expression holds an operator and zero or more operands.
  */
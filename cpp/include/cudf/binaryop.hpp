@@ -263,6 +263,63 @@ std::unique_ptr<column> binary_operation(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Computes `(x * y) + z` element-wise in a single fused kernel
+ *
+ * This is equivalent to chaining two `binary_operation` calls but evaluates
+ * the whole expression in one pass with no temporary column for the product.
+ * Operand types follow the same promotion rules as the equivalent AST
+ * expression; any null operand produces a null output row.
+ *
+ * @throw std::invalid_argument if the column sizes don't match
+ * @throw cudf::logic_error if the operand types are not numeric
+ *
+ * @param x      The first factor column
+ * @param y      The second factor column
+ * @param z      The addend column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr     Device memory resource used to allocate the returned column's device memory
+ * @return       Output column containing `(x * y) + z` for each row
+ */
+std::unique_ptr<column> fused_multiply_add(
+  column_view const& x,
+  column_view const& y,
+  column_view const& z,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Computes `(lhs compare_op rhs) ? true_values : false_values` element-wise
+ *
+ * When all four columns share the same fixed-width type and none contain
+ * nulls, the comparison and selection run in a single fused kernel with no
+ * temporary boolean column. Otherwise the operation falls back to
+ * `binary_operation` followed by `copy_if_else`; in that case a null
+ * comparison result selects from `false_values`.
+ *
+ * @throw std::invalid_argument if the column sizes don't match
+ * @throw std::invalid_argument if `compare_op` is not a comparison operator
+ * @throw cudf::data_type_error if `true_values` and `false_values` types differ
+ *
+ * @param lhs          The left comparison operand column
+ * @param rhs          The right comparison operand column
+ * @param compare_op   The comparison operator; one of EQUAL, NOT_EQUAL, LESS,
+ *                     GREATER, LESS_EQUAL, GREATER_EQUAL
+ * @param true_values  Values selected where the comparison is true
+ * @param false_values Values selected where the comparison is false
+ * @param stream       CUDA stream used for device memory operations and kernel launches
+ * @param mr           Device memory resource used to allocate the returned column's device memory
+ * @return             Output column of selected values
+ */
+std::unique_ptr<column> compare_and_select(
+  column_view const& lhs,
+  column_view const& rhs,
+  binary_operator compare_op,
+  column_view const& true_values,
+  column_view const& false_values,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Computes the `scale` for a `fixed_point` number based on given binary operator `op`
  *
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -348,6 +349,50 @@ std::unique_ptr<column> make_fixed_width_column(
   return make_numeric_column(type, size, std::forward<B>(null_mask), null_count, stream, mr);
 }
 
+/**
+ * @brief A table of fixed-width columns suballocated from a single device buffer.
+ *
+ * The column views alias regions of `all_data`; they remain valid only as long as `all_data`
+ * is alive, and individual columns cannot be released separately.
+ */
+struct bulk_allocated_table {
+  std::unique_ptr<rmm::device_buffer> all_data;  ///< The single allocation backing every column
+  std::vector<mutable_column_view> columns;      ///< Views of the columns within `all_data`
+
+  /**
+   * @brief Returns a mutable table view of the suballocated columns.
+   *
+   * @return Mutable table view over `columns`
+   */
+  [[nodiscard]] mutable_table_view view() const { return mutable_table_view{columns}; }
+};
+
+/**
+ * @brief Allocates storage for a table of fixed-width columns in one device allocation.
+ *
+ * Computes the total size of all column data and null masks, each suballocated region padded
+ * to the CUDA allocation alignment, and services the whole table from a single buffer. This
+ * turns the N allocator round-trips of allocating wide output tables column-by-column into
+ * one and keeps the columns adjacent in memory.
+ *
+ * @throws cudf::data_type_error if any element of `types` is not a fixed width type
+ * @throws cudf::logic_error if `size < 0`
+ *
+ * @param types The desired fixed width type of each column
+ * @param size The number of elements in each column
+ * @param state Optional, controls allocation/initialization of the columns' null masks. By
+ * default, no null masks are allocated.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Constructed table storage and views of its columns
+ */
+bulk_allocated_table make_fixed_width_table(
+  std::vector<data_type> const& types,
+  size_type size,
+  mask_state state                  = mask_state::UNALLOCATED,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Construct a STRING type column given a device span of pointer/size pairs.
  *
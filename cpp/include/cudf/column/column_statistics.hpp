@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <memory>
+
+namespace CUDF_EXPORT cudf {
+/**
+ * @addtogroup column_classes
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Lightweight statistics describing the contents of a column
+ *
+ * Carried alongside a column by callers that want to preserve what an operation already knows
+ * about its output — for example that a gather of a sorted column stayed sorted, or that a
+ * filtered column contains no nulls — so later operations can exploit it: pre-sorted inputs can
+ * pass `sorted::YES` hints or skip sorting entirely, null-free inputs can drop null handling,
+ * and min/max bounds enable range pruning before expensive joins.
+ */
+struct column_statistics {
+  bool is_sorted_ascending{false};  ///< True if rows are in ascending order with nulls first
+  bool has_nulls{false};            ///< True if the column contains null elements
+  std::unique_ptr<scalar> min;  ///< Minimum value; null when unknown (nested type, empty column,
+                                ///< or all-null column)
+  std::unique_ptr<scalar> max;  ///< Maximum value; null when unknown
+};
+
+/**
+ * @brief Computes `column_statistics` for a column
+ *
+ * Sortedness is evaluated for any comparable type with nulls ordered first. Min/max are
+ * computed for non-nested types only and left null otherwise.
+ *
+ * @param input The column to analyze
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ *
+ * @return Statistics describing `input`
+ */
+column_statistics compute_column_statistics(
+  column_view const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/** @} */  // end of group
+}  // namespace CUDF_EXPORT cudf
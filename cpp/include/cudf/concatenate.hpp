@@ -95,5 +95,58 @@ std::unique_ptr<table> concatenate(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Concatenates multiple fixed-width columns into caller-provided device memory
+ *
+ * Writes the concatenated data (and null mask, when any input column has
+ * nulls) into the provided spans instead of allocating fresh output, so
+ * callers that concatenate many small batches can reuse preallocated
+ * buffers. The returned `column_view` aliases the provided spans; it is
+ * valid only as long as the underlying memory is.
+ *
+ * The `null_mask` span may be empty when no input column has nulls.
+ *
+ * @throws cudf::logic_error If types of the input columns mismatch
+ * @throws std::overflow_error If the total number of output rows exceeds cudf::size_type
+ * @throws std::invalid_argument If any input column is not fixed-width
+ * @throws std::invalid_argument If `data` or `null_mask` is too small for the concatenated output
+ *
+ * @param columns_to_concat Column views to be concatenated into a single column
+ * @param data Preallocated device memory for the concatenated column data
+ * @param null_mask Preallocated device memory for the concatenated null mask; must hold
+ * `num_bitmask_words(total rows)` words when any input column has nulls
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return A view of the concatenated column over the provided memory
+ */
+column_view concatenate_into(host_span<column_view const> columns_to_concat,
+                             device_span<uint8_t> data,
+                             device_span<bitmask_type> null_mask,
+                             rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Concatenates the columns of multiple tables into caller-provided device memory
+ *
+ * Table-level variant of the span-based `concatenate_into`; one data span and
+ * one null-mask span are required per output column. Copies of independent
+ * output columns are issued on streams forked from the internal stream pool
+ * so that the many small copies of wide tables overlap; all work is joined
+ * back to `stream` before returning.
+ *
+ * @throws cudf::logic_error If number of columns mismatch
+ * @throws std::overflow_error If the total number of output rows exceeds cudf::size_type
+ * @throws std::invalid_argument If any input column is not fixed-width
+ * @throws std::invalid_argument If the number of buffers does not match the number of columns
+ *
+ * @param tables_to_concat Table views to be concatenated into a single table
+ * @param data_buffers Preallocated device memory for each concatenated column's data
+ * @param null_mask_buffers Preallocated device memory for each concatenated column's null mask
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return A view of the concatenated table over the provided memory
+ */
+table_view concatenate_into(host_span<table_view const> tables_to_concat,
+                            host_span<device_span<uint8_t> const> data_buffers,
+                            host_span<device_span<bitmask_type> const> null_mask_buffers,
+                            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
@@ -18,8 +18,10 @@
 
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 #include <vector>
@@ -308,6 +310,43 @@ std::vector<uint8_t> pack_metadata(table_view const& table,
                                    uint8_t const* contiguous_buffer,
                                    size_t buffer_size);
 
+/**
+ * @brief Non-owning, iovec-style description of the device buffers backing a table.
+ *
+ * The result of `cudf::pack_descriptors`. The spans reference the table's existing device
+ * memory; no data is copied. The table must outlive any use of the spans.
+ */
+struct packed_descriptors {
+  std::vector<device_span<uint8_t const>>
+    buffers;  ///< One span per column data or null mask buffer, in pack traversal order
+  bool contiguous{
+    false};  ///< True when the buffers already lie adjacent (ascending, at most small
+             ///< alignment gaps) in a single region, i.e. the table is already packed
+  device_span<uint8_t const>
+    contiguous_region{};  ///< The single region covering all buffers; empty unless `contiguous`
+  std::unique_ptr<std::vector<uint8_t>>
+    metadata;  ///< Metadata describing the buffers relative to `contiguous_region`; only
+               ///< produced when `contiguous`, in which case the region plus this metadata
+               ///< form a valid input to `cudf::unpack` with no copying
+};
+
+/**
+ * @brief Describes the device buffers of a table without copying them.
+ *
+ * Produces iovec-style buffer descriptors for every column data and null mask buffer of
+ * `input`, in the same traversal order used by `cudf::pack`. When the buffers already form
+ * one contiguous region in that order — the common case for a table produced by
+ * `cudf::unpack` or a single-partition `cudf::contiguous_split` — the result also carries
+ * the region and `cudf::unpack`-compatible metadata, allowing zero-copy handoff to
+ * transports that accept scattered or contiguous device buffers.
+ *
+ * @throws cudf::logic_error if any column of `input` is sliced (non-zero offset)
+ *
+ * @param input View of the table to describe
+ * @return The buffer descriptors for `input`
+ */
+packed_descriptors pack_descriptors(cudf::table_view const& input);
+
 /**
  * @brief Deserialize the result of `cudf::pack`.
  *
@@ -343,5 +382,81 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+namespace detail {
+struct spillable_table_state;
+}
+
+/**
+ * @brief An owning table whose device memory can be spilled to pinned host memory and restored.
+ *
+ * The table is stored in the contiguous `cudf::pack` format, so the serialization cost is paid
+ * once at construction; spilling and restoring afterwards each move a single buffer with one
+ * asynchronous copy. While resident, `view()` returns a zero-copy `table_view` over the device
+ * buffer via `cudf::unpack`.
+ *
+ * All operations are ordered on the passed stream. A caller spilling and restoring on different
+ * streams is responsible for synchronizing between them. `restore()` on a side stream can be
+ * used as an asynchronous prefetch hint ahead of the next access.
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief Constructs a spillable table holding a packed deep copy of `input`
+   *
+   * @param input View of the table to copy and manage
+   * @param stream CUDA stream used for device memory operations
+   * @param mr Device memory resource used for the table's device memory, including
+   *           re-allocations made by `restore()`
+   */
+  explicit spillable_table(
+    table_view const& input,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  ~spillable_table();
+  spillable_table(spillable_table&&) noexcept;             ///< Move constructor
+  spillable_table& operator=(spillable_table&&) noexcept;  ///< Move assignment operator
+  spillable_table(spillable_table const&)            = delete;
+  spillable_table& operator=(spillable_table const&) = delete;
+
+  /**
+   * @brief Copies the table's device buffer to pinned host memory and frees the device memory
+   *
+   * A no-op if the table is already spilled. Any `table_view` previously returned by `view()`
+   * is invalidated.
+   *
+   * @param stream CUDA stream used for the copy and the stream-ordered device free
+   */
+  void spill(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Copies the table back to device memory and frees the pinned host copy
+   *
+   * A no-op if the table is resident.
+   *
+   * @param stream CUDA stream used for device memory operations
+   */
+  void restore(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /// @returns true if the table's buffers currently reside in host memory
+  [[nodiscard]] bool is_spilled() const;
+
+  /// @returns The size in bytes of the table's packed data buffer
+  [[nodiscard]] std::size_t size_bytes() const;
+
+  /**
+   * @brief Returns a view of the table, restoring it to device memory first if spilled
+   *
+   * The view is valid until the next `spill()` or until this object is destroyed.
+   *
+   * @param stream CUDA stream used for device memory operations if a restore is needed
+   * @return View of the managed table
+   */
+  [[nodiscard]] table_view view(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+ private:
+  std::unique_ptr<detail::spillable_table_state> _state;
+};
+
 /** @} */
 }  // namespace CUDF_EXPORT cudf
@@ -23,9 +23,15 @@
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/stream_future.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -88,6 +94,60 @@ std::unique_ptr<table> gather(
   rmm::cuda_stream_view stream       = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr  = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Gathers the specified rows of a set of columns, returning a stream-ordered future.
+ *
+ * @ingroup copy_gather
+ *
+ * Identical to `cudf::gather` except that the caller is not required to synchronize with
+ * `stream` before consuming the result: the returned future carries an event recorded after the
+ * gather, so a consumer can wait for it on another stream (`get(stream)`) and overlap
+ * independent work. See `cudf::stream_future`.
+ *
+ * @param source_table The input columns whose rows will be gathered
+ * @param gather_map View into a non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the destination columns.
+ * @param bounds_policy Policy to apply to account for possible out-of-bounds indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Future holding the result of the gather
+ */
+stream_future<std::unique_ptr<table>> gather_async(
+  table_view const& source_table,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream       = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr  = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Gathers rows from many tables with a single batched device copy.
+ *
+ * @ingroup copy_gather
+ *
+ * Equivalent to calling `cudf::gather(source_tables[i], gather_maps[i])` for each `i`,
+ * but all fixed-width, non-nullable columns across all pairs are gathered by one batched
+ * copy instead of one kernel launch per table, amortizing launch overhead when there are
+ * many small gathers. Columns that cannot take the batched path (nested, strings,
+ * dictionary, or nullable columns) fall back to the per-table gather.
+ *
+ * All gather map values must be valid, in-bounds, non-negative indices of type
+ * `INT32`; out-of-bounds behavior is undefined (as `out_of_bounds_policy::DONT_CHECK`).
+ *
+ * @throws std::invalid_argument if the number of tables and gather maps differ, if a
+ * gather map contains nulls, or if a gather map is not an `INT32` column
+ *
+ * @param source_tables The input tables whose rows will be gathered
+ * @param gather_maps One non-nullable `INT32` column of row indices per input table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ * @return One gathered table per input table
+ */
+std::vector<std::unique_ptr<table>> batched_gather(
+  std::vector<table_view> const& source_tables,
+  std::vector<column_view> const& gather_maps,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Reverses the rows within a table.
  *
@@ -177,6 +237,53 @@ std::unique_ptr<table> scatter(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Scatters the rows of the source table into the target table in-place,
+ * according to a scatter map.
+ *
+ * @ingroup copy_scatter
+ *
+ * Scatters values from the source table directly into the device memory of the
+ * target columns such that row `scatter_map[i]` of the target receives row `i`
+ * of the source. Unlike `cudf::scatter`, no copy of the target is made; only
+ * the scattered rows are written. This is intended for workloads that update a
+ * small fraction of the rows of a large resident table, where copying the
+ * whole target would dominate the cost of the update.
+ *
+ * All target columns must be fixed-width. If a source column contains nulls,
+ * the corresponding target column must be nullable; validity words are updated
+ * with atomic operations so rows not named by the scatter map keep their
+ * validity. When the validity of any target column may change, its null count
+ * is not maintained and the caller must recompute it (e.g. with
+ * `cudf::null_count`) before constructing a `column_view` over the memory.
+ *
+ * If the same index appears more than once in the scatter map, the result is
+ * undefined. If any values in `scatter_map` are outside of the interval
+ * [0, n) where `n` is the number of rows in the `target` table, behavior is
+ * undefined.
+ *
+ * @throws std::invalid_argument if the number of columns in source does not match the number of
+ * columns in target
+ * @throws std::invalid_argument if the number of rows in source is less than the number of
+ * elements in scatter_map
+ * @throws std::invalid_argument if scatter_map contains null values
+ * @throws std::invalid_argument if any target column is not fixed-width
+ * @throws std::invalid_argument if a source column has nulls but the corresponding target column
+ * is not nullable
+ * @throws cudf::data_type_error if the data types of the source and target columns do not match
+ *
+ * @param source The input columns containing values to be scattered into the
+ * target columns
+ * @param scatter_map A non-nullable column of integral indices that maps the
+ * rows in the source columns to rows in the target columns
+ * @param target The set of columns whose rows are updated in-place
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void scatter_in_place(table_view const& source,
+                      column_view const& scatter_map,
+                      mutable_table_view& target,
+                      rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /**
  * @brief Scatters a row of scalar values into a copy of the target table
  * according to a scatter map.
@@ -809,6 +916,124 @@ std::unique_ptr<scalar> get_element(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Accumulates single-element reads from columns and materializes them on the host with a
+ * single device-to-host copy and stream synchronization
+ *
+ * Each call to `get_element` issues its own device-to-host copy and stream synchronization, which
+ * dominates the cost when many individual elements are read. An `element_batch` instead records
+ * the requested elements, packs them into one staging buffer on `flush`, and transfers the whole
+ * batch with a single copy and synchronization. Values are then read back with the typed
+ * accessors.
+ *
+ * Only fixed-width element types are supported.
+ *
+ * @code{.cpp}
+ * cudf::element_batch batch;
+ * auto const h0 = batch.add(int_column, 17);
+ * auto const h1 = batch.add(double_column, 42);
+ * batch.flush(stream);
+ * if (batch.is_valid(h0)) { auto const v = batch.value<int32_t>(h0); }
+ * @endcode
+ *
+ * The source columns must remain valid until `flush` returns.
+ */
+class element_batch {
+ public:
+  /**
+   * @brief Adds the element at `index` of `input` to the batch
+   *
+   * @throws cudf::logic_error if `input` does not have a fixed-width type or if the batch has
+   * already been flushed
+   * @throws std::out_of_range if `index` is not within the range `[0, input.size())`
+   *
+   * @param input Column view to read the element from
+   * @param index Index into `input` of the element to read
+   * @return Handle used to retrieve the element after `flush`
+   */
+  std::size_t add(column_view const& input, size_type index);
+
+  /**
+   * @brief Copies all accumulated elements to the host
+   *
+   * Issues one kernel to pack the requested elements and their validity into a staging buffer,
+   * followed by a single device-to-host copy and a single synchronization of `stream`.
+   *
+   * @throws cudf::logic_error if the batch has already been flushed
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void flush(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the number of elements accumulated in the batch
+   *
+   * @return Number of elements in the batch
+   */
+  [[nodiscard]] std::size_t size() const noexcept { return _entries.size(); }
+
+  /**
+   * @brief Indicates whether the element for `handle` is valid (non-null)
+   *
+   * @throws cudf::logic_error if the batch has not been flushed
+   * @throws std::out_of_range if `handle` was not returned by `add` on this batch
+   *
+   * @param handle Handle returned by `add`
+   * @return true if the element is valid, false if it is null
+   */
+  [[nodiscard]] bool is_valid(std::size_t handle) const;
+
+  /**
+   * @brief Returns the element for `handle`
+   *
+   * For fixed-point types the element is reconstructed with the scale of the source column. The
+   * returned value is unspecified if the element is null; check `is_valid` first.
+   *
+   * @throws cudf::logic_error if the batch has not been flushed
+   * @throws std::out_of_range if `handle` was not returned by `add` on this batch
+   * @throws cudf::data_type_error if `T` does not match the type of the source column
+   *
+   * @tparam T Element type; must match the type of the source column
+   * @param handle Handle returned by `add`
+   * @return The element value
+   */
+  template <typename T>
+  [[nodiscard]] T value(std::size_t handle) const
+  {
+    static_assert(cudf::is_fixed_width<T>(), "element_batch only supports fixed-width types");
+    auto const& e = entry_at(handle);
+    CUDF_EXPECTS(e.column.type().id() == cudf::type_to_id<T>(),
+                 "Requested type does not match the element type",
+                 cudf::data_type_error);
+    if constexpr (cudf::is_fixed_point<T>()) {
+      typename T::rep rep_value{};
+      std::memcpy(&rep_value, _values.data() + e.offset, sizeof(rep_value));
+      return T{numeric::scaled_integer<typename T::rep>{
+        rep_value, numeric::scale_type{e.column.type().scale()}}};
+    } else {
+      T value;
+      std::memcpy(&value, _values.data() + e.offset, sizeof(T));
+      return value;
+    }
+  }
+
+ private:
+  struct entry {
+    column_view column;  ///< Source column
+    size_type index;     ///< Element index within the source column
+    std::size_t offset;  ///< Byte offset of the element in the staging buffer
+  };
+
+  /// Returns the entry for `handle`, verifying that the batch has been flushed
+  [[nodiscard]] entry const& entry_at(std::size_t handle) const;
+
+  std::vector<entry> _entries;
+  std::vector<uint8_t> _values;    ///< Packed element bytes, populated by `flush`
+  std::vector<uint8_t> _validity;  ///< One byte per entry, populated by `flush`
+  std::size_t _value_bytes = 0;
+  bool _flushed            = false;
+};
+
 /**
  * @brief Indicates whether a row can be sampled more than once.
  */
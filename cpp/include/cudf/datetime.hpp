@@ -20,6 +20,7 @@
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -261,6 +262,31 @@ std::unique_ptr<cudf::column> extract_datetime_component(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Extracts several datetime components from any datetime type in a single pass
+ * and returns one int16_t cudf::column per requested component.
+ *
+ * Equivalent to calling `extract_datetime_component` once per component, but the
+ * timestamp is decomposed into its calendar date and time of day only once per row and
+ * all requested fields are written from that shared decomposition, so feature pipelines
+ * extracting many fields pay for one pass over the column instead of one per field.
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param components The datetime components to extract, in output column order
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ *
+ * @returns table of extracted int16_t datetime components, one column per entry in
+ * `components`
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw std::invalid_argument if `components` is empty
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
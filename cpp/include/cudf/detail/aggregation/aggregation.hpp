@@ -99,6 +99,12 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class merge_m2_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(
     data_type col_type, class merge_histogram_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class max_by_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class min_by_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class top_k_by_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
                                                           class covariance_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
@@ -143,6 +149,9 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class merge_sets_aggregation const& agg);
   virtual void visit(class merge_m2_aggregation const& agg);
   virtual void visit(class merge_histogram_aggregation const& agg);
+  virtual void visit(class max_by_aggregation const& agg);
+  virtual void visit(class min_by_aggregation const& agg);
+  virtual void visit(class top_k_by_aggregation const& agg);
   virtual void visit(class covariance_aggregation const& agg);
   virtual void visit(class correlation_aggregation const& agg);
   virtual void visit(class tdigest_aggregation const& agg);
@@ -911,7 +920,7 @@ class lead_lag_aggregation final : public rolling_aggregation {
  * @brief Derived class for specifying a custom aggregation
  * specified in udf
  */
-class udf_aggregation final : public rolling_aggregation {
+class udf_aggregation final : public rolling_aggregation, public groupby_aggregation {
  public:
   udf_aggregation(aggregation::Kind type,
                   std::string user_defined_aggregator,
@@ -1094,6 +1103,87 @@ class merge_histogram_aggregation final : public groupby_aggregation, public red
   void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
 };
 
+/**
+ * @brief Derived aggregation class for specifying MAX_BY aggregation
+ */
+class max_by_aggregation final : public groupby_aggregation {
+ public:
+  max_by_aggregation() : aggregation{MAX_BY} {}
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<max_by_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying MIN_BY aggregation
+ */
+class min_by_aggregation final : public groupby_aggregation {
+ public:
+  min_by_aggregation() : aggregation{MIN_BY} {}
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<min_by_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying TOP_K_BY aggregation
+ */
+class top_k_by_aggregation final : public groupby_aggregation {
+ public:
+  top_k_by_aggregation(size_type k, order topk_order)
+    : aggregation{TOP_K_BY}, _k{k}, _order{topk_order}
+  {
+  }
+
+  size_type _k;  ///< number of rows to keep per group
+  order _order;  ///< whether the largest or smallest ordering values are kept
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<top_k_by_aggregation const&>(_other);
+    return _k == other._k and _order == other._order;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ hash_impl();
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<top_k_by_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  [[nodiscard]] size_t hash_impl() const
+  {
+    return std::hash<size_type>{}(_k) ^ std::hash<int>{}(static_cast<int>(_order));
+  }
+};
+
 /**
  * @brief Derived aggregation class for specifying COVARIANCE aggregation
  */
@@ -1465,6 +1555,29 @@ struct target_type_impl<SourceType, aggregation::MERGE_HISTOGRAM> {
   using type = list_view;
 };
 
+// MAX_BY and MIN_BY emit a struct of the payload children of a struct source
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MAX_BY,
+                        std::enable_if_t<std::is_same_v<Source, cudf::struct_view>>> {
+  using type = struct_view;
+};
+
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MIN_BY,
+                        std::enable_if_t<std::is_same_v<Source, cudf::struct_view>>> {
+  using type = struct_view;
+};
+
+// TOP_K_BY emits a list of payload structs of a struct source
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::TOP_K_BY,
+                        std::enable_if_t<std::is_same_v<Source, cudf::struct_view>>> {
+  using type = list_view;
+};
+
 // Always use double for COVARIANCE
 template <typename SourceType>
 struct target_type_impl<SourceType, aggregation::COVARIANCE> {
@@ -1501,6 +1614,18 @@ struct target_type_impl<SourceType, aggregation::HOST_UDF> {
   using type = struct_view;
 };
 
+// Placeholders for the device UDF aggregations: the actual return type is carried at runtime by
+// `udf_aggregation::_output_type`.
+template <typename SourceType>
+struct target_type_impl<SourceType, aggregation::PTX> {
+  using type = struct_view;
+};
+
+template <typename SourceType>
+struct target_type_impl<SourceType, aggregation::CUDA> {
+  using type = struct_view;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -1608,6 +1733,12 @@ CUDF_HOST_DEVICE inline decltype(auto) aggregation_dispatcher(aggregation::Kind
       return f.template operator()<aggregation::MERGE_M2>(std::forward<Ts>(args)...);
     case aggregation::MERGE_HISTOGRAM:
       return f.template operator()<aggregation::MERGE_HISTOGRAM>(std::forward<Ts>(args)...);
+    case aggregation::MAX_BY:
+      return f.template operator()<aggregation::MAX_BY>(std::forward<Ts>(args)...);
+    case aggregation::MIN_BY:
+      return f.template operator()<aggregation::MIN_BY>(std::forward<Ts>(args)...);
+    case aggregation::TOP_K_BY:
+      return f.template operator()<aggregation::TOP_K_BY>(std::forward<Ts>(args)...);
     case aggregation::COVARIANCE:
       return f.template operator()<aggregation::COVARIANCE>(std::forward<Ts>(args)...);
     case aggregation::CORRELATION:
@@ -1620,6 +1751,9 @@ CUDF_HOST_DEVICE inline decltype(auto) aggregation_dispatcher(aggregation::Kind
       return f.template operator()<aggregation::EWMA>(std::forward<Ts>(args)...);
     case aggregation::HOST_UDF:
       return f.template operator()<aggregation::HOST_UDF>(std::forward<Ts>(args)...);
+    case aggregation::PTX: return f.template operator()<aggregation::PTX>(std::forward<Ts>(args)...);
+    case aggregation::CUDA:
+      return f.template operator()<aggregation::CUDA>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -77,5 +77,29 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          data_type output_type,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::fused_multiply_add
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> fused_multiply_add(column_view const& x,
+                                           column_view const& y,
+                                           column_view const& z,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::compare_and_select
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> compare_and_select(column_view const& lhs,
+                                           column_view const& rhs,
+                                           binary_operator compare_op,
+                                           column_view const& true_values,
+                                           column_view const& false_values,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr);
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
@@ -48,5 +48,24 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::concatenate_into(host_span<column_view const>,device_span<uint8_t>,
+ * device_span<bitmask_type>,rmm::cuda_stream_view)
+ */
+column_view concatenate_into(host_span<column_view const> columns_to_concat,
+                             device_span<uint8_t> data,
+                             device_span<bitmask_type> null_mask,
+                             rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::concatenate_into(host_span<table_view const>,
+ * host_span<device_span<uint8_t> const>,host_span<device_span<bitmask_type> const>,
+ * rmm::cuda_stream_view)
+ */
+table_view concatenate_into(host_span<table_view const> tables_to_concat,
+                            host_span<device_span<uint8_t> const> data_buffers,
+                            host_span<device_span<bitmask_type> const> null_mask_buffers,
+                            rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
@@ -45,6 +45,13 @@ packed_columns pack(cudf::table_view const& input,
                     rmm::cuda_stream_view stream,
                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::pack_descriptors
+ *
+ * @param stream Optional CUDA stream on which to execute kernels
+ **/
+packed_descriptors pack_descriptors(cudf::table_view const& input, rmm::cuda_stream_view stream);
+
 // opaque implementation of `metadata_builder` since it needs to use
 // `serialized_column`, which is only defined in pack.cpp
 class metadata_builder_impl;
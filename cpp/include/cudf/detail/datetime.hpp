@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <cudf/datetime.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 
@@ -125,6 +127,17 @@ std::unique_ptr<cudf::column> extract_datetime_component(cudf::column_view const
                                                          rmm::cuda_stream_view stream,
                                                          rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::extract_datetime_components(cudf::column_view const&,
+ * host_span<datetime_component const>, rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ *
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::last_day_of_month(cudf::column_view const&, rmm::cuda_stream_view,
  * rmm::device_async_resource_ref)
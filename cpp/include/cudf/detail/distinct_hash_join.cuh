@@ -109,7 +109,9 @@ struct distinct_hash_join {
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
     _preprocessed_build;  ///< input table preprocssed for row operators
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
-    _preprocessed_probe;        ///< input table preprocssed for row operators
+    _preprocessed_probe;  ///< input table preprocssed for row operators
+  rmm::device_uvector<hash_value_type>
+    _probe_hashes;              ///< cached row hashes of `_probe`, reused across probe calls
   hash_table_type _hash_table;  ///< hash table built on `_build`
 
  public:
@@ -84,5 +84,15 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::batched_gather
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<table>> batched_gather(std::vector<table_view> const& source_tables,
+                                                   std::vector<column_view> const& gather_maps,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
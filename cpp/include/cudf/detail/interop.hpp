@@ -45,6 +45,13 @@ DLManagedTensor* to_dlpack(table_view const& input,
                            rmm::cuda_stream_view stream,
                            rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::to_dlpack_view
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+DLManagedTensor* to_dlpack_view(column_view const& input, rmm::cuda_stream_view stream);
+
 /**
  * @brief Return a maximum precision for a given type.
  *
@@ -70,13 +70,14 @@ struct hash_join {
   hash_join& operator=(hash_join&&)      = delete;
 
  private:
-  bool const _is_empty;   ///< true if `_hash_table` is empty
+  bool _is_empty;         ///< true if `_hash_table` is empty
   bool const _has_nulls;  ///< true if nulls are present in either build table or any probe table
   cudf::null_equality const _nulls_equal;  ///< whether to consider nulls as equal
   cudf::table_view _build;                 ///< input table to build the hash map
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
     _preprocessed_build;  ///< input table preprocssed for row operators
-  map_type _hash_table;   ///< hash table built on `_build`
+  std::unique_ptr<map_type>
+    _hash_table;  ///< hash table built on `_build`; reallocated when `insert` outgrows its capacity
 
  public:
   /**
@@ -95,6 +96,11 @@ struct hash_join {
             cudf::null_equality compare_nulls,
             rmm::cuda_stream_view stream);
 
+  /**
+   * @copydoc cudf::hash_join::insert
+   */
+  void insert(cudf::table_view const& build, rmm::cuda_stream_view stream);
+
   /**
    * @copydoc cudf::hash_join::inner_join
    */
@@ -31,12 +31,15 @@
 #include <cub/block/block_reduce.cuh>
 #include <cub/device/device_segmented_reduce.cuh>
 #include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
+#include <thrust/uninitialized_fill.h>
 
 #include <algorithm>
 #include <iterator>
@@ -179,6 +182,172 @@ size_type inplace_bitmask_binop(Binop op,
   return d_counter.value(stream);
 }
 
+/**
+ * @brief Merges many independent groups of bitmasks in a single kernel launch
+ *
+ * Each task `t` combines the masks `sources[task_source_offsets[t]]` ..
+ * `sources[task_source_offsets[t + 1] - 1]` with @p op and writes the result to
+ * `destinations[t]`, exactly as `offset_bitmask_binop` would for that task alone. Flattening the
+ * tasks into one launch avoids paying kernel launch latency per column on wide tables.
+ *
+ * @tparam block_size Number of threads in each thread block
+ * @tparam Binop Type of binary operator
+ *
+ * @param op The binary operator used to combine the bitmasks
+ * @param destinations Destination mask pointer for each task
+ * @param destination_word_offsets Exclusive scan of each task's destination word count, with the
+ *                                 total word count appended (size: number of tasks + 1)
+ * @param sources Source mask pointers for all tasks, flattened
+ * @param source_begin_bits Bit offset of each entry of @p sources
+ * @param task_source_offsets Start of each task's range in @p sources (size: number of tasks + 1)
+ * @param task_size_bits Number of bits produced by each task
+ * @param valid_counts Per-task counters of set bits, must be zero-initialized
+ */
+template <int block_size, typename Binop>
+CUDF_KERNEL void batched_bitmask_binop_kernel(Binop op,
+                                              device_span<bitmask_type* const> destinations,
+                                              device_span<size_type const> destination_word_offsets,
+                                              device_span<bitmask_type const* const> sources,
+                                              device_span<size_type const> source_begin_bits,
+                                              device_span<size_type const> task_source_offsets,
+                                              device_span<size_type const> task_size_bits,
+                                              device_span<size_type> valid_counts)
+{
+  auto const tid         = cudf::detail::grid_1d::global_thread_id();
+  auto const total_words = destination_word_offsets.back();
+
+  for (auto destination_word_index = static_cast<size_type>(tid);
+       destination_word_index < total_words;
+       destination_word_index += cudf::detail::grid_1d::grid_stride()) {
+    auto const task = static_cast<size_type>(
+      thrust::distance(destination_word_offsets.begin(),
+                       thrust::upper_bound(thrust::seq,
+                                           destination_word_offsets.begin(),
+                                           destination_word_offsets.end(),
+                                           destination_word_index)) -
+      1);
+    auto const word_index      = destination_word_index - destination_word_offsets[task];
+    auto const source_size_bits = task_size_bits[task];
+    auto const source_begin    = task_source_offsets[task];
+    auto const source_end      = task_source_offsets[task + 1];
+
+    bitmask_type destination_word =
+      detail::get_mask_offset_word(sources[source_begin],
+                                   word_index,
+                                   source_begin_bits[source_begin],
+                                   source_begin_bits[source_begin] + source_size_bits);
+    for (auto i = source_begin + 1; i < source_end; i++) {
+      destination_word = op(destination_word,
+                            detail::get_mask_offset_word(sources[i],
+                                                         word_index,
+                                                         source_begin_bits[i],
+                                                         source_begin_bits[i] + source_size_bits));
+    }
+
+    auto const last_bit_index = source_size_bits - 1;
+    if (word_index == cudf::word_index(last_bit_index)) {
+      // mask out any bits not part of this word
+      auto const num_bits_in_last_word = intra_word_index(last_bit_index);
+      if (num_bits_in_last_word <
+          static_cast<size_type>(detail::size_in_bits<bitmask_type>() - 1)) {
+        destination_word &= set_least_significant_bits(num_bits_in_last_word + 1);
+      }
+    }
+
+    destinations[task][word_index] = destination_word;
+    atomicAdd(&valid_counts[task], __popc(destination_word));
+  }
+}
+
+/**
+ * @brief Performs many independent bitmask merges with a single kernel launch
+ *
+ * Task `t` merges the masks `task_masks[t]` (offset by `task_begin_bits[t]`) over
+ * `task_size_bits[t]` bits, equivalent to calling `bitmask_binop` once per task but with one
+ * launch for the whole batch.
+ *
+ * @param op The binary operator used to combine the bitmasks
+ * @param task_masks The list of mask pointers to merge, per task
+ * @param task_begin_bits The bit offset of each mask in @p task_masks
+ * @param task_size_bits The number of bits to merge, per task
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device buffers
+ * @return For each task, the resulting mask and its count of unset bits
+ */
+template <typename Binop>
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_binop(
+  Binop op,
+  std::vector<std::vector<bitmask_type const*>> const& task_masks,
+  std::vector<std::vector<size_type>> const& task_begin_bits,
+  std::vector<size_type> const& task_size_bits,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const num_tasks = task_masks.size();
+  auto results         = std::vector<std::pair<rmm::device_buffer, size_type>>{};
+  results.reserve(num_tasks);
+  if (num_tasks == 0) { return results; }
+
+  auto h_destinations   = std::vector<bitmask_type*>{};
+  auto h_word_offsets   = std::vector<size_type>{0};
+  auto h_sources        = std::vector<bitmask_type const*>{};
+  auto h_begin_bits     = std::vector<size_type>{};
+  auto h_source_offsets = std::vector<size_type>{};
+  h_source_offsets.push_back(0);
+
+  for (std::size_t t = 0; t < num_tasks; ++t) {
+    CUDF_EXPECTS(task_size_bits[t] > 0, "Invalid bit range.");
+    CUDF_EXPECTS(not task_masks[t].empty(), "Each task must merge at least one mask");
+    CUDF_EXPECTS(std::all_of(task_masks[t].begin(),
+                             task_masks[t].end(),
+                             [](auto p) { return p != nullptr; }),
+                 "Mask pointer cannot be null");
+    CUDF_EXPECTS(std::all_of(task_begin_bits[t].begin(),
+                             task_begin_bits[t].end(),
+                             [](auto b) { return b >= 0; }),
+                 "Invalid range.");
+
+    results.emplace_back(
+      rmm::device_buffer{bitmask_allocation_size_bytes(task_size_bits[t]), stream, mr}, 0);
+    h_destinations.push_back(static_cast<bitmask_type*>(results.back().first.data()));
+    h_word_offsets.push_back(h_word_offsets.back() + num_bitmask_words(task_size_bits[t]));
+    h_sources.insert(h_sources.end(), task_masks[t].begin(), task_masks[t].end());
+    h_begin_bits.insert(h_begin_bits.end(), task_begin_bits[t].begin(), task_begin_bits[t].end());
+    h_source_offsets.push_back(static_cast<size_type>(h_sources.size()));
+  }
+
+  auto const temp_mr        = cudf::get_current_device_resource_ref();
+  auto d_destinations   = cudf::detail::make_device_uvector_async(h_destinations, stream, temp_mr);
+  auto d_word_offsets   = cudf::detail::make_device_uvector_async(h_word_offsets, stream, temp_mr);
+  auto d_sources        = cudf::detail::make_device_uvector_async(h_sources, stream, temp_mr);
+  auto d_begin_bits     = cudf::detail::make_device_uvector_async(h_begin_bits, stream, temp_mr);
+  auto d_source_offsets =
+    cudf::detail::make_device_uvector_async(h_source_offsets, stream, temp_mr);
+  auto d_size_bits = cudf::detail::make_device_uvector_async(task_size_bits, stream, temp_mr);
+  auto d_valid_counts = rmm::device_uvector<size_type>(num_tasks, stream, temp_mr);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), d_valid_counts.begin(), d_valid_counts.end(), 0);
+
+  auto constexpr block_size = 256;
+  cudf::detail::grid_1d config(h_word_offsets.back(), block_size);
+  batched_bitmask_binop_kernel<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(op,
+                                                                             d_destinations,
+                                                                             d_word_offsets,
+                                                                             d_sources,
+                                                                             d_begin_bits,
+                                                                             d_source_offsets,
+                                                                             d_size_bits,
+                                                                             d_valid_counts);
+  CUDF_CHECK_CUDA(stream.value());
+
+  auto const h_valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+  for (std::size_t t = 0; t < num_tasks; ++t) {
+    results[t].second = task_size_bits[t] - h_valid_counts[t];
+  }
+  return results;
+}
+
 /**
  * @brief Enum indicating whether to count unset (0) bits or set (1) bits.
  */
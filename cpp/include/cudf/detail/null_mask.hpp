@@ -252,6 +252,44 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
                                                     rmm::cuda_stream_view stream,
                                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::batched_bitmask_and
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_and(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::batched_bitmask_or
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_or(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::null_counts
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+CUDF_EXPORT
+std::vector<size_type> null_counts(table_view const& view, rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::segmented_null_counts
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+CUDF_EXPORT
+std::vector<size_type> segmented_null_counts(table_view const& view,
+                                             host_span<size_type const> indices,
+                                             rmm::cuda_stream_view stream);
+
 /**
  * @brief Performs a bitwise AND of the specified bitmasks,
  *        and writes in place to destination
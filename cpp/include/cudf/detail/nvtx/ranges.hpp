@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/utilities/instrumentation.hpp>
+
 #include <nvtx3/nvtx3.hpp>
 
 namespace cudf {
@@ -48,7 +50,9 @@ using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. When instrumentation is enabled via
+ * `cudf::set_instrumentation`, the wall time of the function is additionally
+ * recorded under the same name.
  *
  * Example:
  * ```
@@ -58,4 +62,6 @@ using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                      \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain);   \
+  cudf::detail::scoped_call_timer const _cudf_call_timer { __func__ }
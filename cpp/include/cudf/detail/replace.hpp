@@ -92,6 +92,17 @@ std::unique_ptr<column> find_and_replace_all(column_view const& input_col,
                                              rmm::cuda_stream_view stream,
                                              rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::find_and_replace_all(column_view const&, replacement_map const&,
+ * rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> find_and_replace_all(column_view const& input_col,
+                                             replacement_map const& replacement,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::normalize_nans_and_zeros
  *
@@ -26,15 +26,17 @@ namespace detail {
 using idx_valid_pair_t = thrust::tuple<cudf::size_type, bool>;
 
 /**
- * @brief Functor used by `replace_nulls(replace_policy)` to determine the index to gather from in
- * the result column.
+ * @brief Functor used by `replace_nulls(replace_policy)` to propagate the nearest valid row.
  *
  * Binary functor passed to `inclusive_scan` or `inclusive_scan_by_key`. Arguments are a tuple of
- * index and validity of a row. Returns a tuple of current index and a discarded boolean if current
- * row is valid, otherwise a tuple of the nearest non-null row index and a discarded boolean.
+ * a row's payload (its index when building a gather map, or its value when filling fixed-width
+ * data directly in the scan) and its validity. Returns the right tuple if the right row is valid,
+ * otherwise the nearest valid tuple carried from the left.
  */
 struct replace_policy_functor {
-  __device__ idx_valid_pair_t operator()(idx_valid_pair_t const& lhs, idx_valid_pair_t const& rhs)
+  template <typename T>
+  __device__ thrust::tuple<T, bool> operator()(thrust::tuple<T, bool> const& lhs,
+                                               thrust::tuple<T, bool> const& rhs)
   {
     return thrust::get<1>(rhs) ? rhs : lhs;
   }
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/reshape.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -41,5 +42,13 @@ std::unique_ptr<column> interleave_columns(table_view const& input,
                                            rmm::cuda_stream_view,
                                            rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::byte_cast(table_view const&,flip_endianness,rmm::cuda_stream_view,rmm::device_async_resource_ref)
+ */
+std::unique_ptr<table> byte_cast(table_view const& input,
+                                 flip_endianness endian_configuration,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
@@ -79,6 +79,14 @@ std::unique_ptr<table> scatter(table_view const& source,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::scatter_in_place
+ */
+void scatter_in_place(table_view const& source,
+                      column_view const& scatter_map,
+                      mutable_table_view& target,
+                      rmm::cuda_stream_view stream);
+
 /**
  * @brief Scatters a row of scalar values into a copy of the target table
  * according to a scatter map.
@@ -21,6 +21,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -52,6 +53,32 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::batched_lower_bound
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::batched_upper_bound
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::contains(column_view const&, scalar const&, rmm::device_async_resource_ref)
  *
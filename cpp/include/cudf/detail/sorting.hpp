@@ -40,6 +40,17 @@ std::unique_ptr<column> sorted_order(table_view const& input,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::sorted_order(table_view const&,
+ * std::shared_ptr<experimental::row::lexicographic::preprocessed_table>,rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> sorted_order(
+  table_view const& input,
+  std::shared_ptr<experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::stable_sorted_order
  *
@@ -77,6 +88,41 @@ std::unique_ptr<column> rank(column_view const& input,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Computes ranks of a column whose rows are already in sorted order.
+ *
+ * Equivalent to `cudf::rank` except that no sort is performed; the `i`-th output rank
+ * belongs to the `i`-th input row.
+ *
+ * @param input Column already sorted by the desired rank order
+ * @param method Rank method as in `cudf::rank`
+ * @param null_handling Flag to include nulls during ranking
+ * @param percentage Flag to convert ranks to percentage in range (0,1]
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A column of containing the rank of the each element of the column of `input`
+ */
+std::unique_ptr<column> rank_sorted(column_view const& input,
+                                    rank_method method,
+                                    null_policy null_handling,
+                                    bool percentage,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::windowed_ranks
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> windowed_ranks(
+  table_view const& group_keys,
+  table_view const& order_keys,
+  std::vector<rank_method> const& methods,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::stable_sort_by_key
  *
@@ -89,6 +135,14 @@ std::unique_ptr<table> stable_sort_by_key(table_view const& values,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::is_sorted
+ */
+bool is_sorted(table_view const& table,
+               std::vector<order> const& column_order,
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::segmented_sorted_order
  *
@@ -162,5 +216,17 @@ std::unique_ptr<table> stable_sort(table_view const& values,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
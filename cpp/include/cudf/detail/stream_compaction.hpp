@@ -25,6 +25,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <optional>
+
 namespace CUDF_EXPORT cudf {
 namespace detail {
 /**
@@ -48,13 +50,42 @@ std::unique_ptr<table> drop_nans(table_view const& input,
                                  rmm::device_async_resource_ref mr);
 
 /**
- * @copydoc cudf::apply_boolean_mask
+ * @copydoc cudf::apply_boolean_mask(table_view const&, column_view const&, double,
+ *                                   rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ *
+ * @param selectivity_hint Optional expected fraction of rows passing the filter; when
+ * absent, output buffers are sized conservatively at the full input row count
  */
 std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           column_view const& boolean_mask,
+                                          std::optional<double> selectivity_hint,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::apply_boolean_mask(table_view const&, column_view const&,
+ *                                   rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ */
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          column_view const& boolean_mask,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::make_selection_vector
+ */
+selection_vector make_selection_vector(column_view const& boolean_mask,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::apply_selection_vector
+ */
+std::unique_ptr<table> apply_selection_vector(table_view const& input,
+                                              selection_vector const& selection,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::unique
  */
@@ -129,5 +160,32 @@ cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal,
                                rmm::cuda_stream_view stream);
 
+/**
+ * @copydoc cudf::hyperloglog_sketch
+ */
+std::unique_ptr<column> hyperloglog_sketch(table_view const& input,
+                                           int32_t precision,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::merge_hyperloglog_sketches
+ */
+std::unique_ptr<column> merge_hyperloglog_sketches(host_span<column_view const> sketches,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::approx_distinct_count(column_view const&, rmm::cuda_stream_view)
+ */
+double approx_distinct_count(column_view const& sketch, rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::approx_distinct_count(table_view const&, int32_t, rmm::cuda_stream_view)
+ */
+double approx_distinct_count(table_view const& input,
+                             int32_t precision,
+                             rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
@@ -36,5 +36,25 @@ std::unique_ptr<table> make_timezone_transition_table(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @copydoc cudf::get_cached_timezone_transition_table(std::optional<std::string_view>,
+ * std::string_view, rmm::cuda_stream_view)
+ *
+ */
+std::shared_ptr<table const> get_cached_timezone_transition_table(
+  std::optional<std::string_view> tzif_dir,
+  std::string_view timezone_name,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @copydoc cudf::get_cached_timezone_transition_tables(std::optional<std::string_view>,
+ * host_span<std::string const>, rmm::cuda_stream_view)
+ *
+ */
+std::vector<std::shared_ptr<table const>> get_cached_timezone_transition_tables(
+  std::optional<std::string_view> tzif_dir,
+  host_span<std::string const> timezone_names,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
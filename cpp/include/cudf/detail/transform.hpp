@@ -48,6 +48,17 @@ std::unique_ptr<column> compute_column(table_view const& table,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::compute_columns
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& expressions,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
@@ -112,5 +123,10 @@ std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
                                                 rmm::cuda_stream_view stream,
                                                 rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::constant_row_bit_count
+ */
+std::optional<size_type> constant_row_bit_count(table_view const& t);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+namespace detail {
+
+/**
+ * @brief Arena-backed flattened representation of a `column_view` hierarchy.
+ *
+ * A `column_view` over a nested column owns a vector of child views, each of which owns
+ * vectors of its own children, so copying or constructing a view of a deeply nested column
+ * performs one host allocation per descendant. This class stores the metadata of a column
+ * and all of its descendants in a single contiguous buffer, laid out in preorder with each
+ * node's children contiguous, so construction performs exactly one host allocation
+ * regardless of nesting depth and re-windowing the root (slicing) costs one more.
+ *
+ * A `column_view` hierarchy is materialized on demand with `to_column_view()`; like
+ * `column_view` itself, this class does not own the device data it describes.
+ */
+class flattened_column_metadata {
+ public:
+  /**
+   * @brief Plain descriptor of one column in the flattened hierarchy.
+   */
+  struct column_metadata {
+    data_type type{type_id::EMPTY};       ///< Element type
+    size_type size{};                     ///< Number of elements
+    void const* data{};                   ///< Pointer to device data
+    bitmask_type const* null_mask{};      ///< Pointer to device null mask
+    size_type null_count{};               ///< Number of null elements
+    size_type offset{};                   ///< Element offset into the data
+    size_type first_child{};              ///< Arena index of this column's first child
+    size_type num_children{};             ///< Number of children
+  };
+
+  /**
+   * @brief Flattens a `column_view` hierarchy into a single contiguous buffer.
+   *
+   * @param col The column to flatten
+   */
+  explicit flattened_column_metadata(column_view const& col);
+
+  /**
+   * @brief Returns the total number of columns in the hierarchy, including the root.
+   *
+   * @return The number of flattened column descriptors
+   */
+  [[nodiscard]] size_type num_columns() const noexcept
+  {
+    return static_cast<size_type>(_arena.size());
+  }
+
+  /**
+   * @brief Returns the descriptor of the root column.
+   *
+   * @return The root column descriptor
+   */
+  [[nodiscard]] column_metadata const& root() const noexcept { return _arena.front(); }
+
+  /**
+   * @brief Returns the descriptor of the column at `index` in the arena.
+   *
+   * Index 0 is the root; a column's children occupy indices `[first_child, first_child +
+   * num_children)`.
+   *
+   * @param index Arena index of the requested column
+   * @return The column descriptor at `index`
+   */
+  [[nodiscard]] column_metadata const& metadata(size_type index) const { return _arena[index]; }
+
+  /**
+   * @brief Returns a flattened hierarchy re-windowed to `[begin, end)` of the root.
+   *
+   * Equivalent to flattening `cudf::slice` of the materialized root, but performs a single
+   * host allocation: the child descriptors are copied unchanged and only the root's offset,
+   * size, and null count change.
+   *
+   * @throws cudf::logic_error if `begin < 0`, `end < begin`, or `end > root().size`
+   *
+   * @param begin Index of the first element of the slice
+   * @param end Index one past the last element of the slice
+   * @param stream CUDA stream used to recount nulls when the root has a null mask
+   * @return The sliced flattened hierarchy
+   */
+  [[nodiscard]] flattened_column_metadata slice(
+    size_type begin,
+    size_type end,
+    rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
+  /**
+   * @brief Materializes the flattened hierarchy back into a `column_view`.
+   *
+   * This performs one host allocation per nested column, so callers should materialize once
+   * and reuse the result rather than converting per use.
+   *
+   * @return A `column_view` equivalent to the one this instance was flattened from
+   */
+  [[nodiscard]] column_view to_column_view() const;
+
+ private:
+  flattened_column_metadata() = default;
+
+  // Appends the children of `_arena[parent_index]` and recurses into them
+  void flatten_children(size_type parent_index, column_view const& parent);
+
+  // Rebuilds the column_view rooted at arena index `index`
+  [[nodiscard]] column_view build_column_view(size_type index) const;
+
+  std::vector<column_metadata> _arena;
+};
+
+}  // namespace detail
+}  // namespace CUDF_EXPORT cudf
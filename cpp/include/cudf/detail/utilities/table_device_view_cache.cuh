@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace CUDF_EXPORT cudf {
+namespace detail {
+
+/**
+ * @brief Cache of serialized `table_device_view`s keyed by shallow equivalence of the source
+ * table.
+ *
+ * Creating a `table_device_view` serializes every column device view into a device buffer, an
+ * H2D copy per call; for a persistent table that is passed to many row-comparator-based ops
+ * this upload is pure overhead after the first call. This cache reuses the serialized blob as
+ * long as the looked-up table is shallow-equivalent to a cached one (views the exact same data
+ * and null masks; see `is_shallow_equivalent`). A table whose contents were rebuilt views
+ * different memory, misses, and gets a fresh entry, so mutation through replacement is handled
+ * naturally; callers that mutate device data in place through a `mutable_column_view` must
+ * `clear()` the cache themselves, as a shallow view cannot observe such writes.
+ *
+ * The cache is thread-safe. Cached views remain valid until `clear()` is called or the cache is
+ * destroyed, and callers must ensure the viewed device data outlives any use of the returned
+ * view.
+ */
+class table_device_view_cache {
+ public:
+  table_device_view_cache()                                          = default;
+  ~table_device_view_cache()                                         = default;
+  table_device_view_cache(table_device_view_cache const&)            = delete;
+  table_device_view_cache& operator=(table_device_view_cache const&) = delete;
+  table_device_view_cache(table_device_view_cache&&)                 = delete;
+  table_device_view_cache& operator=(table_device_view_cache&&)      = delete;
+
+  /**
+   * @brief Returns the device view for `table`, serializing it only on the first lookup.
+   *
+   * @param table The table to look up
+   * @param stream CUDA stream used for the serializing H2D copy on a cache miss
+   * @return A device view of `table`, valid until `clear()` or cache destruction
+   */
+  table_device_view const& get_or_create(table_view const& table,
+                                         rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Drops all cached device views and frees their device buffers.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the number of cached device views.
+   *
+   * @return The number of entries in the cache
+   */
+  [[nodiscard]] std::size_t size() const;
+
+ private:
+  using device_view_ptr = std::unique_ptr<table_device_view, std::function<void(table_device_view*)>>;
+
+  struct entry {
+    table_view source;  ///< Retained to verify shallow equivalence on lookup
+    device_view_ptr device_view;
+  };
+
+  mutable std::mutex _mutex;
+  std::unordered_multimap<std::size_t, entry> _entries;
+};
+
+}  // namespace detail
+}  // namespace CUDF_EXPORT cudf
@@ -56,6 +56,16 @@ std::unique_ptr<column> encode(column_view const& column,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::dictionary::encode(column_view const&,column_view const&,data_type,
+ * rmm::cuda_stream_view,rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> encode(column_view const& column,
+                               column_view const& existing_keys,
+                               data_type indices_type,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr);
+
 /**
  * @brief Create a column by gathering the keys from the provided
  * dictionary_column into a new column using the indices from that column.
@@ -24,6 +24,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
+
 namespace CUDF_EXPORT cudf {
 namespace dictionary::detail {
 /**
@@ -69,6 +71,18 @@ std::unique_ptr<column> set_keys(dictionary_column_view const& dictionary_column
                                  rmm::cuda_stream_view stream,
                                  rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::dictionary::transform_keys(dictionary_column_view
+ * const&,std::function<std::unique_ptr<column>(column_view const&)>,rmm::device_async_resource_ref)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> transform_keys(
+  dictionary_column_view const& dictionary_column,
+  std::function<std::unique_ptr<column>(column_view const&)> transform,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc
  * cudf::dictionary::match_dictionaries(std::vector<cudf::dictionary_column_view>,rmm::device_async_resource_ref)
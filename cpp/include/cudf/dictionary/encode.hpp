@@ -62,6 +62,42 @@ std::unique_ptr<column> encode(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Construct a dictionary column by encoding an existing column against a set of
+ * already-established dictionary keys.
+ *
+ * Intended for streaming/batched encoding: rather than re-sorting the full key universe for
+ * every batch, only the batch's novel values (those not present in `existing_keys`) are sorted
+ * and merged into the already-sorted key set. The output keys are the union of `existing_keys`
+ * and the batch's values, in sorted order.
+ *
+ * `existing_keys` must be non-nullable, unique and in ascending order — the invariants of a
+ * dictionary column's keys, e.g. the keys of a previously encoded batch.
+ *
+ * @throw cudf::logic_error if indices type is not a signed integer type
+ * @throw cudf::logic_error if the column to encode is already a DICTIONARY type
+ * @throw cudf::logic_error if `existing_keys` type does not match `column` or contains nulls
+ *
+ * @code{.pseudo}
+ * c = [429, 111, 213, 111, 500]
+ * d = encode(c, existing_keys=[111, 429])
+ * d now has keys [111, 213, 429, 500] and indices [2, 0, 1, 0, 3]
+ * @endcode
+ *
+ * @param column The column to dictionary encode
+ * @param existing_keys Sorted, unique, non-nullable keys to encode against
+ * @param indices_type The integer type to use for the indices
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Returns a dictionary column
+ */
+std::unique_ptr<column> encode(
+  column_view const& column,
+  column_view const& existing_keys,
+  data_type indices_type            = data_type{type_id::INT32},
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Create a column by gathering the keys from the provided
  * dictionary_column into a new column using the indices from that column.
@@ -20,6 +20,8 @@
 #include <cudf/utilities/memory_resource.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <functional>
+
 namespace CUDF_EXPORT cudf {
 namespace dictionary {
 /**
@@ -149,6 +151,40 @@ std::unique_ptr<column> set_keys(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Create a new dictionary column by applying a value-wise transform
+ * to the keys only.
+ *
+ * This avoids decoding the dictionary column: the `transform` runs once per
+ * key instead of once per row. The transformed keys are de-duplicated and
+ * sorted and the indices remapped accordingly, so transforms that collapse
+ * keys (e.g. upper-casing "a" and "A") produce a valid dictionary.
+ *
+ * @code{.pseudo}
+ * d1 = {keys=["a", "B", "c"], indices=[2, 0, 1, 0]}
+ * d2 = transform_keys(d1, to_upper)
+ * d2 is now {keys=["A", "B", "C"], indices=[2, 0, 1, 0]}
+ * @endcode
+ *
+ * The output column will have the same number of rows as the input column.
+ * Null entries from the input column are copied to the output column.
+ *
+ * @throw std::invalid_argument if the transform result does not have one row per key
+ * @throw std::invalid_argument if the transform result contains nulls
+ *
+ * @param dictionary_column Existing dictionary column.
+ * @param transform Function applied to the keys column; must return a column
+ *        with one non-null element per input key.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New dictionary column.
+ */
+std::unique_ptr<column> transform_keys(
+  dictionary_column_view const& dictionary_column,
+  std::function<std::unique_ptr<column>(column_view const&)> transform,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Create new dictionaries that have keys merged from the input dictionaries.
  *
@@ -188,6 +188,41 @@ class groupby {
     host_span<aggregation_request const> requests,
     rmm::cuda_stream_view stream      = cudf::get_default_stream(),
     rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Merges partial aggregation results produced by preceding groupby invocations.
+   *
+   * In a distributed or multi-pass aggregation each worker first aggregates its local rows. The
+   * partial group keys are then concatenated to form the `keys` of this object and the partial
+   * result columns are merged with this function, instead of re-aggregating the original rows.
+   *
+   * Each request must carry exactly one aggregation -- the aggregation that produced the
+   * request's `values` column -- since every partial result is a separate column. The
+   * aggregation is translated to its merge counterpart: SUM, PRODUCT, MIN and MAX merge with
+   * themselves; COUNT_VALID and COUNT_ALL merge by addition and are returned in their original
+   * type; M2, COLLECT_LIST, COLLECT_SET, HISTOGRAM and TDIGEST partials merge via MERGE_M2,
+   * MERGE_LISTS, MERGE_SETS, MERGE_HISTOGRAM and MERGE_TDIGEST respectively. Passing a merge
+   * aggregation itself is also valid and merges another level of partials, as needed by
+   * multi-level rollup trees.
+   *
+   * If the partial keys are sorted, constructing this object with `keys_are_sorted == YES`
+   * avoids re-sorting them; the keys are never re-hashed.
+   *
+   * The returned table and results follow the same layout as `aggregate`.
+   *
+   * @throws cudf::logic_error If a request carries more than one aggregation
+   * @throws cudf::logic_error If an aggregation kind has no merge counterpart
+   *
+   * @param requests The partial result columns to merge and the aggregations that produced them
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns
+   * @return Pair containing the table with each group's unique key and a vector of
+   * aggregation_results for each request in the same order as specified in `requests`
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> merge(
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
   /**
    * @brief Performs grouped scans on the specified values.
    *
@@ -418,6 +453,92 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::device_async_resource_ref mr);
 };
+
+/**
+ * @brief Groupby object that aggregates successive chunks of a stream sorted on its keys.
+ *
+ * Unlike `groupby`, which requires all keys to be resident at once, this object consumes the
+ * input one chunk at a time. Each chunk must be sorted on the keys with the same column order
+ * and null precedence, and the key ranges of successive chunks must not interleave, i.e. the
+ * stream as a whole is sorted. Every `aggregate_chunk` call emits the groups that are known to
+ * be complete and carries the partial aggregate of the last group forward, so peak memory is
+ * proportional to the chunk size rather than the stream size.
+ *
+ * Only aggregations whose partial results can be merged across chunk boundaries are supported:
+ * SUM, PRODUCT, MIN, MAX, COUNT_VALID and COUNT_ALL. The shape of the aggregation requests
+ * (number of requests and aggregations per request) must be the same for every chunk.
+ */
+class streaming_groupby {
+ public:
+  ~streaming_groupby();
+  streaming_groupby(streaming_groupby const&)            = delete;
+  streaming_groupby(streaming_groupby&&)                 = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&)      = delete;
+
+  /**
+   * @brief Construct a streaming groupby object
+   *
+   * @param null_handling Indicates whether rows in the keys that contain NULL values should be
+   * included
+   * @param column_order Indicates whether each key column is sorted ascending/descending. If
+   * empty, assumes all columns are ascending
+   * @param null_precedence Indicates the ordering of null values in each key column. If empty,
+   * assumes all columns use `null_order::AFTER`
+   */
+  explicit streaming_groupby(null_policy null_handling                      = null_policy::EXCLUDE,
+                             std::vector<order> const& column_order         = {},
+                             std::vector<null_order> const& null_precedence = {});
+
+  /**
+   * @brief Aggregates the next chunk of the stream and emits all completed groups.
+   *
+   * The last group of the chunk may continue in the next chunk, so its partial aggregate is
+   * retained instead of emitted; it is merged with the first group of the next chunk if their
+   * keys are equal, and emitted ahead of it otherwise. Call `flush` after the last chunk to
+   * obtain the final group.
+   *
+   * The emitted group keys are in sorted order and each `aggregation_result` row corresponds to
+   * the group at the same row of the returned table, as in `groupby::aggregate`.
+   *
+   * @throws cudf::logic_error If an aggregation kind is not mergeable across chunks
+   * @throws cudf::logic_error If the request shape differs from the preceding chunks
+   *
+   * @param keys Table whose rows act as the groupby keys of this chunk, sorted on all columns
+   * @param requests The set of columns to aggregate and the aggregations to perform
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns
+   * @return Pair containing a table of the completed groups' unique keys and a vector of
+   * aggregation_results for each request
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate_chunk(
+    table_view const& keys,
+    host_span<aggregation_request const> requests,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Emits the carried final group after the last chunk has been consumed.
+   *
+   * Returns empty results if no group is pending. The object is reset and may be reused for a
+   * new stream afterwards.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns
+   * @return Pair containing a table with the final group's key and its aggregation_results
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> flush(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+ private:
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys with NULLs
+  std::vector<order> _column_order{};          ///< Sort order of each key column
+  std::vector<null_order> _null_precedence{};  ///< Null order of each key column
+  std::unique_ptr<table> _boundary_keys;       ///< Key of the pending boundary group, one row
+  std::vector<aggregation_result> _boundary_results;  ///< Partial aggregates of the boundary group
+  std::vector<std::vector<aggregation::Kind>> _kinds;  ///< Request shape seen on the first chunk
+};
 /** @} */
 }  // namespace groupby
 }  // namespace CUDF_EXPORT cudf
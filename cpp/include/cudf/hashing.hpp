@@ -138,6 +138,29 @@ std::unique_ptr<column> sha256(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Computes a SHA-256 based checksum of each column's raw data buffer
+ *
+ * Intended for integrity checking of bulk data, where hashing every row individually is
+ * unnecessarily expensive. Each column's data bytes (character bytes for strings columns; the
+ * fixed-width element bytes otherwise) are split into 64KiB chunks that are SHA-256 hashed in
+ * parallel, and the concatenated hex digests are reduced the same way until a single digest per
+ * column remains. A column whose data does not exceed one chunk therefore yields the plain
+ * SHA-256 of its bytes. Null masks are not included in the checksum.
+ *
+ * @throws cudf::data_type_error if any input column type is not supported
+ *
+ * @param input The table of columns to checksum
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns A string column with one hex digest per input column
+ */
+std::unique_ptr<column> sha256_checksum(
+  table_view const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Computes the SHA-384 hash value of each row in the given table
  *
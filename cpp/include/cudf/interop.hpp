@@ -91,6 +91,27 @@ DLManagedTensor* to_dlpack(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Convert a cudf column into a zero-copy DLPack DLTensor
+ *
+ * The returned 1D tensor aliases the column's device data rather than copying
+ * it, so no device memory is allocated. The column data must therefore remain
+ * alive and unmodified for the lifetime of the tensor; the `deleter` method of
+ * the returned `DLManagedTensor` frees only the tensor metadata.
+ *
+ * The column type must be numeric and the null count must be zero.
+ *
+ * @throw cudf::logic_error if the column type is not numeric or the column has
+ * a non-zero null count
+ *
+ * @param input Column to expose as a DLPack tensor
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return 1D DLPack tensor aliasing the column's device data
+ */
+DLManagedTensor* to_dlpack_view(column_view const& input,
+                                rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /** @} */  // end of group
 
 /**
@@ -23,8 +23,11 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <chrono>
+#include <functional>
 #include <future>
 #include <memory>
+#include <mutex>
 
 namespace CUDF_EXPORT cudf {
 //! IO interfaces
@@ -389,6 +392,94 @@ class datasource {
   };
 };
 
+/**
+ * @brief Datasource decorator that records per-source IO statistics and optionally traces
+ * individual reads.
+ *
+ * All calls are forwarded to the wrapped datasource. The `host_read` and `device_read` families
+ * (including the async variants) are timed and counted uniformly; for asynchronous device reads
+ * the recorded duration covers the submission of the read, not its completion.
+ */
+class instrumented_datasource : public datasource {
+ public:
+  /**
+   * @brief Aggregated counters for one read family.
+   */
+  struct read_statistics {
+    size_t num_reads{0};   ///< Number of reads issued
+    size_t bytes_read{0};  ///< Total bytes read
+    std::chrono::nanoseconds total_duration{0};  ///< Total time spent in read calls
+  };
+
+  /**
+   * @brief Statistics for all reads issued through this source.
+   */
+  struct statistics {
+    read_statistics host;    ///< Statistics for `host_read` calls
+    read_statistics device;  ///< Statistics for `device_read` and `device_read_async` calls
+  };
+
+  /**
+   * @brief Callback invoked once per read.
+   *
+   * Receives the read offset, size, duration, and whether the read was a device read.
+   */
+  using trace_callback =
+    std::function<void(size_t offset, size_t size, std::chrono::nanoseconds duration, bool is_device_read)>;
+
+  /**
+   * @brief Constructs an instrumented wrapper around an existing datasource.
+   *
+   * @throws cudf::logic_error if `source` is null
+   *
+   * @param source The datasource to instrument; the wrapper takes ownership
+   * @param trace Optional callback invoked for every read
+   */
+  explicit instrumented_datasource(std::unique_ptr<datasource> source, trace_callback trace = {});
+
+  /**
+   * @brief Returns a snapshot of the statistics accumulated so far.
+   *
+   * @return Copy of the current read statistics
+   */
+  [[nodiscard]] statistics get_statistics() const;
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  [[nodiscard]] bool supports_device_read() const override;
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override;
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override;
+
+  size_t device_read(size_t offset, size_t size, uint8_t* dst, rmm::cuda_stream_view stream) override;
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] size_t size() const override;
+
+  [[nodiscard]] bool is_empty() const override;
+
+ private:
+  /// Accumulates one read into the statistics and invokes the trace callback, if any
+  void record_read(size_t offset,
+                   size_t size,
+                   std::chrono::nanoseconds duration,
+                   bool is_device_read);
+
+  std::unique_ptr<datasource> _source;  ///< The wrapped datasource
+  trace_callback _trace;                ///< Optional per-read trace callback
+  mutable std::mutex _stats_mutex;      ///< Guards `_stats` against concurrent reads
+  statistics _stats;                    ///< Accumulated statistics
+};
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace CUDF_EXPORT cudf
@@ -40,6 +40,29 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Computes record-aligned byte offsets that split a CSV source into `num_splits` ranges.
+ *
+ * Returns `num_splits + 1` monotonically increasing offsets, where each inner offset is
+ * positioned immediately after a record terminator. The ranges `[offsets[i], offsets[i + 1])`
+ * therefore cover whole records and can be read independently (e.g. by different workers)
+ * without overlapping reads or boundary re-discovery. A range may be empty when individual
+ * records are larger than the naive split size.
+ *
+ * Only a small window around each naive split point is read from the source; quoted fields
+ * containing the terminator are not taken into account, matching the byte range handling of
+ * `read_csv`.
+ *
+ * @param source Input `datasource` object to compute the splits for
+ * @param num_splits Number of ranges to split the source into
+ * @param terminator Record terminator character
+ *
+ * @return Record-aligned byte offsets delimiting the ranges
+ */
+std::vector<size_t> compute_byte_range_splits(cudf::io::datasource* source,
+                                              size_type num_splits,
+                                              char terminator = '\n');
+
 /**
  * @brief Write an entire dataset to CSV format.
  *
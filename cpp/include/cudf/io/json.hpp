@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -915,6 +915,10 @@ class json_reader_options_builder {
  *  auto result  = cudf::io::read_json(options);
  * @endcode
  *
+ * To extract a single field from a strings column of raw JSON documents, prefer
+ * `cudf::get_json_object`: it evaluates a JSONPath per string and early-exits once the target
+ * field is found, avoiding the cost of fully tokenizing every document.
+ *
  * @param options Settings for controlling reading behavior
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate device memory of the table in the returned
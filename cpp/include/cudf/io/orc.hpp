@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -58,6 +59,8 @@ class orc_reader_options {
 
   // List of individual stripes to read (ignored if empty)
   std::vector<std::vector<size_type>> _stripes;
+  // Predicate filter as AST to filter output rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
   // Rows to skip from the start
   int64_t _skip_rows = 0;
   // Rows to read; `nullopt` is all
@@ -149,6 +152,13 @@ class orc_reader_options {
    */
   [[nodiscard]] bool is_enabled_use_np_dtypes() const { return _use_np_dtypes; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Returns timestamp type to which timestamp column will be cast.
    *
@@ -200,11 +210,14 @@ class orc_reader_options {
    *
    * @throw cudf::logic_error if a negative value is passed
    * @throw cudf::logic_error if stripes have been previously set
+   * @throw cudf::logic_error if a filter has been previously set
    */
   void set_skip_rows(int64_t rows)
   {
     CUDF_EXPECTS(rows >= 0, "skip_rows cannot be negative");
     CUDF_EXPECTS(rows == 0 or _stripes.empty(), "Can't set both skip_rows along with stripes");
+    CUDF_EXPECTS(rows == 0 or not _filter.has_value(),
+                 "Can't set skip_rows along with a filter");
     _skip_rows = rows;
   }
 
@@ -215,14 +228,42 @@ class orc_reader_options {
    *
    * @throw cudf::logic_error if a negative value is passed
    * @throw cudf::logic_error if stripes have been previously set
+   * @throw cudf::logic_error if a filter has been previously set
    */
   void set_num_rows(int64_t nrows)
   {
     CUDF_EXPECTS(nrows >= 0, "num_rows cannot be negative");
     CUDF_EXPECTS(_stripes.empty(), "Can't set both num_rows and stripes");
+    CUDF_EXPECTS(not _filter.has_value(), "Can't set num_rows along with a filter");
     _num_rows = nrows;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * The filter must reference columns with cudf::ast::column_reference, whose indices refer to
+   * the selected output columns in order; cudf::ast::column_name_reference is not supported.
+   * Stripes whose statistics prove that no row can satisfy the filter are skipped entirely, and
+   * the remaining rows are filtered exactly after decode.
+   *
+   * For an ORC file with columns ["A", "B", "C"]:
+   * @code
+   * use_columns({"C", "A"})
+   * .filter(operation(ast_operator::LESS, column_reference{1}, literal{100}));
+   * @endcode
+   * Here, `1` refers to column "A" because the output contains columns in order ["C", "A"].
+   *
+   * @throw cudf::logic_error if `skip_rows` or `num_rows` has been previously set
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter)
+  {
+    CUDF_EXPECTS(_skip_rows == 0, "Can't set filter along with skip_rows");
+    CUDF_EXPECTS(not _num_rows.has_value(), "Can't set filter along with num_rows");
+    _filter = filter;
+  }
+
   /**
    * @brief Enable/Disable use of row index to speed-up reading.
    *
@@ -300,6 +341,16 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc orc_reader_options::set_filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Sets number of rows to skip from the start.
    *
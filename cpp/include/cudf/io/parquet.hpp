@@ -23,6 +23,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/stream_future.hpp>
 
 #include <iostream>
 #include <memory>
@@ -71,6 +72,10 @@ class parquet_reader_options {
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to emit dictionary-encoded string data as dictionary columns
+  bool _convert_strings_to_dictionaries = false;
+  // Whether to size decimal columns by their declared precision
+  bool _use_minimal_decimal_types = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
   // Whether to read and use ARROW schema
@@ -125,6 +130,28 @@ class parquet_reader_options {
     return _convert_strings_to_categories;
   }
 
+  /**
+   * @brief Returns true/false depending on whether string columns should be returned as
+   * dictionary columns built directly from the Parquet dictionary pages.
+   *
+   * @return `true` if strings should be returned as dictionary columns
+   */
+  [[nodiscard]] bool is_enabled_convert_strings_to_dictionaries() const
+  {
+    return _convert_strings_to_dictionaries;
+  }
+
+  /**
+   * @brief Returns true/false depending on whether decimal columns should be sized by their
+   * declared precision instead of their physical storage size.
+   *
+   * @return `true` if decimal columns are sized by their declared precision
+   */
+  [[nodiscard]] bool is_enabled_use_minimal_decimal_types() const
+  {
+    return _use_minimal_decimal_types;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    *
@@ -257,6 +284,35 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning string columns as dictionary columns.
+   *
+   * When enabled, string columns whose column chunks are entirely dictionary-encoded are
+   * returned as DICTIONARY32 columns: the Parquet dictionary page becomes the keys column
+   * and the decoded values become the indices, avoiding the flat string expansion copy.
+   * All data pages of the string columns must use dictionary encoding, the string columns
+   * must not be nested, and only a single row group may be read.
+   *
+   * @param val Boolean value to enable/disable returning string columns as dictionary columns
+   */
+  void enable_convert_strings_to_dictionaries(bool val)
+  {
+    _convert_strings_to_dictionaries = val;
+  }
+
+  /**
+   * @brief Sets to enable/disable sizing decimal columns by their declared precision.
+   *
+   * When enabled, decimal columns stored as FIXED_LEN_BYTE_ARRAY are decoded directly into the
+   * smallest decimal type whose precision can hold the declared precision, instead of the type
+   * matching the physical storage size. This avoids the separate cast pass otherwise needed to
+   * narrow, for example, a 16-byte FIXED_LEN_BYTE_ARRAY with precision 18 from decimal128 to
+   * decimal64. The column scale is unchanged.
+   *
+   * @param val Boolean value to enable/disable sizing decimal columns by precision
+   */
+  void enable_use_minimal_decimal_types(bool val) { _use_minimal_decimal_types = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -380,6 +436,26 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc parquet_reader_options::enable_convert_strings_to_dictionaries
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& convert_strings_to_dictionaries(bool val)
+  {
+    options._convert_strings_to_dictionaries = val;
+    return *this;
+  }
+
+  /**
+   * @copydoc parquet_reader_options::enable_use_minimal_decimal_types
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& use_minimal_decimal_types(bool val)
+  {
+    options._use_minimal_decimal_types = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -504,6 +580,27 @@ table_with_metadata read_parquet(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Reads a Parquet dataset into a set of columns, returning a stream-ordered future.
+ *
+ * Identical to `cudf::io::read_parquet` except that the caller is not required to synchronize
+ * with `stream` before consuming the result: the returned future carries an event recorded
+ * after the decode, so a consumer can wait for it on another stream (`get(stream)`) and overlap
+ * independent work. Host-side work (IO, footer parsing, decode orchestration) still runs on the
+ * calling thread before the future is returned. See `cudf::stream_future`.
+ *
+ * @param options Settings for controlling reading behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return Future holding the set of columns along with metadata
+ */
+stream_future<table_with_metadata> read_parquet_async(
+  parquet_reader_options const& options,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
  * tables, chunk by chunk.
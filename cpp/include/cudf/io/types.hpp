@@ -100,6 +100,17 @@ enum statistics_freq : int32_t {
   STATISTICS_COLUMN   = 3,  ///< Full column and offset indices. Implies STATISTICS_ROWGROUP
 };
 
+/**
+ * @brief Per-column statistics computation control for use with
+ * `column_in_metadata::set_statistics_mode()`
+ */
+enum class statistics_mode : int32_t {
+  USE_DEFAULT = -1,  ///< Use the writer-wide statistics settings
+  NONE,              ///< Do not compute statistics for this column
+  SAMPLED,           ///< Compute statistics from a sample of this column's rows
+  EXACT,             ///< Compute statistics from every row
+};
+
 /**
  * @brief Valid encodings for use with `column_in_metadata::set_encoding()`
  */
@@ -630,7 +641,8 @@ class column_in_metadata {
   std::optional<int32_t> _parquet_field_id;
   std::optional<int32_t> _type_length;
   std::vector<column_in_metadata> children;
-  column_encoding _encoding = column_encoding::USE_DEFAULT;
+  column_encoding _encoding     = column_encoding::USE_DEFAULT;
+  statistics_mode _stats_mode   = statistics_mode::USE_DEFAULT;
 
  public:
   column_in_metadata() = default;
@@ -789,6 +801,24 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Sets the statistics computation mode for this column.
+   *
+   * `SAMPLED` computes the statistics from a subset of this column's rows, which reduces write
+   * time for columns whose statistics are not worth their cost (e.g. ephemeral intermediate
+   * files). Sampled statistics are approximate: the min/max bounds and counts may not cover every
+   * row, so they must not be relied upon by readers for row filtering. `NONE` skips statistics
+   * computation for this column entirely.
+   *
+   * @param mode The statistics mode to use
+   * @return this for chaining
+   */
+  column_in_metadata& set_statistics_mode(statistics_mode mode) noexcept
+  {
+    _stats_mode = mode;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -924,6 +954,13 @@ class column_in_metadata {
    * @return The encoding that was set for this column
    */
   [[nodiscard]] column_encoding get_encoding() const { return _encoding; }
+
+  /**
+   * @brief Get the statistics computation mode that was set for this column.
+   *
+   * @return The statistics mode that was set for this column
+   */
+  [[nodiscard]] statistics_mode get_statistics_mode() const noexcept { return _stats_mode; }
 };
 
 /**
@@ -24,6 +24,7 @@
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/stream_future.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -112,6 +113,31 @@ inner_join(cudf::table_view const& left_keys,
            rmm::cuda_stream_view stream      = cudf::get_default_stream(),
            rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Computes inner join row index vectors, returning a stream-ordered future.
+ *
+ * Identical to `cudf::inner_join` except that the caller is not required to synchronize with
+ * `stream` before consuming the result: the returned future carries an event recorded after the
+ * probe, so a consumer (e.g. the subsequent gathers of the payload columns) can wait for it on
+ * another stream (`get(stream)`) and overlap independent work. See `cudf::stream_future`.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] compare_nulls controls whether null join-key values
+ * should match or not.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return Future holding the pair of vectors [`left_indices`, `right_indices`]
+ */
+stream_future<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+inner_join_async(cudf::table_view const& left_keys,
+                 cudf::table_view const& right_keys,
+                 null_equality compare_nulls       = null_equality::EQUAL,
+                 rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                 rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Returns a pair of row index vectors corresponding to a
  * left join between the specified tables.
@@ -297,12 +323,138 @@ std::unique_ptr<cudf::table> cross_join(
  */
 enum class nullable_join : bool { YES, NO };
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between two
+ * pre-sorted tables.
+ *
+ * Both tables must be sorted ascending on all join key columns, with nulls ordered before
+ * non-null values; behavior is undefined otherwise. Because the matches for each left row form a
+ * contiguous range of right rows, no hash table is built, so the operation runs in memory
+ * proportional to the input and output sizes. Output pairs are produced in left-row order.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 2}}
+ * Right: {{1, 2, 3}}
+ * Result: {{1, 2}, {0, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of columns in `left_keys` or `right_keys` mismatch
+ * @throw cudf::data_type_error if the column data types do not match
+ *
+ * @param left_keys The left table, sorted ascending with nulls first
+ * @param right_keys The right table, sorted ascending with nulls first
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+merge_inner_join(cudf::table_view const& left_keys,
+                 cudf::table_view const& right_keys,
+                 null_equality compare_nulls       = null_equality::EQUAL,
+                 rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                 rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join performed one
+ * hash partition pair at a time.
+ *
+ * Both tables are hash-partitioned on the join keys into `num_partitions` co-partitions which are
+ * staged in pinned host memory, then partition pairs are brought back to the device and joined one
+ * at a time. The hash table and probe scratch memory are therefore bounded by the largest
+ * partition rather than the full build side, allowing joins whose hash table does not fit in
+ * device memory.
+ *
+ * The returned indices refer to rows of `left_keys` and `right_keys` and are produced in
+ * unspecified order, matching `cudf::inner_join`.
+ *
+ * @throw cudf::logic_error if `num_partitions` is not positive
+ * @throw cudf::logic_error if number of columns in `left_keys` or `right_keys` mismatch
+ * @throw cudf::data_type_error if the column data types do not match
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param num_partitions The number of hash partitions to split the inputs into
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls       = null_equality::EQUAL,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Returns a vector of right-table row indices corresponding to an as-of join
+ * between the specified tables.
+ *
+ * For each left row `i`, `result[i]` is the row index of the right row with equal join keys and
+ * the largest `right_on` value not exceeding `left_on[i]`, or `JoinNoneValue` if no right row
+ * qualifies. When several right rows share that largest value, the last one in the original
+ * right-table order is returned, matching the backward direction of pandas `merge_asof`. The
+ * out-of-bounds `JoinNoneValue` entries become nulls when the result is used with
+ * `cudf::gather` and `out_of_bounds_policy::NULLIFY`.
+ *
+ * Neither input needs to be sorted; the right table is sorted internally, so the operation runs
+ * in O((n + m) log m) rather than evaluating every row pair. `left_keys` and `right_keys` may
+ * have zero columns, in which case rows are matched on the ordering columns alone.
+ *
+ * @code{.pseudo}
+ * Left keys: {{0, 0, 1}}  Left on: {5, 1, 5}
+ * Right keys: {{0, 0, 1}} Right on: {2, 4, 6}
+ * Result: {1, JoinNoneValue, JoinNoneValue}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of columns in `left_keys` or `right_keys` mismatch
+ * @throw cudf::logic_error if `left_on` or `right_on` contain nulls
+ * @throw cudf::data_type_error if the key column data types or the ordering column data types do
+ * not match
+ *
+ * @param left_keys The left table of equality join keys, aligned with `left_on`
+ * @param right_keys The right table of equality join keys, aligned with `right_on`
+ * @param left_on The left ordering column
+ * @param right_on The right ordering column
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A vector of right-table row indices, one per left row, that can be used to gather the
+ * matched right rows
+ */
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  cudf::column_view const& left_on,
+  cudf::column_view const& right_on,
+  null_equality compare_nulls       = null_equality::EQUAL,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
  *
  * This class enables the hash join scheme that builds hash table once, and probes as many times as
  * needed (possibly in parallel).
+ *
+ * Dictionary key columns are hashed and compared on their indices without materializing the
+ * dictionary keys, so the build and probe key sets of each dictionary column pair must be
+ * identical — unify them with `cudf::dictionary::match_dictionaries` (or encode the probe batch
+ * against the build keys) before probing. The free join functions perform this unification
+ * automatically.
  */
 class hash_join {
  public:
@@ -341,6 +493,32 @@ class hash_join {
             null_equality compare_nulls,
             rmm::cuda_stream_view stream = cudf::get_default_stream());
 
+  /**
+   * @brief Inserts rows appended to the build table into the hash table.
+   *
+   * `build` must contain the rows of the build table this object was constructed with (or last
+   * extended to) as a prefix, followed by the newly appended rows; only the appended rows are
+   * hashed and inserted. This avoids a full rebuild when the build side grows incrementally, e.g.
+   * across streaming micro-batches. The hash table is reallocated and rebuilt internally only when
+   * the appended rows outgrow its allocated capacity.
+   *
+   * Subsequent probes return indices into `build`.
+   *
+   * @note The `hash_join` object must not outlive the table viewed by `build`, else behavior is
+   * undefined.
+   *
+   * @throw cudf::logic_error If `build` has fewer rows than the current build table or a
+   * mismatched number of columns
+   * @throw cudf::logic_error If `build` has nulls while this hash_join object was not constructed
+   * with null check
+   * @throw cudf::data_type_error If the column data types do not match the current build table
+   *
+   * @param build The extended build table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void insert(cudf::table_view const& build,
+              rmm::cuda_stream_view stream = cudf::get_default_stream());
+
   /**
    * Returns the row indices that can be used to construct the result of performing
    * an inner join between two tables. @see cudf::inner_join(). Behavior is undefined if the
@@ -469,7 +647,7 @@ class hash_join {
     rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
 
  private:
-  const std::unique_ptr<impl_type const> _impl;
+  const std::unique_ptr<impl_type> _impl;
 };
 
 /**
@@ -1233,5 +1411,75 @@ std::size_t conditional_left_anti_join_size(
   ast::expression const& binary_predicate,
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Returns an estimate of the number of matches (rows) when performing a
+ * conditional inner join between the specified tables where the predicate
+ * evaluates to true.
+ *
+ * The estimate is extrapolated from evaluating the predicate over an evenly strided sample of
+ * roughly 1% of the left table's rows against the full right table, so it costs a fraction of the
+ * exact `conditional_inner_join_size`. The result carries no accuracy guarantee; callers sizing
+ * allocations from it should apply their own safety margin and fall back to the exact size
+ * function when an overrun cannot be tolerated.
+ *
+ * @throw cudf::data_type_error if the binary predicate outputs a non-boolean result.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param binary_predicate The condition on which to join
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate intermediate device memory
+ *
+ * @return An estimate of the size that would result from performing the requested join
+ */
+std::size_t conditional_inner_join_size_estimate(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @copydoc cudf::conditional_inner_join_size_estimate
+ *
+ * @brief Returns an estimate of the number of matches (rows) when performing a
+ * conditional left join between the specified tables where the predicate
+ * evaluates to true.
+ */
+std::size_t conditional_left_join_size_estimate(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @copydoc cudf::conditional_inner_join_size_estimate
+ *
+ * @brief Returns an estimate of the number of matches (rows) when performing a
+ * conditional left semi join between the specified tables where the predicate
+ * evaluates to true.
+ */
+std::size_t conditional_left_semi_join_size_estimate(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @copydoc cudf::conditional_inner_join_size_estimate
+ *
+ * @brief Returns an estimate of the number of matches (rows) when performing a
+ * conditional left anti join between the specified tables where the predicate
+ * evaluates to true.
+ */
+std::size_t conditional_left_anti_join_size_estimate(
+  table_view const& left,
+  table_view const& right,
+  ast::expression const& binary_predicate,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -153,6 +153,10 @@ class get_json_object_options {
  * https://tools.ietf.org/id/draft-goessner-dispatch-jsonpath-00.html
  * Implements only the operators: $ . [] *
  *
+ * Each row is evaluated by a lightweight per-string parser that skips non-matching elements
+ * and stops once the path has been resolved, so extracting a single field costs far less than
+ * fully parsing the document (e.g. with `cudf::io::read_json`).
+ *
  * @throw std::invalid_argument if provided an invalid operator or an empty name
  *
  * @param col The input strings column. Each row must contain a valid json string
@@ -77,5 +77,42 @@ std::unique_ptr<column> label_bins(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Counts elements falling into each of the specified bins.
+ *
+ * Equivalent to counting the occurrences of each label produced by `cudf::label_bins` with the
+ * same arguments: the result has one row per bin and `result[i]` is the number of elements of
+ * `input` contained in `left_edges[i], right_edges[i]` with the specified inclusiveness. The
+ * counts are accumulated in per-block shared-memory bins that spill to global atomics, so no
+ * per-value hash map is involved. Elements belonging to no bin, NULL elements and NaN elements
+ * are not counted.
+ *
+ * Bin edges are caller-provided, so non-linear histograms (for example log-scale) are obtained
+ * by passing the matching edge sequence. The notes and preconditions of `cudf::label_bins` on
+ * the edge columns apply.
+ *
+ * @throws cudf::logic_error if `input.type() == left_edges.type() == right_edges.type()` is
+ * violated.
+ * @throws cudf::logic_error if `left_edges.size() != right_edges.size()`
+ * @throws cudf::logic_error if `left_edges.has_nulls()` or `right_edges.has_nulls()`
+ *
+ * @param input The input elements to count according to the specified bins.
+ * @param left_edges Values of the left edge of each bin.
+ * @param left_inclusive Whether or not the left edge is inclusive.
+ * @param right_edges Value of the right edge of each bin.
+ * @param right_inclusive Whether or not the right edge is inclusive.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device.
+ * @return A non-nullable column of `size_type` counts, one per bin.
+ */
+std::unique_ptr<column> bin_counts(
+  column_view const& input,
+  column_view const& left_edges,
+  inclusive left_inclusive,
+  column_view const& right_edges,
+  inclusive right_inclusive,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
@@ -76,6 +76,62 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Create a column of `bool` values indicating whether the specified scalar
+ * is an element of each row of a list column whose rows are individually sorted.
+ *
+ * Each list row is binary-searched instead of linearly scanned, so repeated membership queries
+ * against long lists are much cheaper. Every list row must be sorted ascending with null
+ * elements last — e.g. a companion column built once with
+ * `cudf::lists::sort_lists(lists, order::ASCENDING, null_order::AFTER)` and persisted across
+ * queries. The result is undefined if any list row is not sorted this way.
+ *
+ * Null semantics match `cudf::lists::contains`: output `column[i]` is null if `search_key` is
+ * null or the list row `lists[i]` is null.
+ *
+ * @throw cudf::data_type_error If `search_key` type does not match the element type in `lists`
+ * @throw cudf::logic_error If the element type is a nested type
+ *
+ * @param lists Lists column whose `n` individually-sorted rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains_sorted(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Create a column of `bool` values indicating whether the individually-sorted list rows
+ * of the first column contain the corresponding values in the second column.
+ *
+ * Each list row is binary-searched instead of linearly scanned. Every list row must be sorted
+ * ascending with null elements last, as produced by
+ * `cudf::lists::sort_lists(lists, order::ASCENDING, null_order::AFTER)`. The result is
+ * undefined if any list row is not sorted this way.
+ *
+ * Null semantics match `cudf::lists::contains`: output `column[i]` is null if `search_keys[i]`
+ * is null or the list row `lists[i]` is null.
+ *
+ * @throw cudf::logic_error If `search_keys` does not match `lists` in its number of rows
+ * @throw cudf::data_type_error If `search_keys` type does not match the element type in `lists`
+ * @throw cudf::logic_error If the element type is a nested type
+ *
+ * @param lists Lists column whose `n` individually-sorted rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains_sorted(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Create a column of `bool` values indicating whether each row in the `lists` column
  * contains at least one null element.
@@ -69,5 +69,27 @@ std::unique_ptr<column> contains(cudf::lists_column_view const& lists,
                                  cudf::column_view const& search_keys,
                                  rmm::cuda_stream_view stream,
                                  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::lists::contains_sorted(cudf::lists_column_view const&,
+ *                                       cudf::scalar const&,
+ *                                       rmm::device_async_resource_ref)
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> contains_sorted(cudf::lists_column_view const& lists,
+                                        cudf::scalar const& search_key,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::lists::contains_sorted(cudf::lists_column_view const&,
+ *                                       cudf::column_view const&,
+ *                                       rmm::device_async_resource_ref)
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> contains_sorted(cudf::lists_column_view const& lists,
+                                        cudf::column_view const& search_keys,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr);
 }  // namespace lists::detail
 }  // namespace CUDF_EXPORT cudf
@@ -22,6 +22,7 @@
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace CUDF_EXPORT cudf {
 /**
@@ -75,6 +76,43 @@ std::unique_ptr<table> explode(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Explodes several list columns that share identical offsets in a single pass.
+ *
+ * Equivalent to calling `explode` once per listed column, but the row mapping implied by the
+ * shared offsets is computed only once and the remaining columns are duplicated through a single
+ * gather. Each exploded column's output rows are exactly its child elements since the columns
+ * line up element-for-element. Example:
+ * ```
+ * [[5,10,15], [a,b,c], 100],
+ * [[20,25],   [d,e],   200],
+ * returns
+ * [5,   a,  100],
+ * [10,  b,  100],
+ * [15,  c,  100],
+ * [20,  d,  200],
+ * [25,  e,  200],
+ * ```
+ *
+ * Null and empty list rows behave as in `explode`: they produce no output rows.
+ *
+ * @throw cudf::logic_error if `explode_column_idxs` is empty or contains duplicates
+ * @throw cudf::logic_error if any referenced column is not a LIST column
+ * @throw cudf::logic_error if the referenced columns do not have identical offsets
+ *
+ * @param input_table Table to explode.
+ * @param explode_column_idxs Column indices to explode inside the table.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ *
+ * @return A new table with all listed columns exploded.
+ */
+std::unique_ptr<table> explode(
+  table_view const& input_table,
+  std::vector<size_type> const& explode_column_idxs,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Explodes a list column's elements and includes a position column.
  *
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_device.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+namespace experimental {
+
+/**
+ * @brief A packed table resident on a specific device
+ *
+ * The packed metadata lives on the host; the data buffer lives on `device`. As with any
+ * device-owning object, the entry must be unpacked, used, and destroyed with its device active.
+ */
+struct packed_device_table {
+  rmm::cuda_device_id device;  ///< Device the packed data resides on
+  packed_columns data;         ///< Packed table contents (see `cudf::pack`)
+};
+
+/**
+ * @brief Partitions a table and scatters each partition to a device.
+ *
+ * Rows are assigned to partitions exactly as by `cudf::partition`: row `i` of `input` ends up on
+ * `devices[partition_map[i]]`. Each partition is serialized into `cudf::contiguous_split`'s
+ * packed format and moved to its destination with a single peer-to-peer copy, so on NVLink
+ * systems each partition transfers at link bandwidth rather than through per-column copies.
+ * Peer access to each destination is enabled on first use when the hardware supports it;
+ * otherwise the copies are staged through host memory by the driver.
+ *
+ * The transfers are stream-ordered: each destination's copy waits for the partitions to be ready
+ * on `stream`, and `stream` in turn waits for all copies before any later work submitted to it
+ * runs. The returned tables are therefore safe to use on their devices once the caller has
+ * synchronized with `stream` (or ordered against it with an event).
+ *
+ * Destination buffers are allocated from each destination device's current device resource.
+ *
+ * @throws cudf::logic_error if `devices` is empty
+ * @throws cudf::logic_error if `partition_map` is not a non-nullable integer column of
+ * `input.num_rows()` elements (propagated from `cudf::partition`)
+ *
+ * @param input The table to scatter
+ * @param partition_map Non-nullable column of integers in `[0, devices.size())` mapping each row
+ * to an entry of `devices`
+ * @param devices Destination device of each partition; may include the current device
+ * @param stream CUDA stream on the current device used for partitioning and transfer ordering
+ * @return One packed table per entry of `devices`, resident on that device
+ */
+std::vector<packed_device_table> scatter_to_devices(
+  table_view const& input,
+  column_view const& partition_map,
+  std::vector<rmm::cuda_device_id> const& devices,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Gathers packed tables from multiple devices into a single table on the current device.
+ *
+ * Each input's data buffer is moved to the current device with a single peer-to-peer copy and
+ * the unpacked partitions are concatenated in input order. The inputs must be fully produced
+ * before the copies execute on `stream`; tables returned by `scatter_to_devices` satisfy this
+ * once the caller has synchronized with the scattering stream.
+ *
+ * @throws cudf::logic_error if `tables` is empty
+ * @throws cudf::data_type_error if the unpacked tables have mismatched schemas (propagated from
+ * `cudf::concatenate`)
+ *
+ * @param tables Packed tables to gather; entries may live on any device
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The concatenation of all input tables on the current device
+ */
+std::unique_ptr<table> gather_from_devices(
+  host_span<packed_device_table const> tables,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+}  // namespace experimental
+}  // namespace CUDF_EXPORT cudf
@@ -207,5 +207,74 @@ cudf::size_type null_count(bitmask_type const* bitmask,
                            size_type start,
                            size_type stop,
                            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Performs `bitmask_and` on many tables with a single kernel launch
+ *
+ * Element `i` of the result is equivalent to `bitmask_and(views[i])`. Batching the merges into
+ * one launch avoids paying kernel launch latency per table, which dominates when many narrow
+ * tables are processed at once.
+ *
+ * @param views The tables whose column bitmasks are ANDed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffers
+ * @return For each table, a pair of resulting bitmask and count of unset bits
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_and(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Performs `bitmask_or` on many tables with a single kernel launch
+ *
+ * Element `i` of the result is equivalent to `bitmask_or(views[i])`.
+ *
+ * @param views The tables whose column bitmasks are ORed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffers
+ * @return For each table, a pair of resulting bitmask and count of unset bits
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_or(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Counts the null elements of every column of a table with a single kernel launch
+ *
+ * Element `i` of the result is the null count of `view.column(i)`; columns without a null mask
+ * report zero. Unlike `column_view::null_count()`, which launches a reduction per column, all
+ * columns are counted in one launch.
+ *
+ * @param view The table whose columns' nulls are counted
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return A vector storing the number of null elements in each column
+ */
+std::vector<size_type> null_counts(table_view const& view,
+                                   rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Counts the null elements of every column of a table within each of a set of index
+ * ranges, all ranges and columns with a single kernel launch
+ *
+ * The ranges are interpreted as in `cudf::slice`: pairs `[indices[2*i], indices[2*i+1])` of
+ * row indices. Entry `c * num_ranges + i` of the result is the null count of column `c`
+ * restricted to range `i`; columns without a null mask report zero. Slicing a table into many
+ * pieces otherwise launches one count reduction per column, which serializes wide tables on
+ * kernel launch latency.
+ *
+ * @throws std::invalid_argument if `indices.size() % 2 != 0` or a range is inverted
+ * @throws std::out_of_range if a range starts below zero or ends beyond the table's row count
+ *
+ * @param view The table whose columns' nulls are counted
+ * @param indices Pairs of row indices delimiting the ranges to count within
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Null counts for every column and range, grouped by column
+ */
+std::vector<size_type> segmented_null_counts(
+  table_view const& view,
+  host_span<size_type const> indices,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/contiguous_split.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/export.hpp>
@@ -257,5 +258,90 @@ std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> round_robi
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Lightweight, non-owning description of one round-robin partition.
+ *
+ * A round-robin partition is a strided selection of the input rows: partition `p` (dealt with
+ * `start_partition`) holds the rows `first_row, first_row + stride, first_row + 2 * stride, ...`
+ * of the source table, in input order. No data is copied; consumers that understand strided
+ * access (e.g. a sender streaming the rows out) can use the descriptor directly, and
+ * `materialize()` produces an owning, densely packed copy of just this partition on demand.
+ */
+struct round_robin_view {
+  table_view table;     ///< The source table the rows are selected from
+  size_type first_row;  ///< Input row index of this partition's first row
+  size_type stride;     ///< Step between consecutive rows; equals the number of partitions
+  size_type num_rows;   ///< Number of rows in this partition
+
+  /**
+   * @brief Copies this partition's rows into a new densely packed table.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return Owning table holding this partition's rows
+   */
+  std::unique_ptr<table> materialize(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+};
+
+/**
+ * @brief Describes the round-robin partitions of a table without copying any data.
+ *
+ * Produces the same row-to-partition assignment as `cudf::round_robin_partition`, but as
+ * zero-copy strided descriptors over the input instead of a gathered copy. Useful when the
+ * partitions are immediately consumed (streamed out, counted, sampled) and the reordered table
+ * would be dead weight; individual partitions can still be materialized selectively.
+ *
+ * The descriptors are views: they are valid only as long as `input`'s underlying data.
+ *
+ * @throws cudf::logic_error if `num_partitions <= 0` or `start_partition` is not in
+ * `[0, num_partitions)`
+ *
+ * @param input The input table to partition
+ * @param num_partitions Number of partitions to describe
+ * @param start_partition Index of the partition the first input row is dealt to
+ * @return One descriptor per partition, in partition order
+ */
+std::vector<round_robin_view> round_robin_partition_views(table_view const& input,
+                                                          cudf::size_type num_partitions,
+                                                          cudf::size_type start_partition = 0);
+
+/**
+ * @brief Hash-partitions a table and serializes each partition into its own contiguous buffer.
+ *
+ * Fuses `cudf::hash_partition` and `cudf::contiguous_split` for shuffle workloads: instead of
+ * materializing a reordered copy of the whole table and then serializing it, each row is written
+ * directly into its destination partition's contiguous buffer, with packed metadata produced per
+ * partition. The returned `packed_table`s are self-contained and ready for network transfer (see
+ * `cudf::unpack` on the receiving side).
+ *
+ * The per-partition buffers are allocated from `mr`, so a host-pinned memory resource can be
+ * supplied to stage the buffers for RDMA directly.
+ *
+ * The single-copy path applies when every column is fixed-width without nulls; other tables are
+ * handled by partitioning and serializing in two steps. The order of rows within each partition
+ * is unspecified. Rows are assigned to partitions exactly as by `cudf::hash_partition` with
+ * `hash_id::HASH_MURMUR3`.
+ *
+ * @throws std::out_of_range if any index in `columns_to_hash` is invalid
+ * @throws cudf::logic_error if `num_partitions <= 0` or `columns_to_hash` is empty
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the partition buffers
+ * @return One `packed_table` per partition, each backed by a single contiguous buffer
+ */
+std::vector<packed_table> shuffle_partition(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  size_type num_partitions,
+  uint32_t seed                     = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
@@ -18,10 +18,13 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/stream_future.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace CUDF_EXPORT cudf {
 /**
@@ -85,6 +88,29 @@ std::unique_ptr<scalar> reduce(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief  Computes the reduction of the values in all rows of a column, returning a
+ * stream-ordered future
+ *
+ * Identical to `cudf::reduce` except that the caller is not required to synchronize with
+ * `stream` before consuming the result: the returned future carries an event recorded after the
+ * reduction, so a consumer can wait for it on another stream (`get(stream)`) and overlap
+ * independent work. See `cudf::stream_future`.
+ *
+ * @param col Input column view
+ * @param agg Aggregation operator applied by the reduction
+ * @param output_dtype The output scalar type
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @returns Future holding the output scalar with the reduce result
+ */
+stream_future<std::unique_ptr<scalar>> reduce_async(
+  column_view const& col,
+  reduce_aggregation const& agg,
+  data_type output_dtype,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief  Computes the reduction of the values in all rows of a column with an initial value
  *
@@ -214,6 +240,55 @@ std::unique_ptr<column> scan(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Computes reductions of all rows of each column of a table
+ *
+ * Element `[c][a]` of the result is equivalent to
+ * `reduce(input.column(c), *aggregations[c][a], output_dtype)` where `output_dtype` is the
+ * aggregation's natural target type for the column (the type groupby would produce). SUM, MIN,
+ * MAX, and MEAN aggregations over numeric columns are all computed with a single fused pass over
+ * the table instead of one kernel per (column, aggregation) pair; other aggregations and column
+ * types fall back to the per-column reduction kernels.
+ *
+ * @throw std::invalid_argument if the number of aggregation lists does not match the number of
+ * columns
+ *
+ * @param input The table to reduce
+ * @param aggregations For each column of `input`, the reduction aggregations to apply to it
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns For each column, one scalar per requested aggregation
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> batched_reduce(
+  table_view const& input,
+  std::vector<std::vector<std::unique_ptr<reduce_aggregation>>> const& aggregations,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Computes the Pearson correlation matrix of a table of numeric columns
+ *
+ * The result has one FLOAT64 column of `input.num_columns()` rows per input column, where
+ * element `[c][r]` is the correlation between `input.column(c)` and `input.column(r)`. All
+ * pairwise correlations are produced by a single tiled kernel over the standardized columns
+ * instead of one pass per column pair.
+ *
+ * A correlation is NaN when it is undefined: when either column has zero variance, or when
+ * `input` has fewer than two rows.
+ *
+ * @throw cudf::data_type_error if any column is non-numeric or BOOL8
+ * @throw cudf::logic_error if any column contains nulls
+ *
+ * @param input The table of columns to correlate
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @returns A square table of pairwise correlation coefficients
+ */
+std::unique_ptr<table> correlation_matrix(
+  table_view const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Determines the minimum and maximum values of a column.
  *
@@ -18,11 +18,13 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace CUDF_EXPORT cudf {
 namespace reduction::detail {
@@ -40,5 +42,25 @@ std::unique_ptr<scalar> reduce(column_view const& col,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::batched_reduce
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> batched_reduce(
+  table_view const& input,
+  std::vector<std::vector<std::unique_ptr<reduce_aggregation>>> const& aggregations,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::correlation_matrix
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> correlation_matrix(table_view const& input,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr);
+
 }  // namespace reduction::detail
 }  // namespace CUDF_EXPORT cudf
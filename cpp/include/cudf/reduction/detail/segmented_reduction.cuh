@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,19 +19,212 @@
 #include "reduction_operators.cuh"
 
 #include <cudf/detail/utilities/cast_functor.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <cub/device/device_segmented_reduce.cuh>
+#include <cub/warp/warp_reduce.cuh>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/partition.h>
 #include <thrust/transform.h>
 
 namespace cudf {
 namespace reduction {
 namespace detail {
 
+/// Largest segment served by the warp-per-segment bin
+constexpr size_type warp_segment_size_threshold = 128;
+/// Minimum number of segments before the size-binned strategy pays for its partition pass
+constexpr size_type min_segments_for_binning = 512;
+
+/**
+ * @brief Reduces each listed segment with one warp
+ *
+ * Each warp loads its segment cooperatively and combines lanes with a warp reduction, so short
+ * segments do not each occupy a whole `cub::DeviceSegmentedReduce` block.
+ *
+ * @param d_in Input data iterator
+ * @param d_offsets Iterator to segment indices
+ * @param segment_indices The segments served by this kernel, one per warp
+ * @param num_segments Number of entries in @p segment_indices
+ * @param d_out Output data iterator, indexed by original segment index
+ * @param op The reduction operator
+ * @param initial_value Initial value of each reduction, folded in exactly once per segment
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+CUDF_KERNEL void warp_per_segment_reduce_kernel(InputIterator d_in,
+                                                OffsetIterator d_offsets,
+                                                size_type const* segment_indices,
+                                                size_type num_segments,
+                                                OutputIterator d_out,
+                                                BinaryOp op,
+                                                OutputType initial_value)
+{
+  constexpr auto warps_per_block = 256 / cudf::detail::warp_size;
+  using WarpReduce               = cub::WarpReduce<OutputType>;
+  __shared__ typename WarpReduce::TempStorage temp_storage[warps_per_block];
+
+  auto const warp_id = cudf::detail::grid_1d::global_thread_id() / cudf::detail::warp_size;
+  if (warp_id >= num_segments) { return; }
+  auto const lane_id = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+  auto const segment = segment_indices[warp_id];
+  auto const begin   = d_offsets[segment];
+  auto const end     = d_offsets[segment + 1];
+  auto const length  = static_cast<size_type>(end - begin);
+
+  // `initial_value` is not necessarily the operator identity (it may carry a user-provided init
+  // value), so it must be folded in exactly once per segment, as `cub::DeviceSegmentedReduce`
+  // does. Lanes seed from their first element and only the populated lanes enter the reduction.
+  if (length <= 0) {
+    if (lane_id == 0) { d_out[segment] = initial_value; }
+    return;
+  }
+
+  auto value = OutputType{};
+  if (lane_id < length) {
+    value = static_cast<OutputType>(d_in[begin + lane_id]);
+    for (auto i = begin + lane_id + cudf::detail::warp_size; i < end;
+         i += cudf::detail::warp_size) {
+      value = op(value, d_in[i]);
+    }
+  }
+  auto const valid_lanes = length < cudf::detail::warp_size ? length : cudf::detail::warp_size;
+  value =
+    WarpReduce(temp_storage[threadIdx.x / cudf::detail::warp_size]).Reduce(value, op, valid_lanes);
+  if (lane_id == 0) { d_out[segment] = op(initial_value, value); }
+}
+
+/**
+ * @brief Invokes `cub::DeviceSegmentedReduce` over the given segment offset iterators
+ */
+template <typename InputIterator,
+          typename BeginIterator,
+          typename EndIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+void cub_segmented_reduce(InputIterator d_in,
+                          OutputIterator d_out,
+                          size_type num_segments,
+                          BeginIterator d_begin,
+                          EndIterator d_end,
+                          BinaryOp binary_op,
+                          OutputType initial_value,
+                          rmm::cuda_stream_view stream)
+{
+  size_t temp_storage_bytes = 0;
+  cub::DeviceSegmentedReduce::Reduce(nullptr,
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_begin,
+                                     d_end,
+                                     binary_op,
+                                     initial_value,
+                                     stream.value());
+  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
+                                     temp_storage_bytes,
+                                     d_in,
+                                     d_out,
+                                     num_segments,
+                                     d_begin,
+                                     d_end,
+                                     binary_op,
+                                     initial_value,
+                                     stream.value());
+}
+
+/**
+ * @brief Segmented reduction with segments binned by size
+ *
+ * `cub::DeviceSegmentedReduce` underutilizes the device when segment sizes are skewed: short
+ * segments each still occupy a full block. Segments at most `warp_segment_size_threshold` rows
+ * long are instead reduced one-warp-per-segment, and only the remaining large segments go
+ * through cub. Small inputs skip the binning pass entirely.
+ *
+ * @param d_in Input data iterator
+ * @param d_offset_begin Begin iterator to segment indices
+ * @param num_segments Number of segments to reduce
+ * @param d_out Output data iterator
+ * @param binary_op The reduction operator
+ * @param initial_value Initial value of each reduction
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename InputIterator,
+          typename OffsetIterator,
+          typename OutputIterator,
+          typename BinaryOp,
+          typename OutputType>
+void size_binned_segmented_reduce(InputIterator d_in,
+                                  OffsetIterator d_offset_begin,
+                                  size_type num_segments,
+                                  OutputIterator d_out,
+                                  BinaryOp binary_op,
+                                  OutputType initial_value,
+                                  rmm::cuda_stream_view stream)
+{
+  if (num_segments <= 0) { return; }
+  if (num_segments < min_segments_for_binning) {
+    cub_segmented_reduce(d_in,
+                         d_out,
+                         num_segments,
+                         d_offset_begin,
+                         d_offset_begin + 1,
+                         binary_op,
+                         initial_value,
+                         stream);
+    return;
+  }
+
+  auto small_indices = rmm::device_uvector<size_type>(num_segments, stream);
+  auto large_indices = rmm::device_uvector<size_type>(num_segments, stream);
+  auto const ends    = thrust::partition_copy(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_segments),
+    small_indices.begin(),
+    large_indices.begin(),
+    [d_offset_begin] __device__(size_type i) {
+      return d_offset_begin[i + 1] - d_offset_begin[i] <= warp_segment_size_threshold;
+    });
+  auto const num_small =
+    static_cast<size_type>(thrust::distance(small_indices.begin(), ends.first));
+  auto const num_large =
+    static_cast<size_type>(thrust::distance(large_indices.begin(), ends.second));
+
+  if (num_small > 0) {
+    cudf::detail::grid_1d config(static_cast<int64_t>(num_small) * cudf::detail::warp_size, 256);
+    warp_per_segment_reduce_kernel<<<config.num_blocks,
+                                     config.num_threads_per_block,
+                                     0,
+                                     stream.value()>>>(
+      d_in, d_offset_begin, small_indices.data(), num_small, d_out, binary_op, initial_value);
+  }
+  if (num_large > 0) {
+    cub_segmented_reduce(d_in,
+                         thrust::make_permutation_iterator(d_out, large_indices.begin()),
+                         num_large,
+                         thrust::make_permutation_iterator(d_offset_begin, large_indices.begin()),
+                         thrust::make_permutation_iterator(d_offset_begin + 1,
+                                                           large_indices.begin()),
+                         binary_op,
+                         initial_value,
+                         stream);
+  }
+}
+
 /**
  * @brief Compute the specified simple reduction over each of the segments in the
  * input range of elements
@@ -68,31 +261,8 @@ void segmented_reduce(InputIterator d_in,
 {
   auto const num_segments = static_cast<size_type>(std::distance(d_offset_begin, d_offset_end)) - 1;
   auto const binary_op    = cudf::detail::cast_functor<OutputType>(op);
-  // Allocate temporary storage
-  size_t temp_storage_bytes = 0;
-  cub::DeviceSegmentedReduce::Reduce(nullptr,
-                                     temp_storage_bytes,
-                                     d_in,
-                                     d_out,
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
-  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
-
-  // Run reduction
-  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
-                                     temp_storage_bytes,
-                                     d_in,
-                                     d_out,
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
+  size_binned_segmented_reduce(
+    d_in, d_offset_begin, num_segments, d_out, binary_op, initial_value, stream);
 }
 
 template <typename InputIterator,
@@ -155,31 +325,13 @@ void segmented_reduce(InputIterator d_in,
   rmm::device_uvector<IntermediateType> intermediate_result{static_cast<std::size_t>(num_segments),
                                                             stream};
 
-  // Allocate temporary storage
-  size_t temp_storage_bytes = 0;
-  cub::DeviceSegmentedReduce::Reduce(nullptr,
-                                     temp_storage_bytes,
-                                     d_in,
-                                     intermediate_result.data(),
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
-  auto d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
-
-  // Run reduction
-  cub::DeviceSegmentedReduce::Reduce(d_temp_storage.data(),
-                                     temp_storage_bytes,
-                                     d_in,
-                                     intermediate_result.data(),
-                                     num_segments,
-                                     d_offset_begin,
-                                     d_offset_begin + 1,
-                                     binary_op,
-                                     initial_value,
-                                     stream.value());
+  size_binned_segmented_reduce(d_in,
+                               d_offset_begin,
+                               num_segments,
+                               intermediate_result.data(),
+                               binary_op,
+                               initial_value,
+                               stream);
 
   // compute the result value from intermediate value in device
   thrust::transform(
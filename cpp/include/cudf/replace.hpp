@@ -170,6 +170,68 @@ std::unique_ptr<column> find_and_replace_all(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief A prebuilt mapping of old values to new values for `find_and_replace_all`
+ *
+ * Owns device copies of the values to replace and their replacements, ordered so that lookups
+ * can binary search the old values. Building the map once and passing it to
+ * `find_and_replace_all` amortizes this setup when the same mapping is applied to many columns.
+ *
+ * @throws cudf::logic_error if `values_to_replace` and `replacement_values` size mismatch
+ * @throws cudf::data_type_error if `values_to_replace` and `replacement_values` type mismatch
+ * @throws cudf::logic_error if `values_to_replace` has null entries
+ */
+class replacement_map {
+ public:
+  /**
+   * @brief Constructs a replacement map from columns of old and new values
+   *
+   * @param values_to_replace The values to replace
+   * @param replacement_values The values to replace with
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the map's device memory
+   */
+  replacement_map(
+    column_view const& values_to_replace,
+    column_view const& replacement_values,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  ~replacement_map();
+  replacement_map(replacement_map&&)                 = default;  ///< Move constructor
+  replacement_map& operator=(replacement_map&&)      = default;  ///< Move assignment operator
+  replacement_map(replacement_map const&)            = delete;
+  replacement_map& operator=(replacement_map const&) = delete;
+
+  /// @returns View of the owned values to replace, sorted ascending
+  [[nodiscard]] column_view values_to_replace() const;
+  /// @returns View of the owned replacement values, permuted to match `values_to_replace()`
+  [[nodiscard]] column_view replacement_values() const;
+
+ private:
+  std::unique_ptr<column> _values_to_replace;
+  std::unique_ptr<column> _replacement_values;
+};
+
+/**
+ * @brief Return a copy of `input_col` replacing values found in a prebuilt replacement map
+ *
+ * Equivalent to the column-based `find_and_replace_all` overload, but reuses the search
+ * structure owned by `replacement` instead of rebuilding it on every call.
+ *
+ * @param input_col The column to find and replace values in
+ * @param replacement The prebuilt mapping of old values to new values
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns Copy of `input_col` with specified values replaced
+ */
+std::unique_ptr<column> find_and_replace_all(
+  column_view const& input_col,
+  replacement_map const& replacement,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Replaces values less than `lo` in `input` with `lo_replace`,
  * and values greater than `hi` with `hi_replace`.
@@ -107,6 +107,26 @@ std::unique_ptr<column> byte_cast(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Converts the elements of each column in a table to lists of bytes
+ *
+ * Equivalent to calling `byte_cast` on every column of `input`, but the byte copies of
+ * all numeric columns are batched into a single kernel launch, which is considerably
+ * faster for tables with many columns.
+ *
+ * @param input Table whose columns are converted to lists of bytes
+ * @param endian_configuration Whether to retain or flip the endianness of the elements
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return A table of columns containing the lists of bytes
+ */
+std::unique_ptr<table> byte_cast(
+  table_view const& input,
+  flip_endianness endian_configuration,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of group
 
 }  // namespace CUDF_EXPORT cudf
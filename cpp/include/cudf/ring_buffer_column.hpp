@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+/**
+ * @addtogroup copy_shift
+ * @{
+ * @file
+ * @brief A fixed-capacity column maintained as a device ring buffer
+ */
+
+/**
+ * @brief A fixed-capacity column of fixed-width elements maintained as a device ring buffer.
+ *
+ * Sliding-window workloads repeatedly shift a column left by `K` rows and append `K` new
+ * rows, which with `cudf::shift` costs a full-column copy per batch. This container keeps
+ * the rows in a fixed physical buffer and tracks the logical start position instead, so
+ * each `append` only writes the `K` new rows in place and advances the head.
+ *
+ * The logical row order is exposed through `segments()`, which returns one zero-copy view
+ * when the buffer happens to be contiguous and two (the wrapped tail and head portions)
+ * otherwise; the views can be fed directly to gather, slice, or concatenate. Use
+ * `to_column` to materialize a contiguous copy in logical order.
+ *
+ * Only non-nullable fixed-width columns are supported, since rows are overwritten in
+ * place.
+ */
+class ring_buffer_column {
+ public:
+  /**
+   * @brief Construct a ring buffer that takes ownership of an existing column.
+   *
+   * The column's rows become the initial window contents in logical order, and its size
+   * becomes the fixed capacity.
+   *
+   * @throws cudf::data_type_error if `buffer` is not of a fixed-width type
+   * @throws std::invalid_argument if `buffer` is nullable or empty
+   *
+   * @param buffer The column holding the initial window contents
+   */
+  explicit ring_buffer_column(std::unique_ptr<column>&& buffer);
+
+  ring_buffer_column(ring_buffer_column const&)            = delete;
+  ring_buffer_column& operator=(ring_buffer_column const&) = delete;
+  ring_buffer_column(ring_buffer_column&&)                 = default;
+  ring_buffer_column& operator=(ring_buffer_column&&)      = default;  ///< Move assignment @return this
+
+  /**
+   * @brief Returns the fixed number of rows held by the buffer.
+   *
+   * @return The buffer capacity in rows
+   */
+  [[nodiscard]] size_type capacity() const;
+
+  /**
+   * @brief Returns the element type of the buffer.
+   *
+   * @return The element data type
+   */
+  [[nodiscard]] data_type type() const;
+
+  /**
+   * @brief Returns the physical index of the logically first (oldest) row.
+   *
+   * @return The physical index of logical row zero
+   */
+  [[nodiscard]] size_type head() const { return _head; }
+
+  /**
+   * @brief Returns true if the logical order wraps around the end of the physical buffer.
+   *
+   * @return true if `segments()` returns two views
+   */
+  [[nodiscard]] bool is_wrapped() const { return _head != 0; }
+
+  /**
+   * @brief Drops the oldest `new_rows.size()` rows and appends `new_rows` at the end.
+   *
+   * Equivalent to shifting the window left by `new_rows.size()` and writing the new rows
+   * into the freed positions, but only the new rows are written; the surviving rows are
+   * not moved.
+   *
+   * @throws cudf::data_type_error if `new_rows` is not of the buffer's type
+   * @throws std::invalid_argument if `new_rows` has nulls or is larger than the capacity
+   *
+   * @param new_rows The rows to append, in logical order
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void append(column_view const& new_rows, rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns zero-copy views covering the window in logical (oldest-first) order.
+   *
+   * @return One view when the window is physically contiguous, otherwise two
+   */
+  [[nodiscard]] std::vector<column_view> segments() const;
+
+  /**
+   * @brief Materializes the window as a contiguous column in logical order.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A new column holding the window rows oldest-first
+   */
+  [[nodiscard]] std::unique_ptr<column> to_column(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+
+ private:
+  std::unique_ptr<column> _buffer;
+  size_type _head{0};
+};
+
+/** @} */  // end of group
+
+}  // namespace CUDF_EXPORT cudf
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <memory>
+
+namespace CUDF_EXPORT cudf {
+namespace rle {
+/**
+ * @addtogroup column_transform
+ * @{
+ * @file
+ * @brief Run-length encode and decode APIs
+ */
+
+/**
+ * @brief Run-length-encoded representation of a column
+ *
+ * Stores one element per run of consecutive equal values, in the same shape as Arrow's
+ * run-end-encoded layout: `values` holds each run's value (including null runs) and
+ * `run_ends` holds the cumulative end offset of each run, so run `i` covers decoded rows
+ * `[run_ends[i-1], run_ends[i])` and the last run end equals the decoded row count.
+ *
+ * Columns with long runs of repeated values compress far below their decoded footprint,
+ * and operations that only touch run boundaries (decode-with-gather, per-run reductions)
+ * can work on the compressed form directly.
+ */
+struct rle_column {
+  std::unique_ptr<column> run_ends;  ///< INT32 column of cumulative run end offsets, one per run,
+                                     ///< in strictly increasing order with no nulls
+  std::unique_ptr<column> values;    ///< One element per run carrying the run's value; nulls
+                                     ///< denote runs of null rows
+};
+
+/**
+ * @brief Run-length encodes a column
+ *
+ * Each maximal group of consecutive equal rows becomes one run. Null rows compare equal to
+ * each other, so consecutive nulls collapse into a single null run.
+ *
+ * @code{.pseudo}
+ * c = [5, 5, 5, null, null, 9]
+ * r = encode(c)
+ * r now has values [5, null, 9] and run_ends [3, 5, 6]
+ * @endcode
+ *
+ * @param input The column to run-length encode
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Run-length-encoded representation of `input`
+ */
+rle_column encode(column_view const& input,
+                  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Expands a run-length-encoded column back to one row per decoded element
+ *
+ * @throw cudf::data_type_error if `run_ends` is not INT32
+ * @throw cudf::logic_error if `run_ends` contains nulls or its size differs from `values`
+ *
+ * @param run_ends INT32 column of cumulative run end offsets
+ * @param values Column with one element per run
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Decoded column with type matching `values`
+ */
+std::unique_ptr<column> decode(
+  column_view const& run_ends,
+  column_view const& values,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Gathers decoded rows directly from a run-length-encoded column
+ *
+ * Equivalent to `cudf::gather` on the decoded column, but maps each requested row to its run
+ * with a binary search over `run_ends` instead of materializing the decoded column first. The
+ * output is a dense column since an arbitrary gather map does not preserve runs.
+ *
+ * @throw cudf::data_type_error if `run_ends` is not INT32 or `gather_map` is not an index type
+ * @throw cudf::logic_error if `run_ends` or `gather_map` contains nulls, or if `run_ends` size
+ * differs from `values`
+ *
+ * @param run_ends INT32 column of cumulative run end offsets
+ * @param values Column with one element per run
+ * @param gather_map Non-nullable column of decoded row indices to gather
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Dense column of the gathered rows with type matching `values`
+ */
+std::unique_ptr<column> gather(
+  column_view const& run_ends,
+  column_view const& values,
+  column_view const& gather_map,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/** @} */  // end of group
+}  // namespace rle
+}  // namespace CUDF_EXPORT cudf
@@ -318,6 +318,76 @@ std::unique_ptr<column> grouped_rolling_window(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+namespace detail {
+struct rolling_group_boundaries;
+}  // namespace detail
+
+/**
+ * @brief Precomputed group boundaries for repeated grouped rolling window aggregations
+ *
+ * Every `grouped_rolling_window()` call recomputes the group offsets and labels from the
+ * grouping keys. When several rolling aggregations run over the same grouping (e.g. multiple
+ * window sizes or aggregations per column), this object computes the boundaries once in its
+ * constructor and reuses them for each `rolling_window()` call.
+ *
+ * The grouping keys are not retained; the object remains valid after they are destroyed.
+ * As with `grouped_rolling_window()`, rows must be presorted by the grouping key values,
+ * and window semantics (including `preceding_window`/`following_window` signs and
+ * `min_periods`) are identical.
+ */
+class rolling_grouping {
+ public:
+  rolling_grouping() = delete;
+  ~rolling_grouping();
+  rolling_grouping(rolling_grouping const&)            = delete;
+  rolling_grouping(rolling_grouping&&) noexcept;
+  rolling_grouping& operator=(rolling_grouping const&) = delete;
+  rolling_grouping& operator=(rolling_grouping&&)      = delete;
+
+  /**
+   * @brief Computes the group boundaries for the given (pre-sorted) grouping keys
+   *
+   * @throw cudf::logic_error if `group_keys` has no columns
+   *
+   * @param group_keys The (pre-sorted) grouping columns
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  rolling_grouping(table_view const& group_keys,
+                   rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Applies a grouped rolling window function using the precomputed boundaries
+   *
+   * Equivalent to `grouped_rolling_window()` called with the grouping keys this object
+   * was constructed from.
+   *
+   * @throw cudf::logic_error if `input` does not have as many rows as the grouping keys
+   *
+   * @param input The input column (to be aggregated)
+   * @param preceding_window The static rolling window size in the backward direction (for
+   * positive values), or forward direction (for negative values)
+   * @param following_window The static rolling window size in the forward direction (for
+   * positive values), or backward direction (for negative values)
+   * @param min_periods Minimum number of observations in window required to have a value,
+   * otherwise element `i` is null
+   * @param aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A nullable output column containing the rolling window results
+   */
+  std::unique_ptr<column> rolling_window(
+    column_view const& input,
+    size_type preceding_window,
+    size_type following_window,
+    size_type min_periods,
+    rolling_aggregation const& aggr,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+
+ private:
+  std::unique_ptr<detail::rolling_group_boundaries> _boundaries;
+};
+
 /**
  * @brief  Applies a grouping-aware, timestamp-based rolling window function to the values in a
  *         column.
@@ -568,6 +638,78 @@ std::unique_ptr<column> grouped_range_rolling_window(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Precomputed per-row window bounds for repeated range-based rolling aggregations
+ *
+ * `grouped_range_rolling_window()` derives the per-row window extents from the order-by
+ * column with a binary-search pass on every call. When several aggregations run over the
+ * same grouping, order-by column and ranges, this object performs the search once in its
+ * constructor and reuses the resulting window-bound columns for each `rolling_window()`
+ * call.
+ *
+ * Neither the grouping keys nor the order-by column are retained; the object remains
+ * valid after they are destroyed. As with `grouped_range_rolling_window()`, rows must be
+ * presorted by the grouping keys and the order-by column, and the window and `min_periods`
+ * semantics are identical.
+ */
+class precomputed_range_windows {
+ public:
+  precomputed_range_windows() = delete;
+  ~precomputed_range_windows();
+  precomputed_range_windows(precomputed_range_windows const&)            = delete;
+  precomputed_range_windows(precomputed_range_windows&&) noexcept;
+  precomputed_range_windows& operator=(precomputed_range_windows const&) = delete;
+  precomputed_range_windows& operator=(precomputed_range_windows&&)      = delete;
+
+  /**
+   * @brief Computes the per-row window bounds for the given grouping, order-by column
+   * and window ranges
+   *
+   * @throw cudf::logic_error if `group_keys` is non-empty and does not have as many rows
+   * as `orderby_column`
+   *
+   * @param group_keys The (pre-sorted) grouping columns; may have zero columns
+   * @param orderby_column The (pre-sorted) order-by column, for range comparisons
+   * @param order The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+   * @param preceding The interval value in the backward direction
+   * @param following The interval value in the forward direction
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  precomputed_range_windows(table_view const& group_keys,
+                            column_view const& orderby_column,
+                            cudf::order order,
+                            range_window_bounds const& preceding,
+                            range_window_bounds const& following,
+                            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Applies a range-based rolling window function using the precomputed bounds
+   *
+   * Equivalent to `grouped_range_rolling_window()` called with the grouping keys,
+   * order-by column and ranges this object was constructed from.
+   *
+   * @throw cudf::logic_error if `input` does not have as many rows as the order-by column
+   *
+   * @param input The input column (to be aggregated)
+   * @param min_periods Minimum number of observations in window required to have a value,
+   * otherwise element `i` is null
+   * @param aggr The rolling window aggregation type (SUM, MAX, MIN, etc.)
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A nullable output column containing the rolling window results
+   */
+  std::unique_ptr<column> rolling_window(
+    column_view const& input,
+    size_type min_periods,
+    rolling_aggregation const& aggr,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+
+ private:
+  std::unique_ptr<column> _preceding;
+  std::unique_ptr<column> _following;
+};
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
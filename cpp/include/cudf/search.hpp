@@ -22,6 +22,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <vector>
 
@@ -117,6 +118,55 @@ std::unique_ptr<column> upper_bound(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Find insertion points in a sorted table for the rows of many needles tables at once.
+ *
+ * Equivalent to calling `lower_bound(haystack, needles[i], ...)` for each needles table, but the
+ * whole batch shares a single comparator setup and search launch. Intended for workloads that
+ * issue many small searches against one haystack, where per-call overhead dominates.
+ *
+ * @throws cudf::logic_error if the needles tables do not all have the same schema
+ *
+ * @param haystack The table containing search space
+ * @param needles Tables of values for which to find the insert locations in the search space
+ * @param column_order Vector of column sort order
+ * @param null_precedence Vector of null_precedence enums needles
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A column of insertion points per needles table, in input order
+ */
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Find last-insertion points in a sorted table for the rows of many needles tables at once.
+ *
+ * Equivalent to calling `upper_bound(haystack, needles[i], ...)` for each needles table, but the
+ * whole batch shares a single comparator setup and search launch.
+ *
+ * @throws cudf::logic_error if the needles tables do not all have the same schema
+ *
+ * @param haystack The table containing search space
+ * @param needles Tables of values for which to find the insert locations in the search space
+ * @param column_order Vector of column sort order
+ * @param null_precedence Vector of null_precedence enums needles
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return A column of insertion points per needles table, in input order
+ */
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Check if the given `needle` value exists in the `haystack` column.
  *
@@ -166,5 +216,54 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief A prebuilt, reusable device index for membership tests against a fixed haystack.
+ *
+ * `cudf::contains` rebuilds its lookup structure on every call. When the same haystack is probed
+ * repeatedly, this class sorts the haystack once at construction (skipping the sort if the input
+ * is already ascending with nulls last) and answers each `contains()` query with binary searches
+ * over the sorted copy.
+ *
+ * Results match `cudf::contains(haystack, needles)`: the output is a BOOL column with the same
+ * size and null mask as `needles`, nulls compare equal, and all NaNs compare equal.
+ */
+class contains_index {
+ public:
+  contains_index() = delete;
+  ~contains_index();
+  contains_index(contains_index const&)            = delete;
+  contains_index(contains_index&&)                 = delete;
+  contains_index& operator=(contains_index const&) = delete;
+  contains_index& operator=(contains_index&&)      = delete;
+
+  /**
+   * @brief Constructs the index, sorting and storing a device copy of the haystack.
+   *
+   * @param haystack The column containing the search space
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the index's device memory
+   */
+  contains_index(column_view const& haystack,
+                 rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                 rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Checks each needle for membership in the indexed haystack.
+   *
+   * @param needles A column of values to check for existence in the search space
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL column indicating if each element in `needles` exists in the search space
+   */
+  std::unique_ptr<column> contains(
+    column_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+
+ private:
+  struct impl;
+  std::unique_ptr<impl const> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
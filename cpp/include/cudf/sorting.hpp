@@ -23,10 +23,15 @@
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace CUDF_EXPORT cudf {
 
+namespace experimental::row::lexicographic {
+struct preprocessed_table;
+}  // namespace experimental::row::lexicographic
+
 /**
  * @addtogroup column_sort
  * @{
@@ -56,6 +61,31 @@ std::unique_ptr<column> sorted_order(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr              = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Computes the row indices that would produce `input` in a lexicographical sorted order,
+ * reusing caller-held preprocessed comparator state.
+ *
+ * Sorting a table with nested (struct or list) key columns preprocesses the keys — flattening
+ * struct hierarchies and decomposing them for the row comparator — before any comparison runs.
+ * When the same keys are sorted repeatedly, that work can be done once with
+ * `cudf::experimental::row::lexicographic::preprocessed_table::create` and passed to every call.
+ * The column order and null precedence are the ones baked into `preprocessed_input` at creation.
+ *
+ * @throw cudf::logic_error if `preprocessed_input` is null
+ *
+ * @param input The table to sort; must be the table `preprocessed_input` was created from
+ * @param preprocessed_input Preprocessed comparator state for `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of elements containing the permuted row indices of
+ * `input` if it were sorted
+ */
+std::unique_ptr<column> sorted_order(
+  table_view const& input,
+  std::shared_ptr<experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Computes the row indices that would produce `input` in a stable
  * lexicographical sorted order.
@@ -127,6 +157,37 @@ std::unique_ptr<table> stable_sort(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr              = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Returns the first `k` rows of `input` in lexicographically sorted order
+ *
+ * Equivalent to `cudf::sort(input)` followed by slicing off the first `k` rows,
+ * but when `k` is much smaller than `input.num_rows()` only a small subset of the
+ * rows is actually sorted. Rows that compare equal to the `k`-th row may be
+ * selected in any order.
+ *
+ * If `k >= input.num_rows()` the entire sorted table is returned.
+ *
+ * @param input The table to select from
+ * @param k The number of rows to return
+ * @param column_order The desired order for each column. Size must be
+ * equal to `input.num_columns()` or empty. If empty, all columns are sorted in
+ * ascending order.
+ * @param null_precedence The desired order of a null element compared to other
+ * elements for each column in `input`. Size must be equal to
+ * `input.num_columns()` or empty. If empty, all columns will be sorted with
+ * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return New table containing the first `k` rows of `input` in sorted order
+ */
+std::unique_ptr<table> top_k(
+  table_view const& input,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr              = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Performs a key-value sort.
  *
@@ -210,6 +271,119 @@ std::unique_ptr<column> rank(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Computes one or more per-group rank columns from a single sort pass.
+ *
+ * Rows are grouped by equality on `group_keys` and ranked within each group by `order_keys`,
+ * producing one `size_type` column per entry of `methods`, aligned with the input rows. Ranks
+ * start from 1. Supported methods are `FIRST` (row number), `MIN` (rank with gaps) and `DENSE`
+ * (rank without gaps). The sort permutation that orders the input by (group keys, order keys) is
+ * also returned so subsequent window functions over the same partitioning can reuse it instead
+ * of sorting again.
+ *
+ * `group_keys` may have zero columns, in which case the whole input forms one group.
+ *
+ * @code{.pseudo}
+ * group_keys = {{"a", "b", "a", "a"}}
+ * order_keys = {{9, 5, 7, 7}}
+ * FIRST = {3, 1, 1, 2}
+ * MIN   = {3, 1, 1, 1}
+ * DENSE = {2, 1, 1, 1}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `order_keys` has no columns, if row counts mismatch, if `methods`
+ * is empty or contains an unsupported method, or if `column_order` or `null_precedence` size
+ * does not match the number of order key columns
+ *
+ * @param group_keys The table of columns defining the partitions
+ * @param order_keys The table of columns defining the ordering within each partition
+ * @param methods The rank methods to compute, one output column per entry
+ * @param column_order The desired sort order for each order key column
+ * @param null_precedence The desired order of nulls in each order key column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and column's device memory
+ * @return A pair of the table of rank columns, in input row order, and the sort permutation
+ * mapping sorted positions to input rows
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> windowed_ranks(
+  table_view const& group_keys,
+  table_view const& order_keys,
+  std::vector<rank_method> const& methods,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr              = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Maintains a persistently sorted column across appended batches for repeated ranking
+ *
+ * Each appended batch is sorted on its own and merged with the retained sorted column,
+ * so the cost per batch is proportional to a merge rather than a full re-sort of all
+ * rows seen so far. Ranks are computed directly from the retained sorted order without
+ * sorting again; the `i`-th rank returned by `ranks()` belongs to the `i`-th row of
+ * `sorted_keys()`.
+ */
+class incremental_rank {
+ public:
+  /**
+   * @brief Constructs an empty incremental rank structure
+   *
+   * @param column_order The desired sort order for ranking
+   * @param null_precedence The desired order of null compared to other elements
+   */
+  explicit incremental_rank(order column_order         = order::ASCENDING,
+                            null_order null_precedence = null_order::BEFORE);
+
+  ~incremental_rank();
+
+  /**
+   * @brief Merges a batch of rows into the retained sorted column
+   *
+   * The batch itself does not need to be sorted.
+   *
+   * @param batch The rows to append
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the retained sorted column
+   */
+  void add_batch(column_view const& batch,
+                 rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                 rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Returns a view of all rows appended so far, in sorted order
+   *
+   * The view is invalidated by the next call to `add_batch`.
+   *
+   * @return View of the retained sorted column
+   */
+  [[nodiscard]] column_view sorted_keys() const;
+
+  /**
+   * @brief Computes ranks of the retained sorted column
+   *
+   * @param method The ranking method used for tie breaking (same values)
+   * @param null_handling flag to include nulls during ranking. If nulls are not
+   * included, corresponding rank will be null.
+   * @param percentage flag to convert ranks to percentage in range (0,1]
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A column containing the rank of each row of `sorted_keys()`. The output
+   * column type is `size_type` column by default but if `method=rank_method::AVERAGE`
+   * or `percentage=True` the output column is a `double` column
+   */
+  [[nodiscard]] std::unique_ptr<column> ranks(
+    rank_method method,
+    null_policy null_handling,
+    bool percentage,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+
+ private:
+  order _column_order;              ///< Sort order of the retained column
+  null_order _null_precedence;      ///< Null order of the retained column
+  std::unique_ptr<table> _sorted;   ///< All appended rows in sorted order, as a one-column table
+};
+
 /**
  * @brief Returns sorted order after sorting each segment in the table.
  *
@@ -20,6 +20,7 @@
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <memory>
 #include <vector>
@@ -217,6 +218,135 @@ std::unique_ptr<table> apply_boolean_mask(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Filters `input` using `boolean_mask`, sizing the output from a selectivity hint.
+ *
+ * Equivalent to the basic `apply_boolean_mask`, but when the input permits a fused
+ * single-pass filter (all columns fixed-width and non-nullable), the output buffers
+ * are allocated optimistically at `selectivity_hint * input.num_rows()` rows instead
+ * of the full input size. A hint that underestimates the true selectivity only costs
+ * an extra pass over the first column; the result is always exact.
+ *
+ * Callers that filter repeatedly with similar masks (e.g. one filter per pipeline
+ * stage) can feed the observed selectivity of prior batches back in as the hint.
+ *
+ * @throws std::invalid_argument if `selectivity_hint` is not in the range `(0, 1]`.
+ * @throws cudf::logic_error if `input.num_rows() != boolean_mask.size()`.
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
+ * as a mask to filter the `input`.
+ * @param[in] selectivity_hint Expected fraction of rows passing the filter, in `(0, 1]`
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input passing
+ * the filter defined by @p boolean_mask.
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  table_view const& input,
+  column_view const& boolean_mask,
+  double selectivity_hint,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief A compact selection vector: the sorted indices of the rows selected by a boolean mask.
+ *
+ * A selection vector is produced once from a boolean filter result (see
+ * `make_selection_vector`) and can then be applied to any number of tables with the same
+ * row count. Because the indices are materialized only once, consumers that would each
+ * re-scan the full-width boolean mask instead perform a single gather over the selected
+ * rows. The indices column is itself a valid gather map and may be passed directly to
+ * `cudf::gather`; every index is guaranteed to be in `[0, source_size())`.
+ */
+class selection_vector {
+ public:
+  /**
+   * @brief Construct from a column of sorted row indices.
+   *
+   * @param indices Column of type type_id::INT32 holding sorted, in-bounds row indices
+   * @param source_size Number of rows in the table(s) the indices select from
+   */
+  selection_vector(std::unique_ptr<column>&& indices, size_type source_size);
+
+  selection_vector(selection_vector&&)            = default;  ///< Move constructor
+  selection_vector& operator=(selection_vector&&) = default;  ///< Move assignment
+  selection_vector(selection_vector const&)       = delete;
+  selection_vector& operator=(selection_vector const&) = delete;
+  ~selection_vector();
+
+  /**
+   * @brief View of the selected row indices, usable directly as a gather map.
+   *
+   * @return Column view of sorted type_id::INT32 row indices
+   */
+  [[nodiscard]] column_view indices() const;
+
+  /**
+   * @brief Number of selected rows.
+   *
+   * @return Number of selected rows
+   */
+  [[nodiscard]] size_type num_selected() const;
+
+  /**
+   * @brief Number of rows in the table(s) this selection applies to.
+   *
+   * @return Row count of the source table
+   */
+  [[nodiscard]] size_type source_size() const { return _source_size; }
+
+ private:
+  std::unique_ptr<column> _indices;  ///< Sorted row indices of the selected rows
+  size_type _source_size;            ///< Row count of the table the indices select from
+};
+
+/**
+ * @brief Creates a selection vector from a boolean mask.
+ *
+ * An element `i` of the mask selects row `i` when it is non-null and `true`, exactly as in
+ * `apply_boolean_mask`. The resulting indices are sorted ascending, so applying the
+ * selection preserves the input order.
+ *
+ * Unlike `apply_boolean_mask`, which scans the mask once per filtered table, the
+ * compaction to indices happens exactly once here; the vector can then be applied to any
+ * table with `source_size()` rows (e.g. every column batch sharing one WHERE clause)
+ * via `apply_selection_vector` or `cudf::gather`.
+ *
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ *
+ * @param boolean_mask A nullable column_view of type type_id::BOOL8
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ * @return Selection vector holding the indices of the rows where the mask is true
+ */
+selection_vector make_selection_vector(
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Filters `input` to the rows selected by `selection`.
+ *
+ * Produces the same result as `apply_boolean_mask` with the mask the selection was built
+ * from, but performs only a gather of the pre-computed indices: the boolean mask is not
+ * re-scanned.
+ *
+ * @throws cudf::logic_error if `input.num_rows() != selection.source_size()`.
+ *
+ * @param input The input table_view to filter
+ * @param selection Selection vector built from a mask of `input.num_rows()` rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing the selected rows of @p input in order
+ */
+std::unique_ptr<table> apply_selection_vector(
+  table_view const& input,
+  selection_vector const& selection,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
@@ -314,6 +444,71 @@ std::unique_ptr<column> distinct_indices(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Incremental distinct filter that deduplicates batches against accumulated history.
+ *
+ * Calling `cudf::distinct` on each batch of a stream only removes duplicates within that batch;
+ * deduplicating against earlier batches would require concatenating and re-hashing the full
+ * history every time. This object retains the key rows of every distinct row it has emitted and
+ * filters each new batch in two stages: the batch is first deduplicated with an exact hash set
+ * sized only for the batch, and the surviving rows are then probed against the history without
+ * inserting the historical rows again. Only rows never seen before are returned, and their keys
+ * are appended to the history.
+ *
+ * NaN values in floating-point key columns always compare equal (as with
+ * `nan_equality::ALL_EQUAL`); otherwise each NaN row would be reported as new in every batch and
+ * the retained history would grow without bound.
+ *
+ * The order of rows in each returned table is not specified.
+ */
+class streaming_distinct {
+ public:
+  streaming_distinct()                                     = delete;
+  ~streaming_distinct();
+  streaming_distinct(streaming_distinct const&)            = delete;
+  streaming_distinct& operator=(streaming_distinct const&) = delete;
+  streaming_distinct(streaming_distinct&&) noexcept;
+  streaming_distinct& operator=(streaming_distinct&&)      = delete;
+
+  /**
+   * @brief Constructs an empty streaming distinct filter.
+   *
+   * @param keys Vector of indices indicating key columns in each inserted batch
+   * @param nulls_equal Flag to specify whether null elements should be considered as equal
+   */
+  streaming_distinct(std::vector<size_type> keys, null_equality nulls_equal = null_equality::EQUAL);
+
+  /**
+   * @brief Returns the rows of `batch` whose keys have not been seen in any prior batch.
+   *
+   * Rows with duplicate keys within `batch` itself are also reduced to a single arbitrary
+   * occurrence, matching `duplicate_keep_option::KEEP_ANY`. The keys of all returned rows are
+   * added to the retained history.
+   *
+   * @throws cudf::logic_error if a key index is out of range for `batch`, or if the key columns
+   * do not match the types of previously inserted batches
+   *
+   * @param batch The batch of rows to deduplicate
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table
+   * @return Table containing the previously unseen rows of `batch`, in an unspecified order
+   */
+  std::unique_ptr<table> insert(
+    table_view const& batch,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Returns the number of distinct rows emitted (and retained as history) so far.
+   */
+  [[nodiscard]] size_type distinct_count() const noexcept;
+
+ private:
+  std::vector<size_type> _keys;          ///< Key column indices within each batch
+  null_equality _nulls_equal;            ///< Whether null key elements compare equal
+  std::unique_ptr<table> _history_keys;  ///< Key rows of every distinct row emitted so far
+};
+
 /**
  * @brief Create a new table without duplicate rows, preserving input order.
  *
@@ -421,5 +616,80 @@ cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal    = null_equality::EQUAL,
                                rmm::cuda_stream_view stream = cudf::get_default_stream());
 
+/**
+ * @brief Builds a HyperLogLog sketch over the rows of a table.
+ *
+ * The sketch is a column of `2^precision` UINT8 registers summarizing the set of distinct rows
+ * seen, using kilobytes of memory regardless of the number of rows. Sketches built with the same
+ * precision merge losslessly with `cudf::merge_hyperloglog_sketches`, so partial sketches can be
+ * combined across batches or across GPUs before estimating. Null key values participate in the
+ * row hash, matching `null_equality::EQUAL` semantics of `cudf::distinct_count`.
+ *
+ * The relative standard error of the resulting estimate is approximately
+ * `1.04 / sqrt(2^precision)`.
+ *
+ * @throws std::invalid_argument if `precision` is not in the range `[4, 18]`
+ *
+ * @param input Table whose distinct rows are summarized
+ * @param precision Number of register-index bits; the sketch holds `2^precision` registers
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column
+ * @return UINT8 column of `2^precision` HyperLogLog registers
+ */
+std::unique_ptr<column> hyperloglog_sketch(
+  table_view const& input,
+  int32_t precision                 = 11,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Merges HyperLogLog sketches built with the same precision into one.
+ *
+ * Merging is the element-wise maximum of the registers and is exactly equivalent to having built
+ * a single sketch over the union of the inputs' rows.
+ *
+ * @throws cudf::data_type_error if any sketch is not a UINT8 column
+ * @throws cudf::logic_error if the sketches do not all have the same register count
+ *
+ * @param sketches Columns of HyperLogLog registers, as returned by `hyperloglog_sketch`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column
+ * @return UINT8 column holding the merged registers
+ */
+std::unique_ptr<column> merge_hyperloglog_sketches(
+  host_span<column_view const> sketches,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Estimates the number of distinct rows summarized by a HyperLogLog sketch.
+ *
+ * @throws cudf::data_type_error if `sketch` is not a UINT8 column
+ *
+ * @param sketch Column of HyperLogLog registers, as returned by `hyperloglog_sketch`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Estimated number of distinct rows
+ */
+double approx_distinct_count(column_view const& sketch,
+                             rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Estimates the number of distinct rows in a table.
+ *
+ * Equivalent to building a sketch with `hyperloglog_sketch` and estimating from it, without
+ * retaining the sketch. Unlike `cudf::distinct_count` this requires no hash set over the input
+ * rows, at the cost of an approximate result.
+ *
+ * @throws std::invalid_argument if `precision` is not in the range `[4, 18]`
+ *
+ * @param input Table whose distinct rows are counted
+ * @param precision Number of register-index bits controlling the accuracy/memory trade-off
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Estimated number of distinct rows
+ */
+double approx_distinct_count(table_view const& input,
+                             int32_t precision            = 11,
+                             rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /** @} */
 }  // namespace CUDF_EXPORT cudf
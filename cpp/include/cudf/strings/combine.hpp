@@ -204,6 +204,64 @@ std::unique_ptr<column> concatenate(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Row-wise concatenates a table of mixed-type columns and returns
+ * a single strings column result, formatting non-string values inline.
+ *
+ * This is equivalent to converting each non-string column with the
+ * corresponding `cudf::strings` conversion API and then calling `concatenate`,
+ * but the conversion runs inside the sizing and writing kernel itself so no
+ * intermediate string columns are materialized.
+ *
+ * Supported column types are strings, numeric types, and fixed-point types.
+ * Integers are formatted as with `from_integers`, floating-point values as
+ * with `from_floats`, fixed-point values as with `from_fixed_point`, and
+ * booleans as `true`/`false`. Chrono columns must be converted to strings
+ * first (e.g. with `from_timestamps`) since their formatting requires a
+ * compiled format program.
+ *
+ * Null handling matches `concatenate`: any row with a null entry results in
+ * the corresponding output row being null unless a valid @p narep is
+ * specified, and @p separate_nulls controls whether separators are added
+ * around null elements replaced by @p narep.
+ *
+ * More than one column must be specified in the input @p columns table.
+ *
+ * @code{.pseudo}
+ * Example:
+ * c0 = ['aa', 'bb', null]
+ * c1 = [10, null, 30]        // INT32
+ * c2 = [1.5, 2.5, 3.5]       // FLOAT64
+ * out = concatenate_typed({c0, c1, c2}, ':')
+ * out is ['aa:10:1.5', null, null]
+ *
+ * out = concatenate_typed({c0, c1, c2}, ':', '_')
+ * out is ['aa:10:1.5', 'bb:_:2.5', '_:30:3.5']
+ * @endcode
+ *
+ * @throw cudf::data_type_error if an input column is not a strings, numeric, or fixed-point column
+ * @throw cudf::logic_error if separator is not valid.
+ * @throw cudf::logic_error if only one column is specified
+ *
+ * @param columns List of columns to concatenate
+ * @param separator String that should be inserted between each value from each row.
+ *        Default is an empty string.
+ * @param narep String to replace any null entry found in any column.
+ *        Default of invalid-scalar means any null entry in any column will
+ *        produces a null result for that row.
+ * @param separate_nulls If YES, then the separator is included for null rows if `narep` is valid
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column with concatenated results
+ */
+std::unique_ptr<column> concatenate_typed(
+  table_view const& columns,
+  string_scalar const& separator    = string_scalar(""),
+  string_scalar const& narep        = string_scalar("", false),
+  separator_on_nulls separate_nulls = separator_on_nulls::YES,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Given a lists column of strings (each row is a list of strings), concatenates the strings
  * within each row and returns a single strings column result.
@@ -42,6 +42,19 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc concatenate_typed(table_view const&,string_scalar const&,string_scalar
+ * const&,separator_on_nulls,rmm::device_async_resource_ref)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> concatenate_typed(table_view const& columns,
+                                          string_scalar const& separator,
+                                          string_scalar const& narep,
+                                          separator_on_nulls separate_nulls,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc join_strings(table_view const&,string_scalar const&,string_scalar
  * const&,rmm::device_async_resource_ref)
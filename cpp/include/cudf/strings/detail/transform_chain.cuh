@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/offsets_iterator.cuh>
+#include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Composes string transforms at compile time so chained operations
+ * produce a single output column
+ * @file transform_chain.cuh
+ *
+ * Each strings API materializes a full output column, so a chain such as
+ * `upper(strip(slice(input)))` writes every byte three times. The utilities
+ * here fuse a chain into one `make_strings_children` pass instead.
+ *
+ * Two kinds of device transforms participate in a chain:
+ * - a view transform maps a `string_view` to a `string_view` without writing
+ *   any bytes (e.g. strip, slice); any number of these may be chained
+ * - a writer transform has signature `(string_view, char*) -> size_type`,
+ *   returning the output size in bytes and writing the bytes when the output
+ *   pointer is not null (e.g. case conversion); at most one of these
+ *   terminates a chain
+ *
+ * View transforms compose for free since they only adjust the pointer and
+ * length of the input; the writer is the single point where bytes are copied.
+ */
+
+/**
+ * @brief Terminal writer that copies the transformed view unchanged
+ *
+ * This is the default writer for chains consisting only of view transforms.
+ */
+struct copy_writer_fn {
+  __device__ size_type operator()(string_view d_str, char* d_output) const
+  {
+    if (d_output) { copy_string(d_output, d_str); }
+    return d_str.size_bytes();
+  }
+};
+
+/**
+ * @brief Applies two view transforms in sequence
+ *
+ * Use `chain_transforms` to build instances of this rather than
+ * nesting the template arguments by hand.
+ *
+ * @tparam Transform1 First view transform applied to the input
+ * @tparam Transform2 Second view transform applied to the result of the first
+ */
+template <typename Transform1, typename Transform2>
+struct chained_transform {
+  Transform1 t1;
+  Transform2 t2;
+
+  __device__ string_view operator()(string_view d_str) const { return t2(t1(d_str)); }
+};
+
+/**
+ * @brief Composes any number of view transforms into a single functor
+ *
+ * The transforms are applied left to right:
+ * `chain_transforms(a, b, c)` evaluates `c(b(a(d_str)))`.
+ *
+ * @param t1 First view transform to apply
+ * @param t2 Second view transform to apply
+ * @return Functor applying both transforms in order
+ */
+template <typename Transform1, typename Transform2>
+auto chain_transforms(Transform1 t1, Transform2 t2)
+{
+  return chained_transform<Transform1, Transform2>{t1, t2};
+}
+
+/**
+ * @copydoc chain_transforms(Transform1,Transform2)
+ *
+ * @param ts Remaining view transforms applied after the first two
+ */
+template <typename Transform1, typename Transform2, typename... Transforms>
+auto chain_transforms(Transform1 t1, Transform2 t2, Transforms... ts)
+{
+  return chain_transforms(chained_transform<Transform1, Transform2>{t1, t2}, ts...);
+}
+
+/**
+ * @brief Size-and-execute functor for `make_strings_children` that applies a
+ * transform chain to each row
+ *
+ * @tparam ViewTransform Composed view transform applied to each string
+ * @tparam Writer Terminal writer producing the output bytes
+ */
+template <typename ViewTransform, typename Writer>
+struct transform_chain_fn {
+  column_device_view const d_strings;
+  ViewTransform transform;
+  Writer writer;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) { d_sizes[idx] = 0; }
+      return;
+    }
+    auto const d_str = transform(d_strings.element<string_view>(idx));
+    if (!d_chars) {
+      d_sizes[idx] = writer(d_str, nullptr);
+    } else {
+      writer(d_str, d_chars + d_offsets[idx]);
+    }
+  }
+};
+
+/**
+ * @brief Builds a strings column by applying a transform chain to each row
+ *
+ * The chain runs inside a single size/write pass so no intermediate
+ * columns are materialized. Null rows produce null rows.
+ *
+ * @code{.cpp}
+ * auto transform = chain_transforms(strip_fn{d_whitespace}, truncate_fn{10});
+ * auto result    = transform_strings(input, transform, upper_writer_fn{}, stream, mr);
+ * @endcode
+ *
+ * @tparam ViewTransform Composed view transform applied to each string
+ * @tparam Writer Terminal writer producing the output bytes
+ *
+ * @param input Strings column to transform
+ * @param transform View transform (or composed chain) applied to each row
+ * @param writer Terminal writer; defaults to copying the transformed view
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column
+ */
+template <typename ViewTransform, typename Writer = copy_writer_fn>
+std::unique_ptr<column> transform_strings(strings_column_view const& input,
+                                          ViewTransform transform,
+                                          Writer writer,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  if (input.is_empty()) { return make_empty_column(type_id::STRING); }
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+
+  auto fn = transform_chain_fn<ViewTransform, Writer>{*d_strings, transform, writer};
+  auto [offsets_column, chars] = make_strings_children(fn, input.size(), stream, mr);
+
+  return make_strings_column(input.size(),
+                             std::move(offsets_column),
+                             chars.release(),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr));
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -80,6 +80,58 @@ int64_t get_offset64_threshold();
  */
 bool is_large_strings_enabled();
 
+/**
+ * @copydoc cudf::strings::is_valid_utf8
+ */
+bool is_valid_utf8(strings_column_view const& input, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Parallelization granularity for processing a strings column
+ *
+ * Kernels that assign one thread per string collapse when a column is
+ * skewed toward long strings, while warp- or block-sized assignment wastes
+ * parallelism on short strings.
+ */
+enum class string_parallelism {
+  THREAD_PER_STRING,  ///< short strings; one thread processes a whole string
+  WARP_PER_STRING,    ///< longer strings; a warp cooperates on each string
+  BLOCK_PER_STRING    ///< multi-KB strings; a thread block cooperates on each string
+};
+
+/**
+ * @brief Choose a parallelization granularity from the average string length
+ *
+ * Generalizes the average-char-bytes heuristic used by individual string
+ * APIs so all kernels with multiple granularities dispatch consistently.
+ * The average ignores null rows since they contribute no characters.
+ *
+ * @param chars_bytes Total bytes of the characters to be processed
+ * @param row_count Number of rows in the column
+ * @param null_count Number of null rows in the column
+ * @param warp_threshold Average bytes per string at or above which a warp per string is used
+ * @param block_threshold Average bytes per string at or above which a block per string is used
+ * @return The granularity kernels should use for this column
+ */
+string_parallelism compute_string_parallelism(int64_t chars_bytes,
+                                              size_type row_count,
+                                              size_type null_count,
+                                              size_type warp_threshold  = 64,
+                                              size_type block_threshold = 4096);
+
+/**
+ * @copydoc compute_string_parallelism(int64_t,size_type,size_type,size_type,size_type)
+ *
+ * @param input Strings column to be processed
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param warp_threshold Average bytes per string at or above which a warp per string is used
+ * @param block_threshold Average bytes per string at or above which a block per string is used
+ * @return The granularity kernels should use for this column
+ */
+string_parallelism compute_string_parallelism(cudf::strings_column_view const& input,
+                                              rmm::cuda_stream_view stream,
+                                              size_type warp_threshold  = 64,
+                                              size_type block_threshold = 4096);
+
 /**
  * @brief Return a normalized offset value from a strings offsets column
  *
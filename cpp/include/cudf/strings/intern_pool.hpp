@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <memory>
+
+namespace CUDF_EXPORT cudf {
+namespace strings {
+/**
+ * @addtogroup strings_classes
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Device-resident pool of unique strings shared across batches
+ *
+ * Interns the strings of successive batches into one growing key set so each distinct string
+ * is stored on the device exactly once, no matter how many batches repeat it. `intern` returns
+ * an INT32 column of stable key ids: a string keeps its id for the lifetime of the pool, so id
+ * columns from different batches can be compared for equality directly and all share the
+ * pool's single keys buffer instead of carrying their own copies.
+ *
+ * Ids are assigned in first-seen order, not lexicographic order, so they preserve string
+ * equality but not string ordering; use `decode` to materialize strings when order or output
+ * is needed.
+ *
+ * The pool is not thread-safe. All calls must use streams from the same device.
+ */
+class intern_pool {
+ public:
+  /**
+   * @brief Construct an empty pool
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the pool's keys storage
+   */
+  explicit intern_pool(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  ~intern_pool();
+  intern_pool(intern_pool&&) noexcept            = default;  ///< Move constructor
+  intern_pool& operator=(intern_pool&&) noexcept = default;  ///< Move assignment
+  intern_pool(intern_pool const&)                = delete;
+  intern_pool& operator=(intern_pool const&)     = delete;
+
+  /**
+   * @brief Interns a strings column, adding its novel strings to the pool
+   *
+   * @param input The strings to intern
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return INT32 column of key ids, one per input row, with the input's null mask
+   */
+  std::unique_ptr<column> intern(
+    strings_column_view const& input,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Materializes the strings for a column of key ids
+   *
+   * @param ids INT32 column of key ids previously returned by `intern`; null or out-of-range
+   * ids produce null rows
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return Strings column with one row per id
+   */
+  std::unique_ptr<column> decode(
+    column_view const& ids,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref()) const;
+
+  /**
+   * @brief Returns the pooled unique strings, where row `i` holds the string with key id `i`
+   *
+   * The view is invalidated by the next `intern` call that adds novel strings.
+   *
+   * @return View of the pool's keys
+   */
+  [[nodiscard]] column_view keys() const;
+
+  /// @returns The number of unique strings in the pool
+  [[nodiscard]] size_type num_keys() const;
+
+ private:
+  std::unique_ptr<column> _keys;        ///< Append-only unique strings; key id == row index
+  std::unique_ptr<column> _sorted_ids;  ///< Key ids in lexicographic key order, for lookup
+  rmm::device_async_resource_ref _mr;   ///< Resource for the pool's own storage
+};
+
+/** @} */  // end of group
+}  // namespace strings
+}  // namespace CUDF_EXPORT cudf
@@ -88,6 +88,51 @@ std::unique_ptr<table> rsplit(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Splits each string on the delimiter and converts the tokens
+ * directly into the requested output types.
+ *
+ * This is equivalent to calling `split()` followed by a conversion of each
+ * output column (e.g. `to_integers()` or `to_floats()`) but without
+ * materializing the intermediate strings columns.
+ *
+ * The number of output columns equals the number of entries in `output_types`
+ * and splitting stops once that many tokens have been produced for a row;
+ * any remainder of the string becomes part of the last token as with
+ * `maxsplit` in `split()`.
+ *
+ * Supported output types are integral types (except bool), floating-point
+ * types, and STRING which returns the token unconverted.
+ * Conversion follows the same rules as `to_integers()` and `to_floats()`.
+ *
+ * A null row or a row with fewer tokens than output columns produces
+ * null entries in the corresponding output columns.
+ *
+ * @code{.pseudo}
+ * s = ["12:3.5:x", "34:0.25:y", "56"]
+ * t = split_to_table(s, ":", [INT32, FLOAT64, STRING])
+ * t is a table of 3 columns:
+ *     [ [12, 34, 56], [3.5, 0.25, null], ["x", "y", null] ]
+ * @endcode
+ *
+ * @throw std::invalid_argument if `delimiter` is invalid or empty
+ * @throw std::invalid_argument if `output_types` is empty
+ * @throw cudf::data_type_error if an entry of `output_types` is not supported
+ *
+ * @param input Strings instance for this operation
+ * @param delimiter UTF-8 encoded string indicating the split points in each string
+ * @param output_types Types of the output columns; also determines the number of columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return New table of typed columns
+ */
+std::unique_ptr<table> split_to_table(
+  strings_column_view const& input,
+  string_scalar const& delimiter,
+  std::vector<data_type> const& output_types,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Splits individual strings elements into a list of strings.
  *
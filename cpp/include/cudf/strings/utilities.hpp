@@ -56,5 +56,23 @@ int64_t get_offset64_threshold();
  */
 bool is_large_strings_enabled();
 
+/**
+ * @brief Verifies all characters in the column are valid UTF-8
+ *
+ * Checks each string for well-formed UTF-8 sequences: correct lead and
+ * continuation bytes, no truncated characters, no overlong encodings,
+ * no surrogate code points, and nothing above U+10FFFF.
+ * Null rows are considered valid.
+ *
+ * This is intended for validating untrusted data at ingest since other
+ * strings APIs assume their input is valid UTF-8.
+ *
+ * @param input Strings column to verify
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return true if all characters are valid UTF-8
+ */
+bool is_valid_utf8(strings_column_view const& input,
+                   rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 }  // namespace strings
 }  // namespace CUDF_EXPORT cudf
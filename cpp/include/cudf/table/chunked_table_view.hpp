@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+/**
+ * @addtogroup table_classes
+ * @{
+ * @file
+ */
+
+/**
+ * @brief A logical table made of an ordered sequence of same-schema table chunks
+ *
+ * Views the chunks as one table of `num_rows()` rows without copying them into contiguous
+ * memory. Row `i` of the logical table lives in the chunk whose cumulative row offset range
+ * contains `i`. Reader output arriving in batches can be passed downstream in this form,
+ * deferring (or avoiding) the concatenation that a single `table_view` would require.
+ *
+ * Chunk-aware operations are provided for the cases where the concatenation can be skipped
+ * entirely: `cudf::gather` and `cudf::apply_boolean_mask` overloads below consume the chunks
+ * in place. Operations without a chunk-aware overload can materialize the logical table with
+ * `cudf::concatenate` on `chunks()`.
+ */
+class chunked_table_view {
+ public:
+  chunked_table_view() = default;
+
+  /**
+   * @brief Construct from an ordered sequence of table chunks
+   *
+   * The chunks must all have the same number of columns and matching column types.
+   *
+   * @throw cudf::data_type_error if chunk schemas do not match
+   * @throw std::overflow_error if the total number of rows exceeds the column size limit
+   *
+   * @param chunks The table chunks, in logical row order
+   */
+  explicit chunked_table_view(host_span<table_view const> chunks);
+
+  /// @returns The number of chunks
+  [[nodiscard]] size_type num_chunks() const { return static_cast<size_type>(_chunks.size()); }
+
+  /// @returns The number of columns in each chunk
+  [[nodiscard]] size_type num_columns() const
+  {
+    return _chunks.empty() ? 0 : _chunks.front().num_columns();
+  }
+
+  /// @returns The total number of rows across all chunks
+  [[nodiscard]] size_type num_rows() const
+  {
+    return _row_offsets.empty() ? 0 : _row_offsets.back();
+  }
+
+  /**
+   * @param chunk_index The index of the chunk to return
+   * @returns The view of the chunk at `chunk_index`
+   */
+  [[nodiscard]] table_view const& chunk(size_type chunk_index) const
+  {
+    return _chunks[chunk_index];
+  }
+
+  /// @returns The views of all chunks, in logical row order
+  [[nodiscard]] host_span<table_view const> chunks() const { return _chunks; }
+
+  /**
+   * @brief Returns the cumulative row end offset of each chunk
+   *
+   * Chunk `i` covers logical rows `[row_offsets()[i-1], row_offsets()[i])`, with the first
+   * chunk starting at row zero.
+   *
+   * @returns One cumulative end offset per chunk
+   */
+  [[nodiscard]] host_span<size_type const> row_offsets() const { return _row_offsets; }
+
+ private:
+  std::vector<table_view> _chunks;
+  std::vector<size_type> _row_offsets;
+};
+
+/**
+ * @brief Gathers rows from a chunked table without concatenating its chunks
+ *
+ * Equivalent to `cudf::gather` on the concatenated table: row `i` of the output is logical row
+ * `gather_map[i]` of `input`. Each map entry is routed to its source chunk with a binary search
+ * over the chunk row offsets, so only gathered rows are copied.
+ *
+ * @throw cudf::data_type_error if `gather_map` is not an index type
+ * @throw cudf::logic_error if `gather_map` contains nulls
+ *
+ * @param input The chunked table to gather from
+ * @param gather_map Non-nullable column of logical row indices to gather; out of bounds or
+ * negative indices are undefined behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Result of the gather
+ */
+std::unique_ptr<table> gather(
+  chunked_table_view const& input,
+  column_view const& gather_map,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Filters a chunked table by a chunked boolean mask without concatenating the input
+ *
+ * Equivalent to `cudf::apply_boolean_mask` on the concatenated table and mask: keeps the rows
+ * whose mask element is true and non-null. Each chunk is filtered against its mask chunk and
+ * only the surviving rows are concatenated, so the copy cost scales with the output size
+ * rather than the input size.
+ *
+ * @throw cudf::logic_error if the mask is not BOOL8 or its chunk row counts do not match
+ * `input`'s
+ *
+ * @param input The chunked table to filter
+ * @param boolean_mask Single-column chunked view of BOOL8 mask chunks whose row counts match
+ * `input`'s chunks
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copies of the rows with true mask values
+ */
+std::unique_ptr<table> apply_boolean_mask(
+  chunked_table_view const& input,
+  chunked_table_view const& boolean_mask,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/** @} */  // end of group
+}  // namespace CUDF_EXPORT cudf
@@ -18,12 +18,14 @@
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace CUDF_EXPORT cudf {
 class table;
@@ -57,4 +59,43 @@ std::unique_ptr<table> make_timezone_transition_table(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Returns a transition table for the given timezone, caching the parsed TZif data.
+ *
+ * The first call for a timezone parses its TZif file and stores the parsed transition data in a
+ * process-wide host-side cache; subsequent calls for the same timezone skip the file system
+ * entirely. The device table is built per call on `stream`, so it resides on the caller's current
+ * device and is allocated from the current device resource. The cache is keyed by the (TZif
+ * directory, timezone name) pair and is safe to use from multiple threads.
+ *
+ * @param tzif_dir The directory where the TZif files are located
+ * @param timezone_name standard timezone name (for example, "America/Los_Angeles")
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Shared view of the cached transition table for the given timezone
+ */
+std::shared_ptr<table const> get_cached_timezone_transition_table(
+  std::optional<std::string_view> tzif_dir,
+  std::string_view timezone_name,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Returns transition tables for multiple timezones from the process-wide cache.
+ *
+ * Equivalent to calling `get_cached_timezone_transition_table` once per name, but cache lookups
+ * and the publication of newly parsed zones are batched, so loading many zones at once (e.g. when
+ * a zone varies per row of a table) does not take the cache lock per zone. The result holds one
+ * entry per input name, in order; duplicate names share one table.
+ *
+ * @param tzif_dir The directory where the TZif files are located
+ * @param timezone_names standard timezone names (for example, "America/Los_Angeles")
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Shared views of the cached transition tables, one per input name
+ */
+std::vector<std::shared_ptr<table const>> get_cached_timezone_transition_tables(
+  std::optional<std::string_view> tzif_dir,
+  host_span<std::string const> timezone_names,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 }  // namespace CUDF_EXPORT cudf
@@ -22,6 +22,7 @@
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <memory>
+#include <optional>
 
 namespace CUDF_EXPORT cudf {
 /**
@@ -95,6 +96,30 @@ std::unique_ptr<column> compute_column(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Compute multiple columns by evaluating several expression trees on a table
+ *
+ * This produces the same columns as calling `compute_column` once per expression
+ * but evaluates all expressions for a row in a single fused kernel pass. Input
+ * column values re-used across expressions are read from cache rather than
+ * re-fetched from device memory, which matters when many derived columns are
+ * computed over the same small set of input columns.
+ *
+ * @throws std::invalid_argument if `expressions` is empty
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation
+ * @param expressions The roots of the expression trees, one per output column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource
+ * @return Output columns in the same order as `expressions`
+ */
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& expressions,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Creates a bitmask from a column of boolean elements.
  *
@@ -265,5 +290,21 @@ std::unique_ptr<column> segmented_row_bit_count(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Returns the per-row size in bits of a `table_view` when it is the same for every row.
+ *
+ * A schema of only fixed-width columns, possibly nested inside structs, has a per-row size
+ * that is a constant computable from the schema alone: the sum of each column's element
+ * storage size plus one bit per nullable column. In that case this function folds
+ * `cudf::row_bit_count` to that constant entirely on the host, with no kernel launch or
+ * device allocation — useful for callers such as spill or split planners that query row
+ * sizes frequently. Tables containing strings, lists, or dictionaries have data-dependent
+ * row sizes and return `std::nullopt`; use `cudf::row_bit_count` for those.
+ *
+ * @param t The table view to analyze
+ * @return The constant per-row size in bits, or `std::nullopt` if the size is not constant
+ */
+std::optional<size_type> constant_row_bit_count(table_view const& t);
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT cudf
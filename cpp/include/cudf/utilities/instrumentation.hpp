@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/export.hpp>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+
+/**
+ * @brief Aggregated timing information for one instrumented libcudf entry point.
+ */
+struct instrumentation_record {
+  std::string name;                      ///< Name of the instrumented function
+  std::size_t num_calls;                 ///< Number of calls recorded
+  std::chrono::nanoseconds total_time;   ///< Total wall time spent across all calls
+};
+
+/**
+ * @brief Enable or disable per-call instrumentation of libcudf entry points.
+ *
+ * When enabled, every public API call that opens an NVTX range also records its
+ * wall time into a process-wide registry, keyed by function name and retrievable
+ * with `get_instrumentation_records()`. The recorded time is the host-side
+ * duration of the call; work enqueued asynchronously on a stream is not waited
+ * on, so device completion time is not included.
+ *
+ * Instrumentation is disabled by default. When disabled, the per-call overhead
+ * is a single atomic load.
+ *
+ * @param enabled True to start recording, false to stop
+ */
+void set_instrumentation(bool enabled);
+
+/**
+ * @brief Query whether per-call instrumentation is enabled.
+ *
+ * @return True if instrumentation is currently enabled
+ */
+bool get_instrumentation();
+
+/**
+ * @brief Retrieve the accumulated instrumentation records.
+ *
+ * Each record aggregates all calls to one function name since the records were
+ * last reset. The order of the records is unspecified.
+ *
+ * @return One record per instrumented function name
+ */
+std::vector<instrumentation_record> get_instrumentation_records();
+
+/**
+ * @brief Discard all accumulated instrumentation records.
+ */
+void reset_instrumentation_records();
+
+/**
+ * @brief Returns the libcudf public API calls currently active on this thread.
+ *
+ * The stack is ordered outermost first and is maintained regardless of whether timing
+ * instrumentation is enabled, so memory-tracking tools can attribute allocations to the
+ * call that made them.
+ *
+ * @return Names of the nested libcudf calls active on the calling thread
+ */
+std::vector<std::string> get_current_call_stack();
+
+namespace detail {
+
+/**
+ * @brief Fast check used by the instrumentation macro; avoids touching the
+ * registry when instrumentation is disabled.
+ *
+ * @return True if instrumentation is currently enabled
+ */
+bool is_instrumentation_enabled() noexcept;
+
+/**
+ * @brief Returns the thread-local stack of active libcudf call names.
+ *
+ * The entries point at `__func__` literals and remain valid for the process lifetime.
+ *
+ * @return The active call names, outermost first
+ */
+std::vector<char const*> const& current_call_stack() noexcept;
+
+/**
+ * @brief Pushes a call name onto the thread-local call stack.
+ *
+ * @param name Name of the entered function; must have static storage duration
+ */
+void push_call(char const* name);
+
+/**
+ * @brief Pops the innermost call name off the thread-local call stack.
+ */
+void pop_call() noexcept;
+
+/**
+ * @brief Add one call's elapsed time to the registry entry for `name`.
+ *
+ * @param name Name of the instrumented function; must outlive the process
+ * @param elapsed Wall time of the call
+ */
+void record_instrumented_call(char const* name, std::chrono::nanoseconds elapsed);
+
+/**
+ * @brief RAII timer that records the wall time of the enclosing scope when
+ * instrumentation is enabled; see `CUDF_FUNC_RANGE`.
+ */
+class scoped_call_timer {
+ public:
+  /**
+   * @brief Starts the timer if instrumentation is enabled.
+   *
+   * @param name Name of the enclosing function, typically `__func__`
+   */
+  explicit scoped_call_timer(char const* name)
+    : name_{is_instrumentation_enabled() ? name : nullptr}
+  {
+    push_call(name);
+    if (name_ != nullptr) { start_ = std::chrono::steady_clock::now(); }
+  }
+
+  ~scoped_call_timer()
+  {
+    if (name_ != nullptr) {
+      record_instrumented_call(
+        name_,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                             start_));
+    }
+    pop_call();
+  }
+
+  scoped_call_timer(scoped_call_timer const&)            = delete;
+  scoped_call_timer& operator=(scoped_call_timer const&) = delete;
+  scoped_call_timer(scoped_call_timer&&)                 = delete;
+  scoped_call_timer& operator=(scoped_call_timer&&)      = delete;
+
+ private:
+  char const* name_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace detail
+
+}  // namespace CUDF_EXPORT cudf
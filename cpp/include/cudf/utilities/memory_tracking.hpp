@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/export.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+
+/**
+ * @brief Aggregated device memory usage attributed to one libcudf call stack.
+ *
+ * The call stack is the nesting of public libcudf entry points that was active on the
+ * allocating thread, outermost first, joined with `" > "`; allocations made outside any
+ * libcudf call are attributed to `"(unattributed)"`.
+ */
+struct call_memory_record {
+  std::string call_stack;        ///< Nested libcudf calls active at allocation time
+  std::size_t num_allocations;   ///< Number of allocations made under this call stack
+  std::size_t bytes_allocated;   ///< Total bytes requested under this call stack
+  std::size_t peak_bytes;        ///< Peak outstanding bytes attributed to this call stack
+};
+
+/**
+ * @brief Resource adaptor that attributes device allocations to the libcudf call that made them.
+ *
+ * Wraps an upstream memory resource and records, per active libcudf call stack, the number of
+ * allocations, total bytes requested, and peak outstanding bytes. Install it as the current
+ * device resource (or pass it as the `mr` argument of libcudf calls) to find which operations
+ * drive peak memory usage. When an allocation fails with `rmm::out_of_memory`, the accumulated
+ * records are written to the libcudf log, largest peak first, before the exception propagates.
+ *
+ * The adaptor is intended for triage rather than production use: every allocation and
+ * deallocation takes a mutex and builds the attribution key.
+ */
+class call_tracking_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Construct a new adaptor.
+   *
+   * @param upstream The resource used for allocating/deallocating device memory
+   */
+  explicit call_tracking_resource_adaptor(rmm::device_async_resource_ref upstream);
+
+  call_tracking_resource_adaptor()                                                 = delete;
+  ~call_tracking_resource_adaptor() override                                       = default;
+  call_tracking_resource_adaptor(call_tracking_resource_adaptor const&)            = delete;
+  call_tracking_resource_adaptor& operator=(call_tracking_resource_adaptor const&) = delete;
+  call_tracking_resource_adaptor(call_tracking_resource_adaptor&&)                 = delete;
+  call_tracking_resource_adaptor& operator=(call_tracking_resource_adaptor&&)      = delete;
+
+  /**
+   * @brief Returns the wrapped upstream resource
+   *
+   * @return The wrapped upstream resource
+   */
+  [[nodiscard]] rmm::device_async_resource_ref get_upstream_resource() const noexcept
+  {
+    return _upstream;
+  }
+
+  /**
+   * @brief Retrieve the accumulated per-call-stack memory records.
+   *
+   * @return One record per distinct call stack observed, in unspecified order
+   */
+  [[nodiscard]] std::vector<call_memory_record> get_records() const;
+
+  /**
+   * @brief Discard all accumulated records.
+   *
+   * Outstanding allocations remain tracked so that later deallocations are accounted
+   * correctly.
+   */
+  void reset_records();
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] bool do_is_equal(device_memory_resource const& other) const noexcept override;
+
+  struct stack_totals {
+    std::size_t num_allocations{0};
+    std::size_t bytes_allocated{0};
+    std::size_t current_bytes{0};
+    std::size_t peak_bytes{0};
+  };
+
+  // Writes the accumulated records to the libcudf log; called on allocation failure
+  void log_records() const;
+
+  rmm::device_async_resource_ref _upstream;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, stack_totals> _records;
+  // Maps live allocations to their size and attribution key so deallocations are
+  // charged back to the call stack that made the allocation
+  std::unordered_map<void*, std::pair<std::size_t, std::string>> _outstanding;
+};
+
+}  // namespace CUDF_EXPORT cudf
@@ -56,6 +56,35 @@ struct pinned_mr_options {
  */
 bool config_default_pinned_memory_resource(pinned_mr_options const& opts);
 
+/**
+ * @brief Usage statistics for the default pinned memory pool
+ */
+struct pinned_pool_statistics {
+  size_t hits;             ///< Number of allocations served from the pool
+  size_t fallbacks;        ///< Number of allocations that fell back to non-pooled pinned memory
+                           ///< because they exceeded the pool size or the pool was exhausted
+  size_t current_usage;    ///< Bytes currently allocated from the pool
+  size_t high_water_mark;  ///< Maximum bytes simultaneously allocated from the pool
+};
+
+/**
+ * @brief Get usage statistics for the default pinned memory pool.
+ *
+ * The counters only reflect allocations routed through the default pinned pool; allocations made
+ * through a resource installed with `set_pinned_memory_resource` are not counted.
+ *
+ * @return The current pinned pool statistics
+ */
+pinned_pool_statistics get_pinned_pool_statistics();
+
+/**
+ * @brief Reset the hit/fallback counters of the default pinned memory pool.
+ *
+ * The high-water mark is reset to the current pool usage since outstanding allocations remain
+ * live.
+ */
+void reset_pinned_pool_statistics();
+
 /**
  * @brief Set the threshold size for using kernels for pinned memory copies.
  *
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/export.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <memory>
+#include <utility>
+
+namespace CUDF_EXPORT cudf {
+
+namespace detail {
+
+/**
+ * @brief Owning wrapper over a `cudaEvent_t` used by `stream_future`
+ */
+class future_event {
+ public:
+  future_event() { CUDF_CUDA_TRY(cudaEventCreateWithFlags(&_event, cudaEventDisableTiming)); }
+  ~future_event() { cudaEventDestroy(_event); }
+
+  future_event(future_event const&)            = delete;
+  future_event& operator=(future_event const&) = delete;
+
+  operator cudaEvent_t() const { return _event; }  ///< The wrapped event
+
+ private:
+  cudaEvent_t _event{};
+};
+
+}  // namespace detail
+
+/**
+ * @brief A stream-ordered result: a value together with an event recorded after the device work
+ * that produces it.
+ *
+ * Returned by the `*_async` API variants. The wrapped value exists as soon as the future is
+ * returned, but its device memory is only valid once the recorded event has completed. Consumers
+ * either wait on the host with `get()`, or stay stream-ordered with `get(stream)`, which makes
+ * `stream` wait for the producing work without blocking the host — this is what allows
+ * independent operator subtrees to overlap on different streams.
+ *
+ * @tparam T Result type, e.g. `std::unique_ptr<table>`
+ */
+template <typename T>
+class stream_future {
+ public:
+  /**
+   * @brief Wraps `value` and records the completion event on `stream`.
+   *
+   * All device work producing `value` must already be submitted to `stream`.
+   *
+   * @param value The result to wrap
+   * @param stream The stream the producing work was submitted to
+   */
+  stream_future(T&& value, rmm::cuda_stream_view stream)
+    : _value{std::move(value)}, _event{std::make_shared<detail::future_event>()}
+  {
+    CUDF_CUDA_TRY(cudaEventRecord(*_event, stream.value()));
+  }
+
+  stream_future(stream_future&&)            = default;  ///< Movable
+  stream_future& operator=(stream_future&&) = default;  ///< Movable
+  stream_future(stream_future const&)       = delete;
+  stream_future& operator=(stream_future const&) = delete;
+
+  /**
+   * @brief Waits on the host for the result to be ready and returns it.
+   *
+   * @return The wrapped value
+   */
+  [[nodiscard]] T get() &&
+  {
+    CUDF_CUDA_TRY(cudaEventSynchronize(*_event));
+    return std::move(_value);
+  }
+
+  /**
+   * @brief Makes `stream` wait for the result and returns it without blocking the host.
+   *
+   * Work subsequently submitted to `stream` may safely consume the result's device memory.
+   *
+   * @param stream The stream that will consume the result
+   * @return The wrapped value
+   */
+  [[nodiscard]] T get(rmm::cuda_stream_view stream) &&
+  {
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(stream.value(), *_event, 0));
+    return std::move(_value);
+  }
+
+  /**
+   * @brief Returns true if the producing device work has completed.
+   *
+   * @return Whether the result is ready to consume
+   */
+  [[nodiscard]] bool is_ready() const
+  {
+    auto const status = cudaEventQuery(*_event);
+    if (status == cudaErrorNotReady) {
+      cudaGetLastError();  // clear the error
+      return false;
+    }
+    CUDF_CUDA_TRY(status);
+    return true;
+  }
+
+ private:
+  T _value;
+  std::shared_ptr<detail::future_event> _event;
+};
+
+}  // namespace CUDF_EXPORT cudf
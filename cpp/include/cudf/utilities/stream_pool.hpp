@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+
+/**
+ * @brief Acquire a set of stream views from the global pool, synchronized to an event on
+ * another stream.
+ *
+ * The returned streams wait on an event recorded on `stream` before running any work submitted
+ * to them; once the forked work has been submitted, `join_streams` makes `stream` wait for it in
+ * turn. This is the same fork-join pattern libcudf uses internally to overlap independent work:
+ *
+ * @code{.cpp}
+ * auto stream = cudf::get_default_stream();
+ * // do work on stream
+ * // allocate streams and wait for an event on stream before executing on any of streams
+ * auto streams = cudf::fork_streams(stream, 2);
+ * // do independent work on streams[0] and streams[1]
+ * // wait for an event on streams before continuing to do work on stream
+ * cudf::join_streams(streams, stream);
+ * @endcode
+ *
+ * Each host thread is handed a consistent set of streams across calls, so concurrently running
+ * threads do not contend for the same streams as long as the pool is large enough.
+ *
+ * If the environment variable `LIBCUDF_USE_DEBUG_STREAM_POOL` is set, all returned streams are
+ * the stream returned by `cudf::get_default_stream()`.
+ *
+ * @param stream Stream that the returned streams will wait on
+ * @param count The number of stream views to return
+ * @return Vector containing `count` stream views
+ */
+[[nodiscard]] std::vector<rmm::cuda_stream_view> fork_streams(rmm::cuda_stream_view stream,
+                                                              std::size_t count);
+
+/**
+ * @brief Synchronize a stream to events recorded on a set of forked streams.
+ *
+ * @param streams Streams to wait on
+ * @param stream Joined stream that synchronizes with the waited-on streams
+ */
+void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Set the number of streams in the global stream pool.
+ *
+ * Only affects pools that have not been created yet; the pool for a device is created on first
+ * use and its size is fixed from then on. The size may also be set with the
+ * `LIBCUDF_STREAM_POOL_SIZE` environment variable, which this function overrides.
+ *
+ * @param size The number of streams in the pool; must be nonzero
+ * @return True if no pool had been created when the size was set, false if a pool was already
+ * created with the previous size
+ */
+bool set_stream_pool_size(std::size_t size);
+
+/**
+ * @brief Get the number of streams in the global stream pool for the current device.
+ *
+ * @return The number of streams in the pool
+ */
+std::size_t get_stream_pool_size();
+
+}  // namespace CUDF_EXPORT cudf
@@ -153,5 +153,44 @@ std::unique_ptr<cudf::column> minhash64(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Returns the LSH band hashes computed from the minhash values
+ * of each string
+ *
+ * This is equivalent to computing `num_bands * band_size` minhash values
+ * per string and then hashing each consecutive band of `band_size` values
+ * into a single value, but the minhash signature is kept in working memory
+ * and never materialized as an output column.
+ *
+ * The a/b permutation parameters are generated deterministically from the
+ * seed using a counter-based mix function so no parameter arrays are
+ * required. Strings with the same contents always produce the same band
+ * hashes for a given seed.
+ *
+ * Any null row entries result in corresponding null rows in the output column.
+ *
+ * @throw std::invalid_argument if `num_bands` or `band_size` is zero
+ * @throw std::invalid_argument if the width < 2
+ * @throw std::overflow_error if `num_bands * band_size * input.size()`
+ *        exceeds the column size limit
+ *
+ * @param input Strings column to compute minhash
+ * @param seed Seed used for the hash function and the permutation parameters
+ * @param num_bands Number of band hashes produced for each row
+ * @param band_size Number of minhash values combined into each band hash
+ * @param width The character width of substrings to hash for each row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of band hash values for each string
+ */
+std::unique_ptr<cudf::column> minhash_lsh(
+  cudf::strings_column_view const& input,
+  uint32_t seed,
+  cudf::size_type num_bands,
+  cudf::size_type band_size,
+  cudf::size_type width,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT nvtext
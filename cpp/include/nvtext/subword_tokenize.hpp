@@ -163,5 +163,124 @@ tokenizer_result subword_tokenize(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Persistent tokenizer object for use with nvtext::subword_tokenize
+ *
+ * Use nvtext::create_subword_tokenizer to create this object.
+ *
+ * This holds the configured tokenizer state on the device so successive
+ * calls over small batches skip the per-call setup and parameter checks.
+ * The vocabulary object must outlive this object.
+ */
+struct subword_tokenizer {
+  /**
+   * @brief Tokenizer object constructor
+   *
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   *
+   * @param vocabulary The vocabulary table pre-loaded into this object
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string
+   * @param stride Each row in the output token-ids will replicate
+   *        `max_sequence_length - stride` the token-ids from the previous row,
+   *        unless it is the first string
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string
+   */
+  subword_tokenizer(hashed_vocabulary const& vocabulary,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_lower_case,
+                    bool do_truncate);
+  ~subword_tokenizer();
+
+  struct subword_tokenizer_impl;
+  subword_tokenizer_impl* _impl{};  ///< Implementation detail
+};
+
+/**
+ * @brief Create a subword_tokenizer object from a loaded vocabulary
+ *
+ * The returned object holds the configured tokenizer state so batches can be
+ * queued on a stream with nvtext::subword_tokenize without repeating the
+ * per-call setup. The vocabulary object must outlive the returned object.
+ *
+ * @throw cudf::logic_error if `stride > max_sequence_length`
+ *
+ * @param vocabulary The vocabulary table pre-loaded into this object
+ * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+ *        for each string
+ * @param stride Each row in the output token-ids will replicate
+ *        `max_sequence_length - stride` the token-ids from the previous row,
+ *        unless it is the first string
+ * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+ *        input stream to lower-case and strip accents from those characters
+ * @param do_truncate If true, the tokenizer will discard all the token-ids after
+ *        `max_sequence_length` for each input string
+ * @return Object to be used with nvtext::subword_tokenize
+ */
+std::unique_ptr<subword_tokenizer> create_subword_tokenizer(hashed_vocabulary const& vocabulary,
+                                                            uint32_t max_sequence_length,
+                                                            uint32_t stride,
+                                                            bool do_lower_case,
+                                                            bool do_truncate);
+
+/**
+ * @brief Tokenizes a batch of strings with a persistent tokenizer object
+ *
+ * This produces the same result as calling nvtext::subword_tokenize with the
+ * parameters given to nvtext::create_subword_tokenizer but reuses the
+ * tokenizer state across calls. Successive batches may be queued on the same
+ * stream without synchronizing in between.
+ *
+ * @throw std::overflow_error if `max_sequence_length * strings.size()`
+ *        exceeds the column size limit
+ *
+ * @param strings The input strings to tokenize
+ * @param tokenizer Tokenizer state created by nvtext::create_subword_tokenizer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Memory resource to allocate any returned objects
+ * @return token-ids, attention-mask, and metadata
+ */
+tokenizer_result subword_tokenize(
+  cudf::strings_column_view const& strings,
+  subword_tokenizer const& tokenizer,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+/**
+ * @brief Tokenizes pairs of strings into single packed sequences
+ *
+ * Row `i` of the output tensor holds the token-ids of `first[i]` followed by
+ * the vocabulary's separator token and then the token-ids of `second[i]`:
+ * ```
+ * tokens(first[i]) [SEP] tokens(second[i])
+ * ```
+ * Sequences longer than `max_sequence_length` are truncated from the end so
+ * the tokenizer must be created with `do_truncate=true`. The sequences are
+ * packed in the tensor-assembly kernel so no intermediate concatenated
+ * column is created. A null row contributes no token-ids to its sequence.
+ *
+ * @throw cudf::logic_error if `first` and `second` have different sizes
+ * @throw cudf::logic_error if `tokenizer` was not created with `do_truncate=true`
+ * @throw std::overflow_error if `max_sequence_length * first.size()`
+ *        exceeds the column size limit
+ *
+ * @param first Strings for the first sequence of each pair
+ * @param second Strings for the second sequence of each pair
+ * @param tokenizer Tokenizer state created by nvtext::create_subword_tokenizer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Memory resource to allocate any returned objects
+ * @return token-ids, attention-mask, and metadata
+ */
+tokenizer_result subword_tokenize_pairs(
+  cudf::strings_column_view const& first,
+  cudf::strings_column_view const& second,
+  subword_tokenizer const& tokenizer,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of group
 }  // namespace CUDF_EXPORT nvtext
@@ -20,6 +20,9 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <vector>
 
 namespace CUDF_EXPORT nvtext {
 /**
@@ -251,6 +254,28 @@ struct tokenize_vocabulary {
   tokenize_vocabulary(cudf::strings_column_view const& input,
                       rmm::cuda_stream_view stream      = cudf::get_default_stream(),
                       rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
+  /**
+   * @brief Vocabulary object constructor with optional perfect-hash lookup table
+   *
+   * When `perfect_hash` is true, a collision-free hash table is built for the
+   * vocabulary so each token lookup resolves in a single probe. Building the
+   * table is more expensive than the default hash map build so this is best
+   * for static vocabularies reused over many nvtext::tokenize_with_vocabulary
+   * calls. If a collision-free table cannot be found, the default hash map
+   * is built instead and lookup results are unaffected.
+   *
+   * @throw cudf::logic_error if `vocabulary` contains nulls or is empty
+   *
+   * @param input Strings for the vocabulary
+   * @param perfect_hash True to build a perfect-hash lookup table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   */
+  tokenize_vocabulary(cudf::strings_column_view const& input,
+                      bool perfect_hash,
+                      rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                      rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
   ~tokenize_vocabulary();
 
   struct tokenize_vocabulary_impl;
@@ -275,6 +300,29 @@ std::unique_ptr<tokenize_vocabulary> load_vocabulary(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Create a tokenize_vocabulary object with a perfect-hash lookup table
+ *
+ * Token ids are the row indices within the vocabulary column.
+ * Each vocabulary entry is expected to be unique otherwise the behavior is undefined.
+ *
+ * A collision-free hash table is built for the vocabulary so each token lookup
+ * resolves in a single probe. Building the table is more expensive than
+ * nvtext::load_vocabulary so this is best for static vocabularies reused over
+ * many nvtext::tokenize_with_vocabulary calls.
+ *
+ * @throw cudf::logic_error if `vocabulary` contains nulls or is empty
+ *
+ * @param input Strings for the vocabulary
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Object to be used with nvtext::tokenize_with_vocabulary
+ */
+std::unique_ptr<tokenize_vocabulary> load_static_vocabulary(
+  cudf::strings_column_view const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /**
  * @brief Returns the token ids for the input string by looking up each delimited
  * token in the given vocabulary
@@ -308,5 +356,34 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Returns the token ids for a batch of input strings columns by looking
+ * up each delimited token in the given vocabulary
+ *
+ * This is equivalent to calling nvtext::tokenize_with_vocabulary on each input
+ * column but resolves the vocabulary and delimiter only once for the entire
+ * batch. Use this when tokenizing many columns with the same vocabulary.
+ *
+ * Any null row entry results in a corresponding null entry in the output
+ *
+ * @throw cudf::logic_error if `delimiter` is invalid
+ *
+ * @param inputs Strings columns to tokenize
+ * @param vocabulary Used to lookup tokens within each column of `inputs`
+ * @param delimiter Used to identify tokens within each column of `inputs`
+ * @param default_id The token id to be used for tokens not found in the `vocabulary`;
+ *                   Default is -1
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Lists column of token ids for each input column
+ */
+std::vector<std::unique_ptr<cudf::column>> tokenize_with_vocabulary(
+  cudf::host_span<cudf::strings_column_view const> inputs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type default_id        = -1,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
+
 /** @} */  // end of tokenize group
 }  // namespace CUDF_EXPORT nvtext
@@ -23,9 +23,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -148,6 +150,19 @@ class kafka_consumer : public cudf::io::datasource {
                                                       int timeout,
                                                       bool cached);
 
+  /**
+   * @brief Retrieve the byte offsets of the message boundaries in the consumed batch
+   *
+   * Entry `i` is the offset of the first byte of message `i` within the batch buffer; a final
+   * entry equal to `size()` marks the end of the last message. Readers that split the batch into
+   * byte ranges can align the ranges to these offsets instead of re-scanning the buffer for
+   * delimiters.
+   *
+   * @return Record boundary offsets, including the terminating `size()` entry. Empty if no
+   *         batch has been consumed.
+   */
+  std::vector<std::size_t> const& get_record_offsets() const;
+
   /**
    * @brief Retrieve the current Kafka client configurations
    *
@@ -210,7 +225,20 @@ class kafka_consumer : public cudf::io::datasource {
   int default_timeout = 10000;  // milliseconds
   std::string delimiter;
 
-  std::string buffer;
+  /**
+   * @brief Deleter that returns a batch buffer to the pinned host memory resource
+   */
+  struct pinned_deleter {
+    std::size_t size;  ///< Allocation size, required by the resource to deallocate
+    void operator()(char* ptr) const;
+  };
+
+  // Message payloads are assembled once into a single pinned allocation; pinned memory keeps the
+  // subsequent host-to-device copy of the batch on the DMA fast path and lets it overlap with the
+  // GPU parse of a previously consumed batch.
+  std::unique_ptr<char, pinned_deleter> buffer;
+  std::size_t buffer_size{0};
+  std::vector<std::size_t> record_offsets;
 
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
@@ -15,10 +15,16 @@
  */
 #include <cudf_kafka/kafka_consumer.hpp>
 
+#include <cudf/utilities/pinned_memory.hpp>
+
+#include <rmm/aligned.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
 #include <chrono>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -107,22 +113,32 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
   consume_to_buffer();
 }
 
+void kafka_consumer::pinned_deleter::operator()(char* ptr) const
+{
+  cudf::get_pinned_memory_resource().deallocate(ptr, size, rmm::RMM_DEFAULT_HOST_ALIGNMENT);
+}
+
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
-  size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
+  if (offset > buffer_size) { return 0; }
+  size = std::min(size, buffer_size - offset);
+  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.get() + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
-  if (offset > buffer.size()) { return 0; }
-  auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  if (offset > buffer_size) { return 0; }
+  auto const read_size = std::min(size, buffer_size - offset);
+  memcpy(dst, buffer.get() + offset, read_size);
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+size_t kafka_consumer::size() const { return buffer_size; }
+
+std::vector<std::size_t> const& kafka_consumer::get_record_offsets() const
+{
+  return record_offsets;
+}
 
 /**
  * Change the TOPPAR assignment for this consumer instance
@@ -142,19 +158,48 @@ void kafka_consumer::consume_to_buffer()
   int64_t messages_read = 0;
   auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
 
+  // Poll the batch without copying anything yet; rdkafka owns each payload for the lifetime of
+  // the message object, so retaining the messages lets us size the batch buffer exactly.
+  std::vector<std::unique_ptr<RdKafka::Message>> messages;
+  std::size_t total_size = 0;
+
   while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
     std::unique_ptr<RdKafka::Message> msg{
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
-      buffer.append(delimiter);
+      total_size += msg->len() + delimiter.size();
+      messages.push_back(std::move(msg));
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
       // If there are no more messages return
       break;
     }
   }
+
+  // Assemble the payloads into a single pinned allocation with exactly one copy per message,
+  // recording the boundary of each message as it lands.
+  record_offsets.clear();
+  record_offsets.reserve(messages.size() + 1);
+  buffer_size = total_size;
+  if (total_size != 0) {
+    buffer = std::unique_ptr<char, pinned_deleter>{
+      static_cast<char*>(cudf::get_pinned_memory_resource().allocate(
+        total_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT)),
+      pinned_deleter{total_size}};
+  } else {
+    buffer.reset();
+  }
+
+  std::size_t write_pos = 0;
+  for (auto const& msg : messages) {
+    record_offsets.push_back(write_pos);
+    std::memcpy(buffer.get() + write_pos, msg->payload(), msg->len());
+    write_pos += msg->len();
+    delimiter.copy(buffer.get() + write_pos, delimiter.size());
+    write_pos += delimiter.size();
+  }
+  record_offsets.push_back(write_pos);
 }
 
 std::map<std::string, std::string> kafka_consumer::current_configs()
@@ -215,6 +215,24 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, max_by_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, min_by_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, top_k_by_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   data_type col_type, covariance_aggregation const& agg)
 {
@@ -396,6 +414,21 @@ void aggregation_finalizer::visit(merge_histogram_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(max_by_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(min_by_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(top_k_by_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 void aggregation_finalizer::visit(covariance_aggregation const& agg)
 {
   visit(static_cast<aggregation const&>(agg));
@@ -833,6 +866,8 @@ template CUDF_EXPORT std::unique_ptr<aggregation> make_udf_aggregation<aggregati
   udf_type type, std::string const& user_defined_aggregator, data_type output_type);
 template CUDF_EXPORT std::unique_ptr<rolling_aggregation> make_udf_aggregation<rolling_aggregation>(
   udf_type type, std::string const& user_defined_aggregator, data_type output_type);
+template CUDF_EXPORT std::unique_ptr<groupby_aggregation> make_udf_aggregation<groupby_aggregation>(
+  udf_type type, std::string const& user_defined_aggregator, data_type output_type);
 
 /// Factory to create a MERGE_LISTS aggregation
 template <typename Base>
@@ -882,6 +917,37 @@ make_merge_histogram_aggregation<groupby_aggregation>();
 template CUDF_EXPORT std::unique_ptr<reduce_aggregation>
 make_merge_histogram_aggregation<reduce_aggregation>();
 
+/// Factory to create a MAX_BY aggregation
+template <typename Base>
+std::unique_ptr<Base> make_max_by_aggregation()
+{
+  return std::make_unique<detail::max_by_aggregation>();
+}
+template CUDF_EXPORT std::unique_ptr<aggregation> make_max_by_aggregation<aggregation>();
+template CUDF_EXPORT std::unique_ptr<groupby_aggregation>
+make_max_by_aggregation<groupby_aggregation>();
+
+/// Factory to create a MIN_BY aggregation
+template <typename Base>
+std::unique_ptr<Base> make_min_by_aggregation()
+{
+  return std::make_unique<detail::min_by_aggregation>();
+}
+template CUDF_EXPORT std::unique_ptr<aggregation> make_min_by_aggregation<aggregation>();
+template CUDF_EXPORT std::unique_ptr<groupby_aggregation>
+make_min_by_aggregation<groupby_aggregation>();
+
+/// Factory to create a TOP_K_BY aggregation
+template <typename Base>
+std::unique_ptr<Base> make_top_k_by_aggregation(size_type k, order topk_order)
+{
+  return std::make_unique<detail::top_k_by_aggregation>(k, topk_order);
+}
+template CUDF_EXPORT std::unique_ptr<aggregation> make_top_k_by_aggregation<aggregation>(
+  size_type k, order topk_order);
+template CUDF_EXPORT std::unique_ptr<groupby_aggregation>
+make_top_k_by_aggregation<groupby_aggregation>(size_type k, order topk_order);
+
 /// Factory to create a COVARIANCE aggregation
 template <typename Base>
 std::unique_ptr<Base> make_covariance_aggregation(size_type min_periods, size_type ddof)
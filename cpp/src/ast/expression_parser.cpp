@@ -200,6 +200,28 @@ cudf::size_type expression_parser::visit(column_name_reference const& expr)
   CUDF_FAIL("Column name references are not supported in the AST expression parser.");
 }
 
+cudf::size_type expression_parser::visit(row_index_reference const& expr)
+{
+  if (_expression_count == 0) {
+    // Handle the trivial case of a row index reference as the entire expression.
+    return visit(operation(ast_operator::IDENTITY, expr));
+  } else {
+    // Increment the expression index
+    _expression_count++;
+    if (expr.get_table_source() == table_reference::RIGHT && !_right.has_value()) {
+      CUDF_FAIL(
+        "Your expression contains a reference to the RIGHT table even though it will only be "
+        "evaluated on a single table (by convention, the LEFT table).");
+    }
+    // Push data reference; the data index is unused since the evaluator generates the value
+    auto const source = detail::device_data_reference(detail::device_data_reference_type::ROW_INDEX,
+                                                      expr.get_data_type(),
+                                                      0,
+                                                      expr.get_table_source());
+    return add_data_reference(source);
+  }
+}
+
 cudf::data_type expression_parser::output_type() const
 {
   return _data_references.empty() ? cudf::data_type(cudf::type_id::EMPTY)
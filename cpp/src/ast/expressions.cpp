@@ -50,6 +50,11 @@ cudf::size_type column_reference::accept(detail::expression_parser& visitor) con
   return visitor.visit(*this);
 }
 
+cudf::size_type row_index_reference::accept(detail::expression_parser& visitor) const
+{
+  return visitor.visit(*this);
+}
+
 cudf::size_type operation::accept(detail::expression_parser& visitor) const
 {
   return visitor.visit(*this);
@@ -72,6 +77,12 @@ auto column_reference::accept(detail::expression_transformer& visitor) const
   return visitor.visit(*this);
 }
 
+auto row_index_reference::accept(detail::expression_transformer& visitor) const
+  -> decltype(visitor.visit(*this))
+{
+  return visitor.visit(*this);
+}
+
 auto operation::accept(detail::expression_transformer& visitor) const
   -> decltype(visitor.visit(*this))
 {
@@ -218,7 +218,7 @@ std::unique_ptr<column> binary_operation(LhsType const& lhs,
 
   auto out_view = out->mutable_view();
   cudf::binops::compiled::binary_operation(out_view, lhs, rhs, op, stream);
-  // TODO: consider having the binary_operation count nulls instead
+  // the kernel fills the null mask inline; only the null count needs a separate pass
   out->set_null_count(cudf::detail::null_count(out_view.null_mask(), 0, out->size(), stream));
   return out;
 }
@@ -256,10 +256,17 @@ std::unique_ptr<column> make_fixed_width_column_for_output(scalar const& lhs,
 {
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
-  } else {
-    auto [new_mask, new_null_count] = binops::scalar_col_valid_mask_and(rhs, lhs, stream, mr);
+  } else if (rhs.nullable() or not lhs.is_valid(stream)) {
+    // the compiled kernel fills the mask inline with the values; null count is set afterwards
     return make_fixed_width_column(
-      output_type, rhs.size(), std::move(new_mask), new_null_count, stream, mr);
+      output_type,
+      rhs.size(),
+      cudf::detail::create_null_mask(rhs.size(), mask_state::UNINITIALIZED, stream, mr),
+      0,
+      stream,
+      mr);
+  } else {
+    return make_fixed_width_column(output_type, rhs.size(), mask_state::UNALLOCATED, stream, mr);
   }
 };
 
@@ -283,10 +290,17 @@ std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lh
 {
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, lhs.size(), mask_state::ALL_VALID, stream, mr);
-  } else {
-    auto [new_mask, new_null_count] = binops::scalar_col_valid_mask_and(lhs, rhs, stream, mr);
+  } else if (lhs.nullable() or not rhs.is_valid(stream)) {
+    // the compiled kernel fills the mask inline with the values; null count is set afterwards
     return make_fixed_width_column(
-      output_type, lhs.size(), std::move(new_mask), new_null_count, stream, mr);
+      output_type,
+      lhs.size(),
+      cudf::detail::create_null_mask(lhs.size(), mask_state::UNINITIALIZED, stream, mr),
+      0,
+      stream,
+      mr);
+  } else {
+    return make_fixed_width_column(output_type, lhs.size(), mask_state::UNALLOCATED, stream, mr);
   }
 };
 
@@ -310,10 +324,17 @@ std::unique_ptr<column> make_fixed_width_column_for_output(column_view const& lh
 {
   if (binops::is_null_dependent(op)) {
     return make_fixed_width_column(output_type, rhs.size(), mask_state::ALL_VALID, stream, mr);
-  } else {
-    auto [new_mask, null_count] = cudf::detail::bitmask_and(table_view({lhs, rhs}), stream, mr);
+  } else if (lhs.nullable() or rhs.nullable()) {
+    // the compiled kernel fills the mask inline with the values; null count is set afterwards
     return make_fixed_width_column(
-      output_type, lhs.size(), std::move(new_mask), null_count, stream, mr);
+      output_type,
+      lhs.size(),
+      cudf::detail::create_null_mask(lhs.size(), mask_state::UNINITIALIZED, stream, mr),
+      0,
+      stream,
+      mr);
+  } else {
+    return make_fixed_width_column(output_type, lhs.size(), mask_state::UNALLOCATED, stream, mr);
   }
 };
 
@@ -326,8 +326,16 @@ void operator_dispatcher(mutable_column_view& out,
 switch (op) {
 case binary_operator::ADD:                  apply_binary_op<ops::Add>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
 case binary_operator::SUB:                  apply_binary_op<ops::Sub>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
-case binary_operator::MUL:                  apply_binary_op<ops::Mul>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
-case binary_operator::DIV:                  apply_binary_op<ops::Div>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
+case binary_operator::MUL:                  if (is_decimal_mul_div_supported(out.type(), lhs.type(), rhs.type())) {
+                                              apply_decimal_mul(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+                                            } else {
+                                              apply_binary_op<ops::Mul>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+                                            } break;
+case binary_operator::DIV:                  if (is_decimal_mul_div_supported(out.type(), lhs.type(), rhs.type())) {
+                                              apply_decimal_div(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+                                            } else {
+                                              apply_binary_op<ops::Div>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+                                            } break;
 case binary_operator::TRUE_DIV:             apply_binary_op<ops::TrueDiv>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
 case binary_operator::FLOOR_DIV:            apply_binary_op<ops::FloorDiv>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
 case binary_operator::MOD:                  apply_binary_op<ops::Mod>(out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream); break;
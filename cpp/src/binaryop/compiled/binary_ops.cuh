@@ -22,7 +22,10 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/unary.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -38,6 +41,18 @@ CUDF_HOST_DEVICE constexpr bool is_bool_result()
   return cuda::std::is_same_v<bool, ReturnType>;
 }
 
+/**
+ * @brief Indicates whether `BinaryOperator` consumes operand validity and determines the output
+ * validity itself, rather than the output being valid iff both operands are valid.
+ */
+template <typename BinaryOperator>
+inline constexpr bool is_null_dependent_v = std::is_same_v<BinaryOperator, ops::NullEquals> or
+                                            std::is_same_v<BinaryOperator, ops::NullNotEquals> or
+                                            std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
+                                            std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
+                                            std::is_same_v<BinaryOperator, ops::NullMax> or
+                                            std::is_same_v<BinaryOperator, ops::NullMin>;
+
 /**
  * @brief Type casts each element of the column to `CastType`
  *
@@ -115,12 +130,7 @@ struct ops_wrapper {
       TypeCommon y =
         type_dispatcher(rhs.type(), type_casted_accessor<TypeCommon>{}, i, rhs, is_rhs_scalar);
       auto result = [&]() {
-        if constexpr (std::is_same_v<BinaryOperator, ops::NullEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullNotEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
-                      std::is_same_v<BinaryOperator, ops::NullMax> or
-                      std::is_same_v<BinaryOperator, ops::NullMin>) {
+        if constexpr (is_null_dependent_v<BinaryOperator>) {
           bool output_valid = false;
           auto result       = BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(
             x,
@@ -165,12 +175,7 @@ struct ops2_wrapper {
       TypeLhs x   = lhs.element<TypeLhs>(is_lhs_scalar ? 0 : i);
       TypeRhs y   = rhs.element<TypeRhs>(is_rhs_scalar ? 0 : i);
       auto result = [&]() {
-        if constexpr (std::is_same_v<BinaryOperator, ops::NullEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullNotEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
-                      std::is_same_v<BinaryOperator, ops::NullMax> or
-                      std::is_same_v<BinaryOperator, ops::NullMin>) {
+        if constexpr (is_null_dependent_v<BinaryOperator>) {
           bool output_valid = false;
           auto result       = BinaryOperator{}.template operator()<TypeLhs, TypeRhs>(
             x,
@@ -244,6 +249,69 @@ struct binary_op_double_device_dispatcher {
   }
 };
 
+constexpr size_type binary_op_block_size = 256;
+
+/**
+ * @brief Grid-stride kernel which applies per-element functor `f` and fills the output null mask
+ * in the same pass.
+ *
+ * An output row is valid iff both of its operands are valid. Each warp covers one bitmask word of
+ * 32 consecutive rows; the loop bound is padded to a warp multiple so every lane participates in
+ * the ballot, with lanes past the end contributing a cleared bit.
+ */
+template <typename Functor>
+CUDF_KERNEL void __launch_bounds__(binary_op_block_size)
+  binary_op_with_validity_kernel(Functor f,
+                                 bitmask_type* out_mask,
+                                 column_device_view lhs,
+                                 column_device_view rhs,
+                                 bool is_lhs_scalar,
+                                 bool is_rhs_scalar,
+                                 size_type size)
+{
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  auto const padded_size =
+    cudf::util::round_up_safe<thread_index_type>(size, cudf::detail::warp_size);
+  for (auto idx = cudf::detail::grid_1d::global_thread_id(); idx < padded_size; idx += stride) {
+    bool valid = false;
+    if (idx < size) {
+      auto const i = static_cast<size_type>(idx);
+      f(i);
+      valid = lhs.is_valid(is_lhs_scalar ? 0 : i) and rhs.is_valid(is_rhs_scalar ? 0 : i);
+    }
+    auto const word = __ballot_sync(0xffff'ffffu, valid);
+    if (idx % cudf::detail::warp_size == 0 and idx < size) { out_mask[word_index(idx)] = word; }
+  }
+}
+
+/**
+ * @brief Launches per-element binop functor `f` over the output rows.
+ *
+ * When `fuse_validity` is true and the output is nullable, the output null mask is computed inline
+ * with the values, so no separate mask pass is needed; the mask may be uninitialized on entry.
+ * Otherwise the mask (if any) is left untouched and `f` alone decides what to write.
+ */
+template <typename Functor>
+void launch_binary_op(mutable_column_view& out,
+                      column_device_view const& lhsd,
+                      column_device_view const& rhsd,
+                      bool is_lhs_scalar,
+                      bool is_rhs_scalar,
+                      bool fuse_validity,
+                      Functor f,
+                      rmm::cuda_stream_view stream)
+{
+  if (fuse_validity and out.nullable()) {
+    auto const grid = cudf::detail::grid_1d{out.size(), binary_op_block_size};
+    binary_op_with_validity_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      f, out.null_mask(), lhsd, rhsd, is_lhs_scalar, is_rhs_scalar, out.size());
+    CUDF_CHECK_CUDA(stream.value());
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream), thrust::counting_iterator<size_type>(0), out.size(), f);
+  }
+}
+
 template <class BinaryOperator>
 void apply_binary_op(mutable_column_view& out,
                      column_view const& lhs,
@@ -257,21 +325,29 @@ void apply_binary_op(mutable_column_view& out,
   auto lhsd = column_device_view::create(lhs, stream);
   auto rhsd = column_device_view::create(rhs, stream);
   auto outd = mutable_column_device_view::create(out, stream);
-  // Create binop functor instance
+  // Null-dependent operators write their own validity through `out.set_null`
+  constexpr bool fuse_validity = not is_null_dependent_v<BinaryOperator>;
+  // Create binop functor instance and execute it on every element
   if (common_dtype) {
-    // Execute it on every element
-    thrust::for_each_n(rmm::exec_policy_nosync(stream),
-                       thrust::counting_iterator<size_type>(0),
-                       out.size(),
-                       binary_op_device_dispatcher<BinaryOperator>{
-                         *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+    launch_binary_op(out,
+                     *lhsd,
+                     *rhsd,
+                     is_lhs_scalar,
+                     is_rhs_scalar,
+                     fuse_validity,
+                     binary_op_device_dispatcher<BinaryOperator>{
+                       *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar},
+                     stream);
   } else {
-    // Execute it on every element
-    thrust::for_each_n(rmm::exec_policy_nosync(stream),
-                       thrust::counting_iterator<size_type>(0),
-                       out.size(),
-                       binary_op_double_device_dispatcher<BinaryOperator>{
-                         *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+    launch_binary_op(out,
+                     *lhsd,
+                     *rhsd,
+                     is_lhs_scalar,
+                     is_rhs_scalar,
+                     fuse_validity,
+                     binary_op_double_device_dispatcher<BinaryOperator>{
+                       *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar},
+                     stream);
   }
 }
 
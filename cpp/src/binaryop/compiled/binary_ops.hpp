@@ -173,6 +173,10 @@ bool is_supported_operation(data_type out, data_type lhs, data_type rhs, binary_
  * @brief Deploys single type or double type dispatcher that runs binary operation on each element
  * of @p lhs and @p rhs columns.
  *
+ * If @p out is nullable, its null mask (which may be uninitialized on entry) is filled in the same
+ * kernel: a row is valid iff both of its operands are valid. Null-dependent operators instead
+ * expect an all-valid mask and clear the bits of rows they deem invalid.
+ *
  * This template is instantiated for each binary operator.
  *
  * @tparam BinaryOperator Binary operator functor
@@ -197,6 +201,9 @@ void apply_binary_op(mutable_column_view& out,
  * Comparison operators are EQUAL, NOT_EQUAL, NULL_EQUALS, NULL_NOT_EQUALS.
  * @p out type is boolean.
  *
+ * If @p out is nullable, its null mask (which may be uninitialized on entry) is filled in the same
+ * kernel: a row is valid iff both of its operands are valid.
+ *
  * This template is instantiated for each binary operator.
  *
  * @param out mutable view of output column
@@ -214,6 +221,57 @@ void dispatch_equality_op(mutable_column_view& out,
                           bool is_rhs_scalar,
                           binary_operator op,
                           rmm::cuda_stream_view stream);
+
+// Defined in decimal_mul_div.cu
+/**
+ * @brief Check if the specialized decimal multiply/divide kernels can handle the given types.
+ *
+ * The specialized kernels require the output and both operands to share one fixed_point type
+ * (scales may differ); mixed decimal/numeric operands fall back to the generic path.
+ *
+ * @param out output type of the binary operation
+ * @param lhs first operand type of the binary operation
+ * @param rhs second operand type of the binary operation
+ * @return true if the decimal multiply/divide fast path supports the given types
+ */
+bool is_decimal_mul_div_supported(data_type out, data_type lhs, data_type rhs);
+/**
+ * @brief Multiplies decimal columns with the rescale to the output scale fused into the kernel.
+ *
+ * Avoids the per-element type dispatch of the generic path. decimal128 products are computed with
+ * a 256-bit intermediate, so results that only overflow 128 bits before the rescale divide are
+ * still exact. If @p out is nullable, its null mask is filled in the same kernel: a row is valid
+ * iff both of its operands are valid.
+ *
+ * @param out mutable view of output column
+ * @param lhs view of left operand column
+ * @param rhs view of right operand column
+ * @param is_lhs_scalar true if @p lhs is a single element column representing a scalar
+ * @param is_rhs_scalar true if @p rhs is a single element column representing a scalar
+ * @param stream CUDA stream used for device memory operations
+ */
+void apply_decimal_mul(mutable_column_view& out,
+                       column_view const& lhs,
+                       column_view const& rhs,
+                       bool is_lhs_scalar,
+                       bool is_rhs_scalar,
+                       rmm::cuda_stream_view stream);
+/**
+ * @brief Divides decimal columns with the rescale to the output scale fused into the kernel.
+ *
+ * @param out mutable view of output column
+ * @param lhs view of left operand column
+ * @param rhs view of right operand column
+ * @param is_lhs_scalar true if @p lhs is a single element column representing a scalar
+ * @param is_rhs_scalar true if @p rhs is a single element column representing a scalar
+ * @param stream CUDA stream used for device memory operations
+ */
+void apply_decimal_div(mutable_column_view& out,
+                       column_view const& lhs,
+                       column_view const& rhs,
+                       bool is_lhs_scalar,
+                       bool is_rhs_scalar,
+                       rmm::cuda_stream_view stream);
 }  // namespace compiled
 }  // namespace binops
 }  // namespace cudf
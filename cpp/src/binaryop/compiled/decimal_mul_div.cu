@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_ops.hpp"
+#include "operation.cuh"
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace binops {
+namespace compiled {
+namespace {
+
+constexpr size_type decimal_binop_block_size = 256;
+
+// Largest power of ten that fits in an unsigned 64-bit limb
+constexpr int32_t max_pow10_exponent_per_limb = 19;
+
+/**
+ * @brief Unsigned 256-bit integer stored as four little-endian 64-bit limbs.
+ *
+ * Only the operations needed for a fused decimal128 multiply-and-rescale are provided: the full
+ * product of two 128-bit magnitudes and truncating division by a power of ten.
+ */
+struct uint256 {
+  uint64_t limbs[4];  // NOLINT
+
+  /**
+   * @brief Returns the full 256-bit product of two unsigned 128-bit values.
+   *
+   * The operands are decomposed into 64-bit limbs and the four partial products are accumulated
+   * with 128-bit arithmetic, so no intermediate result is truncated.
+   */
+  static __device__ uint256 multiply(__uint128_t lhs, __uint128_t rhs)
+  {
+    auto const l0 = static_cast<uint64_t>(lhs);
+    auto const l1 = static_cast<uint64_t>(lhs >> 64);
+    auto const r0 = static_cast<uint64_t>(rhs);
+    auto const r1 = static_cast<uint64_t>(rhs >> 64);
+
+    auto const p00 = static_cast<__uint128_t>(l0) * r0;
+    auto const p01 = static_cast<__uint128_t>(l0) * r1;
+    auto const p10 = static_cast<__uint128_t>(l1) * r0;
+    auto const p11 = static_cast<__uint128_t>(l1) * r1;
+
+    auto const mid = (p00 >> 64) + static_cast<uint64_t>(p01) + static_cast<uint64_t>(p10);
+    auto const high = (mid >> 64) + (p01 >> 64) + (p10 >> 64) + p11;
+
+    return uint256{{static_cast<uint64_t>(p00),
+                    static_cast<uint64_t>(mid),
+                    static_cast<uint64_t>(high),
+                    static_cast<uint64_t>(high >> 64)}};
+  }
+
+  /**
+   * @brief Divides by a 64-bit divisor in place, truncating toward zero.
+   */
+  __device__ void divide(uint64_t divisor)
+  {
+    uint64_t remainder = 0;
+    for (int i = 3; i >= 0; --i) {
+      auto const current = (static_cast<__uint128_t>(remainder) << 64) | limbs[i];
+      limbs[i]           = static_cast<uint64_t>(current / divisor);
+      remainder          = static_cast<uint64_t>(current % divisor);
+    }
+  }
+
+  /**
+   * @brief Divides by 10^exponent in place, truncating toward zero.
+   *
+   * Truncating division distributes over factoring, so dividing by one 64-bit power of ten at a
+   * time yields the same result as a single division by the full power.
+   */
+  __device__ void divide_pow10(int32_t exponent)
+  {
+    while (exponent > 0 and not is_zero()) {
+      auto const step = min(exponent, max_pow10_exponent_per_limb);
+      divide(numeric::detail::ipow<uint64_t, numeric::Radix::BASE_10>(step));
+      exponent -= step;
+    }
+  }
+
+  [[nodiscard]] __device__ bool is_zero() const
+  {
+    return (limbs[0] | limbs[1] | limbs[2] | limbs[3]) == 0;
+  }
+
+  [[nodiscard]] __device__ __uint128_t low128() const
+  {
+    return (static_cast<__uint128_t>(limbs[1]) << 64) | limbs[0];
+  }
+};
+
+/**
+ * @brief Full-precision decimal128 product rescaled to `rescale_exponent` extra digits.
+ *
+ * Computes the 256-bit product of the two representation values and folds the post-op rescale
+ * divide into the same computation, so products that overflow 128 bits before the rescale still
+ * produce the correct result whenever the rescaled value fits the representation.
+ */
+__device__ __int128_t multiply_and_rescale128(__int128_t lhs,
+                                              __int128_t rhs,
+                                              int32_t rescale_exponent)
+{
+  auto const negative    = (lhs < 0) != (rhs < 0);
+  auto const l_magnitude = static_cast<__uint128_t>(lhs < 0 ? -lhs : lhs);
+  auto const r_magnitude = static_cast<__uint128_t>(rhs < 0 ? -rhs : rhs);
+
+  auto product = uint256::multiply(l_magnitude, r_magnitude);
+  product.divide_pow10(rescale_exponent);
+
+  auto const magnitude = static_cast<__int128_t>(product.low128());
+  return negative ? -magnitude : magnitude;
+}
+
+/**
+ * @brief Computes `op(lhs, rhs)` rescaled to the output scale, for one decimal type.
+ *
+ * Operands and output share a representation type; only their scales may differ. Performing the
+ * operation and the rescale in a single kernel avoids the per-element type dispatch that the
+ * generic binary operation path pays for decimal columns.
+ *
+ * When `out_mask` is non-null the output null mask is filled in the same pass: a row is valid iff
+ * both of its operands are valid. Each warp covers one bitmask word, so the loop bound is padded
+ * to a warp multiple to keep every lane in the ballot.
+ */
+template <typename T, typename BinaryOperator>
+CUDF_KERNEL void decimal_binop_kernel(device_storage_type_t<T> const* lhs_data,
+                                      bitmask_type const* lhs_mask,
+                                      int32_t lhs_scale,
+                                      bool is_lhs_scalar,
+                                      device_storage_type_t<T> const* rhs_data,
+                                      bitmask_type const* rhs_mask,
+                                      int32_t rhs_scale,
+                                      bool is_rhs_scalar,
+                                      device_storage_type_t<T>* out_data,
+                                      bitmask_type* out_mask,
+                                      int32_t out_scale,
+                                      size_type size)
+{
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  auto const padded_size =
+    cudf::util::round_up_safe<thread_index_type>(size, cudf::detail::warp_size);
+  for (auto idx = cudf::detail::grid_1d::global_thread_id(); idx < padded_size; idx += stride) {
+    bool valid = false;
+    if (idx < size) {
+      auto const i = static_cast<size_type>(idx);
+      auto const x = T{numeric::scaled_integer{lhs_data[is_lhs_scalar ? 0 : i],
+                                               numeric::scale_type{lhs_scale}}};
+      auto const y = T{numeric::scaled_integer{rhs_data[is_rhs_scalar ? 0 : i],
+                                               numeric::scale_type{rhs_scale}}};
+
+      out_data[i] = [&]() -> device_storage_type_t<T> {
+        if constexpr (std::is_same_v<T, numeric::decimal128> and
+                      std::is_same_v<BinaryOperator, ops::Mul>) {
+          auto const rescale_exponent = out_scale - (lhs_scale + rhs_scale);
+          if (rescale_exponent > 0) {
+            return multiply_and_rescale128(x.value(), y.value(), rescale_exponent);
+          }
+        }
+        return BinaryOperator{}(x, y).rescaled(numeric::scale_type{out_scale}).value();
+      }();
+      valid = (lhs_mask == nullptr or bit_is_set(lhs_mask, is_lhs_scalar ? 0 : i)) and
+              (rhs_mask == nullptr or bit_is_set(rhs_mask, is_rhs_scalar ? 0 : i));
+    }
+    if (out_mask != nullptr) {
+      auto const word = __ballot_sync(0xffff'ffffu, valid);
+      if (idx % cudf::detail::warp_size == 0 and idx < size) { out_mask[word_index(idx)] = word; }
+    }
+  }
+}
+
+template <typename BinaryOperator>
+struct decimal_binop_launcher {
+  template <typename T, CUDF_ENABLE_IF(is_fixed_point<T>())>
+  void operator()(mutable_column_view& out,
+                  column_view const& lhs,
+                  column_view const& rhs,
+                  bool is_lhs_scalar,
+                  bool is_rhs_scalar,
+                  rmm::cuda_stream_view stream) const
+  {
+    using DeviceType = device_storage_type_t<T>;
+    auto const grid  = cudf::detail::grid_1d{out.size(), decimal_binop_block_size};
+    decimal_binop_kernel<T, BinaryOperator>
+      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        lhs.begin<DeviceType>(),
+        lhs.null_mask(),
+        lhs.type().scale(),
+        is_lhs_scalar,
+        rhs.begin<DeviceType>(),
+        rhs.null_mask(),
+        rhs.type().scale(),
+        is_rhs_scalar,
+        out.begin<DeviceType>(),
+        out.nullable() ? out.null_mask() : nullptr,
+        out.type().scale(),
+        out.size());
+    CUDF_CHECK_CUDA(stream.value());
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not is_fixed_point<T>())>
+  void operator()(mutable_column_view&,
+                  column_view const&,
+                  column_view const&,
+                  bool,
+                  bool,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Decimal binary operation fast path requires fixed_point types.");
+  }
+};
+
+}  // namespace
+
+bool is_decimal_mul_div_supported(data_type out, data_type lhs, data_type rhs)
+{
+  return is_fixed_point(out) and lhs.id() == out.id() and rhs.id() == out.id();
+}
+
+void apply_decimal_mul(mutable_column_view& out,
+                       column_view const& lhs,
+                       column_view const& rhs,
+                       bool is_lhs_scalar,
+                       bool is_rhs_scalar,
+                       rmm::cuda_stream_view stream)
+{
+  type_dispatcher(out.type(),
+                  decimal_binop_launcher<ops::Mul>{},
+                  out,
+                  lhs,
+                  rhs,
+                  is_lhs_scalar,
+                  is_rhs_scalar,
+                  stream);
+}
+
+void apply_decimal_div(mutable_column_view& out,
+                       column_view const& lhs,
+                       column_view const& rhs,
+                       bool is_lhs_scalar,
+                       bool is_rhs_scalar,
+                       rmm::cuda_stream_view stream)
+{
+  type_dispatcher(out.type(),
+                  decimal_binop_launcher<ops::Div>{},
+                  out,
+                  lhs,
+                  rhs,
+                  is_lhs_scalar,
+                  is_rhs_scalar,
+                  stream);
+}
+
+}  // namespace compiled
+}  // namespace binops
+}  // namespace cudf
@@ -34,31 +34,47 @@ void dispatch_equality_op(mutable_column_view& out,
   auto rhsd         = column_device_view::create(rhs, stream);
   if (common_dtype) {
     if (op == binary_operator::EQUAL) {
-      thrust::for_each_n(rmm::exec_policy_nosync(stream),
-                         thrust::counting_iterator<size_type>(0),
-                         out.size(),
-                         binary_op_device_dispatcher<ops::Equal>{
-                           *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+      launch_binary_op(out,
+                       *lhsd,
+                       *rhsd,
+                       is_lhs_scalar,
+                       is_rhs_scalar,
+                       true,
+                       binary_op_device_dispatcher<ops::Equal>{
+                         *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar},
+                       stream);
     } else if (op == binary_operator::NOT_EQUAL) {
-      thrust::for_each_n(rmm::exec_policy_nosync(stream),
-                         thrust::counting_iterator<size_type>(0),
-                         out.size(),
-                         binary_op_device_dispatcher<ops::NotEqual>{
-                           *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+      launch_binary_op(out,
+                       *lhsd,
+                       *rhsd,
+                       is_lhs_scalar,
+                       is_rhs_scalar,
+                       true,
+                       binary_op_device_dispatcher<ops::NotEqual>{
+                         *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar},
+                       stream);
     }
   } else {
     if (op == binary_operator::EQUAL) {
-      thrust::for_each_n(rmm::exec_policy_nosync(stream),
-                         thrust::counting_iterator<size_type>(0),
-                         out.size(),
-                         binary_op_double_device_dispatcher<ops::Equal>{
-                           *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+      launch_binary_op(out,
+                       *lhsd,
+                       *rhsd,
+                       is_lhs_scalar,
+                       is_rhs_scalar,
+                       true,
+                       binary_op_double_device_dispatcher<ops::Equal>{
+                         *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar},
+                       stream);
     } else if (op == binary_operator::NOT_EQUAL) {
-      thrust::for_each_n(rmm::exec_policy_nosync(stream),
-                         thrust::counting_iterator<size_type>(0),
-                         out.size(),
-                         binary_op_double_device_dispatcher<ops::NotEqual>{
-                           *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+      launch_binary_op(out,
+                       *lhsd,
+                       *rhsd,
+                       is_lhs_scalar,
+                       is_rhs_scalar,
+                       true,
+                       binary_op_double_device_dispatcher<ops::NotEqual>{
+                         *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar},
+                       stream);
     }
   }
 }
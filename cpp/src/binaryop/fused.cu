@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns `true` if `op` is one of the six comparison operators
+ */
+bool is_fusable_comparison(binary_operator op)
+{
+  return op == binary_operator::EQUAL || op == binary_operator::NOT_EQUAL ||
+         op == binary_operator::LESS || op == binary_operator::GREATER ||
+         op == binary_operator::LESS_EQUAL || op == binary_operator::GREATER_EQUAL;
+}
+
+/**
+ * @brief Fused comparison and selection for a single row
+ *
+ * Used only when all four columns share the same non-nullable type.
+ */
+template <typename T>
+struct compare_select_fn {
+  T const* d_lhs;
+  T const* d_rhs;
+  T const* d_true;
+  T const* d_false;
+  binary_operator compare_op;
+
+  __device__ T operator()(cudf::size_type idx) const
+  {
+    auto const lhs    = d_lhs[idx];
+    auto const rhs    = d_rhs[idx];
+    auto const result = [&] {
+      switch (compare_op) {
+        case binary_operator::EQUAL: return lhs == rhs;
+        case binary_operator::NOT_EQUAL: return lhs != rhs;
+        case binary_operator::LESS: return lhs < rhs;
+        case binary_operator::GREATER: return lhs > rhs;
+        case binary_operator::LESS_EQUAL: return lhs <= rhs;
+        default: return lhs >= rhs;
+      }
+    }();
+    return result ? d_true[idx] : d_false[idx];
+  }
+};
+
+struct compare_select_dispatch_fn {
+  template <typename T,
+            CUDF_ENABLE_IF(cudf::is_relationally_comparable<T, T>() and
+                           cudf::is_equality_comparable<T, T>() and cudf::is_fixed_width<T>() and
+                           not cudf::is_fixed_point<T>())>
+  std::unique_ptr<column> operator()(column_view const& lhs,
+                                     column_view const& rhs,
+                                     binary_operator compare_op,
+                                     column_view const& true_values,
+                                     column_view const& false_values,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    auto output = cudf::make_fixed_width_column(
+      true_values.type(), lhs.size(), mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::counting_iterator<cudf::size_type>(0),
+                      thrust::counting_iterator<cudf::size_type>(lhs.size()),
+                      output->mutable_view().begin<T>(),
+                      compare_select_fn<T>{lhs.begin<T>(),
+                                           rhs.begin<T>(),
+                                           true_values.begin<T>(),
+                                           false_values.begin<T>(),
+                                           compare_op});
+    return output;
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not(cudf::is_relationally_comparable<T, T>() and
+                               cudf::is_equality_comparable<T, T>() and cudf::is_fixed_width<T>() and
+                               not cudf::is_fixed_point<T>()))>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     column_view const&,
+                                     binary_operator,
+                                     column_view const&,
+                                     column_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref)
+  {
+    CUDF_FAIL("Unsupported type for compare_and_select");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> fused_multiply_add(column_view const& x,
+                                           column_view const& y,
+                                           column_view const& z,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(x.size() == y.size() && x.size() == z.size(),
+               "Column sizes don't match",
+               std::invalid_argument);
+
+  auto const table   = cudf::table_view{{x, y, z}};
+  auto const ref_x   = ast::column_reference(0);
+  auto const ref_y   = ast::column_reference(1);
+  auto const ref_z   = ast::column_reference(2);
+  auto const product = ast::operation(ast::ast_operator::MUL, ref_x, ref_y);
+  auto const sum     = ast::operation(ast::ast_operator::ADD, product, ref_z);
+  return compute_column(table, sum, stream, mr);
+}
+
+std::unique_ptr<column> compare_and_select(column_view const& lhs,
+                                           column_view const& rhs,
+                                           binary_operator compare_op,
+                                           column_view const& true_values,
+                                           column_view const& false_values,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(lhs.size() == rhs.size() && lhs.size() == true_values.size() &&
+                 lhs.size() == false_values.size(),
+               "Column sizes don't match",
+               std::invalid_argument);
+  CUDF_EXPECTS(is_fusable_comparison(compare_op),
+               "compare_op must be a comparison operator",
+               std::invalid_argument);
+  CUDF_EXPECTS(true_values.type() == false_values.type(),
+               "true_values and false_values types must match",
+               cudf::data_type_error);
+  if (lhs.is_empty()) { return cudf::empty_like(true_values); }
+
+  auto const same_types = lhs.type() == rhs.type() && lhs.type() == true_values.type();
+  auto const no_nulls   = !lhs.has_nulls() && !rhs.has_nulls() && !true_values.has_nulls() &&
+                        !false_values.has_nulls();
+  if (same_types && no_nulls && cudf::is_fixed_width(lhs.type()) &&
+      !cudf::is_fixed_point(lhs.type())) {
+    return cudf::type_dispatcher(lhs.type(),
+                                 compare_select_dispatch_fn{},
+                                 lhs,
+                                 rhs,
+                                 compare_op,
+                                 true_values,
+                                 false_values,
+                                 stream,
+                                 mr);
+  }
+
+  // fall back to a comparison mask and a separate selection pass;
+  // a null comparison result selects from false_values
+  auto const mask = binary_operation(
+    lhs, rhs, compare_op, data_type{type_id::BOOL8}, stream, cudf::get_current_device_resource_ref());
+  return copy_if_else(true_values, false_values, mask->view(), stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> fused_multiply_add(column_view const& x,
+                                           column_view const& y,
+                                           column_view const& z,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::fused_multiply_add(x, y, z, stream, mr);
+}
+
+std::unique_ptr<column> compare_and_select(column_view const& lhs,
+                                           column_view const& rhs,
+                                           binary_operator compare_op,
+                                           column_view const& true_values,
+                                           column_view const& false_values,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compare_and_select(lhs, rhs, compare_op, true_values, false_values, stream, mr);
+}
+
+}  // namespace cudf
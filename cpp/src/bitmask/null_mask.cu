@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -33,16 +33,20 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
 #include <cub/cub.cuh>
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
 #include <thrust/extrema.h>
+#include <thrust/uninitialized_fill.h>
 
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
 #include <type_traits>
 
 namespace cudf {
@@ -457,11 +461,20 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
 
   std::vector<bitmask_type const*> masks;
   std::vector<size_type> offsets;
+  bool has_nullable = false;
   for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
+    if (not col.nullable()) { continue; }
+    has_nullable = true;
+    // An all-null column forces the result to all-null; no masks need to be read
+    if (col.null_count() == view.num_rows()) {
+      return std::pair(detail::create_null_mask(view.num_rows(), mask_state::ALL_NULL, stream, mr),
+                       view.num_rows());
     }
+    // The stored null count identifies all-valid masks, which are the identity for AND;
+    // skip loading them so nearly-all-valid tables only pay for masks that carry nulls
+    if (col.null_count() == 0) { continue; }
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
   }
 
   if (masks.size() > 0) {
@@ -474,6 +487,12 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
       mr);
   }
 
+  // Nullable inputs, but every mask was all-valid: equivalent to ANDing them, without the reads
+  if (has_nullable) {
+    return std::pair(detail::create_null_mask(view.num_rows(), mask_state::ALL_VALID, stream, mr),
+                     0);
+  }
+
   return std::pair(std::move(null_mask), 0);
 }
 
@@ -488,26 +507,275 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
     return std::pair(std::move(null_mask), 0);
   }
 
+  // A column without a mask is all-valid, which makes the OR all-valid (and unallocated)
+  if (not std::all_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); })) {
+    return std::pair(std::move(null_mask), 0);
+  }
+
+  // Same for an all-valid mask, except the result keeps a (fully set) mask; either way the
+  // stored null counts let us answer without reading any mask words
+  if (std::any_of(
+        view.begin(), view.end(), [](auto const& col) { return col.null_count() == 0; })) {
+    return std::pair(detail::create_null_mask(view.num_rows(), mask_state::ALL_VALID, stream, mr),
+                     0);
+  }
+
   std::vector<bitmask_type const*> masks;
   std::vector<size_type> offsets;
   for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
+    // All-null masks are the identity for OR and do not need to be read
+    if (col.null_count() == view.num_rows()) { continue; }
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+
+  // Every column is all-null, so the result is too
+  if (masks.empty()) {
+    return std::pair(detail::create_null_mask(view.num_rows(), mask_state::ALL_NULL, stream, mr),
+                     view.num_rows());
+  }
+
+  return cudf::detail::bitmask_binop(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    masks,
+    offsets,
+    view.num_rows(),
+    stream,
+    mr);
+}
+
+namespace {
+
+/**
+ * @brief Merges the null masks of many table views with a single kernel launch
+ *
+ * Each view for which @p is_active returns true contributes one merge task; inactive views
+ * produce an empty mask with a null count of zero, matching the single-table
+ * `bitmask_and`/`bitmask_or` behavior for tables without the required masks.
+ */
+template <typename Binop, typename ActivePredicate>
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_binop_over_tables(
+  Binop op,
+  host_span<table_view const> views,
+  ActivePredicate is_active,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto task_masks      = std::vector<std::vector<bitmask_type const*>>{};
+  auto task_begin_bits = std::vector<std::vector<size_type>>{};
+  auto task_size_bits  = std::vector<size_type>{};
+  auto task_of_view    = std::vector<std::size_t>{};
+
+  for (std::size_t v = 0; v < views.size(); ++v) {
+    auto const& view = views[v];
+    if (view.num_rows() == 0 or view.num_columns() == 0 or not is_active(view)) { continue; }
+    auto masks   = std::vector<bitmask_type const*>{};
+    auto offsets = std::vector<size_type>{};
+    for (auto&& col : view) {
+      if (col.nullable()) {
+        masks.push_back(col.null_mask());
+        offsets.push_back(col.offset());
+      }
     }
+    task_masks.push_back(std::move(masks));
+    task_begin_bits.push_back(std::move(offsets));
+    task_size_bits.push_back(view.num_rows());
+    task_of_view.push_back(v);
   }
 
-  if (static_cast<size_type>(masks.size()) == view.num_columns()) {
-    return cudf::detail::bitmask_binop(
-      [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
-      masks,
-      offsets,
-      view.num_rows(),
-      stream,
-      mr);
+  auto merged =
+    cudf::detail::batched_bitmask_binop(op, task_masks, task_begin_bits, task_size_bits, stream, mr);
+
+  auto results = std::vector<std::pair<rmm::device_buffer, size_type>>{};
+  results.reserve(views.size());
+  for (std::size_t v = 0; v < views.size(); ++v) {
+    results.emplace_back(rmm::device_buffer{0, stream, mr}, 0);
   }
+  for (std::size_t t = 0; t < merged.size(); ++t) {
+    results[task_of_view[t]] = std::move(merged[t]);
+  }
+  return results;
+}
 
-  return std::pair(std::move(null_mask), 0);
+/**
+ * @brief Counts the set bits of many independent bitmask ranges in one launch
+ *
+ * Task `t` covers the words of `masks[t]` offset by `begin_bits[t]` spanning `size_bits[t]` bits;
+ * tasks are flattened over the global word space delimited by @p word_offsets.
+ *
+ * @param masks Source mask pointer for each task
+ * @param begin_bits Bit offset of each mask in @p masks
+ * @param size_bits Number of bits counted by each task
+ * @param word_offsets Exclusive scan of each task's word count, with the total appended
+ * @param valid_counts Per-task counters of set bits, must be zero-initialized
+ */
+CUDF_KERNEL void batched_valid_count_kernel(device_span<bitmask_type const* const> masks,
+                                            device_span<size_type const> begin_bits,
+                                            device_span<size_type const> size_bits,
+                                            device_span<size_type const> word_offsets,
+                                            device_span<size_type> valid_counts)
+{
+  auto const tid         = cudf::detail::grid_1d::global_thread_id();
+  auto const total_words = word_offsets.back();
+
+  for (auto global_word_index = static_cast<size_type>(tid); global_word_index < total_words;
+       global_word_index += cudf::detail::grid_1d::grid_stride()) {
+    auto const task = static_cast<size_type>(
+      thrust::distance(
+        word_offsets.begin(),
+        thrust::upper_bound(
+          thrust::seq, word_offsets.begin(), word_offsets.end(), global_word_index)) -
+      1);
+    auto const word_index = global_word_index - word_offsets[task];
+    auto const size       = size_bits[task];
+
+    bitmask_type word =
+      detail::get_mask_offset_word(masks[task], word_index, begin_bits[task], begin_bits[task] + size);
+
+    auto const last_bit_index = size - 1;
+    if (word_index == cudf::word_index(last_bit_index)) {
+      auto const num_bits_in_last_word = intra_word_index(last_bit_index);
+      if (num_bits_in_last_word <
+          static_cast<size_type>(detail::size_in_bits<bitmask_type>() - 1)) {
+        word &= set_least_significant_bits(num_bits_in_last_word + 1);
+      }
+    }
+
+    atomicAdd(&valid_counts[task], __popc(word));
+  }
+}
+
+/**
+ * @brief Counts the set bits of arbitrary (mask, begin bit, size) tasks in one launch
+ *
+ * @return The number of set bits of each task
+ */
+std::vector<size_type> batched_valid_counts(std::vector<bitmask_type const*> const& h_masks,
+                                            std::vector<size_type> const& h_begin_bits,
+                                            std::vector<size_type> const& h_size_bits,
+                                            rmm::cuda_stream_view stream)
+{
+  if (h_masks.empty()) { return {}; }
+
+  auto h_word_offsets = std::vector<size_type>{0};
+  for (auto const size_bits : h_size_bits) {
+    h_word_offsets.push_back(h_word_offsets.back() + num_bitmask_words(size_bits));
+  }
+
+  auto const mr       = cudf::get_current_device_resource_ref();
+  auto d_masks        = cudf::detail::make_device_uvector_async(h_masks, stream, mr);
+  auto d_begin_bits   = cudf::detail::make_device_uvector_async(h_begin_bits, stream, mr);
+  auto d_size_bits    = cudf::detail::make_device_uvector_async(h_size_bits, stream, mr);
+  auto d_word_offsets = cudf::detail::make_device_uvector_async(h_word_offsets, stream, mr);
+  auto d_valid_counts = rmm::device_uvector<size_type>(h_masks.size(), stream, mr);
+  thrust::uninitialized_fill(
+    rmm::exec_policy(stream), d_valid_counts.begin(), d_valid_counts.end(), 0);
+
+  cudf::detail::grid_1d config(h_word_offsets.back(), 256);
+  batched_valid_count_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+    d_masks, d_begin_bits, d_size_bits, d_word_offsets, d_valid_counts);
+  CUDF_CHECK_CUDA(stream.value());
+
+  return cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+}
+
+}  // namespace
+
+// AND of the null masks of each table view, all views in one kernel launch
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_and(
+  host_span<table_view const> views, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return batched_bitmask_binop_over_tables(
+    [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
+    views,
+    [](table_view const& view) {
+      return std::any_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); });
+    },
+    stream,
+    mr);
+}
+
+// OR of the null masks of each table view, all views in one kernel launch
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_or(
+  host_span<table_view const> views, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return batched_bitmask_binop_over_tables(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    views,
+    [](table_view const& view) {
+      return std::all_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); });
+    },
+    stream,
+    mr);
+}
+
+// Null count of every column of a table, all columns in one kernel launch
+std::vector<size_type> null_counts(table_view const& view, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  auto results = std::vector<size_type>(view.num_columns(), 0);
+  if (view.num_rows() == 0) { return results; }
+
+  auto h_masks        = std::vector<bitmask_type const*>{};
+  auto h_begin_bits   = std::vector<size_type>{};
+  auto h_size_bits    = std::vector<size_type>{};
+  auto task_of_column = std::vector<size_type>{};
+  for (size_type c = 0; c < view.num_columns(); ++c) {
+    auto const& col = view.column(c);
+    if (not col.nullable()) { continue; }
+    h_masks.push_back(col.null_mask());
+    h_begin_bits.push_back(col.offset());
+    h_size_bits.push_back(col.size());
+    task_of_column.push_back(c);
+  }
+
+  auto const h_valid_counts = batched_valid_counts(h_masks, h_begin_bits, h_size_bits, stream);
+  for (std::size_t t = 0; t < task_of_column.size(); ++t) {
+    results[task_of_column[t]] = h_size_bits[t] - h_valid_counts[t];
+  }
+  return results;
+}
+
+// Null count of every column and segment of a table, all tasks in one kernel launch
+std::vector<size_type> segmented_null_counts(table_view const& view,
+                                             host_span<size_type const> indices,
+                                             rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even", std::invalid_argument);
+  auto const num_segments = static_cast<size_type>(indices.size() / 2);
+  auto results            = std::vector<size_type>(view.num_columns() * num_segments, 0);
+  if (results.empty()) { return results; }
+
+  auto h_masks       = std::vector<bitmask_type const*>{};
+  auto h_begin_bits  = std::vector<size_type>{};
+  auto h_size_bits   = std::vector<size_type>{};
+  auto task_of_entry = std::vector<std::size_t>{};
+  for (size_type c = 0; c < view.num_columns(); ++c) {
+    auto const& col = view.column(c);
+    for (size_type s = 0; s < num_segments; ++s) {
+      auto const begin = indices[2 * s];
+      auto const end   = indices[2 * s + 1];
+      CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.", std::out_of_range);
+      CUDF_EXPECTS(end >= begin,
+                   "End index cannot be smaller than the starting index.",
+                   std::invalid_argument);
+      CUDF_EXPECTS(end <= col.size(), "Slice range out of bounds.", std::out_of_range);
+      if (not col.nullable() or begin == end) { continue; }
+      h_masks.push_back(col.null_mask());
+      h_begin_bits.push_back(col.offset() + begin);
+      h_size_bits.push_back(end - begin);
+      task_of_entry.push_back(static_cast<std::size_t>(c) * num_segments + s);
+    }
+  }
+
+  auto const h_valid_counts = batched_valid_counts(h_masks, h_begin_bits, h_size_bits, stream);
+  for (std::size_t t = 0; t < task_of_entry.size(); ++t) {
+    results[task_of_entry[t]] = h_size_bits[t] - h_valid_counts[t];
+  }
+  return results;
 }
 
 void set_all_valid_null_masks(column_view const& input,
@@ -563,6 +831,34 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
   return detail::bitmask_or(view, stream, mr);
 }
 
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_and(
+  host_span<table_view const> views, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_bitmask_and(views, stream, mr);
+}
+
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_or(
+  host_span<table_view const> views, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_bitmask_or(views, stream, mr);
+}
+
+std::vector<size_type> null_counts(table_view const& view, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::null_counts(view, stream);
+}
+
+std::vector<size_type> segmented_null_counts(table_view const& view,
+                                             host_span<size_type const> indices,
+                                             rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_null_counts(view, indices, stream);
+}
+
 // Count non-zero bits in the specified range
 cudf::size_type null_count(bitmask_type const* bitmask,
                            size_type start,
@@ -18,10 +18,16 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/integer_utils.hpp>
 #include <cudf/utilities/traits.hpp>
 
+#include <rmm/aligned.hpp>
+
+#include <numeric>
+
 namespace cudf {
 namespace {
 struct size_of_helper {
@@ -168,6 +174,63 @@ std::unique_ptr<column> make_fixed_width_column(data_type type,
   // clang-format on
 }
 
+// Allocate storage for a table of fixed width columns in one device allocation
+bulk_allocated_table make_fixed_width_table(std::vector<data_type> const& types,
+                                            size_type size,
+                                            mask_state state,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(size >= 0, "Column size cannot be negative.");
+  std::for_each(types.begin(), types.end(), [](data_type type) {
+    CUDF_EXPECTS(type.id() != type_id::EMPTY && is_fixed_width(type),
+                 "Invalid, non-fixed-width type.",
+                 cudf::data_type_error);
+  });
+
+  // All column data regions are laid out first, followed by all null mask regions, each
+  // padded so every suballocation keeps the alignment a dedicated allocation would have
+  auto const align = rmm::CUDA_ALLOCATION_ALIGNMENT;
+  std::vector<std::size_t> data_offsets;
+  data_offsets.reserve(types.size() + 1);
+  data_offsets.push_back(0);
+  std::transform(types.begin(),
+                 types.end(),
+                 std::back_inserter(data_offsets),
+                 [&, offset = std::size_t{0}](data_type type) mutable {
+                   offset += util::round_up_safe(size * cudf::size_of(type), align);
+                   return offset;
+                 });
+  auto const mask_begin = data_offsets.back();
+  auto const mask_bytes = (state == mask_state::UNALLOCATED)
+                            ? std::size_t{0}
+                            : util::round_up_safe(bitmask_allocation_size_bytes(size), align);
+
+  bulk_allocated_table result;
+  result.all_data = std::make_unique<rmm::device_buffer>(
+    mask_begin + mask_bytes * types.size(), stream, mr);
+  auto* const base = static_cast<std::byte*>(result.all_data->data());
+
+  if (mask_bytes > 0 && (state == mask_state::ALL_VALID || state == mask_state::ALL_NULL)) {
+    CUDF_CUDA_TRY(cudaMemsetAsync(base + mask_begin,
+                                  state == mask_state::ALL_VALID ? 0xff : 0x00,
+                                  mask_bytes * types.size(),
+                                  stream.value()));
+  }
+
+  auto const null_count = state == mask_state::UNINITIALIZED ? 0 : state_null_count(state, size);
+  result.columns.reserve(types.size());
+  for (std::size_t i = 0; i < types.size(); ++i) {
+    auto* const data = size > 0 ? base + data_offsets[i] : nullptr;
+    auto* const mask = mask_bytes > 0
+                         ? reinterpret_cast<bitmask_type*>(base + mask_begin + mask_bytes * i)
+                         : nullptr;
+    result.columns.emplace_back(types[i], size, data, mask, null_count);
+  }
+  return result;
+}
+
 std::unique_ptr<column> make_dictionary_from_scalar(scalar const& s,
                                                     size_type size,
                                                     rmm::cuda_stream_view stream,
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_statistics.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <utility>
+
+namespace cudf {
+
+column_statistics compute_column_statistics(column_view const& input,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  auto statistics      = column_statistics{};
+  statistics.has_nulls = input.has_nulls();
+  statistics.is_sorted_ascending =
+    input.is_empty() or
+    detail::is_sorted(
+      table_view{{input}}, {order::ASCENDING}, {null_order::BEFORE}, stream);
+  if (not is_nested(input.type()) and input.size() > input.null_count()) {
+    std::tie(statistics.min, statistics.max) = minmax(input, stream, mr);
+  }
+  return statistics;
+}
+
+}  // namespace cudf
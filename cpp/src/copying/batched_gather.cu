@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/batched_memcpy.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief One fixed-width column gather expressed as element-wise batched copies.
+ */
+struct gather_job {
+  uint8_t const* src;        ///< source column data, offset applied
+  uint8_t* dst;              ///< destination column data
+  size_type const* map;      ///< gather map rows for this job
+  std::size_t width;         ///< element width in bytes
+};
+
+/**
+ * @brief Locates the job owning a flat element index.
+ */
+__device__ inline std::size_t job_of(std::size_t const* starts,
+                                     std::size_t num_jobs,
+                                     std::size_t element)
+{
+  return static_cast<std::size_t>(
+           thrust::upper_bound(thrust::seq, starts, starts + num_jobs, element) - starts) -
+         1;
+}
+
+struct src_address_fn {
+  gather_job const* jobs;
+  std::size_t const* starts;
+  std::size_t num_jobs;
+  __device__ void* operator()(std::size_t element) const
+  {
+    auto const j   = job_of(starts, num_jobs, element);
+    auto const row = element - starts[j];
+    return const_cast<uint8_t*>(jobs[j].src +
+                                static_cast<std::size_t>(jobs[j].map[row]) * jobs[j].width);
+  }
+};
+
+struct dst_address_fn {
+  gather_job const* jobs;
+  std::size_t const* starts;
+  std::size_t num_jobs;
+  __device__ void* operator()(std::size_t element) const
+  {
+    auto const j   = job_of(starts, num_jobs, element);
+    auto const row = element - starts[j];
+    return jobs[j].dst + row * jobs[j].width;
+  }
+};
+
+struct copy_size_fn {
+  gather_job const* jobs;
+  std::size_t const* starts;
+  std::size_t num_jobs;
+  __device__ std::size_t operator()(std::size_t element) const
+  {
+    return jobs[job_of(starts, num_jobs, element)].width;
+  }
+};
+
+/**
+ * @brief True when a column can be gathered as raw element copies.
+ */
+bool is_batchable(column_view const& col)
+{
+  return cudf::is_fixed_width(col.type()) and not col.nullable();
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<table>> batched_gather(std::vector<table_view> const& source_tables,
+                                                   std::vector<column_view> const& gather_maps,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(source_tables.size() == gather_maps.size(),
+               "Mismatched number of tables and gather maps",
+               std::invalid_argument);
+  for (auto const& gather_map : gather_maps) {
+    CUDF_EXPECTS(
+      not gather_map.has_nulls(), "gather_map contains nulls", std::invalid_argument);
+    CUDF_EXPECTS(gather_map.type().id() == type_to_id<size_type>(),
+                 "gather_map must be a non-nullable INT32 column",
+                 std::invalid_argument);
+  }
+
+  auto const num_pairs = source_tables.size();
+  std::vector<std::vector<std::unique_ptr<column>>> output_columns(num_pairs);
+
+  std::vector<gather_job> jobs;
+  std::vector<std::size_t> job_starts{0};
+
+  for (std::size_t i = 0; i < num_pairs; ++i) {
+    auto const& source = source_tables[i];
+    auto const& map    = gather_maps[i];
+    auto const n_rows  = map.size();
+    output_columns[i].resize(source.num_columns());
+
+    // columns the batched copy cannot express are gathered per pair below
+    std::vector<column_view> fallback_columns;
+    std::vector<size_type> fallback_positions;
+
+    for (size_type c = 0; c < source.num_columns(); ++c) {
+      auto const& col = source.column(c);
+      if (not is_batchable(col) or n_rows == 0) {
+        fallback_columns.push_back(col);
+        fallback_positions.push_back(c);
+        continue;
+      }
+      auto output = make_fixed_width_column(col.type(), n_rows, mask_state::UNALLOCATED, stream, mr);
+      auto const width = static_cast<std::size_t>(cudf::size_of(col.type()));
+      jobs.push_back(gather_job{col.head<uint8_t>() + static_cast<std::size_t>(col.offset()) * width,
+                                output->mutable_view().head<uint8_t>(),
+                                map.data<size_type>(),
+                                width});
+      job_starts.push_back(job_starts.back() + static_cast<std::size_t>(n_rows));
+      output_columns[i][c] = std::move(output);
+    }
+
+    if (not fallback_columns.empty()) {
+      auto gathered = detail::gather(table_view{fallback_columns},
+                                     map,
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     negative_index_policy::NOT_ALLOWED,
+                                     stream,
+                                     mr);
+      auto released = gathered->release();
+      for (std::size_t f = 0; f < fallback_positions.size(); ++f) {
+        output_columns[i][fallback_positions[f]] = std::move(released[f]);
+      }
+    }
+  }
+
+  if (not jobs.empty()) {
+    auto const temp_mr = cudf::get_current_device_resource_ref();
+    auto const d_jobs  = cudf::detail::make_device_uvector_async(jobs, stream, temp_mr);
+    auto const d_starts =
+      cudf::detail::make_device_uvector_async(job_starts, stream, temp_mr);
+
+    auto const num_jobs     = jobs.size();
+    auto const num_elements = job_starts.back();
+    auto const counting     = thrust::counting_iterator<std::size_t>(0);
+    auto const src_iter     = thrust::make_transform_iterator(
+      counting, src_address_fn{d_jobs.data(), d_starts.data(), num_jobs});
+    auto const dst_iter = thrust::make_transform_iterator(
+      counting, dst_address_fn{d_jobs.data(), d_starts.data(), num_jobs});
+    auto const size_iter = thrust::make_transform_iterator(
+      counting, copy_size_fn{d_jobs.data(), d_starts.data(), num_jobs});
+
+    // all columns of all pairs are copied by this one batched launch
+    cudf::detail::batched_memcpy_async(src_iter, dst_iter, size_iter, num_elements, stream);
+  }
+
+  std::vector<std::unique_ptr<table>> result;
+  result.reserve(num_pairs);
+  for (auto& columns : output_columns) {
+    result.emplace_back(std::make_unique<table>(std::move(columns)));
+  }
+  return result;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<table>> batched_gather(std::vector<table_view> const& source_tables,
+                                                   std::vector<column_view> const& gather_maps,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_gather(source_tables, gather_maps, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+
+std::unique_ptr<table> gather(chunked_table_view const& input,
+                              column_view const& gather_map,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(cudf::is_index_type(gather_map.type()),
+               "Gather map must be of an index type",
+               cudf::data_type_error);
+  CUDF_EXPECTS(not gather_map.has_nulls(), "Gather map must not contain nulls");
+
+  if (input.num_chunks() == 0) { return std::make_unique<table>(); }
+  if (input.num_chunks() == 1) {
+    return cudf::detail::gather(input.chunk(0),
+                                gather_map,
+                                out_of_bounds_policy::DONT_CHECK,
+                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                stream,
+                                mr);
+  }
+  if (gather_map.is_empty()) { return empty_like(input.chunk(0)); }
+
+  auto const num_maps   = gather_map.size();
+  auto const num_chunks = input.num_chunks();
+  auto const temp_mr    = cudf::get_current_device_resource_ref();
+
+  // Route each map entry to its source chunk with a binary search over the chunk row offsets,
+  // then group the entries by chunk so each chunk is gathered exactly once
+  auto const d_offsets =
+    cudf::detail::make_device_uvector_async(input.row_offsets(), stream, temp_mr);
+  auto const map_begin = cudf::detail::indexalator_factory::make_input_iterator(gather_map);
+
+  auto chunk_indices = rmm::device_uvector<size_type>(num_maps, stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      d_offsets.begin(),
+                      d_offsets.end(),
+                      map_begin,
+                      map_begin + num_maps,
+                      chunk_indices.begin());
+
+  auto local_indices = rmm::device_uvector<size_type>(num_maps, stream);
+  auto output_order  = rmm::device_uvector<size_type>(num_maps, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_maps),
+    thrust::make_zip_iterator(local_indices.begin(), output_order.begin()),
+    [map_begin, chunks = chunk_indices.data(), offsets = d_offsets.data()] __device__(
+      size_type i) {
+      auto const chunk = chunks[i];
+      auto const base  = chunk == 0 ? 0 : offsets[chunk - 1];
+      return thrust::make_tuple(static_cast<size_type>(map_begin[i]) - base, i);
+    });
+
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream),
+    chunk_indices.begin(),
+    chunk_indices.end(),
+    thrust::make_zip_iterator(local_indices.begin(), output_order.begin()));
+
+  // Per-chunk boundaries of the grouped map entries
+  auto d_chunk_starts = rmm::device_uvector<size_type>(num_chunks, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      chunk_indices.begin(),
+                      chunk_indices.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_chunks),
+                      d_chunk_starts.begin());
+  auto const chunk_starts = cudf::detail::make_host_vector_sync(
+    device_span<size_type const>{d_chunk_starts.data(), d_chunk_starts.size()}, stream);
+
+  auto partials = std::vector<std::unique_ptr<table>>{};
+  for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+    auto const start = chunk_starts[chunk];
+    auto const end   = chunk + 1 < num_chunks ? chunk_starts[chunk + 1] : num_maps;
+    if (start == end) { continue; }
+    partials.push_back(
+      cudf::detail::gather(input.chunk(chunk),
+                           device_span<size_type const>{local_indices.data() + start,
+                                                        static_cast<std::size_t>(end - start)},
+                           out_of_bounds_policy::DONT_CHECK,
+                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                           stream,
+                           temp_mr));
+  }
+
+  auto partial_views = std::vector<table_view>{};
+  std::transform(partials.begin(),
+                 partials.end(),
+                 std::back_inserter(partial_views),
+                 [](auto const& partial) { return partial->view(); });
+  auto const grouped_rows = cudf::detail::concatenate(partial_views, stream, temp_mr);
+
+  // Undo the group-by-chunk reordering to restore the gather map's output order
+  auto inverse_order = rmm::device_uvector<size_type>(num_maps, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_maps),
+                  output_order.begin(),
+                  inverse_order.begin());
+  return cudf::detail::gather(grouped_rows->view(),
+                              device_span<size_type const>{inverse_order},
+                              out_of_bounds_policy::DONT_CHECK,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
+}
+
+}  // namespace cudf
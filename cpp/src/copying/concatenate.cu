@@ -24,6 +24,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/lists/detail/concatenate.hpp>
@@ -34,6 +35,7 @@
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -50,6 +52,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <stdexcept>
 #include <utility>
 
 namespace cudf {
@@ -557,6 +560,107 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
   return std::make_unique<table>(std::move(concat_columns));
 }
 
+column_view concatenate_into(host_span<column_view const> columns_to_concat,
+                             device_span<uint8_t> data,
+                             device_span<bitmask_type> null_mask,
+                             rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not columns_to_concat.empty(), "Unexpected empty list of columns to concatenate.");
+
+  // verify all types match and that we won't overflow size_type in output size
+  bounds_and_type_check(columns_to_concat, stream);
+
+  auto const type = columns_to_concat.front().type();
+  CUDF_EXPECTS(cudf::is_fixed_width(type),
+               "Concatenation into preallocated memory supports only fixed-width columns",
+               std::invalid_argument);
+
+  auto const total_rows = std::accumulate(
+    columns_to_concat.begin(), columns_to_concat.end(), std::size_t{0}, [](auto a, auto const& b) {
+      return a + b.size();
+    });
+  auto const width = static_cast<std::size_t>(cudf::size_of(type));
+  CUDF_EXPECTS(data.size() >= total_rows * width,
+               "Output data span is too small for the concatenated column",
+               std::invalid_argument);
+  auto const has_nulls =
+    std::any_of(columns_to_concat.begin(), columns_to_concat.end(), [](auto const& col) {
+      return col.has_nulls();
+    });
+  if (has_nulls) {
+    CUDF_EXPECTS(null_mask.size() >=
+                   static_cast<std::size_t>(
+                     num_bitmask_words(static_cast<size_type>(total_rows))),
+                 "Output null mask span is too small for the concatenated column",
+                 std::invalid_argument);
+  }
+
+  std::size_t output_offset = 0;
+  for (auto const& view : columns_to_concat) {
+    auto const bytes = static_cast<std::size_t>(view.size()) * width;
+    if (bytes > 0) {
+      CUDF_CUDA_TRY(
+        cudaMemcpyAsync(data.data() + output_offset,
+                        view.head<uint8_t>() + static_cast<std::size_t>(view.offset()) * width,
+                        bytes,
+                        cudaMemcpyDefault,
+                        stream.value()));
+    }
+    output_offset += bytes;
+  }
+
+  auto const null_count =
+    has_nulls ? detail::concatenate_masks(columns_to_concat, null_mask.data(), stream)
+              : size_type{0};
+
+  return column_view{type,
+                     static_cast<size_type>(total_rows),
+                     data.data(),
+                     has_nulls ? null_mask.data() : nullptr,
+                     null_count};
+}
+
+table_view concatenate_into(host_span<table_view const> tables_to_concat,
+                            host_span<device_span<uint8_t> const> data_buffers,
+                            host_span<device_span<bitmask_type> const> null_mask_buffers,
+                            rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not tables_to_concat.empty(), "Unexpected empty list of tables to concatenate.");
+
+  table_view const first_table = tables_to_concat.front();
+  CUDF_EXPECTS(std::all_of(tables_to_concat.begin(),
+                           tables_to_concat.end(),
+                           [&first_table](auto const& t) {
+                             return t.num_columns() == first_table.num_columns();
+                           }),
+               "Mismatch in table columns to concatenate.");
+  auto const num_columns = static_cast<std::size_t>(first_table.num_columns());
+  CUDF_EXPECTS(data_buffers.size() == num_columns and null_mask_buffers.size() == num_columns,
+               "One data buffer and one null mask buffer are required per output column",
+               std::invalid_argument);
+
+  if (num_columns == 0) { return table_view{}; }
+
+  // fan the per-column copies over the stream pool so the many small copies of a
+  // wide table overlap, then join them back to the user stream
+  auto const streams = cudf::detail::fork_streams(stream, static_cast<uint32_t>(num_columns));
+
+  std::vector<column_view> concat_columns;
+  concat_columns.reserve(num_columns);
+  for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    std::vector<column_view> cols;
+    std::transform(tables_to_concat.begin(),
+                   tables_to_concat.end(),
+                   std::back_inserter(cols),
+                   [i](auto const& t) { return t.column(i); });
+    concat_columns.push_back(
+      detail::concatenate_into(cols, data_buffers[i], null_mask_buffers[i], streams[i]));
+  }
+
+  cudf::detail::join_streams(streams, stream);
+  return table_view{concat_columns};
+}
+
 rmm::device_buffer concatenate_masks(host_span<column_view const> views,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr)
@@ -607,4 +711,22 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
   return detail::concatenate(tables_to_concat, stream, mr);
 }
 
+column_view concatenate_into(host_span<column_view const> columns_to_concat,
+                             device_span<uint8_t> data,
+                             device_span<bitmask_type> null_mask,
+                             rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate_into(columns_to_concat, data, null_mask, stream);
+}
+
+table_view concatenate_into(host_span<table_view const> tables_to_concat,
+                            host_span<device_span<uint8_t> const> data_buffers,
+                            host_span<device_span<bitmask_type> const> null_mask_buffers,
+                            rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate_into(tables_to_concat, data_buffers, null_mask_buffers, stream);
+}
+
 }  // namespace cudf
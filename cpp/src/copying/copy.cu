@@ -14,12 +14,15 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_if_else.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/copy_if_else.cuh>
@@ -311,6 +314,99 @@ struct copy_if_else_functor {
   }
 };
 
+/**
+ * @brief Word-granular copy_if_else for boolean masks with long true/false runs
+ *
+ * Reads the BOOL8 selector four bytes at a time. A selector word that is uniformly true or false
+ * becomes a straight bulk copy from one input, so per-element selection only happens in words
+ * straddling a run boundary. For the long runs produced by range filters nearly every word takes
+ * one of the bulk branches.
+ */
+template <typename T>
+CUDF_KERNEL void word_run_copy_if_else_kernel(T* __restrict__ out,
+                                              T const* __restrict__ lhs,
+                                              T const* __restrict__ rhs,
+                                              uint32_t const* __restrict__ selector_words,
+                                              size_type size)
+{
+  auto const num_words = size / 4;
+  auto const stride    = cudf::detail::grid_1d::grid_stride();
+  for (thread_index_type word = cudf::detail::grid_1d::global_thread_id(); word < num_words;
+       word += stride) {
+    auto const base      = static_cast<size_type>(word) * 4;
+    auto const byte_mask = __vcmpne4(selector_words[word], 0);
+    if (byte_mask == 0xffff'ffffu) {
+#pragma unroll
+      for (int j = 0; j < 4; ++j) {
+        out[base + j] = lhs[base + j];
+      }
+    } else if (byte_mask == 0u) {
+#pragma unroll
+      for (int j = 0; j < 4; ++j) {
+        out[base + j] = rhs[base + j];
+      }
+    } else {
+#pragma unroll
+      for (int j = 0; j < 4; ++j) {
+        out[base + j] = ((byte_mask >> (j * 8)) & 0xffu) ? lhs[base + j] : rhs[base + j];
+      }
+    }
+  }
+  // the trailing partial word, if any, is handled per element to avoid reading past the selector
+  if (cudf::detail::grid_1d::global_thread_id() == 0) {
+    auto const selector_bytes = reinterpret_cast<bool const*>(selector_words);
+    for (size_type i = num_words * 4; i < size; ++i) {
+      out[i] = selector_bytes[i] ? lhs[i] : rhs[i];
+    }
+  }
+}
+
+struct word_run_copy_if_else_fn {
+  template <typename T, CUDF_ENABLE_IF(is_rep_layout_compatible<T>())>
+  std::unique_ptr<column> operator()(column_view const& lhs,
+                                     column_view const& rhs,
+                                     column_view const& boolean_mask,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    auto const size = lhs.size();
+    auto result = make_fixed_width_column(lhs.type(), size, mask_state::UNALLOCATED, stream, mr);
+    auto const num_words = util::div_rounding_up_safe(size, size_type{4});
+    cudf::detail::grid_1d config(num_words, 256);
+    word_run_copy_if_else_kernel<T>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        result->mutable_view().data<T>(),
+        lhs.data<T>(),
+        rhs.data<T>(),
+        reinterpret_cast<uint32_t const*>(boolean_mask.data<bool>()),
+        size);
+    CUDF_CHECK_CUDA(stream.value());
+    return result;
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_rep_layout_compatible<T>())>
+  std::unique_ptr<column> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for word-run copy_if_else.");
+  }
+};
+
+/**
+ * @brief Checks whether the word-granular fast path applies
+ *
+ * The fast path requires directly-copyable values and a selector that can be read as whole
+ * aligned words: fixed-width non-decimal inputs without nulls and with zero offsets.
+ */
+bool is_word_run_eligible(column_view const& lhs,
+                          column_view const& rhs,
+                          column_view const& boolean_mask)
+{
+  return boolean_mask.size() > 0 and boolean_mask.type() == data_type(type_id::BOOL8) and
+         cudf::is_fixed_width(lhs.type()) and not cudf::is_fixed_point(lhs.type()) and
+         not lhs.has_nulls() and not rhs.has_nulls() and not boolean_mask.has_nulls() and
+         lhs.offset() == 0 and rhs.offset() == 0 and boolean_mask.offset() == 0;
+}
+
 // wrap up boolean_mask into a filter lambda
 template <typename Left, typename Right>
 std::unique_ptr<column> copy_if_else(Left const& lhs,
@@ -367,6 +463,11 @@ std::unique_ptr<column> copy_if_else(column_view const& lhs,
   CUDF_EXPECTS(
     cudf::have_same_types(lhs, rhs), "Both inputs must be of the same type", cudf::data_type_error);
 
+  if (is_word_run_eligible(lhs, rhs, boolean_mask)) {
+    return type_dispatcher(
+      lhs.type(), word_run_copy_if_else_fn{}, lhs, rhs, boolean_mask, stream, mr);
+  }
+
   return copy_if_else(lhs, rhs, lhs.has_nulls(), rhs.has_nulls(), boolean_mask, stream, mr);
 }
 
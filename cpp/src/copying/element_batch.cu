@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <stdexcept>
+
+namespace cudf {
+
+namespace {
+
+/**
+ * @brief Device-copyable description of one batched element read
+ */
+struct batch_entry {
+  uint8_t const* data;       ///< Pointer to the element bytes in device memory
+  bitmask_type const* mask;  ///< Null mask of the source column; may be null
+  size_type bit_index;       ///< Bit index of the element in the null mask
+  std::size_t offset;        ///< Byte offset of the element in the staging buffer
+  size_type width;           ///< Element size in bytes
+};
+
+}  // namespace
+
+std::size_t element_batch::add(column_view const& input, size_type index)
+{
+  CUDF_EXPECTS(not _flushed, "Cannot add elements to a batch that has already been flushed");
+  CUDF_EXPECTS(cudf::is_fixed_width(input.type()),
+               "element_batch only supports fixed-width types");
+  CUDF_EXPECTS(index >= 0 and index < input.size(), "Index out of bounds", std::out_of_range);
+  _entries.push_back(entry{input, index, _value_bytes});
+  _value_bytes += cudf::size_of(input.type());
+  return _entries.size() - 1;
+}
+
+void element_batch::flush(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _flushed, "Batch has already been flushed");
+  if (_entries.empty()) {
+    _flushed = true;
+    return;
+  }
+
+  auto h_entries = cudf::detail::make_empty_host_vector<batch_entry>(_entries.size(), stream);
+  for (auto const& e : _entries) {
+    auto const width = cudf::size_of(e.column.type());
+    h_entries.push_back(
+      batch_entry{e.column.head<uint8_t>() +
+                    static_cast<std::size_t>(e.column.offset() + e.index) * width,
+                  e.column.null_mask(),
+                  e.column.offset() + e.index,
+                  e.offset,
+                  width});
+  }
+  auto const d_entries = cudf::detail::make_device_uvector_async(
+    h_entries, stream, cudf::get_current_device_resource_ref());
+
+  // Pack the element bytes, followed by one validity byte per entry, into a single staging
+  // buffer so that a single copy transfers both.
+  auto const validity_offset = _value_bytes;
+  rmm::device_uvector<uint8_t> d_staging(_value_bytes + _entries.size(), stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<std::size_t>(0),
+                     d_entries.size(),
+                     [entries = d_entries.data(),
+                      staging = d_staging.data(),
+                      validity_offset] __device__(std::size_t i) {
+                       auto const& e = entries[i];
+                       memcpy(staging + e.offset, e.data, e.width);
+                       staging[validity_offset + i] =
+                         (e.mask == nullptr or bit_is_set(e.mask, e.bit_index)) ? 1 : 0;
+                     });
+
+  auto const h_staging = cudf::detail::make_host_vector_sync(d_staging, stream);
+  _values.assign(h_staging.begin(), h_staging.begin() + validity_offset);
+  _validity.assign(h_staging.begin() + validity_offset, h_staging.end());
+  _flushed = true;
+}
+
+bool element_batch::is_valid(std::size_t handle) const
+{
+  entry_at(handle);  // validates the handle and the flushed state
+  return _validity[handle] != 0;
+}
+
+element_batch::entry const& element_batch::entry_at(std::size_t handle) const
+{
+  CUDF_EXPECTS(_flushed, "Batch must be flushed before reading results");
+  CUDF_EXPECTS(handle < _entries.size(), "Invalid element handle", std::out_of_range);
+  return _entries[handle];
+}
+
+}  // namespace cudf
@@ -96,4 +96,19 @@ std::unique_ptr<table> gather(table_view const& source_table,
   return detail::gather(source_table, gather_map, bounds_policy, index_policy, stream, mr);
 }
 
+stream_future<std::unique_ptr<table>> gather_async(table_view const& source_table,
+                                                   column_view const& gather_map,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto index_policy = is_unsigned(gather_map.type()) ? detail::negative_index_policy::NOT_ALLOWED
+                                                     : detail::negative_index_policy::ALLOWED;
+
+  return {detail::gather(source_table, gather_map, bounds_policy, index_policy, stream, mr),
+          stream};
+}
+
 }  // namespace cudf
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/multi_device.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_device.hpp>
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cudf::experimental {
+namespace {
+
+rmm::cuda_device_id current_device()
+{
+  int device_id{};
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  return rmm::cuda_device_id{device_id};
+}
+
+/**
+ * @brief Enables direct access from the current device to memory on `peer` when the hardware
+ * supports it.
+ *
+ * Without peer access the subsequent peer copies are staged through host memory by the driver,
+ * which is correct but slower. Re-enabling access that is already enabled is not an error.
+ */
+void try_enable_peer_access(rmm::cuda_device_id peer)
+{
+  int can_access_peer{};
+  CUDF_CUDA_TRY(
+    cudaDeviceCanAccessPeer(&can_access_peer, current_device().value(), peer.value()));
+  if (not can_access_peer) { return; }
+  auto const status = cudaDeviceEnablePeerAccess(peer.value(), 0);
+  if (status == cudaErrorPeerAccessAlreadyEnabled) {
+    cudaGetLastError();  // clear the sticky error
+    return;
+  }
+  CUDF_CUDA_TRY(status);
+}
+
+/**
+ * @brief RAII wrapper for a cuda event used to order work across device streams.
+ */
+struct cuda_event {
+  cuda_event() { CUDF_CUDA_TRY(cudaEventCreateWithFlags(&event_, cudaEventDisableTiming)); }
+  ~cuda_event() { cudaEventDestroy(event_); }
+
+  cuda_event(cuda_event const&)            = delete;
+  cuda_event& operator=(cuda_event const&) = delete;
+
+  operator cudaEvent_t() const { return event_; }
+
+ private:
+  cudaEvent_t event_{};
+};
+
+}  // namespace
+
+std::vector<packed_device_table> scatter_to_devices(
+  table_view const& input,
+  column_view const& partition_map,
+  std::vector<rmm::cuda_device_id> const& devices,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not devices.empty(), "scatter_to_devices requires at least one device");
+
+  auto const source_device  = current_device();
+  auto const num_partitions = static_cast<size_type>(devices.size());
+
+  // reorder rows by destination, then serialize each partition into one contiguous buffer
+  auto [partitioned, offsets] = cudf::partition(
+    input, partition_map, num_partitions, stream, cudf::get_current_device_resource_ref());
+  auto const splits = std::vector<size_type>(offsets.begin() + 1, offsets.end() - 1);
+  auto packed       = cudf::detail::contiguous_split(
+    partitioned->view(), splits, stream, cudf::get_current_device_resource_ref());
+
+  // transfers on each destination wait for the packed buffers to be ready on `stream`
+  cuda_event packed_ready;
+  CUDF_CUDA_TRY(cudaEventRecord(packed_ready, stream.value()));
+
+  std::vector<packed_device_table> result;
+  result.reserve(devices.size());
+  for (std::size_t i = 0; i < devices.size(); ++i) {
+    auto const device = devices[i];
+    auto& data        = packed[i].data;
+    if (device.value() == source_device.value()) {
+      result.push_back(packed_device_table{device, std::move(data)});
+      continue;
+    }
+
+    try_enable_peer_access(device);
+
+    auto const size = data.gpu_data->size();
+    rmm::cuda_set_device_raii const active_device(device);
+    // the transfer runs on its own stream on the destination so copies to different devices
+    // overlap; events order it after the split and before any later work on `stream`
+    rmm::cuda_stream transfer_stream;
+    auto buffer = std::make_unique<rmm::device_buffer>(size, transfer_stream.view());
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(transfer_stream.value(), packed_ready, 0));
+    CUDF_CUDA_TRY(cudaMemcpyPeerAsync(buffer->data(),
+                                      device.value(),
+                                      data.gpu_data->data(),
+                                      source_device.value(),
+                                      size,
+                                      transfer_stream.value()));
+    cuda_event copy_done;
+    CUDF_CUDA_TRY(cudaEventRecord(copy_done, transfer_stream.value()));
+    // hand the buffer off to the destination's default stream before `transfer_stream` goes away
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(cudf::get_default_stream().value(), copy_done, 0));
+    buffer->set_stream(cudf::get_default_stream());
+    // the source-side packed buffer is freed stream-ordered on `stream`; do not let that happen
+    // before the transfer has consumed it
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(stream.value(), copy_done, 0));
+
+    result.push_back(packed_device_table{device,
+                                         packed_columns{std::move(data.metadata),
+                                                        std::move(buffer)}});
+  }
+  return result;
+}
+
+std::unique_ptr<table> gather_from_devices(host_span<packed_device_table const> tables,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not tables.empty(), "gather_from_devices requires at least one table");
+
+  auto const target_device = current_device();
+
+  // buffers staged on the current device; kept alive until the concatenate has consumed them
+  std::vector<rmm::device_buffer> staged;
+  std::vector<table_view> views;
+  staged.reserve(tables.size());
+  views.reserve(tables.size());
+  for (auto const& packed : tables) {
+    CUDF_EXPECTS(packed.data.metadata != nullptr and packed.data.gpu_data != nullptr,
+                 "Invalid packed table");
+    if (packed.device.value() == target_device.value()) {
+      views.push_back(cudf::unpack(packed.data));
+      continue;
+    }
+
+    try_enable_peer_access(packed.device);
+
+    auto const size = packed.data.gpu_data->size();
+    staged.emplace_back(size, stream, cudf::get_current_device_resource_ref());
+    CUDF_CUDA_TRY(cudaMemcpyPeerAsync(staged.back().data(),
+                                      target_device.value(),
+                                      packed.data.gpu_data->data(),
+                                      packed.device.value(),
+                                      size,
+                                      stream.value()));
+    views.push_back(cudf::unpack(packed.data.metadata->data(),
+                                 static_cast<uint8_t const*>(staged.back().data())));
+  }
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
+}  // namespace cudf::experimental
@@ -17,10 +17,19 @@
 #include <cudf/contiguous_split.hpp>
 #include <cudf/detail/contiguous_split.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <optional>
+
 namespace cudf {
 namespace detail {
 
@@ -165,6 +174,65 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
   return table_view{get_columns(num_columns)};
 }
 
+// Gaps between adjacent buffers no larger than this are treated as alignment padding
+// when deciding whether a table is already packed
+constexpr std::size_t max_buffer_alignment_gap = 256;
+
+/**
+ * @brief Collects a span for every column data and null mask buffer of `table`, in the
+ * traversal order used by `pack` and `build_column_metadata`.
+ *
+ * Returns `std::nullopt` when the buffer extents cannot be determined from the views
+ * alone (sliced columns, or a data buffer on an unexpected type).
+ */
+std::optional<std::vector<device_span<uint8_t const>>> collect_buffer_spans(
+  table_view const& table, rmm::cuda_stream_view stream)
+{
+  std::vector<device_span<uint8_t const>> spans;
+  std::function<bool(column_view const&)> add_column = [&](column_view const& col) {
+    if (col.offset() != 0) { return false; }
+    // the packed layout places a column's validity buffer ahead of its data buffer
+    if (col.size() > 0 && col.nullable()) {
+      spans.emplace_back(reinterpret_cast<uint8_t const*>(col.null_mask()),
+                         num_bitmask_words(col.size()) * sizeof(bitmask_type));
+    }
+    if (col.size() > 0 && col.head<uint8_t>() != nullptr) {
+      std::size_t data_size = 0;
+      if (col.type().id() == type_id::STRING) {
+        data_size = static_cast<std::size_t>(strings_column_view(col).chars_size(stream));
+      } else if (cudf::is_fixed_width(col.type())) {
+        data_size = static_cast<std::size_t>(col.size()) * cudf::size_of(col.type());
+      } else {
+        return false;
+      }
+      spans.emplace_back(col.head<uint8_t>(), data_size);
+    }
+    return std::all_of(col.child_begin(), col.child_end(), add_column);
+  };
+  if (!std::all_of(table.begin(), table.end(), add_column)) { return std::nullopt; }
+  return spans;
+}
+
+/**
+ * @brief Returns the single region covered by `spans` if they lie adjacent in ascending
+ * order, allowing only small alignment gaps; `std::nullopt` otherwise.
+ */
+std::optional<device_span<uint8_t const>> contiguous_region(
+  std::vector<device_span<uint8_t const>> const& spans)
+{
+  if (spans.empty()) { return std::nullopt; }
+  auto const* base = spans.front().data();
+  auto const* end  = base + spans.front().size();
+  for (std::size_t i = 1; i < spans.size(); ++i) {
+    auto const* begin = spans[i].data();
+    if (begin < end || static_cast<std::size_t>(begin - end) > max_buffer_alignment_gap) {
+      return std::nullopt;
+    }
+    end = begin + spans[i].size();
+  }
+  return device_span<uint8_t const>{base, static_cast<std::size_t>(end - base)};
+}
+
 }  // anonymous namespace
 
 /**
@@ -174,12 +242,48 @@ packed_columns pack(cudf::table_view const& input,
                     rmm::cuda_stream_view stream,
                     rmm::device_async_resource_ref mr)
 {
+  // Fast path: when the table's buffers already sit contiguously in pack order (e.g. the
+  // result of a previous unpack or single-partition contiguous_split), one copy of the
+  // region preserves the layout and the metadata offsets follow from the pointers, so the
+  // chunked copy kernel is skipped entirely
+  if (input.num_columns() > 0) {
+    if (auto const spans = collect_buffer_spans(input, stream); spans.has_value()) {
+      if (auto const region = contiguous_region(*spans); region.has_value()) {
+        auto buffer = std::make_unique<rmm::device_buffer>(
+          region->data(), region->size(), stream, mr);
+        auto builder  = metadata_builder(input.num_columns());
+        auto metadata = std::make_unique<std::vector<uint8_t>>(
+          pack_metadata(input, region->data(), region->size(), builder));
+        return packed_columns{std::move(metadata), std::move(buffer)};
+      }
+    }
+  }
+
   // do a contiguous_split with no splits to get the memory for the table
   // arranged as we want it
   auto contig_split_result = cudf::detail::contiguous_split(input, {}, stream, mr);
   return contig_split_result.empty() ? packed_columns{} : std::move(contig_split_result[0].data);
 }
 
+packed_descriptors pack_descriptors(cudf::table_view const& input, rmm::cuda_stream_view stream)
+{
+  packed_descriptors result;
+  if (input.num_columns() == 0) { return result; }
+
+  auto spans = collect_buffer_spans(input, stream);
+  CUDF_EXPECTS(spans.has_value(), "Cannot describe the buffers of a sliced table");
+  result.buffers = std::move(*spans);
+
+  if (auto const region = contiguous_region(result.buffers); region.has_value()) {
+    result.contiguous        = true;
+    result.contiguous_region = *region;
+    auto builder             = metadata_builder(input.num_columns());
+    result.metadata          = std::make_unique<std::vector<uint8_t>>(
+      pack_metadata(input, region->data(), region->size(), builder));
+  }
+  return result;
+}
+
 std::vector<uint8_t> pack_metadata(table_view const& table,
                                    uint8_t const* contiguous_buffer,
                                    size_t buffer_size,
@@ -263,6 +367,15 @@ packed_columns pack(cudf::table_view const& input, rmm::device_async_resource_re
   return detail::pack(input, cudf::get_default_stream(), mr);
 }
 
+/**
+ * @copydoc cudf::pack_descriptors
+ */
+packed_descriptors pack_descriptors(cudf::table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::pack_descriptors(input, cudf::get_default_stream());
+}
+
 /**
  * @copydoc cudf::pack_metadata
  */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy_range.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/ring_buffer_column.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+namespace cudf {
+
+ring_buffer_column::ring_buffer_column(std::unique_ptr<column>&& buffer)
+  : _buffer{std::move(buffer)}
+{
+  CUDF_EXPECTS(cudf::is_fixed_width(_buffer->type()),
+               "Ring buffer columns only support fixed-width types",
+               cudf::data_type_error);
+  CUDF_EXPECTS(
+    not _buffer->nullable(), "Ring buffer columns cannot be nullable", std::invalid_argument);
+  CUDF_EXPECTS(_buffer->size() > 0, "Ring buffer columns cannot be empty", std::invalid_argument);
+}
+
+size_type ring_buffer_column::capacity() const { return _buffer->size(); }
+
+data_type ring_buffer_column::type() const { return _buffer->type(); }
+
+void ring_buffer_column::append(column_view const& new_rows, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(new_rows.type() == _buffer->type(),
+               "Appended rows must match the ring buffer type",
+               cudf::data_type_error);
+  CUDF_EXPECTS(new_rows.size() <= capacity(),
+               "Cannot append more rows than the ring buffer capacity",
+               std::invalid_argument);
+  CUDF_EXPECTS(not new_rows.has_nulls(),
+               "Appended rows cannot contain nulls",
+               std::invalid_argument);
+  if (new_rows.is_empty()) { return; }
+
+  // The oldest rows live at the head, so the new rows overwrite the physical range
+  // [head, head + K) modulo the capacity, split into at most two in-place copies.
+  auto target          = _buffer->mutable_view();
+  auto const first_len = std::min(new_rows.size(), capacity() - _head);
+  cudf::detail::copy_range_in_place(new_rows, target, 0, first_len, _head, stream);
+  if (first_len < new_rows.size()) {
+    cudf::detail::copy_range_in_place(new_rows, target, first_len, new_rows.size(), 0, stream);
+  }
+  _head = (_head + new_rows.size()) % capacity();
+}
+
+std::vector<column_view> ring_buffer_column::segments() const
+{
+  auto const view = _buffer->view();
+  if (not is_wrapped()) { return {view}; }
+  // The buffer is non-nullable, so the sliced views can be built directly without a
+  // null-count pass.
+  return {column_view{view.type(), capacity() - _head, view.head(), nullptr, 0, _head},
+          column_view{view.type(), _head, view.head(), nullptr, 0, 0}};
+}
+
+std::unique_ptr<column> ring_buffer_column::to_column(rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  if (not is_wrapped()) { return std::make_unique<column>(_buffer->view(), stream, mr); }
+  auto const views = segments();
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
+}  // namespace cudf
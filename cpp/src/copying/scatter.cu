@@ -34,6 +34,7 @@
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -105,6 +106,55 @@ void scatter_scalar_bitmask_inplace(std::reference_wrapper<scalar const> const&
   }
 }
 
+template <typename MapIterator>
+CUDF_KERNEL void copy_validity_kernel(column_device_view source,
+                                      mutable_column_device_view target,
+                                      MapIterator scatter_map,
+                                      size_type num_scatter_rows)
+{
+  auto row          = cudf::detail::grid_1d::global_thread_id();
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+
+  while (row < num_scatter_rows) {
+    size_type const output_row = scatter_map[row];
+
+    if (source.is_valid_nocheck(row)) {
+      target.set_valid(output_row);
+    } else {
+      target.set_null(output_row);
+    }
+
+    row += stride;
+  }
+}
+
+template <typename MapIterator>
+struct column_in_place_scatterer {
+  template <typename Element, CUDF_ENABLE_IF(is_fixed_width<Element>())>
+  void operator()(column_view const& source,
+                  MapIterator scatter_iter,
+                  size_type num_scatter_rows,
+                  mutable_column_view& target,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::scatter(rmm::exec_policy_nosync(stream),
+                    source.begin<Element>(),
+                    source.begin<Element>() + num_scatter_rows,
+                    scatter_iter,
+                    target.begin<Element>());
+  }
+
+  template <typename Element, CUDF_ENABLE_IF(not is_fixed_width<Element>())>
+  void operator()(column_view const&,
+                  MapIterator,
+                  size_type,
+                  mutable_column_view&,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("In-place scatter supports only fixed-width columns", std::invalid_argument);
+  }
+};
+
 template <typename Element, typename MapIterator>
 struct column_scalar_scatterer_impl {
   std::unique_ptr<column> operator()(std::reference_wrapper<scalar const> const& source,
@@ -347,6 +397,65 @@ std::unique_ptr<table> scatter(table_view const& source,
   return detail::scatter(source, map_col, target, stream, mr);
 }
 
+void scatter_in_place(table_view const& source,
+                      column_view const& scatter_map,
+                      mutable_table_view& target,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(source.num_columns() == target.num_columns(),
+               "Number of columns in source and target not equal",
+               std::invalid_argument);
+  CUDF_EXPECTS(scatter_map.size() <= source.num_rows(),
+               "Size of scatter map must be equal to or less than source rows",
+               std::invalid_argument);
+  CUDF_EXPECTS(cudf::have_same_types(source, target),
+               "Column types do not match between source and target",
+               cudf::data_type_error);
+  CUDF_EXPECTS(not scatter_map.has_nulls(), "Scatter map contains nulls", std::invalid_argument);
+  std::for_each(thrust::counting_iterator<size_type>(0),
+                thrust::counting_iterator<size_type>(source.num_columns()),
+                [&](auto index) {
+                  CUDF_EXPECTS(not source.column(index).has_nulls() or
+                                 target.column(index).nullable(),
+                               "Target column must be nullable when the source column has nulls",
+                               std::invalid_argument);
+                });
+
+  if (scatter_map.is_empty()) { return; }
+
+  auto const map_begin        = indexalator_factory::make_input_iterator(scatter_map);
+  auto const num_scatter_rows = scatter_map.size();
+
+  constexpr size_type block_size = 256;
+  size_type const grid_size      = grid_1d(num_scatter_rows, block_size).num_blocks;
+
+  for (size_type i = 0; i < source.num_columns(); ++i) {
+    auto const& source_col = source.column(i);
+    auto target_col        = target.column(i);
+
+    type_dispatcher<dispatch_storage_type>(target_col.type(),
+                                           column_in_place_scatterer<decltype(map_begin)>{},
+                                           source_col,
+                                           map_begin,
+                                           num_scatter_rows,
+                                           target_col,
+                                           stream);
+
+    // the scattered rows are the only ones whose validity may change; rows not named
+    // by the map keep theirs, so bits are updated atomically rather than rebuilt
+    if (not target_col.nullable()) { continue; }
+    auto d_target = mutable_column_device_view::create(target_col, stream);
+    if (source_col.has_nulls()) {
+      auto d_source = column_device_view::create(source_col, stream);
+      copy_validity_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+        *d_source, *d_target, map_begin, num_scatter_rows);
+    } else {
+      marking_bitmask_kernel<true, decltype(map_begin)>
+        <<<grid_size, block_size, 0, stream.value()>>>(*d_target, map_begin, num_scatter_rows);
+    }
+  }
+}
+
 std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<scalar const>> const& source,
                                column_view const& indices,
                                table_view const& target,
@@ -525,6 +634,15 @@ std::unique_ptr<table> scatter(table_view const& source,
   return detail::scatter(source, scatter_map, target, stream, mr);
 }
 
+void scatter_in_place(table_view const& source,
+                      column_view const& scatter_map,
+                      mutable_table_view& target,
+                      rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::scatter_in_place(source, scatter_map, target, stream);
+}
+
 std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<scalar const>> const& source,
                                column_view const& indices,
                                table_view const& target,
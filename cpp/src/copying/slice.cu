@@ -26,8 +26,6 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
-#include <thrust/iterator/transform_iterator.h>
-
 #include <algorithm>
 #include <stdexcept>
 
@@ -112,18 +110,36 @@ std::vector<table_view> slice(table_view const& input,
   CUDF_EXPECTS(indices.size() % 2 == 0, "indices size must be even", std::invalid_argument);
   if (indices.empty()) { return {}; }
 
+  // One launch covering every (column, range) pair instead of a count reduction per column
+  auto const null_counts   = cudf::detail::segmented_null_counts(input, indices, stream);
+  auto const num_output_tables = indices.size() / 2;
+
   // 2d arrangement of column_views that represent the outgoing table_views sliced_table[i][j]
   // where i is the i'th column of the j'th table_view
-  auto op = [&indices, &stream](auto const& c) { return cudf::detail::slice(c, indices, stream); };
-  auto f  = thrust::make_transform_iterator(input.begin(), op);
-
-  auto sliced_table = std::vector<std::vector<cudf::column_view>>(f, f + input.num_columns());
-  sliced_table.reserve(indices.size() + 1);
+  auto sliced_table = std::vector<std::vector<cudf::column_view>>{};
+  sliced_table.reserve(input.num_columns());
+  for (size_type j = 0; j < input.num_columns(); j++) {
+    auto const& col     = input.column(j);
+    auto const children = std::vector<column_view>(col.child_begin(), col.child_end());
+    auto sliced_column  = std::vector<cudf::column_view>{};
+    sliced_column.reserve(num_output_tables);
+    for (std::size_t i = 0; i < num_output_tables; i++) {
+      auto const begin = indices[2 * i];
+      auto const end   = indices[2 * i + 1];
+      sliced_column.emplace_back(col.type(),
+                                 end - begin,
+                                 col.head(),
+                                 col.null_mask(),
+                                 null_counts[j * num_output_tables + i],
+                                 col.offset() + begin,
+                                 children);
+    }
+    sliced_table.push_back(std::move(sliced_column));
+  }
 
   std::vector<cudf::table_view> result{};
   // distribute columns into outgoing table_views
-  size_t num_output_tables = indices.size() / 2;
-  for (size_t i = 0; i < num_output_tables; i++) {
+  for (std::size_t i = 0; i < num_output_tables; i++) {
     std::vector<cudf::column_view> table_columns;
     for (size_type j = 0; j < input.num_columns(); j++) {
       table_columns.emplace_back(sliced_table[j][i]);
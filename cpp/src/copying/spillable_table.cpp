@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda_memcpy.hpp>
+#include <cudf/detail/utilities/host_vector.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <optional>
+#include <utility>
+
+namespace cudf {
+
+namespace detail {
+
+struct spillable_table_state {
+  std::unique_ptr<std::vector<uint8_t>> metadata;
+  std::unique_ptr<rmm::device_buffer> device_data;
+  std::optional<cudf::detail::host_vector<uint8_t>> host_data;
+  std::size_t num_bytes{};
+  rmm::device_async_resource_ref mr;
+};
+
+}  // namespace detail
+
+spillable_table::spillable_table(table_view const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  auto packed = detail::pack(input, stream, mr);
+  _state      = std::make_unique<detail::spillable_table_state>(detail::spillable_table_state{
+    std::move(packed.metadata), std::move(packed.gpu_data), std::nullopt, 0, mr});
+  _state->num_bytes = _state->device_data->size();
+}
+
+spillable_table::~spillable_table()                                     = default;
+spillable_table::spillable_table(spillable_table&&) noexcept            = default;
+spillable_table& spillable_table::operator=(spillable_table&&) noexcept = default;
+
+void spillable_table::spill(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (is_spilled()) { return; }
+
+  auto host_data = cudf::detail::make_pinned_vector_async<uint8_t>(_state->num_bytes, stream);
+  cudf::detail::cuda_memcpy_async<uint8_t>(
+    host_data,
+    device_span<uint8_t const>{static_cast<uint8_t const*>(_state->device_data->data()),
+                               _state->num_bytes},
+    stream);
+  _state->host_data = std::move(host_data);
+
+  // The device free is ordered on `stream`, after the copy
+  _state->device_data->set_stream(stream);
+  _state->device_data.reset();
+}
+
+void spillable_table::restore(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (not is_spilled()) { return; }
+
+  _state->device_data =
+    std::make_unique<rmm::device_buffer>(_state->num_bytes, stream, _state->mr);
+  cudf::detail::cuda_memcpy_async<uint8_t>(
+    device_span<uint8_t>{static_cast<uint8_t*>(_state->device_data->data()), _state->num_bytes},
+    *_state->host_data,
+    stream);
+
+  // The pinned host free is not stream-ordered, so wait for the copy to read from it
+  stream.synchronize();
+  _state->host_data.reset();
+}
+
+bool spillable_table::is_spilled() const { return _state->host_data.has_value(); }
+
+std::size_t spillable_table::size_bytes() const { return _state->num_bytes; }
+
+table_view spillable_table::view(rmm::cuda_stream_view stream)
+{
+  restore(stream);
+  return unpack(_state->metadata->data(), static_cast<uint8_t const*>(_state->device_data->data()));
+}
+
+}  // namespace cudf
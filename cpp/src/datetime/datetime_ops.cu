@@ -24,12 +24,15 @@
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 #include <cudf/wrappers/durations.hpp>
@@ -37,10 +40,15 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace cudf {
 namespace datetime {
 namespace detail {
@@ -101,6 +109,87 @@ struct extract_component_operator {
   }
 };
 
+// Writes every requested component from a single decomposition of each timestamp, so the
+// calendar-date computation is shared across all requested fields instead of repeated per
+// extraction pass.
+struct extract_components_functor {
+  template <typename Element>
+  std::enable_if_t<!cudf::is_timestamp_t<Element>::value, void> operator()(
+    column_view const&,
+    device_span<datetime_component const>,
+    device_span<int16_t* const>,
+    rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp_t<Timestamp>::value, void> operator()(
+    column_view const& input,
+    device_span<datetime_component const> components,
+    device_span<int16_t* const> outputs,
+    rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      input.size(),
+      [d_input = input.begin<Timestamp>(), components, outputs] __device__(size_type idx) {
+        using namespace cuda::std::chrono;
+        auto const ts               = d_input[idx];
+        auto const days_since_epoch = floor<days>(ts);
+        auto time_since_midnight    = ts - days_since_epoch;
+        if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+        // The expensive part of the decomposition, computed once for all date fields
+        auto const date = year_month_day(days_since_epoch);
+
+        auto const hrs  = duration_cast<hours>(time_since_midnight);
+        auto const mins = duration_cast<minutes>(time_since_midnight) - hrs;
+        auto const secs = duration_cast<seconds>(time_since_midnight) - hrs - mins;
+        auto const millisecs =
+          duration_cast<milliseconds>(time_since_midnight) - hrs - mins - secs;
+        auto const microsecs =
+          duration_cast<microseconds>(time_since_midnight) - hrs - mins - secs - millisecs;
+        auto const nanosecs = duration_cast<nanoseconds>(time_since_midnight) - hrs - mins - secs -
+                              millisecs - microsecs;
+
+        for (std::size_t c = 0; c < components.size(); ++c) {
+          int16_t value;
+          switch (components[c]) {
+            case datetime_component::YEAR:
+              value = static_cast<int16_t>(static_cast<int>(date.year()));
+              break;
+            case datetime_component::MONTH:
+              value = static_cast<int16_t>(static_cast<unsigned>(date.month()));
+              break;
+            case datetime_component::DAY:
+              value = static_cast<int16_t>(static_cast<unsigned>(date.day()));
+              break;
+            case datetime_component::WEEKDAY:
+              value = static_cast<int16_t>(
+                year_month_weekday(days_since_epoch).weekday().iso_encoding());
+              break;
+            case datetime_component::HOUR: value = static_cast<int16_t>(hrs.count()); break;
+            case datetime_component::MINUTE: value = static_cast<int16_t>(mins.count()); break;
+            case datetime_component::SECOND: value = static_cast<int16_t>(secs.count()); break;
+            case datetime_component::MILLISECOND:
+              value = static_cast<int16_t>(millisecs.count());
+              break;
+            case datetime_component::MICROSECOND:
+              value = static_cast<int16_t>(microsecs.count());
+              break;
+            case datetime_component::NANOSECOND:
+              value = static_cast<int16_t>(nanosecs.count());
+              break;
+            default: value = 0; break;
+          }
+          outputs[c][idx] = value;
+        }
+      });
+  }
+};
+
 // This functor takes the rounding type as runtime info and dispatches to the ceil/floor/round
 // function.
 template <typename DurationType>
@@ -569,6 +658,54 @@ std::unique_ptr<cudf::column> extract_datetime_component(cudf::column_view const
 #undef extract
 }
 
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  CUDF_EXPECTS(not components.empty(),
+               "At least one datetime component must be requested",
+               std::invalid_argument);
+
+  std::vector<std::unique_ptr<cudf::column>> outputs;
+  outputs.reserve(components.size());
+
+  if (column.size() == 0) {
+    std::generate_n(std::back_inserter(outputs), components.size(), [] {
+      return make_empty_column(type_id::INT16);
+    });
+    return std::make_unique<cudf::table>(std::move(outputs));
+  }
+
+  auto h_outputs = cudf::detail::make_empty_host_vector<int16_t*>(components.size(), stream);
+  for (std::size_t c = 0; c < components.size(); ++c) {
+    auto output = make_fixed_width_column(data_type{type_id::INT16},
+                                          column.size(),
+                                          cudf::detail::copy_bitmask(column, stream, mr),
+                                          column.null_count(),
+                                          stream,
+                                          mr);
+    h_outputs.push_back(output->mutable_view().begin<int16_t>());
+    outputs.push_back(std::move(output));
+  }
+
+  auto const d_components = cudf::detail::make_device_uvector_async(
+    components, stream, cudf::get_current_device_resource_ref());
+  auto const d_outputs = cudf::detail::make_device_uvector_async(
+    h_outputs, stream, cudf::get_current_device_resource_ref());
+
+  type_dispatcher(column.type(),
+                  extract_components_functor{},
+                  column,
+                  device_span<datetime_component const>{d_components},
+                  device_span<int16_t* const>{d_outputs},
+                  stream);
+
+  return std::make_unique<cudf::table>(std::move(outputs));
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> ceil_datetimes(column_view const& column,
@@ -663,6 +800,16 @@ std::unique_ptr<cudf::column> extract_datetime_component(cudf::column_view const
   return detail::extract_datetime_component(column, component, stream, mr);
 }
 
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  host_span<datetime_component const> components,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, stream, mr);
+}
+
 std::unique_ptr<column> extract_millisecond_fraction(column_view const& column,
                                                      rmm::cuda_stream_view stream,
                                                      rmm::device_async_resource_ref mr)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,11 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
 
 namespace cudf {
 
@@ -385,16 +390,77 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   return detail::make_timezone_transition_table(tzif_dir, timezone_name, stream, mr);
 }
 
+std::shared_ptr<table const> get_cached_timezone_transition_table(
+  std::optional<std::string_view> tzif_dir,
+  std::string_view timezone_name,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_cached_timezone_transition_table(tzif_dir, timezone_name, stream);
+}
+
+std::vector<std::shared_ptr<table const>> get_cached_timezone_transition_tables(
+  std::optional<std::string_view> tzif_dir,
+  host_span<std::string const> timezone_names,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_cached_timezone_transition_tables(tzif_dir, timezone_names, stream);
+}
+
 namespace detail {
+namespace {
 
-std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
-                                                      std::string_view timezone_name,
-                                                      rmm::cuda_stream_view stream,
-                                                      rmm::device_async_resource_ref mr)
+/**
+ * @brief Host-side transition data for a single timezone, as parsed from its TZif file.
+ *
+ * Empty vectors represent a timezone that needs no conversion (e.g. UTC); see
+ * `make_timezone_transition_table` for the entry layout.
+ */
+struct timezone_transitions {
+  std::vector<timestamp_s::rep> times;
+  std::vector<duration_s::rep> offsets;
+};
+
+struct timezone_data_cache {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::shared_ptr<timezone_transitions const>> entries;
+
+  static timezone_data_cache& instance()
+  {
+    static timezone_data_cache cache;
+    return cache;
+  }
+
+  // The same zone name can resolve to different files in different TZif directories
+  static std::string make_key(std::optional<std::string_view> tzif_dir,
+                              std::string_view timezone_name)
+  {
+    return std::string{tzif_dir.value_or("")} + '\0' + std::string{timezone_name};
+  }
+
+  std::shared_ptr<timezone_transitions const> find(std::string const& key)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto const it = entries.find(key);
+    return it != entries.end() ? it->second : nullptr;
+  }
+
+  std::shared_ptr<timezone_transitions const> insert(
+    std::string key, std::shared_ptr<timezone_transitions const> transitions)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Keep the first inserted entry if another thread parsed the same zone concurrently
+    return entries.try_emplace(std::move(key), std::move(transitions)).first->second;
+  }
+};
+
+timezone_transitions build_timezone_transitions(std::optional<std::string_view> tzif_dir,
+                                                std::string_view timezone_name)
 {
   if (timezone_name == "UTC" || timezone_name.empty()) {
-    // Return an empty table for UTC
-    return std::make_unique<cudf::table>();
+    // No conversion needed for UTC
+    return {};
   }
 
   timezone_file const tzf(tzif_dir, timezone_name);
@@ -425,7 +491,7 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
     if (tzf.typecnt() == 0 || tzf.ttype[0].utcoff == 0) {
       // No transitions, offset is zero; Table would be a no-op.
       // Return an empty table to speed up parsing.
-      return std::make_unique<cudf::table>();
+      return {};
     }
     // No transitions to use for the time/offset - use the first offset and apply to all timestamps
     transition_times[0] = std::numeric_limits<int64_t>::max();
@@ -482,15 +548,26 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   CUDF_EXPECTS(transition_times.size() == offsets.size(),
                "Error reading TZif file for timezone " + std::string{timezone_name});
 
-  auto ttimes_typed = make_empty_host_vector<timestamp_s>(transition_times.size(), stream);
-  std::transform(transition_times.cbegin(),
-                 transition_times.cend(),
+  return {std::move(transition_times), std::move(offsets)};
+}
+
+std::unique_ptr<table> make_transition_table(timezone_transitions const& transitions,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  // Empty transition data means the timezone needs no conversion
+  if (transitions.times.empty()) { return std::make_unique<cudf::table>(); }
+
+  auto ttimes_typed = make_empty_host_vector<timestamp_s>(transitions.times.size(), stream);
+  std::transform(transitions.times.cbegin(),
+                 transitions.times.cend(),
                  std::back_inserter(ttimes_typed),
                  [](auto ts) { return timestamp_s{duration_s{ts}}; });
-  auto offsets_typed = make_empty_host_vector<duration_s>(offsets.size(), stream);
-  std::transform(offsets.cbegin(), offsets.cend(), std::back_inserter(offsets_typed), [](auto ts) {
-    return duration_s{ts};
-  });
+  auto offsets_typed = make_empty_host_vector<duration_s>(transitions.offsets.size(), stream);
+  std::transform(transitions.offsets.cbegin(),
+                 transitions.offsets.cend(),
+                 std::back_inserter(offsets_typed),
+                 [](auto ts) { return duration_s{ts}; });
 
   auto d_ttimes  = cudf::detail::make_device_uvector_async(ttimes_typed, stream, mr);
   auto d_offsets = cudf::detail::make_device_uvector_async(offsets_typed, stream, mr);
@@ -501,11 +578,96 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   tz_table_columns.emplace_back(
     std::make_unique<cudf::column>(std::move(d_offsets), rmm::device_buffer{}, 0));
 
-  // Need to finish copies before transition_times and offsets go out of scope
+  // Need to finish copies before the staging host vectors go out of scope
   stream.synchronize();
 
   return std::make_unique<cudf::table>(std::move(tz_table_columns));
 }
 
+}  // namespace
+
+std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                      std::string_view timezone_name,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  return make_transition_table(build_timezone_transitions(tzif_dir, timezone_name), stream, mr);
+}
+
+std::shared_ptr<table const> get_cached_timezone_transition_table(
+  std::optional<std::string_view> tzif_dir,
+  std::string_view timezone_name,
+  rmm::cuda_stream_view stream)
+{
+  auto& cache      = timezone_data_cache::instance();
+  auto key         = timezone_data_cache::make_key(tzif_dir, timezone_name);
+  auto transitions = cache.find(key);
+  if (transitions == nullptr) {
+    // Parse outside of the lock so that misses on different zones do not serialize
+    transitions = cache.insert(std::move(key),
+                               std::make_shared<timezone_transitions const>(
+                                 build_timezone_transitions(tzif_dir, timezone_name)));
+  }
+  // Only host-side data is cached; the device table is built per call so that it resides on the
+  // caller's current device and is allocated from the caller's current memory resource
+  return make_transition_table(*transitions, stream, cudf::get_current_device_resource_ref());
+}
+
+std::vector<std::shared_ptr<table const>> get_cached_timezone_transition_tables(
+  std::optional<std::string_view> tzif_dir,
+  host_span<std::string const> timezone_names,
+  rmm::cuda_stream_view stream)
+{
+  auto& cache = timezone_data_cache::instance();
+
+  std::vector<std::string> keys;
+  keys.reserve(timezone_names.size());
+  std::transform(
+    timezone_names.begin(), timezone_names.end(), std::back_inserter(keys), [&](auto const& name) {
+      return timezone_data_cache::make_key(tzif_dir, name);
+    });
+
+  // Look up all requested zones under a single acquisition of the cache lock
+  std::vector<std::shared_ptr<timezone_transitions const>> transitions(timezone_names.size());
+  std::vector<size_t> missing;
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (size_t i = 0; i < timezone_names.size(); ++i) {
+      auto const it = cache.entries.find(keys[i]);
+      if (it != cache.entries.end()) {
+        transitions[i] = it->second;
+      } else {
+        missing.push_back(i);
+      }
+    }
+  }
+
+  // Parse each missing zone once, sharing the data between duplicate names
+  for (auto const i : missing) {
+    if (transitions[i]) { continue; }
+    auto built = std::make_shared<timezone_transitions const>(
+      build_timezone_transitions(tzif_dir, timezone_names[i]));
+    for (auto const j : missing) {
+      if (keys[j] == keys[i]) { transitions[j] = built; }
+    }
+  }
+  for (auto const i : missing) {
+    transitions[i] = cache.insert(std::move(keys[i]), std::move(transitions[i]));
+  }
+
+  // Upload each distinct zone once per call; duplicate names share the resulting device table
+  std::unordered_map<timezone_transitions const*, std::shared_ptr<table const>> uploaded;
+  std::vector<std::shared_ptr<table const>> tables(timezone_names.size());
+  for (size_t i = 0; i < timezone_names.size(); ++i) {
+    auto& entry = uploaded[transitions[i].get()];
+    if (entry == nullptr) {
+      entry =
+        make_transition_table(*transitions[i], stream, cudf::get_current_device_resource_ref());
+    }
+    tables[i] = entry;
+  }
+  return tables;
+}
+
 }  // namespace detail
 }  // namespace cudf
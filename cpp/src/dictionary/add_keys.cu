@@ -15,7 +15,9 @@
  */
 
 #include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
@@ -32,6 +34,9 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 #include <cudf/utilities/type_checks.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <optional>
 
 namespace cudf {
 namespace dictionary {
@@ -56,6 +61,67 @@ std::unique_ptr<column> add_keys(dictionary_column_view const& dictionary_column
   auto old_keys = dictionary_column.keys();  // [a,b,c,d,f]
   CUDF_EXPECTS(
     cudf::have_same_types(new_keys, old_keys), "Keys must be the same type", cudf::data_type_error);
+
+  // When every novel key sorts after the existing keys (e.g. slowly growing enum columns whose
+  // new values are always larger), the novel keys can simply be appended to the key set without
+  // disturbing the existing ordering, and the indices column is copied as-is instead of being
+  // rebuilt through a search-and-gather pass over every row.
+  if (old_keys.size() > 0 && new_keys.size() > 0) {
+    auto const temp_mr      = cudf::get_current_device_resource_ref();
+    auto const distinct_new = cudf::detail::distinct(table_view{{new_keys}},
+                                                     std::vector<size_type>{0},
+                                                     duplicate_keep_option::KEEP_ANY,
+                                                     null_equality::EQUAL,
+                                                     nan_equality::ALL_EQUAL,
+                                                     stream,
+                                                     temp_mr);
+    auto const is_known =
+      cudf::detail::contains(old_keys, distinct_new->view().column(0), stream, temp_mr);
+    auto const is_novel =
+      cudf::detail::unary_operation(is_known->view(), unary_operator::NOT, stream, temp_mr);
+    auto const novel = cudf::detail::apply_boolean_mask(
+      distinct_new->view(), is_novel->view(), std::nullopt, stream, temp_mr);
+
+    // no novel keys: the dictionary is unchanged
+    if (novel->num_rows() == 0) {
+      return std::make_unique<column>(dictionary_column.parent(), stream, mr);
+    }
+
+    // the existing indices (kept at their current width) must be able to address the grown key set
+    auto const grown_size = old_keys.size() + novel->num_rows();
+    auto const indices_fit =
+      cudf::size_of(dictionary_column.indices().type()) >=
+      cudf::size_of(get_indices_type_for_size(grown_size));
+    auto const sorted_novel = cudf::detail::sort(
+      novel->view(), {order::ASCENDING}, {null_order::AFTER}, stream, temp_mr);
+    // the smallest novel key is past the end of the old keys iff all novel keys append cleanly
+    auto const first_novel =
+      cudf::detail::slice(sorted_novel->view().column(0), {0, 1}, stream).front();
+    auto const bound = cudf::detail::lower_bound(table_view{{old_keys}},
+                                                 table_view{{first_novel}},
+                                                 {order::ASCENDING},
+                                                 {null_order::AFTER},
+                                                 stream,
+                                                 temp_mr);
+    if (indices_fit &&
+        cudf::detail::get_value<size_type>(bound->view(), 0, stream) == old_keys.size()) {
+      auto keys_column = cudf::detail::concatenate(
+        std::vector<column_view>{old_keys, sorted_novel->view().column(0)}, stream, mr);
+      column_view indices_view(dictionary_column.indices().type(),
+                               dictionary_column.size(),
+                               dictionary_column.indices().head(),
+                               nullptr,
+                               0,
+                               dictionary_column.offset());
+      auto indices_column = std::make_unique<column>(indices_view, stream, mr);
+      return make_dictionary_column(
+        std::move(keys_column),
+        std::move(indices_column),
+        cudf::detail::copy_bitmask(dictionary_column.parent(), stream, mr),
+        dictionary_column.null_count());
+    }
+  }
+
   // first, concatenate the keys together
   // [a,b,c,d,f] + [d,b,e] = [a,b,c,d,f,d,b,e]
   auto combined_keys = cudf::detail::concatenate(
@@ -16,8 +16,12 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/merge.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/dictionary/detail/encode.hpp>
@@ -31,6 +35,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <optional>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -71,6 +77,72 @@ std::unique_ptr<column> encode(column_view const& input_column,
                                 input_column.null_count());
 }
 
+/**
+ * @copydoc cudf::dictionary::encode(column_view const&,column_view const&,data_type,
+ * rmm::cuda_stream_view,rmm::device_async_resource_ref)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> encode(column_view const& input_column,
+                               column_view const& existing_keys,
+                               data_type indices_type,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(is_signed(indices_type) && is_index_type(indices_type),
+               "indices must be type signed integer");
+  CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
+               "cannot encode a dictionary from a dictionary");
+  CUDF_EXPECTS(input_column.type() == existing_keys.type(),
+               "keys must match the type of the column to encode");
+  CUDF_EXPECTS(not existing_keys.has_nulls(), "keys must not contain nulls");
+
+  auto const temp_mr = cudf::get_current_device_resource_ref();
+
+  // distinct values of this batch that the existing keys do not already cover
+  auto const batch_keys = cudf::detail::distinct(table_view{{input_column}},
+                                                 {0},
+                                                 duplicate_keep_option::KEEP_ANY,
+                                                 null_equality::EQUAL,
+                                                 nan_equality::ALL_EQUAL,
+                                                 stream,
+                                                 temp_mr);
+  auto const is_known =
+    cudf::detail::contains(existing_keys, batch_keys->view().column(0), stream, temp_mr);
+  auto const is_novel =
+    cudf::detail::unary_operation(is_known->view(), unary_operator::NOT, stream, temp_mr);
+  // a null batch value carries a null flag here and is filtered out along with the known keys
+  auto const novel = cudf::detail::apply_boolean_mask(
+    batch_keys->view(), is_novel->view(), std::nullopt, stream, temp_mr);
+
+  // merge the sorted novel keys into the already-sorted key set instead of re-sorting the union
+  auto keys_column = [&]() -> std::unique_ptr<column> {
+    if (novel->num_rows() == 0) { return std::make_unique<column>(existing_keys, stream, mr); }
+    auto const sorted_novel = cudf::detail::sort(
+      novel->view(), {order::ASCENDING}, {null_order::AFTER}, stream, temp_mr);
+    auto merged = cudf::detail::merge({table_view{{existing_keys}}, sorted_novel->view()},
+                                      {0},
+                                      {order::ASCENDING},
+                                      {},
+                                      stream,
+                                      mr);
+    return std::move(merged->release().front());
+  }();
+
+  // map each input row to its position in the merged keys
+  auto indices_column = cudf::detail::lower_bound(table_view{{keys_column->view()}},
+                                                  table_view{{input_column}},
+                                                  {order::ASCENDING},
+                                                  {null_order::AFTER},
+                                                  stream,
+                                                  mr);
+
+  return make_dictionary_column(std::move(keys_column),
+                                std::move(indices_column),
+                                cudf::detail::copy_bitmask(input_column, stream, mr),
+                                input_column.null_count());
+}
+
 /**
  * @copydoc cudf::dictionary::detail::get_indices_type_for_size
  */
@@ -94,5 +166,15 @@ std::unique_ptr<column> encode(column_view const& input_column,
   return detail::encode(input_column, indices_type, stream, mr);
 }
 
+std::unique_ptr<column> encode(column_view const& input_column,
+                               column_view const& existing_keys,
+                               data_type indices_type,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::encode(input_column, existing_keys, indices_type, stream, mr);
+}
+
 }  // namespace dictionary
 }  // namespace cudf
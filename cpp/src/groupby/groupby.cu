@@ -26,6 +26,7 @@
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
@@ -149,6 +150,11 @@ struct empty_column_constructor {
       return std::get<std::unique_ptr<column>>(udf_ptr->get_empty_output(std::nullopt, stream, mr));
     }
 
+    if constexpr (k == aggregation::Kind::PTX or k == aggregation::Kind::CUDA) {
+      auto const& udf_agg = dynamic_cast<cudf::detail::udf_aggregation const&>(agg);
+      return make_empty_column(udf_agg._output_type);
+    }
+
     return make_empty_column(target_type(values.type(), k));
   }
 };
@@ -203,6 +209,46 @@ void verify_valid_requests(host_span<RequestType const> requests)
     "Invalid type/aggregation combination.");
 }
 
+/**
+ * @brief Creates the aggregation that merges partial results of the given aggregation.
+ *
+ * @throws cudf::logic_error If partial results of `agg` cannot be merged
+ */
+std::unique_ptr<groupby_aggregation> to_merge_aggregation(aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::SUM: return make_sum_aggregation<groupby_aggregation>();
+    case aggregation::PRODUCT: return make_product_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return make_max_aggregation<groupby_aggregation>();
+    // Partial counts merge by addition
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return make_sum_aggregation<groupby_aggregation>();
+    case aggregation::M2:
+    case aggregation::MERGE_M2: return make_merge_m2_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_LIST:
+    case aggregation::MERGE_LISTS: return make_merge_lists_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_SET: {
+      auto const& collect_agg = dynamic_cast<cudf::detail::collect_set_aggregation const&>(agg);
+      return make_merge_sets_aggregation<groupby_aggregation>(collect_agg._nulls_equal,
+                                                              collect_agg._nans_equal);
+    }
+    case aggregation::MERGE_SETS: {
+      auto const& merge_agg = dynamic_cast<cudf::detail::merge_sets_aggregation const&>(agg);
+      return make_merge_sets_aggregation<groupby_aggregation>(merge_agg._nulls_equal,
+                                                              merge_agg._nans_equal);
+    }
+    case aggregation::HISTOGRAM:
+    case aggregation::MERGE_HISTOGRAM: return make_merge_histogram_aggregation<groupby_aggregation>();
+    case aggregation::TDIGEST:
+      return make_merge_tdigest_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::tdigest_aggregation const&>(agg).max_centroids);
+    case aggregation::MERGE_TDIGEST:
+      return make_merge_tdigest_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::merge_tdigest_aggregation const&>(agg).max_centroids);
+    default: CUDF_FAIL("Aggregation kind has no merge counterpart");
+  }
+}
 }  // namespace
 
 // Compute aggregation requests
@@ -225,6 +271,39 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggr
   return dispatch_aggregation(requests, stream, mr);
 }
 
+// Merge partial aggregation results
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::merge(
+  host_span<aggregation_request const> requests,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  std::vector<aggregation_request> merge_requests;
+  for (auto const& request : requests) {
+    CUDF_EXPECTS(request.aggregations.size() == 1,
+                 "Each merge request must carry exactly one aggregation");
+    auto& merge_request  = merge_requests.emplace_back();
+    merge_request.values = request.values;
+    merge_request.aggregations.push_back(to_merge_aggregation(*request.aggregations.front()));
+  }
+
+  auto [unique_keys, merge_results] = aggregate(merge_requests, stream, mr);
+
+  // Partial counts merge via SUM, which widens the result; restore the original count type
+  for (std::size_t i = 0; i < merge_requests.size(); ++i) {
+    auto const kind = requests[i].aggregations.front()->kind;
+    if (kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL) {
+      auto& result = merge_results[i].results.front();
+      if (result->type() != requests[i].values.type()) {
+        result = cudf::detail::cast(result->view(), requests[i].values.type(), stream, mr);
+      }
+    }
+  }
+
+  return {std::move(unique_keys), std::move(merge_results)};
+}
+
 // Compute scan requests
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::scan(
   host_span<scan_request const> requests,
@@ -25,12 +25,32 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <cstdlib>
 #include <memory>
 #include <tuple>
 #include <unordered_set>
 #include <vector>
 
 namespace cudf::groupby::detail::hash {
+namespace {
+
+/**
+ * @brief Checks if the single-pass variance computation has been enabled via the environment
+ * variable `LIBCUDF_GROUPBY_SINGLE_PASS_VAR`.
+ *
+ * When enabled, VARIANCE and STD flatten to SUM, COUNT_VALID and SUM_OF_SQUARES so that the
+ * finalizer can compute the variance per group without an extra pass over the input rows, at the
+ * cost of some numerical stability for inputs with a large mean-to-variance ratio.
+ *
+ * @return true if single-pass variance has been enabled
+ */
+[[nodiscard]] bool is_single_pass_var_enabled()
+{
+  static bool const enabled = []() { return std::getenv("LIBCUDF_GROUPBY_SINGLE_PASS_VAR"); }();
+  return enabled;
+}
+
+}  // namespace
 
 class groupby_simple_aggregations_collector final
   : public cudf::detail::simple_aggregations_collector {
@@ -75,6 +95,7 @@ class groupby_simple_aggregations_collector final
     aggs.push_back(make_sum_aggregation());
     // COUNT_VALID
     aggs.push_back(make_count_aggregation());
+    if (is_single_pass_var_enabled()) { aggs.push_back(make_sum_of_squares_aggregation()); }
 
     return aggs;
   }
@@ -86,6 +107,7 @@ class groupby_simple_aggregations_collector final
     aggs.push_back(make_sum_aggregation());
     // COUNT_VALID
     aggs.push_back(make_count_aggregation());
+    if (is_single_pass_var_enabled()) { aggs.push_back(make_sum_of_squares_aggregation()); }
 
     return aggs;
   }
@@ -173,12 +173,29 @@ void hash_compound_agg_finalizer<SetType>::visit(cudf::detail::var_aggregation c
   cudf::detail::initialize_with_identity(
     var_table_view, host_span<cudf::aggregation::Kind const>(&agg.kind, 1), stream);
 
-  thrust::for_each_n(
-    rmm::exec_policy_nosync(stream),
-    thrust::make_counting_iterator(0),
-    col.size(),
-    var_hash_functor{
-      set, row_bitmask, *var_result_view, *values_view, *sum_view, *count_view, agg._ddof});
+  auto sum_of_squares_agg = make_sum_of_squares_aggregation();
+  if (sparse_results->has_result(col, *sum_of_squares_agg)) {
+    // Single-pass variance: all three partial sums were computed in the main map-probe pass, so
+    // the variance can be finalized with one sweep over the group slots
+    column_view sum_of_squares_result = sparse_results->get_result(col, *sum_of_squares_agg);
+    auto sum_of_squares_view = column_device_view::create(sum_of_squares_result, stream);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator(0),
+                       col.size(),
+                       var_from_sums_functor{*var_result_view,
+                                             *values_view,
+                                             *sum_view,
+                                             *sum_of_squares_view,
+                                             *count_view,
+                                             agg._ddof});
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator(0),
+      col.size(),
+      var_hash_functor{
+        set, row_bitmask, *var_result_view, *values_view, *sum_view, *count_view, agg._ddof});
+  }
   sparse_results->add_result(col, agg, std::move(var_result));
   dense_results->add_result(col, agg, to_dense_agg_result(agg));
 }
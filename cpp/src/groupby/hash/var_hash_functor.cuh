@@ -105,4 +105,67 @@ struct var_hash_functor {
     }
   }
 };
+
+/**
+ * @brief Computes the variance of each group from its single-pass SUM, COUNT_VALID and
+ * SUM_OF_SQUARES results.
+ *
+ * Unlike `var_hash_functor`, this functor runs once per sparse group slot and never touches the
+ * hash set or the input rows, so variance costs no extra pass over the input. The sum-of-squares
+ * identity is numerically less stable than the two-pass formula, hence this path is only taken
+ * when `LIBCUDF_GROUPBY_SINGLE_PASS_VAR` is set.
+ */
+struct var_from_sums_functor {
+  mutable_column_device_view target;
+  column_device_view source;
+  column_device_view sum;
+  column_device_view sum_of_squares;
+  column_device_view count;
+  size_type ddof;
+
+  template <typename Source>
+  constexpr static bool is_supported()
+  {
+    return is_numeric<Source>() && !is_fixed_point<Source>();
+  }
+
+  template <typename Source>
+  __device__ cuda::std::enable_if_t<!is_supported<Source>()> operator()(size_type) noexcept
+  {
+    CUDF_UNREACHABLE("Invalid source type for std, var aggregation combination.");
+  }
+
+  template <typename Source>
+  __device__ cuda::std::enable_if_t<is_supported<Source>()> operator()(
+    size_type target_index) noexcept
+  {
+    using Target    = cudf::detail::target_type_t<Source, aggregation::VARIANCE>;
+    using SumType   = cudf::detail::target_type_t<Source, aggregation::SUM>;
+    using SumSqType = cudf::detail::target_type_t<Source, aggregation::SUM_OF_SQUARES>;
+    using CountType = cudf::detail::target_type_t<Source, aggregation::COUNT_VALID>;
+
+    CountType group_size = count.element<CountType>(target_index);
+    if (group_size == 0 or group_size - ddof <= 0) return;
+
+    auto const s  = static_cast<Target>(sum.element<SumType>(target_index));
+    auto const s2 = static_cast<Target>(sum_of_squares.element<SumSqType>(target_index));
+    Target result = (s2 - s * s / group_size) / (group_size - ddof);
+    // Guard against small negative results caused by floating point cancellation
+    if (result < Target{0}) { result = Target{0}; }
+    target.element<Target>(target_index) = result;
+    // STD sqrt is applied in finalize()
+
+    if (target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+
+  __device__ inline void operator()(size_type target_index)
+  {
+    auto source_type = source.type();
+    if (source_type.id() == type_id::DICTIONARY32) {
+      source_type = source.child(cudf::dictionary_column_view::keys_column_index).type();
+    }
+
+    type_dispatcher(source_type, *this, target_index);
+  }
+};
 }  // namespace cudf::groupby::detail::hash
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The UDF calling convention (and the operation-udf.hpp override hook) is shared with the
+// rolling window JIT kernel.
+#include "rolling/jit/operation.hpp"
+
+#include <cudf/types.hpp>
+
+namespace cudf {
+namespace groupby {
+namespace jit {
+
+template <typename InType, typename OutType, class agg_op>
+CUDF_KERNEL void gpu_group_udf(cudf::size_type num_groups,
+                               cudf::size_type const* const __restrict__ group_offsets,
+                               InType const* const __restrict__ in_col,
+                               OutType* __restrict__ out_col)
+{
+  cudf::thread_index_type i            = blockIdx.x * blockDim.x + threadIdx.x;
+  cudf::thread_index_type const stride = blockDim.x * gridDim.x;
+
+  while (i < num_groups) {
+    cudf::size_type const start = group_offsets[i];
+    cudf::size_type const count = group_offsets[i + 1] - start;
+    out_col[i]                  = agg_op::template operate<OutType, InType>(in_col, start, count);
+    i += stride;
+  }
+}
+
+}  // namespace jit
+}  // namespace groupby
+}  // namespace cudf
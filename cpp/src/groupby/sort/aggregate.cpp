@@ -21,17 +21,20 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/aggregation/host_udf.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/aggregation/result_cache.hpp>
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/lists/detail/stream_compaction.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -397,10 +400,9 @@ void aggregate_result_functor::operator()<aggregation::NUNIQUE>(aggregation cons
 
   auto& nunique_agg = dynamic_cast<cudf::detail::nunique_aggregation const&>(agg);
 
-  auto result = detail::group_nunique(get_sorted_values(),
+  auto result = detail::group_nunique(get_grouped_values(),
                                       helper.group_labels(stream),
                                       helper.num_groups(stream),
-                                      helper.group_offsets(stream),
                                       nunique_agg._null_handling,
                                       stream,
                                       mr);
@@ -599,6 +601,121 @@ void aggregate_result_functor::operator()<aggregation::MERGE_HISTOGRAM>(aggregat
  * @brief Perform covariance between two child columns of non-nullable struct column.
  *
  */
+namespace {
+/**
+ * @brief Gathers the payload children of the rows selected by a grouped ARGMAX/ARGMIN result
+ *
+ * The selection indices refer to original (ungrouped) rows; groups whose ordering values are all
+ * null select no row and produce a null struct row.
+ */
+std::unique_ptr<column> gather_payload_by_selection(column_view const& values,
+                                                    column const& selection,
+                                                    size_type num_groups,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::device_async_resource_ref mr)
+{
+  auto const original = structs_column_view{values};
+  std::vector<column_view> payload;
+  for (size_type i = 1; i < original.num_children(); ++i) {
+    payload.push_back(original.get_sliced_child(i, stream));
+  }
+
+  // Compute the gather without the null mask in the map, nullifying unmatched rows instead
+  column_view const null_removed_map(
+    data_type(type_to_id<size_type>()),
+    selection.size(),
+    static_cast<void const*>(selection.view().template data<size_type>()),
+    nullptr,
+    0);
+  auto gathered =
+    cudf::detail::gather(table_view{payload},
+                         null_removed_map,
+                         selection.view().nullable() ? cudf::out_of_bounds_policy::NULLIFY
+                                                     : cudf::out_of_bounds_policy::DONT_CHECK,
+                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                         stream,
+                         mr);
+  auto const null_count = selection.null_count();
+  auto null_mask        = null_count > 0 ? cudf::detail::copy_bitmask(selection.view(), stream, mr)
+                                         : rmm::device_buffer{};
+  return make_structs_column(
+    num_groups, gathered->release(), null_count, std::move(null_mask), stream, mr);
+}
+}  // namespace
+
+template <>
+void aggregate_result_functor::operator()<aggregation::MAX_BY>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+  CUDF_EXPECTS(values.type().id() == type_id::STRUCT,
+               "Input to `groupby max_by` must be a structs column.");
+  CUDF_EXPECTS(values.num_children() >= 2,
+               "Input to `groupby max_by` must be a structs column with an ordering child and at "
+               "least one payload child.");
+
+  auto const grouped     = structs_column_view{get_grouped_values()};
+  auto const order_child = grouped.get_sliced_child(0, stream);
+  auto const selection   = detail::group_argmax(order_child,
+                                              helper.num_groups(stream),
+                                              helper.group_labels(stream),
+                                              helper.key_sort_order(stream),
+                                              stream,
+                                              cudf::get_current_device_resource_ref());
+  cache.add_result(
+    values,
+    agg,
+    gather_payload_by_selection(values, *selection, helper.num_groups(stream), stream, mr));
+}
+
+template <>
+void aggregate_result_functor::operator()<aggregation::MIN_BY>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+  CUDF_EXPECTS(values.type().id() == type_id::STRUCT,
+               "Input to `groupby min_by` must be a structs column.");
+  CUDF_EXPECTS(values.num_children() >= 2,
+               "Input to `groupby min_by` must be a structs column with an ordering child and at "
+               "least one payload child.");
+
+  auto const grouped     = structs_column_view{get_grouped_values()};
+  auto const order_child = grouped.get_sliced_child(0, stream);
+  auto const selection   = detail::group_argmin(order_child,
+                                              helper.num_groups(stream),
+                                              helper.group_labels(stream),
+                                              helper.key_sort_order(stream),
+                                              stream,
+                                              cudf::get_current_device_resource_ref());
+  cache.add_result(
+    values,
+    agg,
+    gather_payload_by_selection(values, *selection, helper.num_groups(stream), stream, mr));
+}
+
+template <>
+void aggregate_result_functor::operator()<aggregation::TOP_K_BY>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+  CUDF_EXPECTS(values.type().id() == type_id::STRUCT,
+               "Input to `groupby top_k_by` must be a structs column.");
+  CUDF_EXPECTS(values.num_children() >= 2,
+               "Input to `groupby top_k_by` must be a structs column with an ordering child and "
+               "at least one payload child.");
+
+  auto const& top_k_agg = dynamic_cast<cudf::detail::top_k_by_aggregation const&>(agg);
+  CUDF_EXPECTS(top_k_agg._k > 0, "`groupby top_k_by` requires a positive k.");
+
+  cache.add_result(values,
+                   agg,
+                   detail::group_top_k_by(get_grouped_values(),
+                                          helper.group_offsets(stream),
+                                          helper.group_labels(stream),
+                                          helper.num_groups(stream),
+                                          top_k_agg._k,
+                                          top_k_agg._order,
+                                          stream,
+                                          mr));
+}
+
 template <>
 void aggregate_result_functor::operator()<aggregation::COVARIANCE>(aggregation const& agg)
 {
@@ -790,6 +907,27 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                               mr));
 }
 
+template <>
+void aggregate_result_functor::operator()<aggregation::PTX>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  cache.add_result(values,
+                   agg,
+                   detail::group_udf(get_grouped_values(),
+                                     helper.group_offsets(stream),
+                                     helper.num_groups(stream),
+                                     agg,
+                                     stream,
+                                     mr));
+}
+
+template <>
+void aggregate_result_functor::operator()<aggregation::CUDA>(aggregation const& agg)
+{
+  operator()<aggregation::PTX>(agg);
+}
+
 template <>
 void aggregate_result_functor::operator()<aggregation::HOST_UDF>(aggregation const& agg)
 {
@@ -15,7 +15,10 @@
  */
 
 #include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -24,59 +27,51 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cuco/static_set.cuh>
+#include <cuda/atomic>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
-#include <thrust/iterator/discard_iterator.h>
-#include <thrust/iterator/transform_iterator.h>
-#include <thrust/reduce.h>
 
 namespace cudf {
 namespace groupby {
 namespace detail {
 namespace {
 
-template <bool has_nested_columns, typename Nullate>
-struct is_unique_iterator_fn {
-  using comparator_type =
-    typename cudf::experimental::row::equality::device_row_comparator<has_nested_columns, Nullate>;
-
-  Nullate nulls;
-  column_device_view const v;
-  comparator_type equal;
-  null_policy null_handling;
-  size_type const* group_offsets;
+/**
+ * @brief Hashes the composite (group label, value row) key for a row index.
+ */
+template <typename RowHasher>
+struct group_value_hasher {
+  RowHasher d_hasher;
   size_type const* group_labels;
 
-  is_unique_iterator_fn(Nullate nulls,
-                        column_device_view const& v,
-                        comparator_type const& equal,
-                        null_policy null_handling,
-                        size_type const* group_offsets,
-                        size_type const* group_labels)
-    : nulls{nulls},
-      v{v},
-      equal{equal},
-      null_handling{null_handling},
-      group_offsets{group_offsets},
-      group_labels{group_labels}
+  __device__ hash_value_type operator()(size_type i) const noexcept
   {
+    return cudf::hashing::detail::hash_combine(d_hasher(i),
+                                               static_cast<hash_value_type>(group_labels[i]));
   }
+};
+
+/**
+ * @brief Compares two row indices as composite (group label, value row) keys.
+ */
+template <typename RowEqual>
+struct group_value_equal {
+  RowEqual d_equal;
+  size_type const* group_labels;
 
-  __device__ size_type operator()(size_type i) const
+  __device__ bool operator()(size_type lhs, size_type rhs) const noexcept
   {
-    auto const is_input_countable =
-      !nulls || (null_handling == null_policy::INCLUDE || v.is_valid_nocheck(i));
-    auto const is_unique =
-      is_input_countable && (group_offsets[group_labels[i]] == i ||  // first element or
-                             (not equal(i, i - 1)));                 // new unique value in sorted
-    return static_cast<size_type>(is_unique);
+    return group_labels[lhs] == group_labels[rhs] and d_equal(lhs, rhs);
   }
 };
+
 }  // namespace
 
 std::unique_ptr<column> group_nunique(column_view const& values,
                                       cudf::device_span<size_type const> group_labels,
                                       size_type const num_groups,
-                                      cudf::device_span<size_type const> group_offsets,
                                       null_policy null_handling,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr)
@@ -90,46 +85,71 @@ std::unique_ptr<column> group_nunique(column_view const& values,
 
   if (num_groups == 0) { return result; }
 
+  auto result_view = result->mutable_view();
+  thrust::fill(rmm::exec_policy_nosync(stream),
+               result_view.begin<size_type>(),
+               result_view.end<size_type>(),
+               size_type{0});
+  if (values.is_empty()) { return result; }
+
+  // Distinct values are found with a hash set over composite (group label, value) keys rather
+  // than by sorting values within each group: each first-time insertion bumps its group's
+  // counter. Nulls hash and compare equal, so a group's nulls collapse to a single entry which
+  // is skipped up front when the null policy excludes them.
   auto const values_view = table_view{{values}};
-  auto const comparator  = cudf::experimental::row::equality::self_comparator{values_view, stream};
+  auto const has_nulls   = nullate::DYNAMIC{cudf::has_nested_nulls(values_view)};
 
-  auto const d_values_view = column_device_view::create(values, stream);
+  auto const preprocessed_values =
+    cudf::experimental::row::hash::preprocessed_table::create(values_view, stream);
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_values);
+  auto const row_comp = cudf::experimental::row::equality::self_comparator(preprocessed_values);
 
-  auto d_result = rmm::device_uvector<size_type>(group_labels.size(), stream);
+  auto const d_values_view = column_device_view::create(values, stream);
 
   auto const comparator_helper = [&](auto const d_equal) {
-    auto fn = is_unique_iterator_fn{nullate::DYNAMIC{values.has_nulls()},
-                                    *d_values_view,
-                                    d_equal,
-                                    null_handling,
-                                    group_offsets.data(),
-                                    group_labels.data()};
-    thrust::transform(rmm::exec_policy(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(values.size()),
-                      d_result.begin(),
-                      fn);
+    auto const d_hasher =
+      group_value_hasher{row_hasher.device_hasher(has_nulls), group_labels.data()};
+    auto const d_key_equal = group_value_equal{d_equal, group_labels.data()};
+
+    auto key_set = cuco::static_set{
+      cuco::extent{static_cast<size_t>(values.size())},
+      cudf::detail::CUCO_DESIRED_LOAD_FACTOR,
+      cuco::empty_key<size_type>{-1},
+      d_key_equal,
+      cuco::linear_probing<1, decltype(d_hasher)>{d_hasher},
+      {},  // thread scope
+      {},  // storage
+      cudf::detail::cuco_allocator<char>{rmm::mr::polymorphic_allocator<char>{}, stream},
+      stream.value()};
+    auto key_set_ref = key_set.ref(cuco::op::insert);
+
+    thrust::for_each(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(values.size()),
+      [set_ref       = key_set_ref,
+       v             = *d_values_view,
+       nulls         = has_nulls,
+       null_handling = null_handling,
+       labels        = group_labels.data(),
+       counts        = result_view.begin<size_type>()] __device__(size_type i) mutable {
+        auto const is_countable =
+          !nulls || (null_handling == null_policy::INCLUDE || v.is_valid_nocheck(i));
+        if (is_countable and set_ref.insert(i)) {
+          cuda::atomic_ref<size_type, cuda::thread_scope_device> count_ref{counts[labels[i]]};
+          count_ref.fetch_add(size_type{1}, cuda::std::memory_order_relaxed);
+        }
+      });
   };
 
   if (cudf::detail::has_nested_columns(values_view)) {
-    auto const d_equal = comparator.equal_to<true>(
-      cudf::nullate::DYNAMIC{cudf::has_nested_nulls(values_view)}, null_equality::EQUAL);
+    auto const d_equal = row_comp.equal_to<true>(has_nulls, null_equality::EQUAL);
     comparator_helper(d_equal);
   } else {
-    auto const d_equal = comparator.equal_to<false>(
-      cudf::nullate::DYNAMIC{cudf::has_nested_nulls(values_view)}, null_equality::EQUAL);
+    auto const d_equal = row_comp.equal_to<false>(has_nulls, null_equality::EQUAL);
     comparator_helper(d_equal);
   }
 
-  // calling this with a vector instead of a transform iterator is 10x faster to compile;
-  // it also helps that we are only calling it once for both conditions
-  thrust::reduce_by_key(rmm::exec_policy(stream),
-                        group_labels.begin(),
-                        group_labels.end(),
-                        d_result.begin(),
-                        thrust::make_discard_iterator(),
-                        result->mutable_view().begin<size_type>());
-
   return result;
 }
 
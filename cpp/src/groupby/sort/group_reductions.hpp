@@ -174,6 +174,63 @@ std::unique_ptr<column> group_argmin(column_view const& values,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Internal API to gather the payloads of the k rows with the most extreme ordering
+ * values in each group.
+ *
+ * The grouped values are a structs column whose first child orders the rows and whose remaining
+ * children are the payload. The result is a lists column of payload structs with one list row
+ * per group holding up to @p k elements ordered best first; null ordering values rank last.
+ *
+ * @code{.pseudo}
+ * grouped_values = [{2, 'a'}, {1, 'b'}, {4, 'c'}, {-1, 'd'}, {-2, 'e'}]
+ * group_offsets  = [0, 3, 5]
+ * k = 2, topk_order = DESCENDING
+ *
+ * group_top_k_by = [[{'c'}, {'a'}], [{'d'}, {'e'}]]
+ * @endcode
+ *
+ * @param grouped_values Grouped structs column of ordering and payload children
+ * @param group_offsets Offsets of groups' starting points within the grouped values
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param k Number of rows to keep per group
+ * @param topk_order Whether the largest or smallest ordering values are kept
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> group_top_k_by(column_view const& grouped_values,
+                                       cudf::device_span<size_type const> group_offsets,
+                                       cudf::device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       size_type k,
+                                       order topk_order,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Internal API to apply a JIT-compiled device UDF aggregation to each group of @p values
+ *
+ * The UDF source carried by @p agg (a `cudf::detail::udf_aggregation` of kind PTX or CUDA) is
+ * compiled through the JIT cache and invoked once per group over that group's contiguous slice
+ * of @p grouped_values, producing one value of the aggregation's output type per group.
+ *
+ * @throws cudf::logic_error if @p grouped_values contains nulls
+ *
+ * @param grouped_values Grouped values to aggregate
+ * @param group_offsets Offsets of groups' starting points within @p grouped_values
+ * @param num_groups Number of groups
+ * @param agg The PTX or CUDA user-defined aggregation
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> group_udf(column_view const& grouped_values,
+                                  cudf::device_span<size_type const> group_offsets,
+                                  size_type num_groups,
+                                  aggregation const& agg,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr);
+
 /**
  * @brief Internal API to calculate number of non-null values in each group of
  *  @p values
@@ -336,17 +393,18 @@ std::unique_ptr<column> group_quantiles(column_view const& values,
  * @code{.pseudo}
  * values        = [2, 4, 4, -1, -2, <NA>, 4, <NA>]
  * group_labels  = [0, 0, 0,  1,  1,    2, 2,    3]
- * group_offsets = [0,        3,        5,       7, 8]
  * num_groups    = 4
  *
  * group_nunique(null_policy::EXCLUDE) = [2, 2, 1, 0]
  * group_nunique(null_policy::INCLUDE) = [2, 2, 2, 1]
  * @endcode
  *
- * @param values Grouped and sorted (within group) values to get unique count of
+ * Distinct values are counted with a hash set over (group label, value) keys, so @p values does
+ * not need to be sorted within each group.
+ *
+ * @param values Grouped values to get unique count of
  * @param group_labels ID of group that the corresponding value belongs to
  * @param num_groups Number of groups ( unique values in @p group_labels )
- * @param group_offsets Offsets of groups' starting points within @p values
  * @param null_handling Exclude nulls while counting if null_policy::EXCLUDE,
  *  Include nulls if null_policy::INCLUDE.
  *  Nulls are treated equal.
@@ -356,7 +414,6 @@ std::unique_ptr<column> group_quantiles(column_view const& values,
 std::unique_ptr<column> group_nunique(column_view const& values,
                                       cudf::device_span<size_type const> group_labels,
                                       size_type const num_groups,
-                                      cudf::device_span<size_type const> group_offsets,
                                       null_policy null_handling,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr);
@@ -18,9 +18,13 @@
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/replace/nulls.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/replace.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/functional.h>
@@ -37,49 +41,122 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Functor that fills nulls within each group from the nearest valid row in the group.
+ *
+ * Fixed-width columns are filled in a single keyed scan pass: the scan propagates the nearest
+ * valid value directly into the output data, so no gather map is materialized and no gather
+ * kernel runs. Other types build a gather map with the same scan and gather from the input.
+ */
+struct group_replace_nulls_functor {
+  template <typename col_type, std::enable_if_t<cudf::is_fixed_width<col_type>()>* = nullptr>
+  std::unique_ptr<column> operator()(cudf::column_view const& grouped_value,
+                                     device_span<size_type const> group_labels,
+                                     cudf::replace_policy replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    cudf::size_type size = grouped_value.size();
+
+    auto device_in = cudf::column_device_view::create(grouped_value, stream);
+    auto valid_it  = cudf::detail::make_validity_iterator(*device_in);
+    auto in_begin =
+      thrust::make_zip_iterator(thrust::make_tuple(grouped_value.data<col_type>(), valid_it));
+
+    rmm::device_buffer output_data(size * sizeof(col_type), stream, mr);
+    rmm::device_uvector<bool> output_valid(size, stream);
+    auto out_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(static_cast<col_type*>(output_data.data()), output_valid.begin()));
+
+    auto func = cudf::detail::replace_policy_functor();
+    thrust::equal_to<cudf::size_type> eq;
+    if (replace_policy == cudf::replace_policy::PRECEDING) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                    group_labels.begin(),
+                                    group_labels.begin() + size,
+                                    in_begin,
+                                    out_begin,
+                                    eq,
+                                    func);
+    } else {
+      auto gl_rbegin  = thrust::make_reverse_iterator(group_labels.begin() + size);
+      auto in_rbegin  = thrust::make_reverse_iterator(in_begin + size);
+      auto out_rbegin = thrust::make_reverse_iterator(out_begin + size);
+      thrust::inclusive_scan_by_key(
+        rmm::exec_policy(stream), gl_rbegin, gl_rbegin + size, in_rbegin, out_rbegin, eq, func);
+    }
+
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      output_valid.begin(), output_valid.end(), thrust::identity{}, stream, mr);
+
+    return std::make_unique<column>(
+      grouped_value.type(), size, std::move(output_data), std::move(null_mask), null_count);
+  }
+
+  template <typename col_type, std::enable_if_t<not cudf::is_fixed_width<col_type>()>* = nullptr>
+  std::unique_ptr<column> operator()(cudf::column_view const& grouped_value,
+                                     device_span<size_type const> group_labels,
+                                     cudf::replace_policy replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    cudf::size_type size = grouped_value.size();
+
+    auto device_in = cudf::column_device_view::create(grouped_value, stream);
+    auto index     = thrust::make_counting_iterator<cudf::size_type>(0);
+    auto valid_it  = cudf::detail::make_validity_iterator(*device_in);
+    auto in_begin  = thrust::make_zip_iterator(thrust::make_tuple(index, valid_it));
+
+    rmm::device_uvector<cudf::size_type> gather_map(size, stream);
+    auto gm_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(gather_map.begin(), thrust::make_discard_iterator()));
+
+    auto func = cudf::detail::replace_policy_functor();
+    thrust::equal_to<cudf::size_type> eq;
+    if (replace_policy == cudf::replace_policy::PRECEDING) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                    group_labels.begin(),
+                                    group_labels.begin() + size,
+                                    in_begin,
+                                    gm_begin,
+                                    eq,
+                                    func);
+    } else {
+      auto gl_rbegin = thrust::make_reverse_iterator(group_labels.begin() + size);
+      auto in_rbegin = thrust::make_reverse_iterator(in_begin + size);
+      auto gm_rbegin = thrust::make_reverse_iterator(gm_begin + size);
+      thrust::inclusive_scan_by_key(
+        rmm::exec_policy(stream), gl_rbegin, gl_rbegin + size, in_rbegin, gm_rbegin, eq, func);
+    }
+
+    auto output = cudf::detail::gather(cudf::table_view({grouped_value}),
+                                       gather_map,
+                                       cudf::out_of_bounds_policy::DONT_CHECK,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr);
+
+    return std::move(output->release()[0]);
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> group_replace_nulls(cudf::column_view const& grouped_value,
                                             device_span<size_type const> group_labels,
                                             cudf::replace_policy replace_policy,
                                             rmm::cuda_stream_view stream,
                                             rmm::device_async_resource_ref mr)
 {
-  cudf::size_type size = grouped_value.size();
-
-  auto device_in = cudf::column_device_view::create(grouped_value, stream);
-  auto index     = thrust::make_counting_iterator<cudf::size_type>(0);
-  auto valid_it  = cudf::detail::make_validity_iterator(*device_in);
-  auto in_begin  = thrust::make_zip_iterator(thrust::make_tuple(index, valid_it));
-
-  rmm::device_uvector<cudf::size_type> gather_map(size, stream);
-  auto gm_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(gather_map.begin(), thrust::make_discard_iterator()));
-
-  auto func = cudf::detail::replace_policy_functor();
-  thrust::equal_to<cudf::size_type> eq;
-  if (replace_policy == cudf::replace_policy::PRECEDING) {
-    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
-                                  group_labels.begin(),
-                                  group_labels.begin() + size,
-                                  in_begin,
-                                  gm_begin,
-                                  eq,
-                                  func);
-  } else {
-    auto gl_rbegin = thrust::make_reverse_iterator(group_labels.begin() + size);
-    auto in_rbegin = thrust::make_reverse_iterator(in_begin + size);
-    auto gm_rbegin = thrust::make_reverse_iterator(gm_begin + size);
-    thrust::inclusive_scan_by_key(
-      rmm::exec_policy(stream), gl_rbegin, gl_rbegin + size, in_rbegin, gm_rbegin, eq, func);
-  }
-
-  auto output = cudf::detail::gather(cudf::table_view({grouped_value}),
-                                     gather_map,
-                                     cudf::out_of_bounds_policy::DONT_CHECK,
-                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                     stream,
-                                     mr);
-
-  return std::move(output->release()[0]);
+  return cudf::type_dispatcher<dispatch_storage_type>(grouped_value.type(),
+                                                      group_replace_nulls_functor{},
+                                                      grouped_value,
+                                                      group_labels,
+                                                      replace_policy,
+                                                      stream,
+                                                      mr);
 }
 
 }  // namespace detail
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "groupby/sort/group_reductions.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+
+std::unique_ptr<column> group_top_k_by(column_view const& grouped_values,
+                                       cudf::device_span<size_type const> group_offsets,
+                                       cudf::device_span<size_type const> group_labels,
+                                       size_type num_groups,
+                                       size_type k,
+                                       order topk_order,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  auto const num_rows    = grouped_values.size();
+  auto const structs     = structs_column_view{grouped_values};
+  auto const order_child = structs.get_sliced_child(0, stream);
+
+  auto const temp_mr = cudf::get_current_device_resource_ref();
+
+  // Sort rows within each group by the ordering child; the descending flip in the row comparator
+  // is applied after null precedence, so nulls-last needs BEFORE when descending
+  auto const labels_column = column_view{data_type{type_to_id<size_type>()},
+                                         num_rows,
+                                         group_labels.data(),
+                                         nullptr,
+                                         0};
+  auto const null_precedence =
+    topk_order == order::DESCENDING ? null_order::BEFORE : null_order::AFTER;
+  auto const sorted_order =
+    cudf::detail::stable_sorted_order(table_view{{labels_column, order_child}},
+                                      {order::ASCENDING, topk_order},
+                                      {null_order::BEFORE, null_precedence},
+                                      stream,
+                                      temp_mr);
+  auto const d_sorted_order = sorted_order->view().begin<size_type>();
+
+  // Each group keeps its first min(k, group size) sorted rows
+  auto const group_size_iter = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [d_offsets = group_offsets.data(), k] __device__(size_type group) -> size_type {
+      auto const group_size = d_offsets[group + 1] - d_offsets[group];
+      return group_size < k ? group_size : k;
+    });
+  auto offsets = rmm::device_uvector<size_type>(num_groups + 1, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         group_size_iter,
+                         group_size_iter + num_groups,
+                         offsets.begin() + 1);
+  auto const num_kept = offsets.back_element(stream);
+
+  auto gather_map = rmm::device_uvector<size_type>(num_kept, stream);
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(num_groups),
+                   [d_offsets     = group_offsets.data(),
+                    d_out_offsets = offsets.data(),
+                    d_sorted_order,
+                    d_map = gather_map.data()] __device__(size_type group) {
+                     auto const count = d_out_offsets[group + 1] - d_out_offsets[group];
+                     for (size_type i = 0; i < count; ++i) {
+                       d_map[d_out_offsets[group] + i] = d_sorted_order[d_offsets[group] + i];
+                     }
+                   });
+
+  std::vector<column_view> payload;
+  for (size_type i = 1; i < structs.num_children(); ++i) {
+    payload.push_back(structs.get_sliced_child(i, stream));
+  }
+  auto gathered = cudf::detail::gather(table_view{payload},
+                                       device_span<size_type const>{gather_map},
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr);
+  auto elements = make_structs_column(num_kept, gathered->release(), 0, {}, stream, mr);
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(rmm::exec_policy(stream),
+               offsets.begin(),
+               offsets.end(),
+               offsets_column->mutable_view().begin<size_type>());
+
+  return make_lists_column(
+    num_groups, std::move(offsets_column), std::move(elements), 0, {}, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
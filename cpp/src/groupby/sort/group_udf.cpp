@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/cache.hpp"
+#include "jit/parser.hpp"
+#include "jit/util.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <jit_preprocessed_files/groupby/jit/kernel.cu.jit.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+
+std::unique_ptr<column> group_udf(column_view const& grouped_values,
+                                  cudf::device_span<size_type const> group_offsets,
+                                  size_type num_groups,
+                                  aggregation const& agg,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(not grouped_values.has_nulls(),
+               "Device UDF groupby aggregations do not support inputs with nulls.");
+
+  auto const& udf_agg = dynamic_cast<cudf::detail::udf_aggregation const&>(agg);
+
+  std::string cuda_source;
+  switch (udf_agg.kind) {
+    case aggregation::Kind::PTX:
+      cuda_source = cudf::jit::parse_single_function_ptx(udf_agg._source,
+                                                         udf_agg._function_name,
+                                                         cudf::type_to_name(udf_agg._output_type),
+                                                         {0, 5});  // args 0 and 5 are pointers.
+      break;
+    case aggregation::Kind::CUDA:
+      cuda_source = cudf::jit::parse_single_function_cuda(udf_agg._source, udf_agg._function_name);
+      break;
+    default: CUDF_FAIL("Unsupported UDF type.");
+  }
+
+  std::unique_ptr<column> output = make_numeric_column(
+    udf_agg._output_type, num_groups, cudf::mask_state::UNALLOCATED, stream, mr);
+  if (num_groups == 0) { return output; }
+
+  auto output_view = output->mutable_view();
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::groupby::jit::gpu_group_udf")  //
+      .instantiate(cudf::type_to_name(grouped_values.type()),  // list of template arguments
+                   cudf::type_to_name(output->type()),
+                   udf_agg._operator_name);
+
+  cudf::jit::get_program_cache(*groupby_jit_kernel_cu_jit)
+    .get_kernel(
+      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                 //
+    ->launch(num_groups,
+             group_offsets.data(),
+             cudf::jit::get_data_ptr(grouped_values),
+             cudf::jit::get_data_ptr(output_view));
+
+  // check the stream for debugging
+  CUDF_CHECK_CUDA(stream.value());
+
+  return output;
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
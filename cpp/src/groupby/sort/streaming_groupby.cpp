@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+/**
+ * @brief Creates the aggregation that merges two partial results of the given kind.
+ *
+ * @throws cudf::logic_error If partial results of `kind` cannot be merged
+ */
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM: return make_sum_aggregation<groupby_aggregation>();
+    case aggregation::PRODUCT: return make_product_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return make_max_aggregation<groupby_aggregation>();
+    // Partial counts merge by addition
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return make_sum_aggregation<groupby_aggregation>();
+    default: CUDF_FAIL("Aggregation kind cannot be merged across streaming groupby chunks");
+  }
+}
+
+}  // namespace
+
+streaming_groupby::streaming_groupby(null_policy null_handling,
+                                     std::vector<order> const& column_order,
+                                     std::vector<null_order> const& null_precedence)
+  : _include_null_keys{null_handling},
+    _column_order{column_order},
+    _null_precedence{null_precedence}
+{
+}
+
+streaming_groupby::~streaming_groupby() = default;
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>
+streaming_groupby::aggregate_chunk(table_view const& keys,
+                                   host_span<aggregation_request const> requests,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  std::vector<std::vector<aggregation::Kind>> kinds;
+  for (auto const& request : requests) {
+    auto& request_kinds = kinds.emplace_back();
+    for (auto const& agg : request.aggregations) {
+      request_kinds.push_back(agg->kind);
+      // Fail early rather than after the chunk has been aggregated
+      make_merge_aggregation(agg->kind);
+    }
+  }
+  if (_kinds.empty()) {
+    _kinds = kinds;
+  } else {
+    CUDF_EXPECTS(_kinds == kinds,
+                 "Aggregation requests must have the same shape for every chunk");
+  }
+
+  auto chunk_groupby = groupby{keys, _include_null_keys, sorted::YES, _column_order,
+                               _null_precedence};
+  auto [chunk_keys, chunk_results] =
+    chunk_groupby.aggregate(requests, stream, cudf::get_current_device_resource_ref());
+
+  auto const num_groups = chunk_keys->num_rows();
+  if (num_groups == 0) { return {std::move(chunk_keys), std::move(chunk_results)}; }
+
+  // Decide whether the carried boundary group continues into this chunk
+  bool merge_boundary = false;
+  if (_boundary_keys != nullptr) {
+    auto const first_key = cudf::slice(chunk_keys->view(), {0, 1}, stream).front();
+    auto const match     = cudf::detail::contains(first_key,
+                                              _boundary_keys->view(),
+                                              null_equality::EQUAL,
+                                              nan_equality::ALL_EQUAL,
+                                              stream,
+                                              cudf::get_current_device_resource_ref());
+    merge_boundary       = match.front_element(stream);
+  }
+
+  // Merge the carried partial aggregates with those of the chunk's first group
+  std::vector<std::vector<std::unique_ptr<column>>> merged;
+  if (merge_boundary) {
+    auto const first_key = cudf::slice(chunk_keys->view(), {0, 1}, stream).front();
+    auto const merge_keys =
+      cudf::detail::concatenate(std::vector<table_view>{_boundary_keys->view(), first_key},
+                                stream,
+                                cudf::get_current_device_resource_ref());
+
+    std::vector<std::unique_ptr<column>> merge_values;
+    std::vector<aggregation_request> merge_requests;
+    for (std::size_t i = 0; i < kinds.size(); ++i) {
+      for (std::size_t j = 0; j < kinds[i].size(); ++j) {
+        auto const carried     = _boundary_results[i].results[j]->view();
+        auto const chunk_first = cudf::slice(chunk_results[i].results[j]->view(), {0, 1}, stream);
+        merge_values.push_back(
+          cudf::detail::concatenate(std::vector<column_view>{carried, chunk_first.front()},
+                                    stream,
+                                    cudf::get_current_device_resource_ref()));
+
+        auto& merge_request  = merge_requests.emplace_back();
+        merge_request.values = merge_values.back()->view();
+        merge_request.aggregations.push_back(make_merge_aggregation(kinds[i][j]));
+      }
+    }
+
+    auto merge_groupby = groupby{merge_keys->view(), null_policy::INCLUDE, sorted::YES,
+                                 _column_order, _null_precedence};
+    auto merge_results =
+      merge_groupby.aggregate(merge_requests, stream, cudf::get_current_device_resource_ref())
+        .second;
+
+    std::size_t flat_index = 0;
+    for (std::size_t i = 0; i < kinds.size(); ++i) {
+      auto& request_merged = merged.emplace_back();
+      for (std::size_t j = 0; j < kinds[i].size(); ++j) {
+        auto merged_column = std::move(merge_results[flat_index++].results.front());
+        // The merge aggregation may widen the result, e.g. partial counts merge via SUM
+        if (auto const chunk_type = chunk_results[i].results[j]->type();
+            merged_column->type() != chunk_type) {
+          merged_column = cudf::detail::cast(
+            merged_column->view(), chunk_type, stream, cudf::get_current_device_resource_ref());
+        }
+        request_merged.push_back(std::move(merged_column));
+      }
+    }
+  }
+
+  // A carried group whose key does not continue into this chunk is complete; emit it first
+  auto const emit_boundary = _boundary_keys != nullptr and not merge_boundary;
+  // The merged first group is complete unless it is also the chunk's last group
+  auto const emit_merged = merge_boundary and num_groups > 1;
+  auto const last        = num_groups - 1;
+  // First chunk group already emitted (or carried) in merged form when merging
+  auto const body_begin  = std::min<size_type>(merge_boundary ? 1 : 0, last);
+
+  std::vector<table_view> key_parts;
+  if (emit_boundary) { key_parts.push_back(_boundary_keys->view()); }
+  key_parts.push_back(cudf::slice(chunk_keys->view(), {0, last}, stream).front());
+  auto out_keys = cudf::detail::concatenate(key_parts, stream, mr);
+
+  std::vector<aggregation_result> out_results;
+  for (std::size_t i = 0; i < kinds.size(); ++i) {
+    auto& out_result = out_results.emplace_back();
+    for (std::size_t j = 0; j < kinds[i].size(); ++j) {
+      std::vector<column_view> value_parts;
+      if (emit_boundary) { value_parts.push_back(_boundary_results[i].results[j]->view()); }
+      if (emit_merged) { value_parts.push_back(merged[i][j]->view()); }
+      value_parts.push_back(
+        cudf::slice(chunk_results[i].results[j]->view(), {body_begin, last}, stream).front());
+      out_result.results.push_back(cudf::detail::concatenate(value_parts, stream, mr));
+    }
+  }
+
+  // Carry the chunk's last group forward; when the merged first group is also the last group it
+  // becomes the new boundary state
+  auto const last_key = cudf::slice(chunk_keys->view(), {last, num_groups}, stream).front();
+  auto new_boundary_keys =
+    std::make_unique<table>(last_key, stream, cudf::get_current_device_resource_ref());
+  std::vector<aggregation_result> new_boundary_results;
+  for (std::size_t i = 0; i < kinds.size(); ++i) {
+    auto& boundary_result = new_boundary_results.emplace_back();
+    for (std::size_t j = 0; j < kinds[i].size(); ++j) {
+      auto const carry_view =
+        (merge_boundary and num_groups == 1)
+          ? merged[i][j]->view()
+          : cudf::slice(chunk_results[i].results[j]->view(), {last, num_groups}, stream).front();
+      boundary_result.results.push_back(
+        std::make_unique<column>(carry_view, stream, cudf::get_current_device_resource_ref()));
+    }
+  }
+  _boundary_keys    = std::move(new_boundary_keys);
+  _boundary_results = std::move(new_boundary_results);
+
+  return {std::move(out_keys), std::move(out_results)};
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> streaming_groupby::flush(
+  rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  if (_boundary_keys == nullptr) { return {std::make_unique<table>(), {}}; }
+
+  auto out_keys = std::make_unique<table>(_boundary_keys->view(), stream, mr);
+  std::vector<aggregation_result> out_results;
+  for (auto const& boundary_result : _boundary_results) {
+    auto& out_result = out_results.emplace_back();
+    for (auto const& result : boundary_result.results) {
+      out_result.results.push_back(std::make_unique<column>(result->view(), stream, mr));
+    }
+  }
+
+  _boundary_keys.reset();
+  _boundary_results.clear();
+  _kinds.clear();
+
+  return {std::move(out_keys), std::move(out_results)};
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -22,15 +22,77 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/memory_resource.hpp>
 
+#include <cudf/utilities/traits.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/tabulate.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace hashing {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Combines one column's element hashes into the running row hashes.
+ *
+ * One step of the column accumulation performed by the experimental row hasher: every column is
+ * hashed with the same seed and folded into the running value with `hash_combine`. Running one
+ * pass per column moves the type dispatch to the host and reads each column with coalesced loads
+ * instead of interleaving columns within a thread.
+ */
+template <typename T>
+struct device_column_hasher {
+  bool check_nulls;
+  column_device_view col;
+  uint32_t seed;
+  hash_value_type* hashes;
+
+  __device__ void operator()(size_type row_index) const noexcept
+  {
+    auto const hasher =
+      cudf::experimental::row::hash::element_hasher<MurmurHash3_x86_32, bool>{check_nulls, seed};
+    hashes[row_index] =
+      hash_combine(hashes[row_index], hasher.template operator()<T>(col, row_index));
+  }
+};
+
+struct column_hasher_dispatcher {
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  void operator()(column_device_view const& col,
+                  bool check_nulls,
+                  uint32_t seed,
+                  hash_value_type* hashes,
+                  size_type num_rows,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       num_rows,
+                       device_column_hasher<T>{check_nulls, col, seed, hashes});
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  void operator()(column_device_view const&,
+                  bool,
+                  uint32_t,
+                  hash_value_type*,
+                  size_type,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unsupported type for MurmurHash3_x86_32");
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> murmurhash3_x86_32(table_view const& input,
                                            uint32_t seed,
                                            rmm::cuda_stream_view stream,
@@ -45,9 +107,33 @@ std::unique_ptr<column> murmurhash3_x86_32(table_view const& input,
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
 
-  bool const nullable   = has_nulls(input);
+  bool const nullable = has_nulls(input);
+  auto output_view    = output->mutable_view();
+
+  // Flat tables are hashed one column pass at a time, dispatching each column's type once on the
+  // host; each pass folds its column's hashes into the running values with hash_combine
+  if (std::all_of(input.begin(), input.end(), [](auto const& col) {
+        return not cudf::is_nested(col.type());
+      })) {
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               output_view.begin<hash_value_type>(),
+                               output_view.end<hash_value_type>(),
+                               seed);
+    for (auto const& col : input) {
+      auto const d_col = column_device_view::create(col, stream);
+      type_dispatcher<dispatch_storage_type>(col.type(),
+                                             column_hasher_dispatcher{},
+                                             *d_col,
+                                             nullable and col.nullable(),
+                                             seed,
+                                             output_view.begin<hash_value_type>(),
+                                             input.num_rows(),
+                                             stream);
+    }
+    return output;
+  }
+
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(input, stream);
-  auto output_view      = output->mutable_view();
 
   // Compute the hash value for each row
   thrust::tabulate(rmm::exec_policy(stream),
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sha_hash.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace cudf {
+namespace hashing {
+namespace detail {
+
+namespace {
+
+// Bytes hashed by each leaf of the checksum tree
+constexpr int64_t checksum_chunk_bytes = 64 * 1024;
+
+struct sha256_hash_state {
+  uint64_t message_length = 0;
+  uint32_t buffer_length  = 0;
+  uint32_t hash_value[8]  = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  uint8_t buffer[64];
+};
+
+struct SHA256Hash : HashBase<SHA256Hash> {
+  __device__ inline SHA256Hash(char* result_location) : HashBase<SHA256Hash>(result_location) {}
+
+  // Intermediate data type storing the hash state
+  using hash_state = sha256_hash_state;
+  // The word type used by this hash function
+  using sha_word_type = uint32_t;
+  // Number of bytes processed in each hash step
+  static constexpr uint32_t message_chunk_size = 64;
+  // Digest size in bytes
+  static constexpr uint32_t digest_size = 64;
+  // Number of bytes used for the message length
+  static constexpr uint32_t message_length_size = 8;
+
+  __device__ inline void hash_step(hash_state& state) { sha256_hash_step(state); }
+
+  hash_state state;
+};
+
+/**
+ * @brief Returns the raw data bytes backing the rows of a column.
+ *
+ * Slice offsets are accounted for; for strings, the character bytes of the rows in view are used.
+ */
+device_span<uint8_t const> column_data_span(column_view const& col, rmm::cuda_stream_view stream)
+{
+  if (col.type().id() == type_id::STRING) {
+    if (col.size() == 0) { return {}; }
+    auto const scv   = strings_column_view(col);
+    auto const first = cudf::strings::detail::get_offset_value(scv.offsets(), col.offset(), stream);
+    auto const last =
+      cudf::strings::detail::get_offset_value(scv.offsets(), col.offset() + col.size(), stream);
+    return {reinterpret_cast<uint8_t const*>(scv.chars_begin(stream)) + first,
+            static_cast<std::size_t>(last - first)};
+  }
+  auto const width = cudf::size_of(col.type());
+  return {col.head<uint8_t>() + static_cast<std::size_t>(col.offset()) * width,
+          static_cast<std::size_t>(col.size()) * width};
+}
+
+/**
+ * @brief Computes the tree checksum of a device buffer.
+ *
+ * The buffer is split into `checksum_chunk_bytes` chunks that are SHA-256 hashed in parallel, one
+ * chunk per thread. The concatenated hex digests form the next level's input, and levels are
+ * hashed the same way until a single digest remains. A buffer not exceeding one chunk therefore
+ * yields the plain SHA-256 of its bytes.
+ *
+ * @return A device vector holding the final hex digest
+ */
+rmm::device_uvector<char> checksum_digest(device_span<uint8_t const> bytes,
+                                          rmm::cuda_stream_view stream)
+{
+  auto digests = rmm::device_uvector<char>(0, stream);
+  auto current = bytes;
+  while (true) {
+    auto const num_chunks = std::max(
+      int64_t{1},
+      cudf::util::div_rounding_up_safe(static_cast<int64_t>(current.size()), checksum_chunk_bytes));
+    auto level = rmm::device_uvector<char>(num_chunks * SHA256Hash::digest_size, stream);
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::counting_iterator<int64_t>(0),
+      num_chunks,
+      [current, d_level = level.data()] __device__(int64_t chunk_index) {
+        auto const begin     = chunk_index * checksum_chunk_bytes;
+        auto const remaining = static_cast<int64_t>(current.size()) - begin;
+        auto const length = remaining < checksum_chunk_bytes ? remaining : checksum_chunk_bytes;
+        SHA256Hash hasher(d_level + chunk_index * SHA256Hash::digest_size);
+        hasher.process(current.data() + begin, static_cast<uint32_t>(length));
+        hasher.finalize();
+      });
+    digests = std::move(level);
+    if (num_chunks == 1) { break; }
+    current = device_span<uint8_t const>(reinterpret_cast<uint8_t const*>(digests.data()),
+                                         digests.size());
+  }
+  return digests;
+}
+
+}  // namespace
+
+std::unique_ptr<column> sha256_checksum(table_view const& input,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(
+    std::all_of(
+      input.begin(), input.end(), [](auto const& col) { return sha_leaf_type_check(col.type()); }),
+    "Unsupported column type for checksum.",
+    cudf::data_type_error);
+
+  if (input.num_columns() == 0) { return cudf::make_empty_column(cudf::type_id::STRING); }
+
+  auto begin = thrust::make_constant_iterator(SHA256Hash::digest_size);
+  auto [offsets_column, bytes] = cudf::strings::detail::make_offsets_child_column(
+    begin, begin + input.num_columns(), stream, mr);
+
+  auto chars = rmm::device_uvector<char>(bytes, stream, mr);
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const digest = checksum_digest(column_data_span(input.column(i), stream), stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(chars.data() + i * SHA256Hash::digest_size,
+                                  digest.data(),
+                                  SHA256Hash::digest_size,
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    // the digest scratch is stream-ordered, so its release cannot race with the copy
+  }
+
+  return make_strings_column(input.num_columns(), std::move(offsets_column), chars.release(), 0, {});
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> sha256_checksum(table_view const& input,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sha256_checksum(input, stream, mr);
+}
+
+}  // namespace hashing
+}  // namespace cudf
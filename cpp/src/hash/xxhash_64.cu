@@ -21,12 +21,18 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/memory_resource.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <cuda/std/limits>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/tabulate.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace hashing {
@@ -94,6 +100,52 @@ class device_row_hasher {
   hash_value_type const _seed;
 };
 
+/**
+ * @brief Hashes one column into the running row hashes, seeding with the previous value.
+ *
+ * One step of the column accumulation performed by `device_row_hasher`: the running hash of each
+ * row seeds the hash of this column's element, and a null element resets the row hash to the
+ * sentinel. Running one pass per column moves the type dispatch to the host and reads each column
+ * with coalesced loads instead of interleaving columns within a thread.
+ */
+template <typename T>
+struct device_column_hasher {
+  bool check_nulls;
+  column_device_view col;
+  hash_value_type* hashes;
+
+  __device__ void operator()(size_type row_index) const noexcept
+  {
+    if (check_nulls && col.is_null(row_index)) {
+      hashes[row_index] = cuda::std::numeric_limits<hash_value_type>::max();
+    } else {
+      hashes[row_index] = XXHash_64<T>{hashes[row_index]}(col.element<T>(row_index));
+    }
+  }
+};
+
+struct column_hasher_dispatcher {
+  template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+  void operator()(column_device_view const& col,
+                  bool check_nulls,
+                  hash_value_type* hashes,
+                  size_type num_rows,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       num_rows,
+                       device_column_hasher<T>{check_nulls, col, hashes});
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>())>
+  void operator()(
+    column_device_view const&, bool, hash_value_type*, size_type, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unsupported type for XXHash_64");
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<column> xxhash_64(table_view const& input,
@@ -110,9 +162,32 @@ std::unique_ptr<column> xxhash_64(table_view const& input,
   // Return early if there's nothing to hash
   if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
 
-  bool const nullable   = has_nulls(input);
+  bool const nullable = has_nulls(input);
+  auto output_view    = output->mutable_view();
+
+  // Flat tables are hashed one column pass at a time, dispatching each column's type once on the
+  // host; the chained seeding makes each pass read the previous pass's output
+  if (std::all_of(input.begin(), input.end(), [](auto const& col) {
+        return not cudf::is_nested(col.type());
+      })) {
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               output_view.begin<hash_value_type>(),
+                               output_view.end<hash_value_type>(),
+                               seed);
+    for (auto const& col : input) {
+      auto const d_col = column_device_view::create(col, stream);
+      type_dispatcher(col.type(),
+                      column_hasher_dispatcher{},
+                      *d_col,
+                      nullable and col.nullable(),
+                      output_view.begin<hash_value_type>(),
+                      input.num_rows(),
+                      stream);
+    }
+    return output;
+  }
+
   auto const input_view = table_device_view::create(input, stream);
-  auto output_view      = output->mutable_view();
 
   // Compute the hash value for each row
   thrust::tabulate(rmm::exec_policy(stream),
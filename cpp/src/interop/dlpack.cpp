@@ -149,24 +149,33 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
     CUDF_EXPECTS(tensor.device.device_id == device_id, "DLTensor device ID must be current device");
   }
 
-  // We only support 1D and 2D tensors with some restrictions on layout
+  // We support 1D and 2D tensors; 2D tensors may be arbitrarily strided as
+  // long as both strides are positive (no overlapping or reversed elements).
+  // Element stride between consecutive rows of a column, and between the
+  // starts of consecutive columns, respectively.
+  int64_t row_stride = 1;
+  int64_t col_stride = (tensor.ndim == 2) ? tensor.shape[0] : 0;
   if (tensor.ndim == 1) {
     // 1D tensors must have dense layout (strides == nullptr <=> dense layout), or have shape (0,)
     CUDF_EXPECTS(nullptr == tensor.strides || tensor.strides[0] == 1 || tensor.shape[0] == 0,
                  "from_dlpack of 1D DLTensor only for unit-stride data");
   } else if (tensor.ndim == 2) {
-    CUDF_EXPECTS(
-      // Empty array is fine. If ncols == 0 then we get an empty dataframe
-      // irrespective of nrows, which is slightly different behaviour from
-      // cudf.DataFrame(np.empty((3, 0))) because there's no way to communicate
-      // the index information out with a table view if no columns exist.
-      (tensor.shape[0] == 0 || tensor.shape[1] == 0)
-        // (N, 1) is fine as long as the 1D array has dense layout
-        || (tensor.shape[1] == 1 && (nullptr == tensor.strides || tensor.strides[0] == 1))
-        // Column major is fine as long as the fastest dimension has dense layout
-        || (nullptr != tensor.strides && tensor.strides[0] == 1 &&
-            tensor.strides[1] >= tensor.shape[0]),
-      "from_dlpack of 2D DLTensor only for column-major unit-stride data");
+    if (nullptr == tensor.strides) {
+      // Per the DLPack spec, null strides indicate compact row-major data
+      row_stride = tensor.shape[1];
+      col_stride = 1;
+    } else {
+      row_stride = tensor.strides[0];
+      col_stride = tensor.strides[1];
+    }
+    // Empty array is fine. If ncols == 0 then we get an empty dataframe
+    // irrespective of nrows, which is slightly different behaviour from
+    // cudf.DataFrame(np.empty((3, 0))) because there's no way to communicate
+    // the index information out with a table view if no columns exist.
+    CUDF_EXPECTS((tensor.shape[0] == 0 || tensor.shape[1] == 0) ||
+                   ((tensor.shape[0] == 1 || row_stride >= 1) &&
+                    (tensor.shape[1] == 1 || col_stride >= 1)),
+                 "from_dlpack of 2D DLTensor requires positive strides");
   } else {
     CUDF_FAIL("DLTensor must be 1D or 2D");
   }
@@ -191,26 +200,39 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
   auto const num_rows     = static_cast<size_t>(tensor.shape[0]);
   size_t const bytes      = num_rows * byte_width;
 
-  // For 2D tensors, if the strides pointer is not null, then strides[1] is the
-  // number of elements (not bytes) between the start of each column
-  size_t const col_stride = (tensor.ndim == 2 && nullptr != tensor.strides)
-                              ? byte_width * tensor.strides[1]
-                              : byte_width * num_rows;
+  // Strides are in elements, not bytes
+  size_t const row_stride_bytes = byte_width * static_cast<size_t>(row_stride);
+  size_t const col_stride_bytes =
+    (tensor.ndim == 2) ? byte_width * static_cast<size_t>(col_stride) : bytes;
 
   auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
 
-  // Allocate columns and copy data from tensor
+  // Allocate columns and copy data from tensor. Columns with unit row stride
+  // are copied contiguously; otherwise a 2D copy gathers the strided elements
+  // directly, without requiring the caller to transpose into a column-major
+  // staging buffer first.
   std::vector<std::unique_ptr<column>> columns(num_columns);
   for (auto& col : columns) {
     col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
 
-    CUDF_CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
-                                  reinterpret_cast<void*>(tensor_data),
-                                  bytes,
-                                  cudaMemcpyDefault,
-                                  stream.value()));
+    if (row_stride == 1) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
+                                    reinterpret_cast<void*>(tensor_data),
+                                    bytes,
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+    } else {
+      CUDF_CUDA_TRY(cudaMemcpy2DAsync(col->mutable_view().head<void>(),
+                                      byte_width,
+                                      reinterpret_cast<void*>(tensor_data),
+                                      row_stride_bytes,
+                                      byte_width,
+                                      num_rows,
+                                      cudaMemcpyDefault,
+                                      stream.value()));
+    }
 
-    tensor_data += col_stride;
+    tensor_data += col_stride_bytes;
   }
 
   return std::make_unique<table>(std::move(columns));
@@ -294,6 +316,46 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return managed_tensor.release();
 }
 
+DLManagedTensor* to_dlpack_view(column_view const& input, rmm::cuda_stream_view stream)
+{
+  // Ensure that type is convertible to DLDataType
+  DLDataType const dltype = data_type_to_DLDataType(input.type());
+
+  CUDF_EXPECTS(!input.has_nulls(), "Input required to have null count zero");
+
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = dltype;
+
+  tensor.ndim       = 1;
+  tensor.shape      = context->shape;
+  tensor.shape[0]   = input.size();
+  tensor.strides    = context->strides;
+  tensor.strides[0] = 1;
+
+  CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+
+  // The tensor aliases the column's device data rather than copying it; the
+  // context owns no buffer, so the deleter frees only the tensor metadata and
+  // the caller must keep the column data alive for the tensor's lifetime.
+  tensor.data        = const_cast<void*>(get_column_data(input));
+  tensor.byte_offset = 0;
+
+  // Defer ownership of managed tensor to caller
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+
+  // synchronize the stream so that any kernels still producing the column data
+  // have completed before the aliasing tensor is handed to an external consumer
+  // that may use a different stream.
+  stream.synchronize();
+
+  return managed_tensor.release();
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
@@ -312,4 +374,10 @@ DLManagedTensor* to_dlpack(table_view const& input,
   return detail::to_dlpack(input, stream, mr);
 }
 
+DLManagedTensor* to_dlpack_view(column_view const& input, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack_view(input, stream);
+}
+
 }  // namespace cudf
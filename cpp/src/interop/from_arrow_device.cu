@@ -155,6 +155,12 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<cudf::string_view>(
       {});
   }
 
+  // string view arrays scatter their character data across variadic buffers, which has no
+  // zero-copy representation in cudf's offsets+chars layout
+  CUDF_EXPECTS(schema->type != NANOARROW_TYPE_STRING_VIEW,
+               "Arrow string view arrays cannot be zero-copy imported; use from_arrow_host",
+               cudf::data_type_error);
+
   data_type offsets_type(type_id::INT32);
   if (schema->type == NANOARROW_TYPE_LARGE_STRING) { offsets_type = data_type(type_id::INT64); }
   auto offsets_view = column_view{offsets_type,
@@ -26,6 +26,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/table/table_view.hpp>
@@ -43,6 +44,8 @@
 #include <nanoarrow/nanoarrow.hpp>
 #include <nanoarrow/nanoarrow_device.h>
 
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -77,6 +80,64 @@ struct dispatch_copy_from_arrow_host {
     CUDF_FAIL("Unsupported type in copy_from_arrow_host.");
   }
 
+  /**
+   * @brief Flatten an Arrow string view (Utf8View) array into cudf's offsets+chars layout.
+   *
+   * Each 16-byte view descriptor either inlines its character data or references a slice of
+   * one of the array's variadic data buffers, so the rows are walked on the host to rebuild
+   * a contiguous character buffer and its offsets.
+   */
+  std::unique_ptr<column> copy_string_view_column(ArrowArray const* input, bool skip_mask)
+  {
+    auto const* views =
+      reinterpret_cast<ArrowBinaryView const*>(input->buffers[fixed_width_data_buffer_idx]);
+    auto const* validity = reinterpret_cast<uint8_t const*>(input->buffers[validity_buffer_idx]);
+
+    auto const num_rows = static_cast<size_type>(input->length);
+    std::vector<int32_t> h_offsets(num_rows + 1);
+    h_offsets[0] = 0;
+    std::vector<char> h_chars;
+    for (int64_t i = 0; i < input->length; ++i) {
+      auto const row      = input->offset + i;
+      auto const is_valid = validity == nullptr || ((validity[row / 8] >> (row % 8)) & 1);
+      auto const& view    = views[row];
+      if (is_valid && view.inlined.size > 0) {
+        auto const* data =
+          view.inlined.size <= NANOARROW_BINARY_VIEW_INLINE_SIZE
+            ? reinterpret_cast<char const*>(view.inlined.data)
+            : reinterpret_cast<char const*>(input->buffers[2 + view.ref.buffer_index]) +
+                view.ref.offset;
+        h_chars.insert(h_chars.end(), data, data + view.inlined.size);
+      }
+      h_offsets[i + 1] = static_cast<int32_t>(h_chars.size());
+    }
+
+    auto d_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream, mr);
+    auto offsets_column =
+      std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0);
+    rmm::device_buffer chars(h_chars.size(), stream, mr);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      chars.data(), h_chars.data(), h_chars.size(), cudaMemcpyDefault, stream.value()));
+
+    auto const has_nulls = !skip_mask && validity != nullptr;
+    auto out_mask =
+      has_nulls ? cudf::detail::copy_bitmask(
+                    static_cast<bitmask_type const*>(get_mask_buffer(input)->data()),
+                    input->offset,
+                    input->offset + input->length,
+                    stream,
+                    mr)
+                : rmm::device_buffer{};
+    auto out_col = make_strings_column(num_rows,
+                                       std::move(offsets_column),
+                                       std::move(chars),
+                                       has_nulls ? input->null_count : 0,
+                                       std::move(out_mask));
+    // the staging host vectors go out of scope on return
+    stream.synchronize();
+    return out_col;
+  }
+
   template <typename T,
             CUDF_ENABLE_IF(is_rep_layout_compatible<T>() || std::is_same_v<T, numeric::decimal128>)>
   std::unique_ptr<column> operator()(ArrowSchemaView* schema,
@@ -175,6 +236,10 @@ std::unique_ptr<column> dispatch_copy_from_arrow_host::operator()<cudf::string_v
 {
   if (input->length == 0) { return make_empty_column(type_id::STRING); }
 
+  if (schema->type == NANOARROW_TYPE_STRING_VIEW) {
+    return copy_string_view_column(input, skip_mask);
+  }
+
   // offsets column should contain no nulls so we can put nullptr for the bitmask
   // nulls are tracked in the parent string column itself, not in the offsets
   void const* offset_buffers[2] = {nullptr, input->buffers[fixed_width_data_buffer_idx]};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,8 +19,10 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
@@ -90,15 +92,21 @@ std::unique_ptr<table> from_arrow_stream(ArrowArrayStream* input,
   ArrowSchema schema;
   NANOARROW_THROW_NOT_OK(ArrowArrayStreamGetSchema(input, &schema, nullptr));
 
+  // Interleave chunk conversions across two forked streams so the host-to-device copies of
+  // one chunk can overlap the conversion kernels of the previous one instead of serializing
+  // get-next/copy/convert per chunk.
+  auto const conversion_streams = cudf::detail::fork_streams(stream, 2);
+
   std::vector<std::unique_ptr<cudf::table>> chunks;
   ArrowArray chunk;
   while (true) {
     NANOARROW_THROW_NOT_OK(ArrowArrayStreamGetNext(input, &chunk, nullptr));
     if (chunk.release == nullptr) { break; }
-    chunks.push_back(from_arrow(&schema, &chunk, stream, mr));
+    chunks.push_back(from_arrow(&schema, &chunk, conversion_streams[chunks.size() % 2], mr));
     chunk.release(&chunk);
   }
   input->release(input);
+  cudf::detail::join_streams(conversion_streams, stream);
 
   if (chunks.empty()) {
     if (schema.n_children == 0) {
@@ -127,7 +135,20 @@ std::unique_ptr<table> from_arrow_stream(ArrowArrayStream* input,
     chunks.begin(), chunks.end(), std::back_inserter(chunk_views), [](auto const& chunk) {
       return chunk->view();
     });
-  return cudf::detail::concatenate(chunk_views, stream, mr);
+  // concatenate sizes each output buffer once up front and fuses the per-chunk copies, so
+  // the final assembly is a single pre-sized allocation per column
+  auto result = cudf::detail::concatenate(chunk_views, stream, mr);
+
+  // The chunk tables were allocated on the forked conversion streams and their stream-ordered
+  // deallocations run there when `chunks` goes out of scope. Order those frees after the
+  // concatenate kernels on `stream`, so a pool resource cannot hand the chunk memory to another
+  // stream while it is still being read.
+  std::for_each(
+    conversion_streams.begin(), conversion_streams.end(), [&](auto& conversion_stream) {
+      cudf::detail::join_streams(host_span<rmm::cuda_stream_view const>{&stream, 1},
+                                 conversion_stream);
+    });
+  return result;
 }
 
 }  // namespace detail
@@ -17,6 +17,7 @@
 #include "avro.hpp"
 #include "avro_gpu.hpp"
 #include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
 #include "io/utilities/column_buffer.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
@@ -35,14 +36,10 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/equal.h>
+#include <thrust/fill.h>
 #include <thrust/functional.h>
-#include <thrust/iterator/constant_iterator.h>
-#include <thrust/iterator/transform_output_iterator.h>
-#include <thrust/tabulate.h>
-
-#include <nvcomp/snappy.h>
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -263,96 +260,78 @@ rmm::device_buffer decompress_data(datasource& source,
     }
 
     return decomp_block_data;
-  } else if (meta.codec == "snappy") {
+  } else if (meta.codec == "snappy" or meta.codec == "zstandard") {
+    auto const compression = meta.codec == "snappy" ? nvcomp::compression_type::SNAPPY
+                                                    : nvcomp::compression_type::ZSTD;
+    if (auto const reason = nvcomp::is_decompression_disabled(compression); reason) {
+      CUDF_FAIL("Decompression error: " + reason.value());
+    }
+
     size_t const num_blocks = meta.block_list.size();
 
     // comp_block_data contains contents of the avro file starting from the first block, excluding
     // file header. meta.block_list[i].offset refers to offset of block i in the file, including
     // file header.
-    // Find ptrs to each compressed block in comp_block_data by removing header offset.
-    cudf::detail::hostdevice_vector<void const*> compressed_data_ptrs(num_blocks, stream);
+    // Find each compressed block in comp_block_data by removing the header offset.
+    auto inflate_in =
+      cudf::detail::hostdevice_vector<device_span<uint8_t const>>(num_blocks, stream);
+    auto const base_offset = meta.block_list[0].offset;
     std::transform(meta.block_list.begin(),
                    meta.block_list.end(),
-                   compressed_data_ptrs.host_ptr(),
-                   [&](auto const& block) {
-                     return static_cast<std::byte const*>(comp_block_data.data()) +
-                            (block.offset - meta.block_list[0].offset);
+                   inflate_in.host_ptr(),
+                   [&](auto const& block) -> device_span<uint8_t const> {
+                     return {static_cast<uint8_t const*>(comp_block_data.data()) +
+                               (block.offset - base_offset),
+                             block.size};
                    });
-    compressed_data_ptrs.host_to_device_async(stream);
+    inflate_in.host_to_device_async(stream);
 
-    cudf::detail::hostdevice_vector<size_t> compressed_data_sizes(num_blocks, stream);
-    std::transform(meta.block_list.begin(),
-                   meta.block_list.end(),
-                   compressed_data_sizes.host_ptr(),
-                   [](auto const& block) { return block.size; });
-    compressed_data_sizes.host_to_device_async(stream);
-
-    cudf::detail::hostdevice_vector<size_t> uncompressed_data_sizes(num_blocks, stream);
-    nvcompStatus_t status =
-      nvcompBatchedSnappyGetDecompressSizeAsync(compressed_data_ptrs.device_ptr(),
-                                                compressed_data_sizes.device_ptr(),
-                                                uncompressed_data_sizes.device_ptr(),
-                                                num_blocks,
-                                                stream.value());
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
-                 "Unable to get uncompressed sizes for snappy compressed blocks");
-    uncompressed_data_sizes.device_to_host_sync(stream);
+    rmm::device_uvector<size_t> d_uncompressed_data_sizes(num_blocks, stream);
+    nvcomp::batched_get_decompress_size(compression, inflate_in, d_uncompressed_data_sizes, stream);
+    auto const uncompressed_data_sizes =
+      cudf::detail::make_std_vector_sync(d_uncompressed_data_sizes, stream);
 
     size_t const uncompressed_data_size =
       std::reduce(uncompressed_data_sizes.begin(), uncompressed_data_sizes.end());
     size_t const max_uncomp_block_size = std::reduce(
       uncompressed_data_sizes.begin(), uncompressed_data_sizes.end(), 0, thrust::maximum<size_t>());
 
-    size_t temp_size;
-    status =
-      nvcompBatchedSnappyDecompressGetTempSize(num_blocks, max_uncomp_block_size, &temp_size);
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess,
-                 "Unable to get scratch size for snappy decompression");
-
-    rmm::device_buffer scratch(temp_size, stream);
-    rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
-    rmm::device_uvector<void*> uncompressed_data_ptrs(num_blocks, stream);
-    cudf::detail::hostdevice_vector<size_t> uncompressed_data_offsets(num_blocks, stream);
-
+    std::vector<size_t> uncompressed_data_offsets(num_blocks);
     std::exclusive_scan(uncompressed_data_sizes.begin(),
                         uncompressed_data_sizes.end(),
                         uncompressed_data_offsets.begin(),
                         0);
-    uncompressed_data_offsets.host_to_device_async(stream);
-
-    thrust::tabulate(rmm::exec_policy(stream),
-                     uncompressed_data_ptrs.begin(),
-                     uncompressed_data_ptrs.end(),
-                     [off  = uncompressed_data_offsets.device_ptr(),
-                      data = static_cast<std::byte*>(decomp_block_data.data())] __device__(int i) {
-                       return data + off[i];
-                     });
-
-    rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_blocks, stream);
-    rmm::device_uvector<nvcompStatus_t> statuses(num_blocks, stream);
-
-    status = nvcompBatchedSnappyDecompressAsync(compressed_data_ptrs.device_ptr(),
-                                                compressed_data_sizes.device_ptr(),
-                                                uncompressed_data_sizes.device_ptr(),
-                                                actual_uncompressed_data_sizes.data(),
-                                                num_blocks,
-                                                scratch.data(),
-                                                scratch.size(),
-                                                uncompressed_data_ptrs.data(),
-                                                statuses.data(),
-                                                stream);
-    CUDF_EXPECTS(status == nvcompStatus_t::nvcompSuccess, "unable to perform snappy decompression");
-
-    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                               uncompressed_data_sizes.d_begin(),
-                               uncompressed_data_sizes.d_end(),
-                               actual_uncompressed_data_sizes.begin()),
-                 "Mismatch in expected and actual decompressed size during snappy decompression");
-    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
-                               statuses.begin(),
-                               statuses.end(),
-                               thrust::make_constant_iterator(nvcompStatus_t::nvcompSuccess)),
-                 "Error during snappy decompression");
+
+    rmm::device_buffer decomp_block_data(uncompressed_data_size, stream);
+    auto inflate_out = cudf::detail::hostdevice_vector<device_span<uint8_t>>(num_blocks, stream);
+    for (size_t i = 0; i < num_blocks; ++i) {
+      inflate_out[i] = {static_cast<uint8_t*>(decomp_block_data.data()) +
+                          uncompressed_data_offsets[i],
+                        uncompressed_data_sizes[i]};
+    }
+    inflate_out.host_to_device_async(stream);
+
+    auto inflate_stats = cudf::detail::hostdevice_vector<compression_result>(num_blocks, stream);
+    thrust::fill(rmm::exec_policy(stream),
+                 inflate_stats.d_begin(),
+                 inflate_stats.d_end(),
+                 compression_result{0, compression_status::FAILURE});
+
+    nvcomp::batched_decompress(compression,
+                               inflate_in,
+                               inflate_out,
+                               inflate_stats,
+                               max_uncomp_block_size,
+                               uncompressed_data_size,
+                               stream);
+
+    inflate_stats.device_to_host_sync(stream);
+    CUDF_EXPECTS(std::all_of(inflate_stats.begin(),
+                             inflate_stats.end(),
+                             [](auto const& stats) {
+                               return stats.status == compression_status::SUCCESS;
+                             }),
+                 "Error during " + meta.codec + " decompression");
 
     // Update blocks offsets & sizes to refer to uncompressed data
     for (size_t i = 0; i < num_blocks; i++) {
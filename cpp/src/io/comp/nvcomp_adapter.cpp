@@ -52,6 +52,25 @@ auto batched_decompress_get_temp_size_ex(compression_type compression, Args&&...
   }
 }
 
+// Dispatcher for nvcompBatched<format>GetDecompressSizeAsync
+template <typename... Args>
+auto batched_get_decompress_size_async(compression_type compression, Args&&... args)
+{
+  switch (compression) {
+    case compression_type::SNAPPY:
+      return nvcompBatchedSnappyGetDecompressSizeAsync(std::forward<Args>(args)...);
+    case compression_type::ZSTD:
+      return nvcompBatchedZstdGetDecompressSizeAsync(std::forward<Args>(args)...);
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4GetDecompressSizeAsync(std::forward<Args>(args)...);
+    case compression_type::DEFLATE:
+      return nvcompBatchedDeflateGetDecompressSizeAsync(std::forward<Args>(args)...);
+    case compression_type::GZIP:
+      return nvcompBatchedGzipGetDecompressSizeAsync(std::forward<Args>(args)...);
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
 // Dispatcher for nvcompBatched<format>DecompressAsync
 template <typename... Args>
 auto batched_decompress_async(compression_type compression, Args&&... args)
@@ -294,6 +313,23 @@ void batched_decompress(compression_type compression,
   update_compression_results(nvcomp_statuses, actual_uncompressed_data_sizes, results, stream);
 }
 
+void batched_get_decompress_size(compression_type compression,
+                                 device_span<device_span<uint8_t const> const> inputs,
+                                 device_span<size_t> uncompressed_sizes,
+                                 rmm::cuda_stream_view stream)
+{
+  auto const [input_data_ptrs, input_data_sizes] =
+    create_batched_nvcomp_input_args(inputs, stream);
+  auto const nvcomp_status = batched_get_decompress_size_async(compression,
+                                                               input_data_ptrs.data(),
+                                                               input_data_sizes.data(),
+                                                               uncompressed_sizes.data(),
+                                                               inputs.size(),
+                                                               stream.value());
+  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+               "Unable to get uncompressed sizes for compressed chunks");
+}
+
 // Wrapper for nvcompBatched<format>CompressGetMaxOutputChunkSize
 size_t compress_max_output_chunk_size(compression_type compression,
                                       uint32_t max_uncompressed_chunk_bytes)
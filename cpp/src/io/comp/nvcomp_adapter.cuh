@@ -26,6 +26,7 @@
 #include <nvcomp.h>
 
 #include <optional>
+#include <utility>
 
 namespace cudf::io::detail::nvcomp {
 
@@ -47,6 +48,16 @@ batched_args create_batched_nvcomp_args(device_span<device_span<uint8_t const> c
                                         device_span<device_span<uint8_t> const> outputs,
                                         rmm::cuda_stream_view stream);
 
+/**
+ * @brief Split a list of input device spans into lists of pointers/sizes.
+ *
+ * @param[in] inputs List of input buffers
+ * @param[in] stream CUDA stream to use
+ */
+std::pair<rmm::device_uvector<void const*>, rmm::device_uvector<size_t>>
+create_batched_nvcomp_input_args(device_span<device_span<uint8_t const> const> inputs,
+                                 rmm::cuda_stream_view stream);
+
 /**
  * @brief Convert nvcomp statuses and output sizes into cuIO compression results.
  */
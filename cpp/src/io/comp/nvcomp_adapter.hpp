@@ -63,6 +63,21 @@ size_t batched_decompress_temp_size(compression_type compression,
                                     size_t max_uncomp_chunk_size,
                                     size_t max_total_uncomp_size);
 
+/**
+ * @brief Queries the uncompressed sizes of a batch of compressed chunks.
+ *
+ * Used by formats whose metadata does not record uncompressed block sizes (e.g. Avro).
+ *
+ * @param[in] compression Compression type
+ * @param[in] inputs List of input buffers
+ * @param[out] uncompressed_sizes Per-chunk uncompressed sizes
+ * @param[in] stream CUDA stream to use
+ */
+void batched_get_decompress_size(compression_type compression,
+                                 device_span<device_span<uint8_t const> const> inputs,
+                                 device_span<size_t> uncompressed_sizes,
+                                 rmm::cuda_stream_view stream);
+
 /**
  * @brief Gets the maximum size any chunk could compress to in the batch.
  *
@@ -26,7 +26,10 @@
 
 #include <zlib.h>  // uncompress
 
+#include <algorithm>
 #include <cstring>  // memset
+#include <future>
+#include <optional>
 
 namespace cudf::io::detail {
 
@@ -536,6 +539,71 @@ source_properties get_source_properties(compression_type compression, host_span<
   return source_properties{compression, comp_data, comp_len, uncomp_len};
 }
 
+/**
+ * @brief Attempts to decompress a multi-member GZIP stream with one task per member.
+ *
+ * Member boundaries are located by scanning for the GZIP magic bytes. Since the magic can also
+ * occur inside DEFLATE data, every candidate split is verified: each segment must parse as a
+ * complete member and inflate cleanly to its trailer's stated size. Returns std::nullopt if the
+ * stream has a single member or any segment fails, in which case the caller should use the
+ * sequential path.
+ */
+std::optional<std::vector<uint8_t>> decompress_gzip_members_parallel(host_span<uint8_t const> src)
+{
+  // The smallest possible member (empty payload) is 20 bytes, so members cannot start before that
+  auto constexpr min_member_size = size_t{20};
+  std::vector<size_t> starts{0};
+  for (size_t pos = min_member_size; pos + min_member_size <= src.size();) {
+    auto const* hit = static_cast<uint8_t const*>(
+      std::memchr(src.data() + pos, 0x1f, src.size() - min_member_size - pos + 1));
+    if (hit == nullptr) { break; }
+    pos = hit - src.data();
+    if (pos + min_member_size > src.size()) { break; }
+    if (src[pos + 1] == 0x8b and src[pos + 2] == 8) {
+      starts.push_back(pos);
+      pos += min_member_size;
+    } else {
+      ++pos;
+    }
+  }
+  if (starts.size() < 2) { return std::nullopt; }
+  starts.push_back(src.size());
+
+  // Parse each candidate member's header and trailer up front; bail out on implausible sizes
+  std::vector<gz_archive_s> members(starts.size() - 1);
+  size_t total_size = 0;
+  for (size_t i = 0; i + 1 < starts.size(); ++i) {
+    auto const member_len = starts[i + 1] - starts[i];
+    if (not ParseGZArchive(&members[i], src.data() + starts[i], member_len)) {
+      return std::nullopt;
+    }
+    // A wildly implausible uncompressed size means the "trailer" is DEFLATE data from a false
+    // split; give up early instead of allocating for it
+    if (members[i].isize > member_len * 1024 + 4096) { return std::nullopt; }
+    total_size += members[i].isize;
+  }
+
+  std::vector<uint8_t> dst(total_size);
+  std::vector<std::future<bool>> tasks;
+  tasks.reserve(members.size());
+  size_t dst_offset = 0;
+  for (auto const& member : members) {
+    tasks.push_back(std::async(std::launch::async, [&member, out = dst.data() + dst_offset] {
+      size_t out_size = member.isize;
+      return cpu_inflate(out, &out_size, member.comp_data, member.comp_len) == Z_OK and
+             out_size == member.isize;
+    }));
+    dst_offset += member.isize;
+  }
+  // Drain every task before judging the result so no task outlives `dst`
+  auto all_ok = true;
+  for (auto& task : tasks) {
+    all_ok = task.get() and all_ok;
+  }
+  if (not all_ok) { return std::nullopt; }
+  return dst;
+}
+
 }  // namespace
 
 size_t get_uncompressed_size(compression_type compression, host_span<uint8_t const> src)
@@ -573,6 +641,12 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
   }
 
   if (compression == compression_type::GZIP) {
+    // Concatenated members (e.g. from pigz or chunked uploads) decompress one task per member;
+    // the sequential path below would stop at the end of the first member anyway
+    if (auto parallel_result = decompress_gzip_members_parallel(src);
+        parallel_result.has_value()) {
+      return std::move(parallel_result.value());
+    }
     // INFLATE
     std::vector<uint8_t> dst(srcprops.uncomp_len);
     decompress_gzip(src, dst);
@@ -47,6 +47,7 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -1058,6 +1059,43 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
   return read_csv(source.get(), options, parse_options, stream, mr);
 }
 
+std::vector<size_t> compute_byte_range_splits(cudf::io::datasource* source,
+                                              size_type num_splits,
+                                              char terminator)
+{
+  CUDF_EXPECTS(source != nullptr, "Byte range splitting requires a source");
+  CUDF_EXPECTS(num_splits > 0, "Number of splits must be positive");
+
+  auto const total_size = source->size();
+  std::vector<size_t> offsets{0};
+  offsets.reserve(num_splits + 1);
+
+  // Window size for the boundary search; one window is almost always enough since it only needs
+  // to contain a single record terminator
+  auto constexpr window_size = size_t{1} << 20;
+
+  for (size_type split = 1; split < num_splits; ++split) {
+    auto target = total_size * split / num_splits;
+    // Advance the naive split point to just past the next record terminator
+    auto found = total_size;
+    while (target < total_size) {
+      auto const len    = std::min(window_size, total_size - target);
+      auto const buffer = source->host_read(target, len);
+      auto const* hit   = std::memchr(buffer->data(), terminator, buffer->size());
+      if (hit != nullptr) {
+        found = target + (static_cast<uint8_t const*>(hit) - buffer->data()) + 1;
+        break;
+      }
+      target += len;
+    }
+    // Clamp to keep the offsets monotonic; a range may come out empty if records are larger
+    // than the naive split size
+    offsets.push_back(std::max(std::min(found, total_size), offsets.back()));
+  }
+  offsets.push_back(total_size);
+  return offsets;
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -372,34 +372,10 @@ void write_chunked(data_sink* out_sink,
 
   CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
 
-  cudf::string_scalar newline{options.get_line_terminator(), true, stream};
-
-  // use strings concatenate to build the final CSV output in device memory
-  auto contents_w_nl = [&] {
-    auto const total_size =
-      str_column_view.chars_size(stream) + (newline.size() * str_column_view.size());
-    auto const empty_str = string_scalar("", true, stream);
-    // use join_strings when the output will be less than 2GB
-    if (total_size < static_cast<int64_t>(std::numeric_limits<size_type>::max())) {
-      return cudf::strings::detail::join_strings(str_column_view, newline, empty_str, stream, mr)
-        ->release();
-    }
-    auto nl_col = cudf::make_column_from_scalar(newline, str_column_view.size(), stream);
-    // convert the last element into an empty string by resetting the last offset value
-    auto& offsets     = nl_col->child(strings_column_view::offsets_column_index);
-    auto offsets_view = offsets.mutable_view();
-    cudf::fill_in_place(offsets_view,
-                        offsets.size() - 1,  // set the last element with
-                        offsets.size(),      // the value from 2nd to last element
-                        *cudf::detail::get_element(offsets.view(), offsets.size() - 2, stream, mr),
-                        stream);
-    auto const nl_tbl = cudf::table_view({str_column_view.parent(), nl_col->view()});
-    return cudf::strings::detail::concatenate(
-             nl_tbl, empty_str, empty_str, strings::separator_on_nulls::NO, stream, mr)
-      ->release();
-  }();
-  auto const total_num_bytes = contents_w_nl.data->size();
-  auto const ptr_all_bytes   = static_cast<char const*>(contents_w_nl.data->data());
+  // Each row already ends with the line terminator (appended during the row concatenation), so
+  // the column's contiguous character buffer is exactly the CSV output for this chunk
+  auto const total_num_bytes = static_cast<size_t>(str_column_view.chars_size(stream));
+  auto const ptr_all_bytes   = str_column_view.chars_begin(stream);
 
   if (out_sink->is_device_write_preferred(total_num_bytes)) {
     // Direct write from device memory
@@ -411,14 +387,6 @@ void write_chunked(data_sink* out_sink,
 
     out_sink->host_write(h_bytes.data(), total_num_bytes);
   }
-
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink->is_device_write_preferred(newline.size())) {
-    out_sink->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink->host_write(options.get_line_terminator().data(),
-                         options.get_line_terminator().size());
-  }
 }
 
 void write_csv(data_sink* out_sink,
@@ -482,6 +450,26 @@ void write_csv(data_sink* out_sink,
             current_col.type(), converter, current_col);
         });
 
+      // append the line terminator to the last column so that the row concatenation below
+      // produces rows that are already terminated; this makes an extra join pass over the
+      // whole output (and its output-sized allocation) unnecessary
+      {
+        cudf::string_scalar const empty_str{"", true, stream};
+        cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
+        auto const nl_col = cudf::make_column_from_scalar(
+          cudf::string_scalar{options.get_line_terminator(), true, stream},
+          sub_view.num_rows(),
+          stream);
+        auto const last_with_nl = cudf::table_view{{str_column_vec.back()->view(), nl_col->view()}};
+        str_column_vec.back()   = cudf::strings::detail::concatenate(
+          last_with_nl,
+          empty_str,
+          options_narep,
+          strings::separator_on_nulls::YES,
+          stream,
+          cudf::get_current_device_resource_ref());
+      }
+
       // create string table view from str_column_vec:
       //
       auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
@@ -490,19 +478,20 @@ void write_csv(data_sink* out_sink,
       // concatenate columns in each row into one big string column
       // (using null representation and delimiter):
       //
-      auto str_concat_col = [&] {
-        cudf::string_scalar delimiter_str{
-          std::string{options.get_inter_column_delimiter()}, true, stream};
-        cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
-        if (str_table_view.num_columns() > 1)
+      auto str_concat_col = [&]() -> std::unique_ptr<column> {
+        if (str_table_view.num_columns() > 1) {
+          cudf::string_scalar delimiter_str{
+            std::string{options.get_inter_column_delimiter()}, true, stream};
+          cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
           return cudf::strings::detail::concatenate(str_table_view,
                                                     delimiter_str,
                                                     options_narep,
                                                     strings::separator_on_nulls::YES,
                                                     stream,
                                                     cudf::get_current_device_resource_ref());
-        return cudf::strings::detail::replace_nulls(
-          str_table_view.column(0), options_narep, stream, cudf::get_current_device_resource_ref());
+        }
+        // single column: the terminator append above already replaced any nulls
+        return std::move(str_table_ptr->release().front());
       }();
 
       write_chunked(
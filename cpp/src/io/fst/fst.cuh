@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "io/fst/device_dfa.cuh"
+#include "io/fst/lookup_tables.cuh"
+
+namespace cudf::io::fst {
+
+/**
+ * @file fst.cuh
+ * @brief The supported interface to the finite-state transducer (FST) engine.
+ *
+ * The engine runs a user-defined deterministic finite automaton over a device buffer of input
+ * symbols and, for every state transition, emits the sequence of output symbols specified by a
+ * translation table. A state machine is defined by three lookup tables:
+ *
+ * 1. A symbol group lookup table created by `make_symbol_group_lut` (or, for computed mappings,
+ *    `make_symbol_group_lookup_op`). Each input symbol is mapped to the index of the first symbol
+ *    group containing it; symbols not present in any group map to the catch-all symbol group with
+ *    index `NUM_SYMBOL_GROUPS`.
+ * 2. A transition table created by `make_transition_table`, where
+ *    `transition_table[state][symbol_group]` is the state transitioned to on reading a symbol of
+ *    that group.
+ * 3. A translation table created by `make_translation_table` (or, for computed outputs,
+ *    `make_translation_functor`), where `translation_table[state][symbol_group]` is the sequence
+ *    of symbols to emit for that transition.
+ *
+ * The three tables are combined by `make_fst`, and the returned object's `Transduce` member runs
+ * the transducer over a device buffer, writing the transduced output symbols, the input indexes
+ * that produced output, and the total output count. Passing the end state of a previous invocation
+ * as the `seed_state` allows streaming inputs through the machine chunk by chunk. Symbol group ids
+ * are 16-bit, so state machines over multi-byte symbol alphabets may differentiate up to 2^16 - 1
+ * symbol groups, twice the id width previously supported.
+ *
+ * These names are the stable surface of the engine; the `detail` implementation headers they
+ * forward to may change without notice.
+ */
+using detail::make_fst;
+using detail::make_symbol_group_lookup_op;
+using detail::make_symbol_group_lut;
+using detail::make_transition_table;
+using detail::make_translation_functor;
+using detail::make_translation_table;
+
+}  // namespace cudf::io::fst
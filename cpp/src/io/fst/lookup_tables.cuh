@@ -58,8 +58,10 @@ struct IdentityOp {
 template <typename SymbolT, typename PreMapOpT>
 class SingleSymbolSmemLUT {
  private:
-  // Type used for representing a symbol group id (i.e., what we return for a given symbol)
-  using SymbolGroupIdT = uint8_t;
+  // Type used for representing a symbol group id (i.e., what we return for a given symbol). A
+  // 16-bit id supports up to 2^16 - 1 symbol groups for state machines over multi-byte symbol
+  // alphabets.
+  using SymbolGroupIdT = uint16_t;
 
   // Number of entries for every lookup (e.g., for 8-bit Symbol this is 256)
   static constexpr uint32_t NUM_ENTRIES_PER_LUT = 0x01U << (sizeof(SymbolT) * 8U);
@@ -134,7 +136,7 @@ class SingleSymbolSmemLUT {
   }
 
   _TempStorage& temp_storage;
-  SymbolGroupIdT num_valid_entries;
+  uint32_t num_valid_entries;
   PreMapOpT pre_map_op;
 
   __device__ __forceinline__ _TempStorage& PrivateStorage()
@@ -15,9 +15,19 @@
  */
 
 #include "io/orc/orc.hpp"
+#include "io/parquet/reader_impl_helpers.hpp"
+#include "io/utilities/getenv_or.hpp"
 
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/io/avro.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/data_sink.hpp>
@@ -540,12 +550,180 @@ void orc_chunked_writer::close()
 using namespace cudf::io::parquet::detail;
 namespace detail_parquet = cudf::io::parquet::detail;
 
+namespace {
+
+/**
+ * @brief Attempt a two-pass "late materialization" Parquet read.
+ *
+ * Decodes only the columns referenced by the filter expression, evaluates the predicate, and
+ * then reads the remaining output columns over the narrowed row range spanned by the surviving
+ * rows before gathering them. For selective filters this avoids decoding the bulk of the
+ * payload column bytes, since the narrowed row bounds allow the reader to skip pages outside
+ * the range entirely (via the page index, when present).
+ *
+ * Opt-in via the LIBCUDF_PARQUET_LATE_MATERIALIZATION environment variable.
+ *
+ * @return The result table, or std::nullopt if the options are not amenable and the caller
+ * should use the single-pass reader
+ */
+std::optional<table_with_metadata> read_parquet_late_materialized(
+  parquet_reader_options const& options,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  static bool const enabled = getenv_or("LIBCUDF_PARQUET_LATE_MATERIALIZATION", 0) != 0;
+  if (not enabled or not options.get_filter().has_value() or
+      not options.get_columns().has_value() or options.get_column_schema().has_value()) {
+    return std::nullopt;
+  }
+
+  auto const& output_names = options.get_columns().value();
+  // nested column paths are selected with dotted names; punt those to the single-pass reader
+  if (std::any_of(output_names.cbegin(), output_names.cend(), [](std::string const& name) {
+        return name.find('.') != std::string::npos;
+      })) {
+    return std::nullopt;
+  }
+
+  auto const filter_names =
+    detail_parquet::get_column_names_in_expression(options.get_filter(), {});
+  std::vector<std::string> payload_names;
+  std::copy_if(output_names.cbegin(),
+               output_names.cend(),
+               std::back_inserter(payload_names),
+               [&](std::string const& name) {
+                 return std::find(filter_names.cbegin(), filter_names.cend(), name) ==
+                        filter_names.cend();
+               });
+  // nothing to late-materialize if every output column already feeds the predicate
+  if (filter_names.empty() or payload_names.empty()) { return std::nullopt; }
+
+  auto const make_pass_options = [&](std::vector<std::string> cols) {
+    return parquet_reader_options::builder(options.get_source())
+      .columns(std::move(cols))
+      .row_groups(options.get_row_groups())
+      .convert_strings_to_categories(options.is_enabled_convert_strings_to_categories())
+      .use_pandas_metadata(options.is_enabled_use_pandas_metadata())
+      .use_arrow_schema(options.is_enabled_use_arrow_schema())
+      .allow_mismatched_pq_schemas(options.is_enabled_allow_mismatched_pq_schemas())
+      .timestamp_type(options.get_timestamp_type())
+      .build();
+  };
+
+  // pass 1: decode only the filter columns, over the user-requested row bounds
+  auto pass1_options = make_pass_options(filter_names);
+  pass1_options.set_skip_rows(options.get_skip_rows());
+  if (options.get_num_rows().has_value()) {
+    pass1_options.set_num_rows(options.get_num_rows().value());
+  }
+  auto filter_result = detail_parquet::reader(make_datasources(options.get_source()),
+                                              pass1_options,
+                                              stream,
+                                              cudf::get_current_device_resource_ref())
+                         .read();
+
+  // evaluate the predicate on the decoded filter columns
+  auto converter = named_to_reference_converter(options.get_filter(), filter_result.metadata);
+  auto predicate = cudf::detail::compute_column(filter_result.tbl->view(),
+                                                converter.get_converted_expr().value().get(),
+                                                stream,
+                                                cudf::get_current_device_resource_ref());
+  CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+               "Predicate filter should return a boolean");
+
+  // row indices (relative to the requested row bounds) that survive the predicate
+  auto iota      = cudf::detail::sequence(filter_result.tbl->num_rows(),
+                                     numeric_scalar<size_type>(0, true, stream),
+                                     stream,
+                                     cudf::get_current_device_resource_ref());
+  auto surviving = cudf::detail::apply_boolean_mask(table_view{{iota->view()}},
+                                                    predicate->view(),
+                                                    stream,
+                                                    cudf::get_current_device_resource_ref());
+  auto const surviving_rows = surviving->get_column(0).view();
+
+  // narrow the payload read to the bounding row range of the surviving rows
+  size_type first_row         = 0;
+  size_type narrowed_num_rows = 0;
+  if (surviving_rows.size() > 0) {
+    auto const first = cudf::detail::get_element(
+      surviving_rows, 0, stream, cudf::get_current_device_resource_ref());
+    auto const last = cudf::detail::get_element(
+      surviving_rows, surviving_rows.size() - 1, stream, cudf::get_current_device_resource_ref());
+    first_row = static_cast<numeric_scalar<size_type> const&>(*first).value(stream);
+    narrowed_num_rows =
+      static_cast<numeric_scalar<size_type> const&>(*last).value(stream) - first_row + 1;
+  }
+
+  // pass 2: decode the payload columns over the narrowed range only
+  auto pass2_options = make_pass_options(payload_names);
+  pass2_options.set_skip_rows(options.get_skip_rows() + first_row);
+  pass2_options.set_num_rows(narrowed_num_rows);
+  auto payload_result = detail_parquet::reader(make_datasources(options.get_source()),
+                                               pass2_options,
+                                               stream,
+                                               cudf::get_current_device_resource_ref())
+                          .read();
+
+  // gather the surviving rows from both passes
+  auto filter_gathered = cudf::detail::gather(filter_result.tbl->view(),
+                                              surviving_rows,
+                                              out_of_bounds_policy::DONT_CHECK,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              stream,
+                                              mr);
+  auto payload_map     = cudf::detail::binary_operation(surviving_rows,
+                                                    numeric_scalar<size_type>(first_row, true, stream),
+                                                    binary_operator::SUB,
+                                                    data_type{type_to_id<size_type>()},
+                                                    stream,
+                                                    cudf::get_current_device_resource_ref());
+  auto payload_gathered = cudf::detail::gather(payload_result.tbl->view(),
+                                               payload_map->view(),
+                                               out_of_bounds_policy::DONT_CHECK,
+                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               stream,
+                                               mr);
+
+  // re-assemble the output columns in the requested order
+  auto filter_columns  = filter_gathered->release();
+  auto payload_columns = payload_gathered->release();
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata out_metadata;
+  out_columns.reserve(output_names.size());
+  out_metadata.schema_info.reserve(output_names.size());
+  for (auto const& name : output_names) {
+    auto const filter_pos = std::find(filter_names.cbegin(), filter_names.cend(), name);
+    if (filter_pos != filter_names.cend()) {
+      auto const idx = std::distance(filter_names.cbegin(), filter_pos);
+      out_columns.emplace_back(std::move(filter_columns[idx]));
+      out_metadata.schema_info.push_back(filter_result.metadata.schema_info[idx]);
+    } else {
+      auto const idx = std::distance(
+        payload_names.cbegin(), std::find(payload_names.cbegin(), payload_names.cend(), name));
+      out_columns.emplace_back(std::move(payload_columns[idx]));
+      out_metadata.schema_info.push_back(payload_result.metadata.schema_info[idx]);
+    }
+  }
+  out_metadata.user_data          = std::move(payload_result.metadata.user_data);
+  out_metadata.per_file_user_data = std::move(payload_result.metadata.per_file_user_data);
+
+  return table_with_metadata{std::make_unique<table>(std::move(out_columns)),
+                             std::move(out_metadata)};
+}
+
+}  // anonymous namespace
+
 table_with_metadata read_parquet(parquet_reader_options const& options,
                                  rmm::cuda_stream_view stream,
                                  rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
 
+  if (auto result = read_parquet_late_materialized(options, stream, mr); result.has_value()) {
+    return std::move(result).value();
+  }
+
   auto datasources = make_datasources(options.get_source());
   auto reader =
     std::make_unique<detail_parquet::reader>(std::move(datasources), options, stream, mr);
@@ -553,6 +731,14 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read();
 }
 
+stream_future<table_with_metadata> read_parquet_async(parquet_reader_options const& options,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return {read_parquet(options, stream, mr), stream};
+}
+
 parquet_metadata read_parquet_metadata(source_info const& src_info)
 {
   CUDF_FUNC_RANGE();
@@ -30,6 +30,7 @@
 #include <cudf/utilities/memory_resource.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_device.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
@@ -135,20 +136,26 @@ std::size_t estimate_size_per_subchunk(std::size_t chunk_size)
  * @brief Return the upper bound on the batch size for the JSON reader.
  *
  * The datasources passed to the JSON reader are split into batches demarcated by byte range
- * offsets and read iteratively. The batch size is capped at INT_MAX bytes, which is the
- * default value returned by the function. This value can be overridden at runtime using the
- * environment variable LIBCUDF_JSON_BATCH_SIZE
+ * offsets and read iteratively. The batch size is capped at INT_MAX bytes and, since
+ * normalization and tokenization inflate the input several times over in device memory, at a
+ * fraction of the currently free device memory. The value can be overridden at runtime using
+ * the environment variable LIBCUDF_JSON_BATCH_SIZE
  *
  * @return size in bytes
  */
 std::size_t get_batch_size_upper_bound()
 {
-  auto const batch_size_str         = std::getenv("LIBCUDF_JSON_BATCH_SIZE");
-  int64_t const batch_size          = batch_size_str != nullptr ? std::atol(batch_size_str) : 0L;
-  auto const batch_limit            = static_cast<int64_t>(std::numeric_limits<int32_t>::max());
-  auto const batch_size_upper_bound = static_cast<std::size_t>(
-    (batch_size > 0 && batch_size < batch_limit) ? batch_size : batch_limit);
-  return batch_size_upper_bound;
+  auto const batch_size_str = std::getenv("LIBCUDF_JSON_BATCH_SIZE");
+  int64_t const batch_size  = batch_size_str != nullptr ? std::atol(batch_size_str) : 0L;
+  auto const batch_limit    = static_cast<int64_t>(std::numeric_limits<int32_t>::max());
+  if (batch_size > 0 && batch_size < batch_limit) { return static_cast<std::size_t>(batch_size); }
+  // Scale the default with the device so that small GPUs do not run out of memory processing a
+  // batch; the floor keeps the batch count reasonable when memory is mostly occupied
+  auto const [free_memory, total_memory] = rmm::available_device_memory();
+  auto constexpr memory_fraction         = std::size_t{4};
+  auto constexpr min_default_batch_size  = std::size_t{256} << 20;  // 256MB
+  return std::min(static_cast<std::size_t>(batch_limit),
+                  std::max(free_memory / memory_fraction, min_default_batch_size));
 }
 
 /**
@@ -18,6 +18,10 @@
 
 #include "orc.hpp"
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <functional>
 #include <map>
 #include <optional>
 #include <vector>
@@ -129,6 +133,28 @@ class aggregate_orc_metadata {
     std::optional<size_type> const& num_read_rows,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Filters the list of stripes to read using column statistics and a predicate.
+   *
+   * Stripes whose statistics prove that no row can match the predicate are removed from the
+   * selection. Statistics are optional in ORC files; stripes without statistics are always kept,
+   * and `nullopt` is returned when no stripe could be pruned (so that callers can keep the
+   * original selection untouched).
+   *
+   * @param user_specified_stripes The specified stripe indices to read; empty means all stripes
+   * @param output_dtypes Datatypes of the output columns
+   * @param output_column_ids ORC column ids of the output columns
+   * @param filter AST expression to filter output rows, referencing output columns by index
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Surviving stripe indices per source if any stripe was pruned, `nullopt` otherwise
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_stripes(
+    std::vector<std::vector<size_type>> const& user_specified_stripes,
+    host_span<data_type const> output_dtypes,
+    host_span<size_type const> output_column_ids,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
@@ -109,6 +109,9 @@ CUDF_KERNEL void __launch_bounds__(block_size)
   auto& dict            = dictionaries[col_idx][stripe_idx];
   auto const& col       = columns[dict.column_idx];
 
+  // Columns skipped by the cardinality pre-check have no hash map storage
+  if (dict.map_slots.empty()) { return; }
+
   // Make a view of the hash map
   auto const hash_fn     = hash_functor{col};
   auto const equality_fn = equality_functor{col};
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "aggregate_orc_metadata.hpp"
+#include "orc.hpp"
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+namespace cudf::io::orc::detail {
+
+namespace {
+
+/**
+ * @brief Converts parsed stripe statistics into 2 device columns - min, max values.
+ *
+ * Unlike Parquet, ORC statistics are stored as typed protobuf messages rather than binary blobs,
+ * so values are extracted from the already-parsed `column_statistics` optionals.
+ */
+struct stats_caster {
+  size_type total_stripes;
+  std::vector<metadata> const& per_file_metadata;
+  host_span<std::vector<size_type> const> stripe_indices;
+
+  /**
+   * @brief Extracts the minimum or maximum value of the statistics as the target type.
+   *
+   * Returns `nullopt` when the statistics do not carry a usable bound for the target type, which
+   * marks the corresponding entry null and thus never prunes the stripe.
+   */
+  template <typename T>
+  static std::optional<T> extract(column_statistics const& stats, bool get_min)
+  {
+    if constexpr (cudf::is_integral<T>() and not cudf::is_boolean<T>()) {
+      // Decimal columns dispatch here through their storage type but carry string-encoded
+      // `decimal_stats`; they yield nullopt and are never pruned.
+      if (stats.int_stats) {
+        auto const& value = get_min ? stats.int_stats->minimum : stats.int_stats->maximum;
+        if (value.has_value()) { return static_cast<T>(*value); }
+      }
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      if (stats.double_stats) {
+        auto const& value = get_min ? stats.double_stats->minimum : stats.double_stats->maximum;
+        if (value.has_value()) { return static_cast<T>(*value); }
+      }
+    } else if constexpr (std::is_same_v<T, string_view>) {
+      if (stats.string_stats) {
+        auto const& value = get_min ? stats.string_stats->minimum : stats.string_stats->maximum;
+        if (value.has_value()) {
+          return string_view{value->data(), static_cast<size_type>(value->size())};
+        }
+      }
+    } else if constexpr (cudf::is_timestamp<T>()) {
+      using cuda::std::chrono::ceil;
+      using cuda::std::chrono::floor;
+      using cuda::std::chrono::milliseconds;
+      if (stats.timestamp_stats) {
+        // The UTC bounds are in milliseconds; the sub-millisecond part is not applied here, so
+        // the maximum is padded by one millisecond to remain an upper bound.
+        if (get_min and stats.timestamp_stats->minimum_utc.has_value()) {
+          return T{floor<typename T::duration>(milliseconds{*stats.timestamp_stats->minimum_utc})};
+        }
+        if (not get_min and stats.timestamp_stats->maximum_utc.has_value()) {
+          return T{
+            ceil<typename T::duration>(milliseconds{*stats.timestamp_stats->maximum_utc + 1})};
+        }
+      } else if (stats.date_stats) {
+        using days = cuda::std::chrono::duration<int32_t, cuda::std::ratio<86400>>;
+        auto const& value = get_min ? stats.date_stats->minimum : stats.date_stats->maximum;
+        if (value.has_value()) {
+          return get_min ? T{floor<typename T::duration>(days{*value})}
+                         : T{ceil<typename T::duration>(days{*value})};
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Creates device columns from stripe statistics (min, max)
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    size_type column_id,
+    cudf::data_type dtype,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const
+  {
+    // List, Struct, Dictionary types are not supported
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
+    } else {
+      // Local struct to hold host columns
+      struct host_column {
+        // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
+        cudf::detail::host_vector<T> val;
+        std::vector<bitmask_type> null_mask;
+        cudf::size_type null_count = 0;
+        host_column(size_type total_stripes, rmm::cuda_stream_view stream)
+          : val{cudf::detail::make_host_vector<T>(total_stripes, stream)},
+            null_mask(cudf::util::div_rounding_up_safe<size_type>(
+                        cudf::bitmask_allocation_size_bytes(total_stripes), sizeof(bitmask_type)),
+                      ~bitmask_type{0})
+        {
+        }
+
+        void set_index(size_type index, std::optional<T> const& value)
+        {
+          if (value.has_value()) {
+            val[index] = *value;
+          } else {
+            clear_bit_unsafe(null_mask.data(), index);
+            null_count++;
+          }
+        }
+
+        static auto make_strings_children(host_span<string_view> host_strings,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+        {
+          auto const total_char_count = std::accumulate(
+            host_strings.begin(), host_strings.end(), 0, [](auto sum, auto const& str) {
+              return sum + str.size_bytes();
+            });
+          auto chars = cudf::detail::make_empty_host_vector<char>(total_char_count, stream);
+          auto offsets =
+            cudf::detail::make_empty_host_vector<cudf::size_type>(host_strings.size() + 1, stream);
+          offsets.push_back(0);
+          for (auto const& str : host_strings) {
+            auto tmp =
+              str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
+            chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
+            offsets.push_back(offsets.back() + tmp.length());
+          }
+          auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+          auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+          return std::tuple{std::move(d_chars), std::move(d_offsets)};
+        }
+
+        auto to_device(cudf::data_type dtype,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+        {
+          if constexpr (std::is_same_v<T, string_view>) {
+            auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
+            return cudf::make_strings_column(
+              val.size(),
+              std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+              d_chars.release(),
+              null_count,
+              rmm::device_buffer{
+                null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
+          }
+          return std::make_unique<column>(
+            dtype,
+            val.size(),
+            cudf::detail::make_device_uvector_async(val, stream, mr).release(),
+            rmm::device_buffer{
+              null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
+            null_count);
+        }
+      };  // local struct host_column
+      host_column min(total_stripes, stream);
+      host_column max(total_stripes, stream);
+      // Parsed statistics are kept alive until the host columns are copied to device, since
+      // extracted string bounds reference the parsed messages.
+      std::vector<std::optional<column_statistics>> parsed_stats(total_stripes);
+      size_type stats_idx = 0;
+      for (size_t src_idx = 0; src_idx < stripe_indices.size(); ++src_idx) {
+        auto const& stripe_stats = per_file_metadata[src_idx].md.stripeStats;
+        for (auto const stripe_idx : stripe_indices[src_idx]) {
+          if (static_cast<size_t>(stripe_idx) < stripe_stats.size() and
+              static_cast<size_t>(column_id) < stripe_stats[stripe_idx].colStats.size() and
+              not stripe_stats[stripe_idx].colStats[column_id].empty()) {
+            auto const& blob = stripe_stats[stripe_idx].colStats[column_id];
+            column_statistics stats;
+            ProtobufReader(blob.data(), blob.size()).read(stats);
+            parsed_stats[stats_idx] = std::move(stats);
+            min.set_index(stats_idx, extract<T>(*parsed_stats[stats_idx], true));
+            max.set_index(stats_idx, extract<T>(*parsed_stats[stats_idx], false));
+          } else {
+            // Statistics are optional in ORC; stripes without them are never pruned.
+            min.set_index(stats_idx, std::nullopt);
+            max.set_index(stats_idx, std::nullopt);
+          }
+          stats_idx++;
+        }
+      }
+      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
+    }
+  }
+};
+
+/**
+ * @brief Converts AST expression to StatsAST for comparing with column statistics.
+ *
+ * This mirrors the Parquet reader's statistics AST rewrite: the statistics min value of column
+ * `i` is referenced by column index `i * 2`, the max value by `i * 2 + 1`.
+ */
+class stats_expression_converter : public ast::detail::expression_transformer {
+ public:
+  stats_expression_converter(ast::expression const& expr, size_type const& num_columns)
+    : _num_columns{num_columns}
+  {
+    expr.accept(*this);
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
+                 "Statistics AST supports only left table");
+    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
+                 "Column index cannot be more than number of columns in the table");
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    CUDF_FAIL("Column name reference is not supported in statistics AST");
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    using cudf::ast::ast_operator;
+    auto const operands = expr.get_operands();
+    auto const op       = expr.get_operator();
+
+    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
+      // First operand should be column reference, second should be literal.
+      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
+                   "Only binary operations are supported on column reference");
+      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
+                   "Second operand of binary operation with column reference must be a literal");
+      v->accept(*this);
+      // Push literal into the ast::tree
+      auto const& literal =
+        _stats_expr.push(*dynamic_cast<ast::literal const*>(&operands[1].get()));
+      auto const col_index = v->get_column_index();
+      switch (op) {
+        /* transform to stats conditions. op(col, literal)
+        col1 == val --> vmin <= val && vmax >= val
+        col1 != val --> !(vmin == val && vmax == val)
+        col1 >  val --> vmax > val
+        col1 <  val --> vmin < val
+        col1 >= val --> vmax >= val
+        col1 <= val --> vmin <= val
+        */
+        case ast_operator::EQUAL: {
+          auto const& vmin = _stats_expr.push(ast::column_reference{col_index * 2});
+          auto const& vmax = _stats_expr.push(ast::column_reference{col_index * 2 + 1});
+          _stats_expr.push(ast::operation{
+            ast::ast_operator::LOGICAL_AND,
+            _stats_expr.push(ast::operation{ast_operator::GREATER_EQUAL, vmax, literal}),
+            _stats_expr.push(ast::operation{ast_operator::LESS_EQUAL, vmin, literal})});
+          break;
+        }
+        case ast_operator::NOT_EQUAL: {
+          auto const& vmin = _stats_expr.push(ast::column_reference{col_index * 2});
+          auto const& vmax = _stats_expr.push(ast::column_reference{col_index * 2 + 1});
+          _stats_expr.push(ast::operation{
+            ast_operator::LOGICAL_OR,
+            _stats_expr.push(ast::operation{ast_operator::NOT_EQUAL, vmin, vmax}),
+            _stats_expr.push(ast::operation{ast_operator::NOT_EQUAL, vmax, literal})});
+          break;
+        }
+        case ast_operator::LESS: [[fallthrough]];
+        case ast_operator::LESS_EQUAL: {
+          auto const& vmin = _stats_expr.push(ast::column_reference{col_index * 2});
+          _stats_expr.push(ast::operation{op, vmin, literal});
+          break;
+        }
+        case ast_operator::GREATER: [[fallthrough]];
+        case ast_operator::GREATER_EQUAL: {
+          auto const& vmax = _stats_expr.push(ast::column_reference{col_index * 2 + 1});
+          _stats_expr.push(ast::operation{op, vmax, literal});
+          break;
+        }
+        default: CUDF_FAIL("Unsupported operation in Statistics AST");
+      };
+    } else {
+      auto new_operands = visit_operands(operands);
+      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
+        _stats_expr.push(ast::operation{op, new_operands.front(), new_operands.back()});
+      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
+        _stats_expr.push(ast::operation{op, new_operands.front()});
+      }
+    }
+    return _stats_expr.back();
+  }
+
+  /**
+   * @brief Returns the AST to apply on stripe statistics.
+   *
+   * @return AST operation expression
+   */
+  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
+  {
+    return _stats_expr.back();
+  }
+
+ private:
+  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
+    cudf::host_span<std::reference_wrapper<ast::expression const> const> operands)
+  {
+    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
+    for (auto const& operand : operands) {
+      auto const new_operand = operand.get().accept(*this);
+      transformed_operands.push_back(new_operand);
+    }
+    return transformed_operands;
+  }
+  ast::tree _stats_expr;
+  size_type _num_columns;
+};
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_orc_metadata::filter_stripes(
+  std::vector<std::vector<size_type>> const& user_specified_stripes,
+  host_span<data_type const> output_dtypes,
+  host_span<size_type const> output_column_ids,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  // Stripe statistics live in the optional metadata section; without them nothing can be pruned.
+  if (std::any_of(per_file_metadata.cbegin(), per_file_metadata.cend(), [](auto const& meta) {
+        return meta.md.stripeStats.empty();
+      })) {
+    return std::nullopt;
+  }
+
+  auto mr = cudf::get_current_device_resource_ref();
+  // Create stripe indices.
+  std::vector<std::vector<size_type>> filtered_stripe_indices;
+  std::vector<std::vector<size_type>> all_stripe_indices;
+  host_span<std::vector<size_type> const> input_stripe_indices;
+  if (user_specified_stripes.empty()) {
+    std::transform(per_file_metadata.cbegin(),
+                   per_file_metadata.cend(),
+                   std::back_inserter(all_stripe_indices),
+                   [](auto const& file_meta) {
+                     std::vector<size_type> stripe_idx(file_meta.ff.stripes.size());
+                     std::iota(stripe_idx.begin(), stripe_idx.end(), 0);
+                     return stripe_idx;
+                   });
+    input_stripe_indices = host_span<std::vector<size_type> const>(all_stripe_indices);
+  } else {
+    input_stripe_indices = user_specified_stripes;
+  }
+  auto const total_stripes = std::accumulate(input_stripe_indices.begin(),
+                                             input_stripe_indices.end(),
+                                             0,
+                                             [](size_type sum, auto const& per_file_stripes) {
+                                               return sum + per_file_stripes.size();
+                                             });
+
+  // Converts stripe statistics to a table
+  // where min(col[i]) = columns[i*2], max(col[i]) = columns[i*2+1]
+  // For each column, it contains one row per candidate stripe across all sources.
+  std::vector<std::unique_ptr<column>> columns;
+  stats_caster const stats_col{total_stripes, per_file_metadata, input_stripe_indices};
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const column_id = output_column_ids[col_idx];
+    auto const& dtype    = output_dtypes[col_idx];
+    // Only comparable types except fixed point are supported.
+    if (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING) {
+      // placeholder only for unsupported types.
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, total_stripes, rmm::device_buffer{}, 0, stream, mr));
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, total_stripes, rmm::device_buffer{}, 0, stream, mr));
+      continue;
+    }
+    auto [min_col, max_col] =
+      cudf::type_dispatcher<dispatch_storage_type>(dtype, stats_col, column_id, dtype, stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto stats_table = cudf::table(std::move(columns));
+
+  // Converts AST to StatsAST with reference to min, max columns in above `stats_table`.
+  stats_expression_converter const stats_expr{filter.get(),
+                                              static_cast<size_type>(output_dtypes.size())};
+  auto stats_ast     = stats_expr.get_stats_expr();
+  auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
+  auto predicate     = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+
+  auto const host_bitmask = [&] {
+    auto const num_bitmasks = num_bitmask_words(predicate.size());
+    if (predicate.nullable()) {
+      return cudf::detail::make_host_vector_sync(
+        device_span<bitmask_type const>(predicate.null_mask(), num_bitmasks), stream);
+    } else {
+      auto bitmask = cudf::detail::make_host_vector<bitmask_type>(num_bitmasks, stream);
+      std::fill(bitmask.begin(), bitmask.end(), ~bitmask_type{0});
+      return bitmask;
+    }
+  }();
+
+  auto validity_it = cudf::detail::make_counting_transform_iterator(
+    0, [bitmask = host_bitmask.data()](auto bit_index) { return bit_is_set(bitmask, bit_index); });
+
+  auto const is_stripe_required = cudf::detail::make_host_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  // if all are required or all are nulls, nothing was filtered.
+  if (std::all_of(is_stripe_required.cbegin(),
+                  is_stripe_required.cend(),
+                  [](auto i) { return bool(i); }) or
+      predicate.null_count() == predicate.size()) {
+    return std::nullopt;
+  }
+
+  size_type is_required_idx = 0;
+  for (auto const& input_stripe_index : input_stripe_indices) {
+    std::vector<size_type> filtered_stripes;
+    for (auto const stripe_idx : input_stripe_index) {
+      // Keep a stripe when the predicate is null (unknown) or evaluates to true.
+      if ((!validity_it[is_required_idx]) || is_stripe_required[is_required_idx]) {
+        filtered_stripes.push_back(stripe_idx);
+      }
+      ++is_required_idx;
+    }
+    filtered_stripe_indices.push_back(std::move(filtered_stripes));
+  }
+  return {std::move(filtered_stripe_indices)};
+}
+
+}  // namespace cudf::io::orc::detail
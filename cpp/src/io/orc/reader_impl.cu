@@ -19,6 +19,8 @@
 #include "io/orc/reader_impl_helpers.hpp"
 
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
 
 #include <algorithm>
 
@@ -102,7 +104,21 @@ table_with_metadata reader_impl::make_output_chunk()
     return output;
   };
 
-  return {make_output_table(), table_metadata{_out_metadata} /*copy cached metadata*/};
+  auto output_table = make_output_table();
+
+  // Stripe pruning with statistics is conservative; apply the filter exactly on the decoded rows.
+  if (_options.filter.has_value()) {
+    auto const predicate = cudf::detail::compute_column(output_table->view(),
+                                                        _options.filter.value().get(),
+                                                        _stream,
+                                                        cudf::get_current_device_resource_ref());
+    CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+                 "Filter expression must return a boolean column");
+    output_table =
+      cudf::detail::apply_boolean_mask(output_table->view(), predicate->view(), _stream, _mr);
+  }
+
+  return {std::move(output_table), table_metadata{_out_metadata} /*copy cached metadata*/};
 }
 
 table_metadata reader_impl::get_meta_with_user_data()
@@ -173,7 +189,8 @@ reader_impl::reader_impl(std::size_t chunk_read_limit,
              options.get_decimal128_columns(),
              options.get_skip_rows(),
              options.get_num_rows(),
-             options.get_stripes()},
+             options.get_stripes(),
+             options.get_filter()},
     _col_meta{std::make_unique<reader_column_meta>()},
     _sources(std::move(sources)),
     _metadata{_sources, stream},
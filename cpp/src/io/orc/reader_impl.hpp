@@ -28,6 +28,8 @@
 
 #include <io/utilities/column_buffer.hpp>
 
+#include <future>
+#include <map>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -139,6 +141,17 @@ class reader_impl {
    */
   void load_next_stripe_data(read_mode mode);
 
+  /**
+   * @brief Start reading the next load range's stripe data from the sources on a background
+   * thread.
+   *
+   * Only host-side source reads are prefetched; they run while the current range is being
+   * decompressed and decoded, and `load_next_stripe_data()` adopts the buffers when it reaches
+   * that range. This is a no-op unless the `LIBCUDF_ORC_PIPELINED_READ` environment variable is
+   * set, or if there are no more stripes to load.
+   */
+  void prefetch_next_stripe_data();
+
   /**
    * @brief Decompress and decode stripe data in the internal buffers, and store the result into
    * an intermediate table.
@@ -178,6 +191,9 @@ class reader_impl {
     int64_t const skip_rows;
     std::optional<int64_t> num_read_rows;
     std::vector<std::vector<size_type>> const selected_stripes;
+
+    // AST filter; prunes stripes using statistics and filters output rows exactly
+    std::optional<std::reference_wrapper<ast::expression const>> filter;
   } const _options;
 
   // Intermediate data for reading.
@@ -193,6 +209,16 @@ class reader_impl {
   table_metadata _out_metadata;
   std::vector<std::vector<cudf::io::detail::column_buffer>> _out_buffers;
 
+  // In-flight source reads for the next load range, if any. The background task reads through
+  // `_metadata` and `_file_itm_data`, so this member is declared last: its destructor (which
+  // waits on the task) must run before those of the members the task touches.
+  struct prefetched_stripe_data {
+    std::size_t load_range_index;  // index into `load_stripe_ranges` the data belongs to
+    std::map<std::size_t, std::unique_ptr<datasource::buffer>> buffers;  // keyed by read index
+    std::future<void> read_task;
+  };
+  std::optional<prefetched_stripe_data> _prefetched_load;
+
   // The default value used for subdividing the decoded table for final output.
   // Larger values will reduce the computation time but will make the output table less granular.
   // Smaller values (minimum is `1`) will increase the computation time but the output table will
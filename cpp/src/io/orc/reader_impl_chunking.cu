@@ -18,6 +18,7 @@
 #include "io/orc/reader_impl.hpp"
 #include "io/orc/reader_impl_chunking.hpp"
 #include "io/orc/reader_impl_helpers.hpp"
+#include "io/utilities/getenv_or.hpp"
 #include "io/utilities/hostdevice_span.hpp"
 
 #include <cudf/detail/timezone.hpp>
@@ -233,10 +234,40 @@ void reader_impl::preprocess_file(read_mode mode)
   //
   // Load stripes' metadata:
   //
+
+  // Prune stripes that provably contain no matching rows using stripe statistics. The surviving
+  // rows are filtered exactly in `make_output_chunk()`.
+  auto const filtered_stripes = [&]() -> std::optional<std::vector<std::vector<size_type>>> {
+    if (not _options.filter.has_value()) { return std::nullopt; }
+    std::vector<data_type> output_dtypes;
+    std::vector<size_type> output_column_ids;
+    for (auto const& col : _selected_columns.levels[0]) {
+      auto const col_type =
+        to_cudf_type(_metadata.get_col_type(col.id).kind,
+                     _options.use_np_dtypes,
+                     _options.timestamp_type.id(),
+                     to_cudf_decimal_type(_options.decimal128_columns, _metadata, col.id));
+      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+      if (col_type == type_id::DECIMAL32 or col_type == type_id::DECIMAL64 or
+          col_type == type_id::DECIMAL128) {
+        auto const scale =
+          -static_cast<size_type>(_metadata.get_col_type(col.id).scale.value_or(0));
+        output_dtypes.emplace_back(col_type, scale);
+      } else {
+        output_dtypes.emplace_back(col_type);
+      }
+      output_column_ids.push_back(col.id);
+    }
+    return _metadata.filter_stripes(
+      _options.selected_stripes, output_dtypes, output_column_ids, _options.filter.value(), _stream);
+  }();
+
   std::tie(
     _file_itm_data.rows_to_skip, _file_itm_data.rows_to_read, _file_itm_data.selected_stripes) =
-    _metadata.select_stripes(
-      _options.selected_stripes, _options.skip_rows, _options.num_read_rows, _stream);
+    _metadata.select_stripes(filtered_stripes.value_or(_options.selected_stripes),
+                             _options.skip_rows,
+                             _options.num_read_rows,
+                             _stream);
   if (!_file_itm_data.has_data()) { return; }
 
   CUDF_EXPECTS(
@@ -259,9 +290,10 @@ void reader_impl::preprocess_file(read_mode mode)
         });
       });
 
-    return has_timestamp_column ? cudf::detail::make_timezone_transition_table(
-                                    {}, selected_stripes[0].stripe_footer->writerTimezone, _stream)
-                                : std::make_unique<cudf::table>();
+    return has_timestamp_column
+             ? cudf::detail::get_cached_timezone_transition_table(
+                 {}, selected_stripes[0].stripe_footer->writerTimezone, _stream)
+             : std::make_shared<cudf::table const>();
   }();
 
   //
@@ -454,6 +486,18 @@ void reader_impl::preprocess_file(read_mode mode)
     find_splits<cumulative_size>(total_stripe_sizes, num_total_stripes, load_limit);
 }
 
+namespace {
+
+// Returns true if source reads for the next load range should be issued on a background thread
+// while the current range is decompressed and decoded.
+[[nodiscard]] bool is_pipelined_read_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_ORC_PIPELINED_READ", 0) != 0;
+  return enabled;
+}
+
+}  // namespace
+
 // If there is a data read limit, only a subset of stripes are read at a time such that
 // their total data size does not exceed a fixed size limit. Then, the data is probed to
 // estimate its uncompressed sizes, which are in turn used to split that stripe subset into
@@ -500,6 +544,17 @@ void reader_impl::load_next_stripe_data(read_mode mode)
   auto const [read_begin, read_end] =
     merge_selected_ranges(_file_itm_data.stripe_data_read_ranges, load_stripe_range);
 
+  // Adopt host buffers prefetched for this range while the previous stripes were decoding.
+  auto prefetched_buffers = [&]() -> std::map<std::size_t, std::unique_ptr<datasource::buffer>> {
+    if (!_prefetched_load.has_value()) { return {}; }
+    // The background task writes into `_prefetched_load->buffers`; wait for it before moving.
+    _prefetched_load->read_task.get();
+    auto prefetched = std::move(*_prefetched_load);
+    _prefetched_load.reset();
+    if (prefetched.load_range_index != _chunk_read_data.curr_load_stripe_range - 1) { return {}; }
+    return std::move(prefetched.buffers);
+  }();
+
   bool stream_synchronized{false};
 
   for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
@@ -522,7 +577,12 @@ void reader_impl::load_next_stripe_data(read_mode mode)
         read_info.length);
 
     } else {
-      auto buffer = source_ptr->host_read(read_info.offset, read_info.length);
+      auto buffer = [&]() -> std::unique_ptr<cudf::io::datasource::buffer> {
+        if (auto it = prefetched_buffers.find(read_idx); it != prefetched_buffers.end()) {
+          return std::move(it->second);
+        }
+        return source_ptr->host_read(read_info.offset, read_info.length);
+      }();
       CUDF_EXPECTS(buffer->size() == read_info.length, "Unexpected discrepancy in bytes read.");
       CUDF_CUDA_TRY(cudaMemcpyAsync(dst_base + read_info.dst_pos,
                                     buffer->data(),
@@ -541,6 +601,9 @@ void reader_impl::load_next_stripe_data(read_mode mode)
     CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
   }
 
+  // Start reading the next range from the sources while this range's stripes are decoded.
+  prefetch_next_stripe_data();
+
   // Compute number of rows in the loading stripes.
   auto const num_loading_rows = std::accumulate(
     _file_itm_data.selected_stripes.begin() + stripe_start,
@@ -730,4 +793,32 @@ void reader_impl::load_next_stripe_data(read_mode mode)
   add_range_offset(_chunk_read_data.decode_stripe_ranges);
 }
 
+void reader_impl::prefetch_next_stripe_data()
+{
+  if (!is_pipelined_read_enabled()) { return; }
+  if (_chunk_read_data.curr_load_stripe_range >= _chunk_read_data.load_stripe_ranges.size()) {
+    return;
+  }
+
+  auto const next_range_idx = _chunk_read_data.curr_load_stripe_range;
+  auto const [read_begin, read_end] = merge_selected_ranges(
+    _file_itm_data.stripe_data_read_ranges, _chunk_read_data.load_stripe_ranges[next_range_idx]);
+  if (read_begin >= read_end) { return; }
+
+  // Only the host-side source reads are prefetched; device reads need the destination buffers
+  // which are not allocated until the range is actually loaded.
+  _prefetched_load = prefetched_stripe_data{next_range_idx, {}, {}};
+  _prefetched_load->read_task =
+    std::async(std::launch::async, [this, read_begin = read_begin, read_end = read_end] {
+      for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
+        auto const& read_info = _file_itm_data.data_read_info[read_idx];
+        auto const source_ptr = _metadata.per_file_metadata[read_info.source_idx].source;
+        if (!source_ptr->is_device_read_preferred(read_info.length)) {
+          _prefetched_load->buffers.emplace(
+            read_idx, source_ptr->host_read(read_info.offset, read_info.length));
+        }
+      }
+    });
+}
+
 }  // namespace cudf::io::orc::detail
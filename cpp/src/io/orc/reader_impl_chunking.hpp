@@ -167,7 +167,8 @@ struct file_intermediate_data {
   std::vector<std::vector<orc_column_meta>> lvl_nested_cols;
 
   // Table for converting timestamp columns from local to UTC time.
-  std::unique_ptr<cudf::table> tz_table;
+  // Shared with the process-wide timezone table cache.
+  std::shared_ptr<cudf::table const> tz_table;
 
   bool global_preprocessed{false};
 };
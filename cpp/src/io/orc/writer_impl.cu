@@ -23,10 +23,14 @@
 #include "io/orc/orc_gpu.hpp"
 #include "io/statistics/column_statistics.cuh"
 #include "io/utilities/column_utils.cuh"
+#include "io/utilities/getenv_or.hpp"
 #include "writer_impl.hpp"
 
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/batched_memcpy.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/cuda_memcpy.hpp>
@@ -219,6 +223,7 @@ class orc_column_view {
                                                : to_clockscale(col.type().id())},
       _precision{metadata.is_decimal_precision_set() ? metadata.get_decimal_precision()
                                                      : orc_precision(col.type().id())},
+      _stats_mode{metadata.get_statistics_mode()},
       name{metadata.get_name()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
@@ -239,6 +244,7 @@ class orc_column_view {
 
   auto type() const noexcept { return cudf_column.type(); }
   auto is_string() const noexcept { return cudf_column.type().id() == type_id::STRING; }
+  [[nodiscard]] column_view const& cudf_col() const noexcept { return cudf_column; }
 
   void attach_rowgroup_char_counts(host_span<size_type const> counts)
   {
@@ -298,6 +304,7 @@ class orc_column_view {
   [[nodiscard]] auto precision() const noexcept { return _precision; }
 
   void set_orc_encoding(ColumnEncodingKind e) noexcept { _encoding_kind = e; }
+  [[nodiscard]] auto stats_mode() const noexcept { return _stats_mode; }
   [[nodiscard]] auto orc_kind() const noexcept { return _type_kind; }
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
@@ -320,6 +327,8 @@ class orc_column_view {
   int32_t _scale     = 0;
   int32_t _precision = 0;
 
+  statistics_mode _stats_mode = statistics_mode::USE_DEFAULT;
+
   host_span<size_type const> rowgroup_char_counts;
 
   host_span<gpu::stripe_dictionary const> stripe_dicts;
@@ -1233,6 +1242,7 @@ intermediate_statistics gather_statistic_blobs(statistics_freq const stats_freq,
     desc->stats_dtype       = kind_to_stats_type(column.orc_kind());
     desc->num_rows          = column.size();
     desc->num_values        = column.size();
+    desc->stats_row_stride  = stats_mode_to_row_stride(column.stats_mode());
     if (desc->stats_dtype == dtype_timestamp64) {
       // Timestamp statistics are in milliseconds
       switch (column.scale()) {
@@ -2112,12 +2122,59 @@ struct string_rows_less {
   }
 };
 
+namespace {
+
+// Returns true if string columns should be sampled for cardinality before building stripe
+// dictionaries, skipping the build for columns that are clearly too distinct to benefit.
+[[nodiscard]] bool is_dictionary_sampling_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_ORC_DICT_SAMPLING", 0) != 0;
+  return enabled;
+}
+
+}  // namespace
+
 // Build stripe dictionaries for string columns
 stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
                                        file_segmentation const& segmentation,
                                        bool sort_dictionaries,
                                        rmm::cuda_stream_view stream)
 {
+  // Estimate the cardinality of each string column from a strided row sample and skip the
+  // dictionary build for columns that are clearly too distinct to benefit; such columns always
+  // end up direct-encoded, so skipping saves the hash map memory and a full pass over the data.
+  auto const skip_dict = [&] {
+    std::vector<bool> skip(orc_table.num_string_columns(), false);
+    if (not is_dictionary_sampling_enabled()) { return skip; }
+    auto constexpr sample_count         = size_type{32'768};
+    auto constexpr distinct_ratio_limit = 0.75;
+    auto const mr                       = cudf::get_current_device_resource_ref();
+    for (auto col_idx : orc_table.string_column_indices) {
+      auto const& str_column = orc_table.column(col_idx);
+      // Columns not much larger than the sample are cheap to build and sample poorly
+      if (str_column.size() < 4 * sample_count) { continue; }
+      auto const stride = str_column.size() / sample_count;
+      auto const gather_map =
+        cudf::detail::sequence(sample_count,
+                               numeric_scalar<size_type>(0, true, stream),
+                               numeric_scalar<size_type>(stride, true, stream),
+                               stream,
+                               mr);
+      auto const sample = cudf::detail::gather(table_view{{str_column.cudf_col()}},
+                                               gather_map->view(),
+                                               out_of_bounds_policy::DONT_CHECK,
+                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               stream,
+                                               mr);
+      auto const distinct = cudf::detail::distinct_count(
+        sample->get_column(0).view(), null_policy::EXCLUDE, nan_policy::NAN_IS_VALID, stream);
+      if (distinct > static_cast<size_type>(sample_count * distinct_ratio_limit)) {
+        skip[str_column.str_index()] = true;
+      }
+    }
+    return skip;
+  }();
+
   // Variable to keep track of the current total map storage size
   size_t total_map_storage_size = 0;
   std::vector<std::vector<size_t>> hash_maps_storage_offsets(
@@ -2130,7 +2187,10 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
                          : segmentation.rowgroups[stripe.first + stripe.size - 1][col_idx].end -
                              segmentation.rowgroups[stripe.first][col_idx].begin;
       hash_maps_storage_offsets[str_column.str_index()].emplace_back(total_map_storage_size);
-      total_map_storage_size += stripe_num_rows * gpu::occupancy_factor;
+      // Skipped columns get empty hash map storage for all their stripes
+      if (not skip_dict[str_column.str_index()]) {
+        total_map_storage_size += stripe_num_rows * gpu::occupancy_factor;
+      }
     }
     hash_maps_storage_offsets[str_column.str_index()].emplace_back(total_map_storage_size);
   }
@@ -2194,6 +2254,7 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
       // Enable dictionary encoding if the dictionary size is smaller than the direct encode size
       // The estimate excludes the LENGTH stream size, which is present in both cases
       sd.is_enabled = [&]() {
+        if (skip_dict[str_col_idx]) { return false; }  // no hash maps were built for this column
         auto const dict_index_size = varint_size(sd.entry_count);
         return sd.char_count + dict_index_size * sd.entry_count < direct_char_count;
       }();
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parquet_gpu.hpp"
+
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/hashing/detail/xxhash_64.cuh>
+#include <cudf/strings/string_view.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda/std/cstddef>
+
+namespace cudf::io::parquet::detail {
+
+namespace {
+
+// salt values defined by the parquet bloom filter spec
+__constant__ uint32_t bloom_salt[8] = {0x47b6137bU,
+                                       0x44974d91U,
+                                       0x8824ad5bU,
+                                       0xa2b7289dU,
+                                       0x705495c7U,
+                                       0x2df1424bU,
+                                       0x9efc4947U,
+                                       0x5c6bfb31U};
+
+/**
+ * @brief Computes the XXH64 hash of a literal's plain-encoded representation.
+ *
+ * The parquet spec hashes the plain encoding of the value with seed 0: the little-endian
+ * bytes for fixed-width types and the raw bytes (without length prefix) for byte arrays.
+ * Values are hashed without any normalization so the result matches what writers produce.
+ */
+__device__ uint64_t hash_literal(ast::generic_scalar_device_view const& literal)
+{
+  auto const hasher    = cudf::hashing::detail::XXHash_64<uint64_t>{0};
+  auto const hash_bits = [&](auto value) {
+    return hasher.compute_bytes(reinterpret_cast<cuda::std::byte const*>(&value), sizeof(value));
+  };
+  switch (literal.type().id()) {
+    case type_id::INT32: return hash_bits(literal.value<int32_t>());
+    case type_id::INT64: return hash_bits(literal.value<int64_t>());
+    case type_id::FLOAT32: return hash_bits(literal.value<float>());
+    case type_id::FLOAT64: return hash_bits(literal.value<double>());
+    case type_id::STRING: {
+      auto const sv = literal.value<cudf::string_view>();
+      return hasher.compute_bytes(reinterpret_cast<cuda::std::byte const*>(sv.data()),
+                                  sv.size_bytes());
+    }
+    default: return 0;
+  }
+}
+
+// Checks a single 32-byte split block for the bits selected by the low hash word
+__device__ bool block_might_contain(uint32_t const* block, uint32_t key)
+{
+  bool found = true;
+  for (int i = 0; i < 8; i++) {
+    uint32_t const mask = 1u << ((key * bloom_salt[i]) >> 27);
+    found               = found && (block[i] & mask);
+  }
+  return found;
+}
+
+// One thread per probe; probe counts are tiny (#row groups x #equality predicates)
+CUDF_KERNEL void probe_bloom_filters_kernel(device_span<uint8_t const> bitset_data,
+                                            device_span<bloom_filter_probe const> probes,
+                                            device_span<bool> results)
+{
+  auto const idx = cudf::detail::grid_1d::global_thread_id();
+  if (idx >= static_cast<cudf::thread_index_type>(probes.size())) { return; }
+
+  auto const& probe = probes[idx];
+  auto const tid    = probe.literal.type().id();
+  // only hash types whose plain encoding we reproduce here; anything else cannot prune
+  bool const hashable = tid == type_id::INT32 || tid == type_id::INT64 ||
+                        tid == type_id::FLOAT32 || tid == type_id::FLOAT64 ||
+                        tid == type_id::STRING;
+  if (probe.num_blocks <= 0 || !probe.literal.is_valid() || !hashable) {
+    results[idx] = true;  // cannot prune
+    return;
+  }
+
+  auto const hash = hash_literal(probe.literal);
+  // the top 32 hash bits select the block, the low 32 bits select the bits within it
+  auto const block_idx =
+    static_cast<uint32_t>(((hash >> 32) * static_cast<uint64_t>(probe.num_blocks)) >> 32);
+  auto const block = reinterpret_cast<uint32_t const*>(bitset_data.data() + probe.bitset_offset) +
+                     block_idx * 8;
+  results[idx] = block_might_contain(block, static_cast<uint32_t>(hash));
+}
+
+}  // namespace
+
+void ProbeBloomFilters(device_span<uint8_t const> bitset_data,
+                       device_span<bloom_filter_probe const> probes,
+                       device_span<bool> results,
+                       rmm::cuda_stream_view stream)
+{
+  if (probes.empty()) { return; }
+  auto constexpr block_size = 128;
+  auto const num_blocks     = cudf::util::div_rounding_up_safe<size_t>(probes.size(), block_size);
+  probe_bloom_filters_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+    bitset_data, probes, results);
+}
+
+}  // namespace cudf::io::parquet::detail
@@ -677,10 +677,20 @@ void CompactProtocolReader::read(ColumnChunkMetaData* c)
                             parquet_field_int64(11, c->dictionary_page_offset),
                             parquet_field_struct(12, c->statistics),
                             optional_list_enc_stats(13, c->encoding_stats),
+                            parquet_field_optional<int64_t, parquet_field_int64>(
+                              14, c->bloom_filter_offset),
+                            parquet_field_optional<int32_t, parquet_field_int32>(
+                              15, c->bloom_filter_length),
                             optional_size_statistics(16, c->size_statistics));
   function_builder(this, op);
 }
 
+void CompactProtocolReader::read(BloomFilterHeader* b)
+{
+  auto op = std::make_tuple(parquet_field_int32(1, b->num_bytes));
+  function_builder(this, op);
+}
+
 void CompactProtocolReader::read(PageHeader* p)
 {
   auto op = std::make_tuple(parquet_field_enum<PageType>(1, p->type),
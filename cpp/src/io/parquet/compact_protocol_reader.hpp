@@ -109,6 +109,7 @@ class CompactProtocolReader {
   void read(RowGroup* r);
   void read(ColumnChunk* c);
   void read(ColumnChunkMetaData* c);
+  void read(BloomFilterHeader* b);
   void read(PageHeader* p);
   void read(DataPageHeader* d);
   void read(DictionaryPageHeader* d);
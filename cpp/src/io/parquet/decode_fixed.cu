@@ -138,9 +138,11 @@ __device__ void gpuDecodeFixedWidthValues(
           case INT32: gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst)); break;
           case INT64: gpuOutputFast(s, sb, src_pos, static_cast<uint2*>(dst)); break;
           default:
-            if (s->dtype_len_in <= sizeof(int32_t)) {
+            // select the output width by dtype_len: it can be smaller than the stored length
+            // when the output is sized by the declared precision
+            if (dtype_len <= sizeof(int32_t)) {
               gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<int32_t*>(dst));
-            } else if (s->dtype_len_in <= sizeof(int64_t)) {
+            } else if (dtype_len <= sizeof(int64_t)) {
               gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<int64_t*>(dst));
             } else {
               gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<__int128_t*>(dst));
@@ -242,11 +244,11 @@ __device__ inline void gpuDecodeFixedWidthSplitValues(
           case INT32: gpuOutputByteStreamSplit<int32_t>(dst, src, num_values); break;
           case INT64: gpuOutputByteStreamSplit<int64_t>(dst, src, num_values); break;
           case FIXED_LEN_BYTE_ARRAY:
-            if (s->dtype_len_in <= sizeof(int32_t)) {
+            if (dtype_len <= sizeof(int32_t)) {
               gpuOutputSplitFixedLenByteArrayAsInt(
                 reinterpret_cast<int32_t*>(dst), src, num_values, s->dtype_len_in);
               break;
-            } else if (s->dtype_len_in <= sizeof(int64_t)) {
+            } else if (dtype_len <= sizeof(int64_t)) {
               gpuOutputSplitFixedLenByteArrayAsInt(
                 reinterpret_cast<int64_t*>(dst), src, num_values, s->dtype_len_in);
               break;
@@ -903,7 +905,7 @@ __device__ int skip_decode(stream_type& parquet_stream, int num_to_skip, int t)
  * @param error_code Error code to set if an error is encountered
  */
 template <typename level_t, int decode_block_size_t, decode_kernel_mask kernel_mask_t>
-CUDF_KERNEL void __launch_bounds__(decode_block_size_t, 8)
+CUDF_KERNEL void __launch_bounds__(decode_block_size_t, 1024 / decode_block_size_t)
   gpuDecodePageDataGeneric(PageInfo* pages,
                            device_span<ColumnChunkDesc const> chunks,
                            size_t min_row,
@@ -1119,6 +1121,55 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size_t, 8)
   if (t == 0 and s->error != 0) { set_error(s->error, error_code); }
 }
 
+/**
+ * @brief Returns the number of threads that can be resident on an SM when `kernel` is launched
+ * with `block_size` threads per block
+ */
+template <typename Kernel>
+int resident_decode_threads(Kernel kernel, int block_size)
+{
+  int max_blocks = 0;
+  CUDF_CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(&max_blocks, kernel, block_size, 0));
+  return max_blocks * block_size;
+}
+
+/**
+ * @brief Launches `gpuDecodePageDataGeneric` with the thread block size that yields the highest
+ * occupancy on the active device
+ *
+ * The decode kernels are tuned for `preferred_block_size` threads per block. On devices where
+ * that configuration is occupancy-limited by the blocks-per-SM cap rather than by registers or
+ * shared memory, a block twice as wide keeps more of each SM busy, so the launch configuration
+ * is chosen from the occupancy API rather than hardcoded.
+ */
+template <typename level_t, int preferred_block_size, decode_kernel_mask mask>
+void launch_generic_decode_kernel(PageInfo* pages,
+                                  device_span<ColumnChunkDesc const> chunks,
+                                  size_t min_row,
+                                  size_t num_rows,
+                                  size_t num_pages,
+                                  kernel_error::pointer error_code,
+                                  rmm::cuda_stream_view stream)
+{
+  constexpr int wide_block_size = preferred_block_size * 2;
+  auto const use_wide_block =
+    resident_decode_threads(gpuDecodePageDataGeneric<level_t, wide_block_size, mask>,
+                            wide_block_size) >
+    resident_decode_threads(gpuDecodePageDataGeneric<level_t, preferred_block_size, mask>,
+                            preferred_block_size);
+
+  dim3 dim_grid(num_pages, 1);  // 1 threadblock per page
+  if (use_wide_block) {
+    gpuDecodePageDataGeneric<level_t, wide_block_size, mask>
+      <<<dim_grid, dim3(wide_block_size, 1), 0, stream.value()>>>(
+        pages, chunks, min_row, num_rows, error_code);
+  } else {
+    gpuDecodePageDataGeneric<level_t, preferred_block_size, mask>
+      <<<dim_grid, dim3(preferred_block_size, 1), 0, stream.value()>>>(
+        pages, chunks, min_row, num_rows, error_code);
+  }
+}
+
 }  // anonymous namespace
 
 template <decode_kernel_mask mask>
@@ -1141,17 +1192,12 @@ void __host__ DecodePageData(cudf::detail::hostdevice_span<PageInfo> pages,
     constexpr int decode_block_size   = decltype(block_size_tag)::value;
     constexpr decode_kernel_mask mask = decltype(kernel_mask_tag)::value;
 
-    dim3 dim_block(decode_block_size, 1);
-    dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
-
     if (level_type_size == 1) {
-      gpuDecodePageDataGeneric<uint8_t, decode_block_size, mask>
-        <<<dim_grid, dim_block, 0, stream.value()>>>(
-          pages.device_ptr(), chunks, min_row, num_rows, error_code);
+      launch_generic_decode_kernel<uint8_t, decode_block_size, mask>(
+        pages.device_ptr(), chunks, min_row, num_rows, pages.size(), error_code, stream);
     } else {
-      gpuDecodePageDataGeneric<uint16_t, decode_block_size, mask>
-        <<<dim_grid, dim_block, 0, stream.value()>>>(
-          pages.device_ptr(), chunks, min_row, num_rows, error_code);
+      launch_generic_decode_kernel<uint16_t, decode_block_size, mask>(
+        pages.device_ptr(), chunks, min_row, num_rows, pages.size(), error_code, stream);
     }
   };
 
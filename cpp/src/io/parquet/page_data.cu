@@ -158,11 +158,11 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
             case INT32: gpuOutputByteStreamSplit<int32_t>(dst, src, num_values); break;
             case INT64: gpuOutputByteStreamSplit<int64_t>(dst, src, num_values); break;
             case FIXED_LEN_BYTE_ARRAY:
-              if (s->dtype_len_in <= sizeof(int32_t)) {
+              if (dtype_len <= sizeof(int32_t)) {
                 gpuOutputSplitFixedLenByteArrayAsInt(
                   reinterpret_cast<int32_t*>(dst), src, num_values, s->dtype_len_in);
                 break;
-              } else if (s->dtype_len_in <= sizeof(int64_t)) {
+              } else if (dtype_len <= sizeof(int64_t)) {
                 gpuOutputSplitFixedLenByteArrayAsInt(
                   reinterpret_cast<int64_t*>(dst), src, num_values, s->dtype_len_in);
                 break;
@@ -366,9 +366,11 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
             case INT32: gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst)); break;
             case INT64: gpuOutputFast(s, sb, val_src_pos, static_cast<uint2*>(dst)); break;
             default:
-              if (s->dtype_len_in <= sizeof(int32_t)) {
+              // select the output width by dtype_len: it can be smaller than the stored length
+              // when the output is sized by the declared precision
+              if (dtype_len <= sizeof(int32_t)) {
                 gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<int32_t*>(dst));
-              } else if (s->dtype_len_in <= sizeof(int64_t)) {
+              } else if (dtype_len <= sizeof(int64_t)) {
                 gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<int64_t*>(dst));
               } else {
                 gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<__int128_t*>(dst));
@@ -33,6 +33,13 @@ namespace cudf::io::parquet::detail {
 template <typename state_buf>
 inline __device__ void gpuOutputString(page_state_s* s, state_buf* sb, int src_pos, void* dstv)
 {
+  if (s->col.is_strings_to_dict and s->col.physical_type == BYTE_ARRAY) {
+    // Output the raw dictionary index. The keys column is built separately from the
+    // chunk's dictionary page, so the string bytes are never expanded.
+    *static_cast<uint32_t*>(dstv) =
+      (s->dict_bits > 0) ? sb->dict_idx[rolling_index<state_buf::dict_buf_size>(src_pos)] : 0;
+    return;
+  }
   auto [ptr, len] = gpuGetStringData(s, sb, src_pos);
   if (s->col.is_strings_to_cat and s->col.physical_type == BYTE_ARRAY) {
     // Output hash. This hash value is used if the option to convert strings to
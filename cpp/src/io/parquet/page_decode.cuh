@@ -1230,15 +1230,29 @@ inline __device__ bool setupLocalPageInfo(page_state_s* const s,
       s->dtype_len_in = s->dtype_len;
       if (data_type == FIXED_LEN_BYTE_ARRAY) {
         if (is_decimal) {
-          s->dtype_len = [dtype_len = s->dtype_len]() {
-            if (dtype_len <= sizeof(int32_t)) {
-              return sizeof(int32_t);
-            } else if (dtype_len <= sizeof(int64_t)) {
-              return sizeof(int64_t);
-            } else {
-              return sizeof(__int128_t);
-            }
-          }();
+          if (s->col.is_decimals_to_precision) {
+            // output is sized by the declared precision rather than the storage length
+            auto const decimal_precision = s->col.logical_type->precision();
+            s->dtype_len                 = [decimal_precision]() {
+              if (decimal_precision <= MAX_DECIMAL32_PRECISION) {
+                return sizeof(int32_t);
+              } else if (decimal_precision <= MAX_DECIMAL64_PRECISION) {
+                return sizeof(int64_t);
+              } else {
+                return sizeof(__int128_t);
+              }
+            }();
+          } else {
+            s->dtype_len = [dtype_len = s->dtype_len]() {
+              if (dtype_len <= sizeof(int32_t)) {
+                return sizeof(int32_t);
+              } else if (dtype_len <= sizeof(int64_t)) {
+                return sizeof(int64_t);
+              } else {
+                return sizeof(__int128_t);
+              }
+            }();
+          }
         } else {
           s->dtype_len = sizeof(string_index_pair);
         }
@@ -1253,8 +1267,9 @@ inline __device__ bool setupLocalPageInfo(page_state_s* const s,
             s->dtype_len = 8;
           }
         }
-      } else if (data_type == BYTE_ARRAY && s->col.is_strings_to_cat) {
-        s->dtype_len = 4;  // HASH32 output
+      } else if (data_type == BYTE_ARRAY &&
+                 (s->col.is_strings_to_cat || s->col.is_strings_to_dict)) {
+        s->dtype_len = 4;  // HASH32 or dictionary index output
       } else if (data_type == INT96) {
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
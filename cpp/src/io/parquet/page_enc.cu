@@ -3223,9 +3223,21 @@ __device__ bool is_descending(statistics_chunk const* s,
 __device__ int32_t calculate_boundary_order(statistics_chunk const* s,
                                             Type ptype,
                                             ConvertedType ctype,
-                                            uint32_t num_pages)
+                                            uint32_t num_pages,
+                                            int32_t declared_order)
 {
   if (not is_comparable(ptype, ctype)) { return BoundaryOrder::UNORDERED; }
+  // A sort order declared through the writer's sorting columns narrows the work to a
+  // single directed verification pass; a declaration the page statistics do not bear
+  // out degrades to UNORDERED rather than emitting a wrong index.
+  if (declared_order == BoundaryOrder::ASCENDING) {
+    return is_ascending(s, ptype, ctype, num_pages) ? BoundaryOrder::ASCENDING
+                                                    : BoundaryOrder::UNORDERED;
+  }
+  if (declared_order == BoundaryOrder::DESCENDING) {
+    return is_descending(s, ptype, ctype, num_pages) ? BoundaryOrder::DESCENDING
+                                                     : BoundaryOrder::UNORDERED;
+  }
   if (is_ascending(s, ptype, ctype, num_pages)) {
     return BoundaryOrder::ASCENDING;
   } else if (is_descending(s, ptype, ctype, num_pages)) {
@@ -3310,7 +3322,8 @@ CUDF_KERNEL void __launch_bounds__(1)
                       calculate_boundary_order(&column_stats[first_data_page + pageidx],
                                                col_g.physical_type,
                                                col_g.converted_type,
-                                               num_pages - first_data_page));
+                                               num_pages - first_data_page,
+                                               col_g.declared_boundary_order));
   // null_counts
   encoder.field_list_begin(5, num_data_pages, FieldType::I64);
   for (uint32_t page = first_data_page; page < num_pages; page++) {
@@ -273,6 +273,17 @@ struct Statistics {
   std::optional<bool> is_min_value_exact;
 };
 
+/**
+ * @brief Thrift-derived struct describing the header of a split-block bloom filter
+ *
+ * The algorithm, hash and compression fields are thrift unions whose only values defined by the
+ * spec are SPLIT_BLOCK, XXHASH and UNCOMPRESSED respectively, so they are skipped when parsing.
+ */
+struct BloomFilterHeader {
+  // Size of the bitset in bytes
+  int32_t num_bytes = 0;
+};
+
 /**
  * @brief Thrift-derived struct containing statistics used to estimate page and column chunk sizes
  */
@@ -386,6 +397,10 @@ struct ColumnChunkMetaData {
   // The histograms contained in these statistics can also be useful in some cases for more
   // fine-grained nullability/list length filter pushdown.
   std::optional<SizeStatistics> size_statistics;
+  // Byte offset from beginning of file to the bloom filter for this column chunk
+  std::optional<int64_t> bloom_filter_offset;
+  // Size of the bloom filter (header and bitset) in bytes
+  std::optional<int32_t> bloom_filter_length;
 };
 
 /**
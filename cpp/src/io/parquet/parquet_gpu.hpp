@@ -25,6 +25,7 @@
 
 #include <cudf/detail/device_scalar.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/ast/expressions.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -410,6 +411,8 @@ struct ColumnChunkDesc {
                            column_chunk_info const* chunk_info_,
                            float list_bytes_per_row_est_,
                            bool strings_to_categorical_,
+                           bool strings_to_dictionary_,
+                           bool decimals_to_precision_,
                            int32_t src_file_idx_)
     : compressed_data(compressed_data_),
       compressed_size(compressed_size_),
@@ -430,6 +433,8 @@ struct ColumnChunkDesc {
       h_chunk_info(chunk_info_),
       list_bytes_per_row_est(list_bytes_per_row_est_),
       is_strings_to_cat(strings_to_categorical_),
+      is_strings_to_dict(strings_to_dictionary_),
+      is_decimals_to_precision(decimals_to_precision_),
       src_file_idx(src_file_idx_)
 
   {
@@ -465,8 +470,10 @@ struct ColumnChunkDesc {
 
   float list_bytes_per_row_est{};  // for LIST columns, an estimate on number of bytes per row
 
-  bool is_strings_to_cat{};    // convert strings to hashes
-  bool is_large_string_col{};  // `true` if string data uses 64-bit offsets
+  bool is_strings_to_cat{};   // convert strings to hashes
+  bool is_strings_to_dict{};  // emit raw dictionary indices instead of strings
+  bool is_decimals_to_precision{};  // size FIXED_LEN_BYTE_ARRAY decimal output by precision
+  bool is_large_string_col{};       // `true` if string data uses 64-bit offsets
   int32_t src_file_idx{};      // source file index
 };
 
@@ -500,6 +507,10 @@ struct parquet_column_device_view : stats_column_desc {
   bool output_as_byte_array;   //!< Indicates this list column is being written as a byte array
   bool skip_compression;       //!< Skip compression for this column
   column_encoding requested_encoding;  //!< User specified encoding for this column.
+  int32_t declared_boundary_order;  //!< BoundaryOrder declared via the writer's sorting columns;
+                                    //!< UNORDERED when the column is not a declared sort key. The
+                                    //!< column index kernel verifies the declared direction on the
+                                    //!< page statistics before emitting it.
 };
 
 struct EncColumnChunk;
@@ -646,8 +657,11 @@ constexpr bool is_string_col(ColumnChunkDesc const& chunk)
     return false;
   }
 
-  auto const non_hashed_byte_array =
-    chunk.physical_type == BYTE_ARRAY and not chunk.is_strings_to_cat;
+  // byte_array chunks emitting hashes or raw dictionary indices are decoded as
+  // 32-bit fixed width data rather than strings
+  auto const non_hashed_byte_array = chunk.physical_type == BYTE_ARRAY and
+                                     not chunk.is_strings_to_cat and
+                                     not chunk.is_strings_to_dict;
   auto const fixed_len_byte_array = chunk.physical_type == FIXED_LEN_BYTE_ARRAY;
   return non_hashed_byte_array or fixed_len_byte_array;
 }
@@ -1075,4 +1089,29 @@ void EncodeColumnIndexes(device_span<EncColumnChunk> chunks,
                          int32_t column_index_truncate_length,
                          rmm::cuda_stream_view stream);
 
+/**
+ * @brief A single split-block bloom filter probe
+ */
+struct bloom_filter_probe {
+  int64_t bitset_offset;  // byte offset of the filter's bitset within the bitset buffer
+  int32_t num_blocks;     // number of 32-byte blocks in the bitset
+  ast::generic_scalar_device_view literal;  // literal value to probe for
+};
+
+/**
+ * @brief Launches kernel to probe split-block bloom filters with literal values
+ *
+ * A result of false means the filter's column chunk definitely does not contain the probed
+ * value; true means it may.
+ *
+ * @param[in] bitset_data Concatenated bloom filter bitsets
+ * @param[in] probes Probe descriptors
+ * @param[out] results One result per probe
+ * @param[in] stream CUDA stream to use
+ */
+void ProbeBloomFilters(device_span<uint8_t const> bitset_data,
+                       device_span<bloom_filter_probe const> probes,
+                       device_span<bool> results,
+                       rmm::cuda_stream_view stream);
+
 }  // namespace cudf::io::parquet::detail
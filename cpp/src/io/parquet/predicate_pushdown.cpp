@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,6 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "compact_protocol_reader.hpp"
+#include "io/utilities/getenv_or.hpp"
+#include "parquet_gpu.hpp"
 #include "reader_impl_helpers.hpp"
 
 #include <cudf/ast/detail/expression_transformer.hpp>
@@ -32,8 +35,12 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
+#include <tuple>
 #include <unordered_set>
 
 namespace cudf::io::parquet::detail {
@@ -388,6 +395,7 @@ class stats_expression_converter : public ast::detail::expression_transformer {
 }  // namespace
 
 std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::filter_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   host_span<data_type const> output_dtypes,
   host_span<int const> output_column_schemas,
@@ -470,26 +478,261 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
   auto const is_row_group_required = cudf::detail::make_host_vector_sync(
     device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
 
-  // Return only filtered row groups based on predicate
-  // if all are required or all are nulls, return.
-  if (std::all_of(is_row_group_required.cbegin(),
-                  is_row_group_required.cend(),
-                  [](auto i) { return bool(i); }) or
-      predicate.null_count() == predicate.size()) {
-    return std::nullopt;
+  // Compute stats-filtered row groups based on predicate; nullopt if none were filtered out.
+  auto stats_filtered = [&]() -> std::optional<std::vector<std::vector<size_type>>> {
+    // if all are required or all are nulls, nothing was filtered.
+    if (std::all_of(is_row_group_required.cbegin(),
+                    is_row_group_required.cend(),
+                    [](auto i) { return bool(i); }) or
+        predicate.null_count() == predicate.size()) {
+      return std::nullopt;
+    }
+    size_type is_required_idx = 0;
+    for (auto const& input_row_group_index : input_row_group_indices) {
+      std::vector<size_type> filtered_row_groups;
+      for (auto const rg_idx : input_row_group_index) {
+        if ((!validity_it[is_required_idx]) || is_row_group_required[is_required_idx]) {
+          filtered_row_groups.push_back(rg_idx);
+        }
+        ++is_required_idx;
+      }
+      filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+    }
+    return {std::move(filtered_row_group_indices)};
+  }();
+
+  // probe bloom filters with any equality predicates to prune row groups that min/max
+  // statistics could not
+  auto const bloom_input = stats_filtered.has_value()
+                             ? host_span<std::vector<size_type> const>(stats_filtered.value())
+                             : input_row_group_indices;
+  auto bloom_filtered =
+    apply_bloom_filters(sources, bloom_input, output_column_schemas, filter, stream);
+  return bloom_filtered.has_value() ? std::move(bloom_filtered) : std::move(stats_filtered);
+}
+
+namespace {
+
+/**
+ * @brief Collects the (column reference, literal) pairs of equality predicates that can be
+ * probed against column chunk bloom filters.
+ *
+ * Only equality predicates that hold conjunctively (AND-connected) can prune a row group on a
+ * probe miss, so collection is abandoned if the expression contains a disjunction or negation.
+ */
+class equality_literals_collector : public ast::detail::expression_transformer {
+ public:
+  explicit equality_literals_collector(ast::expression const& expr) { expr.accept(*this); }
+
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    return expr;
+  }
+
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    return expr;
+  }
+
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    return expr;
+  }
+
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    auto const op       = expr.get_operator();
+    auto const operands = expr.get_operands();
+    if (op == ast_operator::EQUAL and operands.size() == 2) {
+      auto const* col = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+      auto const* lit = dynamic_cast<ast::literal const*>(&operands[1].get());
+      if (col == nullptr and lit == nullptr) {
+        col = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+        lit = dynamic_cast<ast::literal const*>(&operands[0].get());
+      }
+      if (col != nullptr and lit != nullptr) {
+        _literals.emplace_back(col->get_column_index(), lit->get_value());
+      }
+    } else if (op == ast_operator::LOGICAL_AND or op == ast_operator::NULL_LOGICAL_AND) {
+      for (auto const& operand : operands) {
+        operand.get().accept(*this);
+      }
+    } else if (op == ast_operator::LOGICAL_OR or op == ast_operator::NULL_LOGICAL_OR or
+               op == ast_operator::NOT) {
+      // a miss in one branch of a disjunction (or under a negation) cannot prune anything
+      _supported = false;
+    }
+    return expr;
+  }
+
+  /**
+   * @brief Returns the collected equality literals, or an empty list if pruning is unsound
+   */
+  [[nodiscard]] std::vector<std::pair<size_type, ast::generic_scalar_device_view>> literals() &&
+  {
+    return _supported ? std::move(_literals) : decltype(_literals){};
+  }
+
+ private:
+  std::vector<std::pair<size_type, ast::generic_scalar_device_view>> _literals;
+  bool _supported{true};
+};
+
+// A parsed bloom filter bitset; cached across reads when the footer cache is enabled so that
+// iterative scans over the same files pay the filter read and header parse cost once
+struct bloom_filter_bitset {
+  int32_t num_blocks;
+  std::vector<uint8_t> bitset;
+};
+
+// Keyed by (footer content hash, source size, bloom filter offset). The footer hash ties the
+// entry to the footer bytes of the owning file, so a rewritten file of the same size cannot
+// serve a stale bitset from a matching offset
+using bitset_cache_key = std::tuple<size_t, size_t, size_t>;
+
+std::map<bitset_cache_key, std::shared_ptr<bloom_filter_bitset const>>& bitset_cache()
+{
+  static std::map<bitset_cache_key, std::shared_ptr<bloom_filter_bitset const>> cache;
+  return cache;
+}
+
+std::mutex& bitset_cache_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
+[[nodiscard]] bool is_bitset_cache_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_PARQUET_FOOTER_CACHE", 0) != 0;
+  return enabled;
+}
+
+/**
+ * @brief Reads and parses the bloom filter at `offset`, reusing a cached copy when available.
+ *
+ * Returns nullptr if the filter header is malformed.
+ */
+std::shared_ptr<bloom_filter_bitset const> read_bloom_filter_bitset(datasource* source,
+                                                                    size_t offset,
+                                                                    size_t footer_hash)
+{
+  auto const cache_key =
+    is_bitset_cache_enabled()
+      ? std::make_optional(bitset_cache_key{footer_hash, source->size(), offset})
+      : std::nullopt;
+  if (cache_key.has_value()) {
+    std::lock_guard<std::mutex> lock(bitset_cache_mutex());
+    auto const it = bitset_cache().find(*cache_key);
+    if (it != bitset_cache().end()) { return it->second; }
   }
-  size_type is_required_idx = 0;
-  for (auto const& input_row_group_index : input_row_group_indices) {
+
+  // parse the filter header to locate and size the bitset
+  auto const header_buffer =
+    source->host_read(offset, std::min<size_t>(256, source->size() - offset));
+  BloomFilterHeader header;
+  CompactProtocolReader cp(header_buffer->data(), header_buffer->size());
+  cp.read(&header);
+  if (header.num_bytes <= 0 or header.num_bytes % 32 != 0) { return nullptr; }
+
+  auto const bitset_buffer = source->host_read(offset + cp.bytecount(), header.num_bytes);
+  auto bitset              = std::make_shared<bloom_filter_bitset>();
+  bitset->num_blocks       = header.num_bytes / 32;
+  bitset->bitset.assign(bitset_buffer->data(), bitset_buffer->data() + bitset_buffer->size());
+
+  if (cache_key.has_value()) {
+    std::lock_guard<std::mutex> lock(bitset_cache_mutex());
+    // keep the cache bounded; bitsets are typically ~1MB per column chunk
+    if (bitset_cache().size() >= 256) { bitset_cache().clear(); }
+    bitset_cache().emplace(*cache_key, bitset);
+  }
+  return bitset;
+}
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::apply_bloom_filters(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<std::vector<size_type> const> row_group_indices,
+  host_span<int const> output_column_schemas,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  equality_literals_collector collector{filter.get()};
+  auto const literals = std::move(collector).literals();
+  if (literals.empty()) { return std::nullopt; }
+
+  // gather the bloom filter bitsets for each candidate (row group, equality predicate) pair
+  std::vector<uint8_t> h_bitsets;
+  std::vector<bloom_filter_probe> h_probes;
+  // source index and position within the source's row group list, per probe
+  std::vector<std::pair<size_t, size_t>> probe_locations;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); src_idx++) {
+    auto const& rg_indices = row_group_indices[src_idx];
+    for (size_t rg_pos = 0; rg_pos < rg_indices.size(); rg_pos++) {
+      for (auto const& [col_idx, literal] : literals) {
+        // only types whose parquet plain encoding the probe kernel can hash
+        auto const tid = literal.type().id();
+        if (tid != type_id::INT32 and tid != type_id::INT64 and tid != type_id::FLOAT32 and
+            tid != type_id::FLOAT64 and tid != type_id::STRING) {
+          continue;
+        }
+        auto const schema_idx = output_column_schemas[col_idx];
+        auto const& col_meta =
+          get_column_metadata(rg_indices[rg_pos], static_cast<size_type>(src_idx), schema_idx);
+        if (not col_meta.bloom_filter_offset.has_value()) { continue; }
+
+        auto const offset = static_cast<size_t>(col_meta.bloom_filter_offset.value());
+        auto const bitset = read_bloom_filter_bitset(
+          sources[src_idx].get(), offset, per_file_metadata[src_idx].footer_hash);
+        if (bitset == nullptr) { continue; }
+
+        h_probes.push_back({static_cast<int64_t>(h_bitsets.size()), bitset->num_blocks, literal});
+        probe_locations.emplace_back(src_idx, rg_pos);
+        h_bitsets.insert(h_bitsets.end(), bitset->bitset.begin(), bitset->bitset.end());
+      }
+    }
+  }
+  if (h_probes.empty()) { return std::nullopt; }
+
+  // probe on device; the literal values only exist in device memory
+  auto const mr        = cudf::get_current_device_resource_ref();
+  auto const d_bitsets = cudf::detail::make_device_uvector_async(h_bitsets, stream, mr);
+  auto const d_probes  = cudf::detail::make_device_uvector_async(h_probes, stream, mr);
+  rmm::device_uvector<bool> d_results(h_probes.size(), stream, mr);
+  ProbeBloomFilters(d_bitsets, d_probes, d_results, stream);
+  auto const h_results = cudf::detail::make_host_vector_sync(
+    device_span<bool const>{d_results.data(), d_results.size()}, stream);
+
+  // a row group is dropped if any of its probes definitely missed
+  std::vector<std::vector<uint8_t>> keep;
+  std::transform(row_group_indices.begin(),
+                 row_group_indices.end(),
+                 std::back_inserter(keep),
+                 [](auto const& rg_indices) {
+                   return std::vector<uint8_t>(rg_indices.size(), 1);
+                 });
+  bool any_pruned = false;
+  for (size_t i = 0; i < h_results.size(); i++) {
+    if (not h_results[i]) {
+      keep[probe_locations[i].first][probe_locations[i].second] = 0;
+      any_pruned                                                = true;
+    }
+  }
+  if (not any_pruned) { return std::nullopt; }
+
+  std::vector<std::vector<size_type>> bloom_filtered_row_groups;
+  for (size_t src_idx = 0; src_idx < row_group_indices.size(); src_idx++) {
     std::vector<size_type> filtered_row_groups;
-    for (auto const rg_idx : input_row_group_index) {
-      if ((!validity_it[is_required_idx]) || is_row_group_required[is_required_idx]) {
-        filtered_row_groups.push_back(rg_idx);
+    for (size_t rg_pos = 0; rg_pos < row_group_indices[src_idx].size(); rg_pos++) {
+      if (keep[src_idx][rg_pos]) {
+        filtered_row_groups.push_back(row_group_indices[src_idx][rg_pos]);
       }
-      ++is_required_idx;
     }
-    filtered_row_group_indices.push_back(std::move(filtered_row_groups));
+    bloom_filtered_row_groups.push_back(std::move(filtered_row_groups));
   }
-  return {std::move(filtered_row_group_indices)};
+  return {std::move(bloom_filtered_row_groups)};
 }
 
 // convert column named expression to column index reference expression
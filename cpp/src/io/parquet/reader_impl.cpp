@@ -492,6 +492,15 @@ reader::impl::impl(std::size_t chunk_read_limit,
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
+  // Dictionary-encoded strings may be returned as dictionary columns directly
+  _strings_to_dictionary = options.is_enabled_convert_strings_to_dictionaries();
+  CUDF_EXPECTS(not(_strings_to_categorical and _strings_to_dictionary),
+               "convert_strings_to_categories and convert_strings_to_dictionaries are mutually "
+               "exclusive");
+
+  // Decimal columns may be sized by their declared precision to skip the post-read cast
+  _use_minimal_decimal_types = options.is_enabled_use_minimal_decimal_types();
+
   // Binary columns can be read as binary or strings
   _reader_column_schema = options.get_column_schema();
 
@@ -508,8 +517,18 @@ reader::impl::impl(std::size_t chunk_read_limit,
     _metadata->select_columns(options.get_columns(),
                               filter_columns_names,
                               options.is_enabled_use_pandas_metadata(),
-                              _strings_to_categorical,
-                              _options.timestamp_type.id());
+                              _strings_to_categorical or _strings_to_dictionary,
+                              _options.timestamp_type.id(),
+                              _use_minimal_decimal_types);
+
+  if (_strings_to_dictionary) {
+    for (auto const& col : _input_columns) {
+      auto const& schema = _metadata->get_schema(col.schema_idx);
+      CUDF_EXPECTS(schema.type != BYTE_ARRAY or
+                     _metadata->get_output_nesting_depth(col.schema_idx) == 1,
+                   "convert_strings_to_dictionaries does not support nested string columns");
+    }
+  }
 
   // Save the states of the output buffers for reuse in `chunk_read()`.
   for (auto const& buff : _output_buffers) {
@@ -610,6 +629,11 @@ table_with_metadata reader::impl::read_chunk_internal(read_mode mode)
     } else {
       out_columns.emplace_back(make_column(_output_buffers[i], nullptr, metadata, _stream));
     }
+    // wrap the raw dictionary indices with the keys from the chunk's dictionary page
+    if (_strings_to_dictionary and schema.type == BYTE_ARRAY) {
+      out_columns.back() =
+        wrap_dictionary_column(std::move(out_columns.back()), _output_column_schemas[i]);
+    }
   }
 
   // Check if number of rows per source should be included in output metadata.
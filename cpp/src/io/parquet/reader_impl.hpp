@@ -33,6 +33,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
+#include <future>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -193,6 +194,35 @@ class reader::impl {
    */
   std::pair<bool, std::future<void>> read_column_chunks();
 
+  /**
+   * @brief Read the compressed column chunks for an arbitrary set of row groups.
+   *
+   * Does not decompress the chunk data. The compressed data pointers are written into the
+   * provided chunk descriptors.
+   *
+   * @param row_groups_info Row groups whose chunks are to be read
+   * @param chunks Chunk descriptors for the row groups, in row-group-major order
+   * @param raw_page_data Output buffers holding the compressed data
+   * @param stream CUDA stream to issue the reads on
+   * @return pair of boolean indicating if compressed chunks were found and a future for
+   * read completion
+   */
+  std::pair<bool, std::future<void>> read_pass_column_chunks(
+    cudf::host_span<row_group_info const> row_groups_info,
+    cudf::host_span<ColumnChunkDesc> chunks,
+    std::vector<rmm::device_buffer>& raw_page_data,
+    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Start reading the column chunks for the next pass, if pipelined reading is enabled.
+   *
+   * The reads are issued on a stream from the global stream pool so that they overlap with the
+   * decompression and decode of the current pass. The data is adopted by `read_column_chunks`
+   * when the next pass is set up. No-op unless LIBCUDF_PARQUET_PIPELINED_READ is set, or if
+   * there is no next pass.
+   */
+  void prefetch_next_pass_column_chunks();
+
   /**
    * @brief Read compressed data and page information for the current pass.
    */
@@ -204,6 +234,19 @@ class reader::impl {
    */
   void build_string_dict_indices();
 
+  /**
+   * @brief Wrap a decoded column of raw Parquet dictionary indices into a dictionary column.
+   *
+   * The keys column is materialized from the column chunk's string dictionary page index and
+   * sorted (Parquet stores dictionary entries in insertion order while cudf dictionary keys
+   * must be ordered), remapping the indices to match.
+   *
+   * @param indices Decoded INT32 column holding raw dictionary indices and the output null mask
+   * @param schema_idx Schema index of the column, used to locate its chunk in the current pass
+   * @return Dictionary column with the chunk's dictionary page as its keys
+   */
+  std::unique_ptr<column> wrap_dictionary_column(std::unique_ptr<column> indices, int schema_idx);
+
   /**
    * @brief For list columns, generate estimated row counts for pages in the current pass.
    *
@@ -405,6 +448,10 @@ class reader::impl {
   std::size_t _num_filter_only_columns{0};
 
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
+
+  // Size decimal columns by their declared precision instead of their physical storage size
+  bool _use_minimal_decimal_types = false;
 
   // are there usable page indexes available
   bool _has_page_index = false;
@@ -425,6 +472,22 @@ class reader::impl {
 
   std::unique_ptr<pass_intermediate_data> _pass_itm_data;
 
+  // Compressed column chunk data read ahead of time for the next pass when pipelined reading
+  // is enabled (see prefetch_next_pass_column_chunks).
+  struct prefetched_pass_data {
+    // pass the data was read for
+    std::size_t pass_index;
+    // compressed data for the pass's chunks
+    std::vector<rmm::device_buffer> raw_page_data;
+    // completion of the device reads
+    std::future<void> read_task;
+    // true if any of the chunks require decompression
+    bool has_compressed_data;
+    // stream the reads were issued on
+    rmm::cuda_stream_view stream;
+  };
+  std::optional<prefetched_pass_data> _prefetched_pass;
+
   std::size_t _output_chunk_read_limit{0};  // output chunk size limit in bytes
   std::size_t _input_pass_read_limit{0};    // input pass memory usage limit in bytes
 };
@@ -18,6 +18,7 @@
 #include "io/comp/comp.hpp"
 #include "io/comp/gpuinflate.hpp"
 #include "io/comp/nvcomp_adapter.hpp"
+#include "io/utilities/getenv_or.hpp"
 #include "io/utilities/time_utils.cuh"
 #include "reader_impl.hpp"
 #include "reader_impl_chunking.hpp"
@@ -50,6 +51,15 @@ namespace nvcomp = cudf::io::detail::nvcomp;
 using cudf::io::detail::compression_result;
 using cudf::io::detail::compression_status;
 
+// Snappy batches smaller than this many pages are routed to the in-house decompression kernel,
+// which has a lower fixed cost than an nvcomp batch (no temp size query or scratch allocation).
+// Zero (the default) keeps all batches on nvcomp.
+[[nodiscard]] size_t small_snappy_batch_threshold()
+{
+  static size_t const threshold = getenv_or("LIBCUDF_NVCOMP_SMALL_SNAPPY_BATCH", size_t{0});
+  return threshold;
+}
+
 struct split_info {
   row_range rows;
   int64_t split_pos;
@@ -890,7 +900,8 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
         }
         break;
       case SNAPPY:
-        if (cudf::io::nvcomp_integration::is_stable_enabled()) {
+        if (cudf::io::nvcomp_integration::is_stable_enabled() and
+            codec.num_pages >= small_snappy_batch_threshold()) {
           nvcomp::batched_decompress(nvcomp::compression_type::SNAPPY,
                                      d_comp_in_view,
                                      d_comp_out_view,
@@ -899,7 +910,7 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
                                      codec.total_decomp_size,
                                      stream);
         } else {
-          gpu_unsnap(d_comp_in_view, d_comp_out, d_comp_res_view, stream);
+          gpu_unsnap(d_comp_in_view, d_comp_out_view, d_comp_res_view, stream);
         }
         break;
       case ZSTD:
@@ -1278,6 +1289,10 @@ void reader::impl::setup_next_pass(read_mode mode)
     // pages, and their headers (which we can access without decompressing)
     read_compressed_data();
 
+    // if pipelined reading is enabled, start the reads for the next pass on a side stream so
+    // they overlap with this pass's decompression and decode.
+    prefetch_next_pass_column_chunks();
+
     // detect malformed columns.
     // - we have seen some cases in the wild where we have a row group containing N
     //   rows, but the total number of rows in the pages for column X is != N. while it
@@ -1550,7 +1565,10 @@ void reader::impl::create_global_chunk_info()
         _metadata->map_schema_index(col.schema_idx, rg.source_index), rg.source_index);
 
       auto [clock_rate, logical_type] =
-        conversion_info(to_type_id(schema, _strings_to_categorical, _options.timestamp_type.id()),
+        conversion_info(to_type_id(schema,
+                                   _strings_to_categorical or _strings_to_dictionary,
+                                   _options.timestamp_type.id(),
+                                   _use_minimal_decimal_types),
                         _options.timestamp_type.id(),
                         schema.type,
                         schema.logical_type);
@@ -1587,6 +1605,9 @@ void reader::impl::create_global_chunk_info()
                                        chunk_info,
                                        list_bytes_per_row_est,
                                        schema.type == BYTE_ARRAY and _strings_to_categorical,
+                                       schema.type == BYTE_ARRAY and _strings_to_dictionary,
+                                       schema.type == FIXED_LEN_BYTE_ARRAY and
+                                         _use_minimal_decimal_types,
                                        rg.source_index));
     }
     // Adjust for skip_rows when updating the remaining rows after the first group
@@ -129,6 +129,9 @@ struct pass_intermediate_data {
 
   rmm::device_buffer decomp_dict_data{0, cudf::get_default_stream()};
   rmm::device_uvector<string_index_pair> str_dict_index{0, cudf::get_default_stream()};
+  // per-chunk entry counts within str_dict_index, used to build the keys columns when
+  // emitting dictionary-encoded string chunks as dictionary columns
+  std::vector<size_t> str_dict_sizes{};
 
   // cumulative strings column sizes.
   std::vector<size_t> cumulative_col_string_sizes{};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 #include "compact_protocol_reader.hpp"
 #include "io/parquet/parquet.hpp"
 #include "io/utilities/base64_utilities.hpp"
+#include "io/utilities/getenv_or.hpp"
+#include "io/utilities/host_worker_pool.hpp"
 #include "io/utilities/row_selection.hpp"
 #include "ipc/Message_generated.h"
 #include "ipc/Schema_generated.h"
@@ -29,6 +31,9 @@
 #include <thrust/iterator/zip_iterator.h>
 
 #include <functional>
+#include <future>
+#include <map>
+#include <mutex>
 #include <numeric>
 #include <regex>
 
@@ -76,7 +81,8 @@ std::optional<LogicalType> converted_to_logical_type(SchemaElement const& schema
  */
 type_id to_type_id(SchemaElement const& schema,
                    bool strings_to_categorical,
-                   type_id timestamp_type_id)
+                   type_id timestamp_type_id,
+                   bool use_minimal_decimal_types)
 {
   auto const physical_type = schema.type;
   auto const arrow_type    = schema.arrow_type;
@@ -141,6 +147,19 @@ type_id to_type_id(SchemaElement const& schema,
         } else if (physical_type == INT64) {
           return type_id::DECIMAL64;
         } else if (physical_type == FIXED_LEN_BYTE_ARRAY) {
+          if (use_minimal_decimal_types) {
+            // size the output by the declared precision so that no narrowing cast is needed
+            // after the read
+            CUDF_EXPECTS(decimal_precision <= MAX_DECIMAL128_PRECISION,
+                         "Invalid decimal precision");
+            if (decimal_precision <= MAX_DECIMAL32_PRECISION) {
+              return type_id::DECIMAL32;
+            } else if (decimal_precision <= MAX_DECIMAL64_PRECISION) {
+              return type_id::DECIMAL64;
+            } else {
+              return type_id::DECIMAL128;
+            }
+          }
           if (schema.type_length <= static_cast<int32_t>(sizeof(int32_t))) {
             return type_id::DECIMAL32;
           } else if (schema.type_length <= static_cast<int32_t>(sizeof(int64_t))) {
@@ -281,6 +300,38 @@ void metadata::sanitize_schema()
   process(0);
 }
 
+namespace {
+
+/**
+ * @brief Process-wide cache of parsed footers, enabled via LIBCUDF_PARQUET_FOOTER_CACHE.
+ *
+ * Repeated scans of the same dataset pay the thrift parse (and page index parse) once.
+ * Datasources do not expose a file path, so entries are keyed by the source size, footer
+ * length and a hash of the raw footer bytes; a rewritten file produces a different footer and
+ * therefore a different key.
+ */
+using footer_cache_key = std::tuple<size_t, size_t, size_t>;
+
+std::map<footer_cache_key, FileMetaData>& footer_cache()
+{
+  static std::map<footer_cache_key, FileMetaData> cache;
+  return cache;
+}
+
+std::mutex& footer_cache_mutex()
+{
+  static std::mutex mtx;
+  return mtx;
+}
+
+[[nodiscard]] bool is_footer_cache_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_PARQUET_FOOTER_CACHE", 0) != 0;
+  return enabled;
+}
+
+}  // namespace
+
 metadata::metadata(datasource* source)
 {
   constexpr auto header_len = sizeof(file_header_s);
@@ -298,6 +349,29 @@ metadata::metadata(datasource* source)
                "Incorrect footer length");
 
   auto const buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+
+  // the footer hash is also used to key the bloom filter bitset cache, so it is computed even
+  // when the footer cache is disabled
+  footer_hash = std::hash<std::string_view>{}(std::string_view(
+    reinterpret_cast<char const*>(buffer->data()), static_cast<size_t>(ender->footer_len)));
+
+  // if we have already parsed an identical footer, reuse the parsed representation. the page
+  // index locations are part of the footer, so the cached entry includes the parsed page
+  // indexes as well.
+  auto const cache_key =
+    is_footer_cache_enabled()
+      ? std::make_optional(
+          footer_cache_key{len, static_cast<size_t>(ender->footer_len), footer_hash})
+      : std::nullopt;
+  if (cache_key.has_value()) {
+    std::lock_guard<std::mutex> lock(footer_cache_mutex());
+    auto const it = footer_cache().find(*cache_key);
+    if (it != footer_cache().end()) {
+      static_cast<FileMetaData&>(*this) = it->second;
+      return;
+    }
+  }
+
   CompactProtocolReader cp(buffer->data(), ender->footer_len);
   cp.read(this);
   CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
@@ -346,11 +420,38 @@ metadata::metadata(datasource* source)
   }
 
   sanitize_schema();
+
+  if (cache_key.has_value()) {
+    std::lock_guard<std::mutex> lock(footer_cache_mutex());
+    // keep the cache bounded; footers with many row groups can be sizable
+    if (footer_cache().size() >= 64) { footer_cache().clear(); }
+    footer_cache().emplace(*cache_key, static_cast<FileMetaData const&>(*this));
+  }
 }
 
 std::vector<metadata> aggregate_reader_metadata::metadatas_from_sources(
   host_span<std::unique_ptr<datasource> const> sources)
 {
+  // parse footers in parallel across sources; the footer parse is all host work and can
+  // dominate small reads when there are many files or very large row group counts. Tasks run on
+  // the shared host worker pool so the thread count stays bounded for very large file sets.
+  if (sources.size() > 1) {
+    std::vector<std::future<metadata>> parse_tasks;
+    parse_tasks.reserve(sources.size());
+    std::transform(
+      sources.begin(), sources.end(), std::back_inserter(parse_tasks), [](auto const& source) {
+        return cudf::io::detail::host_worker_pool().submit_task(
+          [src = source.get()] { return metadata(src); });
+      });
+    std::vector<metadata> metadatas;
+    metadatas.reserve(sources.size());
+    std::transform(parse_tasks.begin(),
+                   parse_tasks.end(),
+                   std::back_inserter(metadatas),
+                   [](auto& task) { return task.get(); });
+    return metadatas;
+  }
+
   std::vector<metadata> metadatas;
   std::transform(
     sources.begin(), sources.end(), std::back_inserter(metadatas), [](auto const& source) {
@@ -1030,6 +1131,7 @@ std::vector<std::string> aggregate_reader_metadata::get_pandas_index_names() con
 
 std::tuple<int64_t, size_type, std::vector<row_group_info>, std::vector<size_t>>
 aggregate_reader_metadata::select_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   int64_t skip_rows_opt,
   std::optional<size_type> const& num_rows_opt,
@@ -1042,7 +1144,7 @@ aggregate_reader_metadata::select_row_groups(
   // if filter is not empty, then gather row groups to read after predicate pushdown
   if (filter.has_value()) {
     filtered_row_group_indices = filter_row_groups(
-      row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
+      sources, row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
     if (filtered_row_group_indices.has_value()) {
       row_group_indices =
         host_span<std::vector<size_type> const>(filtered_row_group_indices.value());
@@ -1124,7 +1226,8 @@ aggregate_reader_metadata::select_columns(
   std::optional<std::vector<std::string>> const& filter_columns_names,
   bool include_index,
   bool strings_to_categorical,
-  type_id timestamp_type_id)
+  type_id timestamp_type_id,
+  bool use_minimal_decimal_types)
 {
   auto const find_schema_child =
     [&](SchemaElement const& schema_elem, std::string const& name, int const pfm_idx = 0) {
@@ -1166,9 +1269,11 @@ aggregate_reader_metadata::select_columns(
       auto const one_level_list = schema_elem.is_one_level_list(get_schema(schema_elem.parent_idx));
 
       // if we're at the root, this is a new output column
-      auto const col_type = one_level_list
-                              ? type_id::LIST
-                              : to_type_id(schema_elem, strings_to_categorical, timestamp_type_id);
+      auto const col_type =
+        one_level_list
+          ? type_id::LIST
+          : to_type_id(
+              schema_elem, strings_to_categorical, timestamp_type_id, use_minimal_decimal_types);
       auto const dtype    = to_data_type(col_type, schema_elem);
 
       cudf::io::detail::inline_column_buffer output_col(dtype,
@@ -1207,8 +1312,8 @@ aggregate_reader_metadata::select_columns(
         // set up child output column for one-level encoding list
         if (one_level_list) {
           // determine the element data type
-          auto const element_type =
-            to_type_id(schema_elem, strings_to_categorical, timestamp_type_id);
+          auto const element_type = to_type_id(
+            schema_elem, strings_to_categorical, timestamp_type_id, use_minimal_decimal_types);
           auto const element_dtype = to_data_type(element_type, schema_elem);
 
           cudf::io::detail::inline_column_buffer element_col(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -97,7 +97,8 @@ struct row_group_info {
  */
 [[nodiscard]] type_id to_type_id(SchemaElement const& schema,
                                  bool strings_to_categorical,
-                                 type_id timestamp_type_id);
+                                 type_id timestamp_type_id,
+                                 bool use_minimal_decimal_types);
 
 /**
  * @brief Converts cuDF type enum to column logical type
@@ -115,6 +116,10 @@ struct row_group_info {
 struct metadata : public FileMetaData {
   explicit metadata(datasource* source);
   void sanitize_schema();
+
+  // Hash of the raw footer bytes; identifies the footer contents for caches that must
+  // distinguish a rewritten file from a re-read of the same file
+  size_t footer_hash{};
 };
 
 /**
@@ -323,6 +328,7 @@ class aggregate_reader_metadata {
   /**
    * @brief Filters the row groups based on predicate filter
    *
+   * @param sources Dataset sources used to read bloom filter data
    * @param row_group_indices Lists of row groups to read, one per source
    * @param output_dtypes Datatypes of of output columns
    * @param output_column_schemas schema indices of output columns
@@ -331,18 +337,42 @@ class aggregate_reader_metadata {
    * @return Filtered row group indices, if any is filtered.
    */
   [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
     host_span<std::vector<size_type> const> row_group_indices,
     host_span<data_type const> output_dtypes,
     host_span<int const> output_column_schemas,
     std::reference_wrapper<ast::expression const> filter,
     rmm::cuda_stream_view stream) const;
 
+  /**
+   * @brief Prune row groups by probing column chunk bloom filters with equality predicates
+   *
+   * AND-connected equality predicates in the filter are probed against the split-block bloom
+   * filters of candidate row groups, if present; a row group whose filter definitely does not
+   * contain a probed value is dropped. Used after (and in addition to) min/max statistics
+   * based pruning, which cannot help point lookups on high-cardinality columns.
+   *
+   * @param sources Dataset sources used to read the bloom filter data
+   * @param row_group_indices Lists of input row groups to consider, one per source
+   * @param output_column_schemas schema indices of output columns
+   * @param filter AST expression to probe bloom filters with
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered row group indices, if any is filtered.
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> apply_bloom_filters(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
    * The input `row_start` and `row_count` parameters will be recomputed and output as the valid
    * values based on the input row group list.
    *
+   * @param sources Dataset sources used to read bloom filter data during predicate pushdown
    * @param row_group_indices Lists of row groups to read, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
@@ -354,7 +384,8 @@ class aggregate_reader_metadata {
    *         starting row, and list of number of rows per source.
    */
   [[nodiscard]] std::tuple<int64_t, size_type, std::vector<row_group_info>, std::vector<size_t>>
-  select_row_groups(host_span<std::vector<size_type> const> row_group_indices,
+  select_row_groups(host_span<std::unique_ptr<datasource> const> sources,
+                    host_span<std::vector<size_type> const> row_group_indices,
                     int64_t row_start,
                     std::optional<size_type> const& row_count,
                     host_span<data_type const> output_dtypes,
@@ -371,6 +402,7 @@ class aggregate_reader_metadata {
    * @param include_index Whether to always include the PANDAS index column(s)
    * @param strings_to_categorical Type conversion parameter
    * @param timestamp_type_id Type conversion parameter
+   * @param use_minimal_decimal_types Type conversion parameter
    *
    * @return input column information, output column information, list of output column schema
    * indices
@@ -382,7 +414,8 @@ class aggregate_reader_metadata {
                  std::optional<std::vector<std::string>> const& filter_columns_names,
                  bool include_index,
                  bool strings_to_categorical,
-                 type_id timestamp_type_id);
+                 type_id timestamp_type_id,
+                 bool use_minimal_decimal_types);
 };
 
 /**
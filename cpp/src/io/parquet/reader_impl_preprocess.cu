@@ -16,12 +16,18 @@
 
 #include "error.hpp"
 #include "io/comp/common.hpp"
+#include "io/utilities/getenv_or.hpp"
 #include "reader_impl.hpp"
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/detail/utilities/batched_memset.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
@@ -29,15 +35,18 @@
 
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/count.h>
 #include <thrust/fill.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/iterator_categories.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
 #include <thrust/reduce.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
@@ -51,6 +60,19 @@
 namespace cudf::io::parquet::detail {
 namespace {
 
+/**
+ * @brief Returns true if pipelined pass reading is enabled.
+ *
+ * When enabled, the column chunk reads for the next pass are issued on a stream from the global
+ * stream pool while the current pass is being decompressed and decoded, overlapping device IO
+ * with compute.
+ */
+[[nodiscard]] bool is_pipelined_read_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_PARQUET_PIPELINED_READ", 0) != 0;
+  return enabled;
+}
+
 #if defined(PREPROCESS_DEBUG)
 void print_pages(cudf::detail::hostdevice_vector<PageInfo>& pages, rmm::cuda_stream_view _stream)
 {
@@ -220,13 +242,23 @@ void generate_depth_remappings(
 [[nodiscard]] std::future<void> read_column_chunks_async(
   std::vector<std::unique_ptr<datasource>> const& sources,
   cudf::host_span<rmm::device_buffer> page_data,
-  cudf::detail::hostdevice_vector<ColumnChunkDesc>& chunks,
+  cudf::host_span<ColumnChunkDesc> chunks,
   size_t begin_chunk,
   size_t end_chunk,
   std::vector<size_t> const& column_chunk_offsets,
   std::vector<size_type> const& chunk_source_map,
   rmm::cuda_stream_view stream)
 {
+  // Byte ranges separated by a gap of at most this size are merged into a single source read;
+  // reading and discarding small gaps (e.g. skipped columns or page indexes between chunks)
+  // costs less than an extra request on high-latency sources. Zero only merges exactly
+  // contiguous ranges.
+  static size_t const coalesce_gap_limit = getenv_or("LIBCUDF_IO_COALESCE_GAP_SIZE", size_t{0});
+  // When set, reads staged through the host are issued on background tasks so that multiple byte
+  // ranges are in flight concurrently. Off by default since `host_read` of user-provided
+  // datasources is not guaranteed to be thread-safe.
+  static bool const async_host_reads = getenv_or("LIBCUDF_IO_ASYNC_HOST_READS", 0) != 0;
+
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
@@ -237,43 +269,44 @@ void generate_depth_remappings(
     while (next_chunk < end_chunk) {
       size_t const next_offset      = column_chunk_offsets[next_chunk];
       bool const is_next_compressed = (chunks[next_chunk].codec != Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+      if (next_offset < io_offset + io_size ||
+          next_offset - (io_offset + io_size) > coalesce_gap_limit ||
+          is_next_compressed != is_compressed ||
           chunk_source_map[chunk] != chunk_source_map[next_chunk]) {
-        // Can't merge if not contiguous or mixing compressed and uncompressed
+        // Can't merge if not (nearly) contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
         break;
       }
-      io_size += chunks[next_chunk].compressed_size;
+      io_size = next_offset - io_offset + chunks[next_chunk].compressed_size;
       next_chunk++;
     }
     if (io_size != 0) {
       auto& source = sources[chunk_source_map[chunk]];
+      // Buffer needs to be padded.
+      // Required by `gpuDecodePageData`.
+      page_data[chunk] = rmm::device_buffer(
+        cudf::util::round_up_safe(io_size, cudf::io::detail::BUFFER_PADDING_MULTIPLE), stream);
+      auto const dst = static_cast<uint8_t*>(page_data[chunk].data());
       if (source->is_device_read_preferred(io_size)) {
-        // Buffer needs to be padded.
-        // Required by `gpuDecodePageData`.
-        page_data[chunk] = rmm::device_buffer(
-          cudf::util::round_up_safe(io_size, cudf::io::detail::BUFFER_PADDING_MULTIPLE), stream);
-        auto fut_read_size = source->device_read_async(
-          io_offset, io_size, static_cast<uint8_t*>(page_data[chunk].data()), stream);
-        read_tasks.emplace_back(std::move(fut_read_size));
+        read_tasks.emplace_back(source->device_read_async(io_offset, io_size, dst, stream));
+      } else if (async_host_reads) {
+        read_tasks.emplace_back(
+          std::async(std::launch::async, [src = source.get(), dst, io_offset, io_size, stream] {
+            auto const read_buffer = src->host_read(io_offset, io_size);
+            CUDF_CUDA_TRY(cudaMemcpyAsync(
+              dst, read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
+            stream.synchronize();
+            return read_buffer->size();
+          }));
       } else {
         auto const read_buffer = source->host_read(io_offset, io_size);
-        // Buffer needs to be padded.
-        // Required by `gpuDecodePageData`.
-        page_data[chunk] = rmm::device_buffer(
-          cudf::util::round_up_safe(read_buffer->size(), cudf::io::detail::BUFFER_PADDING_MULTIPLE),
-          stream);
-        CUDF_CUDA_TRY(cudaMemcpyAsync(page_data[chunk].data(),
-                                      read_buffer->data(),
-                                      read_buffer->size(),
-                                      cudaMemcpyDefault,
-                                      stream));
+        CUDF_CUDA_TRY(cudaMemcpyAsync(
+          dst, read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
       }
-      auto d_compdata = static_cast<uint8_t const*>(page_data[chunk].data());
+      // The chunks' data offsets within the merged read account for any coalesced gaps
       do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
+        chunks[chunk].compressed_data = dst + (column_chunk_offsets[chunk] - io_offset);
       } while (++chunk != next_chunk);
     } else {
       chunk = next_chunk;
@@ -673,6 +706,20 @@ struct set_str_dict_index_count {
   }
 };
 
+// A data page of a chunk being emitted as a dictionary column must itself be
+// dictionary-encoded, since the decode step emits raw dictionary indices
+struct is_invalid_dict_output_page {
+  device_span<ColumnChunkDesc const> chunks;
+
+  __device__ bool operator()(PageInfo const& page) const
+  {
+    if ((page.flags & PAGEINFO_FLAGS_DICTIONARY) != 0) { return false; }
+    auto const& chunk = chunks[page.chunk_idx];
+    return chunk.is_strings_to_dict and page.encoding != Encoding::PLAIN_DICTIONARY and
+           page.encoding != Encoding::RLE_DICTIONARY;
+  }
+};
+
 struct set_str_dict_index_ptr {
   string_index_pair* const base;
   device_span<size_t const> str_dict_index_offsets;
@@ -757,6 +804,21 @@ void reader::impl::build_string_dict_indices()
 
   size_t const total_str_dict_indexes = thrust::reduce(
     rmm::exec_policy(_stream), str_dict_index_count.begin(), str_dict_index_count.end());
+
+  if (_strings_to_dictionary) {
+    auto const num_bad_pages = thrust::count_if(rmm::exec_policy(_stream),
+                                                pass.pages.d_begin(),
+                                                pass.pages.d_end(),
+                                                is_invalid_dict_output_page{pass.chunks});
+    CUDF_EXPECTS(num_bad_pages == 0,
+                 "convert_strings_to_dictionaries requires all string data pages to be "
+                 "dictionary-encoded");
+    // save the per-chunk dictionary entry counts; the keys columns are built from these
+    // spans of str_dict_index when the output columns are assembled
+    pass.str_dict_sizes = cudf::detail::make_std_vector_sync(
+      device_span<size_t const>{str_dict_index_count.data(), pass.chunks.size()}, _stream);
+  }
+
   if (total_str_dict_indexes == 0) { return; }
 
   // convert to offsets
@@ -783,6 +845,68 @@ void reader::impl::build_string_dict_indices()
   pass.chunks.device_to_host_sync(_stream);
 }
 
+std::unique_ptr<column> reader::impl::wrap_dictionary_column(std::unique_ptr<column> indices,
+                                                             int schema_idx)
+{
+  auto& pass = *_pass_itm_data;
+
+  // a single row group is enforced, so the chunk for a column is at its input column index
+  auto const input_col = std::find_if(
+    _input_columns.cbegin(), _input_columns.cend(), [schema_idx](input_column_info const& col) {
+      return col.schema_idx == schema_idx;
+    });
+  CUDF_EXPECTS(input_col != _input_columns.cend(), "Could not locate column chunk for schema");
+  auto const chunk_idx = std::distance(_input_columns.cbegin(), input_col);
+  auto const dict_offset =
+    pass.str_dict_sizes.empty()
+      ? size_t{0}
+      : std::accumulate(pass.str_dict_sizes.cbegin(), pass.str_dict_sizes.cbegin() + chunk_idx,
+                        size_t{0});
+  auto const dict_size =
+    pass.str_dict_sizes.empty() ? size_t{0} : pass.str_dict_sizes[chunk_idx];
+  auto const dict_entries =
+    device_span<string_index_pair const>{pass.str_dict_index.data() + dict_offset, dict_size};
+
+  auto const num_keys = static_cast<size_type>(dict_entries.size());
+  auto keys           = cudf::make_strings_column(
+    cudf::device_span<thrust::pair<char const*, size_type> const>{dict_entries.data(),
+                                                                  dict_entries.size()},
+    _stream,
+    _mr);
+
+  // parquet stores dictionary entries in insertion order; cudf dictionary keys must be sorted
+  auto const order = cudf::detail::sorted_order(
+    table_view{{keys->view()}}, {}, {}, _stream, cudf::get_current_device_resource_ref());
+  auto sorted_keys = std::move(cudf::detail::gather(table_view{{keys->view()}},
+                                                    order->view(),
+                                                    out_of_bounds_policy::DONT_CHECK,
+                                                    cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                    _stream,
+                                                    _mr)
+                                 ->release()
+                                 .front());
+
+  // invert the sort order to remap raw dictionary positions to sorted key positions
+  auto remap = rmm::device_uvector<size_type>(num_keys, _stream);
+  thrust::scatter(rmm::exec_policy_nosync(_stream),
+                  thrust::counting_iterator<size_type>(0),
+                  thrust::counting_iterator<size_type>(num_keys),
+                  order->view().begin<size_type>(),
+                  remap.begin());
+  auto indices_view = indices->mutable_view();
+  thrust::transform(rmm::exec_policy_nosync(_stream),
+                    indices_view.begin<size_type>(),
+                    indices_view.end<size_type>(),
+                    indices_view.begin<size_type>(),
+                    [remap = device_span<size_type const>{remap}] __device__(size_type idx) {
+                      // null rows may hold arbitrary index values; clamp rather than index the map
+                      return (idx >= 0 and idx < static_cast<size_type>(remap.size())) ? remap[idx]
+                                                                                       : 0;
+                    });
+
+  return make_dictionary_column(std::move(sorted_keys), std::move(indices), _stream, _mr);
+}
+
 void reader::impl::allocate_nesting_info()
 {
   auto& pass    = *_pass_itm_data;
@@ -922,7 +1046,10 @@ void reader::impl::allocate_nesting_info()
           nesting_info[cur_depth].max_def_level = actual_cur_schema.max_definition_level;
           pni[cur_depth].size                   = 0;
           pni[cur_depth].type =
-            to_type_id(actual_cur_schema, _strings_to_categorical, _options.timestamp_type.id());
+            to_type_id(actual_cur_schema,
+                       _strings_to_categorical or _strings_to_dictionary,
+                       _options.timestamp_type.id(),
+                       _use_minimal_decimal_types);
           pni[cur_depth].nullable = cur_schema.repetition_type == OPTIONAL;
         }
 
@@ -971,13 +1098,12 @@ void reader::impl::allocate_level_decode_space()
   }
 }
 
-std::pair<bool, std::future<void>> reader::impl::read_column_chunks()
+std::pair<bool, std::future<void>> reader::impl::read_pass_column_chunks(
+  cudf::host_span<row_group_info const> row_groups_info,
+  cudf::host_span<ColumnChunkDesc> chunks,
+  std::vector<rmm::device_buffer>& raw_page_data,
+  rmm::cuda_stream_view stream)
 {
-  auto const& row_groups_info = _pass_itm_data->row_groups;
-
-  auto& raw_page_data = _pass_itm_data->raw_page_data;
-  auto& chunks        = _pass_itm_data->chunks;
-
   // Descriptors for all the chunks that make up the selected columns
   auto const num_input_columns = _input_columns.size();
   auto const num_chunks        = row_groups_info.size() * num_input_columns;
@@ -1032,7 +1158,67 @@ std::pair<bool, std::future<void>> reader::impl::read_column_chunks()
                                    chunks.size(),
                                    column_chunk_offsets,
                                    chunk_source_map,
-                                   _stream)};
+                                   stream)};
+}
+
+std::pair<bool, std::future<void>> reader::impl::read_column_chunks()
+{
+  auto& pass = *_pass_itm_data;
+
+  // if the chunk data for this pass was already read ahead on a side stream, adopt it instead of
+  // issuing the reads again. the compressed_data pointers were written into the global chunk
+  // descriptors before they were copied into the pass, so only the buffers and the read
+  // completion need to be handed over.
+  if (_prefetched_pass.has_value() &&
+      _prefetched_pass->pass_index == _file_itm_data._current_input_pass) {
+    auto prefetched = std::move(*_prefetched_pass);
+    _prefetched_pass.reset();
+
+    pass.raw_page_data = std::move(prefetched.raw_page_data);
+    // make all work on _stream wait for the prefetch stream before touching the buffers
+    cudf::detail::join_streams(
+      host_span<rmm::cuda_stream_view const>{&prefetched.stream, 1}, _stream);
+    return {prefetched.has_compressed_data, std::move(prefetched.read_task)};
+  }
+  // stale prefetch (should not happen with sequential passes, but be safe)
+  _prefetched_pass.reset();
+
+  return read_pass_column_chunks(
+    pass.row_groups,
+    cudf::host_span<ColumnChunkDesc>{pass.chunks.host_ptr(), pass.chunks.size()},
+    pass.raw_page_data,
+    _stream);
+}
+
+void reader::impl::prefetch_next_pass_column_chunks()
+{
+  auto const next_pass = _file_itm_data._current_input_pass + 1;
+  if (not is_pipelined_read_enabled() || next_pass >= _file_itm_data.num_passes() ||
+      _prefetched_pass.has_value()) {
+    return;
+  }
+
+  auto const row_group_start = _file_itm_data.input_pass_row_group_offsets[next_pass];
+  auto const row_group_end   = _file_itm_data.input_pass_row_group_offsets[next_pass + 1];
+  auto const num_row_groups  = row_group_end - row_group_start;
+  auto const num_chunks      = num_row_groups * _input_columns.size();
+  if (num_chunks == 0) { return; }
+
+  prefetched_pass_data prefetched;
+  prefetched.pass_index = next_pass;
+  prefetched.stream     = cudf::detail::global_cuda_stream_pool().get_stream();
+
+  // read into the global chunk descriptors; setup_next_pass copies them into the pass,
+  // carrying the compressed_data pointers along.
+  auto const chunks = cudf::host_span<ColumnChunkDesc>{
+    _file_itm_data.chunks.data() + (row_group_start * _input_columns.size()), num_chunks};
+  auto const row_groups = cudf::host_span<row_group_info const>{
+    _file_itm_data.row_groups.data() + row_group_start, static_cast<size_t>(num_row_groups)};
+
+  std::tie(prefetched.has_compressed_data, prefetched.read_task) =
+    read_pass_column_chunks(row_groups, chunks, prefetched.raw_page_data, prefetched.stream);
+
+  _prefetched_pass = std::move(prefetched);
 }
 
 void reader::impl::read_compressed_data()
@@ -1286,7 +1472,8 @@ void reader::impl::preprocess_file(read_mode mode)
            _file_itm_data.global_num_rows,
            _file_itm_data.row_groups,
            _file_itm_data.num_rows_per_source) =
-    _metadata->select_row_groups(_options.row_group_indices,
+    _metadata->select_row_groups(_sources,
+                                 _options.row_group_indices,
                                  _options.skip_rows,
                                  _options.num_rows,
                                  output_dtypes,
@@ -1294,6 +1481,9 @@ void reader::impl::preprocess_file(read_mode mode)
                                  _expr_conv.get_converted_expr(),
                                  _stream);
 
+  CUDF_EXPECTS(not _strings_to_dictionary or _file_itm_data.row_groups.size() <= 1,
+               "convert_strings_to_dictionaries supports reading a single row group only");
+
   // Inclusive scan the number of rows per source
   if (not _expr_conv.get_converted_expr().has_value() and mode == read_mode::CHUNKED_READ) {
     _file_itm_data.exclusive_sum_num_rows_per_source.resize(
@@ -1331,7 +1521,10 @@ void reader::impl::preprocess_file(read_mode mode)
   printf("# Input columns: %'lu\n", _input_columns.size());
   for (size_t idx = 0; idx < _input_columns.size(); idx++) {
     auto const& schema = _metadata->get_schema(_input_columns[idx].schema_idx);
-    auto const type_id = to_type_id(schema, _strings_to_categorical, _options.timestamp_type.id());
+    auto const type_id = to_type_id(schema,
+                                    _strings_to_categorical or _strings_to_dictionary,
+                                    _options.timestamp_type.id(),
+                                    _use_minimal_decimal_types);
     printf("\tC(%'lu, %s): %s\n",
            idx,
            _input_columns[idx].name.c_str(),
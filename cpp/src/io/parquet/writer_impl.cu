@@ -29,6 +29,7 @@
 #include "io/parquet/parquet_gpu.hpp"
 #include "io/statistics/column_statistics.cuh"
 #include "io/utilities/column_utils.cuh"
+#include "io/utilities/getenv_or.hpp"
 #include "parquet_common.hpp"
 #include "parquet_gpu.cuh"
 #include "writer_impl.hpp"
@@ -192,6 +193,14 @@ struct aggregate_writer_metadata {
 
 namespace {
 
+// Returns true if the chunked writer should flush encoded data to the sinks on a background
+// thread, overlapping the sink writes with encoding of the next `write()` call's table.
+[[nodiscard]] bool is_async_write_enabled()
+{
+  static bool const enabled = getenv_or("LIBCUDF_PARQUET_ASYNC_WRITE", 0) != 0;
+  return enabled;
+}
+
 /**
  * @brief Convert a mask of encodings to a vector.
  *
@@ -303,6 +312,7 @@ struct schema_tree_node : public SchemaElement {
   int32_t ts_scale;
   column_encoding requested_encoding;
   bool skip_compression;
+  statistics_mode stats_mode = statistics_mode::USE_DEFAULT;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -761,6 +771,7 @@ std::vector<schema_tree_node> construct_parquet_schema_tree(
         set_encoding(col_schema, col_meta);
         col_schema.output_as_byte_array = col_meta.is_enabled_output_as_binary();
         col_schema.skip_compression     = col_meta.is_enabled_skip_compression();
+        col_schema.stats_mode           = col_meta.get_statistics_mode();
         schema.push_back(col_schema);
       } else if (col->type().id() == type_id::STRUCT) {
         // if struct, add current and recursively call for all children
@@ -898,6 +909,7 @@ std::vector<schema_tree_node> construct_parquet_schema_tree(
         set_field_id(col_schema, col_meta);
         set_encoding(col_schema, col_meta);
         col_schema.skip_compression = col_meta.is_enabled_skip_compression();
+        col_schema.stats_mode       = col_meta.get_statistics_mode();
         schema.push_back(col_schema);
       }
     };
@@ -1099,6 +1111,7 @@ parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_stream
   desc.max_rep_level      = _max_rep_level;
   desc.requested_encoding = schema_node.requested_encoding;
   desc.skip_compression   = schema_node.skip_compression;
+  desc.stats_row_stride   = stats_mode_to_row_stride(schema_node.stats_mode);
   return desc;
 }
 
@@ -1744,6 +1757,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                                    size_type max_page_size_rows,
                                    int32_t column_index_truncate_length,
                                    statistics_freq stats_granularity,
+                                   std::optional<std::vector<sorting_column>> const& sorting_columns,
                                    Compression compression,
                                    bool collect_compression_statistics,
                                    dictionary_policy dict_policy,
@@ -1794,6 +1808,18 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
       return pcol.get_device_view(stream);
     });
 
+  // The leading sort key produces ordered page statistics, so the column index kernel
+  // can verify the declared direction with a single directed pass instead of detecting
+  // the order from scratch. Later sort keys are only ordered within ties of the
+  // preceding keys and stay on the detection path.
+  if (sorting_columns.has_value() and not sorting_columns->empty()) {
+    auto const& leading = sorting_columns->front();
+    if (leading.column_idx >= 0 and leading.column_idx < static_cast<int>(col_desc.size())) {
+      col_desc[leading.column_idx].declared_boundary_order =
+        leading.is_descending ? BoundaryOrder::DESCENDING : BoundaryOrder::ASCENDING;
+    }
+  }
+
   // Init page fragments
   // 5000 is good enough for up to ~200-character strings. Longer strings and deeply nested columns
   // will start producing fragments larger than the desired page size, so calculate fragment sizes
@@ -2352,8 +2378,10 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     }
   }
 
-  auto bounce_buffer =
-    cudf::detail::make_pinned_vector_async<uint8_t>(all_device_write ? 0 : max_write_size, stream);
+  // twice the max chunk size so host-sink writes can be double-buffered: the copy of one chunk
+  // overlaps the host write of the previous one (see write_parquet_data_to_sink)
+  auto bounce_buffer = cudf::detail::make_pinned_vector_async<uint8_t>(
+    all_device_write ? 0 : 2 * static_cast<size_t>(max_write_size), stream);
 
   return std::tuple{std::move(agg_meta),
                     std::move(pages),
@@ -2454,8 +2482,22 @@ void writer::impl::update_compression_statistics(
   }
 }
 
+void writer::impl::wait_for_flush()
+{
+  if (_flush_task.valid()) {
+    try {
+      _flush_task.get();
+    } catch (...) {
+      _last_write_successful = false;
+      throw;
+    }
+  }
+}
+
 void writer::impl::write(table_view const& input, std::vector<partition_info> const& partitions)
 {
+  // The previous table's sink flush must complete before its buffers can be reused
+  wait_for_flush();
   _last_write_successful = false;
   CUDF_EXPECTS(not _closed, "Data has already been flushed to out and closed");
 
@@ -2489,6 +2531,7 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
                                            _max_page_size_rows,
                                            _column_index_truncate_length,
                                            _stats_granularity,
+                                           _sorting_columns,
                                            _compression,
                                            _compression_statistics != nullptr,
                                            _dict_policy,
@@ -2509,6 +2552,35 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
   }();
 
   // Compression/encoding were all successful. Now write the intermediate results.
+  if (is_async_write_enabled()) {
+    // Flush on a background thread so the caller can start encoding the next table; the device
+    // buffers backing `pages`/`chunks` are kept alive by the task until the flush completes.
+    _flush_task = std::async(std::launch::async,
+                             [this,
+                              updated_agg_meta     = std::move(updated_agg_meta),
+                              pages                = std::move(pages),
+                              chunks               = std::move(chunks),
+                              global_rowgroup_base = std::move(global_rowgroup_base),
+                              first_rg_in_part     = std::move(first_rg_in_part),
+                              rg_to_part           = std::move(rg_to_part),
+                              comp_stats           = std::move(comp_stats),
+                              uncomp_bfr           = std::move(uncomp_bfr),
+                              comp_bfr             = std::move(comp_bfr),
+                              col_idx_bfr          = std::move(col_idx_bfr),
+                              bounce_buffer        = std::move(bounce_buffer)]() mutable {
+                               write_parquet_data_to_sink(updated_agg_meta,
+                                                          pages,
+                                                          chunks,
+                                                          global_rowgroup_base,
+                                                          first_rg_in_part,
+                                                          rg_to_part,
+                                                          bounce_buffer);
+                               update_compression_statistics(comp_stats);
+                               _last_write_successful = true;
+                             });
+    return;
+  }
+
   write_parquet_data_to_sink(updated_agg_meta,
                              pages,
                              chunks,
@@ -2538,6 +2610,23 @@ void writer::impl::write_parquet_data_to_sink(
   if (num_rowgroups != 0) {
     std::vector<std::future<void>> write_tasks;
 
+    // state for double-buffered host-sink writes: one half of the bounce buffer is being
+    // written to the sink while the next chunk is copied into the other half
+    struct pending_host_write {
+      uint8_t const* data;
+      size_t size;
+      int sink_id;
+    };
+    std::optional<pending_host_write> pending;
+    auto const half_bounce_size = bounce_buffer.size() / 2;
+    size_t bounce_half          = 0;
+    auto const flush_pending    = [&]() {
+      if (pending.has_value()) {
+        _out_sink[pending->sink_id]->host_write(pending->data, pending->size);
+        pending.reset();
+      }
+    };
+
     for (auto r = 0; r < static_cast<int>(num_rowgroups); r++) {
       int const p        = rg_to_part[r];
       int const global_r = global_rowgroup_base[p] + r - first_rg_in_part[p];
@@ -2550,17 +2639,25 @@ void writer::impl::write_parquet_data_to_sink(
         // Skip the range [0, ck.ck_stat_size) since it has already been copied to host
         // and stored in _agg_meta before.
         if (_out_sink[p]->is_device_write_preferred(ck.compressed_size)) {
+          // preserve write ordering within the sink
+          flush_pending();
           write_tasks.push_back(_out_sink[p]->device_write_async(
             dev_bfr + ck.ck_stat_size, ck.compressed_size, _stream));
         } else {
-          CUDF_EXPECTS(bounce_buffer.size() >= ck.compressed_size,
+          CUDF_EXPECTS(half_bounce_size >= ck.compressed_size,
                        "Bounce buffer was not properly initialized.");
-          cudf::detail::cuda_memcpy(
-            host_span{bounce_buffer}.subspan(0, ck.compressed_size),
+          auto const dst =
+            host_span{bounce_buffer}.subspan(bounce_half * half_bounce_size, ck.compressed_size);
+          // enqueue the copy of this chunk, then write the previous chunk to the sink while
+          // the copy is in flight
+          cudf::detail::cuda_memcpy_async(
+            dst,
             device_span<uint8_t const>{dev_bfr + ck.ck_stat_size, ck.compressed_size},
             _stream);
-
-          _out_sink[p]->host_write(bounce_buffer.data(), ck.compressed_size);
+          flush_pending();
+          _stream.synchronize();
+          pending     = pending_host_write{dst.data(), ck.compressed_size, p};
+          bounce_half = 1 - bounce_half;
         }
 
         auto const chunk_offset = _current_chunk_offset[p];
@@ -2574,6 +2671,7 @@ void writer::impl::write_parquet_data_to_sink(
         if (i == 0) { row_group.file_offset = chunk_offset; }
       }
     }
+    flush_pending();
     for (auto const& task : write_tasks) {
       task.wait();
     }
@@ -2635,6 +2733,11 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
   std::vector<std::string> const& column_chunks_file_path)
 {
   if (_closed) { return nullptr; }
+  try {
+    wait_for_flush();
+  } catch (...) {
+    // a failed background flush means the last write did not complete; skip the footer
+  }
   _closed = true;
   if (not _last_write_successful) { return nullptr; }
   for (size_t p = 0; p < _out_sink.size(); p++) {
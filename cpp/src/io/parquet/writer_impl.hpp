@@ -33,6 +33,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -140,6 +141,14 @@ class writer::impl {
                                   host_span<int const> rg_to_part,
                                   host_span<uint8_t> bounce_buffer);
 
+  /**
+   * @brief Wait for the asynchronous sink flush of the previous `write()` call, if any.
+   *
+   * Rethrows any exception raised by the background flush; in that case the writer behaves as if
+   * the previous `write()` call had failed and `close()` will not write a footer.
+   */
+  void wait_for_flush();
+
   // Cuda stream to be used
   rmm::cuda_stream_view _stream;
 
@@ -173,6 +182,7 @@ class writer::impl {
                                                    // completed successfully current write
                                                    // position for rowgroups/chunks.
   std::shared_ptr<writer_compression_statistics> _compression_statistics;  // Optional output
+  std::future<void> _flush_task;  // In-flight sink flush from the previous `write()` call
   bool _last_write_successful = false;
   bool _closed                = false;  // To track if the output has been written to sink.
 };
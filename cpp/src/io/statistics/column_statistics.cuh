@@ -112,8 +112,12 @@ struct calculate_group_statistics_functor {
     using CT           = typename type_convert::template type<T>;
     typed_statistics_chunk<CT, detail::statistics_type_category<T, IO>::include_aggregate> chunk;
 
-    for (uint32_t i = 0; i < s.group.num_rows; i += block_size) {
-      uint32_t r   = i + t;
+    // With a row stride above one only every strided row is included, yielding approximate
+    // statistics from a sample of the group's rows
+    uint32_t const stride      = max(s.col.stats_row_stride, 1u);
+    uint32_t const num_sampled = (s.group.num_rows + stride - 1) / stride;
+    for (uint32_t i = 0; i < num_sampled; i += block_size) {
+      uint32_t r   = (i + t) * stride;
       uint32_t row = r + s.group.start_row;
       if (r < s.group.num_rows) {
         if (s.col.leaf_column->is_valid(row)) {
@@ -154,8 +158,10 @@ struct calculate_group_statistics_functor {
     detail::storage_wrapper<block_size> storage(temp_storage);
     typed_statistics_chunk<uint32_t, false> chunk;
 
-    for (uint32_t i = 0; i < s.group.num_rows; i += block_size) {
-      uint32_t r   = i + t;
+    uint32_t const stride      = max(s.col.stats_row_stride, 1u);
+    uint32_t const num_sampled = (s.group.num_rows + stride - 1) / stride;
+    for (uint32_t i = 0; i < num_sampled; i += block_size) {
+      uint32_t r   = (i + t) * stride;
       uint32_t row = r + s.group.start_row;
       if (r < s.group.num_rows) {
         if (s.col.leaf_column->is_valid(row)) {
@@ -302,6 +308,13 @@ CUDF_KERNEL void __launch_bounds__(block_size, 1)
   cooperative_load(state.col, state.group.col);
   __syncthreads();
 
+  // A zero row stride means statistics are disabled for this column; the zero-initialized chunk
+  // (no extrema, zero counts) is stored without reading any of the column's rows
+  if (state.col.stats_row_stride == 0) {
+    cooperative_load(chunks[blockIdx.x], &state.ck);
+    return;
+  }
+
   // Calculate statistics
   if constexpr (IO == detail::io_file_format::PARQUET) {
     // Do not convert ns to us for int64 timestamps
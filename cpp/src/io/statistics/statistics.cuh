@@ -24,6 +24,7 @@
 #include "byte_array_view.cuh"
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/io/types.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
@@ -58,11 +59,31 @@ struct stats_column_desc {
   uint32_t num_values;  //!< Number of data values in column. Different from num_rows in case of
                         //!< nested columns
   int32_t ts_scale;     //!< timestamp scale (>0: multiply by scale, <0: divide by -scale)
+  uint32_t stats_row_stride;  //!< row stride for statistics gathering: 1 includes every row, N > 1
+                              //!< samples every Nth row, 0 skips the column entirely
 
   column_device_view const* leaf_column;    //!< Pointer to leaf column
   column_device_view const* parent_column;  //!< Pointer to parent column; nullptr if not list type
 };
 
+/// Row stride used when sampled statistics are requested for a column
+constexpr uint32_t stats_sampling_row_stride = 32;
+
+/**
+ * @brief Returns the statistics row stride corresponding to a column's statistics mode
+ *
+ * @param mode The column's statistics mode; `USE_DEFAULT` resolves to exact statistics
+ * @return The row stride to store in `stats_column_desc::stats_row_stride`
+ */
+[[nodiscard]] constexpr uint32_t stats_mode_to_row_stride(statistics_mode mode)
+{
+  switch (mode) {
+    case statistics_mode::NONE: return 0;
+    case statistics_mode::SAMPLED: return stats_sampling_row_stride;
+    default: return 1;
+  }
+}
+
 template <typename ReturnType>
 struct t_array_stats {
   using data_ptr_type = decltype(std::declval<ReturnType const>().data());
@@ -66,20 +66,40 @@ int32_t constexpr ITEMS_PER_TILE   = ITEMS_PER_THREAD * THREADS_PER_TILE;
 int32_t constexpr TILES_PER_CHUNK  = 4096;
 int32_t constexpr ITEMS_PER_CHUNK  = ITEMS_PER_TILE * TILES_PER_CHUNK;
 
-constexpr multistate transition_init(char c, cudf::device_span<char const> delim)
+// Per-thread copy of the delimiter. The transition functions index the delimiter for every input
+// byte and partial match, so serving those reads from registers instead of repeated global memory
+// accesses keeps the per-byte scan cost flat as the delimiter grows.
+struct delimiter_cache {
+  __device__ explicit delimiter_cache(cudf::device_span<char const> delim)
+    : _size{static_cast<uint8_t>(delim.size())}
+  {
+    for (uint8_t i = 0; i < _size; i++) {
+      _chars[i] = delim[i];
+    }
+  }
+
+  [[nodiscard]] __device__ char operator[](uint8_t idx) const { return _chars[idx]; }
+  [[nodiscard]] __device__ uint8_t size() const { return _size; }
+
+ private:
+  char _chars[multistate::max_segment_value];
+  uint8_t _size;
+};
+
+__device__ multistate transition_init(char c, delimiter_cache const& delim)
 {
   auto result = multistate();
 
   result.enqueue(0, 0);
 
-  for (std::size_t i = 0; i < delim.size(); i++) {
+  for (uint8_t i = 0; i < delim.size(); i++) {
     if (delim[i] == c) { result.enqueue(i, i + 1); }
   }
 
   return result;
 }
 
-constexpr multistate transition(char c, multistate state, cudf::device_span<char const> delim)
+__device__ multistate transition(char c, multistate state, delimiter_cache const& delim)
 {
   auto result = multistate();
 
@@ -109,7 +129,7 @@ struct PatternScan {
 
   __device__ inline void Scan(cudf::size_type tile_idx,
                               cudf::io::text::detail::scan_tile_state_view<multistate> tile_state,
-                              cudf::device_span<char const> delim,
+                              delimiter_cache const& delim,
                               char (&thread_data)[ITEMS_PER_THREAD],
                               multistate& thread_multistate)
   {
@@ -195,11 +215,13 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
 
   // STEP 2: Scan inputs to determine absolute thread states
 
+  auto const thread_delim = delimiter_cache{delim};
+
   multistate thread_multistate;
 
   __syncthreads();  // required before temp_memory re-use
   PatternScan(temp_storage.pattern_scan)
-    .Scan(tile_idx, tile_multistates, delim, thread_chars, thread_multistate);
+    .Scan(tile_idx, tile_multistates, thread_delim, thread_chars, thread_multistate);
 
   // STEP 3: Flag matches
 
@@ -207,9 +229,9 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   uint32_t thread_match_mask[(ITEMS_PER_THREAD + 31) / 32]{};
 
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    thread_multistate       = transition(thread_chars[i], thread_multistate, delim);
+    thread_multistate       = transition(thread_chars[i], thread_multistate, thread_delim);
     auto const thread_state = thread_multistate.max_tail();
-    auto const is_match     = i < thread_input_size and thread_state == delim.size();
+    auto const is_match     = i < thread_input_size and thread_state == thread_delim.size();
     thread_match_mask[i / 32] |= uint32_t{is_match} << (i % 32);
     thread_offset += output_offset{is_match};
   }
@@ -64,23 +64,28 @@ class file_source : public datasource {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
-    ssize_t const read_size = std::min(size, _file.size() - offset);
+    auto const read_size = std::min(size, _file.size() - offset);
 
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(host_read(offset, read_size, v.data()) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
     auto const read_size = std::min(size, _file.size() - offset);
 
+    // kvikIO parallelizes large reads across its thread pool and uses pread, which also makes
+    // this path safe to call concurrently
+    if (!_kvikio_file.closed()) {
+      auto const bytes_read = _kvikio_file.pread(dst, read_size, offset).get();
+      CUDF_EXPECTS(bytes_read == read_size, "read failed");
+      return read_size;
+    }
+
+    lseek(_file.desc(), offset, SEEK_SET);
     CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
                  "read failed");
     return read_size;
@@ -536,5 +541,106 @@ std::unique_ptr<datasource> datasource::create(datasource* source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+instrumented_datasource::instrumented_datasource(std::unique_ptr<datasource> source,
+                                                 trace_callback trace)
+  : _source{std::move(source)}, _trace{std::move(trace)}
+{
+  CUDF_EXPECTS(_source != nullptr, "Cannot instrument a null datasource");
+}
+
+instrumented_datasource::statistics instrumented_datasource::get_statistics() const
+{
+  std::scoped_lock lock{_stats_mutex};
+  return _stats;
+}
+
+void instrumented_datasource::record_read(size_t offset,
+                                          size_t size,
+                                          std::chrono::nanoseconds duration,
+                                          bool is_device_read)
+{
+  {
+    std::scoped_lock lock{_stats_mutex};
+    auto& stats = is_device_read ? _stats.device : _stats.host;
+    ++stats.num_reads;
+    stats.bytes_read += size;
+    stats.total_duration += duration;
+  }
+  if (_trace) { _trace(offset, size, duration, is_device_read); }
+}
+
+std::unique_ptr<datasource::buffer> instrumented_datasource::host_read(size_t offset, size_t size)
+{
+  auto const start = std::chrono::steady_clock::now();
+  auto result      = _source->host_read(offset, size);
+  auto const elapsed =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  record_read(offset, result != nullptr ? result->size() : 0, elapsed, false);
+  return result;
+}
+
+size_t instrumented_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  auto const start      = std::chrono::steady_clock::now();
+  auto const bytes_read = _source->host_read(offset, size, dst);
+  auto const elapsed =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  record_read(offset, bytes_read, elapsed, false);
+  return bytes_read;
+}
+
+bool instrumented_datasource::supports_device_read() const
+{
+  return _source->supports_device_read();
+}
+
+bool instrumented_datasource::is_device_read_preferred(size_t size) const
+{
+  return _source->is_device_read_preferred(size);
+}
+
+std::unique_ptr<datasource::buffer> instrumented_datasource::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  auto const start = std::chrono::steady_clock::now();
+  auto result      = _source->device_read(offset, size, stream);
+  auto const elapsed =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  record_read(offset, result != nullptr ? result->size() : 0, elapsed, true);
+  return result;
+}
+
+size_t instrumented_datasource::device_read(size_t offset,
+                                            size_t size,
+                                            uint8_t* dst,
+                                            rmm::cuda_stream_view stream)
+{
+  auto const start      = std::chrono::steady_clock::now();
+  auto const bytes_read = _source->device_read(offset, size, dst, stream);
+  auto const elapsed =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  record_read(offset, bytes_read, elapsed, true);
+  return bytes_read;
+}
+
+std::future<size_t> instrumented_datasource::device_read_async(size_t offset,
+                                                               size_t size,
+                                                               uint8_t* dst,
+                                                               rmm::cuda_stream_view stream)
+{
+  auto const start = std::chrono::steady_clock::now();
+  auto result      = _source->device_read_async(offset, size, dst, stream);
+  auto const elapsed =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  // The duration covers only the submission; the requested size is recorded since the future has
+  // not completed yet
+  record_read(offset, size, elapsed, true);
+  return result;
+}
+
+size_t instrumented_datasource::size() const { return _source->size(); }
+
+bool instrumented_datasource::is_empty() const { return _source->is_empty(); }
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <BS_thread_pool.hpp>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Retrieves the global host worker thread pool.
+ *
+ * Intended for short-lived, CPU-bound tasks such as parsing file footers. Using a shared pool
+ * bounds the number of host threads spawned when reading many files at once; the pool size can be
+ * overridden with the `LIBCUDF_NUM_HOST_WORKERS` environment variable.
+ *
+ * @return Reference to the global host worker thread pool
+ */
+BS::thread_pool& host_worker_pool();
+
+}  // namespace cudf::io::detail
@@ -14,11 +14,20 @@
  * limitations under the License.
  */
 
+#include "jit/cache.hpp"
+
 #include <cudf/utilities/error.hpp>
 
 #include <jitify2.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -108,6 +117,23 @@ std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t de
   auto const value = std::getenv(env_name);
   return value != nullptr ? std::stoull(value) : default_val;
 }
+
+// Archive format: magic, version, entry count, then per entry the file name
+// (no directory components), contents size and contents bytes.
+constexpr char cache_archive_magic[8] = {'c', 'u', 'd', 'f', 'j', 'i', 't', 'c'};
+constexpr uint32_t cache_archive_version = 1;
+
+void write_size(std::ofstream& archive, uint64_t value)
+{
+  archive.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+uint64_t read_size(std::ifstream& archive)
+{
+  uint64_t value = 0;
+  archive.read(reinterpret_cast<char*>(&value), sizeof(value));
+  return value;
+}
 }  // namespace
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
@@ -139,5 +165,91 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+std::size_t export_kernel_cache(std::string const& archive_path)
+{
+  auto const cache_dir = std::filesystem::path(get_program_cache_dir());
+  if (cache_dir.empty() || !std::filesystem::is_directory(cache_dir)) { return 0; }
+
+  std::vector<std::filesystem::path> entries;
+  for (auto const& entry : std::filesystem::directory_iterator(cache_dir)) {
+    if (entry.is_regular_file()) { entries.push_back(entry.path()); }
+  }
+
+  std::ofstream archive(archive_path, std::ios::binary | std::ios::trunc);
+  CUDF_EXPECTS(archive.good(), "Failed to create kernel cache archive: " + archive_path);
+
+  archive.write(cache_archive_magic, sizeof(cache_archive_magic));
+  archive.write(reinterpret_cast<char const*>(&cache_archive_version),
+                sizeof(cache_archive_version));
+  write_size(archive, entries.size());
+
+  for (auto const& path : entries) {
+    auto const name = path.filename().string();
+    std::ifstream input(path, std::ios::binary);
+    CUDF_EXPECTS(input.good(), "Failed to read kernel cache entry: " + path.string());
+    std::string const contents((std::istreambuf_iterator<char>(input)),
+                               std::istreambuf_iterator<char>());
+    write_size(archive, name.size());
+    archive.write(name.data(), name.size());
+    write_size(archive, contents.size());
+    archive.write(contents.data(), contents.size());
+  }
+  CUDF_EXPECTS(archive.good(), "Failed to write kernel cache archive: " + archive_path);
+  return entries.size();
+}
+
+std::size_t import_kernel_cache(std::string const& archive_path)
+{
+  auto const cache_dir = std::filesystem::path(get_program_cache_dir());
+  if (cache_dir.empty()) { return 0; }
+
+  std::ifstream archive(archive_path, std::ios::binary);
+  CUDF_EXPECTS(archive.good(), "Failed to open kernel cache archive: " + archive_path);
+
+  char magic[sizeof(cache_archive_magic)] = {};
+  archive.read(magic, sizeof(magic));
+  uint32_t version = 0;
+  archive.read(reinterpret_cast<char*>(&version), sizeof(version));
+  CUDF_EXPECTS(archive.good() && std::equal(magic, magic + sizeof(magic), cache_archive_magic) &&
+                 version == cache_archive_version,
+               "Not a valid kernel cache archive: " + archive_path);
+
+  auto const count     = read_size(archive);
+  std::size_t imported = 0;
+  for (uint64_t idx = 0; idx < count; ++idx) {
+    std::string name(read_size(archive), '\0');
+    archive.read(name.data(), name.size());
+    std::string contents(read_size(archive), '\0');
+    archive.read(contents.data(), contents.size());
+    CUDF_EXPECTS(archive.good(), "Truncated kernel cache archive: " + archive_path);
+    // entry names must be plain file names from the cache directory
+    CUDF_EXPECTS(name.find('/') == std::string::npos && name.find("..") == std::string::npos,
+                 "Invalid entry name in kernel cache archive: " + name);
+
+    auto const target = cache_dir / name;
+    if (std::filesystem::exists(target)) { continue; }  // never clobber newer local entries
+    std::ofstream output(target, std::ios::binary);
+    CUDF_EXPECTS(output.good(), "Failed to write kernel cache entry: " + target.string());
+    output.write(contents.data(), contents.size());
+    ++imported;
+  }
+  return imported;
+}
+
+std::future<std::size_t> prewarm_kernel_cache(jitify2::PreprocessedProgramData preprog,
+                                              std::vector<kernel_prewarm_request> requests)
+{
+  return std::async(
+    std::launch::async, [preprog = std::move(preprog), requests = std::move(requests)]() {
+      std::size_t compiled = 0;
+      for (auto const& request : requests) {
+        get_program_cache(preprog).get_kernel(
+          request.kernel_name, {}, request.header_sources, {"-arch=sm_."});
+        ++compiled;
+      }
+      return compiled;
+    });
+}
+
 }  // namespace jit
 }  // namespace cudf
@@ -18,12 +18,69 @@
 
 #include <jitify2.hpp>
 
+#include <future>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Exports the on-disk JIT kernel cache into a single archive file
+ *
+ * All compiled programs in the file cache for the current cudf version and
+ * device compute capability are packed into one archive that can be shipped
+ * to another machine and restored with `import_kernel_cache`.
+ *
+ * @throw cudf::logic_error if the archive file cannot be created
+ *
+ * @param archive_path Path of the archive file to create
+ * @return Number of compiled programs exported; zero if file caching is disabled
+ */
+std::size_t export_kernel_cache(std::string const& archive_path);
+
+/**
+ * @brief Imports compiled programs from an archive created by `export_kernel_cache`
+ *
+ * Entries are restored into the file cache directory for the current cudf
+ * version and device compute capability. Entries already present on disk are
+ * left untouched.
+ *
+ * @throw cudf::logic_error if the archive cannot be opened or is not a valid
+ * kernel cache archive
+ *
+ * @param archive_path Path of the archive file to read
+ * @return Number of compiled programs imported; zero if file caching is disabled
+ */
+std::size_t import_kernel_cache(std::string const& archive_path);
+
+/**
+ * @brief A kernel to compile ahead of time with `prewarm_kernel_cache`
+ */
+struct kernel_prewarm_request {
+  std::string kernel_name;             ///< Fully instantiated kernel template name
+  jitify2::StringMap header_sources;   ///< Generated header sources keyed by include name
+};
+
+/**
+ * @brief Compiles a list of kernels on a background thread
+ *
+ * Each kernel is compiled (or loaded from the file cache) through the same
+ * program cache used on the query path, so a later `get_kernel` with the same
+ * name is a cache hit instead of a 1-2s first-call compile. Call at process
+ * startup with the kernel combinations the workload is known to use.
+ *
+ * Compilation errors are reported through the returned future.
+ *
+ * @param preprog Preprocessed program data the kernels belong to
+ * @param requests Kernels to compile
+ * @return Future holding the number of kernels compiled
+ */
+std::future<std::size_t> prewarm_kernel_cache(jitify2::PreprocessedProgramData preprog,
+                                              std::vector<kernel_prewarm_request> requests);
+
 }  // namespace jit
 }  // namespace cudf
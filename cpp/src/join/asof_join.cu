@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/join_common_utils.hpp"
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left_keys,
+                                                          table_view const& right_keys,
+                                                          column_view const& left_on,
+                                                          column_view const& right_on,
+                                                          null_equality compare_nulls,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(cudf::have_same_types(left_keys, right_keys),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+  CUDF_EXPECTS(cudf::have_same_types(left_on, right_on),
+               "Mismatch in as-of ordering column data types",
+               cudf::data_type_error);
+  CUDF_EXPECTS(left_keys.num_columns() == 0 or left_keys.num_rows() == left_on.size(),
+               "Mismatch in number of rows between the left keys and ordering column");
+  CUDF_EXPECTS(right_keys.num_columns() == 0 or right_keys.num_rows() == right_on.size(),
+               "Mismatch in number of rows between the right keys and ordering column");
+  CUDF_EXPECTS(not left_on.has_nulls() and not right_on.has_nulls(),
+               "As-of ordering columns must not contain nulls");
+
+  auto const num_left = left_on.size();
+  auto result         = std::make_unique<rmm::device_uvector<size_type>>(num_left, stream, mr);
+  if (num_left == 0) { return result; }
+  if (right_on.size() == 0) {
+    thrust::fill(rmm::exec_policy(stream), result->begin(), result->end(), JoinNoneValue);
+    return result;
+  }
+
+  // Lexicographic order on (keys..., on) groups each right key once and sorts its timestamps, so
+  // the upper bound of a left row lands just past its latest candidate. The stable order makes
+  // the last original occurrence win among ties, matching pandas merge_asof.
+  auto left_columns = std::vector<column_view>(left_keys.begin(), left_keys.end());
+  left_columns.push_back(left_on);
+  auto right_columns = std::vector<column_view>(right_keys.begin(), right_keys.end());
+  right_columns.push_back(right_on);
+  auto const left_combined  = table_view{left_columns};
+  auto const right_combined = table_view{right_columns};
+
+  std::vector<order> const column_order(right_combined.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(right_combined.num_columns(), null_order::BEFORE);
+
+  auto const temp_mr = cudf::get_current_device_resource_ref();
+  auto const right_order =
+    cudf::detail::stable_sorted_order(right_combined, column_order, null_precedence, stream, temp_mr);
+  auto const sorted_right = cudf::detail::gather(right_combined,
+                                                 right_order->view(),
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 negative_index_policy::NOT_ALLOWED,
+                                                 stream,
+                                                 temp_mr);
+  auto const match_pos    = cudf::detail::upper_bound(
+    sorted_right->view(), left_combined, column_order, null_precedence, stream, temp_mr);
+
+  auto const d_pos   = match_pos->view().begin<size_type>();
+  auto const d_order = right_order->view().begin<size_type>();
+
+  if (left_keys.num_columns() == 0) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_left),
+                      result->begin(),
+                      [d_pos, d_order] __device__(size_type i) -> size_type {
+                        auto const pos = d_pos[i];
+                        return pos > 0 ? d_order[pos - 1] : JoinNoneValue;
+                      });
+    return result;
+  }
+
+  // The row just below the upper bound may belong to a smaller key; a match requires its keys to
+  // equal the left row's
+  auto const num_keys = left_keys.num_columns();
+  auto const sorted_right_keys =
+    table_view{std::vector<column_view>(sorted_right->view().begin(),
+                                        sorted_right->view().begin() + num_keys)};
+  auto const comparator = cudf::experimental::row::equality::two_table_comparator(
+    left_keys, sorted_right_keys, stream);
+  auto const has_any_nulls = has_nested_nulls(left_keys) or has_nested_nulls(sorted_right_keys);
+
+  auto const build_matches = [&](auto const d_equal) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_left),
+                      result->begin(),
+                      [d_pos, d_order, d_equal] __device__(size_type i) -> size_type {
+                        auto const pos = d_pos[i];
+                        if (pos <= 0) { return JoinNoneValue; }
+                        using cudf::experimental::row::lhs_index_type;
+                        using cudf::experimental::row::rhs_index_type;
+                        return d_equal(lhs_index_type{i}, rhs_index_type{pos - 1})
+                                 ? d_order[pos - 1]
+                                 : JoinNoneValue;
+                      });
+  };
+  if (cudf::detail::has_nested_columns(left_keys) or
+      cudf::detail::has_nested_columns(sorted_right_keys)) {
+    build_matches(
+      comparator.equal_to<true>(nullate::DYNAMIC{has_any_nulls}, compare_nulls));
+  } else {
+    build_matches(
+      comparator.equal_to<false>(nullate::DYNAMIC{has_any_nulls}, compare_nulls));
+  }
+
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<rmm::device_uvector<size_type>> asof_join(table_view const& left_keys,
+                                                          table_view const& right_keys,
+                                                          column_view const& left_on,
+                                                          column_view const& right_on,
+                                                          null_equality compare_nulls,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::asof_join(left_keys, right_keys, left_on, right_on, compare_nulls, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/band_join.hpp"
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <optional>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief One side of a band predicate: `left_col <op> right_col + sign * delta`
+ */
+struct comparison_bound {
+  size_type left_column;
+  size_type right_column;
+  ast::generic_scalar_device_view delta;
+  int sign;
+  ast_operator op;
+};
+
+/**
+ * @brief Matches `left_col >= right_col +/- literal` or `left_col <= right_col +/- literal`
+ */
+std::optional<comparison_bound> match_comparison(ast::expression const& expr)
+{
+  auto const* compare = dynamic_cast<ast::operation const*>(&expr);
+  if (compare == nullptr) { return std::nullopt; }
+  auto const op = compare->get_operator();
+  if (op != ast_operator::GREATER_EQUAL and op != ast_operator::LESS_EQUAL) {
+    return std::nullopt;
+  }
+
+  auto const& operands = compare->get_operands();
+  auto const* left_col = dynamic_cast<ast::column_reference const*>(&operands.front().get());
+  if (left_col == nullptr or left_col->get_table_source() != ast::table_reference::LEFT) {
+    return std::nullopt;
+  }
+
+  auto const* shifted = dynamic_cast<ast::operation const*>(&operands.back().get());
+  if (shifted == nullptr) { return std::nullopt; }
+  auto const shift_op = shifted->get_operator();
+  if (shift_op != ast_operator::ADD and shift_op != ast_operator::SUB) { return std::nullopt; }
+
+  auto const& shift_operands = shifted->get_operands();
+  auto const* right_col = dynamic_cast<ast::column_reference const*>(&shift_operands.front().get());
+  auto const* delta     = dynamic_cast<ast::literal const*>(&shift_operands.back().get());
+  if (right_col == nullptr or right_col->get_table_source() != ast::table_reference::RIGHT or
+      delta == nullptr) {
+    return std::nullopt;
+  }
+
+  return comparison_bound{left_col->get_column_index(),
+                          right_col->get_column_index(),
+                          delta->get_value(),
+                          shift_op == ast_operator::ADD ? 1 : -1,
+                          op};
+}
+
+/**
+ * @brief Computes `a - sign * delta`, the band bound on the right value for left value `a`
+ */
+template <typename T>
+struct bound_functor {
+  ast::generic_scalar_device_view delta;
+  int sign;
+
+  __device__ T operator()(T a) const
+  {
+    auto const d = delta.value<T>();
+    return sign > 0 ? static_cast<T>(a - d) : static_cast<T>(a + d);
+  }
+};
+
+struct band_join_dispatcher {
+  template <typename T, CUDF_ENABLE_IF(std::is_integral_v<T> and std::is_signed_v<T>)>
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  operator()(column_view const& left,
+             column_view const& right,
+             band_join_predicate const& predicate,
+             rmm::cuda_stream_view stream,
+             rmm::device_async_resource_ref mr) const
+  {
+    auto const num_left  = left.size();
+    auto const num_right = right.size();
+
+    // Sort the right band values once, keeping their original row indices
+    auto right_values = rmm::device_uvector<T>(num_right, stream);
+    thrust::copy(rmm::exec_policy(stream), right.begin<T>(), right.end<T>(), right_values.begin());
+    auto right_order = rmm::device_uvector<size_type>(num_right, stream);
+    thrust::sequence(rmm::exec_policy(stream), right_order.begin(), right_order.end());
+    thrust::sort_by_key(
+      rmm::exec_policy(stream), right_values.begin(), right_values.end(), right_order.begin());
+
+    // Each left row's candidates are a contiguous window of the sorted right values, found with
+    // a pair of binary searches on its band bounds
+    auto const lower_iter = thrust::make_transform_iterator(
+      left.begin<T>(), bound_functor<T>{predicate.lower_delta, predicate.lower_sign});
+    auto const upper_iter = thrust::make_transform_iterator(
+      left.begin<T>(), bound_functor<T>{predicate.upper_delta, predicate.upper_sign});
+
+    auto window_begin = rmm::device_uvector<size_type>(num_left, stream);
+    auto window_end   = rmm::device_uvector<size_type>(num_left, stream);
+    thrust::lower_bound(rmm::exec_policy(stream),
+                        right_values.begin(),
+                        right_values.end(),
+                        lower_iter,
+                        lower_iter + num_left,
+                        window_begin.begin());
+    thrust::upper_bound(rmm::exec_policy(stream),
+                        right_values.begin(),
+                        right_values.end(),
+                        upper_iter,
+                        upper_iter + num_left,
+                        window_end.begin());
+
+    auto offsets = rmm::device_uvector<std::size_t>(num_left, stream);
+    auto const window_size_iter = thrust::make_transform_iterator(
+      thrust::make_zip_iterator(window_begin.begin(), window_end.begin()),
+      [] __device__(thrust::tuple<size_type, size_type> window) -> std::size_t {
+        auto const begin = thrust::get<0>(window);
+        auto const end   = thrust::get<1>(window);
+        return end > begin ? end - begin : 0;
+      });
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           window_size_iter,
+                           window_size_iter + num_left,
+                           offsets.begin(),
+                           std::size_t{0});
+
+    auto const last_offset = offsets.back_element(stream);
+    auto const last_begin  = window_begin.back_element(stream);
+    auto const last_end    = window_end.back_element(stream);
+    auto const join_size =
+      last_offset + (last_end > last_begin ? static_cast<std::size_t>(last_end - last_begin) : 0);
+
+    auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(num_left),
+                     [d_begin   = window_begin.data(),
+                      d_end     = window_end.data(),
+                      d_offsets = offsets.data(),
+                      d_order   = right_order.data(),
+                      d_left    = left_indices->data(),
+                      d_right   = right_indices->data()] __device__(size_type i) {
+                       auto out = d_offsets[i];
+                       for (auto j = d_begin[i]; j < d_end[i]; ++j, ++out) {
+                         d_left[out]  = i;
+                         d_right[out] = d_order[j];
+                       }
+                     });
+
+    return std::pair(std::move(left_indices), std::move(right_indices));
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not std::is_integral_v<T> or not std::is_signed_v<T>),
+            typename... Args>
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported column type for a band join");
+  }
+};
+
+}  // namespace
+
+std::optional<band_join_predicate> match_band_predicate(ast::expression const& predicate,
+                                                        table_view const& left,
+                                                        table_view const& right)
+{
+  auto const* conjunction = dynamic_cast<ast::operation const*>(&predicate);
+  if (conjunction == nullptr or conjunction->get_operator() != ast_operator::LOGICAL_AND) {
+    return std::nullopt;
+  }
+
+  auto const& operands = conjunction->get_operands();
+  auto const first     = match_comparison(operands.front().get());
+  auto const second    = match_comparison(operands.back().get());
+  if (not first.has_value() or not second.has_value() or first->op == second->op) {
+    return std::nullopt;
+  }
+  // `a >= b + d` bounds b from above, `a <= b + d` bounds it from below
+  auto const& upper = first->op == ast_operator::GREATER_EQUAL ? *first : *second;
+  auto const& lower = first->op == ast_operator::LESS_EQUAL ? *first : *second;
+  if (upper.left_column != lower.left_column or upper.right_column != lower.right_column) {
+    return std::nullopt;
+  }
+
+  // The binary-search path requires one non-nullable signed integral column pair of matching
+  // type; unsigned wraparound and floating-point NaNs would diverge from the expression's own
+  // arithmetic, so the generic evaluation handles everything else
+  auto const& left_col  = left.column(upper.left_column);
+  auto const& right_col = right.column(upper.right_column);
+  if (left_col.type() != right_col.type() or not cudf::is_integral(left_col.type()) or
+      cudf::is_unsigned(left_col.type()) or left_col.type().id() == type_id::BOOL8 or
+      left_col.has_nulls() or right_col.has_nulls() or upper.delta.type() != left_col.type() or
+      lower.delta.type() != left_col.type()) {
+    return std::nullopt;
+  }
+
+  return band_join_predicate{upper.left_column,
+                             upper.right_column,
+                             lower.delta,
+                             upper.delta,
+                             lower.sign,
+                             upper.sign};
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+band_inner_join(table_view const& left,
+                table_view const& right,
+                band_join_predicate const& predicate,
+                rmm::cuda_stream_view stream,
+                rmm::device_async_resource_ref mr)
+{
+  auto const& left_col  = left.column(predicate.left_column);
+  auto const& right_col = right.column(predicate.right_column);
+  return type_dispatcher(
+    left_col.type(), band_join_dispatcher{}, left_col, right_col, predicate, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief A conditional-join predicate recognized as a band over a pair of columns
+ *
+ * Describes `a BETWEEN b - X AND b + Y` patterns normalized to inclusive bounds on the right
+ * value: a pair (a, b) matches when `a - lower_sign * lower_delta <= b` and
+ * `b <= a - upper_sign * upper_delta`. The deltas are the AST literals, viewed on device.
+ */
+struct band_join_predicate {
+  size_type left_column;                        ///< Index of the left table's band column
+  size_type right_column;                       ///< Index of the right table's band column
+  ast::generic_scalar_device_view lower_delta;  ///< Literal of the lower-bound comparison
+  ast::generic_scalar_device_view upper_delta;  ///< Literal of the upper-bound comparison
+  int lower_sign;                               ///< Sign of the lower literal in `b +/- delta`
+  int upper_sign;                               ///< Sign of the upper literal in `b +/- delta`
+};
+
+/**
+ * @brief Recognizes a band predicate in a conditional-join expression
+ *
+ * Matches the shape `LOGICAL_AND(left_col >= right_col +/- lit, left_col <= right_col +/- lit)`
+ * (the two comparisons in either order) over a single non-nullable signed integral column pair
+ * of matching type. Any other expression returns nullopt and the caller falls back to the
+ * generic nested-loop evaluation.
+ *
+ * @param predicate The conditional-join expression
+ * @param left The left table
+ * @param right The right table
+ * @return The normalized band predicate, or nullopt if the expression is not a band
+ */
+std::optional<band_join_predicate> match_band_predicate(ast::expression const& predicate,
+                                                        table_view const& left,
+                                                        table_view const& right);
+
+/**
+ * @brief Computes the inner join defined by a band predicate in O((n + m) log m)
+ *
+ * Sorts the right band column once, then finds each left row's candidate window with a pair of
+ * binary searches instead of evaluating the expression against every pair.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param predicate The band predicate produced by `match_band_predicate`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors' device memory
+ * @return A pair of vectors [left_indices, right_indices] of the matching pairs
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+band_inner_join(table_view const& left,
+                table_view const& right,
+                band_join_predicate const& predicate,
+                rmm::cuda_stream_view stream,
+                rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
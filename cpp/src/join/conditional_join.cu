@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "join/band_join.hpp"
 #include "join/conditional_join.hpp"
 #include "join/conditional_join_kernels.cuh"
 #include "join/join_common_utils.cuh"
@@ -22,9 +23,12 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/detail/device_scalar.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -34,6 +38,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <optional>
 
 namespace cudf {
@@ -172,6 +177,14 @@ conditional_join(table_view const& left,
     }
   }
 
+  // A band predicate (a BETWEEN b - X AND b + Y) admits a sort plus binary-search algorithm in
+  // place of evaluating the expression against every pair of rows.
+  if (join_type == join_kind::INNER_JOIN and not output_size.has_value()) {
+    if (auto const band = match_band_predicate(binary_predicate, left, right)) {
+      return band_inner_join(left, right, *band, stream, mr);
+    }
+  }
+
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
   // path.
@@ -373,6 +386,45 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   return size.value(stream);
 }
 
+std::size_t estimate_conditional_join_output_size(table_view const& left,
+                                                  table_view const& right,
+                                                  ast::expression const& binary_predicate,
+                                                  join_kind join_type,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  // Probe roughly one left row per `sample_stride`, with a floor below which the exact size
+  // kernel is cheap enough to run directly
+  size_type constexpr sample_stride   = 100;
+  size_type constexpr min_sample_rows = 1024;
+
+  auto const num_rows     = left.num_rows();
+  auto const sample_count = std::max(min_sample_rows, num_rows / sample_stride);
+  if (num_rows == 0 or sample_count >= num_rows) {
+    return compute_conditional_join_output_size(
+      left, right, binary_predicate, join_type, stream, mr);
+  }
+
+  // Evaluate the predicate over an evenly strided sample of the left rows against the full right
+  // table, then extrapolate the matched count to the full left table
+  auto const stride     = num_rows / sample_count;
+  auto const gather_map = cudf::detail::sequence(sample_count,
+                                                 numeric_scalar<size_type>(0, true, stream),
+                                                 numeric_scalar<size_type>(stride, true, stream),
+                                                 stream,
+                                                 cudf::get_current_device_resource_ref());
+  auto const sampled_left = cudf::detail::gather(left,
+                                                 gather_map->view(),
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                 stream,
+                                                 cudf::get_current_device_resource_ref());
+  auto const sampled_size = compute_conditional_join_output_size(
+    sampled_left->view(), right, binary_predicate, join_type, stream, mr);
+  return static_cast<std::size_t>(static_cast<double>(sampled_size) *
+                                  static_cast<double>(num_rows) / sample_count);
+}
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -486,4 +538,48 @@ std::size_t conditional_left_anti_join_size(table_view const& left,
     left, right, binary_predicate, detail::join_kind::LEFT_ANTI_JOIN, stream, mr);
 }
 
+std::size_t conditional_inner_join_size_estimate(table_view const& left,
+                                                 table_view const& right,
+                                                 ast::expression const& binary_predicate,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_conditional_join_output_size(
+    left, right, binary_predicate, detail::join_kind::INNER_JOIN, stream, mr);
+}
+
+std::size_t conditional_left_join_size_estimate(table_view const& left,
+                                                table_view const& right,
+                                                ast::expression const& binary_predicate,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_conditional_join_output_size(
+    left, right, binary_predicate, detail::join_kind::LEFT_JOIN, stream, mr);
+}
+
+std::size_t conditional_left_semi_join_size_estimate(table_view const& left,
+                                                     table_view const& right,
+                                                     ast::expression const& binary_predicate,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_conditional_join_output_size(
+    left, right, binary_predicate, detail::join_kind::LEFT_SEMI_JOIN, stream, mr);
+}
+
+std::size_t conditional_left_anti_join_size_estimate(table_view const& left,
+                                                     table_view const& right,
+                                                     ast::expression const& binary_predicate,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_conditional_join_output_size(
+    left, right, binary_predicate, detail::join_kind::LEFT_ANTI_JOIN, stream, mr);
+}
+
 }  // namespace cudf
@@ -25,6 +25,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -37,6 +38,7 @@
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/sequence.h>
+#include <thrust/tabulate.h>
 
 #include <cstddef>
 #include <limits>
@@ -90,6 +92,18 @@ struct output_fn {
     return static_cast<cudf::size_type>(x.second);
   }
 };
+
+/**
+ * @brief Device functor to return the precomputed hash of a given row.
+ */
+struct precomputed_hash_fn {
+  cudf::device_span<hash_value_type const> hashes;
+
+  __device__ __forceinline__ hash_value_type operator()(size_type i) const noexcept
+  {
+    return hashes[i];
+  }
+};
 }  // namespace
 
 template <cudf::has_nested HasNested>
@@ -106,6 +120,7 @@ distinct_hash_join<HasNested>::distinct_hash_join(cudf::table_view const& build,
       cudf::experimental::row::equality::preprocessed_table::create(_build, stream)},
     _preprocessed_probe{
       cudf::experimental::row::equality::preprocessed_table::create(_probe, stream)},
+    _probe_hashes{static_cast<std::size_t>(probe.num_rows()), stream},
     _hash_table{build.num_rows(),
                 CUCO_DESIRED_LOAD_FACTOR,
                 cuco::empty_key{cuco::pair{std::numeric_limits<hash_value_type>::max(),
@@ -121,6 +136,18 @@ distinct_hash_join<HasNested>::distinct_hash_join(cudf::table_view const& build,
   CUDF_FUNC_RANGE();
   CUDF_EXPECTS(0 != this->_build.num_columns(), "Hash join build table is empty");
 
+  // Cache the probe row hashes once so that repeated probes against the same build table skip
+  // row hashing entirely
+  if (this->_probe.num_rows() > 0) {
+    auto const probe_row_hasher =
+      cudf::experimental::row::hash::row_hasher{this->_preprocessed_probe};
+    auto const d_probe_hasher = probe_row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
+    thrust::tabulate(rmm::exec_policy_nosync(stream),
+                     this->_probe_hashes.begin(),
+                     this->_probe_hashes.end(),
+                     d_probe_hasher);
+  }
+
   if (this->_build.num_rows() == 0) { return; }
 
   auto const row_hasher = experimental::row::hash::row_hasher{this->_preprocessed_build};
@@ -167,11 +194,9 @@ distinct_hash_join<HasNested>::inner_join(rmm::cuda_stream_view stream,
   auto probe_indices =
     std::make_unique<rmm::device_uvector<size_type>>(probe_table_num_rows, stream, mr);
 
-  auto const probe_row_hasher =
-    cudf::experimental::row::hash::row_hasher{this->_preprocessed_probe};
-  auto const d_probe_hasher = probe_row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
-  auto const iter           = cudf::detail::make_counting_transform_iterator(
-    0, build_keys_fn<decltype(d_probe_hasher), lhs_index_type>{d_probe_hasher});
+  auto const d_probe_hash = precomputed_hash_fn{this->_probe_hashes};
+  auto const iter         = cudf::detail::make_counting_transform_iterator(
+    0, build_keys_fn<precomputed_hash_fn, lhs_index_type>{d_probe_hash});
 
   auto found_indices = rmm::device_uvector<size_type>(probe_table_num_rows, stream);
   auto const found_begin =
@@ -227,11 +252,9 @@ std::unique_ptr<rmm::device_uvector<size_type>> distinct_hash_join<HasNested>::l
     thrust::fill(
       rmm::exec_policy_nosync(stream), build_indices->begin(), build_indices->end(), JoinNoneValue);
   } else {
-    auto const probe_row_hasher =
-      cudf::experimental::row::hash::row_hasher{this->_preprocessed_probe};
-    auto const d_probe_hasher = probe_row_hasher.device_hasher(nullate::DYNAMIC{this->_has_nulls});
-    auto const iter           = cudf::detail::make_counting_transform_iterator(
-      0, build_keys_fn<decltype(d_probe_hasher), lhs_index_type>{d_probe_hasher});
+    auto const d_probe_hash = precomputed_hash_fn{this->_probe_hashes};
+    auto const iter         = cudf::detail::make_counting_transform_iterator(
+      0, build_keys_fn<precomputed_hash_fn, lhs_index_type>{d_probe_hash});
 
     auto const output_begin =
       thrust::make_transform_output_iterator(build_indices->begin(), output_fn{});
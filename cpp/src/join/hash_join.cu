@@ -20,6 +20,7 @@
 #include <cudf/detail/join.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/join.hpp>
 #include <cudf/utilities/error.hpp>
@@ -371,11 +372,12 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
   : _has_nulls(has_nulls),
     _is_empty{build.num_rows() == 0},
     _nulls_equal{compare_nulls},
-    _hash_table{compute_hash_table_size(build.num_rows()),
-                cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
-                cuco::empty_value{cudf::detail::JoinNoneValue},
-                stream.value(),
-                cudf::detail::cuco_allocator<char>{rmm::mr::polymorphic_allocator<char>{}, stream}},
+    _hash_table{std::make_unique<map_type>(
+      compute_hash_table_size(build.num_rows()),
+      cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+      cuco::empty_value{cudf::detail::JoinNoneValue},
+      stream.value(),
+      cudf::detail::cuco_allocator<char>{rmm::mr::polymorphic_allocator<char>{}, stream})},
     _build{build},
     _preprocessed_build{
       cudf::experimental::row::equality::preprocessed_table::create(_build, stream)}
@@ -389,13 +391,63 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
     cudf::detail::bitmask_and(build, stream, cudf::get_current_device_resource_ref()).first;
   cudf::detail::build_join_hash_table(_build,
                                       _preprocessed_build,
-                                      _hash_table,
+                                      *_hash_table,
                                       _has_nulls,
                                       _nulls_equal,
+                                      0,
                                       reinterpret_cast<bitmask_type const*>(row_bitmask.data()),
                                       stream);
 }
 
+template <typename Hasher>
+void hash_join<Hasher>::insert(cudf::table_view const& build, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(build.num_columns() == _build.num_columns(),
+               "Mismatch in number of columns with the build table");
+  CUDF_EXPECTS(cudf::have_same_types(_build, build),
+               "Mismatch in build column data types",
+               cudf::data_type_error);
+  CUDF_EXPECTS(build.num_rows() >= _build.num_rows(),
+               "Build table must contain the current build table as a prefix");
+  CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(build),
+               "Build table has nulls while hash join was not constructed with null check.");
+
+  auto const first_new_row = _build.num_rows();
+  if (build.num_rows() == first_new_row) { return; }
+
+  _build              = build;
+  _preprocessed_build =
+    cudf::experimental::row::equality::preprocessed_table::create(_build, stream);
+
+  auto const row_bitmask =
+    cudf::detail::bitmask_and(build, stream, cudf::get_current_device_resource_ref()).first;
+  auto const bitmask_ptr = reinterpret_cast<bitmask_type const*>(row_bitmask.data());
+
+  if (compute_hash_table_size(build.num_rows()) > _hash_table->get_capacity()) {
+    // The appended rows outgrew the allocated slots: reallocate at the target occupancy for the
+    // new size and rebuild from scratch. The occupancy headroom amortizes these rebuilds.
+    _hash_table = std::make_unique<map_type>(
+      compute_hash_table_size(build.num_rows()),
+      cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+      cuco::empty_value{cudf::detail::JoinNoneValue},
+      stream.value(),
+      cudf::detail::cuco_allocator<char>{rmm::mr::polymorphic_allocator<char>{}, stream});
+    cudf::detail::build_join_hash_table(
+      _build, _preprocessed_build, *_hash_table, _has_nulls, _nulls_equal, 0, bitmask_ptr, stream);
+  } else {
+    cudf::detail::build_join_hash_table(_build,
+                                        _preprocessed_build,
+                                        *_hash_table,
+                                        _has_nulls,
+                                        _nulls_equal,
+                                        first_new_row,
+                                        bitmask_ptr,
+                                        stream);
+  }
+  _is_empty = false;
+}
+
 template <typename Hasher>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -451,7 +503,7 @@ std::size_t hash_join<Hasher>::inner_join_size(cudf::table_view const& probe,
                                                 probe,
                                                 _preprocessed_build,
                                                 preprocessed_probe,
-                                                _hash_table,
+                                                *_hash_table,
                                                 cudf::detail::join_kind::INNER_JOIN,
                                                 _has_nulls,
                                                 _nulls_equal,
@@ -477,7 +529,7 @@ std::size_t hash_join<Hasher>::left_join_size(cudf::table_view const& probe,
                                                 probe,
                                                 _preprocessed_build,
                                                 preprocessed_probe,
-                                                _hash_table,
+                                                *_hash_table,
                                                 cudf::detail::join_kind::LEFT_JOIN,
                                                 _has_nulls,
                                                 _nulls_equal,
@@ -504,7 +556,7 @@ std::size_t hash_join<Hasher>::full_join_size(cudf::table_view const& probe,
                                           probe,
                                           _preprocessed_build,
                                           preprocessed_probe,
-                                          _hash_table,
+                                          *_hash_table,
                                           _has_nulls,
                                           _nulls_equal,
                                           stream,
@@ -536,7 +588,7 @@ hash_join<Hasher>::probe_join_indices(cudf::table_view const& probe_table,
                                                           probe_table,
                                                           _preprocessed_build,
                                                           preprocessed_probe,
-                                                          _hash_table,
+                                                          *_hash_table,
                                                           join,
                                                           _has_nulls,
                                                           _nulls_equal,
@@ -578,6 +630,19 @@ hash_join<Hasher>::compute_hash_join(cudf::table_view const& probe,
                "Mismatch in joining column data types",
                cudf::data_type_error);
 
+  // Dictionary columns are joined on their indices without materializing the keys, which is
+  // only valid when the build and probe key sets are identical. Matched key sets always have
+  // the same size, so a size mismatch cheaply catches unmatched dictionaries.
+  for (size_type i = 0; i < probe.num_columns(); ++i) {
+    if (_build.column(i).type().id() == type_id::DICTIONARY32) {
+      auto const build_keys = cudf::dictionary_column_view(_build.column(i)).keys();
+      auto const probe_keys = cudf::dictionary_column_view(probe.column(i)).keys();
+      CUDF_EXPECTS(build_keys.size() == probe_keys.size(),
+                   "Dictionary join columns must have matched key sets; use "
+                   "cudf::dictionary::match_dictionaries before probing");
+    }
+  }
+
   return probe_join_indices(probe, join, output_size, stream, mr);
 }
 }  // namespace detail
@@ -596,11 +661,16 @@ hash_join::hash_join(cudf::table_view const& build,
                      nullable_join has_nulls,
                      null_equality compare_nulls,
                      rmm::cuda_stream_view stream)
-  : _impl{std::make_unique<impl_type const>(
+  : _impl{std::make_unique<impl_type>(
       build, has_nulls == nullable_join::YES, compare_nulls, stream)}
 {
 }
 
+void hash_join::insert(cudf::table_view const& build, rmm::cuda_stream_view stream)
+{
+  _impl->insert(build, stream);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
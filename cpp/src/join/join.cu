@@ -127,6 +127,18 @@ inner_join(table_view const& left,
   return detail::inner_join(left, right, compare_nulls, stream, mr);
 }
 
+stream_future<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+inner_join_async(table_view const& left,
+                 table_view const& right,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return {detail::inner_join(left, right, compare_nulls, stream, mr), stream};
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 left_join(table_view const& left,
@@ -160,6 +160,8 @@ get_trivial_left_join_indices(table_view const& left,
  * @param hash_table Build hash table.
  * @param has_nulls Flag to denote if build or probe tables have nested nulls
  * @param nulls_equal Flag to denote nulls are equal or not.
+ * @param first_row Index of the first row of `build` to insert; rows before it are assumed to
+ *                  already be present in the hash table
  * @param bitmask Bitmask to denote whether a row is valid.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  *
@@ -171,11 +173,12 @@ void build_join_hash_table(
   MultimapType& hash_table,
   bool has_nulls,
   null_equality nulls_equal,
+  size_type first_row,
   [[maybe_unused]] bitmask_type const* bitmask,
   rmm::cuda_stream_view stream)
 {
   CUDF_EXPECTS(0 != build.num_columns(), "Selected build dataset is empty");
-  CUDF_EXPECTS(0 != build.num_rows(), "Build side table has no rows");
+  CUDF_EXPECTS(first_row < build.num_rows(), "Build side table has no rows to insert");
 
   auto const row_hash   = experimental::row::hash::row_hasher{preprocessed_build};
   auto const hash_build = row_hash.device_hasher(nullate::DYNAMIC{has_nulls});
@@ -187,13 +190,14 @@ void build_join_hash_table(
 
   size_type const build_table_num_rows{build.num_rows()};
   if (nulls_equal == cudf::null_equality::EQUAL or (not nullable(build))) {
-    hash_table.insert(iter, iter + build_table_num_rows, stream.value());
+    hash_table.insert(iter + first_row, iter + build_table_num_rows, stream.value());
   } else {
     thrust::counting_iterator<size_type> stencil(0);
     row_is_valid pred{bitmask};
 
     // insert valid rows
-    hash_table.insert_if(iter, iter + build_table_num_rows, stencil, pred, stream.value());
+    hash_table.insert_if(
+      iter + first_row, iter + build_table_num_rows, stencil + first_row, pred, stream.value());
   }
 }
 
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+merge_inner_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Merge join left table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(cudf::have_same_types(left_keys, right_keys),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+
+  if (left_keys.num_rows() == 0 or right_keys.num_rows() == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // Both inputs are sorted ascending with nulls first, so the right-side rows matching each left
+  // row form the contiguous range [lower_bound, upper_bound).
+  std::vector<order> const column_order(left_keys.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(left_keys.num_columns(), null_order::BEFORE);
+
+  auto const match_lower = cudf::detail::lower_bound(right_keys,
+                                                     left_keys,
+                                                     column_order,
+                                                     null_precedence,
+                                                     stream,
+                                                     cudf::get_current_device_resource_ref());
+  auto const match_upper = cudf::detail::upper_bound(right_keys,
+                                                     left_keys,
+                                                     column_order,
+                                                     null_precedence,
+                                                     stream,
+                                                     cudf::get_current_device_resource_ref());
+  auto const d_lower     = match_lower->view().begin<size_type>();
+  auto const d_upper     = match_upper->view().begin<size_type>();
+
+  // Sorted-search comparisons group nulls together, so left rows with null keys match right rows
+  // with null keys. When nulls must not match, drop the matches found for null left rows; a
+  // non-null left row never pairs with a null right row since their keys compare unequal.
+  auto const left_row_bitmask =
+    compare_nulls == null_equality::UNEQUAL and nullable(left_keys)
+      ? cudf::detail::bitmask_and(left_keys, stream, cudf::get_current_device_resource_ref()).first
+      : rmm::device_buffer{};
+  auto const d_bitmask = reinterpret_cast<bitmask_type const*>(left_row_bitmask.data());
+
+  size_type const left_num_rows = left_keys.num_rows();
+
+  // Offsets of each left row's matches within the output, with the total size at the end
+  rmm::device_uvector<int64_t> match_offsets(left_num_rows + 1, stream);
+  auto const count_iter = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<int64_t>([d_lower, d_upper, d_bitmask] __device__(size_type i) {
+      if (d_bitmask != nullptr and not cudf::bit_is_set(d_bitmask, i)) { return int64_t{0}; }
+      return static_cast<int64_t>(d_upper[i] - d_lower[i]);
+    }));
+  match_offsets.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(rmm::exec_policy(stream),
+                         count_iter,
+                         count_iter + left_num_rows,
+                         match_offsets.begin() + 1);
+
+  auto const join_size = match_offsets.back_element(stream);
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+
+  // Expand each left row's match range into (left, right) index pairs
+  thrust::for_each(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    thrust::make_counting_iterator<int64_t>(join_size),
+    [d_offsets     = match_offsets.data(),
+     num_offsets   = left_num_rows + 1,
+     d_lower,
+     d_left_out    = left_indices->data(),
+     d_right_out   = right_indices->data()] __device__(int64_t output_idx) {
+      auto const left_row = static_cast<size_type>(
+        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + num_offsets, output_idx) -
+        d_offsets - 1);
+      d_left_out[output_idx] = left_row;
+      d_right_out[output_idx] =
+        d_lower[left_row] + static_cast<size_type>(output_idx - d_offsets[left_row]);
+    });
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+merge_inner_join(table_view const& left_keys,
+                 table_view const& right_keys,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_inner_join(left_keys, right_keys, compare_nulls, stream, mr);
+}
+
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include "join_common_utils.cuh"
 #include "join_common_utils.hpp"
+#include "mixed_join_common_utils.cuh"
 #include "mixed_join_kernel.hpp"
 #include "mixed_join_size_kernel.hpp"
 
@@ -36,14 +37,62 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cooperative_groups.h>
+#include <thrust/distance.h>
 #include <thrust/fill.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/remove.h>
 #include <thrust/scan.h>
+#include <thrust/tuple.h>
+#include <thrust/uninitialized_fill.h>
 
+#include <cstdlib>
 #include <optional>
 #include <utility>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+// Opt-in to the single-pass mixed join, which sizes the output from key-only match counts so the
+// AST expression is evaluated once per candidate pair instead of twice
+bool is_single_pass_mixed_join_enabled()
+{
+  static bool const enabled = []() {
+    auto const* env = std::getenv("LIBCUDF_MIXED_JOIN_SINGLE_PASS");
+    return env != nullptr and std::atoi(env) != 0;
+  }();
+  return enabled;
+}
+
+// Counts the hash-table matches of each outer row on key equality alone, giving an upper bound on
+// the per-row mixed join output without evaluating the AST expression
+CUDF_KERNEL void __launch_bounds__(DEFAULT_JOIN_BLOCK_SIZE)
+  compute_mixed_join_key_match_counts(row_hash const hash_probe,
+                                      row_equality const equality_probe,
+                                      cudf::detail::mixed_multimap_type::device_view hash_table_view,
+                                      cudf::size_type outer_num_rows,
+                                      cudf::device_span<cudf::size_type> matches_per_row)
+{
+  namespace cg = cooperative_groups;
+
+  auto const start_idx = cudf::detail::grid_1d::global_thread_id();
+  auto const stride    = cudf::detail::grid_1d::grid_stride();
+
+  cg::thread_block_tile<1> this_thread = cg::this_thread();
+  auto const empty_key_sentinel        = hash_table_view.get_empty_key_sentinel();
+  make_pair_function pair_func{hash_probe, empty_key_sentinel};
+  pair_equality equality{equality_probe};
+
+  for (auto outer_row_index = start_idx; outer_row_index < outer_num_rows;
+       outer_row_index += stride) {
+    matches_per_row[outer_row_index] =
+      hash_table_view.pair_count(this_thread, pair_func(outer_row_index), equality);
+  }
+}
+
+}  // namespace
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -148,6 +197,7 @@ mixed_join(
                         hash_table,
                         has_nulls,
                         compare_nulls,
+                        0,
                         static_cast<bitmask_type const*>(row_bitmask.data()),
                         stream);
   auto hash_table_view = hash_table.get_device_view();
@@ -164,6 +214,9 @@ mixed_join(
 
   // If the join size data was not provided as an input, compute it here.
   std::size_t join_size;
+  // Whether the output is sized from key-only match counts (an upper bound) so that the join
+  // kernel provides the only expression evaluation and unmatched slots are compacted afterwards
+  bool single_pass = false;
   // Using an optional because we only need to allocate a new vector if one was
   // not passed as input, and rmm::device_uvector is not default constructible
   std::optional<rmm::device_uvector<size_type>> matches_per_row{};
@@ -189,7 +242,21 @@ mixed_join(
       matches_per_row->begin(), static_cast<std::size_t>(outer_num_rows)};
     matches_per_row_span = cudf::device_span<size_type const>{
       matches_per_row->begin(), static_cast<std::size_t>(outer_num_rows)};
-    if (has_nulls) {
+    if (is_single_pass_mixed_join_enabled() and kernel_join_type == join_kind::INNER_JOIN) {
+      single_pass = true;
+      compute_mixed_join_key_match_counts<<<config.num_blocks,
+                                            config.num_threads_per_block,
+                                            0,
+                                            stream.value()>>>(hash_probe,
+                                                              equality_probe,
+                                                              hash_table_view,
+                                                              outer_num_rows,
+                                                              mutable_matches_per_row_span);
+      join_size = thrust::reduce(rmm::exec_policy(stream),
+                                 matches_per_row->begin(),
+                                 matches_per_row->end(),
+                                 std::size_t{0});
+    } else if (has_nulls) {
       join_size = launch_compute_mixed_join_output_size<true>(*left_conditional_view,
                                                               *right_conditional_view,
                                                               *probe_view,
@@ -246,6 +313,19 @@ mixed_join(
   auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
   auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
 
+  if (single_pass) {
+    // Slots belonging to candidate pairs that fail the expression stay at the sentinel and are
+    // compacted away after the join kernel
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               left_indices->begin(),
+                               left_indices->end(),
+                               cudf::detail::JoinNoneValue);
+    thrust::uninitialized_fill(rmm::exec_policy(stream),
+                               right_indices->begin(),
+                               right_indices->end(),
+                               cudf::detail::JoinNoneValue);
+  }
+
   auto const& join_output_l = left_indices->data();
   auto const& join_output_r = right_indices->data();
 
@@ -285,6 +365,23 @@ mixed_join(
                              stream);
   }
 
+  if (single_pass) {
+    // Inner join indices are never the sentinel, so any remaining sentinel slot is a candidate
+    // pair that failed the expression
+    auto const paired =
+      thrust::make_zip_iterator(thrust::make_tuple(left_indices->begin(), right_indices->begin()));
+    auto const paired_end =
+      thrust::remove_if(rmm::exec_policy(stream),
+                        paired,
+                        paired + join_size,
+                        [] __device__(thrust::tuple<size_type, size_type> const& indices) {
+                          return thrust::get<0>(indices) == cudf::detail::JoinNoneValue;
+                        });
+    auto const actual_size = static_cast<std::size_t>(thrust::distance(paired, paired_end));
+    left_indices->resize(actual_size, stream);
+    right_indices->resize(actual_size, stream);
+  }
+
   auto join_indices = std::pair(std::move(left_indices), std::move(right_indices));
 
   // For full joins, get the indices in the right table that were not joined to
@@ -415,6 +512,7 @@ compute_mixed_join_output_size(table_view const& left_equality,
                         hash_table,
                         has_nulls,
                         compare_nulls,
+                        0,
                         static_cast<bitmask_type const*>(row_bitmask.data()),
                         stream);
   auto hash_table_view = hash_table.get_device_view();
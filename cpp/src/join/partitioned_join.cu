@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/gather.h>
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A hash-partitioned input staged in pinned host memory.
+ *
+ * Each partition is stored as the packed representation produced by `cudf::detail::pack`, with the
+ * device buffer copied to pinned host memory so that no device memory is held between the
+ * partitioning and join phases.
+ */
+struct spilled_partitions {
+  std::vector<std::unique_ptr<std::vector<uint8_t>>> metadata;
+  std::vector<cudf::detail::host_vector<uint8_t>> data;
+};
+
+/**
+ * @brief Hash-partitions `input` on all of its columns and spills each partition to pinned host
+ * memory.
+ *
+ * A row-index column is appended to the table before partitioning so that join results computed on
+ * a partition can be mapped back to rows of `input`.
+ */
+spilled_partitions spill_hash_partitions(table_view const& input,
+                                         size_type num_partitions,
+                                         rmm::cuda_stream_view stream)
+{
+  auto const row_index = cudf::detail::sequence(input.num_rows(),
+                                                numeric_scalar<size_type>(0, true, stream),
+                                                stream,
+                                                cudf::get_current_device_resource_ref());
+  std::vector<column_view> augmented_cols(input.begin(), input.end());
+  augmented_cols.push_back(row_index->view());
+
+  std::vector<size_type> columns_to_hash(input.num_columns());
+  std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+
+  // Both inputs are partitioned with the same hash function and seed, so rows with equal keys land
+  // in the same partition index on both sides
+  auto const [partitioned, offsets] = cudf::hash_partition(table_view{augmented_cols},
+                                                           columns_to_hash,
+                                                           num_partitions,
+                                                           hash_id::HASH_MURMUR3,
+                                                           DEFAULT_HASH_SEED,
+                                                           stream,
+                                                           cudf::get_current_device_resource_ref());
+
+  spilled_partitions spilled;
+  spilled.metadata.reserve(num_partitions);
+  spilled.data.reserve(num_partitions);
+
+  // Pack and copy out one partition at a time so that at most one packed partition is resident on
+  // the device alongside the partitioned table
+  for (size_type part_idx = 0; part_idx < num_partitions; ++part_idx) {
+    auto const part_begin = offsets[part_idx];
+    auto const part_end =
+      part_idx + 1 < num_partitions ? offsets[part_idx + 1] : partitioned->num_rows();
+    auto const part_view =
+      cudf::slice(partitioned->view(), {part_begin, part_end}, stream).front();
+
+    auto packed = cudf::detail::pack(part_view, stream, cudf::get_current_device_resource_ref());
+    auto host_data =
+      cudf::detail::make_pinned_vector_async<uint8_t>(packed.gpu_data->size(), stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(host_data.data(),
+                                  packed.gpu_data->data(),
+                                  packed.gpu_data->size(),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    // The device-side packed copy is freed on scope exit; wait for the copy out first
+    stream.synchronize();
+
+    spilled.metadata.push_back(std::move(packed.metadata));
+    spilled.data.push_back(std::move(host_data));
+  }
+  return spilled;
+}
+
+/**
+ * @brief Brings one spilled partition back to the device.
+ *
+ * @return The unpacked table view, valid as long as `device_data` is alive
+ */
+table_view unspill_partition(spilled_partitions const& spilled,
+                             size_type part_idx,
+                             rmm::device_buffer& device_data,
+                             rmm::cuda_stream_view stream)
+{
+  auto const& host_data = spilled.data[part_idx];
+  device_data           = rmm::device_buffer{
+    host_data.data(), host_data.size(), stream, cudf::get_current_device_resource_ref()};
+  return cudf::unpack(spilled.metadata[part_idx]->data(),
+                      static_cast<uint8_t const*>(device_data.data()));
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_keys,
+                       table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Partitioned join left table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(cudf::have_same_types(left_keys, right_keys),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+
+  if (left_keys.num_rows() == 0 or right_keys.num_rows() == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  auto const num_key_columns = left_keys.num_columns();
+  std::vector<size_type> key_column_indices(num_key_columns);
+  std::iota(key_column_indices.begin(), key_column_indices.end(), 0);
+
+  auto const left_spilled  = spill_hash_partitions(left_keys, num_partitions, stream);
+  auto const right_spilled = spill_hash_partitions(right_keys, num_partitions, stream);
+
+  // Join one partition pair at a time; the hash table and probe scratch memory are bounded by the
+  // largest partition rather than the full build side
+  std::vector<rmm::device_uvector<size_type>> left_results;
+  std::vector<rmm::device_uvector<size_type>> right_results;
+  std::size_t join_size = 0;
+  for (size_type part_idx = 0; part_idx < num_partitions; ++part_idx) {
+    rmm::device_buffer left_data;
+    rmm::device_buffer right_data;
+    auto const left_part  = unspill_partition(left_spilled, part_idx, left_data, stream);
+    auto const right_part = unspill_partition(right_spilled, part_idx, right_data, stream);
+    if (left_part.num_rows() == 0 or right_part.num_rows() == 0) { continue; }
+
+    auto const [local_left, local_right] = cudf::inner_join(left_part.select(key_column_indices),
+                                                            right_part.select(key_column_indices),
+                                                            compare_nulls,
+                                                            stream,
+                                                            cudf::get_current_device_resource_ref());
+
+    // Map the partition-local indices back through the appended row-index column
+    auto const num_matches = local_left->size();
+    rmm::device_uvector<size_type> global_left(
+      num_matches, stream, cudf::get_current_device_resource_ref());
+    rmm::device_uvector<size_type> global_right(
+      num_matches, stream, cudf::get_current_device_resource_ref());
+    thrust::gather(rmm::exec_policy(stream),
+                   local_left->begin(),
+                   local_left->end(),
+                   left_part.column(num_key_columns).begin<size_type>(),
+                   global_left.begin());
+    thrust::gather(rmm::exec_policy(stream),
+                   local_right->begin(),
+                   local_right->end(),
+                   right_part.column(num_key_columns).begin<size_type>(),
+                   global_right.begin());
+    stream.synchronize();  // the unpacked partition views die at the end of this iteration
+
+    join_size += num_matches;
+    left_results.push_back(std::move(global_left));
+    right_results.push_back(std::move(global_right));
+  }
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+  std::size_t output_offset = 0;
+  for (std::size_t result_idx = 0; result_idx < left_results.size(); ++result_idx) {
+    auto const num_matches = left_results[result_idx].size();
+    CUDF_CUDA_TRY(cudaMemcpyAsync(left_indices->data() + output_offset,
+                                  left_results[result_idx].data(),
+                                  num_matches * sizeof(size_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    CUDF_CUDA_TRY(cudaMemcpyAsync(right_indices->data() + output_offset,
+                                  right_results[result_idx].data(),
+                                  num_matches * sizeof(size_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    output_offset += num_matches;
+  }
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_keys,
+                       table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_inner_join(
+    left_keys, right_keys, num_partitions, compare_nulls, stream, mr);
+}
+
+}  // namespace cudf
@@ -22,6 +22,7 @@
 #include <cudf/detail/search.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/join.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -32,15 +33,156 @@
 
 #include <thrust/copy.h>
 #include <thrust/distance.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
 
+#include <cstdlib>
 #include <memory>
 
 namespace cudf {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Checks if the bloom-filter pre-pass for semi/anti joins has been enabled via the
+ * environment variable `LIBCUDF_SEMI_JOIN_BLOOM_FILTER`.
+ *
+ * @return true if the pre-pass has been enabled
+ */
+[[nodiscard]] bool is_bloom_filter_prepass_enabled()
+{
+  static bool const enabled = []() { return std::getenv("LIBCUDF_SEMI_JOIN_BLOOM_FILTER"); }();
+  return enabled;
+}
+
+/// Number of bloom filter bits allotted per build (right) table row
+std::size_t constexpr bloom_bits_per_build_row = 8;
+
+/**
+ * @brief Computes the second bloom filter bit position for a given row hash.
+ *
+ * The first position is the row hash itself; re-mixing the hash with different constants yields
+ * an (approximately) independent second probe.
+ */
+__device__ constexpr hash_value_type remix_hash(hash_value_type h)
+{
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  return h;
+}
+
+/**
+ * @brief Flags each left table row that may have an equal row in the right table.
+ *
+ * Builds a compact bloom filter over the right table row hashes and tests every left row against
+ * it with two cache-resident bit lookups. Rows rejected by the filter are guaranteed to have no
+ * match; rows that pass are verified with an exact `cudf::detail::contains` over the surviving
+ * subset only.
+ *
+ * @param left_keys Table of columns used as the probe side
+ * @param right_keys Table of columns used as the build side
+ * @param compare_nulls Whether or not null values join to each other
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return A device vector of booleans, one per left row, true if the row has a match
+ */
+rmm::device_uvector<bool> bloom_filtered_contains(cudf::table_view const& left_keys,
+                                                  cudf::table_view const& right_keys,
+                                                  null_equality compare_nulls,
+                                                  rmm::cuda_stream_view stream)
+{
+  auto const has_any_nulls = has_nested_nulls(left_keys) or has_nested_nulls(right_keys);
+
+  auto const preprocessed_right =
+    cudf::experimental::row::equality::preprocessed_table::create(right_keys, stream);
+  auto const preprocessed_left =
+    cudf::experimental::row::equality::preprocessed_table::create(left_keys, stream);
+
+  auto const right_hasher = cudf::experimental::row::hash::row_hasher{preprocessed_right};
+  auto const d_right_hasher = right_hasher.device_hasher(nullate::DYNAMIC{has_any_nulls});
+  auto const left_hasher    = cudf::experimental::row::hash::row_hasher{preprocessed_left};
+  auto const d_left_hasher  = left_hasher.device_hasher(nullate::DYNAMIC{has_any_nulls});
+
+  auto const left_num_rows  = left_keys.num_rows();
+  auto const right_num_rows = right_keys.num_rows();
+
+  // Round the filter up to a power-of-two number of bits so that bit positions can be computed
+  // with a mask instead of a modulo
+  std::size_t num_bits = std::size_t{1} << 10;
+  while (num_bits < static_cast<std::size_t>(right_num_rows) * bloom_bits_per_build_row) {
+    num_bits <<= 1;
+  }
+  auto const bit_mask = static_cast<hash_value_type>(num_bits - 1);
+
+  auto filter = rmm::device_uvector<uint32_t>(num_bits / (sizeof(uint32_t) * CHAR_BIT),
+                                              stream,
+                                              cudf::get_current_device_resource_ref());
+  thrust::uninitialized_fill(rmm::exec_policy_nosync(stream), filter.begin(), filter.end(), 0u);
+
+  thrust::for_each(rmm::exec_policy_nosync(stream),
+                   thrust::counting_iterator<size_type>(0),
+                   thrust::counting_iterator<size_type>(right_num_rows),
+                   [d_right_hasher, d_filter = filter.data(), bit_mask] __device__(size_type i) {
+                     auto const hash = d_right_hasher(i);
+                     for (auto const bit : {hash & bit_mask, remix_hash(hash) & bit_mask}) {
+                       atomicOr(d_filter + (bit / 32u), uint32_t{1} << (bit % 32u));
+                     }
+                   });
+
+  // Gather the left rows that pass the filter; only those need the exact containment check
+  auto candidates = rmm::device_uvector<size_type>(
+    left_num_rows, stream, cudf::get_current_device_resource_ref());
+  auto const candidates_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(left_num_rows),
+    candidates.begin(),
+    [d_left_hasher, d_filter = filter.data(), bit_mask] __device__(size_type i) {
+      auto const hash = d_left_hasher(i);
+      for (auto const bit : {hash & bit_mask, remix_hash(hash) & bit_mask}) {
+        if (not(d_filter[bit / 32u] & (uint32_t{1} << (bit % 32u)))) { return false; }
+      }
+      return true;
+    });
+  candidates.resize(thrust::distance(candidates.begin(), candidates_end), stream);
+
+  auto flagged =
+    rmm::device_uvector<bool>(left_num_rows, stream, cudf::get_current_device_resource_ref());
+  thrust::uninitialized_fill(rmm::exec_policy_nosync(stream), flagged.begin(), flagged.end(), false);
+  if (candidates.is_empty()) { return flagged; }
+
+  auto const candidates_view = cudf::column_view{data_type{type_to_id<size_type>()},
+                                                 static_cast<size_type>(candidates.size()),
+                                                 candidates.data(),
+                                                 nullptr,
+                                                 0};
+  auto const candidate_rows  = cudf::detail::gather(left_keys,
+                                                   candidates_view,
+                                                   out_of_bounds_policy::DONT_CHECK,
+                                                   cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                   stream,
+                                                   cudf::get_current_device_resource_ref());
+  auto const candidate_flagged = cudf::detail::contains(right_keys,
+                                                        candidate_rows->view(),
+                                                        compare_nulls,
+                                                        nan_equality::ALL_EQUAL,
+                                                        stream,
+                                                        cudf::get_current_device_resource_ref());
+  thrust::scatter(rmm::exec_policy_nosync(stream),
+                  candidate_flagged.begin(),
+                  candidate_flagged.end(),
+                  candidates.begin(),
+                  flagged.begin());
+  return flagged;
+}
+
+}  // namespace
+
 std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
   join_kind const kind,
   cudf::table_view const& left_keys,
@@ -66,12 +208,14 @@ std::unique_ptr<rmm::device_uvector<cudf::size_type>> left_semi_anti_join(
   // Previously, the gather map was generated directly without this array but by calling to
   // `map.contains` inside the `thrust::copy_if` kernel. However, that led to increasing register
   // usage and reducing performance, as reported here: https://github.com/rapidsai/cudf/pull/10511.
-  auto const flagged = cudf::detail::contains(right_keys,
-                                              left_keys,
-                                              compare_nulls,
-                                              nan_equality::ALL_EQUAL,
-                                              stream,
-                                              cudf::get_current_device_resource_ref());
+  auto const flagged = is_bloom_filter_prepass_enabled()
+                         ? bloom_filtered_contains(left_keys, right_keys, compare_nulls, stream)
+                         : cudf::detail::contains(right_keys,
+                                                  left_keys,
+                                                  compare_nulls,
+                                                  nan_equality::ALL_EQUAL,
+                                                  stream,
+                                                  cudf::get_current_device_resource_ref());
 
   auto const left_num_rows = left_keys.num_rows();
   auto gather_map =
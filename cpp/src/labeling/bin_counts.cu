@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/labeling/label_bins.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/atomic>
+#include <thrust/fill.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type block_size{256};
+
+// Largest bin count accumulated in shared memory; larger edge sets fall through to plain global
+// atomics
+constexpr size_type max_shared_bins{4096};
+
+/**
+ * @brief Accumulates bin labels into per-block shared-memory counters, then spills each block's
+ * partial counts to the global counters with one atomic per non-empty bin
+ */
+CUDF_KERNEL void bin_counts_shared_kernel(column_device_view labels,
+                                          size_type* counts,
+                                          size_type num_bins)
+{
+  extern __shared__ size_type local_counts[];
+  for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+    local_counts[bin] = 0;
+  }
+  __syncthreads();
+
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto i = cudf::detail::grid_1d::global_thread_id(); i < labels.size(); i += stride) {
+    if (labels.is_valid(i)) {
+      cuda::atomic_ref<size_type, cuda::thread_scope_block> bin_count{
+        local_counts[labels.element<size_type>(i)]};
+      bin_count.fetch_add(1, cuda::memory_order_relaxed);
+    }
+  }
+  __syncthreads();
+
+  for (size_type bin = threadIdx.x; bin < num_bins; bin += blockDim.x) {
+    if (local_counts[bin] > 0) {
+      cuda::atomic_ref<size_type, cuda::thread_scope_device> bin_count{counts[bin]};
+      bin_count.fetch_add(local_counts[bin], cuda::memory_order_relaxed);
+    }
+  }
+}
+
+/**
+ * @brief Accumulates bin labels directly into the global counters
+ */
+CUDF_KERNEL void bin_counts_global_kernel(column_device_view labels, size_type* counts)
+{
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto i = cudf::detail::grid_1d::global_thread_id(); i < labels.size(); i += stride) {
+    if (labels.is_valid(i)) {
+      cuda::atomic_ref<size_type, cuda::thread_scope_device> bin_count{
+        counts[labels.element<size_type>(i)]};
+      bin_count.fetch_add(1, cuda::memory_order_relaxed);
+    }
+  }
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   column_view const& left_edges,
+                                   inclusive left_inclusive,
+                                   column_view const& right_edges,
+                                   inclusive right_inclusive,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto const num_bins = left_edges.size();
+  auto counts         = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_bins, mask_state::UNALLOCATED, stream, mr);
+  if (num_bins == 0) { return counts; }
+
+  auto counts_view = counts->mutable_view();
+  thrust::fill(rmm::exec_policy(stream),
+               counts_view.begin<size_type>(),
+               counts_view.end<size_type>(),
+               size_type{0});
+  if (input.size() == input.null_count()) { return counts; }
+
+  // The labels are only needed to feed the counters; validation of the inputs happens here too
+  auto const labels   = label_bins(input,
+                                 left_edges,
+                                 left_inclusive,
+                                 right_edges,
+                                 right_inclusive,
+                                 stream,
+                                 cudf::get_current_device_resource_ref());
+  auto const d_labels = column_device_view::create(labels->view(), stream);
+
+  auto const grid = cudf::detail::grid_1d{input.size(), block_size};
+  if (num_bins <= max_shared_bins) {
+    auto const shared_size = num_bins * sizeof(size_type);
+    bin_counts_shared_kernel<<<grid.num_blocks,
+                               grid.num_threads_per_block,
+                               shared_size,
+                               stream.value()>>>(
+      *d_labels, counts_view.begin<size_type>(), num_bins);
+  } else {
+    bin_counts_global_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *d_labels, counts_view.begin<size_type>());
+  }
+  CUDF_CHECK_CUDA(stream.value());
+
+  return counts;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> bin_counts(column_view const& input,
+                                   column_view const& left_edges,
+                                   inclusive left_inclusive,
+                                   column_view const& right_edges,
+                                   inclusive right_inclusive,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bin_counts(
+    input, left_edges, left_inclusive, right_edges, right_inclusive, stream, mr);
+}
+
+}  // namespace cudf
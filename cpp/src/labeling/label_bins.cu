@@ -20,6 +20,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/label_bins.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/labeling/label_bins.hpp>
 #include <cudf/types.hpp>
@@ -41,6 +42,7 @@
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/pair.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 
 #include <limits>
@@ -55,6 +57,8 @@ namespace {
 // could make this an error in Python, but that is such a crazy edge case...
 constexpr size_type NULL_VALUE{std::numeric_limits<size_type>::max()};
 
+constexpr size_type block_size{256};
+
 /*
  * Functor for finding bins using thrust::transform.
  *
@@ -82,8 +86,18 @@ struct bin_finder {
     // Immediately return sentinel for null inputs.
     if (!input_value.second) return NULL_VALUE;
 
-    T value    = input_value.first;
-    auto bound = thrust::lower_bound(thrust::seq, m_left_begin, m_left_end, value, m_left_comp);
+    return find(input_value.first, m_left_begin, m_left_end);
+  }
+
+  /*
+   * Finds the bin of a value whose left-edge lower bound is known to lie in
+   * [search_begin, search_end]. Callers that cannot narrow the range pass the full edge range.
+   */
+  __device__ size_type find(T value,
+                            RandomAccessIterator search_begin,
+                            RandomAccessIterator search_end) const
+  {
+    auto bound = thrust::lower_bound(thrust::seq, search_begin, search_end, value, m_left_comp);
 
     // Exit early and return sentinel for values that lie below the interval.
     if (bound == m_left_begin) { return NULL_VALUE; }
@@ -107,6 +121,65 @@ struct filter_null_sentinel {
   __device__ bool operator()(size_type i) { return i != NULL_VALUE; }
 };
 
+/*
+ * Kernel for binning monotonically non-decreasing input.
+ *
+ * Consecutive elements of sorted input land in the same or nearby bins, so the first lane of each
+ * warp narrows the edge range for all of its lanes with two binary searches (seeded with the
+ * warp's first and last values) and the remaining lanes only search within that span. Sorted
+ * input binned into many buckets is thereby labeled with effectively O(1) work per element
+ * instead of O(log bins).
+ */
+template <typename T,
+          typename RandomAccessIterator,
+          typename LeftComparator,
+          typename RightComparator>
+CUDF_KERNEL void sorted_bin_finder_kernel(
+  T const* input,
+  size_type num_rows,
+  bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator> finder,
+  size_type* output)
+{
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  auto const lane   = threadIdx.x % cudf::detail::warp_size;
+  auto warp_first   = cudf::detail::grid_1d::global_thread_id() - lane;
+
+  // The whole warp iterates together so that every lane participates in the shuffles
+  while (warp_first < num_rows) {
+    auto const warp_last =
+      warp_first + cudf::detail::warp_size - 1 < num_rows ? warp_first + cudf::detail::warp_size - 1
+                                                          : num_rows - 1;
+    size_type lo_offset{};
+    size_type hi_offset{};
+    if (lane == 0) {
+      lo_offset = static_cast<size_type>(thrust::distance(
+        finder.m_left_begin,
+        thrust::lower_bound(thrust::seq,
+                            finder.m_left_begin,
+                            finder.m_left_end,
+                            input[warp_first],
+                            finder.m_left_comp)));
+      hi_offset = static_cast<size_type>(thrust::distance(
+        finder.m_left_begin,
+        thrust::lower_bound(thrust::seq,
+                            finder.m_left_begin + lo_offset,
+                            finder.m_left_end,
+                            input[warp_last],
+                            finder.m_left_comp)));
+    }
+    lo_offset = __shfl_sync(0xffff'ffffu, lo_offset, 0);
+    hi_offset = __shfl_sync(0xffff'ffffu, hi_offset, 0);
+
+    auto const idx = warp_first + lane;
+    if (idx < num_rows) {
+      // The lower bound of every lane's value lies within [lo_offset, hi_offset]
+      output[idx] = finder.find(
+        input[idx], finder.m_left_begin + lo_offset, finder.m_left_begin + hi_offset);
+    }
+    warp_first += stride;
+  }
+}
+
 // Bin the input by the edges in left_edges and right_edges.
 template <typename T, typename LeftComparator, typename RightComparator>
 std::unique_ptr<column> label_bins(column_view const& input,
@@ -135,20 +208,38 @@ std::unique_ptr<column> label_bins(column_view const& input,
 
   using RandomAccessIterator = decltype(left_edges_device_view->begin<T>());
 
+  auto const finder = bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
+    left_begin, left_end, right_begin);
+
+  // Monotonically non-decreasing input (e.g. timestamps) is binned with the warp-seeded kernel,
+  // which narrows the per-element search to the span covered by each warp. Detecting sortedness
+  // costs a single O(n) pass, which the narrowed searches more than recoup.
+  if constexpr (cudf::is_rep_layout_compatible<T>()) {
+    if (not input.has_nulls() and
+        thrust::is_sorted(rmm::exec_policy(stream), input.begin<T>(), input.end<T>())) {
+      auto grid = cudf::detail::grid_1d{input.size(), block_size};
+      sorted_bin_finder_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+        input.begin<T>(), input.size(), finder, output_begin);
+      CUDF_CHECK_CUDA(stream.value());
+
+      auto mask_and_count = valid_if(output_begin, output_end, filter_null_sentinel(), stream, mr);
+      output->set_null_mask(std::move(mask_and_count.first), mask_and_count.second);
+      return output;
+    }
+  }
+
   if (input.has_nulls()) {
     thrust::transform(rmm::exec_policy(stream),
                       input_device_view->pair_begin<T, true>(),
                       input_device_view->pair_end<T, true>(),
                       output_begin,
-                      bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
-                        left_begin, left_end, right_begin));
+                      finder);
   } else {
     thrust::transform(rmm::exec_policy(stream),
                       input_device_view->pair_begin<T, false>(),
                       input_device_view->pair_end<T, false>(),
                       output_begin,
-                      bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
-                        left_begin, left_end, right_begin));
+                      finder);
   }
 
   auto mask_and_count = valid_if(output_begin, output_end, filter_null_sentinel(), stream, mr);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -38,6 +38,7 @@
 #include <cuda/functional>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/reverse_iterator.h>
 #include <thrust/logical.h>
@@ -46,6 +47,7 @@
 #include <thrust/transform.h>
 
 #include <type_traits>
+#include <vector>
 
 namespace cudf::lists {
 namespace {
@@ -116,31 +118,38 @@ __device__ auto element_index_pair_iter(size_type const size)
  * @brief Functor to perform searching for index of a key element in a given list, specialized
  * for nested types.
  */
-template <typename KeyValidityIter, typename EqComparator>
+template <typename KeyIndexIter, typename KeyValidityIter, typename EqComparator>
 struct search_list_fn {
   duplicate_find_option const find_option;
+  KeyIndexIter const key_index_iter;
   KeyValidityIter const key_validity_iter;
   EqComparator const d_comp;
 
   search_list_fn(duplicate_find_option const find_option,
+                 KeyIndexIter const key_index_iter,
                  KeyValidityIter const key_validity_iter,
                  EqComparator const& d_comp)
-    : find_option(find_option), key_validity_iter(key_validity_iter), d_comp(d_comp)
+    : find_option(find_option),
+      key_index_iter(key_index_iter),
+      key_validity_iter(key_validity_iter),
+      d_comp(d_comp)
   {
   }
 
   __device__ size_type operator()(list_device_view const list) const
   {
+    auto const key_idx = key_index_iter[list.row_index()];
     // A null list or null key will result in a null output row.
-    if (list.is_null() || !key_validity_iter[list.row_index()]) { return NULL_SENTINEL; }
+    if (list.is_null() || !key_validity_iter[key_idx]) { return NULL_SENTINEL; }
 
-    return find_option == duplicate_find_option::FIND_FIRST ? search_list_op<true>(list)
-                                                            : search_list_op<false>(list);
+    return find_option == duplicate_find_option::FIND_FIRST ? search_list_op<true>(list, key_idx)
+                                                            : search_list_op<false>(list, key_idx);
   }
 
  private:
   template <bool forward>
-  __device__ inline size_type search_list_op(list_device_view const list) const
+  __device__ inline size_type search_list_op(list_device_view const list,
+                                             size_type const key_idx) const
   {
     using cudf::experimental::row::lhs_index_type;
     using cudf::experimental::row::rhs_index_type;
@@ -149,7 +158,7 @@ struct search_list_fn {
     auto const found_iter =
       thrust::find_if(thrust::seq, begin, end, [=] __device__(auto const idx) {
         return !list.is_null(idx) && d_comp(static_cast<lhs_index_type>(list.element_offset(idx)),
-                                            static_cast<rhs_index_type>(list.row_index()));
+                                            static_cast<rhs_index_type>(key_idx));
       });
     // If the key is found, return its found position in the list from `found_iter`.
     return found_iter == end ? NOT_FOUND_SENTINEL : *found_iter;
@@ -160,9 +169,10 @@ struct search_list_fn {
  * @brief Function to search for index of key element(s) in the corresponding rows of a lists
  * column, specialized for nested types.
  */
-template <typename InputIterator, typename OutputIterator, typename DeviceComp>
+template <typename InputIterator, typename KeyIndexIter, typename OutputIterator, typename DeviceComp>
 void index_of(InputIterator input_it,
               size_type num_rows,
+              KeyIndexIter key_index_iter,
               OutputIterator output_it,
               column_view const& child,
               column_view const& search_keys,
@@ -176,16 +186,20 @@ void index_of(InputIterator input_it,
                     input_it,
                     input_it + num_rows,
                     output_it,
-                    search_list_fn{find_option, key_validity_iter, d_comp});
+                    search_list_fn{find_option, key_index_iter, key_validity_iter, d_comp});
 }
 
 /**
  * @brief Dispatch function to search for index of key element(s) in the corresponding rows of a
  * lists column.
+ *
+ * If `broadcast_key` is true, `search_keys` holds a single element that is searched for in every
+ * list row (the scalar-key case); otherwise it holds one key per list row.
  */
 std::unique_ptr<column> dispatch_index_of(lists_column_view const& lists,
                                           column_view const& search_keys,
                                           duplicate_find_option find_option,
+                                          bool broadcast_key,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr)
 {
@@ -222,12 +236,22 @@ std::unique_ptr<column> dispatch_index_of(lists_column_view const& lists,
   auto const has_nulls   = has_nested_nulls(child_tview) || has_nested_nulls(keys_tview);
   auto const comparator =
     cudf::experimental::row::equality::two_table_comparator(child_tview, keys_tview, stream);
-  if (cudf::is_nested(search_keys.type())) {
-    auto const d_comp = comparator.equal_to<true>(nullate::DYNAMIC{has_nulls});
-    index_of(input_it, num_rows, output_it, child, search_keys, find_option, d_comp, stream);
+  auto const run_search = [&](auto const key_index_iter) {
+    if (cudf::is_nested(search_keys.type())) {
+      auto const d_comp = comparator.equal_to<true>(nullate::DYNAMIC{has_nulls});
+      index_of(
+        input_it, num_rows, key_index_iter, output_it, child, search_keys, find_option, d_comp, stream);
+    } else {
+      auto const d_comp = comparator.equal_to<false>(nullate::DYNAMIC{has_nulls});
+      index_of(
+        input_it, num_rows, key_index_iter, output_it, child, search_keys, find_option, d_comp, stream);
+    }
+  };
+  // A broadcast (scalar) key is stored as a single-element keys column; every row maps to it
+  if (broadcast_key) {
+    run_search(thrust::make_constant_iterator(size_type{0}));
   } else {
-    auto const d_comp = comparator.equal_to<false>(nullate::DYNAMIC{has_nulls});
-    index_of(input_it, num_rows, output_it, child, search_keys, find_option, d_comp, stream);
+    run_search(thrust::make_counting_iterator(size_type{0}));
   }
 
   if (search_keys_have_nulls || lists.has_nulls()) {
@@ -242,6 +266,127 @@ std::unique_ptr<column> dispatch_index_of(lists_column_view const& lists,
   return out_positions;
 }
 
+/**
+ * @brief Functor to binary-search for a key element within a list row whose elements are
+ * sorted ascending with nulls last.
+ */
+template <typename KeyIndexIter, typename KeyValidityIter, typename LessComp, typename EqComp>
+struct sorted_search_list_fn {
+  KeyIndexIter const key_index_iter;
+  KeyValidityIter const key_validity_iter;
+  LessComp const d_less;
+  EqComp const d_eq;
+
+  __device__ size_type operator()(list_device_view const list) const
+  {
+    using cudf::experimental::row::lhs_index_type;
+    using cudf::experimental::row::rhs_index_type;
+
+    auto const key_idx = key_index_iter[list.row_index()];
+    // A null list or null key will result in a null output row.
+    if (list.is_null() || !key_validity_iter[key_idx]) { return NULL_SENTINEL; }
+
+    auto const key = static_cast<rhs_index_type>(key_idx);
+    // lower_bound over the list's elements; the comparator orders null elements last,
+    // matching the required sort order of the list rows
+    size_type lo = 0;
+    size_type hi = list.size();
+    while (lo < hi) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (d_less(static_cast<lhs_index_type>(list.element_offset(mid)), key)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return (lo < list.size() && !list.is_null(lo) &&
+            d_eq(static_cast<lhs_index_type>(list.element_offset(lo)), key))
+             ? lo
+             : NOT_FOUND_SENTINEL;
+  }
+};
+
+/**
+ * @brief Search for key element(s) in the corresponding pre-sorted rows of a lists column by
+ * binary search, producing the same key-positions output as `dispatch_index_of`.
+ */
+std::unique_ptr<column> dispatch_sorted_index_of(lists_column_view const& lists,
+                                                 column_view const& search_keys,
+                                                 bool broadcast_key,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(!cudf::is_nested(search_keys.type()),
+               "Nested types are not supported in `contains_sorted`.");
+  CUDF_EXPECTS(cudf::type_dispatcher(search_keys.type(), is_supported_type_fn{}),
+               "Unsupported type in `contains_sorted`.");
+  // Access the child column through `child()` method, not `get_sliced_child()`.
+  // This is because slicing offset has already been taken into account during row
+  // comparisons.
+  auto const child = lists.child();
+
+  CUDF_EXPECTS(cudf::have_same_types(child, search_keys),
+               "Type/Scale of search key does not match list column element type.",
+               cudf::data_type_error);
+  CUDF_EXPECTS(search_keys.type().id() != type_id::EMPTY, "Type cannot be empty.");
+
+  auto const num_rows = lists.size();
+
+  auto const lists_cdv_ptr = column_device_view::create(lists.parent(), stream);
+  auto const input_it      = cudf::detail::make_counting_transform_iterator(
+    size_type{0},
+    cuda::proclaim_return_type<list_device_view>(
+      [lists = cudf::detail::lists_column_device_view{*lists_cdv_ptr}] __device__(auto const idx) {
+        return list_device_view{lists, idx};
+      }));
+
+  auto out_positions = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const output_it = out_positions->mutable_view().template begin<size_type>();
+
+  auto const keys_dv_ptr       = column_device_view::create(search_keys, stream);
+  auto const key_validity_iter = cudf::detail::make_validity_iterator<true>(*keys_dv_ptr);
+
+  auto const keys_tview  = cudf::table_view{{search_keys}};
+  auto const child_tview = cudf::table_view{{child}};
+  auto const has_nulls   = has_nested_nulls(child_tview) || has_nested_nulls(keys_tview);
+  auto const less_comparator = cudf::experimental::row::lexicographic::two_table_comparator(
+    child_tview,
+    keys_tview,
+    std::vector<order>{order::ASCENDING},
+    std::vector<null_order>{null_order::AFTER},
+    stream);
+  auto const eq_comparator =
+    cudf::experimental::row::equality::two_table_comparator(child_tview, keys_tview, stream);
+  auto const d_less = less_comparator.less<false>(nullate::DYNAMIC{has_nulls});
+  auto const d_eq   = eq_comparator.equal_to<false>(nullate::DYNAMIC{has_nulls});
+
+  auto const run_search = [&](auto const key_index_iter) {
+    thrust::transform(rmm::exec_policy(stream),
+                      input_it,
+                      input_it + num_rows,
+                      output_it,
+                      sorted_search_list_fn{key_index_iter, key_validity_iter, d_less, d_eq});
+  };
+  // A broadcast (scalar) key is stored as a single-element keys column; every row maps to it
+  if (broadcast_key) {
+    run_search(thrust::make_constant_iterator(size_type{0}));
+  } else {
+    run_search(thrust::make_counting_iterator(size_type{0}));
+  }
+
+  if (search_keys.has_nulls() || lists.has_nulls()) {
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      output_it,
+      output_it + num_rows,
+      [] __device__(auto const idx) { return idx != NULL_SENTINEL; },
+      stream,
+      mr);
+    out_positions->set_null_mask(std::move(null_mask), null_count);
+  }
+  return out_positions;
+}
+
 /**
  * @brief Converts key-positions vector (from `index_of()`) to a BOOL8 vector, indicating if
  * the search key(s) were found.
@@ -293,8 +438,11 @@ std::unique_ptr<column> index_of(lists_column_view const& lists,
       data_type{type_to_id<size_type>()}, 0, cudf::mask_state::UNALLOCATED, stream, mr);
   }
 
-  auto search_key_col = cudf::make_column_from_scalar(search_key, lists.size(), stream, mr);
-  return detail::index_of(lists, search_key_col->view(), find_option, stream, mr);
+  // A single-element column stands in for the scalar; the search broadcasts it to every row
+  // instead of materializing a full lists-sized key column
+  auto const search_key_col = cudf::make_column_from_scalar(
+    search_key, 1, stream, cudf::get_current_device_resource_ref());
+  return dispatch_index_of(lists, search_key_col->view(), find_option, true, stream, mr);
 }
 
 std::unique_ptr<column> index_of(lists_column_view const& lists,
@@ -305,7 +453,7 @@ std::unique_ptr<column> index_of(lists_column_view const& lists,
 {
   CUDF_EXPECTS(search_keys.size() == lists.size(),
                "Number of search keys must match list column size.");
-  return dispatch_index_of(lists, search_keys, find_option, stream, mr);
+  return dispatch_index_of(lists, search_keys, find_option, false, stream, mr);
 }
 
 std::unique_ptr<column> contains(lists_column_view const& lists,
@@ -337,6 +485,50 @@ std::unique_ptr<column> contains(lists_column_view const& lists,
   return to_contains(std::move(key_indices), stream, mr);
 }
 
+std::unique_ptr<column> contains_sorted(lists_column_view const& lists,
+                                        cudf::scalar const& search_key,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  if (!search_key.is_valid(stream)) {
+    return to_contains(
+      make_numeric_column(
+        data_type{cudf::type_to_id<size_type>()},
+        lists.size(),
+        cudf::detail::create_null_mask(lists.size(), mask_state::ALL_NULL, stream, mr),
+        lists.size(),
+        stream,
+        mr),
+      stream,
+      mr);
+  }
+  if (lists.size() == 0) {
+    return make_numeric_column(
+      data_type{type_id::BOOL8}, 0, cudf::mask_state::UNALLOCATED, stream, mr);
+  }
+
+  // A single-element column stands in for the scalar; the search broadcasts it to every row
+  // instead of materializing a full lists-sized key column
+  auto const search_key_col = cudf::make_column_from_scalar(
+    search_key, 1, stream, cudf::get_current_device_resource_ref());
+  auto key_positions = dispatch_sorted_index_of(
+    lists, search_key_col->view(), true, stream, cudf::get_current_device_resource_ref());
+  return to_contains(std::move(key_positions), stream, mr);
+}
+
+std::unique_ptr<column> contains_sorted(lists_column_view const& lists,
+                                        column_view const& search_keys,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  auto key_positions = dispatch_sorted_index_of(
+    lists, search_keys, false, stream, cudf::get_current_device_resource_ref());
+  return to_contains(std::move(key_positions), stream, mr);
+}
+
 std::unique_ptr<column> contains_nulls(lists_column_view const& lists,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
@@ -388,6 +580,24 @@ std::unique_ptr<column> contains(lists_column_view const& lists,
   return detail::contains(lists, search_keys, stream, mr);
 }
 
+std::unique_ptr<column> contains_sorted(lists_column_view const& lists,
+                                        cudf::scalar const& search_key,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_sorted(lists, search_key, stream, mr);
+}
+
+std::unique_ptr<column> contains_sorted(lists_column_view const& lists,
+                                        column_view const& search_keys,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_sorted(lists, search_keys, stream, mr);
+}
+
 std::unique_ptr<column> contains_nulls(lists_column_view const& lists,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "lists/utilities.hpp"
+
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/copy_range.cuh>
 #include <cudf/detail/gather.cuh>
@@ -28,7 +30,6 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <cuda/functional>
-#include <thrust/binary_search.h>
 #include <thrust/execution_policy.h>
 
 namespace cudf {
@@ -49,8 +50,6 @@ std::unique_ptr<column> segmented_gather(lists_column_view const& value_column,
 
   auto const gather_map_sliced_child = gather_map.get_sliced_child(stream);
   auto const gather_map_size         = gather_map_sliced_child.size();
-  auto const gather_index_begin      = gather_map.offsets_begin() + 1;
-  auto const gather_index_end        = gather_map.offsets_end();
   auto const value_offsets           = value_column.offsets_begin();
   auto const value_device_view       = column_device_view::create(value_column.parent(), stream);
   auto const map_begin =
@@ -59,20 +58,22 @@ std::unique_ptr<column> segmented_gather(lists_column_view const& value_column,
     return index >= list_size || (index < 0 && -index > list_size);
   };
 
+  // Precompute the row each gather-map element belongs to with a single coalesced labeling pass.
+  // The gather iterator below is dereferenced once per output pass (data and validity), and a
+  // per-element binary search over the offsets would repeat that cost every time.
+  auto const row_labels = generate_labels(
+    gather_map, gather_map_size, stream, cudf::get_current_device_resource_ref());
+
   // Calculate Flattened gather indices  (value_offset[row]+sub_index
   auto transformer =
     cuda::proclaim_return_type<size_type>([values_lists_view = *value_device_view,
                                            value_offsets,
                                            map_begin,
-                                           gather_index_begin,
-                                           gather_index_end,
+                                           labels = row_labels->view().begin<size_type>(),
                                            bounds_policy,
                                            out_of_bounds] __device__(size_type index) -> size_type {
       // Get each row's offset. (Each row is a list).
-      auto offset_idx =
-        thrust::upper_bound(
-          thrust::seq, gather_index_begin, gather_index_end, gather_index_begin[-1] + index) -
-        gather_index_begin;
+      auto offset_idx = labels[index];
       // Get each sub_index in list in each row of gather_map.
       auto sub_index    = map_begin[index];
       auto list_is_null = values_lists_view.is_null(offset_idx);
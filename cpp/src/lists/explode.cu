@@ -33,6 +33,7 @@
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
 #include <thrust/distance.h>
+#include <thrust/equal.h>
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -42,6 +43,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -149,6 +151,89 @@ std::unique_ptr<table> explode(table_view const& input_table,
                      mr);
 }
 
+std::unique_ptr<table> explode(table_view const& input_table,
+                               std::vector<size_type> const& explode_column_idxs,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  if (explode_column_idxs.size() == 1) {
+    return explode(input_table, explode_column_idxs.front(), stream, mr);
+  }
+
+  std::vector<bool> is_exploded(input_table.num_columns(), false);
+  for (auto const idx : explode_column_idxs) {
+    CUDF_EXPECTS(!is_exploded[idx], "explode column indices must not contain duplicates");
+    is_exploded[idx] = true;
+  }
+
+  lists_column_view first_col{input_table.column(explode_column_idxs.front())};
+  auto const first_offsets = first_col.offsets_begin();
+
+  // all exploded columns must imply the same row mapping: their offsets must be identical
+  // (rebased by the first offset to handle sliced columns)
+  auto rebased = [](size_type const* offsets) {
+    return thrust::make_transform_iterator(
+      offsets, cuda::proclaim_return_type<size_type>(
+                 [offsets] __device__(auto o) { return o - offsets[0]; }));
+  };
+  for (auto const idx : explode_column_idxs) {
+    if (idx == explode_column_idxs.front()) { continue; }
+    lists_column_view col{input_table.column(idx)};
+    auto const other_offsets = col.offsets_begin();
+    CUDF_EXPECTS(thrust::equal(rmm::exec_policy(stream),
+                               rebased(first_offsets),
+                               rebased(first_offsets) + first_col.size() + 1,
+                               rebased(other_offsets)),
+                 "exploded columns must have identical offsets");
+  }
+
+  auto sliced_child = first_col.get_sliced_child(stream);
+  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
+
+  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
+  auto offsets_minus_one = thrust::make_transform_iterator(
+    thrust::next(first_offsets),
+    cuda::proclaim_return_type<size_type>(
+      [offsets = first_offsets] __device__(auto i) { return (i - offsets[0]) - 1; }));
+  auto counting_iter = thrust::make_counting_iterator(0);
+
+  // the shared row mapping is computed once for all exploded columns
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      offsets_minus_one,
+                      offsets_minus_one + first_col.size(),
+                      counting_iter,
+                      counting_iter + gather_map.size(),
+                      gather_map.begin());
+
+  // gather the non-exploded columns once through the shared mapping
+  std::vector<size_type> non_exploded_idxs;
+  for (size_type i = 0; i < input_table.num_columns(); ++i) {
+    if (!is_exploded[i]) { non_exploded_idxs.push_back(i); }
+  }
+  auto gathered = detail::gather(input_table.select(non_exploded_idxs),
+                                 gather_map.begin(),
+                                 gather_map.end(),
+                                 cudf::out_of_bounds_policy::DONT_CHECK,
+                                 stream,
+                                 mr)
+                    ->release();
+
+  // since the offsets line up element-for-element, each exploded column's output rows are
+  // exactly its own child elements -- no per-column remapping is needed
+  std::vector<std::unique_ptr<column>> columns(input_table.num_columns());
+  auto gathered_iter = gathered.begin();
+  for (size_type i = 0; i < input_table.num_columns(); ++i) {
+    if (is_exploded[i]) {
+      columns[i] = std::make_unique<column>(
+        lists_column_view{input_table.column(i)}.get_sliced_child(stream), stream, mr);
+    } else {
+      columns[i] = std::move(*gathered_iter++);
+    }
+  }
+
+  return std::make_unique<table>(std::move(columns));
+}
+
 std::unique_ptr<table> explode_position(table_view const& input_table,
                                         size_type const explode_column_idx,
                                         rmm::cuda_stream_view stream,
@@ -314,6 +399,24 @@ std::unique_ptr<table> explode(table_view const& input_table,
   return detail::explode(input_table, explode_column_idx, stream, mr);
 }
 
+/**
+ * @copydoc cudf::explode(table_view const&, std::vector<size_type> const&, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<table> explode(table_view const& input_table,
+                               std::vector<size_type> const& explode_column_idxs,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(!explode_column_idxs.empty(), "At least one column index to explode is required");
+  for (auto const idx : explode_column_idxs) {
+    CUDF_EXPECTS(input_table.column(idx).type().id() == type_id::LIST,
+                 "Unsupported non-list column");
+  }
+  return detail::explode(input_table, explode_column_idxs, stream, mr);
+}
+
 /**
  * @copydoc cudf::explode_position(table_view const&, size_type, rmm::cuda_stream_view,
  * rmm::device_async_resource_ref)
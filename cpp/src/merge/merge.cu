@@ -15,8 +15,10 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -44,6 +46,7 @@
 
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
@@ -52,9 +55,9 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <limits>
 #include <numeric>
-#include <queue>
 #include <vector>
 
 namespace cudf {
@@ -582,28 +585,54 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
-
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()}
-  {
-  }
-
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
-};
-
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q)
+/**
+ * @brief Computes the merged row order of a table composed of consecutive sorted runs.
+ *
+ * Adjacent runs' index ranges are merged pairwise until a single run remains. Only the
+ * `size_type` row indices are rewritten by each pass; the table's rows are not moved,
+ * so all columns can be materialized with a single gather once the order is known.
+ *
+ * @param run_offsets Offsets of the sorted runs; `run_offsets[i]` is the first row of run
+ * `i` and `run_offsets.back()` is the total number of rows
+ * @param d_less Device row comparator over the table's key columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Row indices of the table in merged order
+ */
+template <typename DeviceComparator>
+rmm::device_uvector<size_type> merge_indices_multiway(std::vector<size_type> const& run_offsets,
+                                                      DeviceComparator d_less,
+                                                      rmm::cuda_stream_view stream)
 {
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+  auto const total_rows = run_offsets.back();
+  auto current          = rmm::device_uvector<size_type>(total_rows, stream);
+  auto next             = rmm::device_uvector<size_type>(total_rows, stream);
+  thrust::sequence(rmm::exec_policy(stream), current.begin(), current.end());
+
+  auto offsets = run_offsets;
+  while (offsets.size() > 2) {
+    auto const num_runs = offsets.size() - 1;
+    std::vector<size_type> next_offsets{0};
+    for (std::size_t i = 0; i + 1 < num_runs; i += 2) {
+      thrust::merge(rmm::exec_policy(stream),
+                    current.begin() + offsets[i],
+                    current.begin() + offsets[i + 1],
+                    current.begin() + offsets[i + 1],
+                    current.begin() + offsets[i + 2],
+                    next.begin() + offsets[i],
+                    d_less);
+      next_offsets.push_back(offsets[i + 2]);
+    }
+    if (num_runs % 2 == 1) {  // odd run count: the trailing run passes through untouched
+      thrust::copy(rmm::exec_policy(stream),
+                   current.begin() + offsets[num_runs - 1],
+                   current.end(),
+                   next.begin() + offsets[num_runs - 1]);
+      next_offsets.push_back(offsets[num_runs]);
+    }
+    std::swap(current, next);
+    offsets = std::move(next_offsets);
+  }
+  return current;
 }
 
 }  // anonymous namespace
@@ -650,43 +679,71 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
     tables_to_merge, stream, cudf::get_current_device_resource_ref());
   auto merge_tables = matched.second;
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(merge_tables.begin(), merge_tables.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+  // Drop empty inputs; they contribute nothing to the merged order
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(merge_tables.begin(),
+               merge_tables.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& table) { return table.num_rows() > 0; });
 
   // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) {
-    return std::make_unique<cudf::table>(merge_queue.top().view, stream, mr);
+  if (non_empty_tables.size() == 1) {
+    return std::make_unique<cudf::table>(non_empty_tables.front(), stream, mr);
   }
   // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-
-    // Only use mr for the output table
-    auto const& new_tbl_mr = merge_queue.empty() ? mr : cudf::get_current_device_resource_ref();
-    auto merged_table      = merge(left_table.view,
-                              right_table.view,
-                              key_cols,
-                              column_order,
-                              null_precedence,
-                              stream,
-                              new_tbl_mr);
-
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (non_empty_tables.empty()) { return empty_like(first_table); }
+
+  // Two inputs merge directly; the type-dispatched column merger writes each row once
+  if (non_empty_tables.size() == 2) {
+    return merge(non_empty_tables.front(),
+                 non_empty_tables.back(),
+                 key_cols,
+                 column_order,
+                 null_precedence,
+                 stream,
+                 mr);
   }
 
-  return std::move(top_and_pop(merge_queue).table);
+  // Multiway merge: view the concatenated inputs as consecutive sorted runs, merge only
+  // the row indices pairwise, then materialize every output column with a single gather
+  // instead of rewriting the full rows once per pairwise pass
+  auto const concatenated = cudf::detail::concatenate(
+    non_empty_tables, stream, cudf::get_current_device_resource_ref());
+
+  std::vector<size_type> run_offsets{0};
+  std::transform(non_empty_tables.begin(),
+                 non_empty_tables.end(),
+                 std::back_inserter(run_offsets),
+                 [sum = size_type{0}](auto const& table) mutable {
+                   sum += table.num_rows();
+                   return sum;
+                 });
+
+  auto const keys     = concatenated->view().select(key_cols);
+  auto const nullable = has_nested_nulls(keys);
+  auto const comparator =
+    cudf::experimental::row::lexicographic::self_comparator(keys, column_order, null_precedence, stream);
+
+  auto const merged_order = [&] {
+    if (cudf::detail::has_nested_columns(keys)) {
+      return merge_indices_multiway(
+        run_offsets, comparator.less<true>(nullate::DYNAMIC{nullable}), stream);
+    }
+    return merge_indices_multiway(
+      run_offsets, comparator.less<false>(nullate::DYNAMIC{nullable}), stream);
+  }();
+
+  auto const merged_order_view = column_view(data_type{type_to_id<size_type>()},
+                                             static_cast<size_type>(merged_order.size()),
+                                             merged_order.data(),
+                                             nullptr,
+                                             0);
+  return cudf::detail::gather(concatenated->view(),
+                              merged_order_view,
+                              out_of_bounds_policy::DONT_CHECK,
+                              detail::negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
 }
 
 }  // namespace detail
@@ -267,6 +267,46 @@ std::pair<std::unique_ptr<table>, std::vector<cudf::size_type>> round_robin_part
   return ret_pair;
 }
 
+std::vector<round_robin_view> round_robin_partition_views(table_view const& input,
+                                                          cudf::size_type num_partitions,
+                                                          cudf::size_type start_partition)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Incorrect number of partitions. Must be greater than 0.");
+  CUDF_EXPECTS(start_partition < num_partitions,
+               "Incorrect start_partition index. Must be less than number of partitions.");
+  CUDF_EXPECTS(start_partition >= 0, "Incorrect start_partition index. Must be positive.");
+
+  auto const nrows = input.num_rows();
+  auto views       = std::vector<round_robin_view>{};
+  views.reserve(num_partitions);
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    // rows are dealt starting at start_partition, so partition p holds the input rows
+    // congruent to (p - start_partition) modulo num_partitions
+    auto const first_row = (p - start_partition + num_partitions) % num_partitions;
+    auto const size      = first_row < nrows ? (nrows - first_row - 1) / num_partitions + 1 : 0;
+    views.push_back(round_robin_view{input, first_row, num_partitions, size});
+  }
+  return views;
+}
+
+std::unique_ptr<table> materialize(round_robin_view const& partition,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto const first_row = partition.first_row;
+  auto const stride    = partition.stride;
+  auto map_begin       = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    cuda::proclaim_return_type<size_type>(
+      [first_row, stride] __device__(auto index) { return first_row + index * stride; }));
+  return cudf::detail::gather(partition.table,
+                              map_begin,
+                              map_begin + partition.num_rows,
+                              cudf::out_of_bounds_policy::DONT_CHECK,
+                              stream,
+                              mr);
+}
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> round_robin_partition(
@@ -280,4 +320,19 @@ std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::size_type>> round_robi
   return detail::round_robin_partition(input, num_partitions, start_partition, stream, mr);
 }
 
+std::vector<round_robin_view> round_robin_partition_views(table_view const& input,
+                                                          cudf::size_type num_partitions,
+                                                          cudf::size_type start_partition)
+{
+  CUDF_FUNC_RANGE();
+  return detail::round_robin_partition_views(input, num_partitions, start_partition);
+}
+
+std::unique_ptr<table> round_robin_view::materialize(rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::materialize(*this, stream, mr);
+}
+
 }  // namespace cudf
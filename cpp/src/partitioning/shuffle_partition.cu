@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Alignment of each column's data slice within a partition buffer
+std::size_t constexpr partition_buffer_align = 64;
+
+/**
+ * @brief Assigns each row its partition and its rank (arrival order) within that partition.
+ *
+ * The per-partition counters double as the final partition sizes.
+ */
+struct assign_partition_fn {
+  uint32_t const* hashes;
+  size_type num_partitions;
+  size_type* partition_map;
+  size_type* rank;
+  size_type* partition_sizes;
+
+  __device__ void operator()(size_type row) const
+  {
+    auto const p       = static_cast<size_type>(hashes[row] % num_partitions);
+    partition_map[row] = p;
+    rank[row]          = atomicAdd(partition_sizes + p, size_type{1});
+  }
+};
+
+/**
+ * @brief Scatters one column's values directly into the per-partition output slices.
+ *
+ * `dst` holds, for this column, the typed base pointer of its slice in each partition's
+ * contiguous buffer; each value moves from the input to its final shuffled position in a
+ * single copy.
+ */
+template <typename T>
+struct scatter_column_fn {
+  T const* src;
+  T* const* dst;
+  size_type const* partition_map;
+  size_type const* rank;
+
+  __device__ void operator()(size_type row) const
+  {
+    dst[partition_map[row]][rank[row]] = src[row];
+  }
+};
+
+struct scatter_column_dispatch {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  void operator()(column_view const& col,
+                  device_span<uint8_t* const> dst,
+                  size_type const* partition_map,
+                  size_type const* rank,
+                  rmm::cuda_stream_view stream) const
+  {
+    using StorageT = device_storage_type_t<T>;
+    thrust::for_each(rmm::exec_policy(stream),
+                     thrust::counting_iterator<size_type>(0),
+                     thrust::counting_iterator<size_type>(col.size()),
+                     scatter_column_fn<StorageT>{col.head<StorageT>(),
+                                                 reinterpret_cast<StorageT* const*>(dst.data()),
+                                                 partition_map,
+                                                 rank});
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  void operator()(column_view const&,
+                  device_span<uint8_t* const>,
+                  size_type const*,
+                  size_type const*,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unsupported type for fused shuffle partitioning");
+  }
+};
+
+/// True if every column of `input` can take the fused scatter path
+bool is_fusible(table_view const& input)
+{
+  return input.num_rows() > 0 and
+         std::all_of(input.begin(), input.end(), [](column_view const& col) {
+           return cudf::is_fixed_width(col.type()) and not col.has_nulls();
+         });
+}
+
+/**
+ * @brief Fused partition+pack: scatters each row straight into its partition's contiguous
+ * buffer, skipping the intermediate reordered table entirely.
+ */
+std::vector<packed_table> fused_shuffle_partition(table_view const& input,
+                                                  std::vector<size_type> const& columns_to_hash,
+                                                  size_type num_partitions,
+                                                  uint32_t seed,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = input.num_rows();
+  auto const num_cols = input.num_columns();
+
+  auto const hashes = cudf::hashing::detail::murmurhash3_x86_32(
+    input.select(columns_to_hash), seed, stream, cudf::get_current_device_resource_ref());
+
+  auto partition_map   = rmm::device_uvector<size_type>(num_rows, stream);
+  auto rank            = rmm::device_uvector<size_type>(num_rows, stream);
+  auto partition_sizes = rmm::device_uvector<size_type>(num_partitions, stream);
+  thrust::fill(rmm::exec_policy(stream), partition_sizes.begin(), partition_sizes.end(), 0);
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::counting_iterator<size_type>(0),
+                   thrust::counting_iterator<size_type>(num_rows),
+                   assign_partition_fn{hashes->view().begin<uint32_t>(),
+                                       num_partitions,
+                                       partition_map.data(),
+                                       rank.data(),
+                                       partition_sizes.data()});
+  auto const h_sizes = cudf::detail::make_std_vector_sync(partition_sizes, stream);
+
+  // Per-partition buffer layout: each column's slice is aligned so the packed buffer can be
+  // transferred and unpacked as-is
+  auto h_column_offsets = std::vector<std::vector<std::size_t>>(num_partitions);
+  auto buffer_sizes     = std::vector<std::size_t>(num_partitions);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto& offsets = h_column_offsets[p];
+    offsets.reserve(num_cols);
+    std::size_t offset = 0;
+    for (auto const& col : input) {
+      offsets.push_back(offset);
+      auto const bytes = static_cast<std::size_t>(h_sizes[p]) * cudf::size_of(col.type());
+      offset += (bytes + partition_buffer_align - 1) / partition_buffer_align *
+                partition_buffer_align;
+    }
+    buffer_sizes[p] = std::max(offset, std::size_t{1});  // keep empty partitions addressable
+  }
+
+  // Allocate one contiguous buffer per partition from `mr` (e.g. a pinned-backed resource for
+  // RDMA staging)
+  auto buffers = std::vector<std::unique_ptr<rmm::device_buffer>>{};
+  buffers.reserve(num_partitions);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    buffers.push_back(std::make_unique<rmm::device_buffer>(buffer_sizes[p], stream, mr));
+  }
+
+  // Scatter each column into its slice of every partition buffer
+  auto h_dst_ptrs = std::vector<uint8_t*>(static_cast<std::size_t>(num_partitions));
+  for (size_type c = 0; c < num_cols; ++c) {
+    for (size_type p = 0; p < num_partitions; ++p) {
+      h_dst_ptrs[p] = static_cast<uint8_t*>(buffers[p]->data()) + h_column_offsets[p][c];
+    }
+    auto const dst_ptrs = cudf::detail::make_device_uvector_async(
+      h_dst_ptrs, stream, cudf::get_current_device_resource_ref());
+    cudf::type_dispatcher(input.column(c).type(),
+                          scatter_column_dispatch{},
+                          input.column(c),
+                          device_span<uint8_t* const>{dst_ptrs.data(), dst_ptrs.size()},
+                          partition_map.data(),
+                          rank.data(),
+                          stream);
+  }
+
+  // Assemble the views and packed metadata over the finished buffers
+  auto result = std::vector<packed_table>{};
+  result.reserve(num_partitions);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto columns = std::vector<column_view>{};
+    columns.reserve(num_cols);
+    for (size_type c = 0; c < num_cols; ++c) {
+      columns.emplace_back(input.column(c).type(),
+                           h_sizes[p],
+                           static_cast<uint8_t const*>(buffers[p]->data()) + h_column_offsets[p][c],
+                           nullptr,
+                           0);
+    }
+    auto tv       = table_view{columns};
+    auto metadata = std::make_unique<std::vector<uint8_t>>(cudf::pack_metadata(
+      tv, static_cast<uint8_t const*>(buffers[p]->data()), buffers[p]->size()));
+    result.emplace_back(
+      packed_table{tv, packed_columns{std::move(metadata), std::move(buffers[p])}});
+  }
+  return result;
+}
+
+}  // namespace
+
+std::vector<packed_table> shuffle_partition(table_view const& input,
+                                            std::vector<size_type> const& columns_to_hash,
+                                            size_type num_partitions,
+                                            uint32_t seed,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive");
+  CUDF_EXPECTS(not columns_to_hash.empty(), "At least one key column must be hashed");
+
+  if (is_fusible(input)) {
+    return fused_shuffle_partition(input, columns_to_hash, num_partitions, seed, stream, mr);
+  }
+
+  // Generic fallback: reorder once, then serialize the partition slices
+  auto [reordered, offsets] = cudf::hash_partition(
+    input, columns_to_hash, num_partitions, hash_id::HASH_MURMUR3, seed, stream, mr);
+  auto const splits = std::vector<size_type>(offsets.begin() + 1, offsets.end());
+  return detail::contiguous_split(reordered->view(), splits, stream, mr);
+}
+
+}  // namespace detail
+
+std::vector<packed_table> shuffle_partition(table_view const& input,
+                                            std::vector<size_type> const& columns_to_hash,
+                                            size_type num_partitions,
+                                            uint32_t seed,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::shuffle_partition(input, columns_to_hash, num_partitions, seed, stream, mr);
+}
+
+}  // namespace cudf
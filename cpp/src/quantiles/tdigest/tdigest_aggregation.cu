@@ -24,9 +24,12 @@
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -55,6 +58,9 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace tdigest {
 namespace detail {
@@ -1274,6 +1280,103 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
     mr);
 }
 
+struct group_offsets_fn {
+  size_type const size;
+  CUDF_HOST_DEVICE size_type operator()(size_type i) const { return i == 0 ? 0 : size; }
+};
+
+// Inputs at or above this row count are digested in fixed-size chunks that are each sorted
+// independently and then merged, instead of globally sorting the entire column first.
+constexpr size_type chunked_reduce_threshold = 1 << 26;
+// Number of rows digested per chunk by the chunked reduction path.
+constexpr size_type reduce_chunk_size = 1 << 24;
+
+struct chunk_label_fn {
+  size_type const chunk_size;
+  __device__ size_type operator()(size_type i) const { return i / chunk_size; }
+};
+
+/**
+ * @brief Builds a tdigest over a large column without globally sorting it.
+ *
+ * The input is split into fixed-size chunks which are sorted independently (a cheaper,
+ * better-localized operation than one monolithic sort), a tdigest is computed per chunk as if
+ * each chunk were a group in a groupby, and the per-chunk digests are merged into the final
+ * result. Because tdigests are themselves approximate, merging per-chunk digests stays within
+ * the expected accuracy bounds of the requested `delta`.
+ */
+std::unique_ptr<scalar> chunked_reduce_tdigest(column_view const& col,
+                                               int delta,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  auto const temp_mr    = cudf::get_current_device_resource_ref();
+  auto const num_chunks = cudf::util::div_rounding_up_safe(col.size(), reduce_chunk_size);
+
+  auto h_offsets = std::vector<size_type>(num_chunks + 1);
+  for (size_type i = 0; i <= num_chunks; ++i) {
+    h_offsets[i] =
+      static_cast<size_type>(std::min<int64_t>(int64_t{i} * reduce_chunk_size, col.size()));
+  }
+  auto chunk_offsets = cudf::detail::make_device_uvector_async(h_offsets, stream, temp_mr);
+
+  // sort each chunk independently, nulls at the end of their chunk
+  auto const offsets_view = column_view(
+    data_type{type_to_id<size_type>()}, num_chunks + 1, chunk_offsets.data(), nullptr, 0);
+  auto sorted            = cudf::detail::segmented_sort_by_key(table_view({col}),
+                                                    table_view({col}),
+                                                    offsets_view,
+                                                    {order::ASCENDING},
+                                                    {null_order::AFTER},
+                                                    stream,
+                                                    temp_mr);
+  auto const& sorted_col = sorted->get_column(0);
+
+  // treat each chunk as a group: per-row chunk labels and per-chunk valid counts
+  auto chunk_labels = rmm::device_uvector<size_type>(col.size(), stream, temp_mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(col.size()),
+                    chunk_labels.begin(),
+                    chunk_label_fn{reduce_chunk_size});
+
+  auto const h_valid_counts = [&] {
+    if (col.null_count() == 0) {
+      auto counts = std::vector<size_type>(num_chunks);
+      for (size_type i = 0; i < num_chunks; ++i) {
+        counts[i] = h_offsets[i + 1] - h_offsets[i];
+      }
+      return counts;
+    }
+    auto indices = std::vector<size_type>(num_chunks * 2);
+    for (size_type i = 0; i < num_chunks; ++i) {
+      indices[2 * i]     = h_offsets[i];
+      indices[2 * i + 1] = h_offsets[i + 1];
+    }
+    return cudf::detail::segmented_valid_count(sorted_col.view().null_mask(), indices, stream);
+  }();
+  auto chunk_valid_counts = cudf::detail::make_device_uvector_async(h_valid_counts, stream, temp_mr);
+
+  // one tdigest per chunk
+  auto chunk_digests = cudf::type_dispatcher(col.type(),
+                                             typed_group_tdigest{},
+                                             sorted_col.view(),
+                                             chunk_offsets,
+                                             chunk_labels,
+                                             chunk_valid_counts,
+                                             num_chunks,
+                                             delta,
+                                             stream,
+                                             temp_mr);
+
+  // merge the per-chunk digests into the final result
+  tdigest_column_view tdv(chunk_digests->view());
+  auto group_offsets = cudf::detail::make_counting_transform_iterator(0, group_offsets_fn{num_chunks});
+  auto group_labels  = thrust::make_constant_iterator(0);
+  return to_tdigest_scalar(
+    merge_tdigests(tdv, group_offsets, group_labels, num_chunks, 1, delta, stream, mr), stream, mr);
+}
+
 }  // anonymous namespace
 
 std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
@@ -1283,22 +1386,24 @@ std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
 {
   if (col.size() == 0) { return cudf::tdigest::detail::make_empty_tdigest_scalar(stream, mr); }
 
+  auto const delta = max_centroids;
+
+  // for very large inputs, digest fixed-size chunks and merge the per-chunk digests rather
+  // than paying for a global sort of the whole column
+  if (col.size() >= chunked_reduce_threshold) {
+    return chunked_reduce_tdigest(col, delta, stream, mr);
+  }
+
   // since this isn't coming out of a groupby, we need to sort the inputs in ascending
   // order with nulls at the end.
   table_view t({col});
   auto sorted = cudf::detail::sort(
     t, {order::ASCENDING}, {null_order::AFTER}, stream, cudf::get_current_device_resource_ref());
 
-  auto const delta = max_centroids;
   return cudf::type_dispatcher(
     col.type(), typed_reduce_tdigest{}, sorted->get_column(0), delta, stream, mr);
 }
 
-struct group_offsets_fn {
-  size_type const size;
-  CUDF_HOST_DEVICE size_type operator()(size_type i) const { return i == 0 ? 0 : size; }
-};
-
 std::unique_ptr<scalar> reduce_merge_tdigest(column_view const& input,
                                              int max_centroids,
                                              rmm::cuda_stream_view stream,
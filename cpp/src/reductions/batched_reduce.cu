@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/assert.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cub/block/block_reduce.cuh>
+#include <cuda/std/limits>
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+
+constexpr int fused_block_size = 256;
+
+/**
+ * @brief Per-column accumulators produced by the fused stats kernel
+ *
+ * Integral columns fill the `*_int` members and floating-point columns the `*_fp` members, so
+ * integer sums stay exact up to the int64_t accumulator the per-column SUM reduction would use.
+ */
+struct fused_column_stats {
+  int64_t valid_count;
+  int64_t sum_int;
+  int64_t min_int;
+  int64_t max_int;
+  double sum_fp;
+  double min_fp;
+  double max_fp;
+};
+
+/**
+ * @brief Computes count/sum/min/max of one column with a single thread block
+ *
+ * Dispatched per block on the column's type; every thread accumulates a strided slice of rows
+ * and the block-wide results are combined with cub block reductions.
+ */
+struct fused_stats_fn {
+  column_device_view col;
+  fused_column_stats* out;
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>() and not std::is_same_v<T, bool>)>
+  __device__ void operator()()
+  {
+    using Accum = std::conditional_t<std::is_floating_point_v<T>, double, int64_t>;
+    int64_t valid = 0;
+    Accum sum{0};
+    auto mn = cuda::std::numeric_limits<Accum>::max();
+    auto mx = cuda::std::numeric_limits<Accum>::lowest();
+    for (auto i = static_cast<size_type>(threadIdx.x); i < col.size(); i += fused_block_size) {
+      if (col.is_valid(i)) {
+        auto const v = static_cast<Accum>(col.element<T>(i));
+        ++valid;
+        sum += v;
+        mn = v < mn ? v : mn;
+        mx = v > mx ? v : mx;
+      }
+    }
+
+    using StatReduce  = cub::BlockReduce<Accum, fused_block_size>;
+    using CountReduce = cub::BlockReduce<int64_t, fused_block_size>;
+    __shared__ union {
+      typename StatReduce::TempStorage stat;
+      typename CountReduce::TempStorage count;
+    } temp;
+    auto const block_sum = StatReduce(temp.stat).Sum(sum);
+    __syncthreads();
+    auto const block_min = StatReduce(temp.stat).Reduce(mn, cub::Min{});
+    __syncthreads();
+    auto const block_max = StatReduce(temp.stat).Reduce(mx, cub::Max{});
+    __syncthreads();
+    auto const block_valid = CountReduce(temp.count).Sum(valid);
+
+    if (threadIdx.x == 0) {
+      out->valid_count = block_valid;
+      if constexpr (std::is_floating_point_v<T>) {
+        out->sum_fp = block_sum;
+        out->min_fp = block_min;
+        out->max_fp = block_max;
+      } else {
+        out->sum_int = block_sum;
+        out->min_int = block_min;
+        out->max_int = block_max;
+      }
+    }
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not(cudf::is_numeric<T>() and not std::is_same_v<T, bool>))>
+  __device__ void operator()()
+  {
+    CUDF_UNREACHABLE("non-numeric columns are filtered out before the fused kernel");
+  }
+};
+
+/**
+ * @brief Computes the stats of all fused columns in one launch, one block per column
+ */
+CUDF_KERNEL void fused_stats_kernel(table_device_view table, fused_column_stats* stats)
+{
+  auto const col = table.column(blockIdx.x);
+  cudf::type_dispatcher(col.type(), fused_stats_fn{col, stats + blockIdx.x});
+}
+
+/**
+ * @brief Constructs a numeric scalar of the requested output type from a host value
+ */
+template <typename Source>
+struct make_stat_scalar_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  std::unique_ptr<scalar> operator()(Source value,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    return std::make_unique<numeric_scalar<T>>(static_cast<T>(value), true, stream, mr);
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not cudf::is_numeric<T>())>
+  std::unique_ptr<scalar> operator()(Args&&...)
+  {
+    CUDF_FAIL("Fused reductions only produce numeric scalars.");
+  }
+};
+
+/**
+ * @brief Checks whether an aggregation on a column can be served by the fused stats kernel
+ *
+ * Empty and all-null columns take the fallback path so the default-constructed invalid scalar
+ * semantics of `cudf::reduce` are preserved.
+ */
+bool is_fused_eligible(column_view const& col, aggregation::Kind kind)
+{
+  auto const supported_kind = kind == aggregation::SUM or kind == aggregation::MIN or
+                              kind == aggregation::MAX or kind == aggregation::MEAN;
+  return supported_kind and cudf::is_numeric(col.type()) and
+         col.type().id() != type_id::BOOL8 and col.size() > col.null_count();
+}
+
+std::unique_ptr<scalar> make_fused_result(column_view const& col,
+                                          aggregation::Kind kind,
+                                          fused_column_stats const& stats,
+                                          data_type output_dtype,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  auto const is_fp = cudf::is_floating_point(col.type());
+  if (kind == aggregation::MEAN) {
+    auto const sum = is_fp ? stats.sum_fp : static_cast<double>(stats.sum_int);
+    return cudf::type_dispatcher(output_dtype,
+                                 make_stat_scalar_fn<double>{},
+                                 sum / static_cast<double>(stats.valid_count),
+                                 stream,
+                                 mr);
+  }
+  if (is_fp) {
+    auto const value = kind == aggregation::SUM   ? stats.sum_fp
+                       : kind == aggregation::MIN ? stats.min_fp
+                                                  : stats.max_fp;
+    return cudf::type_dispatcher(output_dtype, make_stat_scalar_fn<double>{}, value, stream, mr);
+  }
+  auto const value = kind == aggregation::SUM   ? stats.sum_int
+                     : kind == aggregation::MIN ? stats.min_int
+                                                : stats.max_int;
+  return cudf::type_dispatcher(output_dtype, make_stat_scalar_fn<int64_t>{}, value, stream, mr);
+}
+
+}  // namespace
+
+std::vector<std::vector<std::unique_ptr<scalar>>> batched_reduce(
+  table_view const& input,
+  std::vector<std::vector<std::unique_ptr<reduce_aggregation>>> const& aggregations,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(static_cast<std::size_t>(input.num_columns()) == aggregations.size(),
+               "There must be one aggregation list per input column",
+               std::invalid_argument);
+
+  // columns with at least one fusible aggregation share a single stats kernel launch
+  auto fused_cols  = std::vector<column_view>{};
+  auto fused_index = std::vector<size_type>(input.num_columns(), -1);
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    auto const& col = input.column(c);
+    if (std::any_of(aggregations[c].begin(), aggregations[c].end(), [&](auto const& agg) {
+          return is_fused_eligible(col, agg->kind);
+        })) {
+      fused_index[c] = static_cast<size_type>(fused_cols.size());
+      fused_cols.push_back(col);
+    }
+  }
+
+  auto stats = std::vector<fused_column_stats>{};
+  if (not fused_cols.empty()) {
+    auto d_stats = rmm::device_uvector<fused_column_stats>(
+      fused_cols.size(), stream, cudf::get_current_device_resource_ref());
+    auto const d_table = table_device_view::create(table_view{fused_cols}, stream);
+    fused_stats_kernel<<<fused_cols.size(), fused_block_size, 0, stream.value()>>>(*d_table,
+                                                                                   d_stats.data());
+    CUDF_CHECK_CUDA(stream.value());
+    stats = cudf::detail::make_std_vector_sync(d_stats, stream);
+  }
+
+  auto results = std::vector<std::vector<std::unique_ptr<scalar>>>{};
+  results.reserve(aggregations.size());
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    auto const& col = input.column(c);
+    auto column_results = std::vector<std::unique_ptr<scalar>>{};
+    column_results.reserve(aggregations[c].size());
+    for (auto const& agg : aggregations[c]) {
+      auto const output_dtype = cudf::detail::target_type(col.type(), agg->kind);
+      column_results.push_back(
+        is_fused_eligible(col, agg->kind)
+          ? make_fused_result(col, agg->kind, stats[fused_index[c]], output_dtype, stream, mr)
+          : reduce(col, *agg, output_dtype, std::nullopt, stream, mr));
+    }
+    results.push_back(std::move(column_results));
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace reduction
+
+std::vector<std::vector<std::unique_ptr<scalar>>> batched_reduce(
+  table_view const& input,
+  std::vector<std::vector<std::unique_ptr<reduce_aggregation>>> const& aggregations,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::batched_reduce(input, aggregations, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/block/block_reduce.cuh>
+#include <cuda/std/limits>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+
+constexpr int stats_block_size = 256;
+
+// Edge length of the square output tile computed by one thread block
+constexpr int tile_dim = 16;
+
+/**
+ * @brief Casts one column of the input into its column-major slice of the working matrix
+ */
+struct cast_column_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>() and not std::is_same_v<T, bool>)>
+  void operator()(column_device_view const& col, double* out, rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(col.size()),
+                      out,
+                      [col] __device__(size_type i) {
+                        return static_cast<double>(col.element<T>(i));
+                      });
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_numeric<T>() or std::is_same_v<T, bool>)>
+  void operator()(column_device_view const&, double*, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("correlation_matrix supports only non-bool numeric columns", cudf::data_type_error);
+  }
+};
+
+/**
+ * @brief Computes the mean and inverse deviation norm of each column with one block per column
+ *
+ * The inverse norm is `1 / sqrt(sum((x - mean)^2))`; standardizing with it makes the pairwise
+ * dot products below Pearson coefficients directly, with no trailing `1 / (n - 1)` factor. A
+ * zero-variance column gets an infinite inverse norm, which turns its standardized values and
+ * thus its correlations into NaN.
+ */
+CUDF_KERNEL void column_stats_kernel(double const* data,
+                                     size_type num_rows,
+                                     double* means,
+                                     double* inv_norms)
+{
+  using block_reduce = cub::BlockReduce<double, stats_block_size>;
+  __shared__ typename block_reduce::TempStorage temp_storage;
+  __shared__ double block_mean;
+
+  auto const col_data = data + static_cast<size_t>(blockIdx.x) * num_rows;
+
+  double thread_sum = 0;
+  for (auto i = static_cast<size_type>(threadIdx.x); i < num_rows; i += stats_block_size) {
+    thread_sum += col_data[i];
+  }
+  auto const col_sum = block_reduce(temp_storage).Sum(thread_sum);
+  if (threadIdx.x == 0) { block_mean = col_sum / num_rows; }
+  __syncthreads();
+
+  double thread_ssd = 0;
+  for (auto i = static_cast<size_type>(threadIdx.x); i < num_rows; i += stats_block_size) {
+    auto const dev = col_data[i] - block_mean;
+    thread_ssd += dev * dev;
+  }
+  __syncthreads();  // all threads are done reading temp_storage before it is reused
+  auto const col_ssd = block_reduce(temp_storage).Sum(thread_ssd);
+  if (threadIdx.x == 0) {
+    means[blockIdx.x]     = block_mean;
+    inv_norms[blockIdx.x] = rsqrt(col_ssd);
+  }
+}
+
+/**
+ * @brief Standardizes the working matrix in place
+ */
+CUDF_KERNEL void standardize_kernel(double* data,
+                                    int64_t num_elements,
+                                    size_type num_rows,
+                                    double const* means,
+                                    double const* inv_norms)
+{
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto idx = cudf::detail::grid_1d::global_thread_id(); idx < num_elements; idx += stride) {
+    auto const col = idx / num_rows;
+    data[idx]      = (data[idx] - means[col]) * inv_norms[col];
+  }
+}
+
+/**
+ * @brief Computes all pairwise dot products of the standardized columns
+ *
+ * Classic tiled matrix-multiply of `Z^T * Z`: each block produces one `tile_dim x tile_dim`
+ * output tile, staging row chunks of the two column tiles through shared memory so every loaded
+ * value is reused `tile_dim` times.
+ */
+CUDF_KERNEL void correlation_tile_kernel(double const* z,
+                                         size_type num_rows,
+                                         size_type num_cols,
+                                         double* out)
+{
+  __shared__ double lhs_tile[tile_dim][tile_dim + 1];
+  __shared__ double rhs_tile[tile_dim][tile_dim + 1];
+
+  auto const out_row = static_cast<size_type>(blockIdx.y * tile_dim + threadIdx.y);
+  auto const out_col = static_cast<size_type>(blockIdx.x * tile_dim + threadIdx.x);
+
+  double acc = 0;
+  for (size_type chunk = 0; chunk < num_rows; chunk += tile_dim) {
+    auto const lhs_col = static_cast<size_type>(blockIdx.y * tile_dim + threadIdx.y);
+    auto const lhs_row = chunk + static_cast<size_type>(threadIdx.x);
+    lhs_tile[threadIdx.y][threadIdx.x] =
+      (lhs_col < num_cols and lhs_row < num_rows)
+        ? z[static_cast<size_t>(lhs_col) * num_rows + lhs_row]
+        : 0;
+
+    auto const rhs_col = static_cast<size_type>(blockIdx.x * tile_dim + threadIdx.x);
+    auto const rhs_row = chunk + static_cast<size_type>(threadIdx.y);
+    rhs_tile[threadIdx.y][threadIdx.x] =
+      (rhs_col < num_cols and rhs_row < num_rows)
+        ? z[static_cast<size_t>(rhs_col) * num_rows + rhs_row]
+        : 0;
+    __syncthreads();
+
+    for (int k = 0; k < tile_dim; ++k) {
+      acc += lhs_tile[threadIdx.y][k] * rhs_tile[k][threadIdx.x];
+    }
+    __syncthreads();
+  }
+
+  if (out_row < num_cols and out_col < num_cols) {
+    out[static_cast<size_t>(out_col) * num_cols + out_row] = acc;
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<table> correlation_matrix(table_view const& input,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  for (auto const& col : input) {
+    CUDF_EXPECTS(cudf::is_numeric(col.type()) and col.type().id() != type_id::BOOL8,
+                 "correlation_matrix supports only non-bool numeric columns",
+                 cudf::data_type_error);
+    CUDF_EXPECTS(not col.has_nulls(), "correlation_matrix does not support null elements");
+  }
+
+  auto const num_cols = input.num_columns();
+  auto const num_rows = input.num_rows();
+  if (num_cols == 0) { return std::make_unique<table>(); }
+
+  auto const matrix_size = static_cast<size_t>(num_cols) * num_cols;
+  rmm::device_uvector<double> result(matrix_size, stream);
+
+  if (num_rows < 2) {
+    thrust::fill(rmm::exec_policy_nosync(stream),
+                 result.begin(),
+                 result.end(),
+                 cuda::std::numeric_limits<double>::quiet_NaN());
+  } else {
+    // Standardized copy of the input, stored column-major so each column is contiguous
+    rmm::device_uvector<double> standardized(static_cast<size_t>(num_cols) * num_rows, stream);
+    for (size_type c = 0; c < num_cols; ++c) {
+      auto const d_col = column_device_view::create(input.column(c), stream);
+      cudf::type_dispatcher(input.column(c).type(),
+                            cast_column_fn{},
+                            *d_col,
+                            standardized.data() + static_cast<size_t>(c) * num_rows,
+                            stream);
+    }
+
+    rmm::device_uvector<double> means(num_cols, stream);
+    rmm::device_uvector<double> inv_norms(num_cols, stream);
+    column_stats_kernel<<<num_cols, stats_block_size, 0, stream.value()>>>(
+      standardized.data(), num_rows, means.data(), inv_norms.data());
+
+    auto const num_elements = static_cast<int64_t>(num_cols) * num_rows;
+    auto const grid         = cudf::detail::grid_1d{num_elements, stats_block_size};
+    standardize_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      standardized.data(), num_elements, num_rows, means.data(), inv_norms.data());
+
+    auto const num_tiles = cudf::util::div_rounding_up_safe(num_cols, tile_dim);
+    correlation_tile_kernel<<<dim3(num_tiles, num_tiles),
+                              dim3(tile_dim, tile_dim),
+                              0,
+                              stream.value()>>>(
+      standardized.data(), num_rows, num_cols, result.data());
+  }
+  CUDF_CHECK_CUDA(stream.value());
+
+  std::vector<std::unique_ptr<column>> output_columns;
+  output_columns.reserve(num_cols);
+  for (size_type c = 0; c < num_cols; ++c) {
+    auto column_data = rmm::device_buffer{
+      result.data() + static_cast<size_t>(c) * num_cols, num_cols * sizeof(double), stream, mr};
+    output_columns.push_back(std::make_unique<column>(data_type{type_id::FLOAT64},
+                                                      num_cols,
+                                                      std::move(column_data),
+                                                      rmm::device_buffer{},
+                                                      0));
+  }
+  return std::make_unique<table>(std::move(output_columns));
+}
+
+}  // namespace detail
+}  // namespace reduction
+}  // namespace cudf
+
+namespace cudf {
+
+std::unique_ptr<table> correlation_matrix(table_view const& input,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::correlation_matrix(input, stream, mr);
+}
+
+}  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/sequence.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
@@ -37,6 +38,24 @@
 namespace cudf {
 namespace reduction {
 namespace detail {
+namespace {
+
+// Returns indices that order `col` ascending with nulls last, skipping the sort when the column
+// already has that order. Inputs arriving from sorted upstream operators (merges, sorted scans)
+// would otherwise be re-sorted on every quantile/median reduction.
+std::unique_ptr<column> ordered_indices(column_view const& col,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  if (cudf::detail::is_sorted(table_view{{col}}, {}, {null_order::AFTER}, stream)) {
+    auto init = numeric_scalar<size_type>(0, true, stream);
+    return cudf::detail::sequence(col.size(), init, stream, mr);
+  }
+  return cudf::detail::sorted_order(table_view{{col}}, {}, {null_order::AFTER}, stream, mr);
+}
+
+}  // namespace
+
 struct reduce_dispatch_functor {
   column_view const col;
   data_type output_dtype;
@@ -77,8 +96,7 @@ struct reduce_dispatch_functor {
       }
       case aggregation::MEDIAN: {
         auto current_mr     = cudf::get_current_device_resource_ref();
-        auto sorted_indices = cudf::detail::sorted_order(
-          table_view{{col}}, {}, {null_order::AFTER}, stream, current_mr);
+        auto sorted_indices = ordered_indices(col, stream, current_mr);
         auto valid_sorted_indices =
           cudf::detail::split(*sorted_indices, {col.size() - col.null_count()}, stream)[0];
         auto col_ptr = cudf::detail::quantile(
@@ -90,8 +108,7 @@ struct reduce_dispatch_functor {
         CUDF_EXPECTS(quantile_agg._quantiles.size() == 1,
                      "Reduction quantile accepts only one quantile value");
         auto current_mr     = cudf::get_current_device_resource_ref();
-        auto sorted_indices = cudf::detail::sorted_order(
-          table_view{{col}}, {}, {null_order::AFTER}, stream, current_mr);
+        auto sorted_indices = ordered_indices(col, stream, current_mr);
         auto valid_sorted_indices =
           cudf::detail::split(*sorted_indices, {col.size() - col.null_count()}, stream)[0];
 
@@ -215,6 +232,16 @@ std::unique_ptr<scalar> reduce(column_view const& col,
   return reduction::detail::reduce(col, agg, output_dtype, std::nullopt, stream, mr);
 }
 
+stream_future<std::unique_ptr<scalar>> reduce_async(column_view const& col,
+                                                    reduce_aggregation const& agg,
+                                                    data_type output_dtype,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return {reduction::detail::reduce(col, agg, output_dtype, std::nullopt, stream, mr), stream};
+}
+
 std::unique_ptr<scalar> reduce(column_view const& col,
                                reduce_aggregation const& agg,
                                data_type output_dtype,
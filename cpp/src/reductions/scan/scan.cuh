@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/reduction.hpp>
@@ -25,6 +26,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/tuple.h>
+
 #include <utility>
 
 namespace cudf {
@@ -42,6 +45,49 @@ std::unique_ptr<column> exponentially_weighted_moving_average(column_view const&
                                                               rmm::cuda_stream_view stream,
                                                               rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Produces the (value, valid) pairs consumed by the fused null-aware scans
+ *
+ * Null rows contribute the operator identity and a zero valid count, so a single pair scan
+ * yields both the scanned values and the running count of valid rows.
+ */
+template <typename T>
+struct null_identity_pair_fn {
+  column_device_view col;
+  T identity;
+  __device__ thrust::tuple<T, size_type> operator()(size_type i) const
+  {
+    auto const valid = col.is_valid_nocheck(i);
+    return thrust::make_tuple(valid ? col.element<T>(i) : identity, static_cast<size_type>(valid));
+  }
+};
+
+/**
+ * @brief Combines (value, valid-count) pairs for the fused null-aware scans
+ */
+template <typename Op, typename T>
+struct pair_scan_op {
+  __device__ thrust::tuple<T, size_type> operator()(thrust::tuple<T, size_type> const& lhs,
+                                                    thrust::tuple<T, size_type> const& rhs) const
+  {
+    return thrust::make_tuple(static_cast<T>(Op{}(thrust::get<0>(lhs), thrust::get<0>(rhs))),
+                              thrust::get<1>(lhs) + thrust::get<1>(rhs));
+  }
+};
+
+/**
+ * @brief Returns true for rows whose running valid count shows no nulls in the scanned prefix
+ *
+ * Matches the null_policy::INCLUDE mask produced by `mask_scan`: a row is valid while every row
+ * feeding its result was valid. @p offset is 1 for inclusive scans (the row itself participates)
+ * and 0 for exclusive scans.
+ */
+struct no_preceding_nulls_fn {
+  size_type const* running_valid_counts;
+  size_type offset;
+  __device__ bool operator()(size_type i) const { return running_valid_counts[i] == i + offset; }
+};
+
 template <template <typename> typename DispatchFn>
 std::unique_ptr<column> scan_agg_dispatch(column_view const& input,
                                           scan_aggregation const& agg,
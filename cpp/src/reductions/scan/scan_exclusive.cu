@@ -22,13 +22,17 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cast_functor.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/null_mask.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <cuda/functional>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
 #include <thrust/scan.h>
 
 namespace cudf {
@@ -84,6 +88,71 @@ struct scan_dispatcher {
   }
 };
 
+/**
+ * @brief Dispatcher for the fused null-aware exclusive scan
+ *
+ * Scans (value, running valid-count) pairs in a single pass and derives the null_policy::INCLUDE
+ * output mask from the counts, instead of running the separate `mask_scan` launches over the
+ * input null mask.
+ *
+ * @tparam Op device binary operator (e.g. min, max, sum)
+ */
+template <typename Op>
+struct pair_scan_dispatcher {
+ public:
+  template <typename T, std::enable_if_t<cuda::std::is_arithmetic_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     bitmask_type const*,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    auto output_column =
+      detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, stream, mr);
+    mutable_column_view output = output_column->mutable_view();
+
+    auto d_input              = column_device_view::create(input, stream);
+    auto identity             = Op::template identity<T>();
+    auto running_valid_counts = rmm::device_uvector<size_type>(input.size(), stream);
+    auto const begin =
+      make_counting_transform_iterator(0, null_identity_pair_fn<T>{*d_input, identity});
+    auto const out =
+      thrust::make_zip_iterator(thrust::make_tuple(output.data<T>(), running_valid_counts.begin()));
+
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           begin,
+                           begin + input.size(),
+                           out,
+                           thrust::make_tuple(identity, size_type{0}),
+                           pair_scan_op<Op, T>{});
+
+    auto [mask, null_count] =
+      detail::valid_if(thrust::counting_iterator<size_type>(0),
+                       thrust::counting_iterator<size_type>(input.size()),
+                       no_preceding_nulls_fn{running_valid_counts.data(), 0},
+                       stream,
+                       mr);
+    output_column->set_null_mask(std::move(mask), null_count);
+
+    CUDF_CHECK_CUDA(stream.value());
+    return output_column;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cuda::std::is_arithmetic_v<T>, std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for fused exclusive scan");
+  }
+};
+
+bool is_fused_pair_scan(column_view const& input,
+                        scan_aggregation const& agg,
+                        null_policy null_handling)
+{
+  auto const fused_kind = agg.kind == aggregation::SUM || agg.kind == aggregation::MIN ||
+                          agg.kind == aggregation::MAX || agg.kind == aggregation::PRODUCT;
+  return fused_kind && null_handling == null_policy::INCLUDE && input.nullable();
+}
+
 }  // namespace
 
 std::unique_ptr<column> scan_exclusive(column_view const& input,
@@ -92,6 +161,12 @@ std::unique_ptr<column> scan_exclusive(column_view const& input,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
 {
+  // Nullable columns under INCLUDE can compute the values and the output null mask in one fused
+  // pass over (value, valid-count) pairs.
+  if (is_fused_pair_scan(input, agg, null_handling)) {
+    return scan_agg_dispatch<pair_scan_dispatcher>(input, agg, nullptr, stream, mr);
+  }
+
   auto [mask, null_count] = [&] {
     if (null_handling == null_policy::EXCLUDE) {
       return std::make_pair(std::move(detail::copy_bitmask(input, stream, mr)), input.null_count());
@@ -28,6 +28,7 @@
 #include <cudf/detail/replace.hpp>
 #include <cudf/detail/replace/nulls.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/detail/replace.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/null_mask.hpp>
@@ -44,6 +45,7 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/functional.h>
@@ -274,43 +276,82 @@ std::unique_ptr<cudf::column> replace_nulls_scalar_kernel_forwarder::operator()<
 }
 
 /**
- * @brief Function used by replace_nulls policy
+ * @brief Functor used by replace_nulls policy
+ *
+ * Fixed-width columns are filled in a single scan pass: the scan propagates the nearest valid
+ * value directly into the output data, so no gather map is materialized and no gather kernel
+ * runs. Other types build a gather map with the same scan and gather from the input.
  */
+struct replace_nulls_policy_kernel_forwarder {
+  template <typename col_type, std::enable_if_t<cudf::is_fixed_width<col_type>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           cudf::replace_policy const& replace_policy,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+  {
+    auto device_in = cudf::column_device_view::create(input, stream);
+    auto valid_it  = cudf::detail::make_validity_iterator(*device_in);
+    auto in_begin = thrust::make_zip_iterator(thrust::make_tuple(input.data<col_type>(), valid_it));
+
+    rmm::device_buffer output_data(input.size() * sizeof(col_type), stream, mr);
+    rmm::device_uvector<bool> output_valid(input.size(), stream);
+    auto out_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(static_cast<col_type*>(output_data.data()), output_valid.begin()));
+
+    auto func = cudf::detail::replace_policy_functor();
+    if (replace_policy == cudf::replace_policy::PRECEDING) {
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream), in_begin, in_begin + input.size(), out_begin, func);
+    } else {
+      auto in_rbegin  = thrust::make_reverse_iterator(in_begin + input.size());
+      auto out_rbegin = thrust::make_reverse_iterator(out_begin + input.size());
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream), in_rbegin, in_rbegin + input.size(), out_rbegin, func);
+    }
 
-std::unique_ptr<cudf::column> replace_nulls_policy_impl(cudf::column_view const& input,
-                                                        cudf::replace_policy const& replace_policy,
-                                                        rmm::cuda_stream_view stream,
-                                                        rmm::device_async_resource_ref mr)
-{
-  auto device_in = cudf::column_device_view::create(input, stream);
-  auto index     = thrust::make_counting_iterator<cudf::size_type>(0);
-  auto valid_it  = cudf::detail::make_validity_iterator(*device_in);
-  auto in_begin  = thrust::make_zip_iterator(thrust::make_tuple(index, valid_it));
-
-  rmm::device_uvector<cudf::size_type> gather_map(input.size(), stream);
-  auto gm_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(gather_map.begin(), thrust::make_discard_iterator()));
-
-  auto func = cudf::detail::replace_policy_functor();
-  if (replace_policy == cudf::replace_policy::PRECEDING) {
-    thrust::inclusive_scan(
-      rmm::exec_policy(stream), in_begin, in_begin + input.size(), gm_begin, func);
-  } else {
-    auto in_rbegin = thrust::make_reverse_iterator(in_begin + input.size());
-    auto gm_rbegin = thrust::make_reverse_iterator(gm_begin + gather_map.size());
-    thrust::inclusive_scan(
-      rmm::exec_policy(stream), in_rbegin, in_rbegin + input.size(), gm_rbegin, func);
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      output_valid.begin(), output_valid.end(), thrust::identity{}, stream, mr);
+
+    return std::make_unique<cudf::column>(
+      input.type(), input.size(), std::move(output_data), std::move(null_mask), null_count);
   }
 
-  auto output = cudf::detail::gather(cudf::table_view({input}),
-                                     gather_map,
-                                     cudf::out_of_bounds_policy::DONT_CHECK,
-                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                     stream,
-                                     mr);
+  template <typename col_type, std::enable_if_t<not cudf::is_fixed_width<col_type>()>* = nullptr>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           cudf::replace_policy const& replace_policy,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+  {
+    auto device_in = cudf::column_device_view::create(input, stream);
+    auto index     = thrust::make_counting_iterator<cudf::size_type>(0);
+    auto valid_it  = cudf::detail::make_validity_iterator(*device_in);
+    auto in_begin  = thrust::make_zip_iterator(thrust::make_tuple(index, valid_it));
+
+    rmm::device_uvector<cudf::size_type> gather_map(input.size(), stream);
+    auto gm_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(gather_map.begin(), thrust::make_discard_iterator()));
+
+    auto func = cudf::detail::replace_policy_functor();
+    if (replace_policy == cudf::replace_policy::PRECEDING) {
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream), in_begin, in_begin + input.size(), gm_begin, func);
+    } else {
+      auto in_rbegin = thrust::make_reverse_iterator(in_begin + input.size());
+      auto gm_rbegin = thrust::make_reverse_iterator(gm_begin + gather_map.size());
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream), in_rbegin, in_rbegin + input.size(), gm_rbegin, func);
+    }
+
+    auto output = cudf::detail::gather(cudf::table_view({input}),
+                                       gather_map,
+                                       cudf::out_of_bounds_policy::DONT_CHECK,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr);
 
-  return std::move(output->release()[0]);
-}
+    return std::move(output->release()[0]);
+  }
+};
 
 }  // end anonymous namespace
 
@@ -355,7 +396,8 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   if (input.is_empty()) { return cudf::empty_like(input); }
   if (!input.has_nulls()) { return std::make_unique<cudf::column>(input, stream, mr); }
 
-  return replace_nulls_policy_impl(input, replace_policy, stream, mr);
+  return cudf::type_dispatcher<dispatch_storage_type>(
+    input.type(), replace_nulls_policy_kernel_forwarder{}, input, replace_policy, stream, mr);
 }
 
 }  // namespace detail
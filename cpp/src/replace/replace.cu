@@ -38,6 +38,8 @@
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/device_scalar.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
@@ -47,6 +49,8 @@
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/strings/detail/replace.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -55,6 +59,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
@@ -65,7 +70,8 @@ namespace {  // anonymous
 static constexpr int BLOCK_SIZE = 256;
 
 // return the new_value for output column at index `idx`
-template <class T, bool replacement_has_nulls>
+// `values_are_sorted` selects a binary search over values that a `replacement_map` pre-sorted
+template <class T, bool replacement_has_nulls, bool values_are_sorted>
 __device__ auto get_new_value(cudf::size_type idx,
                               T const* __restrict__ input_data,
                               T const* __restrict__ values_to_replace_begin,
@@ -73,8 +79,17 @@ __device__ auto get_new_value(cudf::size_type idx,
                               T const* __restrict__ d_replacement_values,
                               cudf::bitmask_type const* __restrict__ replacement_valid)
 {
-  auto found_ptr =
-    thrust::find(thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+  auto found_ptr = [&] {
+    if constexpr (values_are_sorted) {
+      auto it = thrust::lower_bound(
+        thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+      return (it != values_to_replace_end and *it == input_data[idx]) ? it
+                                                                      : values_to_replace_end;
+    } else {
+      return thrust::find(
+        thrust::seq, values_to_replace_begin, values_to_replace_end, input_data[idx]);
+    }
+  }();
   T new_value{};
   bool output_is_valid{true};
 
@@ -98,6 +113,8 @@ __device__ auto get_new_value(cudf::size_type idx,
  * otherwise The input_has_nulls and replacement_has_nulls template parameters allows us to
  * specialize this kernel for the different scenario for performance without writing different
  * kernel.
+ * @tparam values_are_sorted `true` if `values_to_replace` is sorted ascending, enabling a binary
+ * search instead of a linear scan
  *
  * @param[in] input_data Device array with the data to be modified
  * @param[in] input_valid Valid mask associated with input_data
@@ -112,7 +129,7 @@ __device__ auto get_new_value(cudf::size_type idx,
  * @param[in] d_replacement_values Device array with the new values
  * @param[in] replacement_valid Valid mask associated with d_replacement_values
  */
-template <class T, bool input_has_nulls, bool replacement_has_nulls>
+template <class T, bool input_has_nulls, bool replacement_has_nulls, bool values_are_sorted>
 CUDF_KERNEL void replace_kernel(cudf::column_device_view input,
                                 cudf::mutable_column_device_view output,
                                 cudf::size_type* __restrict__ output_valid_count,
@@ -139,7 +156,8 @@ CUDF_KERNEL void replace_kernel(cudf::column_device_view input,
       output_is_valid = input_is_valid;
     }
     if (input_is_valid)
-      thrust::tie(output_data[idx], output_is_valid) = get_new_value<T, replacement_has_nulls>(
+      thrust::tie(output_data[idx], output_is_valid) =
+        get_new_value<T, replacement_has_nulls, values_are_sorted>(
         idx,
         input.data<T>(),
         values_to_replace.data<T>(),
@@ -175,6 +193,9 @@ CUDF_KERNEL void replace_kernel(cudf::column_device_view input,
  *        `replace_kernel` with the appropriate data types.
  */
 struct replace_kernel_forwarder {
+  // `true` if `values_to_replace` is sorted ascending, as built by `cudf::replacement_map`
+  bool values_are_sorted = false;
+
   template <typename col_type, std::enable_if_t<cudf::is_fixed_width<col_type>()>* = nullptr>
   std::unique_ptr<cudf::column> operator()(cudf::column_view const& input_col,
                                            cudf::column_view const& values_to_replace,
@@ -186,12 +207,15 @@ struct replace_kernel_forwarder {
     cudf::size_type* valid_count = valid_counter.data();
 
     auto replace = [&] {
-      if (input_col.has_nulls())
-        return replacement_values.has_nulls() ? replace_kernel<col_type, true, true>
-                                              : replace_kernel<col_type, true, false>;
-      else
-        return replacement_values.has_nulls() ? replace_kernel<col_type, false, true>
-                                              : replace_kernel<col_type, false, false>;
+      auto const select = [&](auto sorted) {
+        if (input_col.has_nulls())
+          return replacement_values.has_nulls() ? replace_kernel<col_type, true, true, sorted()>
+                                                : replace_kernel<col_type, true, false, sorted()>;
+        else
+          return replacement_values.has_nulls() ? replace_kernel<col_type, false, true, sorted()>
+                                                : replace_kernel<col_type, false, false, sorted()>;
+      };
+      return values_are_sorted ? select(std::true_type{}) : select(std::false_type{});
     }();
 
     auto output = [&] {
@@ -323,6 +347,31 @@ std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& inpu
                                                       mr);
 }
 
+std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& input_col,
+                                                   cudf::replacement_map const& replacement,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  auto const values_to_replace  = replacement.values_to_replace();
+  auto const replacement_values = replacement.replacement_values();
+
+  CUDF_EXPECTS(cudf::have_same_types(input_col, values_to_replace),
+               "Columns type mismatch",
+               cudf::data_type_error);
+
+  if (input_col.is_empty() or values_to_replace.is_empty()) {
+    return std::make_unique<cudf::column>(input_col, stream, mr);
+  }
+
+  return cudf::type_dispatcher<dispatch_storage_type>(input_col.type(),
+                                                      replace_kernel_forwarder{true},
+                                                      input_col,
+                                                      values_to_replace,
+                                                      replacement_values,
+                                                      stream,
+                                                      mr);
+}
+
 }  // namespace detail
 
 /**
@@ -344,4 +393,48 @@ std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& inpu
 {
   return detail::find_and_replace_all(input_col, values_to_replace, replacement_values, stream, mr);
 }
+
+replacement_map::replacement_map(cudf::column_view const& values_to_replace,
+                                 cudf::column_view const& replacement_values,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(values_to_replace.size() == replacement_values.size(),
+               "values_to_replace and replacement_values size mismatch.");
+  CUDF_EXPECTS(cudf::have_same_types(values_to_replace, replacement_values),
+               "Columns type mismatch",
+               cudf::data_type_error);
+  CUDF_EXPECTS(not values_to_replace.has_nulls(), "values_to_replace must not have nulls");
+
+  // Sort the old values once so that lookups can binary search instead of scanning linearly
+  auto const map_view = cudf::table_view({values_to_replace, replacement_values});
+  auto const order    = cudf::detail::sorted_order(cudf::table_view({values_to_replace}),
+                                                {},
+                                                {},
+                                                stream,
+                                                cudf::get_current_device_resource_ref());
+  auto sorted         = cudf::detail::gather(map_view,
+                                     order->view(),
+                                     cudf::out_of_bounds_policy::DONT_CHECK,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     stream,
+                                     mr);
+  auto columns        = sorted->release();
+  _values_to_replace  = std::move(columns.front());
+  _replacement_values = std::move(columns.back());
+}
+
+replacement_map::~replacement_map() = default;
+
+column_view replacement_map::values_to_replace() const { return _values_to_replace->view(); }
+
+column_view replacement_map::replacement_values() const { return _replacement_values->view(); }
+
+std::unique_ptr<cudf::column> find_and_replace_all(cudf::column_view const& input_col,
+                                                   replacement_map const& replacement,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  return detail::find_and_replace_all(input_col, replacement, stream, mr);
+}
 }  // namespace cudf
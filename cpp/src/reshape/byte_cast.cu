@@ -19,17 +19,23 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
+#include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -165,6 +171,32 @@ struct byte_list_conversion_fn<T, std::enable_if_t<std::is_same_v<T, cudf::strin
   }
 };
 
+/**
+ * @brief Copies the bytes of several numeric columns in one grid-stride launch
+ *
+ * Each task is one column's byte copy; `byte_offsets` holds the exclusive scan of the
+ * per-task byte counts, so a thread locates its task with an upper_bound on its global
+ * byte index. `element_masks` holds `sizeof(element) - 1` for tasks that flip
+ * endianness and 0 for straight copies.
+ */
+CUDF_KERNEL void batched_byte_cast_kernel(device_span<char const* const> inputs,
+                                          device_span<char* const> outputs,
+                                          device_span<size_type const> element_masks,
+                                          device_span<std::size_t const> byte_offsets,
+                                          thread_index_type total_bytes)
+{
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto i = cudf::detail::grid_1d::global_thread_id(); i < total_bytes; i += stride) {
+    auto const task =
+      thrust::upper_bound(
+        thrust::seq, byte_offsets.begin(), byte_offsets.end(), static_cast<std::size_t>(i)) -
+      byte_offsets.begin() - 1;
+    auto const index = static_cast<size_type>(static_cast<std::size_t>(i) - byte_offsets[task]);
+    auto const mask  = element_masks[task];
+    outputs[task][index] = inputs[task][index + mask - ((index & mask) << 1)];
+  }
+}
+
 }  // namespace
 
 std::unique_ptr<column> byte_cast(column_view const& input,
@@ -176,6 +208,79 @@ std::unique_ptr<column> byte_cast(column_view const& input,
     input.type(), byte_list_conversion_dispatcher{}, input, endian_configuration, stream, mr);
 }
 
+std::unique_ptr<table> byte_cast(table_view const& input,
+                                 flip_endianness endian_configuration,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  auto results = std::vector<std::unique_ptr<column>>(input.num_columns());
+
+  // Batch the byte copies of the numeric columns into a single launch; strings and the
+  // empty/all-null edge cases keep the single-column path.
+  std::vector<size_type> task_columns;
+  std::vector<std::unique_ptr<column>> byte_columns;
+  auto h_inputs  = cudf::detail::make_empty_host_vector<char const*>(input.num_columns(), stream);
+  auto h_outputs = cudf::detail::make_empty_host_vector<char*>(input.num_columns(), stream);
+  auto h_masks   = cudf::detail::make_empty_host_vector<size_type>(input.num_columns(), stream);
+  std::vector<std::size_t> h_offsets{0};
+
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const col = input.column(i);
+    if (not cudf::is_numeric(col.type()) or col.size() == 0 or col.size() == col.null_count()) {
+      results[i] = byte_cast(col, endian_configuration, stream, mr);
+      continue;
+    }
+    auto const element_size = static_cast<std::size_t>(cudf::size_of(col.type()));
+    auto const num_bytes    = static_cast<std::size_t>(col.size()) * element_size;
+    auto bytes              = make_numeric_column(
+      output_type, static_cast<size_type>(num_bytes), mask_state::UNALLOCATED, stream, mr);
+    h_inputs.push_back(col.head<char>() + static_cast<std::size_t>(col.offset()) * element_size);
+    h_outputs.push_back(bytes->mutable_view().data<char>());
+    h_masks.push_back(endian_configuration == flip_endianness::YES
+                        ? static_cast<size_type>(element_size) - 1
+                        : 0);
+    h_offsets.push_back(h_offsets.back() + num_bytes);
+    task_columns.push_back(i);
+    byte_columns.push_back(std::move(bytes));
+  }
+
+  if (not task_columns.empty()) {
+    auto const d_inputs  = cudf::detail::make_device_uvector_async(h_inputs, stream, mr);
+    auto const d_outputs = cudf::detail::make_device_uvector_async(h_outputs, stream, mr);
+    auto const d_masks   = cudf::detail::make_device_uvector_async(h_masks, stream, mr);
+    auto const d_offsets = cudf::detail::make_device_uvector_async(
+      host_span<std::size_t const>{h_offsets}, stream, mr);
+
+    auto const total_bytes         = h_offsets.back();
+    constexpr size_type block_size = 256;
+    auto const grid = cudf::detail::grid_1d{static_cast<thread_index_type>(total_bytes), block_size};
+    batched_byte_cast_kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+      d_inputs, d_outputs, d_masks, d_offsets, static_cast<thread_index_type>(total_bytes));
+    CUDF_CHECK_CUDA(stream.value());
+  }
+
+  for (std::size_t t = 0; t < task_columns.size(); ++t) {
+    auto const col = input.column(task_columns[t]);
+    auto const it  = thrust::make_constant_iterator(cudf::size_of(col.type()));
+    auto offsets_column =
+      std::get<0>(cudf::detail::make_offsets_child_column(it, it + col.size(), stream, mr));
+    auto result = make_lists_column(col.size(),
+                                    std::move(offsets_column),
+                                    std::move(byte_columns[t]),
+                                    col.null_count(),
+                                    detail::copy_bitmask(col, stream, mr),
+                                    stream,
+                                    mr);
+    if (auto const result_cv = result->view();
+        cudf::detail::has_nonempty_nulls(result_cv, stream)) {
+      result = cudf::detail::purge_nonempty_nulls(result_cv, stream, mr);
+    }
+    results[task_columns[t]] = std::move(result);
+  }
+
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> byte_cast(column_view const& input,
@@ -187,4 +292,13 @@ std::unique_ptr<column> byte_cast(column_view const& input,
   return detail::byte_cast(input, endian_configuration, stream, mr);
 }
 
+std::unique_ptr<table> byte_cast(table_view const& input,
+                                 flip_endianness endian_configuration,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::byte_cast(input, endian_configuration, stream, mr);
+}
+
 }  // namespace cudf
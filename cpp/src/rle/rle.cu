@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stream_compaction/stream_compaction_common.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/rle/rle.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <utility>
+
+namespace cudf {
+namespace rle {
+namespace {
+
+/**
+ * @brief Checks the invariants of an RLE column's run ends against its values
+ */
+void check_rle_input(column_view const& run_ends, column_view const& values)
+{
+  CUDF_EXPECTS(run_ends.type() == data_type{type_id::INT32},
+               "Run ends must be of type INT32",
+               cudf::data_type_error);
+  CUDF_EXPECTS(not run_ends.has_nulls(), "Run ends must not contain nulls");
+  CUDF_EXPECTS(run_ends.size() == values.size(),
+               "Run ends and values must contain one element per run");
+}
+
+/**
+ * @brief Gathers run values for the decoded row indices in `[map_begin, map_begin + map_size)`
+ *
+ * Maps each decoded row index to its run with a binary search over the cumulative run ends,
+ * then gathers the matching run values.
+ */
+template <typename MapIterator>
+std::unique_ptr<column> gather_runs(column_view const& run_ends,
+                                    column_view const& values,
+                                    MapIterator map_begin,
+                                    size_type map_size,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto run_indices = rmm::device_uvector<size_type>(map_size, stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      run_ends.begin<size_type>(),
+                      run_ends.end<size_type>(),
+                      map_begin,
+                      map_begin + map_size,
+                      run_indices.begin());
+
+  auto result = cudf::detail::gather(table_view{{values}},
+                                     device_span<size_type const>{run_indices},
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     stream,
+                                     mr);
+  return std::move(result->release().front());
+}
+
+}  // namespace
+
+rle_column encode(column_view const& input,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto const num_rows = input.size();
+  if (num_rows == 0) {
+    return rle_column{
+      make_numeric_column(data_type{type_id::INT32}, 0, mask_state::UNALLOCATED, stream, mr),
+      empty_like(input)};
+  }
+
+  auto const input_table = table_view{{input}};
+  auto run_starts        = rmm::device_uvector<size_type>(num_rows, stream);
+
+  // A run starts wherever a row differs from its predecessor, with nulls comparing equal so
+  // consecutive null rows collapse into one run. This is the same consecutive-duplicate removal
+  // that cudf::unique performs, reusing its copy helpers.
+  auto comp = cudf::experimental::row::equality::self_comparator(input_table, stream);
+
+  size_type const num_runs = [&] {
+    auto const itr = thrust::make_counting_iterator<size_type>(0);
+    if (cudf::detail::has_nested_columns(input_table)) {
+      auto row_equal =
+        comp.equal_to<true>(nullate::DYNAMIC{has_nested_nulls(input_table)}, null_equality::EQUAL);
+      auto result_end = cudf::detail::unique_copy(itr,
+                                                  itr + num_rows,
+                                                  run_starts.begin(),
+                                                  row_equal,
+                                                  duplicate_keep_option::KEEP_FIRST,
+                                                  stream);
+      return static_cast<size_type>(thrust::distance(run_starts.begin(), result_end));
+    } else {
+      auto row_equal =
+        comp.equal_to<false>(nullate::DYNAMIC{has_nested_nulls(input_table)}, null_equality::EQUAL);
+      auto result_end = cudf::detail::unique_copy(itr,
+                                                  itr + num_rows,
+                                                  run_starts.begin(),
+                                                  row_equal,
+                                                  duplicate_keep_option::KEEP_FIRST,
+                                                  stream);
+      return static_cast<size_type>(thrust::distance(run_starts.begin(), result_end));
+    }
+  }();
+
+  auto values = [&] {
+    auto gathered =
+      cudf::detail::gather(input_table,
+                           device_span<size_type const>{run_starts.data(),
+                                                        static_cast<std::size_t>(num_runs)},
+                           out_of_bounds_policy::DONT_CHECK,
+                           cudf::detail::negative_index_policy::NOT_ALLOWED,
+                           stream,
+                           mr);
+    return std::move(gathered->release().front());
+  }();
+
+  // Each run ends where the next one starts; the last run ends at the decoded row count
+  auto run_ends = make_numeric_column(
+    data_type{type_id::INT32}, num_runs, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_runs),
+                    run_ends->mutable_view().begin<size_type>(),
+                    [starts = run_starts.data(), num_runs, num_rows] __device__(size_type i) {
+                      return i + 1 < num_runs ? starts[i + 1] : num_rows;
+                    });
+
+  return rle_column{std::move(run_ends), std::move(values)};
+}
+
+std::unique_ptr<column> decode(column_view const& run_ends,
+                               column_view const& values,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  check_rle_input(run_ends, values);
+
+  if (run_ends.is_empty()) { return empty_like(values); }
+
+  auto const num_rows =
+    cudf::detail::get_value<size_type>(run_ends, run_ends.size() - 1, stream);
+  return gather_runs(
+    run_ends, values, thrust::make_counting_iterator<size_type>(0), num_rows, stream, mr);
+}
+
+std::unique_ptr<column> gather(column_view const& run_ends,
+                               column_view const& values,
+                               column_view const& gather_map,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  check_rle_input(run_ends, values);
+  CUDF_EXPECTS(cudf::is_index_type(gather_map.type()),
+               "Gather map must be of an index type",
+               cudf::data_type_error);
+  CUDF_EXPECTS(not gather_map.has_nulls(), "Gather map must not contain nulls");
+
+  if (gather_map.is_empty()) { return empty_like(values); }
+
+  auto const map_begin = cudf::detail::indexalator_factory::make_input_iterator(gather_map);
+  return gather_runs(run_ends, values, map_begin, gather_map.size(), stream, mr);
+}
+
+}  // namespace rle
+}  // namespace cudf
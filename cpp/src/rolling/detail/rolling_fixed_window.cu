@@ -15,6 +15,7 @@
  */
 
 #include "rolling.cuh"
+#include "rolling_sliding_window.hpp"
 
 #include <cudf_test/column_utilities.hpp>
 
@@ -61,6 +62,12 @@ std::unique_ptr<column> rolling_window(column_view const& input,
                                             agg,
                                             stream,
                                             mr);
+  } else if (can_use_sliding_window(
+               input, default_outputs, preceding_window, following_window, agg)) {
+    // Wide fixed windows over non-nullable numeric columns can be evaluated in O(n)
+    // with sliding aggregates instead of O(n * window) with per-window loops.
+    return cudf::detail::sliding_rolling_window(
+      input, preceding_window, following_window, min_periods, agg, stream, mr);
   } else {
     // Clamp preceding/following to column boundaries.
     // E.g. If preceding_window == 2, then for a column of 5 elements, preceding_window will be:
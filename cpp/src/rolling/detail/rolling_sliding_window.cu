@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "rolling.hpp"
+#include "rolling_sliding_window.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cuda/std/limits>
+#include <cuda/std/utility>
+#include <thrust/extrema.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Minimum window width at which the sliding algorithms beat the generic path.
+ *
+ * The sliding path trades one read per window element for two or three full passes
+ * over the column, so it only pays off for windows wider than a few dozen rows.
+ */
+size_type constexpr sliding_window_width_threshold = 32;
+
+/**
+ * @brief Clamped window bounds `[start, end]` (inclusive) for output row `i`
+ */
+struct window_bounds_fn {
+  size_type num_rows;
+  size_type preceding;
+  size_type following;
+
+  __device__ cuda::std::pair<size_type, size_type> operator()(size_type i) const
+  {
+    auto const start = thrust::max(i - preceding + 1, 0);
+    auto const end   = thrust::min(i + following, num_rows - 1);
+    return {start, end};
+  }
+};
+
+template <typename T, typename AccumType>
+struct cast_fn {
+  __device__ AccumType operator()(T v) const { return static_cast<AccumType>(v); }
+};
+
+/**
+ * @brief Computes one windowed sum (or mean) as a difference of two prefix sums
+ */
+template <typename OutputType, typename AccumType, bool is_mean>
+struct windowed_sum_fn {
+  AccumType const* d_prefix;
+  window_bounds_fn bounds;
+
+  __device__ OutputType operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    auto const sum   = d_prefix[end] - (start > 0 ? d_prefix[start - 1] : AccumType{0});
+    auto const count = end - start + 1;
+    OutputType out{};
+    auto val = static_cast<OutputType>(sum);
+    rolling_store_output_functor<OutputType, is_mean>{}(out, val, count);
+    return out;
+  }
+};
+
+template <typename T>
+struct square_fn {
+  __device__ __int128_t operator()(T v) const
+  {
+    auto const x = static_cast<__int128_t>(v);
+    return x * x;
+  }
+};
+
+/**
+ * @brief Computes one windowed variance (or standard deviation) from exact prefix moments
+ *
+ * Only integral inputs narrow enough that the prefix sums of the values and their squares
+ * are exact in the wider accumulators reach this functor, so the window moment
+ * `n * sum(x^2) - sum(x)^2` carries no rounding error at all; only the final division
+ * rounds. This is at least as stable as the per-window Welford loop of the generic path,
+ * whose results it may differ from in the last few ulps.
+ */
+template <bool is_std>
+struct windowed_var_fn {
+  int64_t const* d_prefix_sum;
+  __int128_t const* d_prefix_sum_sq;
+  size_type ddof;
+  window_bounds_fn bounds;
+
+  __device__ double operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    auto const n            = end - start + 1;
+    // mirror the generic path: windows smaller than `ddof` produce NaN (a window of
+    // exactly `ddof` rows divides zero by zero below, which is also NaN)
+    if (n < ddof) { return cuda::std::numeric_limits<double>::signaling_NaN(); }
+    auto const sum = d_prefix_sum[end] - (start > 0 ? d_prefix_sum[start - 1] : int64_t{0});
+    auto const sum_sq =
+      d_prefix_sum_sq[end] - (start > 0 ? d_prefix_sum_sq[start - 1] : __int128_t{0});
+    auto const moment =
+      static_cast<__int128_t>(n) * sum_sq - static_cast<__int128_t>(sum) * sum;
+    auto const var =
+      static_cast<double>(moment) / (static_cast<double>(n) * static_cast<double>(n - ddof));
+    if constexpr (is_std) { return sqrt(var); }
+    return var;
+  }
+};
+
+/**
+ * @brief Computes one windowed min/max from per-tile running aggregates
+ *
+ * With tile width equal to the full window width, any clamped window spans at most
+ * two tiles: a window crossing a tile boundary is the suffix of one tile combined
+ * with the prefix of the next. A window contained in a single tile is clamped at
+ * the column boundary, where either the tile-prefix (window starts at a tile
+ * boundary) or the tile-suffix (window ends at the last row) covers it exactly.
+ */
+template <typename T, typename AggOp>
+struct windowed_minmax_fn {
+  T const* d_prefix;  ///< running aggregate within each tile, left to right
+  T const* d_suffix;  ///< running aggregate within each tile, right to left
+  size_type tile;
+  window_bounds_fn bounds;
+
+  __device__ T operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    auto const start_tile   = start / tile;
+    if (start_tile != end / tile) { return AggOp{}(d_suffix[start], d_prefix[end]); }
+    return (start == start_tile * tile) ? d_prefix[end] : d_suffix[start];
+  }
+};
+
+/**
+ * @brief Maps a row index to its tile for the segmented min/max scans
+ */
+struct tile_key_fn {
+  size_type tile;
+  __device__ size_type operator()(size_type i) const { return i / tile; }
+};
+
+struct count_at_least_fn {
+  window_bounds_fn bounds;
+  size_type min_periods;
+
+  __device__ bool operator()(size_type i) const
+  {
+    auto const [start, end] = bounds(i);
+    return (end - start + 1) >= min_periods;
+  }
+};
+
+/**
+ * @brief Attaches the validity mask implied by `min_periods` to `output`
+ *
+ * Matches the generic path, which always produces a nullable output column.
+ */
+void set_min_periods_mask(column& output,
+                          window_bounds_fn bounds,
+                          size_type min_periods,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr)
+{
+  auto [mask, null_count] = valid_if(thrust::make_counting_iterator<size_type>(0),
+                                     thrust::make_counting_iterator<size_type>(output.size()),
+                                     count_at_least_fn{bounds, min_periods},
+                                     stream,
+                                     mr);
+  output.set_null_mask(std::move(mask), null_count);
+}
+
+template <typename T, aggregation::Kind op>
+std::unique_ptr<column> sliding_sum(column_view const& input,
+                                    window_bounds_fn bounds,
+                                    size_type min_periods,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  using OutputType = target_type_t<T, op>;
+  // only integral inputs reach this path; they accumulate exactly in the wider sum type
+  using AccumType =
+    std::conditional_t<std::is_integral_v<T>, target_type_t<T, aggregation::SUM>, double>;
+
+  auto prefix  = rmm::device_uvector<AccumType>(input.size(), stream);
+  auto in_cast = thrust::make_transform_iterator(input.begin<T>(), cast_fn<T, AccumType>{});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), in_cast, in_cast + input.size(), prefix.begin());
+
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<OutputType>()}, input.size(), mask_state::UNALLOCATED, stream, mr);
+  auto out_view = output->mutable_view();
+  thrust::tabulate(rmm::exec_policy(stream),
+                   out_view.begin<OutputType>(),
+                   out_view.end<OutputType>(),
+                   windowed_sum_fn<OutputType, AccumType, op == aggregation::MEAN>{
+                     prefix.data(), bounds});
+
+  set_min_periods_mask(*output, bounds, min_periods, stream, mr);
+  return output;
+}
+
+template <typename T, bool is_std>
+std::unique_ptr<column> sliding_var(column_view const& input,
+                                    window_bounds_fn bounds,
+                                    size_type min_periods,
+                                    size_type ddof,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto prefix_sum    = rmm::device_uvector<int64_t>(input.size(), stream);
+  auto prefix_sum_sq = rmm::device_uvector<__int128_t>(input.size(), stream);
+
+  auto in_cast = thrust::make_transform_iterator(input.begin<T>(), cast_fn<T, int64_t>{});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), in_cast, in_cast + input.size(), prefix_sum.begin());
+  auto in_sq = thrust::make_transform_iterator(input.begin<T>(), square_fn<T>{});
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), in_sq, in_sq + input.size(), prefix_sum_sq.begin());
+
+  auto output = make_fixed_width_column(
+    data_type{type_id::FLOAT64}, input.size(), mask_state::UNALLOCATED, stream, mr);
+  auto out_view = output->mutable_view();
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    out_view.begin<double>(),
+    out_view.end<double>(),
+    windowed_var_fn<is_std>{prefix_sum.data(), prefix_sum_sq.data(), ddof, bounds});
+
+  set_min_periods_mask(*output, bounds, min_periods, stream, mr);
+  return output;
+}
+
+template <typename T, aggregation::Kind op>
+std::unique_ptr<column> sliding_min_max(column_view const& input,
+                                        window_bounds_fn bounds,
+                                        size_type min_periods,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  using AggOp = typename corresponding_operator<op>::type;
+
+  auto const num_rows = input.size();
+  auto const tile     = bounds.preceding + bounds.following;
+
+  auto prefix = rmm::device_uvector<T>(num_rows, stream);
+  auto suffix = rmm::device_uvector<T>(num_rows, stream);
+
+  auto fwd_keys =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0), tile_key_fn{tile});
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                fwd_keys,
+                                fwd_keys + num_rows,
+                                input.begin<T>(),
+                                prefix.begin(),
+                                thrust::equal_to<size_type>{},
+                                AggOp{});
+
+  // the suffix scan runs right-to-left; tiles are still numbered from the column start
+  auto rev_keys = thrust::make_reverse_iterator(fwd_keys + num_rows);
+  thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                rev_keys,
+                                rev_keys + num_rows,
+                                thrust::make_reverse_iterator(input.end<T>()),
+                                thrust::make_reverse_iterator(suffix.end()),
+                                thrust::equal_to<size_type>{},
+                                AggOp{});
+
+  auto output = make_fixed_width_column(
+    data_type{type_to_id<T>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto out_view = output->mutable_view();
+  thrust::tabulate(rmm::exec_policy(stream),
+                   out_view.begin<T>(),
+                   out_view.end<T>(),
+                   windowed_minmax_fn<T, AggOp>{prefix.data(), suffix.data(), tile, bounds});
+
+  set_min_periods_mask(*output, bounds, min_periods, stream, mr);
+  return output;
+}
+
+struct sliding_window_dispatch {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     window_bounds_fn bounds,
+                                     size_type min_periods,
+                                     rolling_aggregation const& agg,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    switch (agg.kind) {
+      case aggregation::SUM:
+        return sliding_sum<T, aggregation::SUM>(input, bounds, min_periods, stream, mr);
+      case aggregation::MEAN:
+        return sliding_sum<T, aggregation::MEAN>(input, bounds, min_periods, stream, mr);
+      case aggregation::MIN:
+        return sliding_min_max<T, aggregation::MIN>(input, bounds, min_periods, stream, mr);
+      case aggregation::MAX:
+        return sliding_min_max<T, aggregation::MAX>(input, bounds, min_periods, stream, mr);
+      case aggregation::VARIANCE:
+        return sliding_var<T, false>(
+          input,
+          bounds,
+          min_periods,
+          dynamic_cast<cudf::detail::std_var_aggregation const&>(agg)._ddof,
+          stream,
+          mr);
+      case aggregation::STD:
+        return sliding_var<T, true>(
+          input,
+          bounds,
+          min_periods,
+          dynamic_cast<cudf::detail::std_var_aggregation const&>(agg)._ddof,
+          stream,
+          mr);
+      default: CUDF_FAIL("Unsupported aggregation for the sliding window path");
+    }
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_numeric<T>())>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     window_bounds_fn,
+                                     size_type,
+                                     rolling_aggregation const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref)
+  {
+    CUDF_FAIL("Unsupported type for the sliding window path");
+  }
+};
+
+}  // namespace
+
+bool can_use_sliding_window(column_view const& input,
+                            column_view const& default_outputs,
+                            size_type preceding_window,
+                            size_type following_window,
+                            rolling_aggregation const& agg)
+{
+  // SUM/MEAN must produce bit-identical results to the per-window loop, which holds for
+  // integral accumulation (including overflow wrap) but not for floating-point inputs,
+  // where differencing prefix sums rounds differently than summing each window directly.
+  // MEAN of 8-byte integers is also excluded: the per-window loop accumulates in double
+  // and may round where the exact integral prefix sum would not.
+  auto const supported_agg = [&] {
+    switch (agg.kind) {
+      case aggregation::SUM: return cudf::is_integral(input.type());
+      case aggregation::MEAN:
+        return cudf::is_integral(input.type()) && cudf::size_of(input.type()) <= 4;
+      case aggregation::MIN:
+      case aggregation::MAX: return cudf::is_numeric(input.type());
+      case aggregation::VARIANCE:
+      case aggregation::STD:
+        // the prefix sums of the values and their squares must be exact for the window
+        // moment to be exact; up to 4-byte integral inputs keep both within the wider
+        // accumulators for any window. The result can differ from the per-window Welford
+        // loop in the last few ulps, where the exact moment is the more accurate one.
+        return cudf::is_integral(input.type()) && cudf::size_of(input.type()) <= 4;
+      default: return false;
+    }
+  }();
+  // the window width is computed in 64 bits: preceding and following may each be
+  // close to the size_type maximum (windows are clamped to the column boundaries)
+  auto const width =
+    static_cast<int64_t>(preceding_window) + static_cast<int64_t>(following_window);
+  return supported_agg && !input.has_nulls() && default_outputs.is_empty() &&
+         preceding_window >= 1 && following_window >= 0 &&
+         width >= sliding_window_width_threshold;
+}
+
+std::unique_ptr<column> sliding_rolling_window(column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               rolling_aggregation const& agg,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  // windows are clamped to the column boundaries, so the offsets can be capped to the
+  // row count up front; this keeps the per-row index arithmetic free of int32 overflow
+  // even for window offsets near the size_type maximum
+  auto const capped = [n = static_cast<int64_t>(input.size())](size_type offset) {
+    return static_cast<size_type>(std::min(static_cast<int64_t>(offset), n));
+  };
+  auto const bounds =
+    window_bounds_fn{input.size(), capped(preceding_window), capped(following_window)};
+  return cudf::type_dispatcher(
+    input.type(), sliding_window_dispatch{}, input, bounds, min_periods, agg, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
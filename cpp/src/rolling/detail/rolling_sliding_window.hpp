@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+
+class rolling_aggregation;
+
+namespace detail {
+
+/**
+ * @brief Checks if a fixed-window rolling aggregation can use the sliding O(n) algorithms.
+ *
+ * The sliding path computes SUM/MEAN from a prefix-sum difference, MIN/MAX from
+ * per-tile running aggregates (the van Herk/Gil-Werman scheme), and VARIANCE/STD from
+ * exact prefix moments, so each output row costs a constant number of reads instead of
+ * one read per window element. It applies to non-nullable inputs with no default
+ * outputs — integral types for SUM/MEAN/VARIANCE/STD, any numeric type for MIN/MAX —
+ * and only pays off once the window is wide enough to amortize the extra scan passes.
+ *
+ * @return true if the aggregation can be evaluated with the sliding algorithms
+ */
+bool can_use_sliding_window(column_view const& input,
+                            column_view const& default_outputs,
+                            size_type preceding_window,
+                            size_type following_window,
+                            rolling_aggregation const& agg);
+
+/**
+ * @brief Applies a fixed-size rolling window function using the sliding O(n) algorithms.
+ *
+ * Behaves exactly like the generic fixed-window path for the aggregations accepted by
+ * `can_use_sliding_window`: window bounds are clamped to the column boundaries and rows
+ * whose window holds fewer than `min_periods` elements are null.
+ *
+ * @return Output column with one aggregated value per input row
+ */
+std::unique_ptr<column> sliding_rolling_window(column_view const& input,
+                                               size_type preceding_window,
+                                               size_type following_window,
+                                               size_type min_periods,
+                                               rolling_aggregation const& agg,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -29,6 +29,7 @@
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <cuda/functional>
@@ -50,8 +51,8 @@ struct row_based_preceding_calc {
   cudf::size_type const* _group_labels_begin;
   cudf::size_type const _preceding_window;
 
-  row_based_preceding_calc(rmm::device_uvector<cudf::size_type> const& group_offsets,
-                           rmm::device_uvector<cudf::size_type> const& group_labels,
+  row_based_preceding_calc(device_span<cudf::size_type const> group_offsets,
+                           device_span<cudf::size_type const> group_labels,
                            cudf::size_type const& preceding_window)
     : _group_offsets_begin(group_offsets.data()),
       _group_labels_begin(group_labels.data()),
@@ -78,8 +79,8 @@ struct row_based_preceding_calc {
 ///   1. For the first row in the group, the preceding is set to 1,
 ///   2. For the next row in the group, preceding is set to 2, etc.
 std::unique_ptr<cudf::column> make_preceding_column(
-  rmm::device_uvector<cudf::size_type> const& group_offsets,
-  rmm::device_uvector<cudf::size_type> const& group_labels,
+  device_span<cudf::size_type const> group_offsets,
+  device_span<cudf::size_type const> group_labels,
   cudf::size_type const& preceding_window,
   cudf::size_type const& num_rows,
   rmm::cuda_stream_view stream)
@@ -101,8 +102,8 @@ struct row_based_following_calc {
   cudf::size_type const* _group_labels_begin;
   cudf::size_type const _following_window;
 
-  row_based_following_calc(rmm::device_uvector<cudf::size_type> const& group_offsets,
-                           rmm::device_uvector<cudf::size_type> const& group_labels,
+  row_based_following_calc(device_span<cudf::size_type const> group_offsets,
+                           device_span<cudf::size_type const> group_labels,
                            cudf::size_type const& following_window)
     : _group_offsets_begin(group_offsets.data()),
       _group_labels_begin(group_labels.data()),
@@ -130,8 +131,8 @@ struct row_based_following_calc {
 ///   1. For the last row in the group, the following is set to 0.
 ///   2. For the second last row in the group, following is set to 1, etc.
 std::unique_ptr<cudf::column> make_following_column(
-  rmm::device_uvector<cudf::size_type> const& group_offsets,
-  rmm::device_uvector<cudf::size_type> const& group_labels,
+  device_span<cudf::size_type const> group_offsets,
+  device_span<cudf::size_type const> group_labels,
   cudf::size_type const& following_window,
   cudf::size_type const& num_rows,
   rmm::cuda_stream_view stream)
@@ -146,6 +147,50 @@ std::unique_ptr<cudf::column> make_following_column(
   }
 }
 
+/// Applies a rolling window aggregation over pre-computed group boundaries.
+std::unique_ptr<column> rolling_window_on_groups(device_span<size_type const> group_offsets,
+                                                 device_span<size_type const> group_labels,
+                                                 column_view const& input,
+                                                 column_view const& default_outputs,
+                                                 size_type preceding_window,
+                                                 size_type following_window,
+                                                 size_type min_periods,
+                                                 rolling_aggregation const& aggr,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::device_async_resource_ref mr)
+{
+  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
+    cudf::detail::preceding_window_wrapper grouped_preceding_window{
+      group_offsets.data(), group_labels.data(), preceding_window};
+
+    cudf::detail::following_window_wrapper grouped_following_window{
+      group_offsets.data(), group_labels.data(), following_window};
+
+    return cudf::detail::rolling_window_udf(input,
+                                            grouped_preceding_window,
+                                            "cudf::detail::preceding_window_wrapper",
+                                            grouped_following_window,
+                                            "cudf::detail::following_window_wrapper",
+                                            min_periods,
+                                            aggr,
+                                            stream,
+                                            mr);
+  } else {
+    auto const preceding_column =
+      make_preceding_column(group_offsets, group_labels, preceding_window, input.size(), stream);
+    auto const following_column =
+      make_following_column(group_offsets, group_labels, following_window, input.size(), stream);
+    return cudf::detail::rolling_window(input,
+                                        default_outputs,
+                                        preceding_column->view().begin<cudf::size_type>(),
+                                        following_column->view().begin<cudf::size_type>(),
+                                        min_periods,
+                                        aggr,
+                                        stream,
+                                        mr);
+  }
+}
+
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
                                                column_view const& default_outputs,
@@ -212,39 +257,77 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
          group_offsets.element(group_offsets.size() - 1, stream) == input.size() &&
          "Must have at least one group.");
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    cudf::detail::preceding_window_wrapper grouped_preceding_window{
-      group_offsets.data(), group_labels.data(), preceding_window};
+  return rolling_window_on_groups(group_offsets,
+                                  group_labels,
+                                  input,
+                                  default_outputs,
+                                  preceding_window,
+                                  following_window,
+                                  min_periods,
+                                  aggr,
+                                  stream,
+                                  mr);
+}
 
-    cudf::detail::following_window_wrapper grouped_following_window{
-      group_offsets.data(), group_labels.data(), following_window};
+// Owns the group boundaries computed once by `rolling_grouping`, so that repeated
+// rolling calls on the same grouping skip the group-offset/label computation.
+struct rolling_group_boundaries {
+  rmm::device_uvector<size_type> offsets;
+  rmm::device_uvector<size_type> labels;
+};
 
-    return cudf::detail::rolling_window_udf(input,
-                                            grouped_preceding_window,
-                                            "cudf::detail::preceding_window_wrapper",
-                                            grouped_following_window,
-                                            "cudf::detail::following_window_wrapper",
-                                            min_periods,
-                                            aggr,
-                                            stream,
-                                            mr);
-  } else {
-    auto const preceding_column =
-      make_preceding_column(group_offsets, group_labels, preceding_window, input.size(), stream);
-    auto const following_column =
-      make_following_column(group_offsets, group_labels, following_window, input.size(), stream);
-    return cudf::detail::rolling_window(input,
-                                        default_outputs,
-                                        preceding_column->view().begin<cudf::size_type>(),
-                                        following_column->view().begin<cudf::size_type>(),
-                                        min_periods,
-                                        aggr,
-                                        stream,
-                                        mr);
-  }
+}  // namespace detail
+
+rolling_grouping::rolling_grouping(table_view const& group_keys, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(group_keys.num_columns() > 0,
+               "rolling_grouping requires at least one grouping column.");
+
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, {}};
+
+  _boundaries = std::make_unique<detail::rolling_group_boundaries>(detail::rolling_group_boundaries{
+    rmm::device_uvector<size_type>(helper.group_offsets(stream), stream),
+    rmm::device_uvector<size_type>(helper.group_labels(stream), stream)});
 }
 
-}  // namespace detail
+rolling_grouping::rolling_grouping(rolling_grouping&&) noexcept = default;
+
+rolling_grouping::~rolling_grouping() = default;
+
+std::unique_ptr<column> rolling_grouping::rolling_window(column_view const& input,
+                                                         size_type preceding_window,
+                                                         size_type following_window,
+                                                         size_type min_periods,
+                                                         rolling_aggregation const& aggr,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.is_empty()) { return cudf::detail::empty_output_for_rolling_aggregation(input, aggr); }
+
+  CUDF_EXPECTS(static_cast<std::size_t>(input.size()) == _boundaries->labels.size(),
+               "Size mismatch between grouping and input vector.");
+
+  CUDF_EXPECTS((min_periods >= 0), "min_periods must be non-negative");
+
+  CUDF_EXPECTS(-(preceding_window - 1) <= following_window,
+               "Preceding window bounds must precede the following window bounds.");
+
+  return detail::rolling_window_on_groups(_boundaries->offsets,
+                                          _boundaries->labels,
+                                          input,
+                                          empty_like(input)->view(),
+                                          preceding_window,
+                                          following_window,
+                                          min_periods,
+                                          aggr,
+                                          stream,
+                                          mr);
+}
 
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
@@ -440,16 +523,12 @@ std::tuple<size_type, size_type> get_null_bounds_for_orderby_column(
 ///   2. rows in ASCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::device_async_resource_ref mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_ASC(column_view const& orderby_column,
+                                                               T preceding_window,
+                                                               bool preceding_window_is_unbounded,
+                                                               T following_window,
+                                                               bool following_window_is_unbounded,
+                                                               rmm::cuda_stream_view stream)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
   auto const p_orderby_device_view = cudf::column_device_view::create(orderby_column, stream);
@@ -488,13 +567,13 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [nulls_begin_idx     = h_nulls_begin_idx,
      nulls_end_idx       = h_nulls_end_idx,
-     num_rows            = input.size(),
+     num_rows            = orderby_column.size(),
      orderby_device_view = *p_orderby_device_view,
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -524,11 +603,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return std::pair{std::move(preceding_column), std::move(following_column)};
 }
 
 // Given an orderby column grouped as specified in group_offsets,
@@ -613,18 +691,15 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
 
 // Range window computation, for orderby column in ASCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::device_async_resource_ref mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_ASC(
+  column_view const& orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -670,8 +745,8 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [d_group_offsets     = group_offsets.data(),
@@ -717,11 +792,10 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return std::pair{std::move(preceding_column), std::move(following_column)};
 }
 
 /// Range window computation, with
@@ -729,16 +803,12 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
 ///   2. rows in DESCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::device_async_resource_ref mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_DESC(column_view const& orderby_column,
+                                                                T preceding_window,
+                                                                bool preceding_window_is_unbounded,
+                                                                T following_window,
+                                                                bool following_window_is_unbounded,
+                                                                rmm::cuda_stream_view stream)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
   auto const p_orderby_device_view = cudf::column_device_view::create(orderby_column, stream);
@@ -777,13 +847,13 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [nulls_begin_idx     = h_nulls_begin_idx,
      nulls_end_idx       = h_nulls_end_idx,
-     num_rows            = input.size(),
+     num_rows            = orderby_column.size(),
      orderby_device_view = *p_orderby_device_view,
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -813,27 +883,23 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return std::pair{std::move(preceding_column), std::move(following_column)};
 }
 
 // Range window computation, for rows in DESCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::device_async_resource_ref mr)
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> range_window_DESC(
+  column_view const& orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  T preceding_window,
+  bool preceding_window_is_unbounded,
+  T following_window,
+  bool following_window_is_unbounded,
+  rmm::cuda_stream_view stream)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -878,8 +944,8 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;  // Add 1, for `preceding` to account for current row.
     });
 
-  auto const preceding_column =
-    cudf::detail::expand_to_column(preceding_calculator, input.size(), stream);
+  auto preceding_column =
+    cudf::detail::expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto const following_calculator = cuda::proclaim_return_type<size_type>(
     [d_group_offsets     = group_offsets.data(),
@@ -922,30 +988,21 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
              1;
     });
 
-  auto const following_column =
-    cudf::detail::expand_to_column(following_calculator, input.size(), stream);
+  auto following_column =
+    cudf::detail::expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return std::pair{std::move(preceding_column), std::move(following_column)};
 }
 
 template <typename OrderByT>
-std::unique_ptr<column> grouped_range_rolling_window_impl(
-  column_view const& input,
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> grouped_range_window_columns(
   column_view const& orderby_column,
   cudf::order const& order_of_orderby_column,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
   range_window_bounds const& preceding_window,
   range_window_bounds const& following_window,
-  size_type min_periods,
-  rolling_aggregation const& aggr,
-  rmm::cuda_stream_view stream,
-  rmm::device_async_resource_ref mr)
+  rmm::cuda_stream_view stream)
 {
   auto [preceding_value, following_value] = [&] {
     if constexpr (std::is_same_v<OrderByT, cudf::string_view>) {
@@ -964,52 +1021,66 @@ std::unique_ptr<column> grouped_range_rolling_window_impl(
   }();
 
   if (order_of_orderby_column == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
+    return group_offsets.is_empty() ? range_window_ASC(orderby_column,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
+                                                       stream)
+                                    : range_window_ASC(orderby_column,
                                                        group_offsets,
                                                        group_labels,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr);
+                                                       stream);
   } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
+    return group_offsets.is_empty() ? range_window_DESC(orderby_column,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
+                                                        stream)
+                                    : range_window_DESC(orderby_column,
                                                         group_offsets,
                                                         group_labels,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr);
+                                                        stream);
+  }
+}
+
+template <typename OrderByT>
+std::unique_ptr<column> grouped_range_rolling_window_impl(
+  column_view const& input,
+  column_view const& orderby_column,
+  cudf::order const& order_of_orderby_column,
+  rmm::device_uvector<cudf::size_type> const& group_offsets,
+  rmm::device_uvector<cudf::size_type> const& group_labels,
+  range_window_bounds const& preceding_window,
+  range_window_bounds const& following_window,
+  size_type min_periods,
+  rolling_aggregation const& aggr,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
+    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
   }
+
+  auto const [preceding_column, following_column] =
+    grouped_range_window_columns<OrderByT>(orderby_column,
+                                           order_of_orderby_column,
+                                           group_offsets,
+                                           group_labels,
+                                           preceding_window,
+                                           following_window,
+                                           stream);
+  return cudf::detail::rolling_window(
+    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
 }
 
 struct dispatch_grouped_range_rolling_window {
@@ -1050,6 +1121,36 @@ struct dispatch_grouped_range_rolling_window {
   }
 };
 
+struct dispatch_grouped_range_window_columns {
+  template <typename OrderByColumnType, typename... Args>
+  std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(),
+                   std::pair<std::unique_ptr<column>, std::unique_ptr<column>>>
+  operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported OrderBy column type.");
+  }
+
+  template <typename OrderByColumnType>
+  std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(),
+                   std::pair<std::unique_ptr<column>, std::unique_ptr<column>>>
+  operator()(column_view const& orderby_column,
+             cudf::order const& order_of_orderby_column,
+             rmm::device_uvector<cudf::size_type> const& group_offsets,
+             rmm::device_uvector<cudf::size_type> const& group_labels,
+             range_window_bounds const& preceding_window,
+             range_window_bounds const& following_window,
+             rmm::cuda_stream_view stream) const
+  {
+    return grouped_range_window_columns<OrderByColumnType>(orderby_column,
+                                                           order_of_orderby_column,
+                                                           group_offsets,
+                                                           group_labels,
+                                                           preceding_window,
+                                                           following_window,
+                                                           stream);
+  }
+};
+
 /**
  * @brief Functor to convert from size_type (number of days) to appropriate duration type.
  */
@@ -1192,6 +1293,67 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
 
 }  // namespace detail
 
+precomputed_range_windows::precomputed_range_windows(table_view const& group_keys,
+                                                     column_view const& orderby_column,
+                                                     cudf::order order,
+                                                     range_window_bounds const& preceding,
+                                                     range_window_bounds const& following,
+                                                     rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == orderby_column.size()),
+               "Size mismatch between group_keys and orderby column.");
+
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets(0, stream), group_labels(0, stream);
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, {}};
+    group_offsets = index_vector(helper.group_offsets(stream), stream);
+    group_labels  = index_vector(helper.group_labels(stream), stream);
+  }
+
+  std::tie(_preceding, _following) = cudf::type_dispatcher(orderby_column.type(),
+                                                           dispatch_grouped_range_window_columns{},
+                                                           orderby_column,
+                                                           order,
+                                                           group_offsets,
+                                                           group_labels,
+                                                           preceding,
+                                                           following,
+                                                           stream);
+}
+
+precomputed_range_windows::precomputed_range_windows(precomputed_range_windows&&) noexcept =
+  default;
+
+precomputed_range_windows::~precomputed_range_windows() = default;
+
+std::unique_ptr<column> precomputed_range_windows::rolling_window(
+  column_view const& input,
+  size_type min_periods,
+  rolling_aggregation const& aggr,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+
+  if (input.is_empty()) { return cudf::detail::empty_output_for_rolling_aggregation(input, aggr); }
+
+  CUDF_EXPECTS(input.size() == _preceding->size(),
+               "Size mismatch between precomputed windows and input vector.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  CUDF_EXPECTS(aggr.kind != aggregation::CUDA && aggr.kind != aggregation::PTX,
+               "Ranged rolling window does NOT (yet) support UDF.");
+
+  return cudf::detail::rolling_window(
+    input, _preceding->view(), _following->view(), min_periods, aggr, stream, mr);
+}
+
 /**
  * @copydoc std::unique_ptr<column> grouped_time_range_rolling_window(
  *              table_view const& group_keys,
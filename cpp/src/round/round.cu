@@ -195,16 +195,33 @@ struct half_even_negative {
   }
 };
 
+// The fixed_point functors compute the quotient and remainder with a single division per element
+// instead of rounding to a multiple of `n` and dividing again; `half_n` is precomputed on the host
+// (`n` is a power of ten, so `n / 2` is exact).
 template <typename T>
 struct half_up_fixed_point {
   T n;
-  __device__ T operator()(T e) { return half_up_negative<T>{n}(e) / n; }
+  T half_n;
+  __device__ T operator()(T e)
+  {
+    auto const q = e / n;
+    auto const r = e - q * n;
+    return q + generic_sign(e) * (generic_abs(r) >= half_n ? 1 : 0);
+  }
 };
 
 template <typename T>
 struct half_even_fixed_point {
   T n;
-  __device__ T operator()(T e) { return half_even_negative<T>{n}(e) / n; }
+  T half_n;
+  __device__ T operator()(T e)
+  {
+    auto const q    = e / n;
+    auto const diff = generic_abs(e - q * n);
+    auto const adjustment =
+      (diff > half_n) or (diff == half_n && generic_abs(q) % 2 == 1) ? 1 : 0;
+    return q + generic_sign(e) * adjustment;
+  }
 };
 
 template <typename T,
@@ -289,7 +306,7 @@ std::unique_ptr<column> round_with(column_view const& input,
                       input.begin<Type>(),
                       input.end<Type>(),
                       out_view.begin<Type>(),
-                      FixedPointRoundFunctor{n});
+                      FixedPointRoundFunctor{n, static_cast<Type>(n / 2)});
   }
 
   result->set_null_count(input.null_count());
@@ -14,16 +14,23 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/search.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace detail {
@@ -98,4 +105,65 @@ std::unique_ptr<column> contains(column_view const& haystack,
   return detail::contains(haystack, needles, stream, mr);
 }
 
+struct contains_index::impl {
+  std::unique_ptr<table> _sorted_haystack;
+
+  impl(column_view const& haystack, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+  {
+    auto const input = table_view{{haystack}};
+    // an already-ascending haystack with nulls last only needs to be copied
+    _sorted_haystack =
+      cudf::detail::is_sorted(input, {order::ASCENDING}, {null_order::AFTER}, stream)
+        ? std::make_unique<table>(input, stream, mr)
+        : cudf::detail::sort(input, {order::ASCENDING}, {null_order::AFTER}, stream, mr);
+  }
+
+  std::unique_ptr<column> contains(column_view const& needles,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr) const
+  {
+    auto const temp_mr       = cudf::get_current_device_resource_ref();
+    auto const needles_table = table_view{{needles}};
+
+    // a needle is present iff its lower and upper bounds in the sorted haystack differ. The
+    // lexicographic comparator groups equal rows, nulls, and NaNs into contiguous runs, which
+    // matches the null_equality::EQUAL / nan_equality::ALL_EQUAL semantics of cudf::contains.
+    auto const lower = detail::lower_bound(
+      _sorted_haystack->view(), needles_table, {order::ASCENDING}, {null_order::AFTER}, stream, temp_mr);
+    auto const upper = detail::upper_bound(
+      _sorted_haystack->view(), needles_table, {order::ASCENDING}, {null_order::AFTER}, stream, temp_mr);
+
+    auto result = make_numeric_column(data_type{type_id::BOOL8},
+                                      needles.size(),
+                                      detail::copy_bitmask(needles, stream, mr),
+                                      needles.null_count(),
+                                      stream,
+                                      mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      lower->view().begin<size_type>(),
+                      lower->view().end<size_type>(),
+                      upper->view().begin<size_type>(),
+                      result->mutable_view().begin<bool>(),
+                      thrust::not_equal_to<size_type>{});
+    return result;
+  }
+};
+
+contains_index::contains_index(column_view const& haystack,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _impl{std::make_unique<impl const>(haystack, stream, mr)}
+{
+}
+
+contains_index::~contains_index() = default;
+
+std::unique_ptr<column> contains_index::contains(column_view const& needles,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->contains(needles, stream, mr);
+}
+
 }  // namespace cudf
@@ -15,6 +15,8 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
@@ -30,6 +32,10 @@
 
 #include <thrust/binary_search.h>
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -116,6 +122,55 @@ std::unique_ptr<column> search_ordered(table_view const& haystack,
   }
   return result;
 }
+
+std::vector<std::unique_ptr<column>> batched_search_ordered(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  bool find_first,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  if (needles.empty()) { return {}; }
+  CUDF_EXPECTS(std::all_of(needles.begin(),
+                           needles.end(),
+                           [&](table_view const& t) {
+                             return t.num_columns() == needles.front().num_columns();
+                           }),
+               "All needles tables must have the same number of columns");
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(needles.size());
+
+  if (needles.size() == 1) {
+    results.push_back(search_ordered(
+      haystack, needles.front(), find_first, column_order, null_precedence, stream, mr));
+    return results;
+  }
+
+  // Concatenate the needles tables so that a single comparator setup and search launch serves
+  // the whole batch, then split the combined result back out per input table.
+  auto const temp_mr  = cudf::get_current_device_resource_ref();
+  auto const combined = cudf::detail::concatenate(needles, stream, temp_mr);
+  auto const combined_result = search_ordered(
+    haystack, combined->view(), find_first, column_order, null_precedence, stream, temp_mr);
+
+  std::vector<size_type> split_points;
+  split_points.reserve(needles.size() - 1);
+  size_type offset{0};
+  for (std::size_t i = 0; i < needles.size() - 1; ++i) {
+    offset += needles[i].num_rows();
+    split_points.push_back(offset);
+  }
+  auto const result_views = cudf::detail::split(combined_result->view(), split_points, stream);
+  std::transform(result_views.begin(),
+                 result_views.end(),
+                 std::back_inserter(results),
+                 [&](column_view const& v) { return std::make_unique<column>(v, stream, mr); });
+  return results;
+}
+
 }  // namespace
 
 std::unique_ptr<column> lower_bound(table_view const& haystack,
@@ -138,6 +193,30 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
   return search_ordered(haystack, needles, false, column_order, null_precedence, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return batched_search_ordered(
+    haystack, needles, true, column_order, null_precedence, stream, mr);
+}
+
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return batched_search_ordered(
+    haystack, needles, false, column_order, null_precedence, stream, mr);
+}
+
 }  // namespace detail
 
 // external APIs
@@ -164,4 +243,30 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
   return detail::upper_bound(haystack, needles, column_order, null_precedence, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> batched_lower_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_lower_bound(
+    haystack, needles, column_order, null_precedence, stream, mr);
+}
+
+std::vector<std::unique_ptr<column>> batched_upper_bound(
+  table_view const& haystack,
+  host_span<table_view const> needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_upper_bound(
+    haystack, needles, column_order, null_precedence, stream, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/merge.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+
+incremental_rank::incremental_rank(order column_order, null_order null_precedence)
+  : _column_order{column_order}, _null_precedence{null_precedence}, _sorted{nullptr}
+{
+}
+
+incremental_rank::~incremental_rank() = default;
+
+void incremental_rank::add_batch(column_view const& batch,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  if (batch.is_empty()) { return; }
+
+  auto sorted_batch = detail::sort(
+    table_view{{batch}}, {_column_order}, {_null_precedence}, stream, _sorted == nullptr ? mr : cudf::get_current_device_resource_ref());
+
+  if (_sorted == nullptr) {
+    _sorted = std::move(sorted_batch);
+    return;
+  }
+
+  CUDF_EXPECTS(cudf::have_same_types(_sorted->view(), sorted_batch->view()),
+               "Batch type does not match previously added batches");
+
+  // Merge writes every retained row once; no full re-sort of the accumulated rows
+  _sorted = detail::merge({_sorted->view(), sorted_batch->view()},
+                          {0},
+                          {_column_order},
+                          {_null_precedence},
+                          stream,
+                          mr);
+}
+
+column_view incremental_rank::sorted_keys() const
+{
+  CUDF_EXPECTS(_sorted != nullptr, "No batches have been added");
+  return _sorted->view().column(0);
+}
+
+std::unique_ptr<column> incremental_rank::ranks(rank_method method,
+                                                null_policy null_handling,
+                                                bool percentage,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_sorted != nullptr, "No batches have been added");
+  return detail::rank_sorted(
+    _sorted->view().column(0), method, null_handling, percentage, stream, mr);
+}
+
+}  // namespace cudf
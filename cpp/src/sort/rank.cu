@@ -262,16 +262,16 @@ void rank_average(cudf::device_span<size_type const> group_keys,
     stream);
 }
 
-}  // anonymous namespace
-
-std::unique_ptr<column> rank(column_view const& input,
-                             rank_method method,
-                             order column_order,
-                             null_policy null_handling,
-                             null_order null_precedence,
-                             bool percentage,
-                             rmm::cuda_stream_view stream,
-                             rmm::device_async_resource_ref mr)
+/**
+ * @brief Computes ranks of `input` given a precomputed sorted order of its rows.
+ */
+std::unique_ptr<column> rank_ordered(column_view const& input,
+                                     column_view const& sorted_order_view,
+                                     rank_method method,
+                                     null_policy null_handling,
+                                     bool percentage,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
 {
   data_type const output_type         = (percentage or method == rank_method::AVERAGE)
                                           ? data_type(type_id::FLOAT64)
@@ -290,13 +290,6 @@ std::unique_ptr<column> rank(column_view const& input,
   }();
   auto rank_mutable_view = rank_column->mutable_view();
 
-  std::unique_ptr<column> sorted_order =
-    (method == rank_method::FIRST)
-      ? detail::stable_sorted_order(
-          table_view{{input}}, {column_order}, {null_precedence}, stream, mr)
-      : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, stream, mr);
-  column_view sorted_order_view = sorted_order->view();
-
   // dense: All equal values have same rank and rank always increases by 1 between groups
   // acts as key for min, max, average to denote equal value groups
   rmm::device_uvector<size_type> const dense_rank_sorted =
@@ -365,6 +358,44 @@ std::unique_ptr<column> rank(column_view const& input,
   }
   return rank_column;
 }
+
+}  // anonymous namespace
+
+std::unique_ptr<column> rank(column_view const& input,
+                             rank_method method,
+                             order column_order,
+                             null_policy null_handling,
+                             null_order null_precedence,
+                             bool percentage,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  std::unique_ptr<column> sorted_order =
+    (method == rank_method::FIRST)
+      ? detail::stable_sorted_order(
+          table_view{{input}}, {column_order}, {null_precedence}, stream, mr)
+      : detail::sorted_order(table_view{{input}}, {column_order}, {null_precedence}, stream, mr);
+
+  return rank_ordered(input, sorted_order->view(), method, null_handling, percentage, stream, mr);
+}
+
+std::unique_ptr<column> rank_sorted(column_view const& input,
+                                    rank_method method,
+                                    null_policy null_handling,
+                                    bool percentage,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  // The rows are already in sorted order, so the sorted order is the identity map
+  auto identity_order = make_numeric_column(
+    data_type{type_to_id<size_type>()}, input.size(), mask_state::UNALLOCATED, stream, mr);
+  auto identity_view = identity_order->mutable_view();
+  thrust::sequence(
+    rmm::exec_policy(stream), identity_view.begin<size_type>(), identity_view.end<size_type>());
+
+  return rank_ordered(input, identity_order->view(), method, null_handling, percentage, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> rank(column_view const& input,
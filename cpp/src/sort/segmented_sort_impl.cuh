@@ -17,18 +17,30 @@
 #pragma once
 
 #include "common_sort_impl.cuh"
+#include "sort_column_impl.cuh"
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/sequence.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <cub/device/device_segmented_sort.cuh>
+#include <cuda/functional>
+#include <thrust/count.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+#include <thrust/tuple.h>
 
 namespace cudf {
 namespace detail {
@@ -65,7 +77,9 @@ struct column_fast_sort_fn {
 
   template <typename T>
   void fast_sort(column_view const& input,
-                 column_view const& segment_offsets,
+                 size_type const* begin_offsets,
+                 size_type const* end_offsets,
+                 size_type num_segments,
                  mutable_column_view& indices,
                  bool ascending,
                  rmm::cuda_stream_view stream)
@@ -122,25 +136,32 @@ struct column_fast_sort_fn {
                    temp_indices.view().begin<size_type>(),
                    indices.begin<size_type>(),
                    input.size(),
-                   segment_offsets.size() - 1,
-                   segment_offsets.begin<size_type>(),
-                   segment_offsets.begin<size_type>() + 1,
+                   num_segments,
+                   begin_offsets,
+                   end_offsets,
                    stream.value());
   }
 
   template <typename T, CUDF_ENABLE_IF(is_fast_sort_supported<T>())>
   void operator()(column_view const& input,
-                  column_view const& segment_offsets,
+                  size_type const* begin_offsets,
+                  size_type const* end_offsets,
+                  size_type num_segments,
                   mutable_column_view& indices,
                   bool ascending,
                   rmm::cuda_stream_view stream)
   {
-    fast_sort<T>(input, segment_offsets, indices, ascending, stream);
+    fast_sort<T>(input, begin_offsets, end_offsets, num_segments, indices, ascending, stream);
   }
 
   template <typename T, CUDF_ENABLE_IF(!is_fast_sort_supported<T>())>
-  void operator()(
-    column_view const&, column_view const&, mutable_column_view&, bool, rmm::cuda_stream_view)
+  void operator()(column_view const&,
+                  size_type const*,
+                  size_type const*,
+                  size_type,
+                  mutable_column_view&,
+                  bool,
+                  rmm::cuda_stream_view)
   {
     CUDF_FAIL("Column type cannot be used with fast-sort function");
   }
@@ -173,13 +194,100 @@ std::unique_ptr<column> fast_segmented_sorted_order(column_view const& input,
   cudf::type_dispatcher<dispatch_storage_type>(input.type(),
                                                column_fast_sort_fn<method>{},
                                                input,
-                                               segment_offsets,
+                                               segment_offsets.begin<size_type>(),
+                                               segment_offsets.begin<size_type>() + 1,
+                                               segment_offsets.size() - 1,
                                                indices_view,
                                                column_order == order::ASCENDING,
                                                stream);
   return sorted_indices;
 }
 
+/// Segments at least this long are sorted individually by the hybrid segmented sort
+constexpr cudf::size_type GIANT_SEGMENT_SIZE_FOR_HYBRID_SORT{1 << 16};
+
+/**
+ * @brief Hybrid segmented sorted-order for segment size distributions with a few giant segments
+ *
+ * Splits the segments by size: everything below `GIANT_SEGMENT_SIZE_FOR_HYBRID_SORT` rows goes
+ * through the CUB fast path, while each giant segment is sorted on its own with the single-column
+ * radix sort. This keeps millions of tiny segments off the generic lexicographic sort when a
+ * handful of giant segments would otherwise defeat the average-segment-size heuristic.
+ *
+ * Check `column_fast_sort_fn<method>::is_fast_sort_supported()==true` on the input column before
+ * using this function.
+ *
+ * @param input Column to sort
+ * @param segment_offsets Identifies segments to sort within
+ * @param column_order Sort ascending or descending
+ * @param num_giants Number of segments at least `GIANT_SEGMENT_SIZE_FOR_HYBRID_SORT` long
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+template <sort_method method>
+std::unique_ptr<column> hybrid_segmented_sorted_order(column_view const& input,
+                                                      column_view const& segment_offsets,
+                                                      order const& column_order,
+                                                      size_type num_giants,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  auto const num_segments = segment_offsets.size() - 1;
+  auto const num_smalls   = num_segments - num_giants;
+  auto const d_offsets    = segment_offsets.begin<size_type>();
+
+  auto small_begins = rmm::device_uvector<size_type>(num_smalls, stream);
+  auto small_ends   = rmm::device_uvector<size_type>(num_smalls, stream);
+  auto giant_begins = rmm::device_uvector<size_type>(num_giants, stream);
+  auto giant_ends   = rmm::device_uvector<size_type>(num_giants, stream);
+
+  auto const segment_iter = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<thrust::tuple<size_type, size_type>>([d_offsets] __device__(
+         size_type i) { return thrust::tuple<size_type, size_type>{d_offsets[i], d_offsets[i + 1]}; }));
+  thrust::partition_copy(
+    rmm::exec_policy_nosync(stream),
+    segment_iter,
+    segment_iter + num_segments,
+    thrust::make_zip_iterator(giant_begins.begin(), giant_ends.begin()),
+    thrust::make_zip_iterator(small_begins.begin(), small_ends.begin()),
+    [] __device__(thrust::tuple<size_type, size_type> const& segment) {
+      return thrust::get<1>(segment) - thrust::get<0>(segment) >=
+             GIANT_SEGMENT_SIZE_FOR_HYBRID_SORT;
+    });
+
+  auto sorted_indices =
+    cudf::detail::sequence(input.size(), numeric_scalar<size_type>{0, true, stream}, stream, mr);
+  auto indices_view = sorted_indices->mutable_view();
+
+  if (num_smalls > 0) {
+    cudf::type_dispatcher<dispatch_storage_type>(input.type(),
+                                                 column_fast_sort_fn<method>{},
+                                                 input,
+                                                 small_begins.data(),
+                                                 small_ends.data(),
+                                                 num_smalls,
+                                                 indices_view,
+                                                 column_order == order::ASCENDING,
+                                                 stream);
+  }
+
+  auto const h_giant_begins = cudf::detail::make_std_vector_sync(giant_begins, stream);
+  auto const h_giant_ends   = cudf::detail::make_std_vector_sync(giant_ends, stream);
+  for (size_type i = 0; i < num_giants; ++i) {
+    auto const segment_begin = h_giant_begins[i];
+    auto const segment       = cudf::detail::slice(input, segment_begin, h_giant_ends[i]);
+    // null precedence is irrelevant here since the fast path requires no nulls
+    auto const local_order = detail::sorted_order<method>(
+      segment, column_order, null_order::AFTER, stream, cudf::get_current_device_resource_ref());
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      local_order->view().begin<size_type>(),
+                      local_order->view().end<size_type>(),
+                      indices_view.begin<size_type>() + segment_begin,
+                      [segment_begin] __device__(size_type idx) { return idx + segment_begin; });
+  }
+  return sorted_indices;
+}
+
 /**
  * @brief Builds indices to identify segments to sort
  *
@@ -260,12 +368,39 @@ std::unique_ptr<column> segmented_sorted_order_common(
   // - size and width are limited -- based on benchmark results
   if (keys.num_columns() == 1 and
       column_fast_sort_fn<method>::is_fast_sort_supported(keys.column(0)) and
-      (segment_offsets.size() > 0) and
-      (((keys.num_rows() / segment_offsets.size()) < MAX_AVG_LIST_SIZE_FOR_FAST_SORT) or
-       (keys.num_rows() < MAX_LIST_SIZE_FOR_FAST_SORT))) {
+      (segment_offsets.size() > 0)) {
     auto const col_order = column_order.empty() ? order::ASCENDING : column_order.front();
-    return fast_segmented_sorted_order<method>(
-      keys.column(0), segment_offsets, col_order, stream, mr);
+    if (((keys.num_rows() / segment_offsets.size()) < MAX_AVG_LIST_SIZE_FOR_FAST_SORT) or
+        (keys.num_rows() < MAX_LIST_SIZE_FOR_FAST_SORT)) {
+      return fast_segmented_sorted_order<method>(
+        keys.column(0), segment_offsets, col_order, stream, mr);
+    }
+    // A few giant segments can defeat the average-size heuristic even though almost all
+    // segments are small; sort the giants individually and keep the fast path for the rest
+    auto const num_segments = segment_offsets.size() - 1;
+    auto const d_offsets    = segment_offsets.begin<size_type>();
+    auto const counting     = thrust::counting_iterator<size_type>(0);
+    auto const is_giant     = [d_offsets] __device__(size_type i) {
+      return d_offsets[i + 1] - d_offsets[i] >= GIANT_SEGMENT_SIZE_FOR_HYBRID_SORT;
+    };
+    auto const num_giants = static_cast<size_type>(
+      thrust::count_if(rmm::exec_policy(stream), counting, counting + num_segments, is_giant));
+    if (num_giants > 0 and num_giants < num_segments) {
+      auto const giant_rows = thrust::transform_reduce(
+        rmm::exec_policy(stream),
+        counting,
+        counting + num_segments,
+        cuda::proclaim_return_type<size_type>([d_offsets, is_giant] __device__(size_type i) {
+          return is_giant(i) ? d_offsets[i + 1] - d_offsets[i] : size_type{0};
+        }),
+        size_type{0},
+        thrust::plus<size_type>{});
+      if (((keys.num_rows() - giant_rows) / (num_segments - num_giants)) <
+          MAX_AVG_LIST_SIZE_FOR_FAST_SORT) {
+        return hybrid_segmented_sorted_order<method>(
+          keys.column(0), segment_offsets, col_order, num_giants, stream, mr);
+      }
+    }
   }
 
   // Get segment id of each element in all segments.
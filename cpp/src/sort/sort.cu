@@ -22,13 +22,16 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <thrust/functional.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
 namespace cudf {
@@ -42,6 +45,44 @@ std::unique_ptr<column> sorted_order(table_view const& input,
   return sorted_order<sort_method::UNSTABLE>(input, column_order, null_precedence, stream, mr);
 }
 
+std::unique_ptr<column> sorted_order(
+  table_view const& input,
+  std::shared_ptr<experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(preprocessed_input != nullptr, "Preprocessed input table is required.");
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return cudf::make_numeric_column(
+      data_type(type_to_id<size_type>()), 0, mask_state::UNALLOCATED, stream, mr);
+  }
+
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto mutable_indices_view = sorted_indices->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream),
+                   mutable_indices_view.begin<size_type>(),
+                   mutable_indices_view.end<size_type>(),
+                   0);
+
+  // the column order and null precedence are baked into the preprocessed table
+  auto const comp =
+    cudf::experimental::row::lexicographic::self_comparator(std::move(preprocessed_input));
+  auto const do_sort = [&](auto const comparator) {
+    thrust::sort(rmm::exec_policy(stream),
+                 mutable_indices_view.begin<size_type>(),
+                 mutable_indices_view.end<size_type>(),
+                 comparator);
+  };
+  if (cudf::detail::has_nested_columns(input)) {
+    do_sort(comp.less<true>(nullate::DYNAMIC{has_nested_nulls(input)}));
+  } else {
+    do_sort(comp.less<false>(nullate::DYNAMIC{has_nested_nulls(input)}));
+  }
+
+  return sorted_indices;
+}
+
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
@@ -95,6 +136,16 @@ std::unique_ptr<column> sorted_order(table_view const& input,
   return detail::sorted_order(input, column_order, null_precedence, stream, mr);
 }
 
+std::unique_ptr<column> sorted_order(
+  table_view const& input,
+  std::shared_ptr<experimental::row::lexicographic::preprocessed_table> preprocessed_input,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sorted_order(input, std::move(preprocessed_input), stream, mr);
+}
+
 std::unique_ptr<table> sort(table_view const& input,
                             std::vector<order> const& column_order,
                             std::vector<null_order> const& null_precedence,
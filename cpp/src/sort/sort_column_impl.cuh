@@ -25,10 +25,20 @@
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace detail {
@@ -81,6 +91,49 @@ struct simple_comparator {
   null_order null_precedence{};
 };
 
+/**
+ * @brief Extracts the first eight bytes of a string as a big-endian integer key.
+ *
+ * Integer ordering of the keys matches the byte-wise string ordering of the prefixes;
+ * strings shorter than eight bytes are padded with zeros, placing them ahead of any
+ * longer string sharing their prefix.
+ */
+struct string_prefix_key_fn {
+  column_device_view d_col;
+  __device__ uint64_t operator()(size_type idx) const
+  {
+    auto const d_str = d_col.element<string_view>(idx);
+    auto const bytes = reinterpret_cast<unsigned char const*>(d_str.data());
+    auto const size  = d_str.size_bytes() < 8 ? d_str.size_bytes() : size_type{8};
+    uint64_t key     = 0;
+    for (size_type i = 0; i < size; ++i) {
+      key |= static_cast<uint64_t>(bytes[i]) << (56 - 8 * i);
+    }
+    return key;
+  }
+};
+
+/**
+ * @brief Orders positions of prefix-tied rows by run and then by full string comparison.
+ *
+ * Positions within the same prefix run are resolved with the full comparator; positions
+ * from different runs keep their radix-sorted run order.
+ */
+struct string_tie_break_comparator {
+  size_type const* run_ids;      ///< prefix-run id of each sorted position
+  size_type const* row_indices;  ///< input row held at each sorted position
+  column_device_view d_col;
+  bool ascending;
+
+  __device__ bool operator()(size_type lhs_pos, size_type rhs_pos) const
+  {
+    if (run_ids[lhs_pos] != run_ids[rhs_pos]) { return run_ids[lhs_pos] < run_ids[rhs_pos]; }
+    auto const cmp = relational_compare(d_col.element<string_view>(row_indices[lhs_pos]),
+                                        d_col.element<string_view>(row_indices[rhs_pos]));
+    return cmp == (ascending ? weak_ordering::LESS : weak_ordering::GREATER);
+  }
+};
+
 template <sort_method method>
 struct column_sorted_order_fn {
   /**
@@ -102,19 +155,26 @@ struct column_sorted_order_fn {
   /**
    * @brief Sorts fixed-width columns using faster thrust sort.
    *
-   * Should not be called if `input.has_nulls()==true`
+   * Null rows are partitioned out up front so the sort itself runs on the raw keys, where
+   * thrust dispatches to a radix sort for primitive types.
    *
    * @param input Column to sort
    * @param indices Output sorted indices
    * @param ascending True if sort order is ascending
+   * @param null_precedence How null rows are to be ordered
    * @param stream CUDA stream used for device memory operations and kernel launches
    */
   template <typename T>
   void faster_sort(column_view const& input,
                    mutable_column_view& indices,
                    bool ascending,
+                   null_order null_precedence,
                    rmm::cuda_stream_view stream)
   {
+    if (input.has_nulls()) {
+      faster_sort_nullable<T>(input, indices, ascending, null_precedence, stream);
+      return;
+    }
     // A thrust sort on a column of primitive types will use a radix sort.
     // For other fixed-width types, thrust will use merge-sort.
     // But this also requires making a copy of the input data.
@@ -146,6 +206,209 @@ struct column_sorted_order_fn {
     }
   }
 
+  /**
+   * @brief Sorts a nullable fixed-width column using faster thrust sort.
+   *
+   * The null row indices are split out in their original (stable) order, the remaining keys are
+   * sorted with the radix path, and the null indices are placed before or after the sorted rows
+   * as `null_precedence` and the sort order dictate. This matches the ordering produced by
+   * `simple_comparator` without paying for a comparator sort.
+   *
+   * @param input Column to sort
+   * @param indices Output sorted indices
+   * @param ascending True if sort order is ascending
+   * @param null_precedence How null rows are to be ordered
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  template <typename T>
+  void faster_sort_nullable(column_view const& input,
+                            mutable_column_view& indices,
+                            bool ascending,
+                            null_order null_precedence,
+                            rmm::cuda_stream_view stream)
+  {
+    auto const num_rows   = input.size();
+    auto const num_nulls  = input.null_count();
+    auto const num_valids = num_rows - num_nulls;
+
+    auto const d_input  = column_device_view::create(input, stream);
+    auto valid_indices  = rmm::device_uvector<size_type>(num_valids, stream);
+    auto null_indices   = rmm::device_uvector<size_type>(num_nulls, stream);
+    auto const counting = thrust::counting_iterator<size_type>(0);
+    thrust::partition_copy(
+      rmm::exec_policy_nosync(stream),
+      counting,
+      counting + num_rows,
+      valid_indices.begin(),
+      null_indices.begin(),
+      [d_col = *d_input] __device__(size_type idx) { return d_col.is_valid_nocheck(idx); });
+
+    auto keys = rmm::device_uvector<T>(num_valids, stream);
+    thrust::gather(rmm::exec_policy_nosync(stream),
+                   valid_indices.begin(),
+                   valid_indices.end(),
+                   input.begin<T>(),
+                   keys.begin());
+
+    auto const do_sort = [&](auto const comp) {
+      // Compiling `thrust::*sort*` APIs is expensive.
+      // Thus, we should optimize that by using constexpr condition to only compile what we need.
+      if constexpr (method == sort_method::STABLE) {
+        thrust::stable_sort_by_key(
+          rmm::exec_policy(stream), keys.begin(), keys.end(), valid_indices.begin(), comp);
+      } else {
+        thrust::sort_by_key(
+          rmm::exec_policy(stream), keys.begin(), keys.end(), valid_indices.begin(), comp);
+      }
+    };
+    if (ascending) {
+      do_sort(thrust::less<T>{});
+    } else {
+      do_sort(thrust::greater<T>{});
+    }
+
+    // `null_order::BEFORE` refers to the ascending key order, so nulls lead a descending sort
+    // only when `null_order::AFTER` is given
+    auto const nulls_first  = ascending == (null_precedence == null_order::BEFORE);
+    auto const valid_offset = nulls_first ? num_nulls : 0;
+    auto const null_offset  = nulls_first ? 0 : num_valids;
+    thrust::copy(rmm::exec_policy_nosync(stream),
+                 null_indices.begin(),
+                 null_indices.end(),
+                 indices.begin<size_type>() + null_offset);
+    thrust::copy(rmm::exec_policy_nosync(stream),
+                 valid_indices.begin(),
+                 valid_indices.end(),
+                 indices.begin<size_type>() + valid_offset);
+  }
+
+  /**
+   * @brief Sorts a strings column using radix sort on eight-byte prefix keys.
+   *
+   * The first eight bytes of each string are packed into a big-endian integer key and the
+   * keys are radix sorted; only positions whose prefix key ties a neighbor are re-sorted
+   * with the full string comparator. Mostly-distinct short keys never touch the comparator;
+   * with heavily duplicated prefixes this degrades to the comparator sort over the tied
+   * rows, which is where the generic path started anyway.
+   *
+   * @param input Column to sort
+   * @param indices Output sorted indices
+   * @param ascending True if sort order is ascending
+   * @param null_precedence How null rows are to be ordered
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void faster_sort_strings(column_view const& input,
+                           mutable_column_view& indices,
+                           bool ascending,
+                           null_order null_precedence,
+                           rmm::cuda_stream_view stream)
+  {
+    auto const num_rows   = input.size();
+    auto const num_nulls  = input.null_count();
+    auto const num_valids = num_rows - num_nulls;
+
+    auto const d_input  = column_device_view::create(input, stream);
+    auto valid_indices  = rmm::device_uvector<size_type>(num_valids, stream);
+    auto null_indices   = rmm::device_uvector<size_type>(num_nulls, stream);
+    auto const counting = thrust::counting_iterator<size_type>(0);
+    thrust::partition_copy(
+      rmm::exec_policy_nosync(stream),
+      counting,
+      counting + num_rows,
+      valid_indices.begin(),
+      null_indices.begin(),
+      [d_col = *d_input] __device__(size_type idx) { return d_col.is_valid_nocheck(idx); });
+
+    auto keys = rmm::device_uvector<uint64_t>(num_valids, stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      valid_indices.begin(),
+                      valid_indices.end(),
+                      keys.begin(),
+                      string_prefix_key_fn{*d_input});
+
+    auto const do_sort = [&](auto const comp) {
+      // Compiling `thrust::*sort*` APIs is expensive.
+      // Thus, we should optimize that by using constexpr condition to only compile what we need.
+      if constexpr (method == sort_method::STABLE) {
+        thrust::stable_sort_by_key(
+          rmm::exec_policy(stream), keys.begin(), keys.end(), valid_indices.begin(), comp);
+      } else {
+        thrust::sort_by_key(
+          rmm::exec_policy(stream), keys.begin(), keys.end(), valid_indices.begin(), comp);
+      }
+    };
+    if (ascending) {
+      do_sort(thrust::less<uint64_t>{});
+    } else {
+      do_sort(thrust::greater<uint64_t>{});
+    }
+
+    // A prefix key tie never proves the strings are ordered, so every position that shares
+    // its key with a neighbor is re-sorted with the full comparator
+    auto const d_keys   = keys.data();
+    auto const tied_fn  = [d_keys, num_valids] __device__(size_type pos) {
+      return (pos > 0 and d_keys[pos] == d_keys[pos - 1]) or
+             (pos + 1 < num_valids and d_keys[pos] == d_keys[pos + 1]);
+    };
+    auto const num_tied = static_cast<size_type>(thrust::count_if(
+      rmm::exec_policy(stream), counting, counting + num_valids, tied_fn));
+    if (num_tied > 0) {
+      auto run_ids = rmm::device_uvector<size_type>(num_valids, stream);
+      thrust::tabulate(rmm::exec_policy_nosync(stream),
+                       run_ids.begin(),
+                       run_ids.end(),
+                       [d_keys] __device__(size_type pos) {
+                         return static_cast<size_type>(pos == 0 or d_keys[pos] != d_keys[pos - 1]);
+                       });
+      thrust::inclusive_scan(
+        rmm::exec_policy_nosync(stream), run_ids.begin(), run_ids.end(), run_ids.begin());
+
+      // positions of tied rows, in radix-sorted (ascending position) order
+      auto tied_positions = rmm::device_uvector<size_type>(num_tied, stream);
+      thrust::copy_if(rmm::exec_policy_nosync(stream),
+                      counting,
+                      counting + num_valids,
+                      tied_positions.begin(),
+                      tied_fn);
+      auto sorted_positions = rmm::device_uvector<size_type>(tied_positions, stream);
+      auto const comp       = string_tie_break_comparator{
+        run_ids.data(), valid_indices.data(), *d_input, ascending};
+      if constexpr (method == sort_method::STABLE) {
+        thrust::stable_sort(
+          rmm::exec_policy(stream), sorted_positions.begin(), sorted_positions.end(), comp);
+      } else {
+        thrust::sort(
+          rmm::exec_policy(stream), sorted_positions.begin(), sorted_positions.end(), comp);
+      }
+      // rewrite the tied positions with their comparator-resolved row order
+      auto resolved = rmm::device_uvector<size_type>(num_tied, stream);
+      thrust::gather(rmm::exec_policy_nosync(stream),
+                     sorted_positions.begin(),
+                     sorted_positions.end(),
+                     valid_indices.begin(),
+                     resolved.begin());
+      thrust::scatter(rmm::exec_policy_nosync(stream),
+                      resolved.begin(),
+                      resolved.end(),
+                      tied_positions.begin(),
+                      valid_indices.begin());
+    }
+
+    // `null_order::BEFORE` refers to the ascending key order, so nulls lead a descending sort
+    // only when `null_order::AFTER` is given
+    auto const nulls_first  = ascending == (null_precedence == null_order::BEFORE);
+    auto const valid_offset = nulls_first ? num_nulls : 0;
+    auto const null_offset  = nulls_first ? 0 : num_valids;
+    thrust::copy(rmm::exec_policy_nosync(stream),
+                 null_indices.begin(),
+                 null_indices.end(),
+                 indices.begin<size_type>() + null_offset);
+    thrust::copy(rmm::exec_policy_nosync(stream),
+                 valid_indices.begin(),
+                 valid_indices.end(),
+                 indices.begin<size_type>() + valid_offset);
+  }
+
   /**
    * @brief Sorts a single column with a relationally comparable type.
    *
@@ -185,11 +448,9 @@ struct column_sorted_order_fn {
                   rmm::cuda_stream_view stream)
   {
     if constexpr (is_faster_sort_supported<T>()) {
-      if (input.has_nulls()) {
-        sorted_order<T>(input, indices, ascending, null_precedence, stream);
-      } else {
-        faster_sort<T>(input, indices, ascending, stream);
-      }
+      faster_sort<T>(input, indices, ascending, null_precedence, stream);
+    } else if constexpr (std::is_same_v<T, cudf::string_view>) {
+      faster_sort_strings(input, indices, ascending, null_precedence, stream);
     } else {
       sorted_order<T>(input, indices, ascending, null_precedence, stream);
     }
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Selection kicks in only when the requested rows are a small fraction of the input
+size_type constexpr top_k_oversample_factor = 16;
+// Minimum number of rows sampled to estimate the k-th row
+size_type constexpr top_k_min_sample_rows = 8192;
+// Extra sample ranks added to the threshold estimate to make underestimation unlikely
+size_type constexpr top_k_threshold_margin = 32;
+
+/**
+ * @brief Sorts `input` outright and gathers its first `k` rows.
+ */
+std::unique_ptr<table> sorted_top_k(table_view const& input,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto const order_map = detail::sorted_order(
+    input, column_order, null_precedence, stream, cudf::get_current_device_resource_ref());
+  return detail::gather(input,
+                        detail::slice(order_map->view(), 0, k),
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+/**
+ * @brief Gathers the indices of all rows that do not compare greater than the threshold row.
+ *
+ * @tparam Comparator Two-table less comparator; the lhs table is the input and the
+ * rhs table holds the single threshold row
+ */
+template <typename Comparator>
+rmm::device_uvector<size_type> collect_candidates(Comparator d_less,
+                                                  size_type num_rows,
+                                                  rmm::cuda_stream_view stream)
+{
+  using cudf::experimental::row::lhs_index_type;
+  using cudf::experimental::row::rhs_index_type;
+  auto const keep_fn = [d_less] __device__(size_type idx) {
+    return not d_less(rhs_index_type{0}, lhs_index_type{idx});
+  };
+  auto const begin = thrust::counting_iterator<size_type>(0);
+  auto const num_candidates =
+    thrust::count_if(rmm::exec_policy(stream), begin, begin + num_rows, keep_fn);
+  auto candidates = rmm::device_uvector<size_type>(num_candidates, stream);
+  thrust::copy_if(rmm::exec_policy(stream), begin, begin + num_rows, candidates.begin(), keep_fn);
+  return candidates;
+}
+
+}  // namespace
+
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(k >= 0, "Number of rows to select must not be negative");
+  CUDF_EXPECTS(
+    column_order.empty() or static_cast<std::size_t>(input.num_columns()) == column_order.size(),
+    "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<std::size_t>(input.num_columns()) == null_precedence.size(),
+               "Mismatch between number of columns and null precedence.");
+
+  auto const num_rows = input.num_rows();
+  if (k == 0 or input.num_columns() == 0) { return empty_like(input); }
+  if (k > num_rows) { k = num_rows; }
+
+  // Selection only pays off when k is a small fraction of the input; otherwise (and for
+  // inputs too small to sample from) the full sort is just as fast
+  if (static_cast<int64_t>(k) * top_k_oversample_factor >= num_rows) {
+    return sorted_top_k(input, k, column_order, null_precedence, stream, mr);
+  }
+  auto const sample_rows = std::max(top_k_min_sample_rows, k * top_k_oversample_factor);
+  if (sample_rows >= num_rows) {
+    return sorted_top_k(input, k, column_order, null_precedence, stream, mr);
+  }
+
+  auto const temp_mr = cudf::get_current_device_resource_ref();
+
+  // Gather an evenly strided sample of the input and sort it
+  auto const stride     = num_rows / sample_rows;
+  auto sample_map       = rmm::device_uvector<size_type>(sample_rows, stream);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   sample_map.begin(),
+                   sample_map.end(),
+                   [stride] __device__(size_type idx) { return idx * stride; });
+  auto const sample_map_view = column_view(
+    data_type{type_to_id<size_type>()}, sample_rows, sample_map.data(), nullptr, 0);
+  auto const sample = detail::gather(input,
+                                     sample_map_view,
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     detail::negative_index_policy::NOT_ALLOWED,
+                                     stream,
+                                     temp_mr);
+  auto const sample_order =
+    detail::sorted_order(sample->view(), column_order, null_precedence, stream, temp_mr);
+
+  // Pick a sample rank whose expected rank in the full input comfortably exceeds k; the
+  // margin only affects how many candidate rows are sorted below, never correctness
+  auto const threshold_rank = std::min<size_type>(
+    sample_rows - 1,
+    static_cast<size_type>(2 * (static_cast<int64_t>(k) * sample_rows / num_rows)) +
+      top_k_threshold_margin);
+  auto const threshold = detail::gather(sample->view(),
+                                        detail::slice(sample_order->view(), threshold_rank, threshold_rank + 1),
+                                        out_of_bounds_policy::DONT_CHECK,
+                                        detail::negative_index_policy::NOT_ALLOWED,
+                                        stream,
+                                        temp_mr);
+
+  // Keep only the rows that do not compare greater than the threshold row
+  auto const matched =
+    dictionary::detail::match_dictionaries({input, threshold->view()}, stream, temp_mr);
+  auto const& matched_input     = matched.second.front();
+  auto const& matched_threshold = matched.second.back();
+  auto const comparator         = cudf::experimental::row::lexicographic::two_table_comparator(
+    matched_input, matched_threshold, column_order, null_precedence, stream);
+  auto const has_nulls = has_nested_nulls(matched_input) or has_nested_nulls(matched_threshold);
+
+  auto const candidates = [&] {
+    if (cudf::detail::has_nested_columns(input)) {
+      return collect_candidates(
+        comparator.less<true>(nullate::DYNAMIC{has_nulls}), num_rows, stream);
+    }
+    return collect_candidates(
+      comparator.less<false>(nullate::DYNAMIC{has_nulls}), num_rows, stream);
+  }();
+
+  // The sample misjudged the k-th row (e.g. heavily skewed duplicates); sort everything
+  if (static_cast<size_type>(candidates.size()) < k) {
+    return sorted_top_k(input, k, column_order, null_precedence, stream, mr);
+  }
+
+  // Sort only the candidate rows and map the first k back to input row indices
+  auto const candidates_view = column_view(
+    data_type{type_to_id<size_type>()}, static_cast<size_type>(candidates.size()), candidates.data(), nullptr, 0);
+  auto const candidate_rows = detail::gather(input,
+                                             candidates_view,
+                                             out_of_bounds_policy::DONT_CHECK,
+                                             detail::negative_index_policy::NOT_ALLOWED,
+                                             stream,
+                                             temp_mr);
+  auto const candidate_order =
+    detail::sorted_order(candidate_rows->view(), column_order, null_precedence, stream, temp_mr);
+  auto top_map = rmm::device_uvector<size_type>(k, stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 candidate_order->view().begin<size_type>(),
+                 candidate_order->view().begin<size_type>() + k,
+                 candidates.begin(),
+                 top_map.begin());
+  auto const top_map_view =
+    column_view(data_type{type_to_id<size_type>()}, k, top_map.data(), nullptr, 0);
+  return detail::gather(input,
+                        top_map_view,
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> top_k(table_view const& input,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(input, k, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
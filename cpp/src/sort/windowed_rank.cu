@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Sets `flags[i]` to 1 where sorted row `i` differs from row `i - 1`, else 0
+ */
+void mark_adjacent_changes(table_view const& sorted,
+                           rmm::device_uvector<size_type>& flags,
+                           rmm::cuda_stream_view stream)
+{
+  auto const comparator = cudf::experimental::row::equality::self_comparator(sorted, stream);
+  auto const fill       = [&](auto const d_equal) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     flags.begin(),
+                     flags.end(),
+                     [d_equal] __device__(size_type i) -> size_type {
+                       return (i == 0 or not d_equal(i, i - 1)) ? 1 : 0;
+                     });
+  };
+  if (cudf::detail::has_nested_columns(sorted)) {
+    fill(comparator.equal_to<true>(nullate::DYNAMIC{has_nested_nulls(sorted)}));
+  } else {
+    fill(comparator.equal_to<false>(nullate::DYNAMIC{has_nested_nulls(sorted)}));
+  }
+}
+
+/**
+ * @brief Scatters ranks computed in sorted order back to the input row order
+ */
+std::unique_ptr<column> scatter_to_input_order(rmm::device_uvector<size_type> const& sorted_ranks,
+                                               column_view const& permutation,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = static_cast<size_type>(sorted_ranks.size());
+  auto output         = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::scatter(rmm::exec_policy(stream),
+                  sorted_ranks.begin(),
+                  sorted_ranks.end(),
+                  permutation.begin<size_type>(),
+                  output->mutable_view().begin<size_type>());
+  return output;
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> windowed_ranks(
+  table_view const& group_keys,
+  table_view const& order_keys,
+  std::vector<rank_method> const& methods,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(order_keys.num_columns() > 0, "Windowed ranking requires at least one order key");
+  CUDF_EXPECTS(group_keys.num_columns() == 0 or group_keys.num_rows() == order_keys.num_rows(),
+               "Mismatch in number of rows between grouping and order keys");
+  CUDF_EXPECTS(not methods.empty(), "Windowed ranking requires at least one rank method");
+  CUDF_EXPECTS(std::all_of(methods.begin(),
+                           methods.end(),
+                           [](rank_method method) {
+                             return method == rank_method::FIRST or
+                                    method == rank_method::MIN or method == rank_method::DENSE;
+                           }),
+               "Windowed ranking supports only FIRST, MIN and DENSE rank methods");
+  CUDF_EXPECTS(column_order.empty() or
+                 static_cast<size_type>(column_order.size()) == order_keys.num_columns(),
+               "Mismatch between number of order keys and column order policies");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<size_type>(null_precedence.size()) == order_keys.num_columns(),
+               "Mismatch between number of order keys and null precedence policies");
+
+  auto const num_rows = order_keys.num_rows();
+  if (num_rows == 0) {
+    std::vector<std::unique_ptr<column>> empty_ranks;
+    std::transform(
+      methods.begin(), methods.end(), std::back_inserter(empty_ranks), [&](rank_method) {
+        return make_numeric_column(
+          data_type{type_to_id<size_type>()}, 0, mask_state::UNALLOCATED, stream, mr);
+      });
+    return std::pair(std::make_unique<table>(std::move(empty_ranks)),
+                     make_numeric_column(
+                       data_type{type_to_id<size_type>()}, 0, mask_state::UNALLOCATED, stream, mr));
+  }
+
+  // One stable sort on (group keys..., order keys...) drives every requested rank column; the
+  // permutation is returned so later window functions can reuse the same pass
+  auto combined_columns = std::vector<column_view>(group_keys.begin(), group_keys.end());
+  combined_columns.insert(combined_columns.end(), order_keys.begin(), order_keys.end());
+  auto const combined = table_view{combined_columns};
+
+  std::vector<order> combined_order(group_keys.num_columns(), order::ASCENDING);
+  std::vector<null_order> combined_null_precedence(group_keys.num_columns(), null_order::BEFORE);
+  if (column_order.empty()) {
+    combined_order.insert(combined_order.end(), order_keys.num_columns(), order::ASCENDING);
+  } else {
+    combined_order.insert(combined_order.end(), column_order.begin(), column_order.end());
+  }
+  if (null_precedence.empty()) {
+    combined_null_precedence.insert(
+      combined_null_precedence.end(), order_keys.num_columns(), null_order::BEFORE);
+  } else {
+    combined_null_precedence.insert(
+      combined_null_precedence.end(), null_precedence.begin(), null_precedence.end());
+  }
+
+  auto const temp_mr     = cudf::get_current_device_resource_ref();
+  auto const permutation = cudf::detail::stable_sorted_order(
+    combined, combined_order, combined_null_precedence, stream, temp_mr);
+  auto const sorted = cudf::detail::gather(combined,
+                                           permutation->view(),
+                                           out_of_bounds_policy::DONT_CHECK,
+                                           negative_index_policy::NOT_ALLOWED,
+                                           stream,
+                                           temp_mr);
+
+  // Group labels from adjacent group-key changes, then 0-based row numbers within each group
+  auto group_flags = rmm::device_uvector<size_type>(num_rows, stream);
+  if (group_keys.num_columns() == 0) {
+    thrust::tabulate(rmm::exec_policy(stream),
+                     group_flags.begin(),
+                     group_flags.end(),
+                     [] __device__(size_type i) -> size_type { return i == 0 ? 1 : 0; });
+  } else {
+    auto const sorted_groups =
+      table_view{std::vector<column_view>(sorted->view().begin(),
+                                          sorted->view().begin() + group_keys.num_columns())};
+    mark_adjacent_changes(sorted_groups, group_flags, stream);
+  }
+  auto group_labels = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), group_flags.begin(), group_flags.end(), group_labels.begin());
+
+  auto row_numbers = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                group_labels.begin(),
+                                group_labels.end(),
+                                thrust::make_constant_iterator<size_type>(1),
+                                row_numbers.begin(),
+                                size_type{0});
+
+  auto const needs_value_flags = std::any_of(methods.begin(), methods.end(), [](rank_method m) {
+    return m == rank_method::MIN or m == rank_method::DENSE;
+  });
+  auto value_flags = rmm::device_uvector<size_type>(needs_value_flags ? num_rows : 0, stream);
+  if (needs_value_flags) { mark_adjacent_changes(sorted->view(), value_flags, stream); }
+
+  std::vector<std::unique_ptr<column>> rank_columns;
+  auto sorted_ranks = rmm::device_uvector<size_type>(num_rows, stream);
+  for (auto const method : methods) {
+    switch (method) {
+      case rank_method::FIRST:
+        thrust::transform(rmm::exec_policy(stream),
+                          row_numbers.begin(),
+                          row_numbers.end(),
+                          sorted_ranks.begin(),
+                          [] __device__(size_type rn) -> size_type { return rn + 1; });
+        break;
+      case rank_method::DENSE:
+        thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                      group_labels.begin(),
+                                      group_labels.end(),
+                                      value_flags.begin(),
+                                      sorted_ranks.begin());
+        break;
+      case rank_method::MIN: {
+        // Each run of equal order keys takes the row number of its first row; a max-scan
+        // propagates it across the run
+        auto const run_start_iter = thrust::make_transform_iterator(
+          thrust::make_zip_iterator(value_flags.begin(), row_numbers.begin()),
+          [] __device__(thrust::tuple<size_type, size_type> flag_and_rn) -> size_type {
+            return thrust::get<0>(flag_and_rn) ? thrust::get<1>(flag_and_rn) + 1 : 0;
+          });
+        thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                      group_labels.begin(),
+                                      group_labels.end(),
+                                      run_start_iter,
+                                      sorted_ranks.begin(),
+                                      thrust::equal_to<size_type>{},
+                                      thrust::maximum<size_type>{});
+        break;
+      }
+      default: CUDF_UNREACHABLE("unsupported rank method");
+    }
+    rank_columns.push_back(scatter_to_input_order(sorted_ranks, permutation->view(), stream, mr));
+  }
+
+  auto perm_output = std::make_unique<column>(permutation->view(), stream, mr);
+  return std::pair(std::make_unique<table>(std::move(rank_columns)), std::move(perm_output));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> windowed_ranks(
+  table_view const& group_keys,
+  table_view const& order_keys,
+  std::vector<rank_method> const& methods,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::windowed_ranks(
+    group_keys, order_keys, methods, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
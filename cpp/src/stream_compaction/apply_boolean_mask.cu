@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,9 +27,23 @@
 #include <cudf/utilities/memory_resource.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <cudf/column/column.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/extrema.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <cmath>
+#include <optional>
 
 namespace {
 // Returns true if the mask is true and valid (non-null) for index i
@@ -38,7 +52,7 @@ template <bool has_nulls = true>
 struct boolean_mask_filter {
   boolean_mask_filter(cudf::column_device_view const& boolean_mask) : boolean_mask{boolean_mask} {}
 
-  __device__ inline bool operator()(cudf::size_type i)
+  __device__ inline bool operator()(cudf::size_type i) const
   {
     if (true == has_nulls) {
       bool valid   = boolean_mask.is_valid(i);
@@ -54,6 +68,113 @@ struct boolean_mask_filter {
   cudf::column_device_view boolean_mask;
 };
 
+// Clamps output indices to `bound` so that writes past an optimistically sized
+// buffer all land on a single sacrificial slot instead of out of bounds
+struct clamp_index_fn {
+  cudf::size_type bound;
+  __device__ cudf::size_type operator()(cudf::size_type i) const { return thrust::min(i, bound); }
+};
+
+// Copies the selected values of a single fixed-width column directly to the output,
+// fusing the filter and gather steps into a single pass over the data.
+//
+// The output buffer holds `capacity + 1` elements; any selected element beyond
+// `capacity` is discarded into the spare slot. The true number of selected rows is
+// always reported through `output_size`, so a caller that undersized the buffer
+// (via a selectivity hint) can detect the overflow and retry with an exact size.
+template <typename Filter>
+struct fused_mask_copy_fn {
+  Filter filter;
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_rep_layout_compatible<T>())>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const& input,
+                                           cudf::size_type capacity,
+                                           cudf::size_type& output_size,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+  {
+    auto output       = rmm::device_uvector<T>(capacity + 1, stream, mr);
+    auto const out_it = thrust::make_permutation_iterator(
+      output.begin(),
+      thrust::make_transform_iterator(thrust::counting_iterator<cudf::size_type>(0),
+                                      clamp_index_fn{capacity}));
+    auto const out_end = thrust::copy_if(rmm::exec_policy(stream),
+                                         input.begin<T>(),
+                                         input.end<T>(),
+                                         thrust::counting_iterator<cudf::size_type>(0),
+                                         out_it,
+                                         filter);
+    output_size        = static_cast<cudf::size_type>(thrust::distance(out_it, out_end));
+    if (output_size > capacity) { return nullptr; }  // caller retries with an exact allocation
+
+    auto buffer = output.release();
+    buffer.resize(output_size * sizeof(T), stream);
+    // resize never shrinks the allocation, so release the unused tail; otherwise a highly
+    // selective filter would pin an input-sized buffer for the lifetime of the output column
+    if (output_size < capacity) { buffer.shrink_to_fit(stream); }
+    return std::make_unique<cudf::column>(
+      input.type(), output_size, std::move(buffer), rmm::device_buffer{}, 0);
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_rep_layout_compatible<T>())>
+  std::unique_ptr<cudf::column> operator()(cudf::column_view const&,
+                                           cudf::size_type,
+                                           cudf::size_type&,
+                                           rmm::cuda_stream_view,
+                                           rmm::device_async_resource_ref)
+  {
+    CUDF_FAIL("Unsupported type for fused boolean mask filter");
+  }
+};
+
+// True if every column of `input` can take the fused single-pass path
+bool is_fusible(cudf::table_view const& input)
+{
+  return input.num_rows() > 0 && input.num_columns() > 0 &&
+         std::all_of(input.begin(), input.end(), [](cudf::column_view const& col) {
+           return cudf::is_fixed_width(col.type()) && not cudf::is_fixed_point(col.type()) &&
+                  not col.nullable();
+         });
+}
+
+// Single-pass filter for tables of non-nullable fixed-width columns: selected values
+// are copied straight to the output, skipping the index materialization and gather of
+// the generic path. When `selectivity_hint` is provided the output buffers are sized
+// to `hint * num_rows` rows; if the hint underestimates, the first column's pass
+// reports the exact size and is re-run with an exact allocation.
+template <typename Filter>
+std::unique_ptr<cudf::table> fused_apply_boolean_mask(cudf::table_view const& input,
+                                                      Filter filter,
+                                                      std::optional<double> selectivity_hint,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = input.num_rows();
+  auto capacity       = num_rows;
+  if (selectivity_hint.has_value()) {
+    capacity = std::min(
+      num_rows, static_cast<cudf::size_type>(std::ceil(selectivity_hint.value() * num_rows)));
+  }
+
+  auto output_size = cudf::size_type{0};
+  std::vector<std::unique_ptr<cudf::column>> output_columns;
+  output_columns.reserve(input.num_columns());
+  for (auto const& col : input) {
+    auto output = cudf::type_dispatcher(
+      col.type(), fused_mask_copy_fn<Filter>{filter}, col, capacity, output_size, stream, mr);
+    if (output == nullptr) {  // the hint undersized the buffer; retry exactly
+      capacity = output_size;
+      output   = cudf::type_dispatcher(
+        col.type(), fused_mask_copy_fn<Filter>{filter}, col, capacity, output_size, stream, mr);
+    }
+    if (output_size == 0) { return cudf::empty_like(input); }
+    // later columns allocate exactly the selected row count
+    capacity = output_size;
+    output_columns.push_back(std::move(output));
+  }
+  return std::make_unique<cudf::table>(std::move(output_columns));
+}
+
 }  // namespace
 
 namespace cudf {
@@ -65,6 +186,7 @@ namespace detail {
  */
 std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           column_view const& boolean_mask,
+                                          std::optional<double> selectivity_hint,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr)
 {
@@ -78,12 +200,28 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
 
   if (boolean_mask.has_nulls()) {
+    if (is_fusible(input)) {
+      return fused_apply_boolean_mask(
+        input, boolean_mask_filter<true>{*device_boolean_mask}, selectivity_hint, stream, mr);
+    }
     return detail::copy_if(input, boolean_mask_filter<true>{*device_boolean_mask}, stream, mr);
   } else {
+    if (is_fusible(input)) {
+      return fused_apply_boolean_mask(
+        input, boolean_mask_filter<false>{*device_boolean_mask}, selectivity_hint, stream, mr);
+    }
     return detail::copy_if(input, boolean_mask_filter<false>{*device_boolean_mask}, stream, mr);
   }
 }
 
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          column_view const& boolean_mask,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  return detail::apply_boolean_mask(input, boolean_mask, std::nullopt, stream, mr);
+}
+
 }  // namespace detail
 
 /*
@@ -95,6 +233,23 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::apply_boolean_mask(input, boolean_mask, stream, mr);
+  return detail::apply_boolean_mask(input, boolean_mask, std::nullopt, stream, mr);
+}
+
+/*
+ * Filters a table_view using a column_view of boolean values as a mask, sizing the
+ * output optimistically from a caller-provided selectivity hint.
+ */
+std::unique_ptr<table> apply_boolean_mask(table_view const& input,
+                                          column_view const& boolean_mask,
+                                          double selectivity_hint,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(selectivity_hint > 0.0 && selectivity_hint <= 1.0,
+               "selectivity_hint must be in (0, 1]",
+               std::invalid_argument);
+  return detail::apply_boolean_mask(input, boolean_mask, selectivity_hint, stream, mr);
 }
 }  // namespace cudf
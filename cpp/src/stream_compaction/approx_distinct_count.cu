@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/functional.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Valid range for the HyperLogLog precision (number of register-index bits)
+int32_t constexpr min_hll_precision = 4;
+int32_t constexpr max_hll_precision = 18;
+
+/**
+ * @brief Updates the HyperLogLog registers with the hash of each input row.
+ *
+ * The top `precision` bits of the row hash select a register; the position of the
+ * first set bit in the remaining bits is the candidate rank, kept if it exceeds the
+ * register's current value.
+ */
+template <typename RowHasher>
+struct update_registers_fn {
+  RowHasher hasher;
+  int32_t* registers;
+  int32_t precision;
+
+  __device__ void operator()(size_type row_index) const
+  {
+    auto const hash = static_cast<uint32_t>(hasher(row_index));
+    auto const idx  = hash >> (32 - precision);
+    auto const rest = hash << precision;
+    auto const rank = rest == 0 ? (32 - precision + 1) : (__clz(rest) + 1);
+    atomicMax(registers + idx, rank);
+  }
+};
+
+/// Bias-correction constant for a register count of `num_registers`
+double hll_alpha(size_type num_registers)
+{
+  switch (num_registers) {
+    case 16: return 0.673;
+    case 32: return 0.697;
+    case 64: return 0.709;
+    default: return 0.7213 / (1.0 + 1.079 / num_registers);
+  }
+}
+
+/// Builds the raw int32 registers for the rows of `input`
+rmm::device_uvector<int32_t> compute_registers(table_view const& input,
+                                               int32_t precision,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const num_registers = size_type{1} << precision;
+  auto registers           = rmm::device_uvector<int32_t>(num_registers, stream);
+  thrust::fill(rmm::exec_policy(stream), registers.begin(), registers.end(), 0);
+  if (input.num_rows() == 0) { return registers; }
+
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls  = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
+  auto const hash_key   = row_hasher.device_hasher(has_nulls);
+
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::counting_iterator<size_type>(0),
+                   thrust::counting_iterator<size_type>(input.num_rows()),
+                   update_registers_fn<std::decay_t<decltype(hash_key)>>{
+                     hash_key, registers.data(), precision});
+  return registers;
+}
+
+/// Validates that `sketch` is a well-formed HyperLogLog register column
+void check_sketch(column_view const& sketch)
+{
+  CUDF_EXPECTS(sketch.type().id() == type_id::UINT8,
+               "HyperLogLog sketch must be a UINT8 column",
+               cudf::data_type_error);
+  CUDF_EXPECTS(not sketch.has_nulls(), "HyperLogLog sketch must not contain nulls");
+  auto const size = sketch.size();
+  CUDF_EXPECTS(size >= (size_type{1} << min_hll_precision) and (size & (size - 1)) == 0,
+               "HyperLogLog sketch size must be a power of two register count");
+}
+
+}  // namespace
+
+std::unique_ptr<column> hyperloglog_sketch(table_view const& input,
+                                           int32_t precision,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(precision >= min_hll_precision and precision <= max_hll_precision,
+               "HyperLogLog precision must be in [4, 18]",
+               std::invalid_argument);
+  CUDF_EXPECTS(input.num_columns() > 0, "At least one key column is required");
+
+  auto const registers     = compute_registers(input, precision, stream);
+  auto const num_registers = static_cast<size_type>(registers.size());
+  auto sketch              = cudf::make_numeric_column(
+    data_type{type_id::UINT8}, num_registers, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    registers.begin(),
+                    registers.end(),
+                    sketch->mutable_view().begin<uint8_t>(),
+                    [] __device__(int32_t rank) { return static_cast<uint8_t>(rank); });
+  return sketch;
+}
+
+std::unique_ptr<column> merge_hyperloglog_sketches(host_span<column_view const> sketches,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(not sketches.empty(), "At least one sketch is required to merge");
+  std::for_each(sketches.begin(), sketches.end(), check_sketch);
+  auto const num_registers = sketches.front().size();
+  CUDF_EXPECTS(std::all_of(sketches.begin(),
+                           sketches.end(),
+                           [&](auto const& s) { return s.size() == num_registers; }),
+               "All sketches must have the same register count (precision)");
+
+  auto merged = cudf::make_numeric_column(
+    data_type{type_id::UINT8}, num_registers, mask_state::UNALLOCATED, stream, mr);
+  auto out = merged->mutable_view().begin<uint8_t>();
+  thrust::copy(
+    rmm::exec_policy(stream), sketches.front().begin<uint8_t>(), sketches.front().end<uint8_t>(), out);
+  std::for_each(sketches.begin() + 1, sketches.end(), [&](auto const& sketch) {
+    thrust::transform(rmm::exec_policy(stream),
+                      sketch.begin<uint8_t>(),
+                      sketch.end<uint8_t>(),
+                      out,
+                      out,
+                      [] __device__(uint8_t lhs, uint8_t rhs) { return lhs > rhs ? lhs : rhs; });
+  });
+  return merged;
+}
+
+double approx_distinct_count(column_view const& sketch, rmm::cuda_stream_view stream)
+{
+  check_sketch(sketch);
+  auto const num_registers = sketch.size();
+
+  auto const sum   = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    sketch.begin<uint8_t>(),
+    sketch.end<uint8_t>(),
+    [] __device__(uint8_t rank) { return exp2(-static_cast<double>(rank)); },
+    0.0,
+    thrust::plus<double>{});
+  auto const zeros = thrust::count(
+    rmm::exec_policy(stream), sketch.begin<uint8_t>(), sketch.end<uint8_t>(), uint8_t{0});
+
+  auto const m        = static_cast<double>(num_registers);
+  auto estimate       = hll_alpha(num_registers) * m * m / sum;
+  auto constexpr pow32 = 4294967296.0;  // 2^32, the row hash range
+  if (estimate <= 2.5 * m and zeros > 0) {
+    // small-range correction: linear counting on the empty registers
+    estimate = m * std::log(m / static_cast<double>(zeros));
+  } else if (estimate > pow32 / 30.0) {
+    // large-range correction for 32-bit hash saturation
+    estimate = -pow32 * std::log1p(-estimate / pow32);
+  }
+  return estimate;
+}
+
+double approx_distinct_count(table_view const& input,
+                             int32_t precision,
+                             rmm::cuda_stream_view stream)
+{
+  auto const sketch =
+    hyperloglog_sketch(input, precision, stream, cudf::get_current_device_resource_ref());
+  return approx_distinct_count(sketch->view(), stream);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> hyperloglog_sketch(table_view const& input,
+                                           int32_t precision,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hyperloglog_sketch(input, precision, stream, mr);
+}
+
+std::unique_ptr<column> merge_hyperloglog_sketches(host_span<column_view const> sketches,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_hyperloglog_sketches(sketches, stream, mr);
+}
+
+double approx_distinct_count(column_view const& sketch, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(sketch, stream);
+}
+
+double approx_distinct_count(table_view const& input,
+                             int32_t precision,
+                             rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(input, precision, stream);
+}
+
+}  // namespace cudf
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+
+std::unique_ptr<table> apply_boolean_mask(chunked_table_view const& input,
+                                          chunked_table_view const& boolean_mask,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(boolean_mask.num_chunks() == input.num_chunks(),
+               "Mask must have one chunk per input chunk");
+
+  if (input.num_chunks() == 0) { return std::make_unique<table>(); }
+
+  CUDF_EXPECTS(boolean_mask.num_columns() == 1 and
+                 boolean_mask.chunk(0).column(0).type() == data_type{type_id::BOOL8},
+               "Mask chunks must be a single BOOL8 column");
+  if (input.num_chunks() == 1) {
+    return cudf::detail::apply_boolean_mask(
+      input.chunk(0), boolean_mask.chunk(0).column(0), stream, mr);
+  }
+
+  // Filter each chunk against its mask chunk; only the surviving rows are concatenated, so the
+  // copy cost scales with the output rather than the input
+  auto const temp_mr = cudf::get_current_device_resource_ref();
+  auto partials      = std::vector<std::unique_ptr<table>>{};
+  for (size_type chunk = 0; chunk < input.num_chunks(); ++chunk) {
+    CUDF_EXPECTS(boolean_mask.chunk(chunk).num_rows() == input.chunk(chunk).num_rows(),
+                 "Mask chunk row counts must match the input chunks");
+    partials.push_back(cudf::detail::apply_boolean_mask(
+      input.chunk(chunk), boolean_mask.chunk(chunk).column(0), stream, temp_mr));
+  }
+
+  auto partial_views = std::vector<table_view>{};
+  std::transform(partials.begin(),
+                 partials.end(),
+                 std::back_inserter(partial_views),
+                 [](auto const& partial) { return partial->view(); });
+  return cudf::detail::concatenate(partial_views, stream, mr);
+}
+
+}  // namespace cudf
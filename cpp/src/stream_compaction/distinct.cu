@@ -17,19 +17,25 @@
 #include "distinct_helpers.hpp"
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/join.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/gather.h>
 
 #include <utility>
 #include <vector>
@@ -168,4 +174,77 @@ std::unique_ptr<column> distinct_indices(table_view const& input,
   return std::make_unique<column>(std::move(indices), rmm::device_buffer{}, 0);
 }
 
+streaming_distinct::streaming_distinct(std::vector<size_type> keys, null_equality nulls_equal)
+  : _keys{std::move(keys)}, _nulls_equal{nulls_equal}, _history_keys{nullptr}
+{
+  CUDF_EXPECTS(not _keys.empty(), "Key column indices must not be empty", std::invalid_argument);
+}
+
+streaming_distinct::~streaming_distinct()                         = default;
+streaming_distinct::streaming_distinct(streaming_distinct&&) noexcept = default;
+
+size_type streaming_distinct::distinct_count() const noexcept
+{
+  return _history_keys == nullptr ? 0 : _history_keys->num_rows();
+}
+
+std::unique_ptr<table> streaming_distinct::insert(table_view const& batch,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const batch_keys = batch.select(_keys);
+  if (batch.num_rows() == 0) { return empty_like(batch); }
+
+  // First level: deduplicate within the batch with an exact set sized only for the batch
+  auto novel_map = detail::distinct_indices(batch_keys,
+                                            duplicate_keep_option::KEEP_ANY,
+                                            _nulls_equal,
+                                            nan_equality::ALL_EQUAL,
+                                            stream,
+                                            cudf::get_current_device_resource_ref());
+
+  // Second level: probe the surviving rows against the retained history; this is a lookup
+  // only, so the historical rows are never re-inserted into a hash set
+  if (_history_keys != nullptr and _history_keys->num_rows() > 0) {
+    auto const surviving_keys = detail::gather(batch_keys,
+                                               novel_map,
+                                               out_of_bounds_policy::DONT_CHECK,
+                                               negative_index_policy::NOT_ALLOWED,
+                                               stream,
+                                               cudf::get_current_device_resource_ref());
+    auto const unseen         = left_anti_join(surviving_keys->view(),
+                                       _history_keys->view(),
+                                       _nulls_equal,
+                                       stream,
+                                       cudf::get_current_device_resource_ref());
+    auto composed             = rmm::device_uvector<size_type>(unseen->size(), stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   unseen->begin(),
+                   unseen->end(),
+                   novel_map.begin(),
+                   composed.begin());
+    novel_map = std::move(composed);
+  }
+
+  auto result = detail::gather(batch,
+                               novel_map,
+                               out_of_bounds_policy::DONT_CHECK,
+                               negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               mr);
+
+  // Retain the keys of the newly emitted rows as history for subsequent batches
+  auto const result_keys = result->view().select(_keys);
+  if (_history_keys == nullptr or _history_keys->num_rows() == 0) {
+    _history_keys =
+      std::make_unique<table>(result_keys, stream, cudf::get_current_device_resource_ref());
+  } else if (result_keys.num_rows() > 0) {
+    _history_keys = detail::concatenate(std::vector<table_view>{_history_keys->view(), result_keys},
+                                        stream,
+                                        cudf::get_current_device_resource_ref());
+  }
+  return result;
+}
+
 }  // namespace cudf
@@ -39,6 +39,39 @@ rmm::device_uvector<size_type> reduce_by_row(distinct_set_t<RowEqual>& set,
     return output_indices;
   }
 
+  // For `KEEP_FIRST`/`KEEP_LAST`, resolve the representative of each group of equal rows
+  // directly in the set: the stored key is a row index, and replacing it with the index of any
+  // equal row preserves the probing invariants since equal rows hash the same and compare equal.
+  // This way the distinct indices can be taken straight from the set with no auxiliary
+  // reduction buffer or extra scan over the input rows.
+  if (keep == duplicate_keep_option::KEEP_FIRST or keep == duplicate_keep_option::KEEP_LAST) {
+    auto set_ref = set.ref(cuco::op::insert_and_find);
+
+    thrust::for_each(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator(0),
+                     thrust::make_counting_iterator(num_rows),
+                     [set_ref, keep] __device__(size_type const idx) mutable {
+                       auto const [inserted_idx_ptr, inserted] = set_ref.insert_and_find(idx);
+                       if (inserted) { return; }  // the insert already stored this row's index
+
+                       auto ref =
+                         cuda::atomic_ref<size_type, cuda::thread_scope_device>{*inserted_idx_ptr};
+                       if (keep == duplicate_keep_option::KEEP_FIRST) {
+                         // Store the smallest index of all rows that are equal.
+                         ref.fetch_min(idx, cuda::memory_order_relaxed);
+                       } else {
+                         // Store the greatest index of all rows that are equal.
+                         ref.fetch_max(idx, cuda::memory_order_relaxed);
+                       }
+                     });
+
+    auto const output_end = set.retrieve_all(output_indices.begin(), stream.value());
+    output_indices.resize(thrust::distance(output_indices.begin(), output_end), stream);
+    return output_indices;
+  }
+
+  // `KEEP_NONE` needs the size of each group of equal rows, which cannot be kept in the set
+  // itself, so reduce into an auxiliary buffer indexed by the group representative.
   auto reduction_results = rmm::device_uvector<size_type>(num_rows, stream, mr);
   thrust::uninitialized_fill(rmm::exec_policy_nosync(stream),
                              reduction_results.begin(),
@@ -50,50 +83,27 @@ rmm::device_uvector<size_type> reduce_by_row(distinct_set_t<RowEqual>& set,
   thrust::for_each(rmm::exec_policy_nosync(stream),
                    thrust::make_counting_iterator(0),
                    thrust::make_counting_iterator(num_rows),
-                   [set_ref, keep, reduction_results = reduction_results.begin()] __device__(
+                   [set_ref, reduction_results = reduction_results.begin()] __device__(
                      size_type const idx) mutable {
                      auto const [inserted_idx_ptr, _] = set_ref.insert_and_find(idx);
 
+                     // Count the number of rows in each group of rows that are compared equal.
                      auto ref = cuda::atomic_ref<size_type, cuda::thread_scope_device>{
                        reduction_results[*inserted_idx_ptr]};
-                     if (keep == duplicate_keep_option::KEEP_FIRST) {
-                       // Store the smallest index of all rows that are equal.
-                       ref.fetch_min(idx, cuda::memory_order_relaxed);
-                     } else if (keep == duplicate_keep_option::KEEP_LAST) {
-                       // Store the greatest index of all rows that are equal.
-                       ref.fetch_max(idx, cuda::memory_order_relaxed);
-                     } else {
-                       // Count the number of rows in each group of rows that are compared equal.
-                       ref.fetch_add(size_type{1}, cuda::memory_order_relaxed);
-                     }
+                     ref.fetch_add(size_type{1}, cuda::memory_order_relaxed);
                    });
 
-  auto const map_end = [&] {
-    if (keep == duplicate_keep_option::KEEP_NONE) {
-      // Reduction results with `KEEP_NONE` are either group sizes of equal rows, or `0`.
-      // Thus, we only output index of the rows in the groups having group size of `1`.
-      return thrust::copy_if(
-        rmm::exec_policy(stream),
-        thrust::make_counting_iterator(0),
-        thrust::make_counting_iterator(num_rows),
-        output_indices.begin(),
-        cuda::proclaim_return_type<bool>(
-          [reduction_results = reduction_results.begin()] __device__(auto const idx) {
-            return reduction_results[idx] == size_type{1};
-          }));
-    }
-
-    // Reduction results with `KEEP_FIRST` and `KEEP_LAST` are row indices of the first/last row in
-    // each group of equal rows (which are the desired output indices), or the value given by
-    // `reduction_init_value()`.
-    return thrust::copy_if(
-      rmm::exec_policy(stream),
-      reduction_results.begin(),
-      reduction_results.end(),
-      output_indices.begin(),
-      cuda::proclaim_return_type<bool>([init_value = reduction_init_value(keep)] __device__(
-                                         auto const idx) { return idx != init_value; }));
-  }();
+  // Reduction results with `KEEP_NONE` are either group sizes of equal rows, or `0`.
+  // Thus, we only output index of the rows in the groups having group size of `1`.
+  auto const map_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_rows),
+    output_indices.begin(),
+    cuda::proclaim_return_type<bool>(
+      [reduction_results = reduction_results.begin()] __device__(auto const idx) {
+        return reduction_results[idx] == size_type{1};
+      }));
 
   output_indices.resize(thrust::distance(output_indices.begin(), map_end), stream);
   return output_indices;
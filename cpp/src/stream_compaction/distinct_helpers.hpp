@@ -73,11 +73,10 @@ using distinct_set_t =
  * - If `keep == KEEP_LAST`: max of row indices in the group.
  * - If `keep == KEEP_NONE`: count of equivalent rows (group size).
  *
- * Note that this function is not needed when `keep == KEEP_NONE`.
- *
- * At the beginning of the operation, the entire output array is filled with a value given by
- * the `reduction_init_value()` function. Then, the reduction result for each row group is written
- * into the output array at the index of an unspecified row in the group.
+ * For `KEEP_FIRST` and `KEEP_LAST`, the reduction is performed directly on the row index stored
+ * in the hash set slot of each group, so the distinct indices are retrieved straight from the
+ * set. Only `KEEP_NONE` reduces into an auxiliary array, which is initialized with the value
+ * given by the `reduction_init_value()` function.
  *
  * @tparam RowEqual The type of row equality comparator
  *
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/iterator/counting_iterator.h>
+
+namespace {
+
+// Returns true if the mask is true and valid (non-null) for index i
+template <bool has_nulls>
+struct selection_mask_filter {
+  cudf::column_device_view boolean_mask;
+
+  __device__ inline bool operator()(cudf::size_type i) const
+  {
+    if constexpr (has_nulls) {
+      return boolean_mask.is_valid(i) && boolean_mask.data<bool>()[i];
+    } else {
+      return boolean_mask.data<bool>()[i];
+    }
+  }
+};
+
+template <typename Filter>
+std::unique_ptr<cudf::column> compact_indices(cudf::size_type num_rows,
+                                              Filter filter,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  auto indices       = rmm::device_uvector<cudf::size_type>(num_rows, stream, mr);
+  auto const end     = thrust::copy_if(rmm::exec_policy(stream),
+                                   thrust::counting_iterator<cudf::size_type>(0),
+                                   thrust::counting_iterator<cudf::size_type>(num_rows),
+                                   indices.begin(),
+                                   filter);
+  auto const num_selected = static_cast<cudf::size_type>(thrust::distance(indices.begin(), end));
+  auto buffer             = indices.release();
+  buffer.resize(num_selected * sizeof(cudf::size_type), stream);
+  return std::make_unique<cudf::column>(cudf::data_type{cudf::type_id::INT32},
+                                        num_selected,
+                                        std::move(buffer),
+                                        rmm::device_buffer{},
+                                        0);
+}
+
+}  // namespace
+
+namespace cudf {
+
+selection_vector::selection_vector(std::unique_ptr<column>&& indices, size_type source_size)
+  : _indices{std::move(indices)}, _source_size{source_size}
+{
+  CUDF_EXPECTS(_indices != nullptr, "Indices column must not be null");
+  CUDF_EXPECTS(_indices->type().id() == type_id::INT32, "Indices must be INT32 type");
+}
+
+selection_vector::~selection_vector() = default;
+
+column_view selection_vector::indices() const { return _indices->view(); }
+
+size_type selection_vector::num_selected() const { return _indices->size(); }
+
+namespace detail {
+
+selection_vector make_selection_vector(column_view const& boolean_mask,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+
+  auto const num_rows      = boolean_mask.size();
+  auto device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+
+  auto indices =
+    boolean_mask.has_nulls()
+      ? compact_indices(num_rows, selection_mask_filter<true>{*device_boolean_mask}, stream, mr)
+      : compact_indices(num_rows, selection_mask_filter<false>{*device_boolean_mask}, stream, mr);
+  return selection_vector{std::move(indices), num_rows};
+}
+
+std::unique_ptr<table> apply_selection_vector(table_view const& input,
+                                              selection_vector const& selection,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  // zero-size inputs are OK, but otherwise input size must match the selection's source size
+  CUDF_EXPECTS(input.num_rows() == 0 || input.num_rows() == selection.source_size(),
+               "Column size mismatch");
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  // the indices are guaranteed in-bounds, so bounds checking is skipped
+  return detail::gather(input,
+                        selection.indices(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+selection_vector make_selection_vector(column_view const& boolean_mask,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_selection_vector(boolean_mask, stream, mr);
+}
+
+std::unique_ptr<table> apply_selection_vector(table_view const& input,
+                                              selection_vector const& selection,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_selection_vector(input, selection, stream, mr);
+}
+
+}  // namespace cudf
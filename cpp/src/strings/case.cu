@@ -26,6 +26,7 @@
 #include <cudf/strings/detail/char_tables.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -265,6 +266,33 @@ struct ascii_converter_fn {
   __device__ char operator()(char chr) { return converter.process_ascii(chr); }
 };
 
+/**
+ * @brief Case-flips 8 ASCII bytes per load using SWAR arithmetic
+ *
+ * The per-byte range tests use carry-less addition which is only valid when
+ * no byte has its high bit set; callers must have already established the
+ * data is ASCII-only. Flipping bit 0x20 converts the case of ASCII letters.
+ */
+struct ascii_swar_fn {
+  bool flip_upper;  // convert [A-Z] characters (to_lower, swapcase)
+  bool flip_lower;  // convert [a-z] characters (to_upper, swapcase)
+
+  __device__ uint64_t operator()(uint64_t word) const
+  {
+    constexpr uint64_t high_bits = 0x8080'8080'8080'8080ULL;
+    uint64_t flips               = 0;
+    if (flip_upper) {
+      // byte >= 'A' sets the high bit; byte > 'Z' sets the high bit
+      flips |= ((word + 0x3F3F'3F3F'3F3F'3F3FULL) & ~(word + 0x2525'2525'2525'2525ULL)) & high_bits;
+    }
+    if (flip_lower) {
+      // byte >= 'a' sets the high bit; byte > 'z' sets the high bit
+      flips |= ((word + 0x1F1F'1F1F'1F1F'1F1FULL) & ~(word + 0x0505'0505'0505'0505ULL)) & high_bits;
+    }
+    return word ^ (flips >> 2);  // move each 0x80 marker onto the 0x20 case bit
+  }
+};
+
 constexpr int64_t block_size       = 512;
 constexpr int64_t bytes_per_thread = 8;
 
@@ -335,8 +363,11 @@ std::unique_ptr<column> convert_case(strings_column_view const& input,
   convert_char_fn ccfn{case_flag, d_flags, d_cases, d_special};
   upper_lower_fn converter{ccfn, *d_strings};
 
-  // For smaller strings, use the regular string-parallel algorithm
-  if ((chars_size / (input.size() - input.null_count())) < AVG_CHAR_BYTES_THRESHOLD) {
+  // For smaller strings, use the regular string-parallel algorithm;
+  // block-per-string columns also run the warp kernels until block variants exist
+  if (compute_string_parallelism(
+        chars_size, input.size(), input.null_count(), AVG_CHAR_BYTES_THRESHOLD) ==
+      string_parallelism::THREAD_PER_STRING) {
     auto [offsets, chars] = make_strings_children(converter, input.size(), stream, mr);
     return make_strings_column(input.size(),
                                std::move(offsets),
@@ -356,11 +387,21 @@ std::unique_ptr<column> convert_case(strings_column_view const& input,
   has_multibytes_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
     input_chars, first_offset, last_offset, mb_count.data());
   if (mb_count.value(stream) == 0) {
-    // optimization for ASCII-only case: copy the input column and inplace replace each character
+    // optimization for ASCII-only case: copy the input column and inplace replace each character;
+    // most of the data is processed 8 bytes per load using SWAR bit arithmetic
     auto result  = std::make_unique<column>(input.parent(), stream, mr);
     auto d_chars = result->mutable_view().head<char>();
+    ascii_swar_fn swar{(case_flag & IS_UPPER(0xFF)) != 0, (case_flag & IS_LOWER(0xFF)) != 0};
+    auto const num_words = chars_size / static_cast<int64_t>(sizeof(uint64_t));
+    if (num_words > 0) {
+      auto d_words = reinterpret_cast<uint64_t*>(d_chars);
+      thrust::transform(
+        rmm::exec_policy_nosync(stream), d_words, d_words + num_words, d_words, swar);
+    }
+    // remaining tail bytes are processed one at a time
+    auto const d_tail = d_chars + (num_words * static_cast<int64_t>(sizeof(uint64_t)));
     thrust::transform(
-      rmm::exec_policy(stream), d_chars, d_chars + chars_size, d_chars, ascii_converter_fn{ccfn});
+      rmm::exec_policy(stream), d_tail, d_chars + chars_size, d_tail, ascii_converter_fn{ccfn});
     result->set_null_count(input.null_count());
     return result;
   }
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/convert/fixed_point_to_string.cuh>
+#include <cudf/strings/detail/convert/float_to_string.cuh>
+#include <cudf/strings/detail/convert/int_to_string.cuh>
+#include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Formats a single element of a typed column into the output buffer.
+ *
+ * Returns the number of bytes the formatted value occupies. When `d_buffer` is null only the size
+ * is computed, so the same functor serves both phases of `make_strings_children`.
+ */
+struct format_element_fn {
+  template <typename T>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type idx,
+                                  char* d_buffer) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const d_str = d_column.element<string_view>(idx);
+      if (d_buffer) { copy_string(d_buffer, d_str); }
+      return d_str.size_bytes();
+    } else if constexpr (std::is_same_v<T, bool>) {
+      auto const value = d_column.element<bool>(idx);
+      auto const size  = value ? 4 : 5;
+      if (d_buffer) { memcpy(d_buffer, value ? "true" : "false", size); }
+      return size;
+    } else if constexpr (cudf::is_integral_not_bool<T>()) {
+      auto const value = d_column.element<T>(idx);
+      return d_buffer ? integer_to_string(value, d_buffer) : count_digits(value);
+    } else if constexpr (cudf::is_floating_point<T>()) {
+      ftos_converter fts;
+      auto const value = static_cast<double>(d_column.element<T>(idx));
+      return static_cast<size_type>(d_buffer ? fts.float_to_string(value, d_buffer)
+                                             : fts.compute_ftos_size(value));
+    } else if constexpr (cudf::is_fixed_point<T>()) {
+      auto const value = d_column.element<device_storage_type_t<T>>(idx);
+      auto const scale = d_column.type().scale();
+      if (d_buffer) { fixed_point_to_string(value, scale, d_buffer); }
+      return fixed_point_string_size(value, scale);
+    } else {
+      CUDF_UNREACHABLE("unsupported type for typed concatenate");
+    }
+  }
+};
+
+/**
+ * @brief Typed concatenate functor.
+ *
+ * Walks the row across all columns, formatting each value in place with `format_element_fn` and
+ * applying the separator, in the same style as `concat_strings_fn` for all-string inputs.
+ */
+struct concat_typed_fn {
+  table_device_view const d_table;
+  string_view const d_separator;
+  string_scalar_device_view const d_narep;
+  separator_on_nulls separate_nulls;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type idx)
+  {
+    if (!d_narep.is_valid() &&
+        thrust::any_of(thrust::seq, d_table.begin(), d_table.end(), [idx](auto const& col) {
+          return col.is_null(idx);
+        })) {
+      if (!d_chars) { d_sizes[idx] = 0; }
+      return;
+    }
+
+    char* d_buffer       = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    size_type bytes      = 0;
+    bool write_separator = false;
+
+    for (auto itr = d_table.begin(); itr < d_table.end(); ++itr) {
+      auto const d_column     = *itr;
+      bool const null_element = d_column.is_null(idx);
+
+      if (write_separator && (separate_nulls == separator_on_nulls::YES || !null_element)) {
+        if (d_buffer) d_buffer = detail::copy_string(d_buffer, d_separator);
+        bytes += d_separator.size_bytes();
+        write_separator = false;
+      }
+
+      if (null_element) {
+        auto const d_str = d_narep.value();
+        if (d_buffer) d_buffer = detail::copy_string(d_buffer, d_str);
+        bytes += d_str.size_bytes();
+      } else {
+        auto const size =
+          type_dispatcher(d_column.type(), format_element_fn{}, d_column, idx, d_buffer);
+        if (d_buffer) d_buffer += size;
+        bytes += size;
+      }
+
+      write_separator =
+        write_separator || (separate_nulls == separator_on_nulls::YES) || !null_element;
+    }
+
+    if (!d_chars) { d_sizes[idx] = bytes; }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> concatenate_typed(table_view const& columns,
+                                          string_scalar const& separator,
+                                          string_scalar const& narep,
+                                          separator_on_nulls separate_nulls,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  auto const num_columns = columns.num_columns();
+  CUDF_EXPECTS(num_columns > 1, "At least two columns must be specified");
+  // check all columns can be formatted inline
+  CUDF_EXPECTS(std::all_of(columns.begin(),
+                           columns.end(),
+                           [](auto c) {
+                             return c.type().id() == type_id::STRING or is_numeric(c.type()) or
+                                    is_fixed_point(c.type());
+                           }),
+               "All columns must be of string, numeric, or fixed-point types",
+               cudf::data_type_error);
+  auto const strings_count = columns.num_rows();
+  if (strings_count == 0)  // empty begets empty
+    return make_empty_column(type_id::STRING);
+
+  CUDF_EXPECTS(separator.is_valid(stream), "Parameter separator must be a valid string_scalar");
+  string_view d_separator(separator.data(), separator.size());
+  auto d_narep = get_scalar_device_view(const_cast<string_scalar&>(narep));
+
+  // Create device views from the input columns; values are formatted in the sizing and
+  // writing passes themselves so no intermediate string columns are materialized.
+  auto d_table = table_device_view::create(columns, stream);
+  concat_typed_fn fn{*d_table, d_separator, d_narep, separate_nulls};
+  auto [offsets_column, chars] = make_strings_children(fn, strings_count, stream, mr);
+
+  // create resulting null mask
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(strings_count),
+    [d_table = *d_table, d_narep] __device__(size_type idx) {
+      if (d_narep.is_valid()) return true;
+      return !thrust::any_of(
+        thrust::seq, d_table.begin(), d_table.end(), [idx](auto col) { return col.is_null(idx); });
+    },
+    stream,
+    mr);
+
+  return make_strings_column(
+    strings_count, std::move(offsets_column), chars.release(), null_count, std::move(null_mask));
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<column> concatenate_typed(table_view const& columns,
+                                          string_scalar const& separator,
+                                          string_scalar const& narep,
+                                          separator_on_nulls separate_nulls,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::concatenate_typed(columns, separator, narep, separate_nulls, stream, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -23,8 +23,10 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/find.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/memory_resource.hpp>
@@ -51,6 +53,9 @@ struct contains_fn {
     if (d_strings.is_null(idx)) return false;
     auto const d_str = d_strings.element<string_view>(idx);
 
+    // an unanchored containment query can run the DFA when one was compiled
+    if (!beginning_only && prog.has_dfa()) { return prog.dfa_contains(d_str); }
+
     size_type end = beginning_only ? 1    // match only the beginning of the string;
                                    : -1;  // match anywhere in the string
     return prog.find(thread_idx, d_str, d_str.begin(), end).has_value();
@@ -63,6 +68,29 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr)
 {
+  // patterns that reduce to a plain literal search dispatch to the
+  // specialized find kernels instead of the regex executor
+  auto const literal = regex_device_builder::get_prog(prog).as_literal();
+  if (literal.form != literal_form::NONE) {
+    auto const target = string_scalar(literal.chars, true, stream);
+    if (beginning_only) {
+      // matching from the beginning makes an unanchored literal a prefix
+      if (literal.form == literal_form::CONTAINS || literal.form == literal_form::PREFIX) {
+        return strings::starts_with(input, target, stream, mr);
+      }
+    } else {
+      if (literal.form == literal_form::CONTAINS) {
+        return strings::contains(input, target, stream, mr);
+      }
+      if (literal.form == literal_form::PREFIX) {
+        return strings::starts_with(input, target, stream, mr);
+      }
+      if (literal.form == literal_form::SUFFIX) {
+        return strings::ends_with(input, target, stream, mr);
+      }
+    }
+  }
+
   auto results = make_numeric_column(data_type{type_id::BOOL8},
                                      input.size(),
                                      cudf::detail::copy_bitmask(input.parent(), stream, mr),
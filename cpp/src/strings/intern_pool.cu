@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/strings/intern_pool.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/count.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+
+intern_pool::intern_pool(rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
+  : _keys{make_empty_column(type_id::STRING)},
+    _sorted_ids{make_empty_column(type_id::INT32)},
+    _mr{mr}
+{
+}
+
+intern_pool::~intern_pool() = default;
+
+std::unique_ptr<column> intern_pool::intern(strings_column_view const& input,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto const num_rows = input.size();
+  if (num_rows == 0) { return make_empty_column(type_id::INT32); }
+
+  auto const temp_mr = cudf::get_current_device_resource_ref();
+
+  // Distinct batch strings plus the per-row mapping into them
+  auto const encoded =
+    dictionary::detail::encode(input.parent(), data_type{type_id::INT32}, stream, temp_mr);
+  auto const dictionary     = dictionary_column_view(encoded->view());
+  auto const batch_keys     = dictionary.keys();
+  auto const num_batch_keys = batch_keys.size();
+
+  // Resolve each distinct batch string to a stable pool id: found strings keep their existing
+  // id, novel ones get the next ids in batch key order
+  auto batch_ids = rmm::device_uvector<size_type>(num_batch_keys, stream);
+  if (num_batch_keys > 0) {
+    auto const pool_size  = num_keys();
+    auto const batch_view = table_view{{batch_keys}};
+
+    auto found                   = rmm::device_uvector<bool>(num_batch_keys, stream);
+    auto positions               = std::unique_ptr<column>{};
+    auto sorted_keys             = std::unique_ptr<table>{};
+    size_type const* d_positions = nullptr;
+    if (pool_size == 0) {
+      thrust::fill(rmm::exec_policy(stream), found.begin(), found.end(), false);
+    } else {
+      sorted_keys = cudf::detail::gather(table_view{{_keys->view()}},
+                                         _sorted_ids->view(),
+                                         out_of_bounds_policy::DONT_CHECK,
+                                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                         stream,
+                                         temp_mr);
+      positions   = cudf::detail::lower_bound(sorted_keys->view(),
+                                            batch_view,
+                                            {order::ASCENDING},
+                                            {null_order::BEFORE},
+                                            stream,
+                                            temp_mr);
+      d_positions = positions->view().begin<size_type>();
+
+      auto const comparator = cudf::experimental::row::equality::two_table_comparator(
+        sorted_keys->view(), batch_view, stream);
+      auto const d_equal = comparator.equal_to<false>(nullate::DYNAMIC{false});
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_batch_keys),
+                        found.begin(),
+                        [d_positions, d_equal, pool_size] __device__(size_type i) {
+                          using cudf::experimental::row::lhs_index_type;
+                          using cudf::experimental::row::rhs_index_type;
+                          auto const pos = d_positions[i];
+                          return pos < pool_size and
+                                 d_equal(lhs_index_type{pos}, rhs_index_type{i});
+                        });
+    }
+
+    auto novel_ranks = rmm::device_uvector<size_type>(num_batch_keys, stream);
+    thrust::transform_exclusive_scan(
+      rmm::exec_policy(stream),
+      found.begin(),
+      found.end(),
+      novel_ranks.begin(),
+      [] __device__(bool is_found) -> size_type { return is_found ? 0 : 1; },
+      size_type{0},
+      thrust::plus<size_type>{});
+
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_batch_keys),
+      batch_ids.begin(),
+      [d_found = found.data(),
+       d_positions,
+       d_ranks      = novel_ranks.data(),
+       d_sorted_ids = _sorted_ids->view().begin<size_type>(),
+       pool_size] __device__(size_type i) {
+        return d_found[i] ? d_sorted_ids[d_positions[i]] : pool_size + d_ranks[i];
+      });
+
+    // Append the novel strings and refresh the sorted lookup order
+    auto const num_novel = static_cast<size_type>(
+      thrust::count(rmm::exec_policy(stream), found.begin(), found.end(), false));
+    if (num_novel > 0) {
+      auto novel_indices = rmm::device_uvector<size_type>(num_novel, stream);
+      thrust::copy_if(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_batch_keys),
+                      found.begin(),
+                      novel_indices.begin(),
+                      thrust::logical_not<bool>{});
+      auto const novel_keys =
+        cudf::detail::gather(batch_view,
+                             device_span<size_type const>{novel_indices},
+                             out_of_bounds_policy::DONT_CHECK,
+                             cudf::detail::negative_index_policy::NOT_ALLOWED,
+                             stream,
+                             temp_mr);
+      _keys = cudf::detail::concatenate(
+        std::vector<column_view>{_keys->view(), novel_keys->view().column(0)}, stream, _mr);
+      _sorted_ids = cudf::detail::sorted_order(
+        table_view{{_keys->view()}}, {order::ASCENDING}, {null_order::BEFORE}, stream, _mr);
+    }
+  }
+
+  // Map each row's batch key index to its pool id. Null rows carry the one-past-the-end index
+  // the dictionary encode leaves behind, so clamp before the lookup; their output is masked.
+  auto output = make_numeric_column(data_type{type_id::INT32},
+                                    num_rows,
+                                    cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                    input.null_count(),
+                                    stream,
+                                    mr);
+  if (num_batch_keys > 0) {
+    auto const indices = dictionary.indices();
+    thrust::transform(rmm::exec_policy(stream),
+                      indices.begin<int32_t>(),
+                      indices.end<int32_t>(),
+                      output->mutable_view().begin<int32_t>(),
+                      [d_batch_ids = batch_ids.data(), num_batch_keys] __device__(int32_t index) {
+                        return d_batch_ids[min(index, num_batch_keys - 1)];
+                      });
+  }
+  return output;
+}
+
+std::unique_ptr<column> intern_pool::decode(column_view const& ids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(ids.type() == data_type{type_id::INT32},
+               "Key ids must be of type INT32",
+               cudf::data_type_error);
+
+  if (ids.is_empty()) { return make_empty_column(type_id::STRING); }
+
+  // Null ids are sent out of bounds so the gather nullifies them
+  auto const d_ids     = column_device_view::create(ids, stream);
+  auto gather_map      = rmm::device_uvector<size_type>(ids.size(), stream);
+  auto const pool_size = num_keys();
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(ids.size()),
+                    gather_map.begin(),
+                    [ids = *d_ids, pool_size] __device__(size_type i) {
+                      return ids.is_valid(i) ? ids.element<int32_t>(i) : pool_size;
+                    });
+
+  auto result = cudf::detail::gather(table_view{{_keys->view()}},
+                                     device_span<size_type const>{gather_map},
+                                     out_of_bounds_policy::NULLIFY,
+                                     cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                     stream,
+                                     mr);
+  return std::move(result->release().front());
+}
+
+column_view intern_pool::keys() const { return _keys->view(); }
+
+size_type intern_pool::num_keys() const { return _keys->size(); }
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "strings/regex/redfa.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+constexpr char32_t max_char = std::numeric_limits<char32_t>::max();
+
+// a DFA state is the sorted set of NFA instruction ids active at once
+using inst_set = std::vector<int32_t>;
+
+/**
+ * @brief Adds the epsilon closure of instruction `id` to `closure`.
+ *
+ * Only consuming instructions and END survive in the closure; epsilon
+ * instructions (OR, LBRA/RBRA, NOP) are followed through. Returns false
+ * when an instruction the DFA cannot express is reached.
+ */
+bool add_closure(reprog const& prog, int32_t id, std::set<int32_t>& closure)
+{
+  if (id < 0) { return true; }
+  auto const inst = prog.insts_data()[id];
+  switch (inst.type) {
+    case CHAR:
+    case ANY:
+    case ANYNL:
+    case END: closure.insert(id); return true;
+    case CCLASS:
+      // builtin classes depend on the codepoint flags table which the
+      // range-based DFA transitions cannot encode
+      if (prog.class_at(inst.u1.cls_id).builtins != 0) { return false; }
+      closure.insert(id);
+      return true;
+    case OR:
+      return add_closure(prog, inst.u1.right_id, closure) &&
+             add_closure(prog, inst.u2.left_id, closure);
+    case LBRA:
+    case RBRA:
+    case NOP: return add_closure(prog, inst.u2.next_id, closure);
+    default: return false;  // BOL, EOL, BOW, NBOW, NCCLASS
+  }
+}
+
+/**
+ * @brief Returns the character ranges matched by a consuming instruction.
+ */
+std::vector<reclass_range> inst_ranges(reprog const& prog, int32_t id)
+{
+  auto const inst = prog.insts_data()[id];
+  switch (inst.type) {
+    case CHAR: return {{inst.u1.c, inst.u1.c}};
+    case ANY:
+      // '.' does not match new-line
+      return {{0, '\n' - 1}, {'\n' + 1, max_char}};
+    case ANYNL: return {{0, max_char}};
+    case CCLASS: {
+      auto const& cls = prog.class_at(inst.u1.cls_id);
+      return cls.literals;
+    }
+    default: return {};
+  }
+}
+
+}  // namespace
+
+std::optional<redfa> build_dfa(reprog const& prog)
+{
+  if (prog.insts_count() == 0) { return std::nullopt; }
+
+  // the start closure is folded into every successor set (an implicit
+  // leading ".*") so the DFA performs an unanchored containment scan
+  std::set<int32_t> start_closure;
+  if (!add_closure(prog, prog.get_start_inst(), start_closure)) { return std::nullopt; }
+
+  auto const is_accepting = [&](inst_set const& insts) {
+    return std::any_of(insts.begin(), insts.end(), [&](auto id) {
+      return prog.insts_data()[id].type == END;
+    });
+  };
+
+  inst_set const start_state(start_closure.begin(), start_closure.end());
+
+  redfa dfa;
+  std::map<inst_set, int32_t> state_ids;
+  std::vector<inst_set> states;
+  std::deque<int32_t> work;
+
+  auto const intern_state = [&](inst_set const& insts) {
+    auto const [itr, inserted] = state_ids.emplace(insts, static_cast<int32_t>(states.size()));
+    if (inserted) {
+      states.push_back(insts);
+      work.push_back(itr->second);
+    }
+    return itr->second;
+  };
+  intern_state(start_state);
+
+  std::vector<std::vector<redfa_transition>> state_transitions;
+  std::vector<int32_t> state_defaults;
+
+  while (!work.empty()) {
+    if (static_cast<int32_t>(states.size()) > MAX_DFA_STATES) { return std::nullopt; }
+    auto const state_id = work.front();
+    work.pop_front();
+    auto const insts = states[state_id];
+
+    state_transitions.resize(states.size());
+    state_defaults.resize(states.size(), 0);
+
+    // the scan stops on the first accepting state; no transitions needed
+    if (is_accepting(insts)) { continue; }
+
+    // partition the character space at every range boundary of every
+    // instruction in this state, then compute one successor set per interval
+    std::set<char32_t> boundaries;
+    for (auto const id : insts) {
+      for (auto const& range : inst_ranges(prog, id)) {
+        boundaries.insert(range.first);
+        if (range.last < max_char) { boundaries.insert(range.last + 1); }
+      }
+    }
+
+    std::vector<redfa_transition> transitions;
+    auto boundary = boundaries.begin();
+    while (boundary != boundaries.end()) {
+      auto const first = *boundary;
+      ++boundary;
+      auto const last = (boundary == boundaries.end()) ? max_char : *boundary - 1;
+
+      std::set<int32_t> successor = start_closure;
+      bool any_match              = false;
+      for (auto const id : insts) {
+        auto const ranges = inst_ranges(prog, id);
+        auto const hit    = std::any_of(ranges.begin(), ranges.end(), [&](auto const& range) {
+          return first >= range.first && first <= range.last;
+        });
+        if (hit) {
+          any_match = true;
+          if (!add_closure(prog, prog.insts_data()[id].u2.next_id, successor)) {
+            return std::nullopt;
+          }
+        }
+      }
+      if (!any_match) { continue; }  // interval falls through to the default
+
+      auto const next = intern_state(inst_set(successor.begin(), successor.end()));
+      // merge with the previous transition when the ranges are adjacent
+      if (!transitions.empty() && transitions.back().next_state == next &&
+          transitions.back().last + 1 == first) {
+        transitions.back().last = last;
+      } else {
+        transitions.push_back(redfa_transition{first, last, next});
+      }
+    }
+    state_transitions.resize(states.size());
+    state_defaults.resize(states.size(), 0);
+    state_transitions[state_id] = std::move(transitions);
+    // characters matching no instruction restart the unanchored scan
+    state_defaults[state_id] = intern_state(start_state);
+
+    auto const total_transitions = std::accumulate(
+      state_transitions.begin(),
+      state_transitions.end(),
+      std::size_t{0},
+      [](auto sum, auto const& t) { return sum + t.size(); });
+    if (total_transitions > static_cast<std::size_t>(MAX_DFA_TRANSITIONS)) {
+      return std::nullopt;
+    }
+  }
+
+  state_transitions.resize(states.size());
+  state_defaults.resize(states.size(), 0);
+
+  // flatten into the device-friendly layout
+  auto const num_states = static_cast<int32_t>(states.size());
+  dfa.offsets.reserve(num_states + 1);
+  dfa.offsets.push_back(0);
+  for (int32_t s = 0; s < num_states; ++s) {
+    dfa.transitions.insert(
+      dfa.transitions.end(), state_transitions[s].begin(), state_transitions[s].end());
+    dfa.offsets.push_back(static_cast<int32_t>(dfa.transitions.size()));
+  }
+  dfa.defaults = std::move(state_defaults);
+  dfa.accepts.resize(num_states);
+  std::transform(states.begin(), states.end(), dfa.accepts.begin(), [&](auto const& insts) {
+    return static_cast<uint8_t>(is_accepting(insts));
+  });
+
+  return dfa;
+}
+
+std::shared_ptr<redfa const> get_cached_dfa(std::string_view pattern,
+                                            regex_flags flags,
+                                            reprog const& prog)
+{
+  constexpr std::size_t max_cache_entries = 256;
+
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, std::shared_ptr<redfa const>> cache;
+
+  auto key = std::string(pattern);
+  key.push_back('\x01');
+  key.append(std::to_string(static_cast<uint32_t>(flags)));
+
+  std::lock_guard<std::mutex> guard(cache_mutex);
+  auto const found = cache.find(key);
+  if (found != cache.end()) { return found->second; }
+
+  auto built = build_dfa(prog);
+  auto entry = built.has_value() ? std::make_shared<redfa const>(std::move(*built))
+                                 : std::shared_ptr<redfa const>{};
+  if (cache.size() >= max_cache_entries) { cache.clear(); }
+  cache.emplace(std::move(key), entry);
+  return entry;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
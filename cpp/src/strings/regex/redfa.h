@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "strings/regex/regcomp.h"
+
+#include <cudf/strings/regex/flags.hpp>
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+constexpr int32_t MAX_DFA_STATES      = 128;   ///< Subset construction state cap
+constexpr int32_t MAX_DFA_TRANSITIONS = 2048;  ///< Total transition-range cap
+
+/**
+ * @brief A single DFA transition: characters in [first,last] move to next_state.
+ *
+ * Characters are compared in the same UTF-8 encoded form used by the NFA
+ * CHAR and CCLASS instructions.
+ */
+struct alignas(16) redfa_transition {
+  char32_t first;
+  char32_t last;
+  int32_t next_state;
+};
+
+/**
+ * @brief Deterministic automaton built from a compiled regex program.
+ *
+ * The automaton encodes an unanchored containment scan: the NFA start state
+ * is folded into every successor set (an implicit leading `.*`) so a single
+ * left-to-right pass over a string answers whether any match exists. It
+ * cannot report match positions or capture groups; callers needing those
+ * must execute the NFA.
+ *
+ * State 0 is the start state. Transitions for state `s` are
+ * `transitions[offsets[s]..offsets[s+1])`; characters matching none of them
+ * move to `defaults[s]`. Accepting states carry no transitions since the
+ * scan stops on the first accept.
+ */
+struct redfa {
+  std::vector<int32_t> offsets;              // per-state transition offsets; size states+1
+  std::vector<redfa_transition> transitions; // sorted, non-overlapping ranges per state
+  std::vector<int32_t> defaults;             // per-state fallback next state
+  std::vector<uint8_t> accepts;              // per-state accept flag
+
+  [[nodiscard]] int32_t states_count() const { return static_cast<int32_t>(accepts.size()); }
+};
+
+/**
+ * @brief Builds a DFA from a compiled regex program by subset construction.
+ *
+ * Returns std::nullopt when the program uses features a containment DFA
+ * cannot express (anchors, word boundaries, negated or builtin classes) or
+ * when the construction exceeds the state or transition caps -- callers fall
+ * back to the NFA in that case.
+ *
+ * @param prog Compiled regex program
+ * @return The DFA, or std::nullopt if the pattern is not DFA-able
+ */
+std::optional<redfa> build_dfa(reprog const& prog);
+
+/**
+ * @brief Returns the DFA for a pattern from the process-wide cache,
+ * building and inserting it on first use.
+ *
+ * Failed builds are cached as well so pathological patterns pay the
+ * construction cost only once. Returns nullptr when no DFA is available.
+ *
+ * @param pattern Regex pattern the program was compiled from
+ * @param flags Flags the program was compiled with
+ * @param prog Compiled regex program for the pattern
+ * @return Shared DFA instance or nullptr
+ */
+std::shared_ptr<redfa const> get_cached_dfa(std::string_view pattern,
+                                            regex_flags flags,
+                                            reprog const& prog);
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
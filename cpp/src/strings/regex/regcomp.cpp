@@ -1052,6 +1052,58 @@ reprog reprog::create_from(std::string_view pattern,
   return rtn;
 }
 
+literal_pattern reprog::as_literal() const
+{
+  literal_pattern result;
+  std::string chars;
+  bool anchored_begin = false;
+  bool anchored_end   = false;
+  bool at_start       = true;
+
+  auto id = _startinst_id;
+  while (id >= 0 && id < insts_count()) {
+    auto const& inst = _insts[id];
+    switch (inst.type) {
+      case LBRA:
+      case RBRA:
+        // capture brackets do not change what the pattern matches
+        id = inst.u2.next_id;
+        break;
+      case BOL:
+        // only absolute start anchors: plain '^' (non-multiline) or \A
+        if (!at_start || (inst.u1.c != '\n' && inst.u1.c != 'A')) { return result; }
+        anchored_begin = true;
+        id             = inst.u2.next_id;
+        break;
+      case EOL:
+        // only \Z anchors the absolute end; '$' also matches before a
+        // trailing new-line and so is not equivalent to a suffix search
+        if (inst.u1.c != 'Z') { return result; }
+        anchored_end = true;
+        id           = inst.u2.next_id;
+        break;
+      case CHAR: {
+        if (anchored_end) { return result; }
+        char buffer[4];
+        auto const bytes = from_char_utf8(inst.u1.c, buffer);
+        chars.append(buffer, bytes);
+        at_start = false;
+        id       = inst.u2.next_id;
+        break;
+      }
+      case END:
+        if (chars.empty()) { return result; }
+        result.form = anchored_begin
+                        ? (anchored_end ? literal_form::EXACT : literal_form::PREFIX)
+                        : (anchored_end ? literal_form::SUFFIX : literal_form::CONTAINS);
+        result.chars = std::move(chars);
+        return result;
+      default: return result;
+    }
+  }
+  return result;
+}
+
 void reprog::optimize() { collapse_nops(); }
 
 void reprog::finalize() { build_start_ids(); }
@@ -91,6 +91,25 @@ struct reinst {
   int32_t reserved4;
 };
 
+/**
+ * @brief Shape of a pattern that reduces to a plain literal search.
+ */
+enum class literal_form : int32_t {
+  NONE,      ///< not a literal pattern
+  CONTAINS,  ///< unanchored literal, e.g. "foo"
+  PREFIX,    ///< start-anchored literal, e.g. "^foo" or "\Afoo"
+  SUFFIX,    ///< absolute-end-anchored literal, e.g. "foo\Z"
+  EXACT      ///< literal anchored at both ends
+};
+
+/**
+ * @brief A literal pattern recognized by reprog::as_literal.
+ */
+struct literal_pattern {
+  literal_form form{literal_form::NONE};
+  std::string chars;  ///< UTF-8 encoded literal characters
+};
+
 /**
  * @brief Regex program handles parsing a pattern into a vector
  * of chained instructions.
@@ -137,6 +156,20 @@ class reprog {
   void set_start_inst(int32_t id);
   [[nodiscard]] int32_t get_start_inst() const;
 
+  /**
+   * @brief Classifies this program as a plain literal search when possible.
+   *
+   * Recognizes instruction chains of only CHAR instructions, optionally
+   * anchored by BOL at the start or an absolute-end EOL (`\Z`) at the end.
+   * A `$` anchor is not treated as a suffix since it also matches before a
+   * trailing new-line. Capture brackets are transparent as they do not
+   * change what the pattern matches.
+   *
+   * @return The literal form and characters; form is literal_form::NONE
+   * when the program is not a literal search
+   */
+  [[nodiscard]] literal_pattern as_literal() const;
+
   void optimize();
   void finalize();
   void check_for_errors();
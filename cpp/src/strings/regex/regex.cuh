@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "strings/regex/redfa.h"
 #include "strings/regex/regcomp.h"
 
 #include <cudf/strings/regex/flags.hpp>
@@ -88,6 +89,21 @@ class reprog_device {
   static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
     reprog const& prog, rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Create device program instance from a regex program and an
+   * optional DFA built from the same program
+   *
+   * The DFA tables are stored alongside the program data and enable the
+   * `dfa_contains` fast path. Pass nullptr when no DFA is available.
+   *
+   * @param prog The regex program to create from
+   * @param dfa DFA built from `prog`, or nullptr
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The program device object
+   */
+  static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
+    reprog const& prog, redfa const* dfa, rmm::cuda_stream_view stream);
+
   /**
    * @brief Called automatically by the unique_ptr returned from create().
    */
@@ -211,6 +227,25 @@ class reprog_device {
                                                        cudf::size_type end,
                                                        cudf::size_type const group_id) const;
 
+  /**
+   * @brief Returns true if a DFA was compiled for this program.
+   *
+   * The DFA supports only the `dfa_contains` containment query; position
+   * and capture queries must use find/extract.
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE bool has_dfa() const { return _dfa_states_count > 0; }
+
+  /**
+   * @brief Returns true if the pattern matches anywhere in the given string.
+   *
+   * Runs the compiled DFA in a single pass over the string with no working
+   * memory. Only valid when `has_dfa()` returns true.
+   *
+   * @param d_str The string to search
+   * @return true if any match exists
+   */
+  [[nodiscard]] __device__ inline bool dfa_contains(string_view const d_str) const;
+
  private:
   struct reljunk {
     relist* __restrict__ list1;
@@ -265,6 +300,12 @@ class reprog_device {
   int32_t const* _startinst_ids{};    // array of start instruction ids
   reclass_device const* _classes{};   // array of regex classes
 
+  int32_t _dfa_states_count{};                 // number of DFA states; 0 = no DFA
+  redfa_transition const* _dfa_transitions{};  // flattened DFA transition ranges
+  int32_t const* _dfa_offsets{};               // per-state offsets into _dfa_transitions
+  int32_t const* _dfa_defaults{};              // per-state fallback states
+  uint8_t const* _dfa_accepts{};               // per-state accept flags
+
   std::size_t _prog_size{};  // total size of this instance
   void* _buffer{};           // working memory buffer
   int32_t _thread_count{};   // threads available in working memory
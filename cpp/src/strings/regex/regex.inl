@@ -421,6 +421,32 @@ __device__ __forceinline__ match_result reprog_device::regexec(string_view const
   return match ? match_result({begin, end}) : cuda::std::nullopt;
 }
 
+__device__ __forceinline__ bool reprog_device::dfa_contains(string_view const d_str) const
+{
+  // state 0 accepting means the pattern matches the empty string
+  if (_dfa_accepts[0]) { return true; }
+
+  int32_t state = 0;
+  auto itr      = d_str.begin();
+  while (itr.byte_offset() < d_str.size_bytes()) {
+    auto const chr = static_cast<char32_t>(*itr);
+    // characters outside this state's ranges fall through to the default state
+    auto next = _dfa_defaults[state];
+    for (auto t = _dfa_offsets[state]; t < _dfa_offsets[state + 1]; ++t) {
+      auto const transition = _dfa_transitions[t];
+      if (chr < transition.first) { break; }  // ranges are sorted
+      if (chr <= transition.last) {
+        next = transition.next_state;
+        break;
+      }
+    }
+    state = next;
+    if (_dfa_accepts[state]) { return true; }
+    ++itr;
+  }
+  return false;
+}
+
 __device__ __forceinline__ match_result reprog_device::find(int32_t const thread_idx,
                                                             string_view const dstr,
                                                             string_view::const_iterator begin,
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "redfa.h"
 #include "regcomp.h"
 #include "regex.cuh"
 
@@ -41,9 +42,14 @@ struct regex_program::regex_program_impl {
 };
 
 struct regex_device_builder {
+  static detail::reprog const& get_prog(regex_program const& p) { return p._impl->prog; }
+
   static auto create_prog_device(regex_program const& p, rmm::cuda_stream_view stream)
   {
-    return detail::reprog_device::create(p._impl->prog, stream);
+    // the cache returns nullptr for patterns a DFA cannot express; those
+    // programs simply run the NFA as before
+    auto const dfa = detail::get_cached_dfa(p.pattern(), p.flags(), p._impl->prog);
+    return detail::reprog_device::create(p._impl->prog, dfa.get(), stream);
   }
 };
 
@@ -47,6 +47,12 @@ reprog_device::reprog_device(reprog const& prog)
 
 std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
   reprog const& h_prog, rmm::cuda_stream_view stream)
+{
+  return create(h_prog, nullptr, stream);
+}
+
+std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
+  reprog const& h_prog, redfa const* dfa, rmm::cuda_stream_view stream)
 {
   // compute size to hold all the member data
   auto const insts_count   = h_prog.insts_count();
@@ -63,9 +69,23 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
                           std::plus<std::size_t>{},
                           [](auto& cls) { return cls.literals.size() * sizeof(reclass_range); });
   // make sure each section is aligned for the subsequent section's data type
-  auto const memsize = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
-                       cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
-                       cudf::util::round_up_safe(classes_size, sizeof(char32_t));
+  auto const prog_memsize = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
+                            cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
+                            cudf::util::round_up_safe(classes_size, sizeof(char32_t));
+
+  // the DFA tables are appended after the program data: transition ranges
+  // first (widest alignment), then offsets, defaults, and accept flags
+  auto const dfa_states = (dfa != nullptr) ? dfa->states_count() : 0;
+  auto const dfa_base   = cudf::util::round_up_safe(prog_memsize, alignof(redfa_transition));
+  auto const dfa_transitions_size = dfa_states ? dfa->transitions.size() * sizeof(redfa_transition)
+                                               : std::size_t{0};
+  auto const dfa_offsets_size  = dfa_states ? dfa->offsets.size() * sizeof(int32_t) : std::size_t{0};
+  auto const dfa_defaults_size = dfa_states ? dfa->defaults.size() * sizeof(int32_t) : std::size_t{0};
+  auto const dfa_accepts_size  = dfa_states ? dfa->accepts.size() * sizeof(uint8_t) : std::size_t{0};
+  auto const memsize =
+    dfa_states ? dfa_base + dfa_transitions_size + dfa_offsets_size + dfa_defaults_size +
+                   dfa_accepts_size
+               : prog_memsize;
 
   // allocate memory to store all the prog data in a flat contiguous buffer
   auto h_buffer =
@@ -111,9 +131,34 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     d_end += h_class.literals.size() * sizeof(reclass_range);
   }
 
+  if (dfa_states > 0) {
+    auto h_dfa = h_buffer.data() + dfa_base;
+    auto d_dfa = d_buffer->data() + dfa_base;
+
+    memcpy(h_dfa, dfa->transitions.data(), dfa_transitions_size);
+    d_prog->_dfa_transitions = reinterpret_cast<redfa_transition const*>(d_dfa);
+    h_dfa += dfa_transitions_size;
+    d_dfa += dfa_transitions_size;
+
+    memcpy(h_dfa, dfa->offsets.data(), dfa_offsets_size);
+    d_prog->_dfa_offsets = reinterpret_cast<int32_t const*>(d_dfa);
+    h_dfa += dfa_offsets_size;
+    d_dfa += dfa_offsets_size;
+
+    memcpy(h_dfa, dfa->defaults.data(), dfa_defaults_size);
+    d_prog->_dfa_defaults = reinterpret_cast<int32_t const*>(d_dfa);
+    h_dfa += dfa_defaults_size;
+    d_dfa += dfa_defaults_size;
+
+    memcpy(h_dfa, dfa->accepts.data(), dfa_accepts_size);
+    d_prog->_dfa_accepts      = reinterpret_cast<uint8_t const*>(d_dfa);
+    d_prog->_dfa_states_count = dfa_states;
+  }
+
   // initialize the rest of the elements
   d_prog->_max_insts = insts_count;
-  d_prog->_prog_size = memsize + sizeof(reprog_device);
+  // the DFA tables are excluded; they are always read from global memory
+  d_prog->_prog_size = prog_memsize + sizeof(reprog_device);
 
   // copy flat prog to device memory
   cudf::detail::cuda_memcpy_async<u_char>(*d_buffer, h_buffer, stream);
@@ -26,6 +26,7 @@
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -512,9 +513,8 @@ std::unique_ptr<column> replace_multiple(strings_column_view const& input,
   if (repls.size() > 1)
     CUDF_EXPECTS(repls.size() == targets.size(), "Sizes for targets and repls must match");
 
-  return (input.size() == input.null_count() ||
-          ((input.chars_size(stream) / (input.size() - input.null_count())) <
-           AVG_CHAR_BYTES_THRESHOLD))
+  return compute_string_parallelism(input, stream, AVG_CHAR_BYTES_THRESHOLD) ==
+             string_parallelism::THREAD_PER_STRING
            ? replace_string_parallel(input, targets, repls, stream, mr)
            : replace_character_parallel(input, targets, repls, stream, mr);
 }
@@ -185,8 +185,10 @@ void find_utility(strings_column_view const& input,
 {
   auto d_strings = column_device_view::create(input.parent(), stream);
   auto d_results = output.mutable_view().data<size_type>();
-  if ((input.chars_size(stream) / (input.size() - input.null_count())) > AVG_CHAR_BYTES_THRESHOLD) {
-    // warp-per-string runs faster for longer strings (but not shorter ones)
+  if (compute_string_parallelism(input, stream, AVG_CHAR_BYTES_THRESHOLD) !=
+      string_parallelism::THREAD_PER_STRING) {
+    // warp-per-string runs faster for longer strings (but not shorter ones);
+    // this also covers block-per-string columns until a block variant exists
     constexpr int block_size = 256;
     cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
     finder_warp_parallel_fn<TargetIterator, forward>
@@ -541,9 +543,8 @@ std::unique_ptr<column> contains(strings_column_view const& input,
                                  rmm::device_async_resource_ref mr)
 {
   // use warp parallel when the average string width is greater than the threshold
-  if ((input.null_count() < input.size()) &&
-      ((input.chars_size(stream) / (input.size() - input.null_count())) >
-       AVG_CHAR_BYTES_THRESHOLD)) {
+  if (compute_string_parallelism(input, stream, AVG_CHAR_BYTES_THRESHOLD) !=
+      string_parallelism::THREAD_PER_STRING) {
     return contains_warp_parallel(input, target, stream, mr);
   }
 
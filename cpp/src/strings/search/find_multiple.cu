@@ -18,23 +18,219 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <array>
+#include <queue>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+
+/**
+ * @brief Minimum number of targets to build an Aho-Corasick automaton
+ *
+ * Below this the automaton build and transfer overhead outweighs the
+ * O(targets x chars) cost of searching each target separately.
+ */
+constexpr size_type AC_TARGETS_THRESHOLD = 16;
+
+constexpr int32_t ALPHABET_SIZE = 256;  // automaton transitions are per byte
+
+/**
+ * @brief Aho-Corasick automaton over the target strings
+ *
+ * The goto and failure functions are baked into a dense per-byte transition
+ * table so the device scan is a single table lookup per input byte.
+ * Matches for a state (including those inherited through suffix links) are
+ * stored flattened in out_ids addressed by out_offsets.
+ */
+struct aho_corasick_automaton {
+  rmm::device_uvector<int32_t> transitions;   // states x ALPHABET_SIZE
+  rmm::device_uvector<int32_t> out_offsets;   // states + 1
+  rmm::device_uvector<int32_t> out_ids;       // flattened matching target ids
+  rmm::device_uvector<size_type> char_widths;  // character count per target
+};
+
+/**
+ * @brief Builds the automaton on the host from the targets column
+ */
+aho_corasick_automaton build_aho_corasick(strings_column_view const& targets,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const targets_count = targets.size();
+  auto const first_offset  = (targets.offset() == 0) ? 0L
+                                                     : cudf::strings::detail::get_offset_value(
+                                                        targets.offsets(), targets.offset(), stream);
+  auto const last_offset =
+    cudf::strings::detail::get_offset_value(targets.offsets(), targets.offset() + targets_count, stream);
+
+  auto const h_chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(targets.chars_begin(stream) + first_offset,
+                            static_cast<std::size_t>(last_offset - first_offset)),
+    stream);
+  auto const h_offsets = [&] {
+    std::vector<int64_t> result(targets_count + 1);
+    if (targets.offsets().type().id() == type_id::INT32) {
+      auto const v = cudf::detail::make_std_vector_sync(
+        device_span<int32_t const>(targets.offsets().data<int32_t>() + targets.offset(),
+                                   static_cast<std::size_t>(targets_count) + 1),
+        stream);
+      std::transform(v.begin(), v.end(), result.begin(), [first_offset](int32_t o) {
+        return static_cast<int64_t>(o) - first_offset;
+      });
+    } else {
+      auto const v = cudf::detail::make_std_vector_sync(
+        device_span<int64_t const>(targets.offsets().data<int64_t>() + targets.offset(),
+                                   static_cast<std::size_t>(targets_count) + 1),
+        stream);
+      std::transform(
+        v.begin(), v.end(), result.begin(), [first_offset](int64_t o) { return o - first_offset; });
+    }
+    return result;
+  }();
+
+  // build the trie; node 0 is the root
+  std::vector<std::array<int32_t, ALPHABET_SIZE>> nodes(1);
+  nodes.front().fill(-1);
+  std::vector<std::vector<int32_t>> outputs(1);
+  std::vector<size_type> char_widths(targets_count);
+  for (size_type tgt = 0; tgt < targets_count; ++tgt) {
+    auto const begin = h_chars.data() + h_offsets[tgt];
+    auto const bytes = static_cast<size_type>(h_offsets[tgt + 1] - h_offsets[tgt]);
+    char_widths[tgt] = static_cast<size_type>(std::count_if(begin, begin + bytes, [](char chr) {
+      return !is_utf8_continuation_char(static_cast<u_char>(chr));
+    }));
+    int32_t node = 0;
+    for (size_type i = 0; i < bytes; ++i) {
+      auto const chr = static_cast<u_char>(begin[i]);
+      if (nodes[node][chr] < 0) {
+        nodes[node][chr] = static_cast<int32_t>(nodes.size());
+        nodes.emplace_back().fill(-1);
+        outputs.emplace_back();
+      }
+      node = nodes[node][chr];
+    }
+    outputs[node].push_back(tgt);  // empty targets land on the root
+  }
+
+  // breadth-first pass computes failure links, folds them into the transition
+  // table, and merges each node's outputs with its suffix node's outputs
+  auto const states_count = static_cast<int32_t>(nodes.size());
+  std::vector<int32_t> failure(states_count, 0);
+  std::queue<int32_t> queue;
+  for (int32_t chr = 0; chr < ALPHABET_SIZE; ++chr) {
+    auto const child = nodes[0][chr];
+    if (child < 0) {
+      nodes[0][chr] = 0;
+    } else {
+      queue.push(child);
+    }
+  }
+  while (!queue.empty()) {
+    auto const node = queue.front();
+    queue.pop();
+    auto const& suffix_outputs = outputs[failure[node]];
+    outputs[node].insert(outputs[node].end(), suffix_outputs.begin(), suffix_outputs.end());
+    for (int32_t chr = 0; chr < ALPHABET_SIZE; ++chr) {
+      auto const child = nodes[node][chr];
+      if (child < 0) {
+        nodes[node][chr] = nodes[failure[node]][chr];
+      } else {
+        failure[child] = nodes[failure[node]][chr];
+        queue.push(child);
+      }
+    }
+  }
+
+  // flatten for the device
+  std::vector<int32_t> h_transitions(static_cast<std::size_t>(states_count) * ALPHABET_SIZE);
+  std::vector<int32_t> h_out_offsets(states_count + 1, 0);
+  std::vector<int32_t> h_out_ids;
+  for (int32_t node = 0; node < states_count; ++node) {
+    std::copy(nodes[node].begin(),
+              nodes[node].end(),
+              h_transitions.begin() + (static_cast<std::size_t>(node) * ALPHABET_SIZE));
+    h_out_ids.insert(h_out_ids.end(), outputs[node].begin(), outputs[node].end());
+    h_out_offsets[node + 1] = static_cast<int32_t>(h_out_ids.size());
+  }
+
+  auto const mr = cudf::get_current_device_resource_ref();
+  return aho_corasick_automaton{
+    cudf::detail::make_device_uvector_async(h_transitions, stream, mr),
+    cudf::detail::make_device_uvector_async(h_out_offsets, stream, mr),
+    cudf::detail::make_device_uvector_async(h_out_ids, stream, mr),
+    cudf::detail::make_device_uvector_async(char_widths, stream, mr)};
+}
+
+/**
+ * @brief Finds the first position of every target in each string in one pass
+ *
+ * Walks the automaton over the string's bytes recording the first match per
+ * target. Match positions are converted to character positions by counting
+ * character start bytes during the same pass.
+ */
+struct find_automaton_fn {
+  column_device_view const d_strings;
+  size_type targets_count;
+  int32_t const* d_transitions;
+  int32_t const* d_out_offsets;
+  int32_t const* d_out_ids;
+  size_type const* d_char_widths;
+  int32_t* d_results;
+
+  __device__ void emit_matches(int32_t state, size_type char_count, int32_t* results) const
+  {
+    for (auto k = d_out_offsets[state]; k < d_out_offsets[state + 1]; ++k) {
+      auto const tgt = d_out_ids[k];
+      if (results[tgt] < 0) { results[tgt] = char_count - d_char_widths[tgt]; }
+    }
+  }
+
+  __device__ void operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return; }
+    auto const d_str  = d_strings.element<string_view>(idx);
+    auto const data   = d_str.data();
+    auto const bytes  = d_str.size_bytes();
+    auto results      = d_results + (static_cast<int64_t>(idx) * targets_count);
+    int32_t state     = 0;
+    size_type char_count = 0;
+    emit_matches(state, char_count, results);  // empty targets match at position 0
+    for (size_type i = 0; i < bytes; ++i) {
+      auto const chr = static_cast<u_char>(data[i]);
+      char_count += !is_utf8_continuation_char(chr);
+      state = d_transitions[(static_cast<int64_t>(state) * ALPHABET_SIZE) + chr];
+      if (d_out_offsets[state] != d_out_offsets[state + 1]) {
+        emit_matches(state, char_count, results);
+      }
+    }
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> find_multiple(strings_column_view const& input,
                                       strings_column_view const& targets,
                                       rmm::cuda_stream_view stream,
@@ -48,27 +244,45 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
 
   auto strings_column = column_device_view::create(input.parent(), stream);
   auto d_strings      = *strings_column;
-  auto targets_column = column_device_view::create(targets.parent(), stream);
-  auto d_targets      = *targets_column;
 
   auto const total_count = strings_count * targets_count;
 
   // create output column
   auto results = make_numeric_column(
     data_type{type_id::INT32}, total_count, rmm::device_buffer{0, stream, mr}, 0, stream, mr);
+  auto d_results = results->mutable_view().begin<int32_t>();
+
+  if (targets_count >= AC_TARGETS_THRESHOLD) {
+    // search all targets in a single pass over the chars
+    auto const automaton = build_aho_corasick(targets, stream);
+    thrust::fill(rmm::exec_policy_nosync(stream), d_results, d_results + total_count, -1);
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       strings_count,
+                       find_automaton_fn{d_strings,
+                                         targets_count,
+                                         automaton.transitions.data(),
+                                         automaton.out_offsets.data(),
+                                         automaton.out_ids.data(),
+                                         automaton.char_widths.data(),
+                                         d_results});
+  } else {
+    auto targets_column = column_device_view::create(targets.parent(), stream);
+    auto d_targets      = *targets_column;
 
-  // fill output column with position values
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(total_count),
-                    results->mutable_view().begin<int32_t>(),
-                    [d_strings, d_targets, targets_count] __device__(size_type idx) {
-                      size_type str_idx = idx / targets_count;
-                      if (d_strings.is_null(str_idx)) return -1;
-                      string_view d_str = d_strings.element<string_view>(str_idx);
-                      string_view d_tgt = d_targets.element<string_view>(idx % targets_count);
-                      return d_str.find(d_tgt);
-                    });
+    // fill output column with position values
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(total_count),
+                      d_results,
+                      [d_strings, d_targets, targets_count] __device__(size_type idx) {
+                        size_type str_idx = idx / targets_count;
+                        if (d_strings.is_null(str_idx)) return -1;
+                        string_view d_str = d_strings.element<string_view>(str_idx);
+                        string_view d_tgt = d_targets.element<string_view>(idx % targets_count);
+                        return d_str.find(d_tgt);
+                      });
+  }
   results->set_null_count(0);
 
   auto offsets = cudf::detail::sequence(strings_count + 1,
@@ -23,6 +23,7 @@
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/slice.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
@@ -255,7 +256,9 @@ std::unique_ptr<column> compute_substrings_from_fn(strings_column_view const& in
 
   auto const d_column = column_device_view::create(input.parent(), stream);
 
-  if ((input.chars_size(stream) / (input.size() - input.null_count())) < AVG_CHAR_BYTES_THRESHOLD) {
+  // block-per-string columns also run the warp kernel until a block variant exists
+  if (compute_string_parallelism(input, stream, AVG_CHAR_BYTES_THRESHOLD) ==
+      string_parallelism::THREAD_PER_STRING) {
     thrust::transform(rmm::exec_policy(stream),
                       thrust::counting_iterator<size_type>(0),
                       thrust::counting_iterator<size_type>(input.size()),
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "split.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator_factory.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/strings/detail/convert/string_to_float.cuh>
+#include <cudf/strings/detail/convert/string_to_int.cuh>
+#include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/split/split.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <stdexcept>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+/**
+ * @brief Converts the tokens for one output column into a typed column
+ *
+ * A null-pointer token marks a missing token (or a null input row) and
+ * produces a null entry in the output column. Conversion of valid tokens
+ * follows the same rules as to_integers() and to_floats().
+ */
+struct tokens_to_column_fn {
+  device_span<string_index_pair const> tokens;
+
+  template <typename T,
+            CUDF_ENABLE_IF(cudf::is_integral_not_bool<T>() or cudf::is_floating_point<T>())>
+  std::unique_ptr<column> operator()(rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    auto const d_tokens = tokens.data();
+
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(static_cast<size_type>(tokens.size())),
+      [d_tokens] __device__(size_type idx) { return d_tokens[idx].first != nullptr; },
+      stream,
+      mr);
+
+    auto results = make_numeric_column(data_type{type_to_id<T>()},
+                                       static_cast<size_type>(tokens.size()),
+                                       std::move(null_mask),
+                                       null_count,
+                                       stream,
+                                       mr);
+
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      tokens.begin(),
+                      tokens.end(),
+                      results->mutable_view().begin<T>(),
+                      [] __device__(string_index_pair const& token) -> T {
+                        if (token.first == nullptr) { return T{0}; }
+                        auto const d_str = string_view{token.first, token.second};
+                        if constexpr (std::is_floating_point_v<T>) {
+                          return static_cast<T>(stod(d_str));
+                        }
+                        return static_cast<T>(string_to_integer(d_str));
+                      });
+    return results;
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_integral_not_bool<T>() and not cudf::is_floating_point<T>())>
+  std::unique_ptr<column> operator()(rmm::cuda_stream_view, rmm::device_async_resource_ref) const
+  {
+    CUDF_FAIL("Output type not supported by split_to_table", cudf::data_type_error);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<table> split_to_table(strings_column_view const& input,
+                                      string_scalar const& delimiter,
+                                      std::vector<data_type> const& output_types,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream) && (delimiter.size() > 0),
+               "Parameter delimiter must be valid and non-empty",
+               std::invalid_argument);
+  CUDF_EXPECTS(
+    !output_types.empty(), "Parameter output_types must not be empty", std::invalid_argument);
+
+  auto const columns_count = static_cast<size_type>(output_types.size());
+
+  auto const d_strings   = column_device_view::create(input.parent(), stream);
+  auto const d_delimiter = string_view(delimiter.data(), delimiter.size());
+
+  // tokenize the entire column; tokens are views into the input chars so no
+  // intermediate strings columns are materialized
+  auto [offsets, tokens] = split_helper(
+    input, split_tokenizer_fn{*d_strings, d_delimiter, columns_count}, stream, mr);
+  auto const d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(offsets->view());
+  auto const d_tokens  = tokens.data();
+
+  std::vector<std::unique_ptr<column>> results;
+  auto column_tokens = rmm::device_uvector<string_index_pair>(input.size(), stream);
+  for (size_type col = 0; col < columns_count; ++col) {
+    // gather the tokens for this output column; missing tokens become nulls
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(input.size()),
+                      column_tokens.begin(),
+                      [d_tokens, d_offsets, col] __device__(size_type idx) -> string_index_pair {
+                        auto const offset      = d_offsets[idx];
+                        auto const token_count = static_cast<size_type>(d_offsets[idx + 1] - offset);
+                        return (col < token_count) ? d_tokens[offset + col]
+                                                   : string_index_pair{nullptr, 0};
+                      });
+    auto const type = output_types[col];
+    if (type.id() == type_id::STRING) {
+      results.emplace_back(
+        make_strings_column(column_tokens.begin(), column_tokens.end(), stream, mr));
+    } else {
+      results.emplace_back(type_dispatcher(type, tokens_to_column_fn{column_tokens}, stream, mr));
+    }
+  }
+
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace detail
+
+// external API
+
+std::unique_ptr<table> split_to_table(strings_column_view const& input,
+                                      string_scalar const& delimiter,
+                                      std::vector<data_type> const& output_types,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_to_table(input, delimiter, output_types, stream, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
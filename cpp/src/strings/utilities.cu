@@ -33,6 +33,7 @@
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/transform.h>
 
 #include <cstdlib>
@@ -92,6 +93,59 @@ std::unique_ptr<column> create_offsets_child_column(int64_t chars_bytes,
     mr);
 }
 
+/**
+ * @copydoc cudf::strings::is_valid_utf8
+ */
+bool is_valid_utf8(strings_column_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.size() == input.null_count()) { return true; }
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  return thrust::all_of(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    [d_col = *d_strings] __device__(size_type idx) {
+      if (d_col.is_null(idx)) { return true; }
+      auto const d_str = d_col.element<string_view>(idx);
+      auto const bytes = d_str.size_bytes();
+      auto const data  = d_str.data();
+      size_type i      = 0;
+      while (i < bytes) {
+        auto const byte = static_cast<u_char>(data[i]);
+        if (byte < 0x80) {  // ASCII
+          ++i;
+          continue;
+        }
+        size_type width = 0;
+        uint32_t code_point{};
+        if ((byte & 0xE0) == 0xC0) {
+          width      = 2;
+          code_point = byte & 0x1F;
+        } else if ((byte & 0xF0) == 0xE0) {
+          width      = 3;
+          code_point = byte & 0x0F;
+        } else if ((byte & 0xF8) == 0xF0) {
+          width      = 4;
+          code_point = byte & 0x07;
+        } else {  // unexpected continuation byte or invalid lead byte
+          return false;
+        }
+        if (i + width > bytes) { return false; }  // truncated character
+        for (size_type j = 1; j < width; ++j) {
+          auto const continuation = static_cast<u_char>(data[i + j]);
+          if ((continuation & 0xC0) != 0x80) { return false; }
+          code_point = (code_point << 6) | (continuation & 0x3F);
+        }
+        // reject overlong encodings, surrogates, and out-of-range code points
+        if (code_point < (width == 2 ? 0x80 : width == 3 ? 0x800 : 0x1'0000)) { return false; }
+        if (code_point >= 0xD800 && code_point <= 0xDFFF) { return false; }
+        if (code_point > 0x10'FFFF) { return false; }
+        i += width;
+      }
+      return true;
+    });
+}
+
 namespace {
 // The device variables are created here to avoid using a singleton that may cause issues
 // with RMM initialize/finalize. See PR #3159 for details on this approach.
@@ -168,6 +222,29 @@ bool is_large_strings_enabled()
 #endif
 }
 
+string_parallelism compute_string_parallelism(int64_t chars_bytes,
+                                              size_type row_count,
+                                              size_type null_count,
+                                              size_type warp_threshold,
+                                              size_type block_threshold)
+{
+  auto const valid_count = row_count - null_count;
+  if (valid_count <= 0) { return string_parallelism::THREAD_PER_STRING; }
+  auto const avg_bytes_per_row = chars_bytes / valid_count;
+  if (avg_bytes_per_row >= block_threshold) { return string_parallelism::BLOCK_PER_STRING; }
+  if (avg_bytes_per_row >= warp_threshold) { return string_parallelism::WARP_PER_STRING; }
+  return string_parallelism::THREAD_PER_STRING;
+}
+
+string_parallelism compute_string_parallelism(cudf::strings_column_view const& input,
+                                              rmm::cuda_stream_view stream,
+                                              size_type warp_threshold,
+                                              size_type block_threshold)
+{
+  return compute_string_parallelism(
+    input.chars_size(stream), input.size(), input.null_count(), warp_threshold, block_threshold);
+}
+
 int64_t get_offset_value(cudf::column_view const& offsets,
                          size_type index,
                          rmm::cuda_stream_view stream)
@@ -194,4 +271,10 @@ rmm::device_uvector<string_view> create_string_vector_from_column(
 int64_t get_offset64_threshold() { return detail::get_offset64_threshold(); }
 bool is_large_strings_enabled() { return detail::is_large_strings_enabled(); }
 
+bool is_valid_utf8(strings_column_view const& input, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::is_valid_utf8(input, stream);
+}
+
 }  // namespace cudf::strings
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <limits>
+
+namespace cudf {
+
+chunked_table_view::chunked_table_view(host_span<table_view const> chunks)
+  : _chunks(chunks.begin(), chunks.end())
+{
+  _row_offsets.reserve(_chunks.size());
+  std::size_t total_rows = 0;
+  for (auto const& chunk : _chunks) {
+    CUDF_EXPECTS(have_same_types(_chunks.front(), chunk),
+                 "Chunk schemas must match",
+                 cudf::data_type_error);
+    total_rows += chunk.num_rows();
+    CUDF_EXPECTS(total_rows <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+                 "Total number of rows exceeds the column size limit",
+                 std::overflow_error);
+    _row_offsets.push_back(static_cast<size_type>(total_rows));
+  }
+}
+
+}  // namespace cudf
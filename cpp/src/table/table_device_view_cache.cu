@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/table_device_view_cache.cuh>
+#include <cudf/hashing/detail/hashing.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf::detail {
+
+namespace {
+
+std::size_t table_shallow_hash(table_view const& table)
+{
+  return std::accumulate(
+    table.begin(), table.end(), std::size_t{0}, [](std::size_t hash, column_view const& col) {
+      return cudf::hashing::detail::hash_combine(hash, shallow_hash(col));
+    });
+}
+
+bool table_shallow_equivalent(table_view const& lhs, table_view const& rhs)
+{
+  return (lhs.num_columns() == rhs.num_columns()) and
+         std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](auto const& lcol, auto const& rcol) {
+           return is_shallow_equivalent(lcol, rcol);
+         });
+}
+
+}  // namespace
+
+table_device_view const& table_device_view_cache::get_or_create(table_view const& table,
+                                                                rmm::cuda_stream_view stream)
+{
+  auto const hash = table_shallow_hash(table);
+  std::scoped_lock lock{_mutex};
+  auto const [begin, end] = _entries.equal_range(hash);
+  auto const it           = std::find_if(begin, end, [&](auto const& candidate) {
+    return table_shallow_equivalent(candidate.second.source, table);
+  });
+  if (it != end) { return *it->second.device_view; }
+  auto const inserted = _entries.emplace(hash, entry{table, table_device_view::create(table, stream)});
+  return *inserted->second.device_view;
+}
+
+void table_device_view_cache::clear()
+{
+  std::scoped_lock lock{_mutex};
+  _entries.clear();
+}
+
+std::size_t table_device_view_cache::size() const
+{
+  std::scoped_lock lock{_mutex};
+  return _entries.size();
+}
+
+}  // namespace cudf::detail
@@ -118,9 +118,14 @@ struct bpe_unpairable_offsets_fn {
  * Once there are no more rankable pairs, the process finishes and the `d_spaces_data`
  * values identify the location to insert the separator.
  *
+ * The hottest merge pairs are probed through a shared-memory copy of the
+ * rank cache before falling back to the global-memory map. When the cache
+ * covers the entire merges table the global map is never probed.
+ *
  * @tparam MapRefType The type of the map finder object
  * @param d_strings Input data
  * @param d_map For looking up individual string candidates
+ * @param d_rank_cache Packed table of the hottest merge pairs
  * @param d_spaces_data Output the location where separator will be inserted
  * @param d_ranks_data Working memory to hold pair ranks
  * @param d_rerank_data Working memory to hold locations where reranking is required
@@ -129,6 +134,7 @@ template <typename MapRefType>
 CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
                                  char const* d_input_chars,
                                  MapRefType const d_map,
+                                 bpe_rank_cache const d_rank_cache,
                                  int8_t* d_spaces_data,          // working memory
                                  cudf::size_type* d_ranks_data,  // more working memory
                                  int8_t* d_rerank_data           // and one more working memory
@@ -154,8 +160,16 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
   __shared__ cudf::size_type block_min_rank;
   using block_reduce = cub::BlockReduce<cudf::size_type, block_size>;
   __shared__ typename block_reduce::TempStorage temp_storage;
+  __shared__ uint64_t s_rank_cache[bpe_cache_size];
   auto const num_valid = block_size < d_str.size_bytes() ? block_size : d_str.size_bytes();
 
+  // copy the hot merge-pair cache into shared memory
+  for (auto idx = lane_idx; idx < bpe_cache_size; idx += block_size) {
+    s_rank_cache[idx] = d_rank_cache.d_table[idx];
+  }
+  auto const d_cache =
+    bpe_rank_cache{s_rank_cache, d_rank_cache.d_pairs, d_rank_cache.complete};
+
   // init all the re-rank identifiers to zero
   for (auto itr = d_rerank + lane_idx; itr < end_rerank; itr += block_size) {
     *itr = 0;
@@ -184,6 +198,16 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
     }
     return ptr;
   };
+  // resolves the rank of a pair through the shared-memory cache first
+  // and only probes the global map on a miss
+  auto pair_rank = [d_map, d_cache](cudf::string_view const& lhs, cudf::string_view const& rhs) {
+    auto const mp   = merge_pair_type{lhs, rhs};
+    auto const rank = d_cache.find(mp, bpe_hasher{d_cache.d_pairs}(mp));
+    if (rank != bpe_rank_cache::cache_miss) { return rank; }
+    if (d_cache.complete) { return max_rank; }  // a cache miss is definitive
+    auto const map_itr = d_map.find(mp);
+    return map_itr != d_map.end() ? map_itr->second : max_rank;
+  };
 
   auto min_rank = max_rank;
 
@@ -202,11 +226,8 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
     if (next_itr < end_spaces) {
       auto const rhs = next_substr(next_itr);  // retrieve rhs of the pair
       if (!rhs.empty()) {
-        auto rank          = max_rank;
-        auto const mp      = merge_pair_type{lhs, rhs};
-        auto const map_itr = d_map.find(mp);                     // lookup pair in merges table;
-        if (map_itr != d_map.end()) { rank = map_itr->second; }  // found a match;
-        d_ranks[thrust::distance(d_spaces, next_itr)] = rank;    // store the rank
+        auto const rank = pair_rank(lhs, rhs);  // lookup pair in merges table
+        d_ranks[thrust::distance(d_spaces, next_itr)] = rank;  // store the rank
         if (rank < min_rank) { min_rank = rank; }
       }
     }
@@ -267,9 +288,7 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
         auto const rhs  = next_substr(d_spaces + index);  // retrieve rhs of pair
         rank            = max_rank;
         if (!rhs.empty()) {
-          auto const mp      = merge_pair_type{lhs, rhs};
-          auto const map_itr = d_map.find(mp);                     // lookup rank for this pair;
-          if (map_itr != d_map.end()) { rank = map_itr->second; }  // found a match
+          rank = pair_rank(lhs, rhs);  // lookup rank for this pair
         }
         d_ranks[index] = rank;  // store new rank
       }
@@ -410,9 +429,16 @@ std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const
     // launch the byte-pair-encoding kernel on the temp column
     rmm::device_uvector<int8_t> d_rerank(chars_size, stream);  // more working memory;
     rmm::device_uvector<cudf::size_type> d_ranks(chars_size, stream);
-    auto const pair_map = get_bpe_merge_pairs_impl(merge_pairs)->get_merge_pairs_ref();
-    bpe_parallel_fn<decltype(pair_map)><<<tmp_size, block_size, 0, stream.value()>>>(
-      *d_tmp_strings, d_input_chars, pair_map, d_spaces.data(), d_ranks.data(), d_rerank.data());
+    auto const pair_map   = get_bpe_merge_pairs_impl(merge_pairs)->get_merge_pairs_ref();
+    auto const rank_cache = get_bpe_merge_pairs_impl(merge_pairs)->get_rank_cache();
+    bpe_parallel_fn<decltype(pair_map)>
+      <<<tmp_size, block_size, 0, stream.value()>>>(*d_tmp_strings,
+                                                    d_input_chars,
+                                                    pair_map,
+                                                    rank_cache,
+                                                    d_spaces.data(),
+                                                    d_ranks.data(),
+                                                    d_rerank.data());
   }
 
   // compute the output sizes
@@ -29,6 +29,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <cuco/static_map.cuh>
+#include <cuda/std/limits>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
@@ -100,6 +101,55 @@ struct bpe_equal {
 
 using bpe_probe_scheme = cuco::linear_probing<1, bpe_hasher>;
 
+/// Number of slots in the hot merge-pair cache; power-of-2 for masked probing
+cudf::size_type constexpr bpe_cache_size = 1024;
+/// Maximum number of merge pairs stored in the cache (50% load factor)
+cudf::size_type constexpr bpe_cache_capacity = bpe_cache_size / 2;
+
+/**
+ * @brief Compact open-addressing cache of the hottest merge pairs
+ *
+ * GPT-style merges tables are ordered by frequency so the lowest ranks are
+ * resolved far more often than the rest of the table. The hottest pairs are
+ * packed into a small linear-probing table of `(pair-hash << 32) | rank`
+ * entries which each encoding block copies into shared memory before probing.
+ *
+ * A hash match is verified against the merge-pairs strings before the rank is
+ * returned so hash collisions with uncached pairs cannot produce a false hit.
+ * When the entire merges table fits in the cache a miss is definitive and the
+ * global map probe can be skipped altogether.
+ */
+struct bpe_rank_cache {
+  static uint64_t constexpr empty_entry       = cuda::std::numeric_limits<uint64_t>::max();
+  static cudf::size_type constexpr cache_miss = -1;
+
+  uint64_t const* d_table;                 ///< bpe_cache_size packed entries
+  cudf::column_device_view const d_pairs;  ///< merge-pairs strings for verification
+  bool complete;                           ///< true if the cache holds the entire merges table
+
+  /**
+   * @brief Returns the rank for the given merge pair or `cache_miss`
+   *
+   * @param mp The merge pair to look up
+   * @param hash Combined hash of the pair as computed by `bpe_hasher`
+   */
+  __device__ cudf::size_type find(merge_pair_type const& mp, hash_value_type hash) const
+  {
+    auto slot = static_cast<cudf::size_type>(hash & (bpe_cache_size - 1));
+    while (true) {
+      auto const entry = d_table[slot];
+      if (entry == empty_entry) { return cache_miss; }
+      if (static_cast<hash_value_type>(entry >> 32) == hash) {
+        auto const rank  = static_cast<cudf::size_type>(entry & 0xFFFF'FFFFUL);
+        auto const left  = d_pairs.element<cudf::string_view>(rank * 2);
+        auto const right = d_pairs.element<cudf::string_view>(rank * 2 + 1);
+        return (left == mp.first) && (right == mp.second) ? rank : cache_miss;
+      }
+      slot = (slot + 1) & (bpe_cache_size - 1);
+    }
+  }
+};
+
 using merge_pairs_map_type = cuco::static_map<cudf::size_type,
                                               cudf::size_type,
                                               cuco::extent<std::size_t>,
@@ -180,15 +230,22 @@ struct bpe_merge_pairs::bpe_merge_pairs_impl {
   col_device_view const d_merge_pairs;
   std::unique_ptr<detail::merge_pairs_map_type> merge_pairs_map;  // for BPE
   std::unique_ptr<detail::mp_table_map_type> mp_table_map;        // for locating unpairables
+  rmm::device_uvector<uint64_t> const rank_cache;                 // hottest pairs by rank
 
   bpe_merge_pairs_impl(std::unique_ptr<cudf::column>&& merge_pairs,
                        col_device_view&& d_merge_pairs,
                        std::unique_ptr<detail::merge_pairs_map_type>&& merge_pairs_map,
-                       std::unique_ptr<detail::mp_table_map_type>&& mp_table_map);
+                       std::unique_ptr<detail::mp_table_map_type>&& mp_table_map,
+                       rmm::device_uvector<uint64_t>&& rank_cache);
 
   auto const get_merge_pairs() const { return *d_merge_pairs; }
   auto get_merge_pairs_ref() const { return merge_pairs_map->ref(cuco::op::find); }
   auto get_mp_table_ref() const { return mp_table_map->ref(cuco::op::find); }
+  auto get_rank_cache() const
+  {
+    auto const complete = (merge_pairs->size() / 2) <= detail::bpe_cache_capacity;
+    return detail::bpe_rank_cache{rank_cache.data(), *d_merge_pairs, complete};
+  }
 };
 
 }  // namespace nvtext
@@ -29,9 +29,13 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <cuda/functional>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -88,14 +92,59 @@ std::unique_ptr<detail::mp_table_map_type> initialize_mp_table_map(
   return mp_table_map;
 }
 
+/**
+ * @brief Builds the packed table of the hottest merge pairs
+ *
+ * The merges table is ordered by rank so the first `bpe_cache_capacity` pairs
+ * are hashed and placed into a `bpe_cache_size` open-addressing table of
+ * `(pair-hash << 32) | rank` entries. The table is small enough to build on
+ * the host at load time. When two cached pairs alias the same 32-bit hash
+ * only the lower (hotter) rank is kept; the loser resolves through the
+ * global map like any other uncached pair.
+ */
+rmm::device_uvector<uint64_t> build_rank_cache(cudf::column_device_view const& input,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const num_pairs = input.size() / 2;
+  auto const cached    = std::min(num_pairs, bpe_cache_capacity);
+
+  auto hashes = rmm::device_uvector<hash_value_type>(cached, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::counting_iterator<cudf::size_type>(0),
+                    thrust::counting_iterator<cudf::size_type>(cached),
+                    hashes.begin(),
+                    bpe_hasher{input});
+  auto const h_hashes = cudf::detail::make_std_vector_sync(hashes, stream);
+
+  auto table = std::vector<uint64_t>(bpe_cache_size, bpe_rank_cache::empty_entry);
+  for (cudf::size_type rank = 0; rank < cached; ++rank) {
+    auto const hash = h_hashes[rank];
+    auto slot       = static_cast<cudf::size_type>(hash & (bpe_cache_size - 1));
+    while (true) {
+      if (table[slot] == bpe_rank_cache::empty_entry) {
+        table[slot] = (static_cast<uint64_t>(hash) << 32) | static_cast<uint32_t>(rank);
+        break;
+      }
+      if (static_cast<hash_value_type>(table[slot] >> 32) == hash) { break; }
+      slot = (slot + 1) & (bpe_cache_size - 1);
+    }
+  }
+  return cudf::detail::make_device_uvector_sync(
+    table, stream, cudf::get_current_device_resource_ref());
+}
+
 std::unique_ptr<bpe_merge_pairs::bpe_merge_pairs_impl> create_bpe_merge_pairs_impl(
   std::unique_ptr<cudf::column>&& input, rmm::cuda_stream_view stream)
 {
   auto d_input      = cudf::column_device_view::create(input->view(), stream);
   auto merge_pairs  = initialize_merge_pairs_map(*d_input, stream);
   auto mp_table_map = initialize_mp_table_map(*d_input, stream);
-  return std::make_unique<nvtext::bpe_merge_pairs::bpe_merge_pairs_impl>(
-    std::move(input), std::move(d_input), std::move(merge_pairs), std::move(mp_table_map));
+  auto rank_cache   = build_rank_cache(*d_input, stream);
+  return std::make_unique<nvtext::bpe_merge_pairs::bpe_merge_pairs_impl>(std::move(input),
+                                                                         std::move(d_input),
+                                                                         std::move(merge_pairs),
+                                                                         std::move(mp_table_map),
+                                                                         std::move(rank_cache));
 }
 
 std::unique_ptr<bpe_merge_pairs::bpe_merge_pairs_impl> create_bpe_merge_pairs_impl(
@@ -135,11 +184,13 @@ bpe_merge_pairs::bpe_merge_pairs_impl::bpe_merge_pairs_impl(
   std::unique_ptr<cudf::column_device_view, std::function<void(cudf::column_device_view*)>>&&
     d_merge_pairs,
   std::unique_ptr<detail::merge_pairs_map_type>&& merge_pairs_map,
-  std::unique_ptr<detail::mp_table_map_type>&& mp_table_map)
+  std::unique_ptr<detail::mp_table_map_type>&& mp_table_map,
+  rmm::device_uvector<uint64_t>&& rank_cache)
   : merge_pairs(std::move(merge_pairs)),
     d_merge_pairs(std::move(d_merge_pairs)),
     merge_pairs_map(std::move(merge_pairs_map)),
-    mp_table_map(std::move(mp_table_map))
+    mp_table_map(std::move(mp_table_map)),
+    rank_cache(std::move(rank_cache))
 {
 }
 
@@ -45,6 +45,7 @@
 #include <thrust/fill.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
+#include <thrust/tabulate.h>
 
 #include <limits>
 
@@ -250,17 +251,26 @@ CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
     auto const param_count =
       cuda::std::min(static_cast<cuda::std::size_t>(params_per_thread), parameter_a.size() - i);
 
+    // cache this chunk's parameters in registers so the inner loop below
+    // does not re-read them from global memory for every hash value
+    hash_value_type param_a[params_per_thread];
+    hash_value_type param_b[params_per_thread];
+    for (std::size_t param_idx = 0; param_idx < param_count; ++param_idx) {
+      param_a[param_idx] = parameter_a[i + param_idx];
+      param_b[param_idx] = parameter_b[i + param_idx];
+    }
+
     // each lane accumulates min hashes in its shared memory
     for (auto itr = begin; itr < end; itr += block_size) {
       auto const hv = *itr;
       // 0 is used as a skip sentinel for UTF-8 and trailing bytes
       if (hv == 0) { continue; }
 
-      for (std::size_t param_idx = i; param_idx < (i + param_count); ++param_idx) {
+      for (std::size_t param_idx = 0; param_idx < param_count; ++param_idx) {
         // permutation formula used by datatrove
         hash_value_type const v =
-          ((hv * parameter_a[param_idx] + parameter_b[param_idx]) % mersenne_prime) & hash_max;
-        auto const block_idx    = ((param_idx % params_per_thread) * block_size) + lane_idx;
+          ((hv * param_a[param_idx] + param_b[param_idx]) % mersenne_prime) & hash_max;
+        auto const block_idx    = (param_idx * block_size) + lane_idx;
         block_values[block_idx] = cuda::std::min(v, block_values[block_idx]);
       }
     }
@@ -411,6 +421,49 @@ std::unique_ptr<cudf::column> build_list_result(cudf::column_view const& input,
   }
   return result;
 }
+
+/**
+ * @brief Counter-based generator for the a/b permutation parameters
+ *
+ * This applies the splitmix64 mix function to the seed and parameter index
+ * so the parameter sequence is deterministic for a given seed without
+ * requiring the caller to provide parameter arrays.
+ */
+struct parameter_generator_fn {
+  uint32_t const seed;
+  uint32_t const salt;  // distinguishes the a and b sequences
+
+  __device__ uint32_t operator()(cudf::size_type idx) const
+  {
+    auto x = (static_cast<uint64_t>(seed) << 32) + (static_cast<uint64_t>(idx) << 1) + salt;
+    x += 0x9e37'79b9'7f4a'7c15UL;
+    x = (x ^ (x >> 30)) * 0xbf58'476d'1ce4'e5b9UL;
+    x = (x ^ (x >> 27)) * 0x94d0'49bb'1331'11ebUL;
+    x = x ^ (x >> 31);
+    // zero would produce a degenerate permutation
+    return cuda::std::max(static_cast<uint32_t>(x), 1u);
+  }
+};
+
+/**
+ * @brief Combines each band of minhash values into a single band hash
+ *
+ * Each output element covers `band_size` consecutive signature values.
+ */
+struct band_hash_fn {
+  uint32_t const* d_signatures;
+  cudf::size_type const band_size;
+
+  __device__ uint32_t operator()(cudf::size_type idx) const
+  {
+    auto const begin = d_signatures + (static_cast<std::size_t>(idx) * band_size);
+    uint32_t band_hash{0};
+    for (cudf::size_type j = 0; j < band_size; ++j) {
+      band_hash = cudf::hashing::detail::hash_combine(band_hash, begin[j]);
+    }
+    return band_hash;
+  }
+};
 }  // namespace
 
 std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
@@ -441,6 +494,57 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   return build_list_result(input.parent(), std::move(hashes), parameter_a.size(), stream, mr);
 }
 
+std::unique_ptr<cudf::column> minhash_lsh(cudf::strings_column_view const& input,
+                                          uint32_t seed,
+                                          cudf::size_type num_bands,
+                                          cudf::size_type band_size,
+                                          cudf::size_type width,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(
+    num_bands > 0, "Number of bands must be greater than zero", std::invalid_argument);
+  CUDF_EXPECTS(band_size > 0, "Band size must be greater than zero", std::invalid_argument);
+  CUDF_EXPECTS(
+    static_cast<std::size_t>(num_bands) * band_size <
+      static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+    "Number of bands times the band size exceeds the column size limit",
+    std::overflow_error);
+
+  auto const output_type = cudf::data_type{cudf::type_id::UINT32};
+  if (input.is_empty()) { return cudf::make_empty_column(output_type); }
+
+  auto const num_hashes = num_bands * band_size;
+
+  // generate the a/b permutation parameters from the seed;
+  // these are never provided by (or returned to) the caller
+  auto parameter_a = rmm::device_uvector<uint32_t>(num_hashes, stream);
+  auto parameter_b = rmm::device_uvector<uint32_t>(num_hashes, stream);
+  thrust::tabulate(rmm::exec_policy_nosync(stream),
+                   parameter_a.begin(),
+                   parameter_a.end(),
+                   parameter_generator_fn{seed, 0});
+  thrust::tabulate(rmm::exec_policy_nosync(stream),
+                   parameter_b.begin(),
+                   parameter_b.end(),
+                   parameter_generator_fn{seed, 1});
+
+  // the signatures are temporary working memory and not returned to the caller
+  using HashFunction = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>;
+  auto const signatures = minhash_fn<HashFunction>(
+    input, seed, parameter_a, parameter_b, width, stream, cudf::get_current_device_resource_ref());
+
+  // combine each band of signature values into a single band hash
+  auto band_hashes = cudf::make_numeric_column(
+    output_type, input.size() * num_bands, cudf::mask_state::UNALLOCATED, stream, mr);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   band_hashes->mutable_view().begin<uint32_t>(),
+                   band_hashes->mutable_view().end<uint32_t>(),
+                   band_hash_fn{signatures->view().data<uint32_t>(), band_size});
+
+  return build_list_result(input.parent(), std::move(band_hashes), num_bands, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
@@ -479,6 +583,18 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   return detail::minhash64(input, seed, parameter_a, parameter_b, width, stream, mr);
 }
 
+std::unique_ptr<cudf::column> minhash_lsh(cudf::strings_column_view const& input,
+                                          uint32_t seed,
+                                          cudf::size_type num_bands,
+                                          cudf::size_type band_size,
+                                          cudf::size_type width,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_lsh(input, seed, num_bands, band_size, width, stream, mr);
+}
+
 std::unique_ptr<cudf::column> minhash64_permuted(cudf::strings_column_view const& input,
                                                  uint64_t seed,
                                                  cudf::device_span<uint64_t const> parameter_a,
@@ -40,6 +40,52 @@
 #include <thrust/transform_scan.h>
 
 namespace nvtext {
+
+struct subword_tokenizer::subword_tokenizer_impl {
+  hashed_vocabulary const& vocabulary;
+  uint32_t const max_sequence_length;
+  uint32_t const stride;
+  bool const do_truncate;
+  detail::wordpiece_tokenizer tokenizer;
+
+  subword_tokenizer_impl(hashed_vocabulary const& vocabulary,
+                         uint32_t max_sequence_length,
+                         uint32_t stride,
+                         bool do_lower_case,
+                         bool do_truncate)
+    : vocabulary(vocabulary),
+      max_sequence_length(max_sequence_length),
+      stride(stride),
+      do_truncate(do_truncate),
+      tokenizer(vocabulary, max_sequence_length, stride, do_truncate, do_lower_case)
+  {
+  }
+};
+
+subword_tokenizer::subword_tokenizer(hashed_vocabulary const& vocabulary,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_lower_case,
+                                     bool do_truncate)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  _impl =
+    new subword_tokenizer_impl(vocabulary, max_sequence_length, stride, do_lower_case, do_truncate);
+}
+subword_tokenizer::~subword_tokenizer() { delete _impl; }
+
+std::unique_ptr<subword_tokenizer> create_subword_tokenizer(hashed_vocabulary const& vocabulary,
+                                                            uint32_t max_sequence_length,
+                                                            uint32_t stride,
+                                                            bool do_lower_case,
+                                                            bool do_truncate)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<subword_tokenizer>(
+    vocabulary, max_sequence_length, stride, do_lower_case, do_truncate);
+}
+
 namespace detail {
 namespace {
 
@@ -153,38 +199,19 @@ tokenizer_result build_empty_result(cudf::size_type size,
     0, max_sequence_length, std::move(ids), std::move(mask), std::move(metadata)};
 }
 
-}  // namespace
-
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  rmm::cuda_stream_view stream,
-                                  rmm::device_async_resource_ref mr)
+/**
+ * @brief Assembles the output tensors from the wordpiece tokenizer results
+ *
+ * This is shared by the one-shot and the persistent-tokenizer entry points.
+ */
+tokenizer_result build_tokenizer_result(uvector_pair const& tokens,
+                                        cudf::size_type strings_count,
+                                        uint32_t max_sequence_length,
+                                        uint32_t stride,
+                                        bool do_truncate,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  auto const strings_count = strings.size();
-  if (strings_count == strings.null_count()) {  // empty or all-null returns empty
-    return tokenizer_result{0,
-                            max_sequence_length,
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
-  }
-  CUDF_EXPECTS(
-    max_sequence_length <=
-      (static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()) / strings_count),
-    "max_sequence_length times number of input rows exceeds the column size limit",
-    std::overflow_error);
-
-  // Create tokenizer
-  wordpiece_tokenizer tokenizer(
-    vocab_table, max_sequence_length, stride, do_truncate, do_lower_case);
-  // Run tokenizer
-  auto const tokens = tokenizer.tokenize(strings, stream);
   // assign output components
   auto device_token_ids = tokens.first->data();
   auto device_offsets   = tokens.second->data();
@@ -280,6 +307,202 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+/**
+ * @brief Packs each pair of token sequences into a single output tensor row
+ *
+ * Row values are the first sequence's token-ids, the separator token and then
+ * the second sequence's token-ids, truncated to `max_sequence_length`.
+ *
+ * @param[in] token_ids_a Tokens for the first sequence of each pair
+ * @param[in] offsets_a Offsets to each first-sequence's tokens
+ * @param[in] token_ids_b Tokens for the second sequence of each pair
+ * @param[in] offsets_b Offsets to each second-sequence's tokens
+ * @param[in] max_sequence_length Maximum number of tokens in a row
+ * @param[in] nrows Number of pairs
+ * @param[in] separator_id Token id written between the two sequences
+ * @param[out] final_tensor Output vector of token-ids
+ * @param[out] attn_mask Identifies valid token id entries
+ * @param[out] metadata Additional data per row
+ */
+CUDF_KERNEL void kernel_compute_pair_tensor(uint32_t const* token_ids_a,
+                                            int64_t const* offsets_a,
+                                            uint32_t const* token_ids_b,
+                                            int64_t const* offsets_b,
+                                            uint32_t max_sequence_length,
+                                            uint32_t nrows,
+                                            uint32_t separator_id,
+                                            uint32_t* final_tensor,
+                                            uint32_t* attn_mask,
+                                            uint32_t* metadata)
+{
+  auto const output_idx = cudf::detail::grid_1d::global_thread_id();
+
+  uint32_t const row = output_idx / max_sequence_length;
+  if (row >= nrows) { return; }
+  uint32_t const token_idx = output_idx % max_sequence_length;
+
+  auto const begin_a     = offsets_a[row];
+  auto const count_a     = static_cast<uint32_t>(offsets_a[row + 1] - begin_a);
+  auto const begin_b     = offsets_b[row];
+  auto const count_b     = static_cast<uint32_t>(offsets_b[row + 1] - begin_b);
+  uint32_t const total   = count_a + count_b + 1;  // separator between the sequences
+  bool const valid_token = token_idx < total;
+
+  uint32_t token_id = 0;
+  if (token_idx < count_a) {
+    token_id = token_ids_a[begin_a + token_idx];
+  } else if (token_idx == count_a) {
+    token_id = separator_id;
+  } else if (valid_token) {
+    token_id = token_ids_b[begin_b + token_idx - count_a - 1];
+  }
+  final_tensor[output_idx] = token_id;
+  attn_mask[output_idx]    = valid_token;
+
+  // write metadata
+  if (token_idx == 0) {
+    auto const metadata_idx    = row * 3;  // three metadata values per output row
+    auto const last_token      = total < max_sequence_length ? total : max_sequence_length;
+    metadata[metadata_idx]     = row;
+    metadata[metadata_idx + 1] = 0;
+    metadata[metadata_idx + 2] = last_token - 1;
+  }
+}
+
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  auto const strings_count = strings.size();
+  if (strings_count == strings.null_count()) {  // empty or all-null returns empty
+    return tokenizer_result{0,
+                            max_sequence_length,
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+  }
+  CUDF_EXPECTS(
+    max_sequence_length <=
+      (static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()) / strings_count),
+    "max_sequence_length times number of input rows exceeds the column size limit",
+    std::overflow_error);
+
+  // Create tokenizer
+  wordpiece_tokenizer tokenizer(
+    vocab_table, max_sequence_length, stride, do_truncate, do_lower_case);
+  // Run tokenizer
+  auto const tokens = tokenizer.tokenize(strings, stream);
+
+  return build_tokenizer_result(
+    tokens, strings_count, max_sequence_length, stride, do_truncate, stream, mr);
+}
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  subword_tokenizer const& tokenizer,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  auto& impl                     = *tokenizer._impl;
+  auto const max_sequence_length = impl.max_sequence_length;
+  auto const strings_count       = strings.size();
+  if (strings_count == strings.null_count()) {  // empty or all-null returns empty
+    return tokenizer_result{0,
+                            max_sequence_length,
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+  }
+  CUDF_EXPECTS(
+    max_sequence_length <=
+      (static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()) / strings_count),
+    "max_sequence_length times number of input rows exceeds the column size limit",
+    std::overflow_error);
+
+  auto const tokens = impl.tokenizer.tokenize(strings, stream);
+
+  return build_tokenizer_result(
+    tokens, strings_count, max_sequence_length, impl.stride, impl.do_truncate, stream, mr);
+}
+
+tokenizer_result subword_tokenize_pairs(cudf::strings_column_view const& first,
+                                        cudf::strings_column_view const& second,
+                                        subword_tokenizer const& tokenizer,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  auto& impl = *tokenizer._impl;
+  CUDF_EXPECTS(first.size() == second.size(),
+               "both input columns must have the same number of rows");
+  CUDF_EXPECTS(impl.do_truncate, "pair tokenization requires do_truncate=true");
+
+  auto const max_sequence_length = impl.max_sequence_length;
+  auto const strings_count       = first.size();
+  if (strings_count == 0) {
+    return tokenizer_result{0,
+                            max_sequence_length,
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+  }
+  CUDF_EXPECTS(
+    max_sequence_length <=
+      (static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()) / strings_count),
+    "max_sequence_length times number of input rows exceeds the column size limit",
+    std::overflow_error);
+
+  auto const tokens_a = impl.tokenizer.tokenize(first, stream);
+  auto const tokens_b = impl.tokenizer.tokenize(second, stream);
+
+  // create output data columns; one tensor row per pair
+  auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                    strings_count * max_sequence_length,
+                                                    cudf::mask_state::UNALLOCATED,
+                                                    stream,
+                                                    mr);
+  auto tensor_attention_mask =
+    cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                              strings_count * max_sequence_length,
+                              cudf::mask_state::UNALLOCATED,
+                              stream,
+                              mr);
+  auto tensor_metadata = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                                   strings_count * 3,
+                                                   cudf::mask_state::UNALLOCATED,
+                                                   stream,
+                                                   mr);
+
+  // pack both sequences and the separator into the output tensor
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d const grid{
+    static_cast<cudf::size_type>(strings_count * max_sequence_length), block_size};
+  kernel_compute_pair_tensor<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    tokens_a.first->data(),
+    tokens_a.second->data(),
+    tokens_b.first->data(),
+    tokens_b.second->data(),
+    max_sequence_length,
+    static_cast<uint32_t>(strings_count),
+    impl.vocabulary.separator_token_id,
+    tensor_token_ids->mutable_view().data<uint32_t>(),
+    tensor_attention_mask->mutable_view().data<uint32_t>(),
+    tensor_metadata->mutable_view().data<uint32_t>());
+
+  return tokenizer_result{static_cast<uint32_t>(strings_count),
+                          max_sequence_length,
+                          std::move(tensor_token_ids),
+                          std::move(tensor_attention_mask),
+                          std::move(tensor_metadata)};
+}
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -296,4 +519,23 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
     strings, vocabulary_table, max_sequence_length, stride, do_lower_case, do_truncate, stream, mr);
 }
 
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  subword_tokenizer const& tokenizer,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize(strings, tokenizer, stream, mr);
+}
+
+tokenizer_result subword_tokenize_pairs(cudf::strings_column_view const& first,
+                                        cudf::strings_column_view const& second,
+                                        subword_tokenizer const& tokenizer,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::subword_tokenize_pairs(first, second, tokenizer, stream, mr);
+}
+
 }  // namespace nvtext
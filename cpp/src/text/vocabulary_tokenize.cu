@@ -26,6 +26,7 @@
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -37,6 +38,8 @@
 #include <nvtext/tokenize.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <cub/cub.cuh>
 #include <cuco/static_map.cuh>
@@ -47,6 +50,11 @@
 #include <thrust/logical.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -102,6 +110,135 @@ using vocabulary_map_type = cuco::static_map<cudf::size_type,
                                              probe_scheme,
                                              cudf::detail::cuco_allocator<char>,
                                              cuco_storage>;
+
+/**
+ * @brief Re-mixes a hash value with a displacement seed
+ *
+ * This applies the murmur3 finalizer to the seeded hash and is used both
+ * when building the perfect-hash table and when probing it.
+ */
+__host__ __device__ inline hash_value_type remix_hash(hash_value_type hash, uint32_t seed)
+{
+  hash += seed;
+  hash ^= hash >> 16;
+  hash *= 0x85eb'ca6bU;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2'ae35U;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+/**
+ * @brief Maximum displacement seeds tried per bucket when building the
+ * perfect-hash table
+ *
+ * Exhausting this many seeds means a collision-free assignment could not be
+ * found (e.g. two vocabulary entries share the same 32-bit hash value) and
+ * the caller falls back to the cuco static-map.
+ */
+constexpr uint32_t PERFECT_HASH_MAX_ATTEMPTS = 1024;
+
+/**
+ * @brief Builds displacement seeds and a collision-free slot table from the
+ * vocabulary hash values
+ *
+ * This uses the hash-and-displace technique: entries are first grouped into
+ * buckets by their hash value and then each bucket (largest first) searches
+ * for a seed that re-mixes its entries into unoccupied table slots. The
+ * bucket count and table size are powers of two so probing needs only masks.
+ *
+ * @param hashes Hash value for each vocabulary entry
+ * @return Per-bucket seeds and the slot table (-1 for empty slots);
+ *         both empty if no collision-free assignment was found
+ */
+std::pair<std::vector<uint32_t>, std::vector<cudf::size_type>> build_perfect_hash(
+  std::vector<hash_value_type> const& hashes)
+{
+  cudf::size_type table_size = 1;
+  while (table_size < static_cast<cudf::size_type>(hashes.size() * 2)) {
+    table_size <<= 1;
+  }
+  auto const bucket_count = std::max(table_size / 2, 1);
+  auto const bucket_mask  = static_cast<hash_value_type>(bucket_count - 1);
+  auto const table_mask   = static_cast<hash_value_type>(table_size - 1);
+
+  std::vector<std::vector<cudf::size_type>> buckets(bucket_count);
+  for (std::size_t idx = 0; idx < hashes.size(); ++idx) {
+    buckets[hashes[idx] & bucket_mask].push_back(static_cast<cudf::size_type>(idx));
+  }
+
+  // place the largest buckets first while the table is mostly empty
+  std::vector<cudf::size_type> order(bucket_count);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&buckets](auto lhs, auto rhs) {
+    return buckets[lhs].size() > buckets[rhs].size();
+  });
+
+  std::vector<uint32_t> seeds(bucket_count, 0);
+  std::vector<cudf::size_type> table(table_size, -1);
+  std::vector<cudf::size_type> slots;
+  for (auto const bucket_idx : order) {
+    auto const& bucket = buckets[bucket_idx];
+    if (bucket.empty()) { break; }  // buckets are ordered by size; the rest are empty
+    uint32_t seed = 0;
+    for (; seed < PERFECT_HASH_MAX_ATTEMPTS; ++seed) {
+      slots.clear();
+      for (auto const idx : bucket) {
+        auto const slot = static_cast<cudf::size_type>(remix_hash(hashes[idx], seed) & table_mask);
+        if (table[slot] >= 0 || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+          break;
+        }
+        slots.push_back(slot);
+      }
+      if (slots.size() == bucket.size()) { break; }
+    }
+    if (seed == PERFECT_HASH_MAX_ATTEMPTS) { return {}; }
+    seeds[bucket_idx] = seed;
+    for (std::size_t i = 0; i < bucket.size(); ++i) {
+      table[slots[i]] = bucket[i];
+    }
+  }
+  return {std::move(seeds), std::move(table)};
+}
+
+/**
+ * @brief Resolves a token id with a single probe of the perfect-hash table
+ *
+ * The table stores vocabulary row indices so the probed entry is verified
+ * against the actual vocabulary string before its id is returned.
+ */
+struct vocab_perfect_lookup {
+  cudf::column_device_view const d_vocabulary;
+  uint32_t const* d_seeds;         // per-bucket displacement seeds
+  cudf::size_type bucket_count;    // power of two
+  cudf::size_type const* d_table;  // slot -> vocabulary row; -1 for empty slots
+  cudf::size_type table_size;      // power of two
+  string_hasher_type hasher{};
+
+  __device__ cudf::size_type operator()(cudf::string_view const& token,
+                                        cudf::size_type default_id) const
+  {
+    auto const hash = hasher(token);
+    auto const seed = d_seeds[hash & static_cast<hash_value_type>(bucket_count - 1)];
+    auto const idx  = d_table[remix_hash(hash, seed) & static_cast<hash_value_type>(table_size - 1)];
+    return (idx >= 0 && d_vocabulary.element<cudf::string_view>(idx) == token) ? idx : default_id;
+  }
+};
+
+/**
+ * @brief Resolves a token id by probing the cuco static-map
+ */
+template <typename MapRefType>
+struct vocab_map_lookup {
+  MapRefType d_map;
+
+  __device__ cudf::size_type operator()(cudf::string_view const& token,
+                                        cudf::size_type default_id) const
+  {
+    auto const itr = d_map.find(token);
+    return itr != d_map.end() ? itr->second : default_id;
+  }
+};
 }  // namespace
 }  // namespace detail
 
@@ -114,14 +251,33 @@ using col_device_view = std::invoke_result_t<decltype(&cudf::column_device_view:
 struct tokenize_vocabulary::tokenize_vocabulary_impl {
   std::unique_ptr<cudf::column> const vocabulary;
   col_device_view const d_vocabulary;
-  std::unique_ptr<detail::vocabulary_map_type> vocabulary_map;
+  std::unique_ptr<detail::vocabulary_map_type> vocabulary_map;  // null when perfect hashing is used
+  rmm::device_uvector<uint32_t> hash_seeds;          // perfect-hash displacement seeds
+  rmm::device_uvector<cudf::size_type> hash_table;   // perfect-hash slot table; empty if unused
+
+  bool has_perfect_hash() const { return not hash_table.is_empty(); }
 
   auto get_map_ref() const { return vocabulary_map->ref(cuco::op::find); }
 
+  auto get_perfect_ref() const
+  {
+    return detail::vocab_perfect_lookup{*d_vocabulary,
+                                        hash_seeds.data(),
+                                        static_cast<cudf::size_type>(hash_seeds.size()),
+                                        hash_table.data(),
+                                        static_cast<cudf::size_type>(hash_table.size())};
+  }
+
   tokenize_vocabulary_impl(std::unique_ptr<cudf::column>&& vocab,
                            col_device_view&& d_vocab,
-                           std::unique_ptr<detail::vocabulary_map_type>&& map)
-    : vocabulary(std::move(vocab)), d_vocabulary(std::move(d_vocab)), vocabulary_map(std::move(map))
+                           std::unique_ptr<detail::vocabulary_map_type>&& map,
+                           rmm::device_uvector<uint32_t>&& seeds,
+                           rmm::device_uvector<cudf::size_type>&& table)
+    : vocabulary(std::move(vocab)),
+      d_vocabulary(std::move(d_vocab)),
+      vocabulary_map(std::move(map)),
+      hash_seeds(std::move(seeds)),
+      hash_table(std::move(table))
   {
   }
 };
@@ -136,6 +292,14 @@ struct key_pair {
 tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr)
+  : tokenize_vocabulary(input, false, stream, mr)
+{
+}
+
+tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
+                                         bool perfect_hash,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
 {
   CUDF_EXPECTS(not input.is_empty(), "vocabulary must not be empty");
   CUDF_EXPECTS(not input.has_nulls(), "vocabulary must not have nulls");
@@ -144,23 +308,46 @@ tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
   auto vocabulary   = std::make_unique<cudf::column>(input.parent(), stream, mr);
   auto d_vocabulary = cudf::column_device_view::create(vocabulary->view(), stream);
 
-  auto vocab_map = std::make_unique<detail::vocabulary_map_type>(
-    static_cast<size_t>(vocabulary->size() * 2),
-    cuco::empty_key{-1},
-    cuco::empty_value{-1},
-    detail::vocab_equal{*d_vocabulary},
-    detail::probe_scheme{detail::vocab_hasher{*d_vocabulary}},
-    cuco::thread_scope_device,
-    detail::cuco_storage{},
-    cudf::detail::cuco_allocator<char>{rmm::mr::polymorphic_allocator<char>{}, stream},
-    stream.value());
-
-  // the row index is the token id (value for each key in the map)
-  auto iter = cudf::detail::make_counting_transform_iterator(0, key_pair{});
-  vocab_map->insert_async(iter, iter + vocabulary->size(), stream.value());
-
-  _impl = new tokenize_vocabulary_impl(
-    std::move(vocabulary), std::move(d_vocabulary), std::move(vocab_map));
+  auto hash_seeds = rmm::device_uvector<uint32_t>(0, stream, mr);
+  auto hash_table = rmm::device_uvector<cudf::size_type>(0, stream, mr);
+  if (perfect_hash) {
+    auto d_hashes = rmm::device_uvector<detail::hash_value_type>(vocabulary->size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::counting_iterator<cudf::size_type>(0),
+                      thrust::counting_iterator<cudf::size_type>(vocabulary->size()),
+                      d_hashes.begin(),
+                      detail::vocab_hasher{*d_vocabulary});
+    auto const h_hashes     = cudf::detail::make_std_vector_sync(d_hashes, stream);
+    auto [h_seeds, h_table] = detail::build_perfect_hash(h_hashes);
+    if (not h_table.empty()) {
+      hash_seeds = cudf::detail::make_device_uvector_sync(h_seeds, stream, mr);
+      hash_table = cudf::detail::make_device_uvector_sync(h_table, stream, mr);
+    }
+  }
+
+  std::unique_ptr<detail::vocabulary_map_type> vocab_map;
+  if (hash_table.is_empty()) {
+    vocab_map = std::make_unique<detail::vocabulary_map_type>(
+      static_cast<size_t>(vocabulary->size() * 2),
+      cuco::empty_key{-1},
+      cuco::empty_value{-1},
+      detail::vocab_equal{*d_vocabulary},
+      detail::probe_scheme{detail::vocab_hasher{*d_vocabulary}},
+      cuco::thread_scope_device,
+      detail::cuco_storage{},
+      cudf::detail::cuco_allocator<char>{rmm::mr::polymorphic_allocator<char>{}, stream},
+      stream.value());
+
+    // the row index is the token id (value for each key in the map)
+    auto iter = cudf::detail::make_counting_transform_iterator(0, key_pair{});
+    vocab_map->insert_async(iter, iter + vocabulary->size(), stream.value());
+  }
+
+  _impl = new tokenize_vocabulary_impl(std::move(vocabulary),
+                                       std::move(d_vocabulary),
+                                       std::move(vocab_map),
+                                       std::move(hash_seeds),
+                                       std::move(hash_table));
 }
 tokenize_vocabulary::~tokenize_vocabulary() { delete _impl; }
 
@@ -172,6 +359,14 @@ std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view c
   return std::make_unique<tokenize_vocabulary>(input, stream, mr);
 }
 
+std::unique_ptr<tokenize_vocabulary> load_static_vocabulary(cudf::strings_column_view const& input,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<tokenize_vocabulary>(input, true, stream, mr);
+}
+
 namespace detail {
 namespace {
 
@@ -288,15 +483,15 @@ CUDF_KERNEL void token_counts_fn(cudf::column_device_view const d_strings,
 }
 
 /**
- * @brief Tokenizes each string and uses the map to assign token id values
+ * @brief Tokenizes each string and uses the lookup functor to assign token id values
  *
- * @tparam MapRefType Type of the static_map reference for calling find()
+ * @tparam LookupType Functor type resolving a token string to its id
  */
-template <typename MapRefType>
+template <typename LookupType>
 struct vocabulary_tokenizer_fn {
   cudf::column_device_view const d_strings;
   cudf::string_view const d_delimiter;
-  MapRefType d_map;
+  LookupType d_lookup;
   cudf::size_type const default_id;
   cudf::detail::input_offsetalator d_offsets;
   cudf::size_type* d_results;
@@ -313,19 +508,16 @@ struct vocabulary_tokenizer_fn {
     while (tokenizer.next_token()) {
       auto const pos   = tokenizer.token_byte_positions();
       auto const token = cudf::string_view{d_str.data() + pos.first, (pos.second - pos.first)};
-      // lookup token in map
-      auto const itr = d_map.find(token);
-      auto const id  = (itr != d_map.end()) ? itr->second : default_id;
-      // set value into the output
-      d_tokens[token_idx++] = id;
+      // lookup token in the vocabulary and set the id into the output
+      d_tokens[token_idx++] = d_lookup(token, default_id);
     }
   }
 };
 
-template <typename MapRefType>
+template <typename LookupType>
 struct transform_tokenizer_fn {
   cudf::string_view const d_delimiter;
-  MapRefType d_map;
+  LookupType d_lookup;
   cudf::size_type const default_id;
 
   __device__ cudf::size_type operator()(cudf::string_view d_str) const
@@ -343,31 +535,29 @@ struct transform_tokenizer_fn {
 
     auto const size  = static_cast<cudf::size_type>(thrust::distance(itr, end));
     auto const token = cudf::string_view{itr, size};
-    // lookup token in map
-    auto const fitr = d_map.find(token);
-    return (fitr != d_map.end()) ? fitr->second : default_id;
+    // lookup token in the vocabulary
+    return d_lookup(token, default_id);
   }
 };
 
-}  // namespace
-
-std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
-                                                       tokenize_vocabulary const& vocabulary,
-                                                       cudf::string_scalar const& delimiter,
-                                                       cudf::size_type default_id,
-                                                       rmm::cuda_stream_view stream,
-                                                       rmm::device_async_resource_ref mr)
+/**
+ * @brief Tokenizes the input strings resolving token ids with the given lookup functor
+ *
+ * @tparam LookupType Functor type resolving a token string to its id
+ */
+template <typename LookupType>
+std::unique_ptr<cudf::column> tokenize_fn(cudf::strings_column_view const& input,
+                                          cudf::string_view const& d_delimiter,
+                                          LookupType d_lookup,
+                                          cudf::size_type default_id,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
 {
-  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
-
   auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
-  if (input.size() == input.null_count()) { return cudf::make_empty_column(output_type); }
 
   // count the tokens per string and build the offsets from the counts
-  auto const d_strings   = cudf::column_device_view::create(input.parent(), stream);
-  auto const d_delimiter = delimiter.value(stream);
-  auto map_ref           = vocabulary._impl->get_map_ref();
-  auto const zero_itr    = thrust::make_counting_iterator<cudf::size_type>(0);
+  auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
+  auto const zero_itr  = thrust::make_counting_iterator<cudf::size_type>(0);
 
   if ((input.chars_size(stream) / (input.size() - input.null_count())) < AVG_CHAR_BYTES_THRESHOLD) {
     auto const sizes_itr =
@@ -380,8 +570,8 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
       output_type, total_count, cudf::mask_state::UNALLOCATED, stream, mr);
     auto d_tokens  = tokens->mutable_view().data<cudf::size_type>();
     auto d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(token_offsets->view());
-    vocabulary_tokenizer_fn<decltype(map_ref)> tokenizer{
-      *d_strings, d_delimiter, map_ref, default_id, d_offsets, d_tokens};
+    vocabulary_tokenizer_fn<LookupType> tokenizer{
+      *d_strings, d_delimiter, d_lookup, default_id, d_offsets, d_tokens};
     thrust::for_each_n(rmm::exec_policy(stream), zero_itr, input.size(), tokenizer);
     return cudf::make_lists_column(input.size(),
                                    std::move(token_offsets),
@@ -442,7 +632,7 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
     cudf::make_numeric_column(output_type, total_count, cudf::mask_state::UNALLOCATED, stream, mr);
   auto d_tokens = tokens->mutable_view().data<cudf::size_type>();
 
-  transform_tokenizer_fn<decltype(map_ref)> tokenizer{d_delimiter, map_ref, default_id};
+  transform_tokenizer_fn<LookupType> tokenizer{d_delimiter, d_lookup, default_id};
   thrust::transform(rmm::exec_policy(stream),
                     d_tmp_strings->begin<cudf::string_view>(),
                     d_tmp_strings->end<cudf::string_view>(),
@@ -458,6 +648,69 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
                                  mr);
 }
 
+/**
+ * @brief Tokenizes one input column dispatching on the vocabulary's lookup structure
+ */
+std::unique_ptr<cudf::column> dispatch_tokenize(cudf::strings_column_view const& input,
+                                                tokenize_vocabulary const& vocabulary,
+                                                cudf::string_view const& d_delimiter,
+                                                cudf::size_type default_id,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  if (vocabulary._impl->has_perfect_hash()) {
+    return tokenize_fn(
+      input, d_delimiter, vocabulary._impl->get_perfect_ref(), default_id, stream, mr);
+  }
+  auto map_ref = vocabulary._impl->get_map_ref();
+  return tokenize_fn(
+    input, d_delimiter, vocab_map_lookup<decltype(map_ref)>{map_ref}, default_id, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+
+  auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+  if (input.size() == input.null_count()) { return cudf::make_empty_column(output_type); }
+
+  auto const d_delimiter = delimiter.value(stream);
+  return dispatch_tokenize(input, vocabulary, d_delimiter, default_id, stream, mr);
+}
+
+std::vector<std::unique_ptr<cudf::column>> tokenize_with_vocabulary(
+  cudf::host_span<cudf::strings_column_view const> inputs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type default_id,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+
+  // resolve the delimiter value only once for the entire batch
+  auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+  auto const d_delimiter = delimiter.value(stream);
+
+  std::vector<std::unique_ptr<cudf::column>> results;
+  results.reserve(inputs.size());
+  for (auto const& input : inputs) {
+    if (input.size() == input.null_count()) {
+      results.push_back(cudf::make_empty_column(output_type));
+      continue;
+    }
+    results.push_back(dispatch_tokenize(input, vocabulary, d_delimiter, default_id, stream, mr));
+  }
+  return results;
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
@@ -471,4 +724,16 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
   return detail::tokenize_with_vocabulary(input, vocabulary, delimiter, default_id, stream, mr);
 }
 
+std::vector<std::unique_ptr<cudf::column>> tokenize_with_vocabulary(
+  cudf::host_span<cudf::strings_column_view const> inputs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type default_id,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(inputs, vocabulary, delimiter, default_id, stream, mr);
+}
+
 }  // namespace nvtext
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "transform/compute_column_jit.hpp"
+
 #include <cudf/ast/detail/expression_evaluator.cuh>
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
@@ -23,6 +25,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -36,6 +39,13 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -81,6 +91,49 @@ __launch_bounds__(max_block_size) CUDF_KERNEL
   }
 }
 
+/**
+ * @brief Kernel for evaluating several expressions on a table to produce new columns
+ *
+ * All expressions are evaluated for a row before moving to the next row so
+ * input values shared between expressions are served from cache instead of
+ * being re-read from device memory for every expression.
+ *
+ * @tparam max_block_size The size of the thread block, used to set launch
+ * bounds and minimize register usage.
+ * @tparam has_nulls whether or not any output column may contain nulls.
+ *
+ * @param table The table device view used for evaluation.
+ * @param device_expression_data Device data for each expression to evaluate.
+ * @param max_intermediates The per-thread intermediate storage stride; the
+ * maximum `num_intermediates` across all expressions.
+ * @param output_columns The destination columns, one per expression.
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) CUDF_KERNEL void compute_columns_kernel(
+  table_device_view const table,
+  device_span<ast::detail::expression_device_view const> device_expression_data,
+  cudf::size_type max_intermediates,
+  device_span<mutable_column_device_view> output_columns)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+
+  auto thread_intermediate_storage = &intermediate_storage[threadIdx.x * max_intermediates];
+  auto start_idx    = cudf::detail::grid_1d::global_thread_id();
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+
+  for (thread_index_type row_index = start_idx; row_index < table.num_rows(); row_index += stride) {
+    for (std::size_t expr_idx = 0; expr_idx < device_expression_data.size(); ++expr_idx) {
+      auto evaluator =
+        cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data[expr_idx]);
+      auto output_dest =
+        ast::detail::mutable_column_expression_result<has_nulls>(output_columns[expr_idx]);
+      evaluator.evaluate(output_dest, row_index, thread_intermediate_storage);
+    }
+  }
+}
+
 std::unique_ptr<column> compute_column(table_view const& table,
                                        ast::expression const& expr,
                                        rmm::cuda_stream_view stream,
@@ -93,6 +146,14 @@ std::unique_ptr<column> compute_column(table_view const& table,
 
   auto const parser = ast::detail::expression_parser{expr, table, has_nulls, stream, mr};
 
+  // Attempt the JIT fused-kernel path first; a nullopt result means the
+  // expression is not eligible and the interpreted evaluator is used instead.
+  if (!has_nulls && table.num_rows() > 0) {
+    if (auto result = try_compute_column_jit(table, expr, parser.output_type(), stream, mr)) {
+      return std::move(*result);
+    }
+  }
+
   auto const output_column_mask_state =
     has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
 
@@ -134,6 +195,106 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return output_column;
 }
 
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& expressions,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(!expressions.empty(),
+               "compute_columns requires at least one expression",
+               std::invalid_argument);
+
+  // The null-supporting evaluation path is used for all expressions if any
+  // one of them may produce null outputs.
+  auto const has_nulls =
+    std::any_of(expressions.begin(), expressions.end(), [&](auto const& expr) {
+      return expr.get().may_evaluate_null(table, stream);
+    });
+
+  std::vector<std::unique_ptr<ast::detail::expression_parser>> parsers;
+  parsers.reserve(expressions.size());
+  for (auto const& expr : expressions) {
+    parsers.push_back(std::make_unique<ast::detail::expression_parser>(
+      expr.get(), table, has_nulls, stream, mr));
+  }
+
+  auto const output_column_mask_state =
+    has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED;
+
+  std::vector<std::unique_ptr<column>> output_columns;
+  output_columns.reserve(parsers.size());
+  for (auto const& parser : parsers) {
+    output_columns.push_back(cudf::make_fixed_width_column(
+      parser->output_type(), table.num_rows(), output_column_mask_state, stream, mr));
+  }
+  if (table.num_rows() == 0) { return output_columns; }
+
+  // Gather the device data for all expressions and outputs
+  auto const max_intermediates = std::accumulate(
+    parsers.begin(), parsers.end(), cudf::size_type{0}, [](auto maximum, auto const& parser) {
+      return std::max(maximum, parser->device_expression_data.num_intermediates);
+    });
+  auto const max_shmem_per_thread = std::accumulate(
+    parsers.begin(), parsers.end(), 0, [](auto maximum, auto const& parser) {
+      return std::max(maximum, parser->shmem_per_thread);
+    });
+
+  std::vector<ast::detail::expression_device_view> h_expression_data;
+  h_expression_data.reserve(parsers.size());
+  for (auto const& parser : parsers) {
+    h_expression_data.push_back(parser->device_expression_data);
+  }
+  auto const d_expression_data = cudf::detail::make_device_uvector_sync(
+    h_expression_data, stream, cudf::get_current_device_resource_ref());
+
+  std::vector<decltype(cudf::mutable_column_device_view::create(std::declval<mutable_column_view>(),
+                                                                stream))>
+    mutable_output_devices;
+  std::vector<mutable_column_device_view> h_output_views;
+  for (auto const& output_column : output_columns) {
+    mutable_output_devices.push_back(
+      cudf::mutable_column_device_view::create(output_column->mutable_view(), stream));
+    h_output_views.push_back(*mutable_output_devices.back());
+  }
+  auto d_output_views = cudf::detail::make_device_uvector_sync(
+    h_output_views, stream, cudf::get_current_device_resource_ref());
+
+  // Configure kernel parameters
+  int device_id;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  auto constexpr MAX_BLOCK_SIZE = 128;
+  auto const block_size =
+    max_shmem_per_thread != 0
+      ? std::min(MAX_BLOCK_SIZE, shmem_limit_per_block / max_shmem_per_thread)
+      : MAX_BLOCK_SIZE;
+  auto const config          = cudf::detail::grid_1d{table.num_rows(), block_size};
+  auto const shmem_per_block = max_shmem_per_thread * config.num_threads_per_block;
+
+  // Execute the kernel
+  auto table_device = table_device_view::create(table, stream);
+  if (has_nulls) {
+    cudf::detail::compute_columns_kernel<MAX_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, d_expression_data, max_intermediates, d_output_views);
+  } else {
+    cudf::detail::compute_columns_kernel<MAX_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, d_expression_data, max_intermediates, d_output_views);
+  }
+  CUDF_CHECK_CUDA(stream.value());
+  if (has_nulls) {
+    for (std::size_t idx = 0; idx < output_columns.size(); ++idx) {
+      output_columns[idx]->set_null_count(cudf::detail::null_count(
+        h_output_views[idx].null_mask(), 0, output_columns[idx]->size(), stream));
+    }
+  }
+  return output_columns;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> compute_column(table_view const& table,
@@ -145,4 +306,14 @@ std::unique_ptr<column> compute_column(table_view const& table,
   return detail::compute_column(table, expr, stream, mr);
 }
 
+std::vector<std::unique_ptr<column>> compute_columns(
+  table_view const& table,
+  std::vector<std::reference_wrapper<ast::expression const>> const& expressions,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_columns(table, expressions, stream, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/cache.hpp"
+#include "jit/util.hpp"
+#include "transform/compute_column_jit.hpp"
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <jit_preprocessed_files/transform/jit/row_kernel.cu.jit.hpp>
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Maps an AST operator to the equivalent C++ operator token
+ *
+ * Only operators whose AST semantics match the plain C++ operator on
+ * numeric operands are mapped. Anything else makes the expression
+ * ineligible for the JIT path.
+ */
+std::optional<std::string> operator_token(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::ADD: return "+";
+    case ast::ast_operator::SUB: return "-";
+    case ast::ast_operator::MUL: return "*";
+    case ast::ast_operator::DIV: return "/";
+    case ast::ast_operator::EQUAL: return "==";
+    case ast::ast_operator::NOT_EQUAL: return "!=";
+    case ast::ast_operator::LESS: return "<";
+    case ast::ast_operator::GREATER: return ">";
+    case ast::ast_operator::LESS_EQUAL: return "<=";
+    case ast::ast_operator::GREATER_EQUAL: return ">=";
+    case ast::ast_operator::BITWISE_AND: return "&";
+    case ast::ast_operator::BITWISE_OR: return "|";
+    case ast::ast_operator::BITWISE_XOR: return "^";
+    case ast::ast_operator::LOGICAL_AND: return "&&";
+    case ast::ast_operator::LOGICAL_OR: return "||";
+    case ast::ast_operator::NOT: return "!";
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Generates a fused C++ row function from an expression tree
+ *
+ * Walks the tree collecting the device data pointer for each leaf operand
+ * and building the equivalent C++ expression string over the type-erased
+ * `inputs` pointers. Column operands index by row; literal operands read
+ * element zero. Unsupported nodes mark the expression as ineligible rather
+ * than throwing so the caller can fall back to the interpreted evaluator.
+ */
+class expression_codegen : public ast::detail::expression_transformer {
+ public:
+  expression_codegen(table_view const& table) : _table(table) {}
+
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    auto const type = expr.get_data_type();
+    if (!cudf::is_numeric(type)) { return mark_unsupported(expr); }
+    _fragments.push_back("static_cast<" + cudf::type_to_name(type) + " const*>(inputs[" +
+                         std::to_string(_input_pointers.size()) + "])[0]");
+    _input_pointers.push_back(expr.get_value().data());
+    return expr;
+  }
+
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    if (expr.get_table_source() != ast::table_reference::LEFT) { return mark_unsupported(expr); }
+    auto const column = _table.column(expr.get_column_index());
+    if (!cudf::is_numeric(column.type())) { return mark_unsupported(expr); }
+    _fragments.push_back("static_cast<" + cudf::type_to_name(column.type()) + " const*>(inputs[" +
+                         std::to_string(_input_pointers.size()) + "])[row]");
+    _input_pointers.push_back(cudf::jit::get_data_ptr(column));
+    return expr;
+  }
+
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    auto const& operands = expr.get_operands();
+    for (auto const& operand : operands) {
+      operand.get().accept(*this);
+    }
+    if (!_supported) { return expr; }
+    auto const token = operator_token(expr.get_operator());
+    if (!token.has_value()) { return mark_unsupported(expr); }
+    if (operands.size() == 1) {
+      auto const arg = std::move(_fragments.back());
+      _fragments.pop_back();
+      _fragments.push_back("(" + *token + arg + ")");
+    } else if (operands.size() == 2) {
+      auto const rhs = std::move(_fragments.back());
+      _fragments.pop_back();
+      auto const lhs = std::move(_fragments.back());
+      _fragments.pop_back();
+      _fragments.push_back("(" + lhs + " " + *token + " " + rhs + ")");
+    } else {
+      return mark_unsupported(expr);
+    }
+    return expr;
+  }
+
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    return mark_unsupported(expr);
+  }
+
+  std::reference_wrapper<ast::expression const> visit(ast::row_index_reference const& expr) override
+  {
+    if (expr.get_table_source() != ast::table_reference::LEFT) { return mark_unsupported(expr); }
+    _fragments.push_back("static_cast<int32_t>(row)");
+    return expr;
+  }
+
+  [[nodiscard]] bool is_supported() const { return _supported && _fragments.size() == 1; }
+  [[nodiscard]] std::string const& expression_source() const { return _fragments.front(); }
+  [[nodiscard]] std::vector<void const*> const& input_pointers() const { return _input_pointers; }
+
+ private:
+  std::reference_wrapper<ast::expression const> mark_unsupported(ast::expression const& expr)
+  {
+    _supported = false;
+    return expr;
+  }
+
+  table_view const& _table;
+  std::vector<std::string> _fragments;
+  std::vector<void const*> _input_pointers;
+  bool _supported{true};
+};
+
+}  // namespace
+
+std::optional<std::unique_ptr<column>> try_compute_column_jit(table_view const& table,
+                                                              ast::expression const& expr,
+                                                              data_type output_type,
+                                                              rmm::cuda_stream_view stream,
+                                                              rmm::device_async_resource_ref mr)
+{
+  if (!cudf::is_numeric(output_type)) { return std::nullopt; }
+
+  auto codegen = expression_codegen{table};
+  expr.accept(codegen);
+  if (!codegen.is_supported()) { return std::nullopt; }
+
+  auto const output_type_name = cudf::type_to_name(output_type);
+  std::string const cuda_source =
+    "__device__ inline void GENERIC_ROW_OP(" + output_type_name +
+    "* output, void const* const* inputs, cudf::size_type row)\n"
+    "{\n"
+    "  *output = static_cast<" +
+    output_type_name + ">(" + codegen.expression_source() +
+    ");\n"
+    "}\n";
+
+  auto output = make_fixed_width_column(
+    output_type, table.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  auto const d_inputs = cudf::detail::make_device_uvector_sync(
+    codegen.input_pointers(), stream, cudf::get_current_device_resource_ref());
+
+  std::string const kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::row_kernel")  //
+      .instantiate(output_type_name);
+
+  cudf::jit::get_program_cache(*transform_jit_row_kernel_cu_jit)
+    .get_kernel(
+      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
+    ->configure_1d_max_occupancy(0, 0, nullptr, stream.value())                             //
+    ->launch(output->size(),                                                                //
+             cudf::jit::get_data_ptr(output->mutable_view()),
+             d_inputs.data());
+
+  return output;
+}
+
+}  // namespace detail
+}  // namespace cudf
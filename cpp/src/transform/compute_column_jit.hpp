@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <optional>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Evaluates an expression with a JIT-compiled fused kernel if possible
+ *
+ * The expression tree is code-generated into a single row function compiled
+ * through the jitify program cache. This removes the per-operator dispatch
+ * and the shared-memory intermediate traffic of the interpreted evaluator.
+ *
+ * Only expressions over non-nullable numeric columns and valid numeric
+ * literals with arithmetic, comparison, logical and bitwise operators are
+ * eligible. Returns `std::nullopt` when the expression is not eligible so
+ * the caller can fall back to the interpreted kernel.
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param output_type The type of the resulting column as deduced by the expression parser
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column if the expression was evaluated or `std::nullopt`
+ */
+std::optional<std::unique_ptr<column>> try_compute_column_jit(table_view const& table,
+                                                              ast::expression const& expr,
+                                                              data_type output_type,
+                                                              rmm::cuda_stream_view stream,
+                                                              rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -39,6 +39,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/tabulate.h>
 
+#include <optional>
+
 namespace cudf {
 namespace detail {
 
@@ -474,8 +476,45 @@ CUDF_KERNEL void compute_segment_sizes(device_span<column_device_view const> col
   }
 }
 
+/**
+ * @brief Returns the constant per-row bit count of a column, or nullopt if the column's
+ * per-row size is data dependent.
+ *
+ * Matches the accounting of `flatten_functor`: element storage bits plus one validity bit
+ * per nullable column, recursing through struct children. Strings, lists, and dictionaries
+ * have row sizes that depend on their offsets or keys and are not constant.
+ */
+std::optional<size_type> constant_column_bit_count(column_view const& col)
+{
+  auto const validity_bit = col.nullable() ? 1 : 0;
+  if (cudf::is_fixed_width(col.type())) {
+    return static_cast<size_type>(cudf::size_of(col.type()) * CHAR_BIT) + validity_bit;
+  }
+  if (col.type().id() == type_id::STRUCT) {
+    auto size = size_type{validity_bit};
+    for (size_type i = 0; i < col.num_children(); ++i) {
+      auto const child_size = constant_column_bit_count(col.child(i));
+      if (not child_size.has_value()) { return std::nullopt; }
+      size += *child_size;
+    }
+    return size;
+  }
+  return std::nullopt;
+}
+
 }  // anonymous namespace
 
+std::optional<size_type> constant_row_bit_count(table_view const& t)
+{
+  auto size = size_type{0};
+  for (auto const& col : t) {
+    auto const col_size = constant_column_bit_count(col);
+    if (not col_size.has_value()) { return std::nullopt; }
+    size += *col_size;
+  }
+  return size;
+}
+
 std::unique_ptr<column> segmented_row_bit_count(table_view const& t,
                                                 size_type segment_length,
                                                 rmm::cuda_stream_view stream,
@@ -583,4 +622,10 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
   return detail::row_bit_count(t, stream, mr);
 }
 
+std::optional<size_type> constant_row_bit_count(table_view const& t)
+{
+  CUDF_FUNC_RANGE();
+  return detail::constant_row_bit_count(t);
+}
+
 }  // namespace cudf
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/flattened_column_metadata.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+
+namespace cudf::detail {
+
+namespace {
+
+flattened_column_metadata::column_metadata make_metadata(column_view const& col)
+{
+  return {col.type(),
+          col.size(),
+          col.head(),
+          col.null_mask(),
+          col.null_count(),
+          col.offset(),
+          0,
+          col.num_children()};
+}
+
+}  // namespace
+
+flattened_column_metadata::flattened_column_metadata(column_view const& col)
+{
+  _arena.reserve(count_descendants(col) + 1);
+  _arena.push_back(make_metadata(col));
+  flatten_children(0, col);
+}
+
+void flattened_column_metadata::flatten_children(size_type parent_index, column_view const& parent)
+{
+  auto const first_child           = static_cast<size_type>(_arena.size());
+  _arena[parent_index].first_child = first_child;
+  std::for_each(parent.child_begin(), parent.child_end(), [&](column_view const& child) {
+    _arena.push_back(make_metadata(child));
+  });
+  for (size_type i = 0; i < parent.num_children(); ++i) {
+    flatten_children(first_child + i, parent.child(i));
+  }
+}
+
+flattened_column_metadata flattened_column_metadata::slice(size_type begin,
+                                                           size_type end,
+                                                           rmm::cuda_stream_view stream) const
+{
+  CUDF_EXPECTS((begin >= 0) && (end >= begin) && (end <= root().size),
+               "Slice range out of bounds.");
+  flattened_column_metadata result{*this};
+  auto& new_root = result._arena.front();
+  new_root.offset += begin;
+  new_root.size = end - begin;
+  new_root.null_count =
+    (root().null_count == 0)
+      ? 0
+      : cudf::detail::null_count(
+          root().null_mask, root().offset + begin, root().offset + end, stream);
+  return result;
+}
+
+column_view flattened_column_metadata::to_column_view() const { return build_column_view(0); }
+
+column_view flattened_column_metadata::build_column_view(size_type index) const
+{
+  auto const& meta = _arena[index];
+  std::vector<column_view> children;
+  children.reserve(meta.num_children);
+  for (size_type i = 0; i < meta.num_children; ++i) {
+    children.push_back(build_column_view(meta.first_child + i));
+  }
+  return column_view{meta.type,
+                     meta.size,
+                     meta.data,
+                     meta.null_mask,
+                     meta.null_count,
+                     meta.offset,
+                     std::move(children)};
+}
+
+}  // namespace cudf::detail
@@ -24,9 +24,40 @@
 #include <rmm/mr/device/pool_memory_resource.hpp>
 #include <rmm/mr/pinned_host_memory_resource.hpp>
 
+#include <atomic>
+
 namespace cudf {
 
 namespace {
+
+// Telemetry for the default pinned pool; the counters are queryable through
+// get_pinned_pool_statistics() to diagnose pool exhaustion at runtime
+struct pinned_pool_counters_t {
+  std::atomic<size_t> hits{0};
+  std::atomic<size_t> fallbacks{0};
+  std::atomic<size_t> in_use{0};
+  std::atomic<size_t> high_water_mark{0};
+
+  void record_allocation(size_t bytes)
+  {
+    hits.fetch_add(1, std::memory_order_relaxed);
+    auto const usage = in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    auto prev        = high_water_mark.load(std::memory_order_relaxed);
+    while (prev < usage &&
+           !high_water_mark.compare_exchange_weak(prev, usage, std::memory_order_relaxed)) {}
+  }
+
+  void record_fallback() { fallbacks.fetch_add(1, std::memory_order_relaxed); }
+
+  void record_deallocation(size_t bytes) { in_use.fetch_sub(bytes, std::memory_order_relaxed); }
+};
+
+CUDF_EXPORT pinned_pool_counters_t& pinned_pool_counters()
+{
+  static pinned_pool_counters_t counters;
+  return counters;
+}
+
 class fixed_pinned_pool_memory_resource {
   using upstream_mr    = rmm::mr::pinned_host_memory_resource;
   using host_pooled_mr = rmm::mr::pool_memory_resource<upstream_mr>;
@@ -58,12 +89,15 @@ class fixed_pinned_pool_memory_resource {
   {
     if (bytes <= pool_size_) {
       try {
-        return pool_->allocate_async(bytes, alignment, stream);
+        auto* const result = pool_->allocate_async(bytes, alignment, stream);
+        pinned_pool_counters().record_allocation(bytes);
+        return result;
       } catch (...) {
         // If the pool is exhausted, fall back to the upstream memory resource
       }
     }
 
+    pinned_pool_counters().record_fallback();
     return upstream_mr_.allocate_async(bytes, alignment, stream);
   }
 
@@ -86,6 +120,7 @@ class fixed_pinned_pool_memory_resource {
   {
     if (bytes <= pool_size_ && ptr >= pool_begin_ && ptr < pool_end_) {
       pool_->deallocate_async(ptr, bytes, alignment, stream);
+      pinned_pool_counters().record_deallocation(bytes);
     } else {
       upstream_mr_.deallocate_async(ptr, bytes, alignment, stream);
     }
@@ -274,6 +309,26 @@ bool config_default_pinned_memory_resource(pinned_mr_options const& opts)
   return did_configure;
 }
 
+pinned_pool_statistics get_pinned_pool_statistics()
+{
+  auto const& counters = pinned_pool_counters();
+  return {counters.hits.load(std::memory_order_relaxed),
+          counters.fallbacks.load(std::memory_order_relaxed),
+          counters.in_use.load(std::memory_order_relaxed),
+          counters.high_water_mark.load(std::memory_order_relaxed)};
+}
+
+void reset_pinned_pool_statistics()
+{
+  auto& counters = pinned_pool_counters();
+  counters.hits.store(0, std::memory_order_relaxed);
+  counters.fallbacks.store(0, std::memory_order_relaxed);
+  // Bytes currently allocated from the pool are still outstanding, so the high-water mark
+  // restarts from the current usage rather than zero
+  counters.high_water_mark.store(counters.in_use.load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+}
+
 CUDF_EXPORT auto& kernel_pinned_copy_threshold()
 {
   // use cudaMemcpyAsync for all pinned copies
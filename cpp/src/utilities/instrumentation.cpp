@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/export.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace cudf {
+
+namespace {
+
+struct call_totals {
+  std::size_t num_calls{0};
+  std::chrono::nanoseconds total_time{0};
+};
+
+CUDF_EXPORT std::atomic<bool>& instrumentation_enabled()
+{
+  static std::atomic<bool> enabled{false};
+  return enabled;
+}
+
+CUDF_EXPORT std::mutex& registry_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+CUDF_EXPORT std::unordered_map<std::string, call_totals>& registry()
+{
+  static std::unordered_map<std::string, call_totals> records;
+  return records;
+}
+
+// Thread-local stack of the libcudf calls active on this thread. Entries are `__func__`
+// literals, so the vector only ever stores pointers; reuse across calls means pushes do not
+// allocate in steady state.
+std::vector<char const*>& call_stack() noexcept
+{
+  thread_local std::vector<char const*> stack;
+  return stack;
+}
+
+}  // namespace
+
+void set_instrumentation(bool enabled)
+{
+  instrumentation_enabled().store(enabled, std::memory_order_relaxed);
+}
+
+bool get_instrumentation() { return instrumentation_enabled().load(std::memory_order_relaxed); }
+
+std::vector<instrumentation_record> get_instrumentation_records()
+{
+  std::scoped_lock lock{registry_mutex()};
+  std::vector<instrumentation_record> records;
+  records.reserve(registry().size());
+  for (auto const& [name, totals] : registry()) {
+    records.push_back({name, totals.num_calls, totals.total_time});
+  }
+  return records;
+}
+
+void reset_instrumentation_records()
+{
+  std::scoped_lock lock{registry_mutex()};
+  registry().clear();
+}
+
+std::vector<std::string> get_current_call_stack()
+{
+  auto const& stack = call_stack();
+  return {stack.begin(), stack.end()};
+}
+
+namespace detail {
+
+std::vector<char const*> const& current_call_stack() noexcept { return call_stack(); }
+
+void push_call(char const* name) { call_stack().push_back(name); }
+
+void pop_call() noexcept { call_stack().pop_back(); }
+
+bool is_instrumentation_enabled() noexcept
+{
+  return instrumentation_enabled().load(std::memory_order_relaxed);
+}
+
+void record_instrumented_call(char const* name, std::chrono::nanoseconds elapsed)
+{
+  std::scoped_lock lock{registry_mutex()};
+  auto& totals = registry()[name];
+  ++totals.num_calls;
+  totals.total_time += elapsed;
+}
+
+}  // namespace detail
+
+}  // namespace cudf
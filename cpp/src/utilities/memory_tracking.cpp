@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/logger.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+#include <cudf/utilities/memory_tracking.hpp>
+
+#include <rmm/bad_alloc.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+
+namespace {
+
+// Builds the attribution key for the current thread from the active libcudf call stack
+std::string current_attribution_key()
+{
+  auto const& stack = detail::current_call_stack();
+  if (stack.empty()) { return "(unattributed)"; }
+  std::string key = stack.front();
+  std::for_each(stack.begin() + 1, stack.end(), [&](char const* name) {
+    key += " > ";
+    key += name;
+  });
+  return key;
+}
+
+}  // namespace
+
+call_tracking_resource_adaptor::call_tracking_resource_adaptor(
+  rmm::device_async_resource_ref upstream)
+  : _upstream{upstream}
+{
+}
+
+std::vector<call_memory_record> call_tracking_resource_adaptor::get_records() const
+{
+  std::scoped_lock lock{_mutex};
+  std::vector<call_memory_record> records;
+  records.reserve(_records.size());
+  for (auto const& [stack, totals] : _records) {
+    records.push_back({stack, totals.num_allocations, totals.bytes_allocated, totals.peak_bytes});
+  }
+  return records;
+}
+
+void call_tracking_resource_adaptor::reset_records()
+{
+  std::scoped_lock lock{_mutex};
+  _records.clear();
+  // Re-seed the entries for still-live allocations so their deallocations have a
+  // matching record to decrement
+  for (auto const& [ptr, alloc] : _outstanding) {
+    auto& totals = _records[alloc.second];
+    totals.current_bytes += alloc.first;
+    totals.peak_bytes = std::max(totals.peak_bytes, totals.current_bytes);
+  }
+}
+
+void* call_tracking_resource_adaptor::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  auto key = current_attribution_key();
+  void* ptr{};
+  try {
+    ptr = _upstream.allocate_async(bytes, rmm::CUDA_ALLOCATION_ALIGNMENT, stream);
+  } catch (rmm::out_of_memory const&) {
+    CUDF_LOG_ERROR("Failed to allocate {} bytes in call stack '{}'", bytes, key);
+    log_records();
+    throw;
+  }
+  std::scoped_lock lock{_mutex};
+  auto& totals = _records[key];
+  ++totals.num_allocations;
+  totals.bytes_allocated += bytes;
+  totals.current_bytes += bytes;
+  totals.peak_bytes = std::max(totals.peak_bytes, totals.current_bytes);
+  _outstanding.emplace(ptr, std::pair{bytes, std::move(key)});
+  return ptr;
+}
+
+void call_tracking_resource_adaptor::do_deallocate(void* ptr,
+                                                   std::size_t bytes,
+                                                   rmm::cuda_stream_view stream)
+{
+  _upstream.deallocate_async(ptr, bytes, rmm::CUDA_ALLOCATION_ALIGNMENT, stream);
+  std::scoped_lock lock{_mutex};
+  auto const it = _outstanding.find(ptr);
+  if (it == _outstanding.end()) { return; }
+  auto const record = _records.find(it->second.second);
+  if (record != _records.end()) { record->second.current_bytes -= it->second.first; }
+  _outstanding.erase(it);
+}
+
+bool call_tracking_resource_adaptor::do_is_equal(device_memory_resource const& other) const noexcept
+{
+  if (this == &other) { return true; }
+  auto cast = dynamic_cast<call_tracking_resource_adaptor const*>(&other);
+  if (cast == nullptr) { return false; }
+  return get_upstream_resource() == cast->get_upstream_resource();
+}
+
+void call_tracking_resource_adaptor::log_records() const
+{
+  std::vector<call_memory_record> records;
+  {
+    std::scoped_lock lock{_mutex};
+    records.reserve(_records.size());
+    for (auto const& [stack, totals] : _records) {
+      records.push_back({stack, totals.num_allocations, totals.bytes_allocated, totals.peak_bytes});
+    }
+  }
+  std::sort(records.begin(), records.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.peak_bytes > rhs.peak_bytes;
+  });
+  CUDF_LOG_ERROR("Per-call peak device memory usage at allocation failure:");
+  for (auto const& record : records) {
+    CUDF_LOG_ERROR("  {}: peak {} bytes, {} allocations, {} bytes total",
+                   record.call_stack,
+                   record.peak_bytes,
+                   record.num_allocations,
+                   record.bytes_allocated);
+  }
+}
+
+}  // namespace cudf
@@ -18,11 +18,14 @@
 #include <cudf/logger.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/stream_pool.hpp>
 
 #include <rmm/cuda_stream_pool.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdlib>
 #include <mutex>
 #include <vector>
 
@@ -36,6 +39,10 @@ namespace cudf::detail {
 // defaults to 16.
 std::size_t constexpr STREAM_POOL_SIZE = 32;
 
+// Number of pool streams reserved per host thread when handing out stream sets; matches the
+// per-thread stream estimate used to size the pool above.
+std::size_t constexpr STREAMS_PER_THREAD = 8;
+
 // FIXME: "borrowed" from rmm...remove when this stream pool is moved there
 #ifdef NDEBUG
 #define CUDF_ASSERT_CUDA_SUCCESS(_call) \
@@ -110,6 +117,25 @@ cudaEvent_t event_for_thread()
   return *thread_events[device_id.value()];
 }
 
+// Pool size requested via `cudf::set_stream_pool_size`; zero means not set.
+std::atomic<std::size_t> requested_pool_size{0};
+// Set once the first pool has been created; later size changes only affect new pools.
+std::atomic<bool> pool_created{false};
+
+/**
+ * @brief Returns the number of streams to create in a new stream pool.
+ */
+std::size_t stream_pool_size()
+{
+  if (auto const size = requested_pool_size.load(); size != 0) { return size; }
+  if (auto const* env = std::getenv("LIBCUDF_STREAM_POOL_SIZE")) {
+    auto const size = std::stoul(env);
+    CUDF_EXPECTS(size > 0, "LIBCUDF_STREAM_POOL_SIZE must be nonzero");
+    return size;
+  }
+  return STREAM_POOL_SIZE;
+}
+
 }  // namespace
 
 /**
@@ -119,7 +145,7 @@ class rmm_cuda_stream_pool : public cuda_stream_pool {
   rmm::cuda_stream_pool _pool;
 
  public:
-  rmm_cuda_stream_pool() : _pool{STREAM_POOL_SIZE} {}
+  rmm_cuda_stream_pool() : _pool{stream_pool_size()} {}
   rmm::cuda_stream_view get_stream() override { return _pool.get_stream(); }
   rmm::cuda_stream_view get_stream(stream_id_type stream_id) override
   {
@@ -128,17 +154,24 @@ class rmm_cuda_stream_pool : public cuda_stream_pool {
 
   std::vector<rmm::cuda_stream_view> get_streams(std::size_t count) override
   {
-    if (count > STREAM_POOL_SIZE) {
-      CUDF_LOG_WARN("get_streams called with count ({}) > pool size ({})", count, STREAM_POOL_SIZE);
+    if (count > _pool.get_pool_size()) {
+      CUDF_LOG_WARN(
+        "get_streams called with count ({}) > pool size ({})", count, _pool.get_pool_size());
     }
+    // Each host thread draws streams starting at its own fixed offset into the pool, so a thread
+    // sees a consistent set of streams across calls and concurrently running threads do not
+    // alias each other's streams as long as the pool is large enough.
+    static std::atomic<stream_id_type> next_thread_offset{0};
+    thread_local stream_id_type const thread_offset =
+      next_thread_offset.fetch_add(STREAMS_PER_THREAD);
     auto streams = std::vector<rmm::cuda_stream_view>();
     for (uint32_t i = 0; i < count; i++) {
-      streams.emplace_back(_pool.get_stream());
+      streams.emplace_back(_pool.get_stream(thread_offset + i));
     }
     return streams;
   }
 
-  [[nodiscard]] std::size_t get_stream_pool_size() const override { return STREAM_POOL_SIZE; }
+  [[nodiscard]] std::size_t get_stream_pool_size() const override { return _pool.get_pool_size(); }
 };
 
 /**
@@ -181,6 +214,7 @@ cuda_stream_pool& global_cuda_stream_pool()
   std::lock_guard<std::mutex> const lock(mutex);
   if (pools[device_id.value()] == nullptr) {
     pools[device_id.value()] = create_global_cuda_stream_pool();
+    pool_created.store(true);
   }
   return *pools[device_id.value()];
 }
@@ -206,3 +240,26 @@ void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stre
 }
 
 }  // namespace cudf::detail
+
+namespace cudf {
+
+std::vector<rmm::cuda_stream_view> fork_streams(rmm::cuda_stream_view stream, std::size_t count)
+{
+  return detail::fork_streams(stream, count);
+}
+
+void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stream_view stream)
+{
+  detail::join_streams(streams, stream);
+}
+
+bool set_stream_pool_size(std::size_t size)
+{
+  CUDF_EXPECTS(size > 0, "Stream pool size must be nonzero");
+  detail::requested_pool_size.store(size);
+  return not detail::pool_created.load();
+}
+
+std::size_t get_stream_pool_size() { return detail::global_cuda_stream_pool().get_stream_pool_size(); }
+
+}  // namespace cudf
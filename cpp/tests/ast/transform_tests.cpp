@@ -148,6 +148,59 @@ TEST_F(TransformTest, BasicAddition)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, DeepArithmeticTree)
+{
+  // a deep operator chain mixing columns and literals exercises the fused
+  // JIT kernel path on non-nullable numeric inputs
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::numeric_scalar<int32_t>(2);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto diff       = cudf::ast::operation(cudf::ast::ast_operator::SUB, col_ref_0, col_ref_1);
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, diff);
+  auto scaled     = cudf::ast::operation(cudf::ast::ast_operator::MUL, product, literal);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, scaled, col_ref_1);
+
+  // 2 * (c0 + c1) * (c0 - c1) + c1
+  auto expected = column_wrapper<int32_t>{-172, 709, -778, 5000};
+  auto result   = cudf::compute_column(table, expression);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, MultipleExpressions)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+
+  auto sum  = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto diff = cudf::ast::operation(cudf::ast::ast_operator::SUB, col_ref_1, col_ref_1);
+  auto less = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  auto results = cudf::compute_columns(table, {sum, diff, less});
+  ASSERT_EQ(results.size(), 3u);
+
+  // results match evaluating each expression separately
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    cudf::compute_column(table, sum)->view(), results[0]->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    cudf::compute_column(table, diff)->view(), results[1]->view(), verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    cudf::compute_column(table, less)->view(), results[2]->view(), verbosity);
+
+  EXPECT_THROW(cudf::compute_columns(table, {}), std::invalid_argument);
+}
+
 TEST_F(TransformTest, BasicAdditionEmptyTable)
 {
   auto c_0   = column_wrapper<int32_t>{};
@@ -577,6 +630,68 @@ TEST_F(TransformTest, StringScalarComparison)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringContains)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"abc", "cab", "bca", ""});
+  auto table = cudf::table_view{{c_0}};
+
+  auto literal_value = cudf::string_scalar("ab");
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+
+  auto contains =
+    cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, literal);
+  auto expected_contains = column_wrapper<bool>{true, true, false, false};
+  auto result_contains   = cudf::compute_column(table, contains);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_contains, result_contains->view(), verbosity);
+
+  auto starts_with =
+    cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, literal);
+  auto expected_starts = column_wrapper<bool>{true, false, false, false};
+  auto result_starts   = cudf::compute_column(table, starts_with);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_starts, result_starts->view(), verbosity);
+
+  auto ends_with = cudf::ast::operation(cudf::ast::ast_operator::ENDS_WITH, col_ref_0, literal);
+  auto expected_ends = column_wrapper<bool>{false, true, false, false};
+  auto result_ends   = cudf::compute_column(table, ends_with);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_ends, result_ends->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringLike)
+{
+  auto c_0 = cudf::test::strings_column_wrapper(
+    {"abc", "a1c", "abcd", "bc", ""}, {true, true, true, true, false});
+  auto table = cudf::table_view{{c_0}};
+
+  auto literal_value = cudf::string_scalar("a_c%");
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LIKE, col_ref_0, literal);
+
+  auto expected =
+    column_wrapper<bool>{{true, true, true, false, false}, {true, true, true, true, false}};
+  auto result = cudf::compute_column(table, expression);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringLength)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"", "a", "bb", "héllo"});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LENGTH, col_ref_0);
+
+  // LENGTH counts characters, not bytes
+  auto expected = column_wrapper<cudf::size_type>{0, 1, 2, 5};
+  auto result   = cudf::compute_column(table, expression);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, NumericScalarComparison)
 {
   auto c_0   = column_wrapper<int32_t>{1, 12, 123, 23};
@@ -837,4 +952,39 @@ TEST_F(TransformTest, NullLogicalOr)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, RowIndexReference)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  auto row_index = cudf::ast::row_index_reference();
+
+  auto result   = cudf::compute_column(table, row_index);
+  auto expected = column_wrapper<int32_t>{0, 1, 2, 3};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, RowIndexSequenceArithmetic)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  // init + step * row_index, fused with an addition of the input column
+  auto row_index  = cudf::ast::row_index_reference();
+  auto step_value = cudf::numeric_scalar<int32_t>(10);
+  auto step       = cudf::ast::literal(step_value);
+  auto init_value = cudf::numeric_scalar<int32_t>(5);
+  auto init       = cudf::ast::literal(init_value);
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto scaled     = cudf::ast::operation(cudf::ast::ast_operator::MUL, row_index, step);
+  auto sequence   = cudf::ast::operation(cudf::ast::ast_operator::ADD, scaled, init);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, sequence, col_ref_0);
+
+  auto result   = cudf::compute_column(table, expression);
+  auto expected = column_wrapper<int32_t>{8, 35, 26, 85};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
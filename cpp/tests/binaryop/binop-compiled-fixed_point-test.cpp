@@ -901,3 +901,41 @@ TYPED_TEST(FixedPointCompiledTest, FixedPointWithFloating)
   test_fixed_floating(cudf::binary_operator::NULL_MAX, 4.0, 20, -1, decimal_result);
   test_fixed_floating(cudf::binary_operator::NULL_MIN, 4.0, 200, -1, decimal_result);
 }
+
+struct FixedPointCompiledDecimal128Test : public cudf::test::BaseFixture {};
+
+TEST_F(FixedPointCompiledDecimal128Test, FixedPointBinaryOpMultiplyWideIntermediate)
+{
+  using namespace numeric;
+  using RepType = cudf::device_storage_type_t<decimal128>;
+
+  // lhs * rhs overflows 128 bits before the rescale divide, but the rescaled result fits
+  auto const ten_pow20 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto) { return detail::ipow<RepType, Radix::BASE_10>(20); });
+  auto const lhs = fp_wrapper<RepType>(ten_pow20, ten_pow20 + 3, scale_type{0});
+  auto const rhs = fp_wrapper<RepType>(ten_pow20, ten_pow20 + 3, scale_type{0});
+
+  auto const expected_rep = cudf::detail::make_counting_transform_iterator(
+    0, [](auto) { return detail::ipow<RepType, Radix::BASE_10>(30); });
+  auto const expected = fp_wrapper<RepType>(expected_rep, expected_rep + 3, scale_type{10});
+
+  auto const result = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::MUL, cudf::data_type{cudf::type_id::DECIMAL128, 10});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(FixedPointCompiledDecimal128Test, FixedPointBinaryOpMultiplyFusedRescale)
+{
+  using namespace numeric;
+  using RepType = cudf::device_storage_type_t<decimal128>;
+
+  auto const lhs      = fp_wrapper<RepType>{{1111, -2222, 3333, 4444}, scale_type{-3}};
+  auto const rhs      = fp_wrapper<RepType>{{2000, 2000, -2000, 2000}, scale_type{-3}};
+  auto const expected = fp_wrapper<RepType>{{22, -44, -66, 88}, scale_type{-1}};
+
+  auto const result = cudf::binary_operation(
+    lhs, rhs, cudf::binary_operator::MUL, cudf::data_type{cudf::type_id::DECIMAL128, -1});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
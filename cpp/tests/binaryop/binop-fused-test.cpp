@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <stdexcept>
+
+struct BinopFusedTest : public cudf::test::BaseFixture {};
+
+TEST_F(BinopFusedTest, FusedMultiplyAdd)
+{
+  auto const x = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3, 4};
+  auto const y = cudf::test::fixed_width_column_wrapper<int32_t>{10, 20, 30, 40};
+  auto const z = cudf::test::fixed_width_column_wrapper<int32_t>{5, 6, 7, 8};
+
+  auto const result   = cudf::fused_multiply_add(x, y, z);
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>{15, 46, 97, 168};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(BinopFusedTest, FusedMultiplyAddWithNulls)
+{
+  auto const x = cudf::test::fixed_width_column_wrapper<double>{{1.0, 2.0, 3.0}, {1, 0, 1}};
+  auto const y = cudf::test::fixed_width_column_wrapper<double>{2.0, 2.0, 2.0};
+  auto const z = cudf::test::fixed_width_column_wrapper<double>{1.0, 1.0, 1.0};
+
+  auto const result   = cudf::fused_multiply_add(x, y, z);
+  auto const expected = cudf::test::fixed_width_column_wrapper<double>{{3.0, 0.0, 7.0}, {1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(BinopFusedTest, FusedMultiplyAddSizeMismatch)
+{
+  auto const x = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const y = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2};
+  EXPECT_THROW(cudf::fused_multiply_add(x, y, x), std::invalid_argument);
+}
+
+TEST_F(BinopFusedTest, CompareAndSelect)
+{
+  auto const lhs  = cudf::test::fixed_width_column_wrapper<int32_t>{1, 5, 3, 9};
+  auto const rhs  = cudf::test::fixed_width_column_wrapper<int32_t>{4, 4, 4, 4};
+  auto const tval = cudf::test::fixed_width_column_wrapper<int32_t>{10, 20, 30, 40};
+  auto const fval = cudf::test::fixed_width_column_wrapper<int32_t>{-1, -2, -3, -4};
+
+  auto const result =
+    cudf::compare_and_select(lhs, rhs, cudf::binary_operator::LESS, tval, fval);
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>{10, -2, 30, -4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(BinopFusedTest, CompareAndSelectNullComparison)
+{
+  // a null comparison result selects from false_values
+  auto const lhs  = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 5, 3}, {1, 0, 1}};
+  auto const rhs  = cudf::test::fixed_width_column_wrapper<int32_t>{4, 4, 4};
+  auto const tval = cudf::test::fixed_width_column_wrapper<int32_t>{10, 20, 30};
+  auto const fval = cudf::test::fixed_width_column_wrapper<int32_t>{-1, -2, -3};
+
+  auto const result =
+    cudf::compare_and_select(lhs, rhs, cudf::binary_operator::LESS, tval, fval);
+  auto const expected = cudf::test::fixed_width_column_wrapper<int32_t>{10, -2, 30};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(BinopFusedTest, CompareAndSelectMixedTypes)
+{
+  // lhs/rhs type differs from the value columns: takes the fallback path
+  auto const lhs  = cudf::test::fixed_width_column_wrapper<double>{1.5, 4.5};
+  auto const rhs  = cudf::test::fixed_width_column_wrapper<double>{2.0, 2.0};
+  auto const tval = cudf::test::fixed_width_column_wrapper<int64_t>{100, 200};
+  auto const fval = cudf::test::fixed_width_column_wrapper<int64_t>{-100, -200};
+
+  auto const result =
+    cudf::compare_and_select(lhs, rhs, cudf::binary_operator::GREATER, tval, fval);
+  auto const expected = cudf::test::fixed_width_column_wrapper<int64_t>{-100, 200};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST_F(BinopFusedTest, CompareAndSelectErrors)
+{
+  auto const col   = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2};
+  auto const other = cudf::test::fixed_width_column_wrapper<int64_t>{1, 2};
+  EXPECT_THROW(cudf::compare_and_select(col, col, cudf::binary_operator::ADD, col, col),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::compare_and_select(col, col, cudf::binary_operator::LESS, col, other),
+               cudf::data_type_error);
+}
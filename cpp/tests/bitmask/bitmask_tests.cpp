@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -754,4 +754,179 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3_mask.data());
 }
 
+TEST_F(MergeBitmaskTest, TestBitmaskAndAllValidAllNull)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const all_valid({1, 1, 1, 1, 1}, {1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<bool> const all_null({1, 1, 1, 1, 1}, {0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const mixed({0, 1, 0, 1, 1}, {0, 1, 1, 1, 0});
+
+  auto const num_rows = cudf::column_view{mixed}.size();
+
+  // All-valid masks are the AND identity and must not change the result
+  auto [and_mask, and_null_count] = cudf::bitmask_and(cudf::table_view({all_valid, mixed}));
+  std::vector<int> const mixed_validity{0, 1, 1, 1, 0};
+  auto mixed_gold                 = std::get<0>(
+    cudf::test::detail::make_null_mask(mixed_validity.begin(), mixed_validity.end()));
+  EXPECT_EQ(and_null_count, 2);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    and_mask.data(), mixed_gold.data(), cudf::num_bitmask_words(num_rows));
+
+  // Only all-valid masks: the result keeps a mask but has no nulls
+  auto [valid_mask, valid_null_count] =
+    cudf::bitmask_and(cudf::table_view({all_valid, all_valid}));
+  EXPECT_NE(nullptr, valid_mask.data());
+  EXPECT_EQ(valid_null_count, 0);
+  EXPECT_EQ(
+    cudf::null_count(static_cast<cudf::bitmask_type const*>(valid_mask.data()), 0, num_rows), 0);
+
+  // An all-null column forces the result to all-null
+  auto [null_mask, null_null_count] = cudf::bitmask_and(cudf::table_view({all_null, mixed}));
+  EXPECT_EQ(null_null_count, num_rows);
+  EXPECT_EQ(cudf::null_count(static_cast<cudf::bitmask_type const*>(null_mask.data()), 0, num_rows),
+            num_rows);
+}
+
+TEST_F(MergeBitmaskTest, TestBitmaskOrAllValidAllNull)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const all_valid({1, 1, 1, 1, 1}, {1, 1, 1, 1, 1});
+  cudf::test::fixed_width_column_wrapper<bool> const all_null({1, 1, 1, 1, 1}, {0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const mixed({0, 1, 0, 1, 1}, {0, 1, 1, 1, 0});
+
+  auto const num_rows = cudf::column_view{mixed}.size();
+
+  // An all-valid column makes the OR all-valid without reading any other mask
+  auto [valid_mask, valid_null_count] = cudf::bitmask_or(cudf::table_view({all_valid, all_null}));
+  EXPECT_NE(nullptr, valid_mask.data());
+  EXPECT_EQ(valid_null_count, 0);
+  EXPECT_EQ(
+    cudf::null_count(static_cast<cudf::bitmask_type const*>(valid_mask.data()), 0, num_rows), 0);
+
+  // All-null masks are the OR identity and must not change the result
+  auto [or_mask, or_null_count] = cudf::bitmask_or(cudf::table_view({mixed, all_null}));
+  std::vector<int> const mixed_validity{0, 1, 1, 1, 0};
+  auto mixed_gold               = std::get<0>(
+    cudf::test::detail::make_null_mask(mixed_validity.begin(), mixed_validity.end()));
+  EXPECT_EQ(or_null_count, 2);
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(
+    or_mask.data(), mixed_gold.data(), cudf::num_bitmask_words(num_rows));
+
+  // Only all-null columns: the result is all-null
+  auto [null_mask, null_null_count] = cudf::bitmask_or(cudf::table_view({all_null, all_null}));
+  EXPECT_EQ(null_null_count, num_rows);
+  EXPECT_EQ(cudf::null_count(static_cast<cudf::bitmask_type const*>(null_mask.data()), 0, num_rows),
+            num_rows);
+}
+
+namespace {
+
+// Compares each element of a batched bitmask merge against its single-table reference
+void expect_matches_single_table(
+  std::vector<std::pair<rmm::device_buffer, cudf::size_type>> const& batched,
+  std::vector<cudf::table_view> const& views,
+  std::pair<rmm::device_buffer, cudf::size_type> (*single)(cudf::table_view const&,
+                                                           rmm::cuda_stream_view,
+                                                           rmm::device_async_resource_ref))
+{
+  ASSERT_EQ(batched.size(), views.size());
+  for (std::size_t i = 0; i < views.size(); ++i) {
+    auto const [reference_mask, reference_null_count] =
+      single(views[i], cudf::get_default_stream(), cudf::get_current_device_resource_ref());
+    EXPECT_EQ(batched[i].second, reference_null_count);
+    EXPECT_EQ(batched[i].first.is_empty(), reference_mask.is_empty());
+    if (not reference_mask.is_empty()) {
+      CUDF_TEST_EXPECT_EQUAL_BUFFERS(batched[i].first.data(),
+                                     reference_mask.data(),
+                                     cudf::num_bitmask_words(views[i].num_rows()));
+    }
+  }
+}
+
+}  // namespace
+
+TEST_F(MergeBitmaskTest, BatchedBitmaskAnd)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col1({0, 1, 0, 1, 1}, {0, 1, 1, 1, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col2({0, 2, 1, 0, 255}, {1, 1, 0, 1, 0});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col3({0, 2, 1, 0, 255});
+  cudf::test::fixed_width_column_wrapper<int32_t> const empty_col{};
+
+  auto const views = std::vector<cudf::table_view>{cudf::table_view({bools_col3}),
+                                                   cudf::table_view({bools_col1, bools_col2}),
+                                                   cudf::table_view({bools_col1, bools_col3}),
+                                                   cudf::table_view({empty_col}),
+                                                   cudf::table_view({bools_col1, bools_col2,
+                                                                     bools_col3})};
+
+  expect_matches_single_table(cudf::batched_bitmask_and(views), views, cudf::bitmask_and);
+}
+
+TEST_F(MergeBitmaskTest, BatchedBitmaskOr)
+{
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col1({0, 1, 0, 1, 1}, {1, 1, 0, 0, 1});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col2({0, 2, 1, 0, 255}, {0, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<bool> const bools_col3({0, 2, 1, 0, 255});
+
+  auto const views = std::vector<cudf::table_view>{cudf::table_view({bools_col3}),
+                                                   cudf::table_view({bools_col1, bools_col2}),
+                                                   cudf::table_view({bools_col1, bools_col2,
+                                                                     bools_col3})};
+
+  expect_matches_single_table(cudf::batched_bitmask_or(views), views, cudf::bitmask_or);
+
+  // no tasks at all
+  EXPECT_TRUE(cudf::batched_bitmask_or(std::vector<cudf::table_view>{}).empty());
+}
+
+TEST_F(MergeBitmaskTest, TableNullCounts)
+{
+  constexpr cudf::size_type num_rows{1000};
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto values   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> const with_nulls(
+    values, values + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> const no_nulls(values, values + num_rows);
+  auto const sliced = cudf::slice(with_nulls, {7, 7 + 500}).front();
+
+  auto const view   = cudf::table_view({with_nulls, no_nulls, sliced});
+  auto const counts = cudf::null_counts(view);
+
+  ASSERT_EQ(counts.size(), static_cast<std::size_t>(view.num_columns()));
+  for (cudf::size_type c = 0; c < view.num_columns(); ++c) {
+    EXPECT_EQ(counts[c], view.column(c).null_count());
+  }
+
+  auto const empty_counts = cudf::null_counts(cudf::table_view{});
+  EXPECT_TRUE(empty_counts.empty());
+}
+
+TEST_F(MergeBitmaskTest, TableSegmentedNullCounts)
+{
+  constexpr cudf::size_type num_rows{1000};
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto values   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> const with_nulls(
+    values, values + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> const no_nulls(values, values + num_rows);
+
+  auto const view    = cudf::table_view({with_nulls, no_nulls});
+  auto const indices = std::vector<cudf::size_type>{0, 300, 300, 300, 250, 1000};
+  auto const counts  = cudf::segmented_null_counts(view, indices);
+
+  ASSERT_EQ(counts.size(), static_cast<std::size_t>(view.num_columns() * 3));
+  for (cudf::size_type c = 0; c < view.num_columns(); ++c) {
+    for (std::size_t s = 0; s < 3; ++s) {
+      EXPECT_EQ(counts[c * 3 + s],
+                cudf::detail::null_count(view.column(c).null_mask(),
+                                         indices[2 * s],
+                                         indices[2 * s + 1],
+                                         cudf::get_default_stream()));
+    }
+  }
+
+  EXPECT_THROW(cudf::segmented_null_counts(view, std::vector<cudf::size_type>{0, 300, 250}),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::segmented_null_counts(view, std::vector<cudf::size_type>{0, num_rows + 1}),
+               std::out_of_range);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
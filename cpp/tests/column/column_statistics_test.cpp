@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column_statistics.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+struct ColumnStatisticsTest : public cudf::test::BaseFixture {};
+
+TEST_F(ColumnStatisticsTest, SortedColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({1, 2, 2, 5, 9});
+
+  auto const statistics = cudf::compute_column_statistics(input);
+  EXPECT_TRUE(statistics.is_sorted_ascending);
+  EXPECT_FALSE(statistics.has_nulls);
+  ASSERT_NE(statistics.min, nullptr);
+  ASSERT_NE(statistics.max, nullptr);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>&>(*statistics.min).value(), 1);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>&>(*statistics.max).value(), 9);
+}
+
+TEST_F(ColumnStatisticsTest, UnsortedWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({7, 2, 0, 5, 9}, {1, 1, 0, 1, 1});
+
+  auto const statistics = cudf::compute_column_statistics(input);
+  EXPECT_FALSE(statistics.is_sorted_ascending);
+  EXPECT_TRUE(statistics.has_nulls);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>&>(*statistics.min).value(), 2);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>&>(*statistics.max).value(), 9);
+}
+
+TEST_F(ColumnStatisticsTest, Strings)
+{
+  cudf::test::strings_column_wrapper input({"apple", "banana", "cherry"});
+
+  auto const statistics = cudf::compute_column_statistics(input);
+  EXPECT_TRUE(statistics.is_sorted_ascending);
+  EXPECT_FALSE(statistics.has_nulls);
+  EXPECT_EQ(static_cast<cudf::string_scalar&>(*statistics.min).to_string(), "apple");
+  EXPECT_EQ(static_cast<cudf::string_scalar&>(*statistics.max).to_string(), "cherry");
+}
+
+TEST_F(ColumnStatisticsTest, EmptyColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{};
+
+  auto const statistics = cudf::compute_column_statistics(input);
+  EXPECT_TRUE(statistics.is_sorted_ascending);
+  EXPECT_FALSE(statistics.has_nulls);
+  EXPECT_EQ(statistics.min, nullptr);
+  EXPECT_EQ(statistics.max, nullptr);
+}
@@ -767,3 +767,44 @@ TEST_F(ColumnFactoryTest, FromScalarErrors)
   auto s    = cudf::make_list_scalar(FCW({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
   EXPECT_THROW(cudf::make_column_from_scalar(*s, 214748365), std::overflow_error);
 }
+
+class BulkFactoryTest : public ColumnFactoryTest {};
+
+TEST_F(BulkFactoryTest, FixedWidthTableNoMask)
+{
+  std::vector<cudf::data_type> const types{cudf::data_type{cudf::type_id::INT32},
+                                           cudf::data_type{cudf::type_id::FLOAT64},
+                                           cudf::data_type{cudf::type_id::TIMESTAMP_SECONDS}};
+  auto const table = cudf::make_fixed_width_table(types, size());
+  EXPECT_EQ(table.view().num_columns(), static_cast<cudf::size_type>(types.size()));
+  auto const* const base  = static_cast<std::byte const*>(table.all_data->data());
+  auto const* const limit = base + table.all_data->size();
+  for (cudf::size_type i = 0; i < table.view().num_columns(); ++i) {
+    auto const col = table.view().column(i);
+    EXPECT_EQ(col.type(), types[i]);
+    EXPECT_EQ(col.size(), size());
+    EXPECT_FALSE(col.nullable());
+    EXPECT_GE(static_cast<std::byte const*>(col.head()), base);
+    EXPECT_LT(static_cast<std::byte const*>(col.head()), limit);
+  }
+}
+
+TEST_F(BulkFactoryTest, FixedWidthTableMaskStates)
+{
+  std::vector<cudf::data_type> const types(4, cudf::data_type{cudf::type_id::INT64});
+  auto const valid = cudf::make_fixed_width_table(types, size(), cudf::mask_state::ALL_VALID);
+  auto const null  = cudf::make_fixed_width_table(types, size(), cudf::mask_state::ALL_NULL);
+  for (cudf::size_type i = 0; i < 4; ++i) {
+    EXPECT_EQ(valid.view().column(i).null_count(), 0);
+    EXPECT_EQ(null.view().column(i).null_count(), size());
+  }
+}
+
+TEST_F(BulkFactoryTest, FixedWidthTableErrors)
+{
+  EXPECT_THROW(
+    cudf::make_fixed_width_table({cudf::data_type{cudf::type_id::STRING}}, size()),
+    cudf::data_type_error);
+  EXPECT_THROW(cudf::make_fixed_width_table({cudf::data_type{cudf::type_id::INT32}}, -1),
+               cudf::logic_error);
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/flattened_column_metadata.hpp>
+
+struct FlattenedColumnMetadataTest : public cudf::test::BaseFixture {};
+
+TEST_F(FlattenedColumnMetadataTest, RoundTripFixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4, 5},
+                                                      {true, true, false, true, true});
+  auto const input = cudf::column_view{col};
+
+  cudf::detail::flattened_column_metadata const flat{input};
+  EXPECT_EQ(flat.num_columns(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(flat.to_column_view(), input);
+}
+
+TEST_F(FlattenedColumnMetadataTest, RoundTripNested)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> child1({1, 2, 3});
+  cudf::test::strings_column_wrapper child2({"a", "bb", "ccc"});
+  cudf::test::structs_column_wrapper col({child1, child2});
+  auto const input = cudf::column_view{col};
+
+  cudf::detail::flattened_column_metadata const flat{input};
+  // root + struct children + string offsets child
+  EXPECT_EQ(flat.num_columns(), cudf::count_descendants(input) + 1);
+  EXPECT_EQ(flat.root().num_children, input.num_children());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(flat.to_column_view(), input);
+}
+
+TEST_F(FlattenedColumnMetadataTest, SliceMatchesColumnSlice)
+{
+  cudf::test::lists_column_wrapper<int32_t> col({{1, 2}, {3}, {}, {4, 5, 6}, {7}});
+  auto const input = cudf::column_view{col};
+
+  cudf::detail::flattened_column_metadata const flat{input};
+  auto const sliced   = flat.slice(1, 4);
+  auto const expected = cudf::slice(input, {1, 4}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced.to_column_view(), expected);
+
+  EXPECT_THROW(flat.slice(1, 6), cudf::logic_error);
+  EXPECT_THROW(flat.slice(-1, 2), cudf::logic_error);
+}
+
+TEST_F(FlattenedColumnMetadataTest, SliceRecountsNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4, 5},
+                                                      {false, true, true, true, false});
+  auto const input = cudf::column_view{col};
+
+  cudf::detail::flattened_column_metadata const flat{input};
+  EXPECT_EQ(flat.slice(1, 4).root().null_count, 0);
+  EXPECT_EQ(flat.slice(0, 2).root().null_count, 1);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/table/table.hpp>
+
+#include <vector>
+
+struct BatchedGatherTest : public cudf::test::BaseFixture {};
+
+TEST_F(BatchedGatherTest, ManySmallFixedWidthGathers)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints0{10, 20, 30, 40};
+  cudf::test::fixed_width_column_wrapper<double> doubles0{1., 2., 3., 4.};
+  cudf::test::fixed_width_column_wrapper<int32_t> ints1{5, 6, 7};
+  cudf::test::fixed_width_column_wrapper<double> doubles1{5., 6., 7.};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> map0{3, 0, 2};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> map1{1, 1, 0, 2};
+
+  std::vector<cudf::table_view> tables{cudf::table_view{{ints0, doubles0}},
+                                       cudf::table_view{{ints1, doubles1}}};
+  std::vector<cudf::column_view> maps{map0, map1};
+
+  auto const results = cudf::batched_gather(tables, maps);
+  ASSERT_EQ(results.size(), tables.size());
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    auto const expected = cudf::gather(tables[i], maps[i]);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(results[i]->view(), expected->view());
+  }
+}
+
+TEST_F(BatchedGatherTest, FallbackColumnsInterleaved)
+{
+  // strings and nullable columns take the per-table path; the output column order
+  // must still match the input
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4}, {true, false, true, true}};
+  cudf::test::strings_column_wrapper strings{"a", "bb", "ccc", "dddd"};
+  cudf::test::fixed_width_column_wrapper<int64_t> longs{10, 20, 30, 40};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> map{2, 0, 3};
+
+  std::vector<cudf::table_view> tables{cudf::table_view{{ints, strings, longs}}};
+  std::vector<cudf::column_view> maps{map};
+
+  auto const results  = cudf::batched_gather(tables, maps);
+  auto const expected = cudf::gather(tables.front(), maps.front());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(results.front()->view(), expected->view());
+}
+
+TEST_F(BatchedGatherTest, EmptyMapAndErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> empty_map{};
+
+  auto const results = cudf::batched_gather({cudf::table_view{{ints}}}, {empty_map});
+  EXPECT_EQ(results.front()->num_rows(), 0);
+
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> map{0};
+  EXPECT_THROW(cudf::batched_gather({cudf::table_view{{ints}}}, {}), std::invalid_argument);
+  cudf::test::fixed_width_column_wrapper<int64_t> wide_map{0};
+  EXPECT_THROW(cudf::batched_gather({cudf::table_view{{ints}}}, {wide_map}),
+               std::invalid_argument);
+}
@@ -1725,3 +1725,81 @@ TEST_F(TableOfEmptyColumnsTest, SimpleTest)
     ASSERT_EQ(result->get_column(i).type().id(), cudf::type_id::EMPTY);
   }
 }
+
+struct ConcatenateIntoTest : public cudf::test::BaseFixture {};
+
+TEST_F(ConcatenateIntoTest, PreallocatedColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> first({1, 2, 3}, {true, false, true});
+  cudf::test::fixed_width_column_wrapper<int32_t> second({4, 5});
+  cudf::test::fixed_width_column_wrapper<int32_t> third({6, 7, 8, 9});
+  std::vector<cudf::column_view> columns{first, second, third};
+
+  auto const total_rows = 9;
+  auto const stream     = cudf::get_default_stream();
+  rmm::device_uvector<uint8_t> data(total_rows * sizeof(int32_t), stream);
+  rmm::device_uvector<cudf::bitmask_type> mask(cudf::num_bitmask_words(total_rows), stream);
+
+  auto const result =
+    cudf::concatenate_into(columns, data, mask, stream);
+  auto const expected = cudf::concatenate(columns);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), result);
+
+  // the view must alias the caller's buffer
+  EXPECT_EQ(result.head<uint8_t>(), data.data());
+}
+
+TEST_F(ConcatenateIntoTest, PreallocatedTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints0({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<double> doubles0({1., 2., 3.});
+  cudf::test::fixed_width_column_wrapper<int32_t> ints1({4, 5});
+  cudf::test::fixed_width_column_wrapper<double> doubles1({4., 5.});
+  std::vector<cudf::table_view> tables{cudf::table_view{{ints0, doubles0}},
+                                       cudf::table_view{{ints1, doubles1}}};
+
+  auto const total_rows = 5;
+  auto const stream     = cudf::get_default_stream();
+  rmm::device_uvector<uint8_t> int_data(total_rows * sizeof(int32_t), stream);
+  rmm::device_uvector<uint8_t> double_data(total_rows * sizeof(double), stream);
+  std::vector<cudf::device_span<uint8_t>> data_buffers{int_data, double_data};
+  std::vector<cudf::device_span<cudf::bitmask_type>> mask_buffers{{}, {}};
+
+  auto const result   = cudf::concatenate_into(tables, data_buffers, mask_buffers, stream);
+  auto const expected = cudf::concatenate(tables);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
+}
+
+TEST_F(ConcatenateIntoTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3});
+  std::vector<cudf::column_view> columns{ints};
+  auto const stream = cudf::get_default_stream();
+
+  // data span too small
+  {
+    rmm::device_uvector<uint8_t> data(2 * sizeof(int32_t), stream);
+    EXPECT_THROW(cudf::concatenate_into(columns, data, {}, stream), std::invalid_argument);
+  }
+
+  // non-fixed-width input
+  {
+    cudf::test::strings_column_wrapper strings({"a", "b"});
+    std::vector<cudf::column_view> string_columns{strings};
+    rmm::device_uvector<uint8_t> data(64, stream);
+    EXPECT_THROW(cudf::concatenate_into(string_columns, data, {}, stream),
+                 std::invalid_argument);
+  }
+
+  // mismatched buffer counts for the table variant
+  {
+    rmm::device_uvector<uint8_t> data(3 * sizeof(int32_t), stream);
+    std::vector<cudf::device_span<uint8_t>> data_buffers{data};
+    std::vector<cudf::device_span<cudf::bitmask_type>> mask_buffers{};
+    EXPECT_THROW(cudf::concatenate_into(std::vector<cudf::table_view>{cudf::table_view{{ints}}},
+                                        data_buffers,
+                                        mask_buffers,
+                                        stream),
+                 std::invalid_argument);
+  }
+}
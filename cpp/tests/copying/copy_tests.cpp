@@ -137,6 +137,41 @@ TYPED_TEST(CopyTest, CopyIfElseTestMultipleBlocks)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(out->view(), rhs_w);
 }
 
+TYPED_TEST(CopyTest, CopyIfElseLongRuns)
+{
+  using T = TypeParam;
+
+  // long true/false runs over non-nullable inputs exercise the word-granular fast path,
+  // including a size that is not a multiple of the selector word width
+  constexpr int num_els = 1003;
+  std::vector<bool> h_mask(num_els);
+  std::vector<int32_t> h_lhs(num_els, 5);
+  std::vector<int32_t> h_rhs(num_els, 6);
+  std::vector<int32_t> h_expected(num_els);
+  for (int i = 0; i < num_els; ++i) {
+    h_mask[i]     = (i / 101) % 2 == 0;
+    h_expected[i] = h_mask[i] ? h_lhs[i] : h_rhs[i];
+  }
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> lhs_w(h_lhs.begin(), h_lhs.end());
+  cudf::test::fixed_width_column_wrapper<T, int32_t> rhs_w(h_rhs.begin(), h_rhs.end());
+  cudf::test::fixed_width_column_wrapper<bool> mask_w(h_mask.begin(), h_mask.end());
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected_w(h_expected.begin(),
+                                                                h_expected.end());
+
+  auto out = cudf::copy_if_else(lhs_w, rhs_w, mask_w);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out->view(), expected_w);
+
+  // sliced inputs fall back to the generic path and must produce the same result
+  auto const lhs_sliced  = cudf::slice(lhs_w, {3, 3 + 100}).front();
+  auto const rhs_sliced  = cudf::slice(rhs_w, {3, 3 + 100}).front();
+  auto const mask_sliced = cudf::slice(mask_w, {3, 3 + 100}).front();
+  auto const expected_sliced = cudf::slice(expected_w, {3, 3 + 100}).front();
+
+  auto out_sliced = cudf::copy_if_else(lhs_sliced, rhs_sliced, mask_sliced);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_sliced->view(), expected_sliced);
+}
+
 TYPED_TEST(CopyTest, CopyIfElseTestEmptyInputs)
 {
   using T = TypeParam;
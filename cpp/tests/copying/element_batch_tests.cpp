@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/types.hpp>
+
+#include <stdexcept>
+
+using namespace cudf::test::iterators;
+
+struct ElementBatchTest : public cudf::test::BaseFixture {};
+
+TEST_F(ElementBatchTest, MixedTypes)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({10, 20, 30, 40}, {1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> doubles({0.5, 1.5, 2.5});
+  cudf::test::fixed_width_column_wrapper<bool> bools({true, false, true});
+
+  cudf::element_batch batch;
+  auto const h0 = batch.add(ints, 1);
+  auto const h1 = batch.add(ints, 2);
+  auto const h2 = batch.add(doubles, 0);
+  auto const h3 = batch.add(bools, 2);
+  EXPECT_EQ(batch.size(), std::size_t{4});
+
+  batch.flush(cudf::get_default_stream());
+
+  EXPECT_TRUE(batch.is_valid(h0));
+  EXPECT_EQ(batch.value<int32_t>(h0), 20);
+  EXPECT_FALSE(batch.is_valid(h1));
+  EXPECT_TRUE(batch.is_valid(h2));
+  EXPECT_EQ(batch.value<double>(h2), 0.5);
+  EXPECT_TRUE(batch.is_valid(h3));
+  EXPECT_EQ(batch.value<bool>(h3), true);
+}
+
+TEST_F(ElementBatchTest, SlicedColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col({0, 1, 2, 3, 4, 5}, {1, 1, 1, 0, 1, 1});
+  auto const sliced = cudf::slice(col, {2, 6}).front();
+
+  cudf::element_batch batch;
+  auto const h0 = batch.add(sliced, 0);
+  auto const h1 = batch.add(sliced, 1);
+  auto const h2 = batch.add(sliced, 3);
+  batch.flush(cudf::get_default_stream());
+
+  EXPECT_TRUE(batch.is_valid(h0));
+  EXPECT_EQ(batch.value<int64_t>(h0), 2);
+  EXPECT_FALSE(batch.is_valid(h1));
+  EXPECT_TRUE(batch.is_valid(h2));
+  EXPECT_EQ(batch.value<int64_t>(h2), 5);
+}
+
+TEST_F(ElementBatchTest, FixedPoint)
+{
+  using decimal64 = numeric::decimal64;
+  cudf::test::fixed_point_column_wrapper<int64_t> col({12345, -67890},
+                                                      numeric::scale_type{-2});
+
+  cudf::element_batch batch;
+  auto const h0 = batch.add(col, 0);
+  auto const h1 = batch.add(col, 1);
+  batch.flush(cudf::get_default_stream());
+
+  EXPECT_EQ(batch.value<decimal64>(h0),
+            decimal64{numeric::scaled_integer<int64_t>{12345, numeric::scale_type{-2}}});
+  EXPECT_EQ(batch.value<decimal64>(h1),
+            decimal64{numeric::scaled_integer<int64_t>{-67890, numeric::scale_type{-2}}});
+}
+
+TEST_F(ElementBatchTest, EmptyBatch)
+{
+  cudf::element_batch batch;
+  EXPECT_EQ(batch.size(), std::size_t{0});
+  EXPECT_NO_THROW(batch.flush(cudf::get_default_stream()));
+}
+
+TEST_F(ElementBatchTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3});
+  cudf::test::strings_column_wrapper strings({"a", "b"});
+
+  cudf::element_batch batch;
+  EXPECT_THROW(batch.add(strings, 0), cudf::logic_error);
+  EXPECT_THROW(batch.add(ints, 3), std::out_of_range);
+  EXPECT_THROW(batch.add(ints, -1), std::out_of_range);
+
+  auto const h0 = batch.add(ints, 1);
+  EXPECT_THROW(batch.value<int32_t>(h0), cudf::logic_error);  // not flushed yet
+  batch.flush(cudf::get_default_stream());
+
+  EXPECT_THROW(batch.add(ints, 0), cudf::logic_error);
+  EXPECT_THROW(batch.flush(cudf::get_default_stream()), cudf::logic_error);
+  EXPECT_THROW(batch.value<int32_t>(h0 + 1), std::out_of_range);
+  EXPECT_THROW(batch.value<int64_t>(h0), cudf::data_type_error);
+  EXPECT_EQ(batch.value<int32_t>(h0), 2);
+}
@@ -26,6 +26,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {};
@@ -51,6 +52,27 @@ TYPED_TEST(GatherTest, IdentityTest)
   CUDF_TEST_EXPECT_TABLES_EQUAL(source_table, result->view());
 }
 
+TYPED_TEST(GatherTest, AsyncIdentityTest)
+{
+  constexpr cudf::size_type source_size{1000};
+
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<TypeParam> source_column(data, data + source_size);
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(data, data + source_size);
+
+  cudf::table_view source_table({source_column});
+
+  // host-side wait makes the result safe to consume anywhere
+  auto future                         = cudf::gather_async(source_table, gather_map);
+  std::unique_ptr<cudf::table> result = std::move(future).get();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(source_table, result->view());
+
+  // stream-ordered consumption without blocking the host
+  auto stream_result =
+    std::move(cudf::gather_async(source_table, gather_map)).get(cudf::get_default_stream());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(source_table, stream_result->view());
+}
+
 TYPED_TEST(GatherTest, ReverseIdentityTest)
 {
   constexpr cudf::size_type source_size{1000};
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/multi_device.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+
+#include <rmm/cuda_device.hpp>
+
+#include <cuda_runtime.h>
+
+struct MultiDeviceTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+rmm::cuda_device_id current_device()
+{
+  int device_id{};
+  EXPECT_EQ(cudaGetDevice(&device_id), cudaSuccess);
+  return rmm::cuda_device_id{device_id};
+}
+
+}  // namespace
+
+TEST_F(MultiDeviceTest, ScatterGatherRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3, 4, 5, 6, 7, 8});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({8, 7, 6, 5, 4, 3, 2, 1},
+                                                       {true, true, false, true, true, false, true, true});
+  auto const input = cudf::table_view{{col1, col2}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> partition_map({0, 1, 0, 1, 0, 1, 0, 1});
+  auto const devices = std::vector<rmm::cuda_device_id>(2, current_device());
+
+  auto scattered = cudf::experimental::scatter_to_devices(input, partition_map, devices);
+  ASSERT_EQ(scattered.size(), devices.size());
+
+  auto const result = cudf::experimental::gather_from_devices(scattered);
+
+  // the gathered table holds the partitions in order, i.e. the partitioned row order
+  auto const [expected, offsets] = cudf::partition(input, partition_map, devices.size());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(MultiDeviceTest, EmptyPartition)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4});
+  auto const input = cudf::table_view{{col}};
+
+  // partition 1 receives no rows
+  cudf::test::fixed_width_column_wrapper<int32_t> partition_map({0, 0, 0, 0});
+  auto const devices = std::vector<rmm::cuda_device_id>(2, current_device());
+
+  auto scattered = cudf::experimental::scatter_to_devices(input, partition_map, devices);
+  ASSERT_EQ(scattered.size(), devices.size());
+
+  auto const result = cudf::experimental::gather_from_devices(scattered);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result->view());
+}
+
+TEST_F(MultiDeviceTest, PeerRoundTrip)
+{
+  int num_devices{};
+  ASSERT_EQ(cudaGetDeviceCount(&num_devices), cudaSuccess);
+  if (num_devices < 2) { GTEST_SKIP() << "test requires multiple GPUs"; }
+
+  cudf::test::fixed_width_column_wrapper<int64_t> col({10, 20, 30, 40, 50, 60});
+  auto const input = cudf::table_view{{col}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> partition_map({0, 1, 0, 1, 0, 1});
+  auto const devices =
+    std::vector<rmm::cuda_device_id>{current_device(), rmm::cuda_device_id{1}};
+
+  auto scattered    = cudf::experimental::scatter_to_devices(input, partition_map, devices);
+  auto const stream = cudf::get_default_stream();
+  stream.synchronize();
+
+  auto const result = cudf::experimental::gather_from_devices(scattered);
+
+  auto const [expected, offsets] = cudf::partition(input, partition_map, devices.size());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
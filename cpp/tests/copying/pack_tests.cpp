@@ -555,6 +555,47 @@ TEST_F(PackUnpackTest, EmptyTable)
   }
 }
 
+TEST_F(PackUnpackTest, PackDescriptorsContiguous)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> col1(
+    {1, 2, 3, 4, 5, 6, 7}, {true, true, true, false, true, false, true});
+  cudf::test::strings_column_wrapper col2({"Vimes", "Carrot", "Angua", "", "Detritus", "x", "y"});
+  cudf::table_view t({col1, col2});
+
+  // a previously packed table is recognized as contiguous and needs no copying
+  auto packed         = cudf::pack(t);
+  auto unpacked       = cudf::unpack(packed);
+  auto const descriptors = cudf::pack_descriptors(unpacked);
+  EXPECT_TRUE(descriptors.contiguous);
+  EXPECT_FALSE(descriptors.buffers.empty());
+  EXPECT_EQ(descriptors.contiguous_region.data(),
+            reinterpret_cast<uint8_t const*>(packed.gpu_data->data()));
+
+  // the emitted metadata plus the region deserialize without any copy
+  auto zero_copy_view =
+    cudf::unpack(descriptors.metadata->data(), descriptors.contiguous_region.data());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, zero_copy_view);
+
+  // repacking the already-contiguous table must also round-trip
+  auto repacked = cudf::pack(unpacked);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, cudf::unpack(repacked));
+}
+
+TEST_F(PackUnpackTest, PackDescriptorsBufferCount)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3}, {true, false, true});
+  cudf::test::strings_column_wrapper col2({"a", "bb", "ccc"});
+  cudf::table_view t({col1, col2});
+
+  // int data + int null mask + string offsets + string chars
+  auto const descriptors = cudf::pack_descriptors(t);
+  EXPECT_EQ(descriptors.buffers.size(), 4);
+
+  // sliced tables cannot be described
+  auto const sliced = cudf::split(t, {1});
+  EXPECT_THROW(cudf::pack_descriptors(sliced[1]), cudf::logic_error);
+}
+
 TEST_F(PackUnpackTest, SlicedEmpty)
 {
   // empty sliced column. this is specifically testing the corner case:
@@ -578,3 +619,40 @@ TEST_F(PackUnpackTest, SlicedEmpty)
   auto unpacked = cudf::unpack(packed);
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(t, unpacked);
 }
+
+struct SpillableTableTest : public cudf::test::BaseFixture {};
+
+TEST_F(SpillableTableTest, SpillAndRestore)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1(
+    {1, 2, 3, 4, 5, 6, 7}, {true, true, true, false, true, false, true});
+  cudf::test::strings_column_wrapper col2({"Lorem", "ipsum", "dolor", "sit", "amet", "ort", "ral"},
+                                          {true, false, true, true, true, false, true});
+  cudf::table_view t({col1, col2});
+
+  auto spillable = cudf::spillable_table(t);
+  EXPECT_FALSE(spillable.is_spilled());
+  EXPECT_GT(spillable.size_bytes(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, spillable.view());
+
+  spillable.spill();
+  EXPECT_TRUE(spillable.is_spilled());
+  spillable.spill();  // idempotent
+  EXPECT_TRUE(spillable.is_spilled());
+
+  // view() transparently restores the table
+  CUDF_TEST_EXPECT_TABLES_EQUAL(t, spillable.view());
+  EXPECT_FALSE(spillable.is_spilled());
+
+  // explicit restore as a prefetch hint is a no-op while resident
+  spillable.restore();
+  EXPECT_FALSE(spillable.is_spilled());
+}
+
+TEST_F(SpillableTableTest, EmptyTable)
+{
+  auto spillable = cudf::spillable_table(cudf::table_view{});
+  spillable.spill();
+  auto const result = spillable.view();
+  EXPECT_EQ(result.num_columns(), 0);
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/ring_buffer_column.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <stdexcept>
+
+struct RingBufferTest : public cudf::test::BaseFixture {};
+
+TEST_F(RingBufferTest, AppendAndWrap)
+{
+  auto initial = cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, 2, 3, 4, 5, 6, 7});
+  auto ring    = cudf::ring_buffer_column(std::make_unique<cudf::column>(initial));
+  EXPECT_EQ(ring.capacity(), 8);
+  EXPECT_FALSE(ring.is_wrapped());
+
+  auto batch1 = cudf::test::fixed_width_column_wrapper<int32_t>({8, 9, 10});
+  ring.append(batch1);
+  EXPECT_TRUE(ring.is_wrapped());
+  EXPECT_EQ(ring.segments().size(), std::size_t{2});
+
+  auto expected1 = cudf::test::fixed_width_column_wrapper<int32_t>({3, 4, 5, 6, 7, 8, 9, 10});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected1, ring.to_column()->view());
+
+  // A second append crosses the physical end of the buffer and splits into two writes
+  auto batch2 = cudf::test::fixed_width_column_wrapper<int32_t>({11, 12, 13, 14, 15, 16, 17});
+  ring.append(batch2);
+  auto expected2 = cudf::test::fixed_width_column_wrapper<int32_t>({10, 11, 12, 13, 14, 15, 16, 17});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected2, ring.to_column()->view());
+}
+
+TEST_F(RingBufferTest, FullCapacityAppend)
+{
+  auto initial = cudf::test::fixed_width_column_wrapper<double>({1.0, 2.0, 3.0, 4.0});
+  auto ring    = cudf::ring_buffer_column(std::make_unique<cudf::column>(initial));
+
+  auto batch = cudf::test::fixed_width_column_wrapper<double>({5.0, 6.0, 7.0, 8.0});
+  ring.append(batch);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(batch, ring.to_column()->view());
+}
+
+TEST_F(RingBufferTest, Errors)
+{
+  auto strings = cudf::test::strings_column_wrapper({"a", "b"});
+  EXPECT_THROW(cudf::ring_buffer_column(std::make_unique<cudf::column>(strings)),
+               cudf::data_type_error);
+
+  auto nullable = cudf::test::fixed_width_column_wrapper<int32_t>(
+    {1, 2, 3}, cudf::test::iterators::null_at(1));
+  EXPECT_THROW(cudf::ring_buffer_column(std::make_unique<cudf::column>(nullable)),
+               std::invalid_argument);
+
+  auto initial = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3});
+  auto ring    = cudf::ring_buffer_column(std::make_unique<cudf::column>(initial));
+
+  auto mismatched = cudf::test::fixed_width_column_wrapper<int64_t>({4});
+  EXPECT_THROW(ring.append(mismatched), cudf::data_type_error);
+
+  auto oversized = cudf::test::fixed_width_column_wrapper<int32_t>({4, 5, 6, 7});
+  EXPECT_THROW(ring.append(oversized), std::invalid_argument);
+}
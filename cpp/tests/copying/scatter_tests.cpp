@@ -20,6 +20,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 
@@ -852,3 +853,75 @@ TYPED_TEST(FixedPointTestAllReps, FixedPointScatter)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_table, result->view());
 }
+
+class ScatterInPlaceTests : public cudf::test::BaseFixture {};
+
+TEST_F(ScatterInPlaceTests, FixedWidthColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<double> source_second({1., 2., 3.});
+  cudf::test::fixed_width_column_wrapper<int32_t> target({10, 20, 30, 40, 50});
+  cudf::test::fixed_width_column_wrapper<double> target_second({10., 20., 30., 40., 50.});
+  cudf::test::fixed_width_column_wrapper<int32_t> scatter_map({4, 0, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({2, 20, 3, 40, 1});
+  cudf::test::fixed_width_column_wrapper<double> expected_second({2., 20., 3., 40., 1.});
+
+  auto first  = cudf::column(target);
+  auto second = cudf::column(target_second);
+  std::vector<cudf::mutable_column_view> columns{first.mutable_view(), second.mutable_view()};
+  auto target_table = cudf::mutable_table_view(columns);
+
+  cudf::scatter_in_place(cudf::table_view({source, source_second}), scatter_map, target_table);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected, expected_second}),
+                                cudf::table_view({first.view(), second.view()}));
+}
+
+TEST_F(ScatterInPlaceTests, SourceWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source({1, 2, 3}, {true, false, true});
+  cudf::test::fixed_width_column_wrapper<int32_t> target({10, 20, 30, 40, 50},
+                                                         {false, true, true, true, true});
+  cudf::test::fixed_width_column_wrapper<int32_t> scatter_map({4, 0, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({2, 20, 3, 40, 1},
+                                                           {false, true, true, true, true});
+
+  auto column = cudf::column(target);
+  std::vector<cudf::mutable_column_view> columns{column.mutable_view()};
+  auto target_table = cudf::mutable_table_view(columns);
+
+  cudf::scatter_in_place(cudf::table_view({source}), scatter_map, target_table);
+
+  // the in-place API does not maintain null counts
+  column.set_null_count(cudf::null_count(column.view().null_mask(), 0, column.size()));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, column.view());
+}
+
+TEST_F(ScatterInPlaceTests, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> source({1, 2}, {true, false});
+  cudf::test::strings_column_wrapper string_source({"a", "b"});
+  cudf::test::fixed_width_column_wrapper<int32_t> scatter_map({0, 1});
+
+  // non-fixed-width target
+  {
+    cudf::test::strings_column_wrapper string_target({"x", "y", "z"});
+    auto column = cudf::column(string_target);
+    std::vector<cudf::mutable_column_view> columns{column.mutable_view()};
+    auto target_table = cudf::mutable_table_view(columns);
+    EXPECT_THROW(
+      cudf::scatter_in_place(cudf::table_view({string_source}), scatter_map, target_table),
+      std::invalid_argument);
+  }
+
+  // nullable source into a non-nullable target
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> target({10, 20, 30});
+    auto column = cudf::column(target);
+    std::vector<cudf::mutable_column_view> columns{column.mutable_view()};
+    auto target_table = cudf::mutable_table_view(columns);
+    EXPECT_THROW(cudf::scatter_in_place(cudf::table_view({source}), scatter_map, target_table),
+                 std::invalid_argument);
+  }
+}
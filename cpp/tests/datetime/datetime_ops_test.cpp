@@ -25,9 +25,13 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
+#include <stdexcept>
+#include <vector>
+
 #define XXX false  // stub for null values
 
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
@@ -245,6 +249,52 @@ TEST_F(BasicDatetimeOpsTest, TestExtractingDatetimeComponents)
     fixed_width_column_wrapper<int16_t>{766, 424, 623});
 }
 
+TEST_F(BasicDatetimeOpsTest, TestExtractingMultipleDatetimeComponents)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto timestamps_ms =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{
+      {
+        -131968727238,  // 1965-10-26 14:01:12.762 GMT
+        1530705600000,  // 2018-07-04 12:00:00.000 GMT
+        1674631932929   // 2023-01-25 07:32:12.929 GMT
+      },
+      {true, false, true}};
+
+  auto const components = std::vector<datetime_component>{datetime_component::YEAR,
+                                                          datetime_component::MONTH,
+                                                          datetime_component::DAY,
+                                                          datetime_component::WEEKDAY,
+                                                          datetime_component::HOUR,
+                                                          datetime_component::MINUTE,
+                                                          datetime_component::SECOND,
+                                                          datetime_component::MILLISECOND,
+                                                          datetime_component::MICROSECOND,
+                                                          datetime_component::NANOSECOND};
+
+  auto const results = extract_datetime_components(timestamps_ms, components);
+  EXPECT_EQ(results->num_columns(), static_cast<cudf::size_type>(components.size()));
+  for (std::size_t i = 0; i < components.size(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_datetime_component(timestamps_ms, components[i]),
+                                   results->get_column(i));
+  }
+
+  auto const empty = cudf::test::fixed_width_column_wrapper<cudf::timestamp_s>{};
+  auto const empty_results =
+    extract_datetime_components(empty, std::vector<datetime_component>{datetime_component::YEAR});
+  EXPECT_EQ(empty_results->num_rows(), 0);
+
+  auto not_timestamps = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  EXPECT_THROW(
+    extract_datetime_components(not_timestamps,
+                                std::vector<datetime_component>{datetime_component::YEAR}),
+    cudf::logic_error);
+  EXPECT_THROW(extract_datetime_components(timestamps_ms, std::vector<datetime_component>{}),
+               std::invalid_argument);
+}
+
 template <typename T>
 struct TypedDatetimeOpsTest : public cudf::test::BaseFixture {
   cudf::size_type size() { return cudf::size_type(10); }
@@ -76,6 +76,52 @@ TEST_F(DictionaryAddKeysTest, WithNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), input);  // new keys should not change anything
 }
 
+TEST_F(DictionaryAddKeysTest, AppendLargerKeys)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> input{20, 10, 30, 10, 20};
+  auto dictionary = cudf::dictionary::encode(input);
+
+  // all new keys sort after the existing keys so the indices are not remapped
+  cudf::test::fixed_width_column_wrapper<int64_t> new_keys{50, 40, 50};
+  auto result =
+    cudf::dictionary::add_keys(cudf::dictionary_column_view(dictionary->view()), new_keys);
+  cudf::dictionary_column_view view(result->view());
+
+  cudf::test::fixed_width_column_wrapper<int64_t> keys_expected{10, 20, 30, 40, 50};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected{1, 0, 2, 0, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+
+  auto decoded = cudf::dictionary::decode(view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), input);
+
+  // keys already present leave the dictionary unchanged
+  cudf::test::fixed_width_column_wrapper<int64_t> known_keys{10, 30};
+  auto same =
+    cudf::dictionary::add_keys(cudf::dictionary_column_view(dictionary->view()), known_keys);
+  cudf::dictionary_column_view same_view(same->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(same_view.keys(),
+                                 cudf::dictionary_column_view(dictionary->view()).keys());
+  auto same_decoded = cudf::dictionary::decode(same_view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(same_decoded->view(), input);
+}
+
+TEST_F(DictionaryAddKeysTest, AppendLargerKeysStrings)
+{
+  cudf::test::strings_column_wrapper strings({"ccc", "aaa", "bbb", "aaa", "ccc"});
+  cudf::test::strings_column_wrapper new_keys({"eee", "ddd"});
+
+  auto dictionary = cudf::dictionary::encode(strings);
+  auto result =
+    cudf::dictionary::add_keys(cudf::dictionary_column_view(dictionary->view()), new_keys);
+  cudf::dictionary_column_view view(result->view());
+
+  cudf::test::strings_column_wrapper keys_expected({"aaa", "bbb", "ccc", "ddd", "eee"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected{2, 0, 1, 0, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+}
+
 TEST_F(DictionaryAddKeysTest, Errors)
 {
   cudf::test::fixed_width_column_wrapper<int64_t> input{1, 2, 3};
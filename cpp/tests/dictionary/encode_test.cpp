@@ -68,6 +68,52 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), expected);
 }
 
+TEST_F(DictionaryEncodeTest, EncodeAgainstExistingKeys)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> existing_keys{111, 429};
+
+  cudf::test::fixed_width_column_wrapper<int64_t> batch{429, 111, 213, 111, 500};
+  auto dictionary = cudf::dictionary::encode(batch, existing_keys);
+  cudf::dictionary_column_view view(dictionary->view());
+
+  cudf::test::fixed_width_column_wrapper<int64_t> keys_expected{111, 213, 429, 500};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected{2, 0, 1, 0, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+
+  // a batch with no novel values keeps the keys unchanged
+  cudf::test::fixed_width_column_wrapper<int64_t> batch2{{111, 429, 429, 111},
+                                                         {true, true, false, true}};
+  auto dictionary2 = cudf::dictionary::encode(batch2, existing_keys);
+  cudf::dictionary_column_view view2(dictionary2->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view2.keys(), existing_keys);
+  EXPECT_EQ(view2.null_count(), 1);
+}
+
+TEST_F(DictionaryEncodeTest, EncodeAgainstExistingKeysStrings)
+{
+  cudf::test::strings_column_wrapper existing_keys({"aaa", "ccc"});
+  cudf::test::strings_column_wrapper batch({"bbb", "ccc", "aaa"});
+
+  auto dictionary = cudf::dictionary::encode(batch, existing_keys);
+  cudf::dictionary_column_view view(dictionary->view());
+
+  cudf::test::strings_column_wrapper keys_expected({"aaa", "bbb", "ccc"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+  cudf::test::fixed_width_column_wrapper<int32_t> indices_expected{1, 2, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+}
+
+TEST_F(DictionaryEncodeTest, InvalidEncodeAgainstExistingKeys)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> batch{429, 111, 213};
+  cudf::test::fixed_width_column_wrapper<int32_t> wrong_type_keys{1, 2};
+  EXPECT_THROW(cudf::dictionary::encode(batch, wrong_type_keys), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> null_keys{{111, 429}, {true, false}};
+  EXPECT_THROW(cudf::dictionary::encode(batch, null_keys), cudf::logic_error);
+}
+
 TEST_F(DictionaryEncodeTest, InvalidEncode)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> input{0, 1, 2, 3, -1, -2, -3};
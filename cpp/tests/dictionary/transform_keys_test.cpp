@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/dictionary/update_keys.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <stdexcept>
+
+struct DictionaryTransformKeysTest : public cudf::test::BaseFixture {};
+
+TEST_F(DictionaryTransformKeysTest, StringsColumn)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"eee", "aaa", "ddd", "bbb", "ccc", "ccc", "ccc", "eee", "aaa"});
+
+  auto dictionary = cudf::dictionary::encode(strings);
+  auto result     = cudf::dictionary::transform_keys(
+    cudf::dictionary_column_view(dictionary->view()), [](cudf::column_view const& keys) {
+      return cudf::strings::to_upper(cudf::strings_column_view(keys));
+    });
+
+  cudf::dictionary_column_view view(result->view());
+
+  cudf::test::strings_column_wrapper keys_expected({"AAA", "BBB", "CCC", "DDD", "EEE"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), keys_expected);
+
+  cudf::test::fixed_width_column_wrapper<int8_t> indices_expected({4, 0, 3, 1, 2, 2, 2, 4, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), indices_expected);
+}
+
+TEST_F(DictionaryTransformKeysTest, CollapsingKeys)
+{
+  cudf::test::strings_column_wrapper strings({"aaa", "AAA", "bbb", "aaa", "BBB", "bbb"},
+                                             {true, true, true, false, true, true});
+
+  auto dictionary = cudf::dictionary::encode(strings);
+  auto result     = cudf::dictionary::transform_keys(
+    cudf::dictionary_column_view(dictionary->view()), [](cudf::column_view const& keys) {
+      return cudf::strings::to_upper(cudf::strings_column_view(keys));
+    });
+  auto decoded = cudf::dictionary::decode(result->view());
+
+  // upper-casing collapses {aaa,AAA} and {bbb,BBB}; null rows are preserved
+  cudf::test::strings_column_wrapper expected({"AAA", "AAA", "BBB", "", "BBB", "BBB"},
+                                              {true, true, true, false, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, expected);
+  EXPECT_EQ(cudf::dictionary_column_view(result->view()).keys_size(), 2);
+}
+
+TEST_F(DictionaryTransformKeysTest, Errors)
+{
+  cudf::test::strings_column_wrapper strings({"aaa", "bbb", "aaa"});
+  auto dictionary = cudf::dictionary::encode(strings);
+  auto view       = cudf::dictionary_column_view(dictionary->view());
+
+  // result must have one row per key
+  EXPECT_THROW(
+    cudf::dictionary::transform_keys(view,
+                                     [](cudf::column_view const&) {
+                                       cudf::test::strings_column_wrapper wrong({"x"});
+                                       return std::make_unique<cudf::column>(wrong);
+                                     }),
+    std::invalid_argument);
+
+  // result must not contain nulls
+  EXPECT_THROW(
+    cudf::dictionary::transform_keys(view,
+                                     [](cudf::column_view const&) {
+                                       cudf::test::strings_column_wrapper nulled(
+                                         {"x", "y"}, {true, false});
+                                       return std::make_unique<cudf::column>(nulled);
+                                     }),
+    std::invalid_argument);
+}
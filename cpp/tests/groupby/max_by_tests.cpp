@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+using int32s_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+using structs_col = cudf::test::structs_column_wrapper;
+
+namespace {
+// Runs a single row-gathering aggregation and returns (keys, result) sorted by key
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> groupby_select_by(
+  cudf::column_view const& keys,
+  cudf::column_view const& values,
+  std::unique_ptr<cudf::groupby_aggregation> agg)
+{
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = values;
+  requests[0].aggregations.push_back(std::move(agg));
+
+  auto gb_obj            = cudf::groupby::groupby(cudf::table_view({keys}));
+  auto const agg_results = gb_obj.aggregate(requests);
+
+  auto const key_sort_order = cudf::sorted_order(agg_results.first->view(), {}, {});
+  auto sorted_keys =
+    std::move(cudf::gather(agg_results.first->view(), *key_sort_order)->release().front());
+  auto sorted_result =
+    std::move(cudf::gather(cudf::table_view{{agg_results.second[0].results[0]->view()}},
+                           *key_sort_order)
+                ->release()
+                .front());
+  return {std::move(sorted_keys), std::move(sorted_result)};
+}
+}  // namespace
+
+struct GroupbyMaxByTest : public cudf::test::BaseFixture {};
+
+TEST_F(GroupbyMaxByTest, MaxByMultiplePayloads)
+{
+  auto const keys      = int32s_col{1, 2, 1, 2, 1};
+  auto const order_by  = int32s_col{10, 20, 30, 5, 20};
+  auto const payload_1 = int32s_col{100, 200, 300, 400, 500};
+  auto const payload_2 = strings_col{"a", "b", "c", "d", "e"};
+  auto const values    = structs_col{{order_by, payload_1, payload_2}};
+
+  auto const [sorted_keys, result] = groupby_select_by(
+    keys, values, cudf::make_max_by_aggregation<cudf::groupby_aggregation>());
+
+  auto const expected_keys      = int32s_col{1, 2};
+  auto const expected_payload_1 = int32s_col{300, 200};
+  auto const expected_payload_2 = strings_col{"c", "b"};
+  auto const expected           = structs_col{{expected_payload_1, expected_payload_2}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_keys->view(), expected_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+TEST_F(GroupbyMaxByTest, MinBy)
+{
+  auto const keys     = int32s_col{1, 2, 1, 2, 1};
+  auto const order_by = int32s_col{10, 20, 30, 5, 20};
+  auto const payload  = int32s_col{100, 200, 300, 400, 500};
+  auto const values   = structs_col{{order_by, payload}};
+
+  auto const [sorted_keys, result] = groupby_select_by(
+    keys, values, cudf::make_min_by_aggregation<cudf::groupby_aggregation>());
+
+  auto const expected_payload = int32s_col{100, 400};
+  auto const expected         = structs_col{{expected_payload}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+TEST_F(GroupbyMaxByTest, MaxByNullOrderValues)
+{
+  auto const keys     = int32s_col{1, 1, 2};
+  auto const order_by = int32s_col{{0, 5, 0}, {0, 1, 0}};
+  auto const payload  = int32s_col{7, 8, 9};
+  auto const values   = structs_col{{order_by, payload}};
+
+  auto const [sorted_keys, result] = groupby_select_by(
+    keys, values, cudf::make_max_by_aggregation<cudf::groupby_aggregation>());
+
+  // Null ordering values are ignored; group 2 has no non-null ordering value
+  auto const expected_payload = int32s_col{{8, 0}, {1, 0}};
+  auto const expected         = structs_col{{expected_payload}, {1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+TEST_F(GroupbyMaxByTest, TopKBy)
+{
+  auto const keys     = int32s_col{1, 1, 1, 2, 2};
+  auto const order_by = int32s_col{10, 30, 20, 5, 20};
+  auto const payload  = int32s_col{100, 300, 200, 400, 500};
+  auto const values   = structs_col{{order_by, payload}};
+
+  auto const [sorted_keys, result] = groupby_select_by(
+    keys, values, cudf::make_top_k_by_aggregation<cudf::groupby_aggregation>(2));
+
+  // Group 1 keeps {300, 200}, group 2 keeps {500, 400}, best first
+  auto const lists = cudf::lists_column_view{result->view()};
+  auto const expected_offsets = int32s_col{0, 2, 4};
+  auto const expected_payload = int32s_col{300, 200, 500, 400};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), expected_offsets);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child().child(0), expected_payload);
+}
+
+TEST_F(GroupbyMaxByTest, TopKByAscendingSmallGroups)
+{
+  auto const keys     = int32s_col{1, 1, 1, 2};
+  auto const order_by = int32s_col{10, 30, 20, 5};
+  auto const payload  = int32s_col{100, 300, 200, 400};
+  auto const values   = structs_col{{order_by, payload}};
+
+  auto const [sorted_keys, result] = groupby_select_by(
+    keys,
+    values,
+    cudf::make_top_k_by_aggregation<cudf::groupby_aggregation>(2, cudf::order::ASCENDING));
+
+  // Group 2 is smaller than k and keeps its single row
+  auto const lists = cudf::lists_column_view{result->view()};
+  auto const expected_offsets = int32s_col{0, 2, 3};
+  auto const expected_payload = int32s_col{100, 200, 400};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), expected_offsets);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.child().child(0), expected_payload);
+}
+
+TEST_F(GroupbyMaxByTest, InvalidInputs)
+{
+  auto const keys   = int32s_col{1, 2};
+  auto const values = int32s_col{10, 20};
+
+  // Values must be a structs column
+  EXPECT_THROW(groupby_select_by(
+                 keys, values, cudf::make_max_by_aggregation<cudf::groupby_aggregation>()),
+               cudf::logic_error);
+  // k must be positive
+  auto const order_by       = int32s_col{10, 20};
+  auto const payload        = int32s_col{1, 2};
+  auto const struct_values  = structs_col{{order_by, payload}};
+  EXPECT_THROW(groupby_select_by(
+                 keys, struct_values, cudf::make_top_k_by_aggregation<cudf::groupby_aggregation>(0)),
+               cudf::logic_error);
+}
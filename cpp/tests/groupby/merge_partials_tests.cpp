@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <vector>
+
+struct groupby_merge_partials_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_merge_partials_test, SumAndCountPartials)
+{
+  // Concatenated partial results of two workers: keys {1, 2} and {2, 3}
+  cudf::test::fixed_width_column_wrapper<int32_t> partial_keys{1, 2, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> partial_sums{10, 20, 5, 30};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> partial_counts{2, 3, 1, 4};
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  auto& sum_request  = requests.emplace_back();
+  sum_request.values = cudf::column_view{partial_sums};
+  sum_request.aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  auto& count_request  = requests.emplace_back();
+  count_request.values = cudf::column_view{partial_counts};
+  count_request.aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+
+  cudf::groupby::groupby gb{cudf::table_view{{partial_keys}}};
+  auto const [unique_keys, results] = gb.merge(requests);
+
+  auto const order       = cudf::sorted_order(unique_keys->view());
+  auto const sorted_keys = cudf::gather(unique_keys->view(), order->view());
+  auto const sorted_sums =
+    cudf::gather(cudf::table_view{{results[0].results[0]->view()}}, order->view());
+  auto const sorted_counts =
+    cudf::gather(cudf::table_view{{results[1].results[0]->view()}}, order->view());
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_sums{10, 25, 30};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_counts{2, 4, 4};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sorted_keys->view(), cudf::table_view{{expect_keys}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_sums->view().column(0), expect_sums);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_counts->view().column(0), expect_counts);
+}
+
+TEST_F(groupby_merge_partials_test, MultipleAggregationsPerRequestThrow)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> partial_keys{1, 2};
+  cudf::test::fixed_width_column_wrapper<int64_t> partial_sums{10, 20};
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  auto& request  = requests.emplace_back();
+  request.values = cudf::column_view{partial_sums};
+  request.aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  request.aggregations.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+
+  cudf::groupby::groupby gb{cudf::table_view{{partial_keys}}};
+  EXPECT_THROW(gb.merge(requests), cudf::logic_error);
+}
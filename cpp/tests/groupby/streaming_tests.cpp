@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/groupby.hpp>
+#include <cudf/table/table.hpp>
+
+#include <vector>
+
+struct groupby_streaming_test : public cudf::test::BaseFixture {};
+
+namespace {
+
+std::vector<cudf::groupby::aggregation_request> make_sum_count_requests(
+  cudf::column_view const& values)
+{
+  std::vector<cudf::groupby::aggregation_request> requests;
+  auto& request  = requests.emplace_back();
+  request.values = values;
+  request.aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  request.aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  return requests;
+}
+
+}  // namespace
+
+TEST_F(groupby_streaming_test, BoundaryGroupSpansChunks)
+{
+  // Group 2 spans the chunk boundary and group 3 spans all of chunk two
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0{1, 1, 2, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals0{10, 20, 30, 40};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{2, 3, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals1{50, 60, 70};
+
+  cudf::groupby::streaming_groupby sgb{};
+
+  auto const [out_keys0, out_results0] =
+    sgb.aggregate_chunk(cudf::table_view{{keys0}}, make_sum_count_requests(vals0));
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys0{1};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_sums0{30};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_counts0{2};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out_keys0->view(), cudf::table_view{{expect_keys0}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_results0[0].results[0]->view(), expect_sums0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_results0[0].results[1]->view(), expect_counts0);
+
+  auto const [out_keys1, out_results1] =
+    sgb.aggregate_chunk(cudf::table_view{{keys1}}, make_sum_count_requests(vals1));
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys1{2};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_sums1{120};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_counts1{3};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out_keys1->view(), cudf::table_view{{expect_keys1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_results1[0].results[0]->view(), expect_sums1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_results1[0].results[1]->view(), expect_counts1);
+
+  auto const [final_keys, final_results] = sgb.flush();
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_final_keys{3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_final_sums{130};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_final_counts{2};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(final_keys->view(), cudf::table_view{{expect_final_keys}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(final_results[0].results[0]->view(), expect_final_sums);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(final_results[0].results[1]->view(), expect_final_counts);
+}
+
+TEST_F(groupby_streaming_test, DistinctBoundaryGroups)
+{
+  // No group spans the boundary; the carried group is emitted ahead of chunk two's groups
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0{1, 1, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals0{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{3, 4, 4};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals1{4, 5, 6};
+
+  cudf::groupby::streaming_groupby sgb{};
+
+  auto const [out_keys0, out_results0] =
+    sgb.aggregate_chunk(cudf::table_view{{keys0}}, make_sum_count_requests(vals0));
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys0{1};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out_keys0->view(), cudf::table_view{{expect_keys0}});
+
+  auto const [out_keys1, out_results1] =
+    sgb.aggregate_chunk(cudf::table_view{{keys1}}, make_sum_count_requests(vals1));
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys1{2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_sums1{3, 4};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_counts1{1, 1};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out_keys1->view(), cudf::table_view{{expect_keys1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_results1[0].results[0]->view(), expect_sums1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(out_results1[0].results[1]->view(), expect_counts1);
+
+  auto const [final_keys, final_results] = sgb.flush();
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_final_keys{4};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_final_sums{11};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(final_keys->view(), cudf::table_view{{expect_final_keys}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(final_results[0].results[0]->view(), expect_final_sums);
+}
+
+TEST_F(groupby_streaming_test, UnmergeableAggregationThrows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 1, 2};
+  cudf::test::fixed_width_column_wrapper<double> vals{1., 2., 3.};
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  auto& request  = requests.emplace_back();
+  request.values = cudf::column_view{vals};
+  request.aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+
+  cudf::groupby::streaming_groupby sgb{};
+  EXPECT_THROW(sgb.aggregate_chunk(cudf::table_view{{keys}}, requests), cudf::logic_error);
+}
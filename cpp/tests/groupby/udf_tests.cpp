@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/utilities/error.hpp>
+
+struct GroupbyUdfTest : public cudf::test::BaseFixture {
+  const std::string cuda_func{
+    R"***(
+      template <typename OutType, typename InType>
+      __device__ void CUDA_GENERIC_AGGREGATOR(OutType *ret, InType *in_col, cudf::size_type start,
+                                              cudf::size_type count) {
+        OutType val = 0;
+        for (cudf::size_type i = 0; i < count; i++) {
+          val += in_col[start + i];
+        }
+        *ret = val;
+      }
+    )***"};
+};
+
+TEST_F(GroupbyUdfTest, CudaGroupSum)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> expect_vals{9, 19, 17};
+
+  auto agg = cudf::make_udf_aggregation<cudf::groupby_aggregation>(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64});
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+}
+
+TEST_F(GroupbyUdfTest, NullInputsUnsupported)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 1, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{{0, 1, 2}, {1, 0, 1}};
+
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_udf_aggregation<cudf::groupby_aggregation>(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64}));
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({keys}));
+  EXPECT_THROW(gb_obj.aggregate(requests), cudf::logic_error);
+}
@@ -22,6 +22,8 @@
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 class SHA256HashTest : public cudf::test::BaseFixture {};
 
 TEST_F(SHA256HashTest, EmptyTable)
@@ -147,6 +149,67 @@ TEST_F(SHA256HashTest, StructsUnsupported)
   EXPECT_THROW(cudf::hashing::sha256(input), cudf::data_type_error);
 }
 
+class SHA256ChecksumTest : public cudf::test::BaseFixture {};
+
+TEST_F(SHA256ChecksumTest, SingleChunkBuffers)
+{
+  // Buffers not exceeding one 64KiB chunk yield the plain SHA-256 of their bytes:
+  // ```
+  // import hashlib, struct
+  // print(hashlib.sha256(struct.pack("<3i", 1, 2, 3)).hexdigest())
+  // print(hashlib.sha256(b"abcde").hexdigest())
+  // print(hashlib.sha256(b"").hexdigest())
+  // ```
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints_col({1, 2, 3});
+  cudf::test::strings_column_wrapper const strings_col({"ab", "cde"});
+  cudf::test::fixed_width_column_wrapper<int32_t> const empty_col{};
+
+  cudf::test::strings_column_wrapper const expected(
+    {"4636993d3e1da4e9d6b8f87b79e8f7c6d018580d52661950eabc3845c5897a4d",
+     "36bbe50ed96841d10443bcb670d6554f0a34b761be67ec9c4a8ad2c0c44ca42c",
+     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"});
+
+  auto const input  = cudf::table_view({ints_col, strings_col, empty_col});
+  auto const output = cudf::hashing::sha256_checksum(input);
+  EXPECT_EQ(input.num_columns(), output->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+}
+
+TEST_F(SHA256ChecksumTest, MultiChunkBuffer)
+{
+  // 20000 int64 values span three 64KiB chunks; the digest is the SHA-256 of the three
+  // concatenated chunk digests:
+  // ```
+  // import hashlib
+  // data = b"".join(i.to_bytes(8, "little") for i in range(20000))
+  // chunks = [data[i : i + 65536] for i in range(0, len(data), 65536)]
+  // level = b"".join(hashlib.sha256(c).hexdigest().encode() for c in chunks)
+  // print(hashlib.sha256(level).hexdigest())
+  // ```
+  auto begin = thrust::counting_iterator<int64_t>(0);
+  cudf::test::fixed_width_column_wrapper<int64_t> const col(begin, begin + 20000);
+
+  cudf::test::strings_column_wrapper const expected(
+    {"4b82b3aede733e49d344bbc0b8a5ea0d28b2f457f13e259d66f9a58cc2f79bd1"});
+
+  auto const output = cudf::hashing::sha256_checksum(cudf::table_view({col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected);
+}
+
+TEST_F(SHA256ChecksumTest, EmptyTable)
+{
+  auto const output = cudf::hashing::sha256_checksum(cudf::table_view{});
+  EXPECT_EQ(0, output->size());
+}
+
+TEST_F(SHA256ChecksumTest, ListsUnsupported)
+{
+  cudf::test::lists_column_wrapper<cudf::string_view> strings_list_col({{""}, {"", "Some inputs"}});
+  auto const input = cudf::table_view({strings_list_col});
+
+  EXPECT_THROW(cudf::hashing::sha256_checksum(input), cudf::data_type_error);
+}
+
 template <typename T>
 class SHA256HashTestTyped : public cudf::test::BaseFixture {};
 
@@ -267,11 +267,11 @@ TEST_F(DLPackUntypedTests, UnsupportedStrided1DTensorFromDlpack)
   EXPECT_THROW(cudf::from_dlpack(&tensor), cudf::logic_error);
 }
 
-TEST_F(DLPackUntypedTests, UnsupportedImplicitRowMajor2DTensorFromDlpack)
+TEST_F(DLPackUntypedTests, ImplicitRowMajor2DTensorFromDlpack)
 {
   using T            = float;
   constexpr int ndim = 2;
-  // Row major 2D tensor
+  // Row major 2D tensor (null strides indicate compact row-major data)
   auto const data     = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
   int64_t shape[ndim] = {2, 2};  // NOLINT
 
@@ -286,10 +286,15 @@ TEST_F(DLPackUntypedTests, UnsupportedImplicitRowMajor2DTensorFromDlpack)
   thrust::host_vector<T> host_vector(data.begin(), data.end());
   tensor.dl_tensor.data = host_vector.data();
 
-  EXPECT_THROW(cudf::from_dlpack(&tensor), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<T> col1({1, 3});
+  cudf::test::fixed_width_column_wrapper<T> col2({2, 4});
+  cudf::table_view expected({col1, col2});
+
+  auto result = cudf::from_dlpack(&tensor);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
 }
 
-TEST_F(DLPackUntypedTests, UnsupportedExplicitRowMajor2DTensorFromDlpack)
+TEST_F(DLPackUntypedTests, ExplicitRowMajor2DTensorFromDlpack)
 {
   using T            = float;
   constexpr int ndim = 2;
@@ -309,10 +314,15 @@ TEST_F(DLPackUntypedTests, UnsupportedExplicitRowMajor2DTensorFromDlpack)
   thrust::host_vector<T> host_vector(data.begin(), data.end());
   tensor.dl_tensor.data = host_vector.data();
 
-  EXPECT_THROW(cudf::from_dlpack(&tensor), cudf::logic_error);
+  cudf::test::fixed_width_column_wrapper<T> col1({1, 3});
+  cudf::test::fixed_width_column_wrapper<T> col2({2, 4});
+  cudf::table_view expected({col1, col2});
+
+  auto result = cudf::from_dlpack(&tensor);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
 }
 
-TEST_F(DLPackUntypedTests, UnsupportedStridedColMajor2DTensorFromDlpack)
+TEST_F(DLPackUntypedTests, StridedColMajor2DTensorFromDlpack)
 {
   using T            = float;
   constexpr int ndim = 2;
@@ -332,9 +342,49 @@ TEST_F(DLPackUntypedTests, UnsupportedStridedColMajor2DTensorFromDlpack)
   thrust::host_vector<T> host_vector(data.begin(), data.end());
   tensor.dl_tensor.data = host_vector.data();
 
+  cudf::test::fixed_width_column_wrapper<T> col1({1, 3});
+  cudf::test::fixed_width_column_wrapper<T> col2({5, 7});
+  cudf::table_view expected({col1, col2});
+
+  auto result = cudf::from_dlpack(&tensor);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
+}
+
+TEST_F(DLPackUntypedTests, NegativeStride2DTensorFromDlpack)
+{
+  using T            = float;
+  constexpr int ndim = 2;
+  // Reversed rows via negative stride are not supported
+  auto const data       = cudf::test::make_type_param_vector<T>({1, 2, 3, 4});
+  int64_t shape[ndim]   = {2, 2};   // NOLINT
+  int64_t strides[ndim] = {-1, 2};  // NOLINT
+
+  DLManagedTensor tensor{};
+  tensor.dl_tensor.device.device_type = kDLCPU;
+  tensor.dl_tensor.dtype              = get_dtype<T>();
+  tensor.dl_tensor.ndim               = ndim;
+  tensor.dl_tensor.byte_offset        = sizeof(T);
+  tensor.dl_tensor.shape              = shape;
+  tensor.dl_tensor.strides            = strides;
+
+  thrust::host_vector<T> host_vector(data.begin(), data.end());
+  tensor.dl_tensor.data = host_vector.data();
+
   EXPECT_THROW(cudf::from_dlpack(&tensor), cudf::logic_error);
 }
 
+TEST_F(DLPackUntypedTests, NullsToDlpackView)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4}, {true, false, true, true});
+  EXPECT_THROW(cudf::to_dlpack_view(col), cudf::logic_error);
+}
+
+TEST_F(DLPackUntypedTests, StringTypeToDlpackView)
+{
+  cudf::test::strings_column_wrapper col({"foo", "bar", "baz"});
+  EXPECT_THROW(cudf::to_dlpack_view(col), cudf::logic_error);
+}
+
 template <typename T>
 class DLPackTimestampTests : public cudf::test::BaseFixture {};
 
@@ -426,6 +476,29 @@ TYPED_TEST(DLPackNumericTests, ToDlpack2D)
   }
 }
 
+TYPED_TEST(DLPackNumericTests, ToDlpackViewZeroCopy)
+{
+  cudf::test::fixed_width_column_wrapper<TypeParam> col({1, 2, 3, 4});
+  auto const col_view = static_cast<cudf::column_view>(col);
+
+  unique_managed_tensor result(cudf::to_dlpack_view(col_view));
+
+  auto const& tensor = result->dl_tensor;
+  validate_dtype<TypeParam>(tensor.dtype);
+  EXPECT_EQ(kDLCUDA, tensor.device.device_type);
+  EXPECT_EQ(1, tensor.ndim);
+  EXPECT_EQ(uint64_t{0}, tensor.byte_offset);
+  EXPECT_EQ(1, tensor.strides[0]);
+  EXPECT_EQ(4, tensor.shape[0]);
+
+  // The tensor must alias the column device data, not a copy of it
+  EXPECT_EQ(col_view.head<TypeParam>(), tensor.data);
+
+  constexpr cudf::data_type type{cudf::type_to_id<TypeParam>()};
+  cudf::column_view const result_view(type, tensor.shape[0], tensor.data, nullptr, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col_view, result_view);
+}
+
 TYPED_TEST(DLPackNumericTests, FromDlpack1D)
 {
   // Use to_dlpack to generate an input tensor
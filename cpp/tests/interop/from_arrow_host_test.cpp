@@ -557,6 +557,50 @@ void slice_host_nanoarrow(ArrowArray* arr, int64_t start, int64_t end)
   }
 }
 
+TEST_F(FromArrowHostDeviceTest, StringViewColumn)
+{
+  // mix of inline (<= 12 bytes) and out-of-line view entries, plus a null and an empty string
+  std::vector<std::string> const strings = {"short",
+                                            "a string long enough to spill into a data buffer",
+                                            "",
+                                            "exactly12byt",
+                                            "another long string referencing the variadic buffer",
+                                            ""};
+  std::vector<uint8_t> const validity    = {1, 1, 1, 1, 1, 0};
+
+  nanoarrow::UniqueSchema input_schema;
+  ArrowSchemaInit(input_schema.get());
+  NANOARROW_THROW_NOT_OK(ArrowSchemaSetTypeStruct(input_schema.get(), 1));
+  NANOARROW_THROW_NOT_OK(
+    ArrowSchemaInitFromType(input_schema->children[0], NANOARROW_TYPE_STRING_VIEW));
+  NANOARROW_THROW_NOT_OK(ArrowSchemaSetName(input_schema->children[0], "a"));
+
+  nanoarrow::UniqueArray input_array;
+  NANOARROW_THROW_NOT_OK(ArrowArrayInitFromSchema(input_array.get(), input_schema.get(), nullptr));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(input_array.get()));
+  for (size_t i = 0; i < strings.size(); ++i) {
+    if (validity[i] == 0) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendNull(input_array->children[0], 1));
+    } else {
+      NANOARROW_THROW_NOT_OK(
+        ArrowArrayAppendString(input_array->children[0], ArrowCharView(strings[i].c_str())));
+    }
+    NANOARROW_THROW_NOT_OK(ArrowArrayFinishElement(input_array.get()));
+  }
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuildingDefault(input_array.get(), nullptr));
+
+  ArrowDeviceArray input;
+  memcpy(&input.array, input_array.get(), sizeof(ArrowArray));
+  input.device_id   = -1;
+  input.device_type = ARROW_DEVICE_CPU;
+
+  auto expected = cudf::test::strings_column_wrapper(
+    strings.begin(), strings.end(), validity.begin());
+
+  auto got_cudf_table = cudf::from_arrow_host(input_schema.get(), &input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got_cudf_table->view().column(0));
+}
+
 struct FromArrowHostDeviceTestSlice
   : public FromArrowHostDeviceTest,
     public ::testing::WithParamInterface<std::tuple<cudf::size_type, cudf::size_type>> {};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,6 +25,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/csv.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/convert/convert_fixed_point.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -1117,6 +1118,55 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, ByteRangeSplits)
+{
+  // Nine 5-byte records; the naive split points land mid-record and must advance past the next
+  // terminator
+  std::string const input = "1000\n2000\n3000\n4000\n5000\n6000\n7000\n8000\n9000\n";
+  auto const source       = cudf::io::datasource::create(cudf::host_span<std::byte const>{
+    reinterpret_cast<std::byte const*>(input.data()), input.size()});
+
+  auto const offsets = cudf::io::detail::csv::compute_byte_range_splits(source.get(), 3);
+  EXPECT_EQ(offsets, (std::vector<size_t>{0, 20, 35, 45}));
+
+  // Reading the ranges back covers each record exactly once
+  cudf::size_type num_rows = 0;
+  for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+    cudf::io::csv_reader_options in_opts =
+      cudf::io::csv_reader_options::builder(cudf::io::source_info{input.c_str(), input.size()})
+        .names({"A"})
+        .dtypes({dtype<int32_t>()})
+        .header(-1)
+        .byte_range_offset(offsets[i])
+        .byte_range_size(offsets[i + 1] - offsets[i]);
+    num_rows += cudf::io::read_csv(in_opts).tbl->num_rows();
+  }
+  EXPECT_EQ(9, num_rows);
+}
+
+TEST_F(CsvReaderTest, ByteRangeSplitsNoTerminator)
+{
+  // A single unterminated record; every inner split point clamps to the end of the source
+  std::string const input(100, 'x');
+  auto const source = cudf::io::datasource::create(cudf::host_span<std::byte const>{
+    reinterpret_cast<std::byte const*>(input.data()), input.size()});
+
+  auto const offsets = cudf::io::detail::csv::compute_byte_range_splits(source.get(), 4);
+  EXPECT_EQ(offsets, (std::vector<size_t>{0, 100, 100, 100, 100}));
+}
+
+TEST_F(CsvReaderTest, ByteRangeSplitsLargeRecord)
+{
+  // A record larger than the naive split size; both naive split points fall inside it and
+  // collapse onto the same boundary, leaving an empty middle range
+  std::string const input = std::string(60, 'x') + "\nab\ncd\n";
+  auto const source       = cudf::io::datasource::create(cudf::host_span<std::byte const>{
+    reinterpret_cast<std::byte const*>(input.data()), input.size()});
+
+  auto const offsets = cudf::io::detail::csv::compute_byte_range_splits(source.get(), 3);
+  EXPECT_EQ(offsets, (std::vector<size_t>{0, 61, 61, 67}));
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
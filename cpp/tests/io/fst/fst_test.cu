@@ -14,7 +14,7 @@
  * limitations under the License.
  */
 
-#include "io/fst/lookup_tables.cuh"
+#include "io/fst/fst.cuh"
 #include "io/utilities/hostdevice_vector.hpp"
 
 #include <tests/io/fst/common.hpp>
@@ -166,13 +166,13 @@ TEST_F(FstTest, GroundTruth)
   cudf::detail::hostdevice_vector<SymbolOffsetT> out_indexes_gpu(input.size(), stream_view);
 
   // Run algorithm
-  auto parser = cudf::io::fst::detail::make_fst(
-    cudf::io::fst::detail::make_symbol_group_lut(pda_sgs),
-    cudf::io::fst::detail::make_transition_table(pda_state_tt),
-    cudf::io::fst::detail::make_translation_table<TT_NUM_STATES * NUM_SYMBOL_GROUPS,
-                                                  min_translated_out,
-                                                  max_translated_out>(pda_out_tt),
-    stream);
+  auto parser =
+    cudf::io::fst::make_fst(cudf::io::fst::make_symbol_group_lut(pda_sgs),
+                            cudf::io::fst::make_transition_table(pda_state_tt),
+                            cudf::io::fst::make_translation_table<TT_NUM_STATES * NUM_SYMBOL_GROUPS,
+                                                                  min_translated_out,
+                                                                  max_translated_out>(pda_out_tt),
+                            stream);
 
   // Allocate device-side temporary storage & run algorithm
   parser.Transduce(d_input.data(),
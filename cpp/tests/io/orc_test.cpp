@@ -31,8 +31,10 @@
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <src/io/comp/nvcomp_adapter.hpp>
@@ -1290,6 +1292,46 @@ TEST_F(OrcStatisticsTest, Overflow)
   check_sum_exist(4, true);
 }
 
+TEST_F(OrcStatisticsTest, PerColumnStatisticsMode)
+{
+  constexpr auto num_rows = 100;
+
+  auto sequence = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> col(sequence, sequence + num_rows, no_nulls());
+  table_view expected({col, col, col});
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[1].set_statistics_mode(cudf::io::statistics_mode::SAMPLED);
+  expected_metadata.column_metadata[2].set_statistics_mode(cudf::io::statistics_mode::NONE);
+
+  auto filepath = temp_env->get_temp_filepath("OrcPerColumnStatisticsMode.orc");
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(std::move(expected_metadata));
+  cudf::io::write_orc(out_opts);
+
+  auto const stats = cudf::io::read_parsed_orc_statistics(cudf::io::source_info{filepath});
+
+  // column 0 in the file is the root struct; table columns start at index 1
+  auto const& exact_stats =
+    std::get<cudf::io::integer_statistics>(stats.file_stats[1].type_specific_stats);
+  EXPECT_EQ(*exact_stats.minimum, 0);
+  EXPECT_EQ(*exact_stats.maximum, 99);
+
+  // sampled statistics only cover every 32nd row, so the max is 96, not 99
+  auto const& sampled_stats =
+    std::get<cudf::io::integer_statistics>(stats.file_stats[2].type_specific_stats);
+  EXPECT_EQ(*sampled_stats.minimum, 0);
+  EXPECT_EQ(*sampled_stats.maximum, 96);
+
+  // the opted-out column has no min/max/sum at all
+  auto const& no_stats =
+    std::get<cudf::io::integer_statistics>(stats.file_stats[3].type_specific_stats);
+  EXPECT_FALSE(no_stats.minimum.has_value());
+  EXPECT_FALSE(no_stats.maximum.has_value());
+  EXPECT_FALSE(no_stats.sum.has_value());
+}
+
 TEST_F(OrcStatisticsTest, HasNull)
 {
   // This test can now be implemented with libcudf; keeping the pandas version to keep the test
@@ -2195,4 +2237,102 @@ TEST_F(OrcChunkedWriterTest, NoDataInSinkWhenNoWrite)
   EXPECT_EQ(out_buffer.size(), 0);
 }
 
+TEST_F(OrcReaderTest, FilterSimple)
+{
+  constexpr auto num_rows = 40'000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  int64_col col(sequence, sequence + num_rows);
+  table_view expected({col});
+
+  // Write multiple stripes so that stripe statistics can prune some of them
+  auto filepath = temp_env->get_temp_filepath("OrcFilterSimple.orc");
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .stripe_size_rows(10'000);
+  cudf::io::write_orc(out_opts);
+
+  // Filtering AST - table[0] >= 35000
+  auto literal_value     = cudf::numeric_scalar<int64_t>(35'000);
+  auto literal           = cudf::ast::literal(literal_value);
+  auto col_ref_0         = cudf::ast::column_reference(0);
+  auto filter_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, literal);
+
+  auto predicate = cudf::compute_column(expected, filter_expression);
+  auto expected_filtered = cudf::apply_boolean_mask(expected, *predicate);
+  // To make sure AST filters out some elements
+  EXPECT_LT(expected_filtered->num_rows(), num_rows);
+
+  cudf::io::orc_reader_options read_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+      .filter(filter_expression);
+  auto result = cudf::io::read_orc(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected_filtered);
+}
+
+TEST_F(OrcReaderTest, FilterMultiColumn)
+{
+  constexpr auto num_rows = 40'000;
+  auto ascending = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto modular =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  int32_col col0(ascending, ascending + num_rows);
+  float64_col col1(modular, modular + num_rows);
+  table_view expected({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("OrcFilterMultiColumn.orc");
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .stripe_size_rows(10'000);
+  cudf::io::write_orc(out_opts);
+
+  // Filtering AST - table[0] < 15000 AND table[1] >= 50.0
+  auto literal0_value = cudf::numeric_scalar<int32_t>(15'000);
+  auto literal0       = cudf::ast::literal(literal0_value);
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto expr0          = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, literal0);
+  auto literal1_value = cudf::numeric_scalar<double>(50.0);
+  auto literal1       = cudf::ast::literal(literal1_value);
+  auto col_ref_1      = cudf::ast::column_reference(1);
+  auto expr1 = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_1, literal1);
+  auto filter_expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr0, expr1);
+
+  auto predicate         = cudf::compute_column(expected, filter_expression);
+  auto expected_filtered = cudf::apply_boolean_mask(expected, *predicate);
+
+  cudf::io::orc_reader_options read_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+      .filter(filter_expression);
+  auto result = cudf::io::read_orc(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected_filtered);
+}
+
+TEST_F(OrcReaderTest, FilterWithRowSelection)
+{
+  std::vector<char> out_buffer;
+  auto literal_value     = cudf::numeric_scalar<int64_t>(0);
+  auto literal           = cudf::ast::literal(literal_value);
+  auto col_ref_0         = cudf::ast::column_reference(0);
+  auto filter_expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+
+  // The filter cannot be combined with row selection
+  EXPECT_THROW(cudf::io::orc_reader_options::builder(
+                 cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+                 .filter(filter_expression)
+                 .skip_rows(10),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::orc_reader_options::builder(
+                 cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+                 .filter(filter_expression)
+                 .num_rows(10),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::orc_reader_options::builder(
+                 cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+                 .skip_rows(10)
+                 .filter(filter_expression),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
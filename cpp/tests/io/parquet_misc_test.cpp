@@ -235,6 +235,70 @@ TYPED_TEST(ParquetWriterComparableTypeTest, ThreeColumnSorted)
   }
 }
 
+TYPED_TEST(ParquetWriterComparableTypeTest, DeclaredSortOrder)
+{
+  using T = TypeParam;
+
+  auto col0 = testdata::ascending<T>();
+  auto col1 = testdata::unordered<T>();
+
+  auto const expected = table_view{{col0, col1}};
+
+  // declare col0 as the leading (ascending) sort key; the declaration on sorted data
+  // must be verified and emitted as the boundary order
+  auto const filepath = temp_env->get_temp_filepath("DeclaredSortOrder.parquet");
+  const cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .max_page_size_rows(page_size_for_ordered_tests)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .sorting_columns({{0, false, true}});
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+
+  read_footer(source, &fmd);
+  ASSERT_GT(fmd.row_groups.size(), 0);
+
+  auto const& columns = fmd.row_groups[0].columns;
+  ASSERT_EQ(columns.size(), static_cast<size_t>(expected.num_columns()));
+
+  std::array expected_orders{cudf::io::parquet::detail::BoundaryOrder::ASCENDING,
+                             cudf::io::parquet::detail::BoundaryOrder::UNORDERED};
+
+  for (std::size_t i = 0; i < columns.size(); i++) {
+    auto const ci = read_column_index(source, columns[i]);
+    EXPECT_EQ(ci.boundary_order, expected_orders[i]);
+  }
+}
+
+TYPED_TEST(ParquetWriterComparableTypeTest, DeclaredSortOrderUnverified)
+{
+  using T = TypeParam;
+
+  auto col0 = testdata::unordered<T>();
+
+  auto const expected = table_view{{col0}};
+
+  // a declaration the page statistics do not bear out must degrade to UNORDERED
+  auto const filepath = temp_env->get_temp_filepath("DeclaredSortOrderUnverified.parquet");
+  const cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .max_page_size_rows(page_size_for_ordered_tests)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .sorting_columns({{0, false, true}});
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+
+  read_footer(source, &fmd);
+  ASSERT_GT(fmd.row_groups.size(), 0);
+
+  auto const ci = read_column_index(source, fmd.row_groups[0].columns[0]);
+  EXPECT_EQ(ci.boundary_order, cudf::io::parquet::detail::BoundaryOrder::UNORDERED);
+}
+
 TEST_P(ParquetCompressionTest, Basic)
 {
   constexpr auto num_rows     = 12000;
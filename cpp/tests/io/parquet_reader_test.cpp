@@ -23,6 +23,8 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
@@ -2763,3 +2765,135 @@ TEST_F(ParquetReaderTest, DISABLED_ListsWideTable)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result->view());
 }
+
+TEST_F(ParquetReaderTest, StringsToDictionaries)
+{
+  std::vector<char const*> h_strings{
+    "apple", "banana", "apple", "cherry", "banana", "apple", "cherry", "apple"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  cudf::table_view expected({strings});
+
+  std::vector<char> buffer;
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected)
+      .dictionary_policy(cudf::io::dictionary_policy::ALWAYS)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(buffer.data(), buffer.size()))
+      .convert_strings_to_dictionaries(true);
+  auto const result = cudf::io::read_parquet(in_opts);
+
+  auto const& col = result.tbl->view().column(0);
+  ASSERT_EQ(col.type().id(), cudf::type_id::DICTIONARY32);
+  auto const decoded = cudf::dictionary::decode(cudf::dictionary_column_view(col));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, strings);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionariesWithNulls)
+{
+  auto validity = cudf::test::iterators::nulls_at({1, 4});
+  std::vector<char const*> h_strings{"aa", "", "bb", "aa", "", "cc", "bb", "aa"};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity);
+  cudf::table_view expected({strings});
+
+  std::vector<char> buffer;
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected)
+      .dictionary_policy(cudf::io::dictionary_policy::ALWAYS)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(buffer.data(), buffer.size()))
+      .convert_strings_to_dictionaries(true);
+  auto const result = cudf::io::read_parquet(in_opts);
+
+  auto const& col = result.tbl->view().column(0);
+  ASSERT_EQ(col.type().id(), cudf::type_id::DICTIONARY32);
+  auto const decoded = cudf::dictionary::decode(cudf::dictionary_column_view(col));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, strings);
+}
+
+TEST_F(ParquetReaderTest, StringsToDictionariesErrors)
+{
+  cudf::test::strings_column_wrapper strings({"aa", "bb", "cc"});
+  cudf::table_view expected({strings});
+
+  // non-dictionary-encoded pages are rejected
+  std::vector<char> buffer;
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected)
+      .dictionary_policy(cudf::io::dictionary_policy::NEVER)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(buffer.data(), buffer.size()))
+      .convert_strings_to_dictionaries(true);
+  EXPECT_THROW(cudf::io::read_parquet(in_opts), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, UseMinimalDecimalTypes)
+{
+  // precision 18 fits in decimal64, but decimal128 is written as a 16-byte FIXED_LEN_BYTE_ARRAY
+  auto const values = std::vector<__int128_t>{-999'999'999'999'999'999L,
+                                              -123'456'789L,
+                                              0,
+                                              987'654'321L,
+                                              999'999'999'999'999'999L};
+  auto const col =
+    cudf::test::fixed_point_column_wrapper<__int128_t>{values.begin(), values.end(),
+                                                       numeric::scale_type{-2}};
+  auto const expected = table_view{{col}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_decimal_precision(18);
+
+  std::vector<char> buffer;
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected)
+      .metadata(expected_metadata)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  // default read keeps the storage-sized decimal128
+  cudf::io::parquet_reader_options default_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(buffer.data(), buffer.size()));
+  auto const result128 = cudf::io::read_parquet(default_opts);
+  EXPECT_EQ(result128.tbl->get_column(0).type().id(), cudf::type_id::DECIMAL128);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result128.tbl->get_column(0), col);
+
+  // precision-sized read decodes directly into decimal64
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(buffer.data(), buffer.size()))
+      .use_minimal_decimal_types(true);
+  auto const result = cudf::io::read_parquet(in_opts);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DECIMAL64);
+
+  auto const narrowed_values = std::vector<int64_t>(values.begin(), values.end());
+  auto const expected_col    = cudf::test::fixed_point_column_wrapper<int64_t>{
+    narrowed_values.begin(), narrowed_values.end(), numeric::scale_type{-2}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), expected_col);
+}
+
+TEST_F(ParquetReaderTest, UseMinimalDecimalTypesWide)
+{
+  // precision above 18 must keep decimal128 even with precision-sized decimals enabled
+  auto const col = cudf::test::fixed_point_column_wrapper<__int128_t>{
+    {__int128_t{1} << 100, -(__int128_t{1} << 100), 0}, numeric::scale_type{-2}};
+  auto const expected = table_view{{col}};
+
+  std::vector<char> buffer;
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected).build();
+  cudf::io::write_parquet(out_opts);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info(buffer.data(), buffer.size()))
+      .use_minimal_decimal_types(true);
+  auto const result = cudf::io::read_parquet(in_opts);
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DECIMAL128);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), col);
+}
@@ -1437,6 +1437,45 @@ TEST_F(ParquetWriterTest, SkipCompression)
   EXPECT_EQ(fmd.row_groups[0].columns[1].meta_data.codec, cudf::io::parquet::detail::ZSTD);
 }
 
+TEST_F(ParquetWriterTest, PerColumnStatisticsMode)
+{
+  constexpr auto num_rows = 100;
+
+  auto sequence = thrust::make_counting_iterator(0);
+  column_wrapper<int> col(sequence, sequence + num_rows, no_nulls());
+
+  auto expected          = table_view{{col, col, col}};
+  auto expected_metadata = cudf::io::table_input_metadata{expected};
+  expected_metadata.column_metadata[1].set_statistics_mode(cudf::io::statistics_mode::SAMPLED);
+  expected_metadata.column_metadata[2].set_statistics_mode(cudf::io::statistics_mode::NONE);
+
+  auto const filepath = temp_env->get_temp_filepath("PerColumnStatisticsMode.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(std::move(expected_metadata));
+
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  // exact (default) statistics cover every row
+  auto const exact_stats = get_statistics(fmd.row_groups[0].columns[0]);
+  EXPECT_EQ(std::vector<uint8_t>({0, 0, 0, 0}), exact_stats.min_value);
+  EXPECT_EQ(std::vector<uint8_t>({99, 0, 0, 0}), exact_stats.max_value);
+
+  // sampled statistics only cover every 32nd row, so the max is 96, not 99
+  auto const sampled_stats = get_statistics(fmd.row_groups[0].columns[1]);
+  EXPECT_EQ(std::vector<uint8_t>({0, 0, 0, 0}), sampled_stats.min_value);
+  EXPECT_EQ(std::vector<uint8_t>({96, 0, 0, 0}), sampled_stats.max_value);
+
+  // no min/max at all for the opted-out column
+  auto const no_stats = get_statistics(fmd.row_groups[0].columns[2]);
+  EXPECT_FALSE(no_stats.min_value.has_value());
+  EXPECT_FALSE(no_stats.max_value.has_value());
+}
+
 TEST_F(ParquetWriterTest, NoNullsAsNonNullable)
 {
   column_wrapper<int32_t> col{{1, 2, 3}, no_nulls()};
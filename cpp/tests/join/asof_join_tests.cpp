@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+struct AsofJoinTest : public cudf::test::BaseFixture {};
+
+namespace {
+// Materializes the right-side payload selected by the as-of gather map, turning unmatched rows
+// into nulls.
+std::unique_ptr<cudf::table> asof_join_and_gather(cudf::table_view const& left_keys,
+                                                  cudf::table_view const& right_keys,
+                                                  cudf::column_view const& left_on,
+                                                  cudf::column_view const& right_on,
+                                                  cudf::table_view const& right_payload,
+                                                  cudf::null_equality compare_nulls)
+{
+  auto const join_indices =
+    cudf::asof_join(left_keys, right_keys, left_on, right_on, compare_nulls);
+  auto const indices_span = cudf::device_span<cudf::size_type const>{*join_indices};
+  auto const indices_col  = cudf::column_view{indices_span};
+  return cudf::gather(right_payload, indices_col, cudf::out_of_bounds_policy::NULLIFY);
+}
+}  // namespace
+
+TEST_F(AsofJoinTest, NoKeys)
+{
+  column_wrapper<int32_t> left_on{{1, 5, 10}};
+  column_wrapper<int32_t> right_on{{2, 4, 4, 9}};
+  column_wrapper<int32_t> payload{{20, 40, 41, 90}};
+
+  auto const result = asof_join_and_gather(cudf::table_view{},
+                                           cudf::table_view{},
+                                           left_on,
+                                           right_on,
+                                           cudf::table_view{{payload}},
+                                           cudf::null_equality::EQUAL);
+
+  // 1 precedes every right value; 5 matches the later of the tied 4s; 10 matches 9
+  column_wrapper<int32_t> expected{{0, 41, 90}, {0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(0), expected);
+}
+
+TEST_F(AsofJoinTest, KeyedUnsortedInputs)
+{
+  strcol_wrapper left_keys{{"b", "a", "a", "c"}};
+  column_wrapper<int32_t> left_on{{5, 5, 1, 5}};
+  strcol_wrapper right_keys{{"b", "a", "a", "b"}};
+  column_wrapper<int32_t> right_on{{6, 4, 2, 3}};
+  column_wrapper<int32_t> payload{{60, 40, 20, 30}};
+
+  auto const result = asof_join_and_gather(cudf::table_view{{left_keys}},
+                                           cudf::table_view{{right_keys}},
+                                           left_on,
+                                           right_on,
+                                           cudf::table_view{{payload}},
+                                           cudf::null_equality::EQUAL);
+
+  // ("b", 5) matches ("b", 3); ("a", 5) matches ("a", 4); ("a", 1) has no earlier "a" row and
+  // "c" has no right rows at all
+  column_wrapper<int32_t> expected{{30, 40, 0, 0}, {1, 1, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(0), expected);
+}
+
+TEST_F(AsofJoinTest, NullKeys)
+{
+  column_wrapper<int32_t> left_keys{{0, 0}, {0, 1}};
+  column_wrapper<int32_t> left_on{{5, 5}};
+  column_wrapper<int32_t> right_keys{{0, 0}, {0, 1}};
+  column_wrapper<int32_t> right_on{{2, 3}};
+  column_wrapper<int32_t> payload{{20, 30}};
+
+  auto const equal = asof_join_and_gather(cudf::table_view{{left_keys}},
+                                          cudf::table_view{{right_keys}},
+                                          left_on,
+                                          right_on,
+                                          cudf::table_view{{payload}},
+                                          cudf::null_equality::EQUAL);
+  column_wrapper<int32_t> expected_equal{{20, 30}, {1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(equal->get_column(0), expected_equal);
+
+  auto const unequal = asof_join_and_gather(cudf::table_view{{left_keys}},
+                                            cudf::table_view{{right_keys}},
+                                            left_on,
+                                            right_on,
+                                            cudf::table_view{{payload}},
+                                            cudf::null_equality::UNEQUAL);
+  column_wrapper<int32_t> expected_unequal{{0, 30}, {0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(unequal->get_column(0), expected_unequal);
+}
+
+TEST_F(AsofJoinTest, EmptyRight)
+{
+  column_wrapper<int32_t> left_keys{{0, 1}};
+  column_wrapper<int32_t> left_on{{5, 6}};
+  column_wrapper<int32_t> right_keys{};
+  column_wrapper<int32_t> right_on{};
+  column_wrapper<int32_t> payload{};
+
+  auto const result = asof_join_and_gather(cudf::table_view{{left_keys}},
+                                           cudf::table_view{{right_keys}},
+                                           left_on,
+                                           right_on,
+                                           cudf::table_view{{payload}},
+                                           cudf::null_equality::EQUAL);
+
+  column_wrapper<int32_t> expected{{0, 0}, {0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(0), expected);
+}
+
+TEST_F(AsofJoinTest, InvalidInputs)
+{
+  column_wrapper<int32_t> keys{{0, 1}};
+  column_wrapper<int32_t> on{{5, 6}};
+  column_wrapper<int64_t> wide_on{{5, 6}};
+  column_wrapper<int32_t> null_on{{5, 6}, {1, 0}};
+
+  // Key column counts must match
+  EXPECT_THROW(
+    cudf::asof_join(cudf::table_view{{keys}}, cudf::table_view{}, on, on, cudf::null_equality::EQUAL),
+    cudf::logic_error);
+  // Ordering column types must match
+  EXPECT_THROW(cudf::asof_join(cudf::table_view{{keys}},
+                               cudf::table_view{{keys}},
+                               on,
+                               wide_on,
+                               cudf::null_equality::EQUAL),
+               cudf::data_type_error);
+  // Ordering columns must not contain nulls
+  EXPECT_THROW(cudf::asof_join(cudf::table_view{{keys}},
+                               cudf::table_view{{keys}},
+                               null_on,
+                               on,
+                               cudf::null_equality::EQUAL),
+               cudf::logic_error);
+}
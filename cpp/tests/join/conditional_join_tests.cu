@@ -426,6 +426,18 @@ TYPED_TEST(ConditionalInnerJoinTest, TestOneColumnTwoRowAllEqual)
   this->test({{0, 1}}, {{0, 0}}, left_zero_eq_right_zero, {{0, 0}, {0, 1}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestSizeEstimateMatchesExactForSmallInputs)
+{
+  auto col_left  = cudf::test::fixed_width_column_wrapper<TypeParam>{{0, 1, 2, 2, 3}};
+  auto col_right = cudf::test::fixed_width_column_wrapper<TypeParam>{{1, 2, 2, 4}};
+  auto left      = cudf::table_view{{col_left}};
+  auto right     = cudf::table_view{{col_right}};
+
+  // Below the sampling floor the estimate falls back to the exact size computation
+  EXPECT_EQ(cudf::conditional_inner_join_size_estimate(left, right, left_zero_eq_right_zero),
+            cudf::conditional_inner_join_size(left, right, left_zero_eq_right_zero));
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestTwoColumnOneRowAllEqual)
 {
   this->test({{0}, {0}}, {{0}, {0}}, left_zero_eq_right_zero, {{0, 0}});
@@ -518,6 +530,27 @@ TYPED_TEST(ConditionalInnerJoinTest, TestComplexConditionMultipleColumns)
              {{4, 0}, {5, 0}, {6, 0}, {7, 0}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestBandPredicate)
+{
+  // a BETWEEN b - 1 AND b + 1, the shape recognized by the band-join fast path for signed
+  // integral columns and evaluated by the generic kernel for every other element type
+  auto col_ref_left  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto col_ref_right = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto scalar_1      = cudf::numeric_scalar<TypeParam>(1);
+  auto literal_1     = cudf::ast::literal(scalar_1);
+
+  auto lower_bound = cudf::ast::operation(cudf::ast::ast_operator::SUB, col_ref_right, literal_1);
+  auto upper_bound = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_right, literal_1);
+  auto left_ge_lower =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_left, lower_bound);
+  auto left_le_upper =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, col_ref_left, upper_bound);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, left_ge_lower, left_le_upper);
+
+  this->test({{1, 3, 6, 9}}, {{2, 3, 7, 20}}, expression, {{0, 0}, {1, 0}, {1, 1}, {2, 2}});
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
 {
   auto col_ref_0  = cudf::ast::column_reference(0);
@@ -99,6 +99,31 @@ TEST_F(DistinctJoinTest, IntegerInnerJoin)
   this->compare_to_reference(build_table, probe_table, result, cudf::table_view{{gold->view()}});
 }
 
+TEST_F(DistinctJoinTest, IntegerInnerJoinRepeatedProbes)
+{
+  auto constexpr size = 2024;
+
+  auto const init = cudf::numeric_scalar<int32_t>{0};
+
+  auto build = cudf::sequence(size, init, cudf::numeric_scalar<int32_t>{1});
+  auto probe = cudf::sequence(size, init, cudf::numeric_scalar<int32_t>{2});
+
+  auto build_table = cudf::table_view{{build->view()}};
+  auto probe_table = cudf::table_view{{probe->view()}};
+
+  auto distinct_join = cudf::distinct_hash_join<cudf::has_nested::NO>{
+    build_table, probe_table, cudf::nullable_join::NO};
+
+  auto constexpr gold_size = size / 2;
+  auto gold                = cudf::sequence(gold_size, init, cudf::numeric_scalar<int32_t>{2});
+
+  // Later probes reuse the row hashes cached by the first one and must produce the same result
+  for (int i = 0; i < 2; ++i) {
+    auto result = distinct_join.inner_join();
+    this->compare_to_reference(build_table, probe_table, result, cudf::table_view{{gold->view()}});
+  }
+}
+
 TEST_F(DistinctJoinTest, InnerJoinNoNulls)
 {
   column_wrapper<int32_t> col0_0{{1, 2, 3, 4, 5}};
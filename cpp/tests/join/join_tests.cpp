@@ -24,7 +24,9 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/dictionary/update_keys.hpp>
 #include <cudf/join.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
@@ -1424,6 +1426,123 @@ TEST_F(JoinTest, HashJoinSequentialProbes)
   }
 }
 
+TEST_F(JoinTest, HashJoinInsert)
+{
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3, 1, 2, 9}}.release());
+
+  Table t1(std::move(cols1));
+  auto const build_prefix = cudf::slice(t1.view(), {0, 5}).front();
+
+  cudf::hash_join hash_join(build_prefix, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{1, 2, 5}}.release());
+
+  Table t0(std::move(cols0));
+
+  {
+    auto output_size                         = hash_join.inner_join_size(t0);
+    std::optional<std::size_t> optional_size = output_size;
+
+    std::size_t const size_gold = 2;
+    EXPECT_EQ(output_size, size_gold);
+
+    auto result = hash_join.inner_join(t0, optional_size);
+    column_wrapper<int32_t> col_gold_0{{1, 1}};
+    column_wrapper<int32_t> col_gold_1{{0, 1}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  // Insert the rows appended past the original build table; subsequent probes also return their
+  // indices
+  hash_join.insert(t1.view());
+
+  {
+    auto output_size                         = hash_join.inner_join_size(t0);
+    std::optional<std::size_t> optional_size = output_size;
+
+    std::size_t const size_gold = 4;
+    EXPECT_EQ(output_size, size_gold);
+
+    auto result = hash_join.inner_join(t0, optional_size);
+    column_wrapper<int32_t> col_gold_0{{0, 1, 1, 1}};
+    column_wrapper<int32_t> col_gold_1{{5, 0, 1, 6}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+}
+
+TEST_F(JoinTest, PartitionedInnerJoin)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{3, 1, 2, 0, 2}}.release());
+  cols0.emplace_back(strcol_wrapper({"s1", "s1", "s0", "s4", "s0"}).release());
+
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{2, 2, 0, 4, 3}}.release());
+  cols1.emplace_back(strcol_wrapper({"s1", "s0", "s1", "s2", "s1"}).release());
+
+  Table t1(std::move(cols1));
+
+  auto result = cudf::partitioned_inner_join(t0, t1, 3);
+  column_wrapper<int32_t> col_gold_0{{0, 2, 4}};
+  column_wrapper<int32_t> col_gold_1{{4, 1, 1}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, MergeInnerJoin)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{0, 1, 1, 2, 5}}.release());
+
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{1, 1, 2, 3}}.release());
+
+  Table t1(std::move(cols1));
+
+  auto result = cudf::merge_inner_join(t0, t1);
+  column_wrapper<int32_t> col_gold_0{{1, 1, 2, 2, 3}};
+  column_wrapper<int32_t> col_gold_1{{0, 1, 0, 1, 2}};
+  auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
+TEST_F(JoinTest, MergeInnerJoinWithNulls)
+{
+  CVector cols0;
+  cols0.emplace_back(column_wrapper<int32_t>{{-1, 1, 2}, {0, 1, 1}}.release());
+
+  Table t0(std::move(cols0));
+
+  CVector cols1;
+  cols1.emplace_back(column_wrapper<int32_t>{{-1, -1, 2}, {0, 0, 1}}.release());
+
+  Table t1(std::move(cols1));
+
+  {
+    auto result = cudf::merge_inner_join(t0, t1, cudf::null_equality::EQUAL);
+    column_wrapper<int32_t> col_gold_0{{0, 0, 2}};
+    column_wrapper<int32_t> col_gold_1{{0, 1, 2}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    auto result = cudf::merge_inner_join(t0, t1, cudf::null_equality::UNEQUAL);
+    column_wrapper<int32_t> col_gold_0{{2}};
+    column_wrapper<int32_t> col_gold_1{{2}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+}
+
 TEST_F(JoinTest, HashJoinWithStructsAndNulls)
 {
   auto col0_names_col = strcol_wrapper{
@@ -1836,6 +1955,30 @@ TEST_F(JoinDictionaryTest, FullJoinWithNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinDictionaryTest, HashJoinMatchedDictionaries)
+{
+  strcol_wrapper col0_w({"s0", "s1", "s2", "s4", "s1"});
+  auto col0 = cudf::dictionary::encode(col0_w);
+  strcol_wrapper col1_w({"s1", "s0", "s1", "s2", "s3"});
+  auto col1 = cudf::dictionary::encode(col1_w);
+
+  // The prebuilt hash_join probes on dictionary indices, so the key sets must be unified first
+  auto const dictionaries = std::vector<cudf::dictionary_column_view>{
+    cudf::dictionary_column_view(col0->view()), cudf::dictionary_column_view(col1->view())};
+  auto matched = cudf::dictionary::match_dictionaries(dictionaries);
+  auto build = cudf::table_view({matched.front()->view()});
+  auto probe = cudf::table_view({matched.back()->view()});
+
+  cudf::hash_join hash_join(build, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+  auto const [probe_indices, build_indices] = hash_join.inner_join(probe);
+
+  auto gold = inner_join(cudf::table_view({col1_w}), cudf::table_view({col0_w}), {0}, {0});
+  EXPECT_EQ(probe_indices->size(), static_cast<std::size_t>(gold->num_rows()));
+
+  // Probing with the original unmatched dictionary is rejected
+  EXPECT_THROW(hash_join.inner_join(cudf::table_view({col1->view()})), cudf::logic_error);
+}
+
 TEST_F(JoinTest, FullJoinWithStructsAndNulls)
 {
   column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 3}};
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/labeling/label_bins.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <limits>
+
+namespace {
+
+template <typename T>
+using fwc_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+using counts_wrapper = fwc_wrapper<cudf::size_type>;
+
+struct BinCountsTestFixture : public cudf::test::BaseFixture {};
+
+}  // anonymous namespace
+
+// Edge types must match the input type, same as cudf::label_bins.
+TEST(BinCountsErrorTests, TestMismatchedTypes)
+{
+  fwc_wrapper<double> left_edges{0, 1, 2};
+  fwc_wrapper<float> right_edges{1, 2, 3};
+  fwc_wrapper<float> input{0.5, 1.5};
+
+  EXPECT_THROW(
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO),
+    cudf::data_type_error);
+}
+
+// Number of left and right edges must match.
+TEST(BinCountsErrorTests, TestMismatchedEdges)
+{
+  fwc_wrapper<float> left_edges{0, 1, 2};
+  fwc_wrapper<float> right_edges{1, 2};
+  fwc_wrapper<float> input{0.5, 1.5};
+
+  EXPECT_THROW(
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO),
+    cudf::logic_error);
+}
+
+// Values are counted in the bins that would label them.
+TEST_F(BinCountsTestFixture, TestSimpleCounts)
+{
+  fwc_wrapper<float> left_edges{0, 2, 4, 6};
+  fwc_wrapper<float> right_edges{2, 4, 6, 8};
+  fwc_wrapper<float> input{0.5, 1.5, 2.5, 5.0, 7.0, 7.5, 7.9};
+
+  auto result =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  counts_wrapper expected{2, 1, 1, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+// Boundary values respect the requested inclusiveness.
+TEST_F(BinCountsTestFixture, TestInclusiveBoundaries)
+{
+  fwc_wrapper<int32_t> left_edges{0, 10};
+  fwc_wrapper<int32_t> right_edges{10, 20};
+  fwc_wrapper<int32_t> input{0, 10, 10, 20};
+
+  auto left_closed =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  counts_wrapper expected_left_closed{1, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(left_closed->view(), expected_left_closed);
+
+  auto right_closed =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::NO, right_edges, cudf::inclusive::YES);
+  counts_wrapper expected_right_closed{2, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(right_closed->view(), expected_right_closed);
+}
+
+// NULL, NaN, and out-of-bin values are not counted anywhere.
+TEST_F(BinCountsTestFixture, TestUncountedValues)
+{
+  fwc_wrapper<double> left_edges{0, 5};
+  fwc_wrapper<double> right_edges{5, 10};
+  fwc_wrapper<double> input{{1, 6, -1, 20, std::numeric_limits<double>::quiet_NaN(), 7},
+                            {1, 1, 1, 1, 1, 0}};
+
+  auto result =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  counts_wrapper expected{1, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+// Log-scale histograms are expressed by passing geometric edge sequences.
+TEST_F(BinCountsTestFixture, TestGeometricEdges)
+{
+  fwc_wrapper<double> left_edges{1, 10, 100};
+  fwc_wrapper<double> right_edges{10, 100, 1000};
+  fwc_wrapper<double> input{2, 5, 9, 50, 120, 999};
+
+  auto result =
+    cudf::bin_counts(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  counts_wrapper expected{3, 1, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+// Empty edges produce an empty counts column; empty input produces zero counts.
+TEST_F(BinCountsTestFixture, TestEmptyEdgesAndInput)
+{
+  fwc_wrapper<float> empty_edges{};
+  fwc_wrapper<float> input{0.5, 1.5};
+
+  auto empty_result =
+    cudf::bin_counts(input, empty_edges, cudf::inclusive::YES, empty_edges, cudf::inclusive::NO);
+  EXPECT_EQ(empty_result->size(), 0);
+
+  fwc_wrapper<float> left_edges{0, 1};
+  fwc_wrapper<float> right_edges{1, 2};
+  fwc_wrapper<float> empty_input{};
+
+  auto zero_result = cudf::bin_counts(
+    empty_input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+  counts_wrapper expected{0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(zero_result->view(), expected);
+}
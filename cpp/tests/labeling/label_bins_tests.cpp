@@ -307,6 +307,55 @@ TYPED_TEST(RealDataBinTestFixture, TestRealData256) { this->test(256); };
 TYPED_TEST(RealDataBinTestFixture, TestRealData512) { this->test(512); };
 TYPED_TEST(RealDataBinTestFixture, TestRealData1024) { this->test(1024); };
 
+// Test sorted input, which is labeled by the warp-seeded monotonic kernel. Includes values in
+// the gaps between bins and above the last bin to exercise the null sentinel on that path.
+template <typename T>
+struct SortedInputBinTestFixture : public BinTestFixture {
+  void test(unsigned int num_elements = 512)
+  {
+    // Avoid testing numbers that are larger than the current type supports.
+    num_elements = static_cast<unsigned int>(
+      std::min<double>(std::numeric_limits<T>::max(), num_elements));
+
+    // Create noncontiguous bins of width 2 separated by 2, covering only the lower half of the
+    // sorted input range.
+    unsigned int const num_edges = std::max(1u, num_elements / 8);
+
+    std::vector<T> left_edge_vector(num_edges);
+    std::vector<T> right_edge_vector(num_edges);
+    std::vector<T> input_vector(num_elements);
+    std::vector<cudf::size_type> expected_vector(num_elements);
+    std::vector<unsigned int> expected_validity(num_elements);
+
+    for (unsigned int i = 0; i < num_edges; ++i) {
+      left_edge_vector[i]  = static_cast<T>(4 * i);
+      right_edge_vector[i] = static_cast<T>(4 * i + 2);
+    }
+    std::iota(input_vector.begin(), input_vector.end(), T{0});
+    for (unsigned int i = 0; i < num_elements; ++i) {
+      bool const in_bin    = (i % 4 < 2) && (i / 4 < num_edges);
+      expected_vector[i]   = in_bin ? i / 4 : 0;
+      expected_validity[i] = in_bin;
+    }
+
+    fwc_wrapper<T> left_edges(left_edge_vector.begin(), left_edge_vector.end());
+    fwc_wrapper<T> right_edges(right_edge_vector.begin(), right_edge_vector.end());
+    fwc_wrapper<T> input(input_vector.begin(), input_vector.end());
+    fwc_wrapper<cudf::size_type> expected(
+      expected_vector.begin(), expected_vector.end(), expected_validity.begin());
+
+    auto result =
+      cudf::label_bins(input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+  }
+};
+
+TYPED_TEST_SUITE(SortedInputBinTestFixture, NumericTypesNotBool);
+
+TYPED_TEST(SortedInputBinTestFixture, TestSortedInput256) { this->test(256); };
+TYPED_TEST(SortedInputBinTestFixture, TestSortedInput1024) { this->test(1024); };
+
 // Test negative numbers for signed types.
 template <typename T>
 struct NegativeNumbersBinTestFixture : public RealDataBinTestFixture<T> {
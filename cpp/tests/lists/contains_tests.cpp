@@ -491,6 +491,59 @@ TYPED_TEST(TypedContainsTest, ScalarNullSearchKey)
   }
 }
 
+TYPED_TEST(TypedContainsTest, SortedListsScalarKey)
+{
+  using T = TypeParam;
+
+  // list rows sorted ascending with nulls last, as produced by sort_lists
+  auto const search_space_col = cudf::test::lists_column_wrapper<T, int32_t>{
+    {{0, 1, 1, 2},
+     {3, 4, 5},
+     {6, 7, 8},
+     {0, 1, 1, 3, 9},
+     {{2, 3, X}, null_at(2)},
+     {},
+     {1, 2, 3}},
+    null_at(5)};
+  auto const search_space = cudf::lists_column_view{search_space_col};
+  auto search_key_one     = create_scalar_search_key<T>(1);
+
+  auto result   = cudf::lists::contains_sorted(search_space, *search_key_one);
+  auto expected = bools_col{{1, 0, 0, 1, 0, X, 1}, null_at(5)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+
+  // a null search key nullifies all output rows
+  auto null_key    = create_null_search_key<T>();
+  auto null_result = cudf::lists::contains_sorted(search_space, *null_key);
+  auto all_null    = bools_col{{X, X, X, X, X, X, X}, all_nulls()};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(all_null, *null_result);
+}
+
+TEST_F(ContainsTest, SortedListsVectorKeys)
+{
+  auto const search_space_col = cudf::test::lists_column_wrapper<int32_t>{
+    {1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {}, {0, 2, 4, 6, 8}};
+  auto const search_space = cudf::lists_column_view{search_space_col};
+  auto const search_keys =
+    cudf::test::fixed_width_column_wrapper<int32_t>{{2, 5, 8, 1, X}, null_at(4)};
+
+  auto result   = cudf::lists::contains_sorted(search_space, search_keys);
+  auto expected = bools_col{{1, 1, 1, 0, X}, null_at(4)};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+}
+
+TEST_F(ContainsTest, SortedListsStringKey)
+{
+  auto const search_space_col = cudf::test::lists_column_wrapper<cudf::string_view>{
+    {"aaa", "bbb", "ccc"}, {"ddd", "eee"}, {}, {"bbb", "zzz"}};
+  auto const search_space = cudf::lists_column_view{search_space_col};
+  auto const search_key   = create_scalar_search_key<std::string>("bbb");
+
+  auto result   = cudf::lists::contains_sorted(search_space, *search_key);
+  auto expected = bools_col{1, 0, 0, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+}
+
 TEST_F(ContainsTest, ScalarTypeRelatedExceptions)
 {
   {
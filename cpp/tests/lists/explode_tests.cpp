@@ -94,6 +94,40 @@ TEST_F(ExplodeTest, Basics)
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
 
+TEST_F(ExplodeTest, SiblingListsSharedOffsets)
+{
+  //    a                   b                  c
+  //    100                [1, 2, 7]          [[10, 20, 70]
+  //    200                [5, 6]              [50, 60]
+  //    300                [0, 3]              [0, 30]]
+
+  FCW a{100, 200, 300};
+  LCW b{LCW{1, 2, 7}, LCW{5, 6}, LCW{0, 3}};
+  LCW c{LCW{10, 20, 70}, LCW{50, 60}, LCW{0, 30}};
+
+  cudf::table_view t({a, b, c});
+
+  auto ret = cudf::explode(t, std::vector<cudf::size_type>{1, 2});
+
+  FCW expected_a{100, 100, 100, 200, 200, 300, 300};
+  FCW expected_b{1, 2, 7, 5, 6, 0, 3};
+  FCW expected_c{10, 20, 70, 50, 60, 0, 30};
+  cudf::table_view expected({expected_a, expected_b, expected_c});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ret->view(), expected);
+
+  // a single index behaves exactly like the single-column API
+  auto single = cudf::explode(t, std::vector<cudf::size_type>{1});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(single->view(), cudf::explode(t, 1)->view());
+
+  // mismatched offsets are rejected
+  LCW d{LCW{1}, LCW{2, 3}, LCW{4, 5}};
+  cudf::table_view mismatched({a, b, d});
+  EXPECT_THROW(cudf::explode(mismatched, std::vector<cudf::size_type>{1, 2}), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(t, std::vector<cudf::size_type>{}), cudf::logic_error);
+  EXPECT_THROW(cudf::explode(t, std::vector<cudf::size_type>{1, 1}), cudf::logic_error);
+}
+
 TEST_F(ExplodeTest, SingleNull)
 {
   //    a                   b
@@ -19,6 +19,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/table.hpp>
@@ -752,3 +753,51 @@ TYPED_TEST(RoundRobinTest, RoundRobinIncorrectStartPartition)
   EXPECT_THROW(cudf::round_robin_partition(rr_view, num_partitions, start_partition),
                cudf::logic_error);
 }
+
+struct RoundRobinViewTest : public cudf::test::BaseFixture {};
+
+TEST_F(RoundRobinViewTest, MatchesMaterializedPartitions)
+{
+  cudf::size_type constexpr num_rows{13};
+  auto iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i * 10); });
+  auto const col = fixed_width_column_wrapper<int32_t>(iter, iter + num_rows);
+  auto const input = cudf::table_view{{col}};
+
+  for (auto const [num_partitions, start_partition] :
+       {std::pair{3, 0}, std::pair{3, 2}, std::pair{5, 1}, std::pair{20, 7}}) {
+    auto const views = cudf::round_robin_partition_views(input, num_partitions, start_partition);
+    ASSERT_EQ(views.size(), static_cast<std::size_t>(num_partitions));
+
+    auto const [reference, offsets] =
+      cudf::round_robin_partition(input, num_partitions, start_partition);
+
+    cudf::size_type total_rows{0};
+    for (cudf::size_type p = 0; p < num_partitions; ++p) {
+      auto const& view = views[p];
+      EXPECT_EQ(view.stride, num_partitions);
+      total_rows += view.num_rows;
+
+      auto const begin = offsets[p];
+      auto const end =
+        (p + 1 < num_partitions) ? offsets[p + 1] : reference->view().num_rows();
+      ASSERT_EQ(view.num_rows, end - begin);
+      if (view.num_rows == 0) { continue; }
+
+      auto const expected = cudf::slice(reference->view(), {begin, end}).front();
+      auto const got      = view.materialize();
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got->view());
+    }
+    EXPECT_EQ(total_rows, num_rows);
+  }
+}
+
+TEST_F(RoundRobinViewTest, InvalidArguments)
+{
+  auto const col = fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const input = cudf::table_view{{col}};
+
+  EXPECT_THROW(cudf::round_robin_partition_views(input, 0, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::round_robin_partition_views(input, 3, 3), cudf::logic_error);
+  EXPECT_THROW(cudf::round_robin_partition_views(input, 3, -1), cudf::logic_error);
+}
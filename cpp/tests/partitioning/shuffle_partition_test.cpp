@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <numeric>
+
+struct ShufflePartitionTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// Sorts a table by all its columns so partitions with unspecified row order can be compared
+std::unique_ptr<cudf::table> sorted(cudf::table_view const& t)
+{
+  return cudf::sort_by_key(t, t);
+}
+
+// Compares shuffle_partition output with the hash_partition + contiguous_split reference
+void expect_matches_reference(cudf::table_view const& input,
+                              std::vector<cudf::size_type> const& columns_to_hash,
+                              cudf::size_type num_partitions)
+{
+  auto const result = cudf::shuffle_partition(input, columns_to_hash, num_partitions);
+  ASSERT_EQ(result.size(), static_cast<std::size_t>(num_partitions));
+
+  auto const [reference, offsets] = cudf::hash_partition(input, columns_to_hash, num_partitions);
+  auto const splits = std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end());
+  auto const reference_parts = cudf::split(reference->view(), splits);
+
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    // each packed partition must contain the same rows as the reference partition
+    auto const got      = sorted(result[p].table);
+    auto const expected = sorted(reference_parts[p]);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+
+    // the packed metadata + buffer must round-trip through unpack
+    auto const unpacked = cudf::unpack(result[p].data);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result[p].table, unpacked);
+  }
+}
+
+}  // namespace
+
+TEST_F(ShufflePartitionTest, FixedWidthFusedPath)
+{
+  constexpr cudf::size_type num_rows{10'000};
+  auto key_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 317); });
+  auto val_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>(i); });
+  auto const keys = cudf::test::fixed_width_column_wrapper<int32_t>(key_iter, key_iter + num_rows);
+  auto const vals = cudf::test::fixed_width_column_wrapper<double>(val_iter, val_iter + num_rows);
+
+  expect_matches_reference(cudf::table_view{{keys, vals}}, {0}, 8);
+}
+
+TEST_F(ShufflePartitionTest, StringsFallbackPath)
+{
+  auto const keys = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3, 4, 5, 6, 7, 8};
+  auto const vals =
+    cudf::test::strings_column_wrapper{"a", "bb", "ccc", "d", "ee", "fff", "g", "hh"};
+
+  expect_matches_reference(cudf::table_view{{keys, vals}}, {0}, 3);
+}
+
+TEST_F(ShufflePartitionTest, PartitionSizesCoverAllRows)
+{
+  constexpr cudf::size_type num_rows{1'000};
+  auto iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i * 7919); });
+  auto const col = cudf::test::fixed_width_column_wrapper<int64_t>(iter, iter + num_rows);
+
+  auto const result = cudf::shuffle_partition(cudf::table_view{{col}}, {0}, 13);
+  auto const total  = std::accumulate(
+    result.begin(), result.end(), cudf::size_type{0}, [](auto sum, auto const& part) {
+      return sum + part.table.num_rows();
+    });
+  EXPECT_EQ(total, num_rows);
+}
+
+TEST_F(ShufflePartitionTest, InvalidInputs)
+{
+  auto const col   = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const input = cudf::table_view{{col}};
+  EXPECT_THROW(cudf::shuffle_partition(input, {0}, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::shuffle_partition(input, {}, 4), cudf::logic_error);
+  EXPECT_THROW(cudf::shuffle_partition(input, {7}, 4), std::out_of_range);
+}
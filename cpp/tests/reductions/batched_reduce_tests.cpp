@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <stdexcept>
+
+struct BatchedReduceTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+std::vector<std::unique_ptr<cudf::reduce_aggregation>> make_stats_aggs()
+{
+  std::vector<std::unique_ptr<cudf::reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::reduce_aggregation>());
+  aggs.push_back(cudf::make_min_aggregation<cudf::reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<cudf::reduce_aggregation>());
+  return aggs;
+}
+
+}  // namespace
+
+TEST_F(BatchedReduceTest, FusedNumericColumns)
+{
+  constexpr cudf::size_type num_rows{10'000};
+  auto int_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 997 - 500); });
+  auto dbl_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>(i) * 0.25; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints(int_iter, int_iter + num_rows);
+  cudf::test::fixed_width_column_wrapper<double> const dbls(
+    dbl_iter, dbl_iter + num_rows, validity);
+
+  auto const input = cudf::table_view{{ints, dbls}};
+  std::vector<std::vector<std::unique_ptr<cudf::reduce_aggregation>>> aggregations;
+  aggregations.push_back(make_stats_aggs());
+  aggregations.push_back(make_stats_aggs());
+
+  auto const results = cudf::batched_reduce(input, aggregations);
+  ASSERT_EQ(results.size(), 2u);
+  ASSERT_EQ(results[0].size(), 4u);
+
+  // int32 sums promote to int64; min/max keep the column type; mean is double
+  EXPECT_EQ(results[0][0]->type(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(results[0][1]->type(), cudf::data_type{cudf::type_id::INT32});
+  EXPECT_EQ(results[0][3]->type(), cudf::data_type{cudf::type_id::FLOAT64});
+
+  for (cudf::size_type c = 0; c < input.num_columns(); ++c) {
+    for (std::size_t a = 0; a < aggregations[c].size(); ++a) {
+      auto const output_dtype =
+        cudf::detail::target_type(input.column(c).type(), aggregations[c][a]->kind);
+      auto const reference = cudf::reduce(input.column(c), *aggregations[c][a], output_dtype);
+      EXPECT_EQ(results[c][a]->type(), reference->type());
+      EXPECT_TRUE(results[c][a]->is_valid());
+    }
+  }
+
+  auto const& sum = static_cast<cudf::numeric_scalar<int64_t> const&>(*results[0][0]);
+  auto const reference_sum = cudf::reduce(ints,
+                                          *cudf::make_sum_aggregation<cudf::reduce_aggregation>(),
+                                          cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(sum.value(),
+            static_cast<cudf::numeric_scalar<int64_t> const&>(*reference_sum).value());
+
+  auto const& mean = static_cast<cudf::numeric_scalar<double> const&>(*results[1][3]);
+  auto const reference_mean =
+    cudf::reduce(dbls,
+                 *cudf::make_mean_aggregation<cudf::reduce_aggregation>(),
+                 cudf::data_type{cudf::type_id::FLOAT64});
+  EXPECT_DOUBLE_EQ(mean.value(),
+                   static_cast<cudf::numeric_scalar<double> const&>(*reference_mean).value());
+}
+
+TEST_F(BatchedReduceTest, FallbackAggregationsAndColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints{4, 1, 3, 2, 5};
+  cudf::test::strings_column_wrapper const strs{"d", "a", "c", "b", "e"};
+
+  std::vector<std::vector<std::unique_ptr<cudf::reduce_aggregation>>> aggregations;
+  // product is not fused; strings columns are never fused
+  aggregations.push_back({});
+  aggregations[0].push_back(cudf::make_product_aggregation<cudf::reduce_aggregation>());
+  aggregations[0].push_back(cudf::make_sum_aggregation<cudf::reduce_aggregation>());
+  aggregations.push_back({});
+  aggregations[1].push_back(cudf::make_min_aggregation<cudf::reduce_aggregation>());
+
+  auto const results = cudf::batched_reduce(cudf::table_view{{ints, strs}}, aggregations);
+
+  auto const& product = static_cast<cudf::numeric_scalar<int64_t> const&>(*results[0][0]);
+  EXPECT_EQ(product.value(), 120);
+  auto const& sum = static_cast<cudf::numeric_scalar<int64_t> const&>(*results[0][1]);
+  EXPECT_EQ(sum.value(), 15);
+  auto const& min_str = static_cast<cudf::string_scalar const&>(*results[1][0]);
+  EXPECT_EQ(min_str.to_string(), "a");
+}
+
+TEST_F(BatchedReduceTest, EmptyAndAllNullColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const empty{};
+  cudf::test::fixed_width_column_wrapper<int32_t> const all_null({1, 2, 3},
+                                                                 cudf::test::iterators::all_nulls());
+
+  std::vector<std::vector<std::unique_ptr<cudf::reduce_aggregation>>> aggregations;
+  aggregations.push_back({});
+  aggregations[0].push_back(cudf::make_sum_aggregation<cudf::reduce_aggregation>());
+  aggregations.push_back({});
+  aggregations[1].push_back(cudf::make_max_aggregation<cudf::reduce_aggregation>());
+
+  auto const results = cudf::batched_reduce(cudf::table_view{{empty, all_null}}, aggregations);
+  EXPECT_FALSE(results[0][0]->is_valid());
+  EXPECT_FALSE(results[1][0]->is_valid());
+}
+
+TEST_F(BatchedReduceTest, InvalidInputs)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const col{1, 2, 3};
+  std::vector<std::vector<std::unique_ptr<cudf::reduce_aggregation>>> aggregations;
+  aggregations.push_back({});
+  aggregations[0].push_back(cudf::make_sum_aggregation<cudf::reduce_aggregation>());
+
+  // one aggregation list per column is required
+  EXPECT_THROW(cudf::batched_reduce(cudf::table_view{{col, col}}, aggregations),
+               std::invalid_argument);
+}
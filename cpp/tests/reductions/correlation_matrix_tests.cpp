@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/reduction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Copies the result matrix to host as column-major doubles
+std::vector<double> to_host_matrix(cudf::table const& result)
+{
+  std::vector<double> matrix;
+  for (auto const& col : result.view()) {
+    auto const host_data = cudf::test::to_host<double>(col).first;
+    matrix.insert(matrix.end(), host_data.begin(), host_data.end());
+  }
+  return matrix;
+}
+
+}  // namespace
+
+struct CorrelationMatrixTest : public cudf::test::BaseFixture {};
+
+TEST_F(CorrelationMatrixTest, PerfectCorrelations)
+{
+  auto const x = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3, 4};
+  auto const y = cudf::test::fixed_width_column_wrapper<double>{2, 4, 6, 8};
+  auto const z = cudf::test::fixed_width_column_wrapper<double>{4, 3, 2, 1};
+
+  auto const result = cudf::correlation_matrix(cudf::table_view{{x, y, z}});
+  ASSERT_EQ(result->num_columns(), 3);
+  ASSERT_EQ(result->num_rows(), 3);
+
+  auto const matrix = to_host_matrix(*result);
+  // y is a positive and z a negative linear function of x
+  std::vector<double> const expected{1, 1, -1, 1, 1, -1, -1, -1, 1};
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(matrix[i], expected[i], 1e-10);
+  }
+}
+
+TEST_F(CorrelationMatrixTest, KnownCoefficient)
+{
+  auto const x = cudf::test::fixed_width_column_wrapper<double>{1, 2, 3, 4, 5};
+  auto const y = cudf::test::fixed_width_column_wrapper<double>{2, 1, 4, 3, 5};
+
+  auto const result = cudf::correlation_matrix(cudf::table_view{{x, y}});
+  auto const matrix = to_host_matrix(*result);
+
+  // Pearson r of {1..5} and {2,1,4,3,5} is 0.8
+  EXPECT_NEAR(matrix[0], 1.0, 1e-10);
+  EXPECT_NEAR(matrix[1], 0.8, 1e-10);
+  EXPECT_NEAR(matrix[2], 0.8, 1e-10);
+  EXPECT_NEAR(matrix[3], 1.0, 1e-10);
+}
+
+TEST_F(CorrelationMatrixTest, ZeroVarianceIsNaN)
+{
+  auto const x        = cudf::test::fixed_width_column_wrapper<double>{1, 2, 3};
+  auto const constant = cudf::test::fixed_width_column_wrapper<double>{7, 7, 7};
+
+  auto const result = cudf::correlation_matrix(cudf::table_view{{x, constant}});
+  auto const matrix = to_host_matrix(*result);
+
+  EXPECT_NEAR(matrix[0], 1.0, 1e-10);
+  EXPECT_TRUE(std::isnan(matrix[1]));
+  EXPECT_TRUE(std::isnan(matrix[2]));
+  EXPECT_TRUE(std::isnan(matrix[3]));
+}
+
+TEST_F(CorrelationMatrixTest, TooFewRowsIsNaN)
+{
+  auto const x = cudf::test::fixed_width_column_wrapper<double>{1};
+  auto const y = cudf::test::fixed_width_column_wrapper<double>{2};
+
+  auto const result = cudf::correlation_matrix(cudf::table_view{{x, y}});
+  auto const matrix = to_host_matrix(*result);
+  for (auto const value : matrix) {
+    EXPECT_TRUE(std::isnan(value));
+  }
+}
+
+TEST_F(CorrelationMatrixTest, EmptyTable)
+{
+  auto const result = cudf::correlation_matrix(cudf::table_view{});
+  EXPECT_EQ(result->num_columns(), 0);
+}
+
+TEST_F(CorrelationMatrixTest, InvalidInputs)
+{
+  auto const numbers = cudf::test::fixed_width_column_wrapper<double>{1, 2, 3};
+  auto const strings = cudf::test::strings_column_wrapper{"a", "b", "c"};
+  EXPECT_THROW(cudf::correlation_matrix(cudf::table_view{{numbers, strings}}),
+               cudf::data_type_error);
+
+  auto const with_nulls = cudf::test::fixed_width_column_wrapper<double>{{1, 2, 3}, {1, 0, 1}};
+  EXPECT_THROW(cudf::correlation_matrix(cudf::table_view{{numbers, with_nulls}}),
+               cudf::logic_error);
+}
@@ -1514,6 +1514,45 @@ TYPED_TEST(ReductionTest, Quantile)
             expected_null_value1);
 }
 
+TYPED_TEST(ReductionTest, MedianQuantilePresorted)
+{
+  using T = TypeParam;
+  // ascending inputs with nulls last exercise the pre-sorted path that skips the internal sort
+  std::vector<int> int_values({0, 1, 2, 4, 6, 13, 45, 64});
+  std::vector<bool> host_bools({true, true, true, true, true, true, true, false});
+  std::vector<T> v = convert_values<T>(int_values);
+  cudf::interpolation interp{cudf::interpolation::LINEAR};
+
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  double expected_median = std::is_same_v<T, bool> ? 1.0 : 5.0;
+  EXPECT_EQ(
+    this->template reduction_test<double>(col, *cudf::make_median_aggregation<reduce_aggregation>())
+      .first,
+    expected_median);
+
+  double expected_value1 = std::is_same_v<T, bool> ? 1.0 : 64.0;
+  EXPECT_EQ(this
+              ->template reduction_test<double>(
+                col, *cudf::make_quantile_aggregation<reduce_aggregation>({1.0}, interp))
+              .first,
+            expected_value1);
+
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  double expected_null_median                         = std::is_same_v<T, bool> ? 1.0 : 4.0;
+  EXPECT_EQ(this
+              ->template reduction_test<double>(
+                col_nulls, *cudf::make_median_aggregation<reduce_aggregation>())
+              .first,
+            expected_null_median);
+
+  double expected_null_value1 = std::is_same_v<T, bool> ? 1.0 : 45.0;
+  EXPECT_EQ(this
+              ->template reduction_test<double>(
+                col_nulls, *cudf::make_quantile_aggregation<reduce_aggregation>({1.0}, interp))
+              .first,
+            expected_null_value1);
+}
+
 TYPED_TEST(ReductionTest, UniqueCount)
 {
   using T = TypeParam;
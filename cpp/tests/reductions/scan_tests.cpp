@@ -406,6 +406,43 @@ TYPED_TEST(ScanTest, LeadingNulls)
                   null_policy::INCLUDE);
 }
 
+TYPED_TEST(ScanTest, ScatteredNullsLargeInput)
+{
+  using HostType = typename TypeParam_to_host_type<TypeParam>::type;
+  if constexpr (not std::is_same_v<TypeParam, cudf::string_view>) {
+    // large enough to span many scan tiles, with nulls scattered throughout, so the fused
+    // null-aware pair scan is exercised beyond a single block
+    constexpr cudf::size_type num_rows = 8192;
+    thrust::host_vector<HostType> v(num_rows);
+    thrust::host_vector<bool> b(num_rows);
+    for (cudf::size_type i = 0; i < num_rows; ++i) {
+      v[i] = static_cast<HostType>(i % 17);
+      b[i] = i % 97 != 0;
+    }
+
+    this->scan_test(v,
+                    b,
+                    *cudf::make_min_aggregation<scan_aggregation>(),
+                    scan_type::INCLUSIVE,
+                    null_policy::INCLUDE);
+    this->scan_test(v,
+                    b,
+                    *cudf::make_max_aggregation<scan_aggregation>(),
+                    scan_type::INCLUSIVE,
+                    null_policy::INCLUDE);
+    this->scan_test(v,
+                    b,
+                    *cudf::make_min_aggregation<scan_aggregation>(),
+                    scan_type::EXCLUSIVE,
+                    null_policy::INCLUDE);
+    this->scan_test(v,
+                    b,
+                    *cudf::make_max_aggregation<scan_aggregation>(),
+                    scan_type::EXCLUSIVE,
+                    null_policy::INCLUDE);
+  }
+}
+
 class ScanStringsTest : public ScanTest<cudf::string_view> {};
 
 TEST_F(ScanStringsTest, MoreStringsMinMax)
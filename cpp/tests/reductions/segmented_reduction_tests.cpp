@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -781,6 +781,75 @@ TEST_F(SegmentedReductionTestUntyped, Mean)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
 }
 
+TEST_F(SegmentedReductionTestUntyped, SkewedSegmentSizes)
+{
+  // enough segments to trigger the size-binned strategy, with sizes alternating between one
+  // element and several hundred so both the warp bin and the cub bin are exercised
+  constexpr cudf::size_type num_segments = 1000;
+  constexpr cudf::size_type large_size   = 300;
+  std::vector<cudf::size_type> offsets{0};
+  std::vector<int64_t> expected_sums;
+  std::vector<int32_t> values;
+  for (cudf::size_type s = 0; s < num_segments; ++s) {
+    auto const size = (s % 2 == 0) ? 1 : large_size;
+    int64_t sum     = 0;
+    for (cudf::size_type i = 0; i < size; ++i) {
+      values.push_back(s % 17 + i % 5);
+      sum += values.back();
+    }
+    offsets.push_back(offsets.back() + size);
+    expected_sums.push_back(sum);
+  }
+
+  auto const input =
+    cudf::test::fixed_width_column_wrapper<int32_t>(values.begin(), values.end());
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    offsets, cudf::get_default_stream(), cudf::get_current_device_resource_ref());
+  auto const expected = cudf::test::fixed_width_column_wrapper<int64_t>(expected_sums.begin(),
+                                                                        expected_sums.end());
+
+  auto const agg    = cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>();
+  auto const result = cudf::segmented_reduce(input,
+                                             d_offsets,
+                                             *agg,
+                                             cudf::data_type{cudf::type_id::INT64},
+                                             cudf::null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+
+  // An initial value must be folded into each segment's result exactly once, also in the
+  // warp-per-segment bin where it is not the operator identity
+  auto const init_scalar = cudf::make_fixed_width_scalar<int32_t>(3);
+  std::vector<int64_t> expected_init_sums;
+  expected_init_sums.reserve(expected_sums.size());
+  for (auto const sum : expected_sums) {
+    expected_init_sums.push_back(sum + 3);
+  }
+  auto const expected_init = cudf::test::fixed_width_column_wrapper<int64_t>(
+    expected_init_sums.begin(), expected_init_sums.end());
+  auto const init_result = cudf::segmented_reduce(input,
+                                                  d_offsets,
+                                                  *agg,
+                                                  cudf::data_type{cudf::type_id::INT64},
+                                                  cudf::null_policy::EXCLUDE,
+                                                  *init_scalar);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*init_result, expected_init);
+
+  auto const max_agg = cudf::make_max_aggregation<cudf::segmented_reduce_aggregation>();
+  auto const max_result = cudf::segmented_reduce(input,
+                                                 d_offsets,
+                                                 *max_agg,
+                                                 cudf::data_type{cudf::type_id::INT32},
+                                                 cudf::null_policy::EXCLUDE);
+  std::vector<int32_t> expected_maxs;
+  for (cudf::size_type s = 0; s < num_segments; ++s) {
+    auto const size = (s % 2 == 0) ? 1 : large_size;
+    expected_maxs.push_back(s % 17 + (size > 4 ? 4 : 0));
+  }
+  auto const expected_max = cudf::test::fixed_width_column_wrapper<int32_t>(expected_maxs.begin(),
+                                                                            expected_maxs.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*max_result, expected_max);
+}
+
 TEST_F(SegmentedReductionTestUntyped, MeanNulls)
 {
   auto const input = cudf::test::fixed_width_column_wrapper<int32_t>(
@@ -604,6 +604,73 @@ TEST_F(ReplaceDictionaryTest, InputAndReplacementNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*decoded, expected);
 }
 
+struct ReplaceMapTest : public cudf::test::BaseFixture {};
+
+TEST_F(ReplaceMapTest, ReuseAcrossColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values_to_replace({8, 2, 6, 4});
+  cudf::test::fixed_width_column_wrapper<int32_t> replacement_values({6, 0, 4, 2});
+  auto const map = cudf::replacement_map(values_to_replace, replacement_values);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> input1({1, 2, 3, 4, 5, 6, 7, 8});
+  cudf::test::fixed_width_column_wrapper<int32_t> input2({7, 5, 6, 3, 1, 2, 8, 4},
+                                                         {1, 1, 1, 0, 0, 1, 1, 1});
+
+  auto const result1 = cudf::find_and_replace_all(input1, map);
+  auto const result2 = cudf::find_and_replace_all(input2, map);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected1({1, 0, 3, 2, 5, 4, 7, 6});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected2({7, 5, 4, 3, 1, 0, 6, 2},
+                                                            {1, 1, 1, 0, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result1, expected1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result2, expected2);
+}
+
+TEST_F(ReplaceMapTest, ReplacementNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> values_to_replace({2, 6});
+  cudf::test::fixed_width_column_wrapper<int64_t> replacement_values({0, 4}, {0, 1});
+  auto const map = cudf::replacement_map(values_to_replace, replacement_values);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> input({7, 5, 6, 3, 1, 2, 8, 4});
+  auto const result = cudf::find_and_replace_all(input, map);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected({7, 5, 4, 3, 1, 0, 8, 4},
+                                                           {1, 1, 1, 1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(ReplaceMapTest, Strings)
+{
+  cudf::test::strings_column_wrapper values_to_replace({"b", "d"});
+  cudf::test::strings_column_wrapper replacement_values({"e", "f"});
+  auto const map = cudf::replacement_map(values_to_replace, replacement_values);
+
+  cudf::test::strings_column_wrapper input({"a", "b", "c", "d", "b"});
+  auto const result = cudf::find_and_replace_all(input, map);
+
+  cudf::test::strings_column_wrapper expected({"a", "e", "c", "f", "e"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+}
+
+TEST_F(ReplaceMapTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values_to_replace({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> size_mismatch({10, 11});
+  EXPECT_THROW(cudf::replacement_map(values_to_replace, size_mismatch), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<float> type_mismatch({10, 11, 12});
+  EXPECT_THROW(cudf::replacement_map(values_to_replace, type_mismatch), cudf::data_type_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> old_with_nulls({1, 2, 3}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> replacement_values({10, 11, 12});
+  EXPECT_THROW(cudf::replacement_map(old_with_nulls, replacement_values), cudf::logic_error);
+
+  auto const map = cudf::replacement_map(values_to_replace, replacement_values);
+  cudf::test::fixed_width_column_wrapper<int64_t> input_mismatch({1, 2, 3});
+  EXPECT_THROW(cudf::find_and_replace_all(input_mismatch, map), cudf::data_type_error);
+}
+
 TEST_F(ReplaceDictionaryTest, EmptyReplacement)
 {
   cudf::test::fixed_width_column_wrapper<double> input_w(
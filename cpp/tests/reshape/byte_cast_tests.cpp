@@ -18,6 +18,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/reshape.hpp>
 
@@ -407,3 +408,35 @@ TEST_F(ByteCastTest, StringsAllNulls)
   EXPECT_EQ(out_child.size(), 0);
   EXPECT_EQ(out_child.type().id(), cudf::type_id::UINT8);
 }
+
+TEST_F(ByteCastTest, TableMatchesPerColumn)
+{
+  using limits = std::numeric_limits<int32_t>;
+  cudf::test::fixed_width_column_wrapper<int32_t> const int32_col(
+    {0, 100, -100, limits::min(), limits::max()});
+  cudf::test::fixed_width_column_wrapper<double> const fp64_col(
+    {0.0, 100.125, -100.125, -1.0, 1.0}, {1, 1, 0, 1, 1});
+  cudf::test::strings_column_wrapper const string_col({"ab", "", "cdef", "g", "hi"});
+  cudf::table_view const input{{int32_col, fp64_col, string_col}};
+
+  for (auto const configuration : {cudf::flip_endianness::NO, cudf::flip_endianness::YES}) {
+    auto const output = cudf::byte_cast(input, configuration);
+    EXPECT_EQ(output->num_columns(), input.num_columns());
+    for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+      auto const expected = cudf::byte_cast(input.column(i), configuration);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, output->view().column(i));
+    }
+  }
+}
+
+TEST_F(ByteCastTest, TableWithSlicedColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> const int64_col(
+    {-23456, 987234, 27834922, -17, 0, 42});
+  auto const sliced = cudf::split(int64_col, {2}).back();
+  cudf::table_view const input{{sliced}};
+
+  auto const output   = cudf::byte_cast(input, cudf::flip_endianness::YES);
+  auto const expected = cudf::byte_cast(sliced, cudf::flip_endianness::YES);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, output->view().column(0));
+}
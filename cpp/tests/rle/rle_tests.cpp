@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/rle/rle.hpp>
+
+struct RleTest : public cudf::test::BaseFixture {};
+
+TEST_F(RleTest, EncodeDecodeRoundTrip)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({5, 5, 5, 7, 7, 9, 9, 9, 9});
+
+  auto encoded = cudf::rle::encode(input);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_values({5, 7, 9});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_run_ends({3, 5, 9});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(encoded.values->view(), expected_values);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(encoded.run_ends->view(), expected_run_ends);
+
+  auto decoded = cudf::rle::decode(encoded.run_ends->view(), encoded.values->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), input);
+}
+
+TEST_F(RleTest, NullRuns)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> input({5, 5, 0, 0, 0, 9}, {1, 1, 0, 0, 0, 1});
+
+  auto encoded = cudf::rle::encode(input);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_values({5, 0, 9}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_run_ends({2, 5, 6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(encoded.values->view(), expected_values);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(encoded.run_ends->view(), expected_run_ends);
+
+  auto decoded = cudf::rle::decode(encoded.run_ends->view(), encoded.values->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), input);
+}
+
+TEST_F(RleTest, Strings)
+{
+  cudf::test::strings_column_wrapper input({"on", "on", "on", "off", "on", "on"});
+
+  auto encoded = cudf::rle::encode(input);
+
+  cudf::test::strings_column_wrapper expected_values({"on", "off", "on"});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_run_ends({3, 4, 6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(encoded.values->view(), expected_values);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(encoded.run_ends->view(), expected_run_ends);
+
+  auto decoded = cudf::rle::decode(encoded.run_ends->view(), encoded.values->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), input);
+}
+
+TEST_F(RleTest, GatherCompressed)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input({5, 5, 5, 7, 7, 9, 9, 9, 9});
+  auto encoded = cudf::rle::encode(input);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({8, 0, 3, 4, 2});
+  auto gathered =
+    cudf::rle::gather(encoded.run_ends->view(), encoded.values->view(), gather_map);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({9, 5, 7, 7, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(gathered->view(), expected);
+}
+
+TEST_F(RleTest, EmptyColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{};
+
+  auto encoded = cudf::rle::encode(input);
+  EXPECT_EQ(encoded.run_ends->size(), 0);
+  EXPECT_EQ(encoded.values->size(), 0);
+
+  auto decoded = cudf::rle::decode(encoded.run_ends->view(), encoded.values->view());
+  EXPECT_EQ(decoded->size(), 0);
+}
+
+TEST_F(RleTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> values({5, 7});
+  cudf::test::fixed_width_column_wrapper<int64_t> bad_run_ends({3, 5});
+  EXPECT_THROW(cudf::rle::decode(bad_run_ends, values), cudf::data_type_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> mismatched_run_ends({3, 5, 9});
+  EXPECT_THROW(cudf::rle::decode(mismatched_run_ends, values), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> run_ends({3, 5});
+  cudf::test::fixed_width_column_wrapper<int32_t> null_map({1, 0}, {1, 0});
+  EXPECT_THROW(cudf::rle::gather(run_ends, values, null_map), cudf::logic_error);
+}
@@ -666,6 +666,31 @@ TEST_F(GroupedRollingTestInts, SumLargeWindow)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
 }
 
+TEST_F(GroupedRollingTestInts, PrecomputedGroupBoundaries)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> input(
+    {5, 1, 4, 7, 2, 8, 6, 3, 9, 1, 2, 4}, {1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+  auto const key_cols = cudf::table_view{{keys}};
+
+  // the precomputed boundaries must yield the same results as the one-shot API,
+  // across multiple window shapes and aggregations on the same grouping
+  auto const grouping = cudf::rolling_grouping(key_cols);
+  for (auto const& [preceding, following, min_periods] :
+       {std::tuple{2, 1, 1}, std::tuple{3, 0, 2}}) {
+    for (auto const* agg_factory : {&cudf::make_sum_aggregation<cudf::rolling_aggregation>,
+                                    &cudf::make_min_aggregation<cudf::rolling_aggregation>}) {
+      auto const agg      = (*agg_factory)();
+      auto const result   = grouping.rolling_window(input, preceding, following, min_periods, *agg);
+      auto const expected = cudf::grouped_rolling_window(
+        key_cols, input, preceding, following, min_periods, *agg);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *result);
+    }
+  }
+
+  EXPECT_THROW(cudf::rolling_grouping(cudf::table_view{}), cudf::logic_error);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using GroupedRollingTestStrings = GroupedRollingTest<cudf::string_view>;
@@ -592,3 +592,34 @@ TYPED_TEST(TypedRangeRollingNullsTest, UnboundedFollowingWindowSingleGroupOrderB
                                  cudf::test::fixed_width_column_wrapper<cudf::size_type>{
                                    {9, 9, 9, 9, 5, 5, 4, 4, 3, 2}, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1}});
 }
+
+TEST_F(RangeRollingTest, PrecomputedRangeWindows)
+{
+  auto const grp_col = int_col{0, 0, 0, 0, 1, 1, 1, 1};
+  auto const oby_col = int_col{1, 2, 4, 7, 1, 2, 3, 9};
+  auto const agg_col = int_col{{1, 2, 3, 4, 5, 6, 7, 8}, {1, 1, 0, 1, 1, 1, 1, 1}};
+  auto const grouping_keys = cudf::table_view{std::vector<cudf::column_view>{grp_col}};
+  auto const preceding     = cudf::range_window_bounds::get(cudf::numeric_scalar<int32_t>{1, true});
+  auto const following     = cudf::range_window_bounds::get(cudf::numeric_scalar<int32_t>{1, true});
+
+  // the precomputed window bounds must yield the same results as the one-shot API,
+  // across multiple aggregations over the same grouping and order-by column
+  auto const windows = cudf::precomputed_range_windows(
+    grouping_keys, oby_col, cudf::order::ASCENDING, preceding, following);
+
+  for (auto const* agg_factory : {&cudf::make_sum_aggregation<cudf::rolling_aggregation>,
+                                  &cudf::make_min_aggregation<cudf::rolling_aggregation>,
+                                  &cudf::make_max_aggregation<cudf::rolling_aggregation>}) {
+    auto const agg      = (*agg_factory)();
+    auto const result   = windows.rolling_window(agg_col, 1, *agg);
+    auto const expected = cudf::grouped_range_rolling_window(
+      grouping_keys, oby_col, cudf::order::ASCENDING, agg_col, preceding, following, 1, *agg);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *result);
+  }
+
+  auto const short_col = int_col{1, 2, 3};
+  EXPECT_THROW(
+    windows.rolling_window(
+      short_col, 1, *cudf::make_sum_aggregation<cudf::rolling_aggregation>()),
+    cudf::logic_error);
+}
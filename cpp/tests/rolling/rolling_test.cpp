@@ -957,6 +957,59 @@ TEST_F(RollingtVarStdTestUntyped, SimpleStaticVarianceStdInfNaN)
 #undef XXX
 }
 
+// wide window over a non-nullable integral column, taking the sliding O(n) path
+TEST_F(RollingtVarStdTestUntyped, WideWindowVarianceStd)
+{
+  cudf::size_type const num_rows = 3000;
+  cudf::size_type const ddof = 1, min_periods = 1, preceding_window = 150, following_window = 50;
+
+  std::vector<int32_t> col_data(num_rows);
+  std::generate(col_data.begin(), col_data.end(), [i = 0]() mutable {
+    return (i++ % 97) * ((i % 3) - 1);
+  });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(col_data.begin(), col_data.end());
+
+  std::vector<double> expected_var(num_rows);
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    auto const start = std::max(i - preceding_window + 1, 0);
+    auto const end   = std::min(i + following_window, num_rows - 1);
+    auto const n     = end - start + 1;
+    __int128_t sum = 0, sum_sq = 0;
+    for (auto j = start; j <= end; ++j) {
+      sum += col_data[j];
+      sum_sq += static_cast<__int128_t>(col_data[j]) * col_data[j];
+    }
+    auto const moment = n * sum_sq - sum * sum;
+    expected_var[i] =
+      static_cast<double>(moment) / (static_cast<double>(n) * static_cast<double>(n - ddof));
+  }
+  std::vector<double> expected_std(expected_var.size());
+  std::transform(expected_var.begin(), expected_var.end(), expected_std.begin(), [](auto const& x) {
+    return std::sqrt(x);
+  });
+
+  cudf::test::fixed_width_column_wrapper<double> var_expect(expected_var.begin(),
+                                                            expected_var.end());
+  cudf::test::fixed_width_column_wrapper<double> std_expect(expected_std.begin(),
+                                                            expected_std.end());
+
+  auto const var_result = cudf::rolling_window(input,
+                                               preceding_window,
+                                               following_window,
+                                               min_periods,
+                                               dynamic_cast<cudf::rolling_aggregation const&>(
+                                                 *cudf::make_variance_aggregation(ddof)));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*var_result, var_expect);
+
+  auto const std_result = cudf::rolling_window(input,
+                                               preceding_window,
+                                               following_window,
+                                               min_periods,
+                                               dynamic_cast<cudf::rolling_aggregation const&>(
+                                                 *cudf::make_std_aggregation(ddof)));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*std_result, std_expect);
+}
+
 /*
 // negative sizes
 TYPED_TEST(RollingTest, NegativeWindowSizes)
@@ -1093,6 +1146,24 @@ TYPED_TEST(RollingTest, RandomStaticAllValid)
   this->run_test_col_agg(input, window, window, periods);
 }
 
+// random input data, wide asymmetric window taking the sliding O(n) path, no nulls
+TYPED_TEST(RollingTest, RandomStaticWideWindowAllValid)
+{
+  cudf::size_type num_rows = 5000;
+
+  // random input
+  std::vector<TypeParam> col_data(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  cudf::test::fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end());
+
+  std::vector<cudf::size_type> preceding_window({200});
+  std::vector<cudf::size_type> following_window({100});
+  cudf::size_type periods = 250;
+
+  this->run_test_col_agg(input, preceding_window, following_window, periods);
+}
+
 // random input data, static parameters, with nulls
 TYPED_TEST(RollingTest, RandomStaticWithInvalid)
 {
@@ -103,6 +103,46 @@ TEST_F(SearchTest, non_null_column__find_last)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, batched__find_first_and_last)
+{
+  using element_type = int64_t;
+
+  fixed_width_column_wrapper<element_type> column{10, 20, 30, 40, 50};
+  fixed_width_column_wrapper<element_type> values0{0, 7, 10, 11, 30};
+  fixed_width_column_wrapper<element_type> values1{32, 40, 47, 50, 90};
+  fixed_width_column_wrapper<element_type> values2{20};
+  fixed_width_column_wrapper<element_type> values3{};
+
+  auto const haystack = cudf::table_view{{column}};
+  auto const needles  = std::vector<cudf::table_view>{cudf::table_view{{values0}},
+                                                      cudf::table_view{{values1}},
+                                                      cudf::table_view{{values2}},
+                                                      cudf::table_view{{values3}}};
+
+  auto const lower = cudf::batched_lower_bound(
+    haystack, needles, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  ASSERT_EQ(lower.size(), needles.size());
+  for (std::size_t i = 0; i < needles.size(); ++i) {
+    auto const expect = cudf::lower_bound(
+      haystack, needles[i], {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower[i], *expect);
+  }
+
+  auto const upper = cudf::batched_upper_bound(
+    haystack, needles, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  ASSERT_EQ(upper.size(), needles.size());
+  for (std::size_t i = 0; i < needles.size(); ++i) {
+    auto const expect = cudf::upper_bound(
+      haystack, needles[i], {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper[i], *expect);
+  }
+
+  // empty batch
+  EXPECT_TRUE(cudf::batched_lower_bound(
+                haystack, {}, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE})
+                .empty());
+}
+
 TEST_F(SearchTest, non_null_column_desc__find_first)
 {
   using element_type = int64_t;
@@ -1757,6 +1797,47 @@ TEST_F(SearchTest, multi_contains_none_string_with_nulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, contains_index_reuse)
+{
+  using element_type = int64_t;
+
+  // unsorted haystack is sorted once at construction
+  fixed_width_column_wrapper<element_type> haystack{23, 0, 71, 1, 17, 29, 19};
+  cudf::contains_index index{haystack};
+
+  fixed_width_column_wrapper<element_type> needles0{17, 19, 45, 72};
+  fixed_width_column_wrapper<bool> expect0{1, 1, 0, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles0), expect0);
+
+  // the same index serves repeated queries
+  fixed_width_column_wrapper<element_type> needles1{{23, 3, 71, 2}, {1, 1, 1, 0}};
+  fixed_width_column_wrapper<bool> expect1{{1, 0, 1, 0}, {1, 1, 1, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles1), expect1);
+}
+
+TEST_F(SearchTest, contains_index_presorted_with_nulls)
+{
+  using element_type = int64_t;
+
+  // already ascending with the null last: construction skips the sort
+  fixed_width_column_wrapper<element_type> haystack{{0, 1, 19, 23, 29, 71, 0},
+                                                    {1, 1, 1, 1, 1, 1, 0}};
+  cudf::contains_index index{haystack};
+
+  fixed_width_column_wrapper<element_type> needles{{17, 23, 0, 72}, {1, 1, 0, 1}};
+  fixed_width_column_wrapper<bool> expect{{0, 1, 1, 0}, {1, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*index.contains(needles), expect);
+
+  // string haystacks work through the same generic comparator
+  std::vector<char const*> h_haystack{"19", "0", "71"};
+  std::vector<char const*> h_needles{"71", "7"};
+  cudf::test::strings_column_wrapper str_haystack(h_haystack.begin(), h_haystack.end());
+  cudf::test::strings_column_wrapper str_needles(h_needles.begin(), h_needles.end());
+  fixed_width_column_wrapper<bool> str_expect{1, 0};
+  cudf::contains_index str_index{str_haystack};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*str_index.contains(str_needles), str_expect);
+}
+
 TEST_F(SearchTest, multi_contains_empty_column)
 {
   using element_type = int64_t;
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/sorting.hpp>
+
+struct IncrementalRank : public cudf::test::BaseFixture {};
+
+TEST_F(IncrementalRank, AppendedBatchesMatchRankOfConcatenation)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> batch0{5, 1, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> batch1{4, 3, 2};
+
+  cudf::incremental_rank ranker{};
+  ranker.add_batch(batch0);
+  ranker.add_batch(batch1);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_sorted{1, 2, 3, 3, 4, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranker.sorted_keys(), expect_sorted);
+
+  auto const min_ranks =
+    ranker.ranks(cudf::rank_method::MIN, cudf::null_policy::INCLUDE, false);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_min{1, 2, 3, 3, 5, 6};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(min_ranks->view(), expect_min);
+
+  auto const pct_ranks =
+    ranker.ranks(cudf::rank_method::MAX, cudf::null_policy::INCLUDE, true);
+  cudf::test::fixed_width_column_wrapper<double> expect_pct{
+    1. / 6., 2. / 6., 4. / 6., 4. / 6., 5. / 6., 1.};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(pct_ranks->view(), expect_pct);
+}
+
+TEST_F(IncrementalRank, DescendingWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> batch0{{2, 5}, {true, true}};
+  cudf::test::fixed_width_column_wrapper<int32_t> batch1{{0, 4}, {false, true}};
+
+  cudf::incremental_rank ranker{cudf::order::DESCENDING, cudf::null_order::AFTER};
+  ranker.add_batch(batch0);
+  ranker.add_batch(batch1);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_sorted{{5, 4, 2, 0},
+                                                                {true, true, true, false}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranker.sorted_keys(), expect_sorted);
+
+  auto const ranks =
+    ranker.ranks(cudf::rank_method::FIRST, cudf::null_policy::INCLUDE, false);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_ranks{1, 2, 3, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranks->view(), expect_ranks);
+}
+
+TEST_F(IncrementalRank, ErrorCases)
+{
+  cudf::incremental_rank ranker{};
+  EXPECT_THROW(ranker.sorted_keys(), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> batch{1, 2};
+  ranker.add_batch(batch);
+  cudf::test::fixed_width_column_wrapper<double> mismatched{1.0};
+  EXPECT_THROW(ranker.add_batch(mismatched), cudf::logic_error);
+}
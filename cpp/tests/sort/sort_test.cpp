@@ -1098,6 +1098,40 @@ TEST_F(SortCornerTest, WithEmptyStructColumn)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected3, got3->view());
 };
 
+using SortString = Sort<cudf::string_view>;
+TEST_F(SortString, TiedPrefixes)
+{
+  // first eight bytes tie within several groups; ties must fall back to the full comparator
+  cudf::test::strings_column_wrapper input({"prefix-prefix-b",
+                                            "prefix-prefix-a",
+                                            "",
+                                            "short",
+                                            "prefix-prefix",
+                                            "shorty",
+                                            "prefix-prefix-aa"},
+                                           {true, true, true, true, true, true, true});
+  auto results = cudf::sorted_order(cudf::table_view({input}));
+  auto expected =
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>({2, 4, 1, 6, 0, 3, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+
+  auto descending =
+    cudf::sorted_order(cudf::table_view({input}), {cudf::order::DESCENDING});
+  auto expected_desc =
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>({5, 3, 0, 6, 1, 4, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(descending->view(), expected_desc);
+}
+
+TEST_F(SortString, TiedPrefixesWithNulls)
+{
+  cudf::test::strings_column_wrapper input({"same-long-prefix-1", "", "same-long-prefix-0", "x"},
+                                           {true, false, true, true});
+  auto results = cudf::sorted_order(
+    cudf::table_view({input}), {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+  auto expected = cudf::test::fixed_width_column_wrapper<cudf::size_type>({2, 0, 3, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
 using SortDouble = Sort<double>;
 TEST_F(SortDouble, InfinityAndNan)
 {
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+struct TopK : public cudf::test::BaseFixture {};
+
+TEST_F(TopK, SmallInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 8, 6, 5, 3, 8, 5}};
+  cudf::table_view input{{col}};
+
+  auto const ascending = cudf::top_k(input, 3);
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_asc{{3, 5, 5}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(ascending->view(), cudf::table_view{{expect_asc}});
+
+  auto const descending = cudf::top_k(input, 3, {cudf::order::DESCENDING});
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_desc{{8, 8, 6}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(descending->view(), cudf::table_view{{expect_desc}});
+}
+
+TEST_F(TopK, WithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{5, 8, 6, 5, 3, 8, 5},
+                                                      {true, true, false, true, true, false, true}};
+  cudf::table_view input{{col}};
+
+  auto const nulls_last =
+    cudf::top_k(input, 3, {cudf::order::ASCENDING}, {cudf::null_order::AFTER});
+  cudf::test::fixed_width_column_wrapper<int32_t> expect{{3, 5, 5}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(nulls_last->view(), cudf::table_view{{expect}});
+}
+
+TEST_F(TopK, KExceedsNumRows)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{2, 3, 1}};
+  cudf::table_view input{{col}};
+
+  auto const result = cudf::top_k(input, 10);
+  auto const expect = cudf::sort(input);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), expect->view());
+
+  auto const empty = cudf::top_k(input, 0);
+  EXPECT_EQ(empty->num_rows(), 0);
+}
+
+TEST_F(TopK, LargeInputMatchesSort)
+{
+  // Large enough to take the sampled-selection path rather than the full sort
+  auto values = std::vector<int32_t>(20000);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), std::default_random_engine{0});
+  cudf::test::fixed_width_column_wrapper<int32_t> col(values.begin(), values.end());
+  cudf::table_view input{{col}};
+
+  auto const k         = 100;
+  auto const result    = cudf::top_k(input, k, {cudf::order::DESCENDING});
+  auto const sorted    = cudf::sort(input, {cudf::order::DESCENDING});
+  auto const reference = cudf::slice(sorted->view(), {0, k}).front();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), reference);
+}
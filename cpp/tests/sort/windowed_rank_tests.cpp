@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+using strcol_wrapper = cudf::test::strings_column_wrapper;
+
+struct WindowedRankTest : public cudf::test::BaseFixture {};
+
+TEST_F(WindowedRankTest, AllMethodsOnePass)
+{
+  strcol_wrapper group_keys{{"a", "b", "a", "a", "b"}};
+  column_wrapper<int32_t> order_keys{{9, 5, 7, 7, 5}};
+
+  auto const [ranks, permutation] =
+    cudf::windowed_ranks(cudf::table_view{{group_keys}},
+                         cudf::table_view{{order_keys}},
+                         {cudf::rank_method::FIRST, cudf::rank_method::MIN, cudf::rank_method::DENSE});
+
+  ASSERT_EQ(ranks->num_columns(), 3);
+  column_wrapper<cudf::size_type> expected_first{{3, 1, 1, 2, 2}};
+  column_wrapper<cudf::size_type> expected_min{{3, 1, 1, 1, 1}};
+  column_wrapper<cudf::size_type> expected_dense{{2, 1, 1, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranks->get_column(0), expected_first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranks->get_column(1), expected_min);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranks->get_column(2), expected_dense);
+
+  // The permutation sorts by (group, order) with ties in input order
+  column_wrapper<cudf::size_type> expected_permutation{{2, 3, 0, 1, 4}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(permutation->view(), expected_permutation);
+}
+
+TEST_F(WindowedRankTest, NoGroupKeysDescending)
+{
+  column_wrapper<int32_t> order_keys{{5, 9, 5, 7}};
+
+  auto const [ranks, permutation] = cudf::windowed_ranks(cudf::table_view{},
+                                                         cudf::table_view{{order_keys}},
+                                                         {cudf::rank_method::FIRST},
+                                                         {cudf::order::DESCENDING});
+
+  column_wrapper<cudf::size_type> expected_first{{3, 1, 4, 2}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranks->get_column(0), expected_first);
+}
+
+TEST_F(WindowedRankTest, DedupByLatest)
+{
+  // The dedup-by-latest pattern: rank descending by timestamp within each key and keep rank 1
+  column_wrapper<int32_t> keys{{1, 2, 1, 2, 1}};
+  column_wrapper<int32_t> timestamps{{10, 20, 30, 5, 20}};
+
+  auto const [ranks, permutation] = cudf::windowed_ranks(cudf::table_view{{keys}},
+                                                         cudf::table_view{{timestamps}},
+                                                         {cudf::rank_method::FIRST},
+                                                         {cudf::order::DESCENDING});
+
+  column_wrapper<cudf::size_type> expected_first{{3, 1, 1, 2, 2}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(ranks->get_column(0), expected_first);
+}
+
+TEST_F(WindowedRankTest, EmptyAndErrors)
+{
+  column_wrapper<int32_t> empty{};
+  auto const [ranks, permutation] = cudf::windowed_ranks(
+    cudf::table_view{}, cudf::table_view{{empty}}, {cudf::rank_method::DENSE});
+  EXPECT_EQ(ranks->num_rows(), 0);
+  EXPECT_EQ(permutation->size(), 0);
+
+  column_wrapper<int32_t> order_keys{{1, 2}};
+  // No order keys
+  EXPECT_THROW(cudf::windowed_ranks(cudf::table_view{}, cudf::table_view{}, {cudf::rank_method::FIRST}),
+               cudf::logic_error);
+  // No methods
+  EXPECT_THROW(cudf::windowed_ranks(cudf::table_view{}, cudf::table_view{{order_keys}}, {}),
+               cudf::logic_error);
+  // Unsupported method
+  EXPECT_THROW(cudf::windowed_ranks(
+                 cudf::table_view{}, cudf::table_view{{order_keys}}, {cudf::rank_method::AVERAGE}),
+               cudf::logic_error);
+}
@@ -371,4 +371,42 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, SelectivityHint)
+{
+  constexpr cudf::size_type num_rows{10000};
+  auto value_iter = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(value_iter, value_iter + num_rows);
+  cudf::test::fixed_width_column_wrapper<double> col2(value_iter, value_iter + num_rows);
+  cudf::table_view input{{col1, col2}};
+  auto mask_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 == 0; });
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask(mask_iter, mask_iter + num_rows);
+
+  auto expected = cudf::apply_boolean_mask(input, boolean_mask);
+
+  // an accurate hint, an overestimate, and an underestimate (which forces the
+  // first column's pass to be retried with an exact allocation) all yield the
+  // same result as the unhinted API
+  for (auto hint : {0.34, 0.9, 0.1}) {
+    auto got = cudf::apply_boolean_mask(input, boolean_mask, hint);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+  }
+
+  EXPECT_THROW(cudf::apply_boolean_mask(input, boolean_mask, 0.0), std::invalid_argument);
+  EXPECT_THROW(cudf::apply_boolean_mask(input, boolean_mask, 1.5), std::invalid_argument);
+}
+
+TEST_F(ApplyBooleanMask, SelectivityHintWithNulls)
+{
+  // nullable inputs take the generic path; the hint must not change the result
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::table_view input{{col}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, true},
+                                                            {1, 1, 1, 1, 1, 0}};
+
+  auto expected = cudf::apply_boolean_mask(input, boolean_mask);
+  auto got      = cudf::apply_boolean_mask(input, boolean_mask, 0.5);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/detail/iterator.cuh>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cmath>
+#include <vector>
+
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+struct ApproxDistinctCount : public cudf::test::BaseFixture {};
+
+TEST_F(ApproxDistinctCount, EstimateAccuracy)
+{
+  constexpr cudf::size_type num_rows{100'000};
+  constexpr int32_t num_distinct{10'000};
+  auto value_iter = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % num_distinct); });
+  auto const col = int32s_col(value_iter, value_iter + num_rows);
+  auto const input = cudf::table_view{{col}};
+
+  auto const estimate = cudf::approx_distinct_count(input, 11);
+
+  // precision 11 gives a relative standard error of ~2.3%; allow 5 sigma
+  EXPECT_NEAR(estimate, static_cast<double>(num_distinct), 0.115 * num_distinct);
+}
+
+TEST_F(ApproxDistinctCount, SketchMerge)
+{
+  constexpr cudf::size_type num_rows{50'000};
+  auto iter1 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 20'000); });
+  auto iter2 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(10'000 + i % 20'000); });
+  auto const col1 = int32s_col(iter1, iter1 + num_rows);
+  auto const col2 = int32s_col(iter2, iter2 + num_rows);
+
+  auto const sketch1 = cudf::hyperloglog_sketch(cudf::table_view{{col1}}, 12);
+  auto const sketch2 = cudf::hyperloglog_sketch(cudf::table_view{{col2}}, 12);
+
+  // merging the two partial sketches must be identical to sketching the union
+  auto const merged = cudf::merge_hyperloglog_sketches(
+    std::vector<cudf::column_view>{sketch1->view(), sketch2->view()});
+  auto const estimate = cudf::approx_distinct_count(merged->view());
+
+  // the union covers values [0, 30000)
+  EXPECT_NEAR(estimate, 30'000.0, 0.082 * 30'000);
+
+  // merging a sketch with itself changes nothing
+  auto const self_merged = cudf::merge_hyperloglog_sketches(
+    std::vector<cudf::column_view>{sketch1->view(), sketch1->view()});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sketch1->view(), self_merged->view());
+}
+
+TEST_F(ApproxDistinctCount, EmptyAndSmallInputs)
+{
+  auto const empty = int32s_col{};
+  EXPECT_EQ(cudf::approx_distinct_count(cudf::table_view{{empty}}), 0.0);
+
+  // the small-range (linear counting) regime is exact for tiny cardinalities
+  auto const small = int32s_col{1, 2, 3, 1, 2, 3};
+  auto const estimate = cudf::approx_distinct_count(cudf::table_view{{small}});
+  EXPECT_NEAR(estimate, 3.0, 0.5);
+}
+
+TEST_F(ApproxDistinctCount, InvalidInputs)
+{
+  auto const col = int32s_col{1, 2, 3};
+  EXPECT_THROW(cudf::approx_distinct_count(cudf::table_view{{col}}, 3), std::invalid_argument);
+  EXPECT_THROW(cudf::approx_distinct_count(cudf::table_view{{col}}, 19), std::invalid_argument);
+
+  // a non-UINT8 column is not a sketch
+  EXPECT_THROW(cudf::approx_distinct_count(static_cast<cudf::column_view>(col)),
+               cudf::data_type_error);
+
+  // mismatched precisions cannot merge
+  auto const sketch_a = cudf::hyperloglog_sketch(cudf::table_view{{col}}, 10);
+  auto const sketch_b = cudf::hyperloglog_sketch(cudf::table_view{{col}}, 11);
+  EXPECT_THROW(cudf::merge_hyperloglog_sketches(
+                 std::vector<cudf::column_view>{sketch_a->view(), sketch_b->view()}),
+               cudf::logic_error);
+}
@@ -1409,3 +1409,74 @@ TEST_F(DistinctKeepAny, SlicedStructsOfLists)
   auto const result_sort = cudf::sort_by_key(*result, result->select({0}));
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_sort, *result_sort);
 }
+
+struct StreamingDistinct : public cudf::test::BaseFixture {};
+
+TEST_F(StreamingDistinct, BatchesAgainstHistory)
+{
+  auto filter = cudf::streaming_distinct{std::vector<cudf::size_type>{0}};
+  EXPECT_EQ(filter.distinct_count(), 0);
+
+  // Batch 1: duplicates within the batch are reduced to one occurrence.
+  auto const keys1 = int32s_col{1, 1, 2, 3};
+  auto const vals1 = int32s_col{10, 11, 20, 30};
+  auto const out1  = filter.insert(cudf::table_view{{keys1, vals1}});
+  {
+    auto const sorted = cudf::sort_by_key(*out1, out1->select({0}));
+    auto const expected_keys = int32s_col{1, 2, 3};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, sorted->view().column(0));
+  }
+  EXPECT_EQ(filter.distinct_count(), 3);
+
+  // Batch 2: keys already emitted by batch 1 are filtered out.
+  auto const keys2 = int32s_col{2, 3, 4, 4};
+  auto const vals2 = int32s_col{21, 31, 40, 41};
+  auto const out2  = filter.insert(cudf::table_view{{keys2, vals2}});
+  {
+    auto const expected_keys = int32s_col{4};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, out2->view().column(0));
+  }
+  EXPECT_EQ(filter.distinct_count(), 4);
+
+  // Batch 3: nothing new.
+  auto const keys3 = int32s_col{1, 2, 3, 4};
+  auto const vals3 = int32s_col{12, 22, 32, 42};
+  auto const out3  = filter.insert(cudf::table_view{{keys3, vals3}});
+  EXPECT_EQ(out3->num_rows(), 0);
+  EXPECT_EQ(filter.distinct_count(), 4);
+}
+
+TEST_F(StreamingDistinct, NullKeys)
+{
+  // With NULL_EQUAL (the default), a null key is emitted by the first batch that
+  // contains it and filtered from all subsequent batches.
+  auto filter = cudf::streaming_distinct{std::vector<cudf::size_type>{0}};
+
+  auto const keys1 = int32s_col{{1, null, 2}, null_at(1)};
+  auto const out1  = filter.insert(cudf::table_view{{keys1}});
+  EXPECT_EQ(out1->num_rows(), 3);
+
+  auto const keys2 = int32s_col{{null, 2, 3}, null_at(0)};
+  auto const out2  = filter.insert(cudf::table_view{{keys2}});
+  {
+    auto const expected_keys = int32s_col{3};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, out2->view().column(0));
+  }
+  EXPECT_EQ(filter.distinct_count(), 4);
+}
+
+TEST_F(StreamingDistinct, EmptyAndInvalidInputs)
+{
+  EXPECT_THROW(cudf::streaming_distinct{std::vector<cudf::size_type>{}}, std::invalid_argument);
+
+  auto filter = cudf::streaming_distinct{std::vector<cudf::size_type>{0}};
+
+  auto const empty_keys = int32s_col{};
+  auto const out        = filter.insert(cudf::table_view{{empty_keys}});
+  EXPECT_EQ(out->num_rows(), 0);
+  EXPECT_EQ(filter.distinct_count(), 0);
+
+  auto bad_filter = cudf::streaming_distinct{std::vector<cudf::size_type>{5}};
+  auto const keys = int32s_col{1, 2};
+  EXPECT_THROW(bad_filter.insert(cudf::table_view{{keys}}), std::out_of_range);
+}
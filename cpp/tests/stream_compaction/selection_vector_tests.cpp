@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+struct SelectionVectorTest : public cudf::test::BaseFixture {};
+
+TEST_F(SelectionVectorTest, NonNullBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{
+    {true, false, true, false, true, false}};
+
+  auto selection = cudf::make_selection_vector(boolean_mask);
+  EXPECT_EQ(selection.source_size(), 6);
+  EXPECT_EQ(selection.num_selected(), 3);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_indices{{0, 2, 4}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(selection.indices(), expected_indices);
+}
+
+TEST_F(SelectionVectorTest, NullBooleanMask)
+{
+  // null mask entries do not select, matching apply_boolean_mask
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, true, true, false, true, true},
+                                                            {1, 0, 1, 1, 1, 0}};
+
+  auto selection = cudf::make_selection_vector(boolean_mask);
+  EXPECT_EQ(selection.num_selected(), 3);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_indices{{0, 2, 4}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(selection.indices(), expected_indices);
+}
+
+TEST_F(SelectionVectorTest, ApplyMatchesBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::fixed_width_column_wrapper<double> col2{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper col3({"a", "b", "c", "d", "e", "f"});
+  cudf::table_view input{{col1, col2, col3}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true, false, true, true},
+                                                            {1, 1, 1, 1, 1, 0}};
+
+  auto selection = cudf::make_selection_vector(boolean_mask);
+  auto got       = cudf::apply_selection_vector(input, selection);
+  auto expected  = cudf::apply_boolean_mask(input, boolean_mask);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(SelectionVectorTest, ApplyToMultipleTables)
+{
+  // one mask compaction applied to several tables with the same row count
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4}};
+  cudf::test::fixed_width_column_wrapper<int64_t> col2{{5, 6, 7, 8}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{false, true, true, false}};
+
+  auto selection = cudf::make_selection_vector(boolean_mask);
+  auto got1      = cudf::apply_selection_vector(cudf::table_view{{col1}}, selection);
+  auto got2      = cudf::apply_selection_vector(cudf::table_view{{col2}}, selection);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected1{{2, 3}};
+  cudf::test::fixed_width_column_wrapper<int64_t> expected2{{6, 7}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(got1->view().column(0), expected1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(got2->view().column(0), expected2);
+}
+
+TEST_F(SelectionVectorTest, EmptyAndErrors)
+{
+  cudf::test::fixed_width_column_wrapper<bool> empty_mask{};
+  auto selection = cudf::make_selection_vector(empty_mask);
+  EXPECT_EQ(selection.source_size(), 0);
+  EXPECT_EQ(selection.num_selected(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_col{};
+  auto got = cudf::apply_selection_vector(cudf::table_view{{empty_col}}, selection);
+  EXPECT_EQ(got->num_rows(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> not_a_mask{{1, 2, 3}};
+  EXPECT_THROW(cudf::make_selection_vector(not_a_mask), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<bool> mask{{true, false, true}};
+  cudf::test::fixed_width_column_wrapper<int32_t> wrong_size{{1, 2, 3, 4}};
+  auto sel3 = cudf::make_selection_vector(mask);
+  EXPECT_THROW(cudf::apply_selection_vector(cudf::table_view{{wrong_size}}, sel3),
+               cudf::logic_error);
+}
@@ -18,9 +18,12 @@
 #include <cudf_test/default_stream.hpp>
 
 #include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/utilities/stream_pool.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <thread>
+
 class StreamPoolTest : public cudf::test::BaseFixture {};
 
 CUDF_KERNEL void do_nothing_kernel() {}
@@ -32,3 +35,39 @@ TEST_F(StreamPoolTest, ForkStreams)
     do_nothing_kernel<<<1, 32, 0, stream.value()>>>();
   }
 }
+
+TEST_F(StreamPoolTest, PublicForkJoin)
+{
+  auto const stream = cudf::test::get_default_stream();
+  auto streams      = cudf::fork_streams(stream, 2);
+  for (auto& strm : streams) {
+    do_nothing_kernel<<<1, 32, 0, strm.value()>>>();
+  }
+  cudf::join_streams(streams, stream);
+  EXPECT_GE(cudf::get_stream_pool_size(), 1ul);
+}
+
+TEST_F(StreamPoolTest, ThreadAffinity)
+{
+  auto& pool = cudf::detail::global_cuda_stream_pool();
+
+  // a thread gets the same set of streams across calls
+  auto const streams       = pool.get_streams(2);
+  auto const streams_again = pool.get_streams(2);
+  ASSERT_EQ(streams.size(), streams_again.size());
+  for (std::size_t i = 0; i < streams.size(); ++i) {
+    EXPECT_EQ(streams[i].value(), streams_again[i].value());
+  }
+
+  // with the debug stream pool all threads share the default stream
+  if (pool.get_stream_pool_size() == 1) { return; }
+
+  // a different thread gets its own set of streams
+  std::vector<rmm::cuda_stream_view> other_streams;
+  std::thread([&] { other_streams = pool.get_streams(2); }).join();
+  for (auto const& strm : streams) {
+    for (auto const& other : other_streams) {
+      EXPECT_NE(strm.value(), other.value());
+    }
+  }
+}
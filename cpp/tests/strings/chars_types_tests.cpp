@@ -21,10 +21,12 @@
 #include <cudf/column/column.hpp>
 #include <cudf/strings/char_types/char_types.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/strings/utilities.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
 #include <array>
+#include <string>
 #include <vector>
 
 struct StringsCharsTest : public cudf::test::BaseFixture {};
@@ -381,3 +383,28 @@ TEST_F(StringsCharsTest, EmptyStringsColumn)
   EXPECT_EQ(cudf::type_id::STRING, results->view().type().id());
   EXPECT_EQ(0, results->view().size());
 }
+
+TEST_F(StringsCharsTest, IsValidUtf8)
+{
+  cudf::test::strings_column_wrapper valid({"abcdef",
+                                            "",
+                                            "caf\xC3\xA9",
+                                            "\xE2\x82\xAC 12",
+                                            "\xF0\x9F\x98\x80",
+                                            "null row"},
+                                           {true, true, true, true, true, false});
+  EXPECT_TRUE(cudf::strings::is_valid_utf8(cudf::strings_column_view(valid)));
+
+  auto const invalid = std::vector<std::string>{
+    "\x80rest",           // lone continuation byte
+    "\xE2\x82",           // truncated character
+    "\xC0\xAF",           // overlong encoding
+    "\xED\xA0\x80",       // surrogate code point
+    "\xF4\x90\x80\x80",   // above U+10FFFF
+    "abc\xFFxyz"          // invalid lead byte
+  };
+  for (auto const& chars : invalid) {
+    cudf::test::strings_column_wrapper input({"valid", chars});
+    EXPECT_FALSE(cudf::strings::is_valid_utf8(cudf::strings_column_view(input)));
+  }
+}
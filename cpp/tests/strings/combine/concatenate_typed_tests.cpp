@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/combine.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <thrust/iterator/transform_iterator.h>
+
+struct StringsConcatenateTypedTest : public cudf::test::BaseFixture {};
+
+TEST_F(StringsConcatenateTypedTest, MixedTypes)
+{
+  cudf::test::strings_column_wrapper strings({"id:1", "id:2", "id:3", "id:4"});
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({10, -20, 0, 12345});
+  cudf::test::fixed_width_column_wrapper<double> floats({1.5, -2.25, 0.0, 100.0});
+  cudf::test::fixed_width_column_wrapper<bool> bools({true, false, true, false});
+
+  cudf::table_view input({strings, ints, floats, bools});
+
+  cudf::test::strings_column_wrapper expected({"id:1@10@1.5@true",
+                                               "id:2@-20@-2.25@false",
+                                               "id:3@0@0.0@true",
+                                               "id:4@12345@100.0@false"});
+
+  auto results = cudf::strings::concatenate_typed(input, cudf::string_scalar("@"));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsConcatenateTypedTest, FixedPoint)
+{
+  cudf::test::strings_column_wrapper strings({"a", "b", "c"});
+  cudf::test::fixed_point_column_wrapper<int32_t> decimals({1234, -100, 0},
+                                                           numeric::scale_type{-2});
+
+  cudf::table_view input({strings, decimals});
+
+  cudf::test::strings_column_wrapper expected({"a:12.34", "b:-1.00", "c:0.00"});
+
+  auto results = cudf::strings::concatenate_typed(input, cudf::string_scalar(":"));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsConcatenateTypedTest, WithNulls)
+{
+  std::vector<char const*> h_strings{"aa", "bb", nullptr, "dd"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  cudf::test::fixed_width_column_wrapper<int64_t> ints({100, 200, 300, 400}, {true, false, true, true});
+
+  cudf::table_view input({strings, ints});
+
+  {
+    std::vector<char const*> h_expected{"aa:100", nullptr, nullptr, "dd:400"};
+    cudf::test::strings_column_wrapper expected(
+      h_expected.begin(),
+      h_expected.end(),
+      thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+
+    auto results = cudf::strings::concatenate_typed(input, cudf::string_scalar(":"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper expected({"aa:100", "bb:_", "_:300", "dd:400"});
+
+    auto results = cudf::strings::concatenate_typed(
+      input, cudf::string_scalar(":"), cudf::string_scalar("_"));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper expected({"aa:100", "bb", "300", "dd:400"});
+
+    auto results = cudf::strings::concatenate_typed(input,
+                                                    cudf::string_scalar(":"),
+                                                    cudf::string_scalar(""),
+                                                    cudf::strings::separator_on_nulls::NO);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
+TEST_F(StringsConcatenateTypedTest, EmptyAndErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_ints{};
+  cudf::test::strings_column_wrapper empty_strings{};
+  auto results =
+    cudf::strings::concatenate_typed(cudf::table_view({empty_strings, empty_ints}));
+  EXPECT_EQ(results->size(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3});
+  EXPECT_THROW(cudf::strings::concatenate_typed(cudf::table_view({ints})), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings({"a", "b", "c"});
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep> timestamps(
+    {100, 200, 300});
+  EXPECT_THROW(cudf::strings::concatenate_typed(cudf::table_view({strings, timestamps})),
+               cudf::data_type_error);
+}
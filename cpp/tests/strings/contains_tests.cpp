@@ -903,3 +903,49 @@ TEST_F(StringsContainsTests, ExtraLargeRegex)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
   }
 }
+
+TEST_F(StringsContainsTests, LiteralPatterns)
+{
+  // literal-ish patterns run through the compiled DFA; anchored and
+  // word-boundary patterns fall back to the NFA executor
+  cudf::test::strings_column_wrapper input(
+    {"ERROR: disk full", "WARN: retrying", "error in line 2", "errors: 0", "", "ERR"});
+  auto sv = cudf::strings_column_view(input);
+
+  {
+    auto prog    = cudf::strings::regex_program::create("ERROR");
+    auto results = cudf::strings::contains_re(sv, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto prog    = cudf::strings::regex_program::create("[Ee]rror");
+    auto results = cudf::strings::contains_re(sv, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected({0, 0, 1, 1, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto prog    = cudf::strings::regex_program::create("(ERROR|WARN): .*");
+    auto results = cudf::strings::contains_re(sv, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto prog    = cudf::strings::regex_program::create("^ERR");
+    auto results = cudf::strings::contains_re(sv, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto prog    = cudf::strings::regex_program::create(R"(full\Z)");
+    auto results = cudf::strings::contains_re(sv, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    auto prog    = cudf::strings::regex_program::create("ERR");
+    auto results = cudf::strings::matches_re(sv, *prog);
+    cudf::test::fixed_width_column_wrapper<bool> expected({1, 0, 0, 0, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
@@ -56,6 +56,47 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, FindMultipleManyTargets)
+{
+  // enough targets to engage the single-pass automaton path
+  std::vector<char const*> h_strings{"ababcd xyz", "Héllo é", nullptr, ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  std::vector<char const*> h_targets{"ab",
+                                     "abc",
+                                     "bc",
+                                     "cd",
+                                     "d",
+                                     "xyz",
+                                     "é",
+                                     "Hél",
+                                     "",
+                                     "q1",
+                                     "q2",
+                                     "q3",
+                                     "q4",
+                                     "q5",
+                                     "q6",
+                                     "q7",
+                                     "q8"};
+  cudf::test::strings_column_wrapper targets(h_targets.begin(), h_targets.end());
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::find_multiple(strings_view, targets_view);
+
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  LCW expected({LCW{0, 2, 3, 4, 5, 7, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1},
+                LCW{-1, -1, -1, -1, -1, -1, 1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1},
+                LCW{-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+                LCW{-1, -1, -1, -1, -1, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, -1, -1}});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/strings/intern_pool.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+struct InternPoolTest : public cudf::test::BaseFixture {};
+
+TEST_F(InternPoolTest, StableIdsAcrossBatches)
+{
+  auto pool = cudf::strings::intern_pool{};
+
+  cudf::test::strings_column_wrapper batch1({"web", "api", "web", "db"});
+  auto const ids1 = pool.intern(cudf::strings_column_view(batch1));
+  EXPECT_EQ(pool.num_keys(), 3);
+
+  // Repeated strings keep their ids; only the novel string grows the pool
+  cudf::test::strings_column_wrapper batch2({"db", "cache", "web"});
+  auto const ids2 = pool.intern(cudf::strings_column_view(batch2));
+  EXPECT_EQ(pool.num_keys(), 4);
+
+  // Round-tripping through decode recovers the original strings of both batches
+  auto const decoded1 = pool.decode(ids1->view());
+  auto const decoded2 = pool.decode(ids2->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded1->view(), batch1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded2->view(), batch2);
+
+  // The same string interns to the same id in both batches
+  auto const host_ids1 = cudf::test::to_host<int32_t>(ids1->view()).first;
+  auto const host_ids2 = cudf::test::to_host<int32_t>(ids2->view()).first;
+  EXPECT_EQ(host_ids1[0], host_ids2[2]);  // "web"
+  EXPECT_EQ(host_ids1[3], host_ids2[0]);  // "db"
+}
+
+TEST_F(InternPoolTest, Nulls)
+{
+  auto pool = cudf::strings::intern_pool{};
+
+  cudf::test::strings_column_wrapper input({"a", "", "b", ""}, {true, false, true, false});
+  auto const ids = pool.intern(cudf::strings_column_view(input));
+  EXPECT_EQ(pool.num_keys(), 2);
+  EXPECT_EQ(ids->null_count(), 2);
+
+  auto const decoded = pool.decode(ids->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), input);
+}
+
+TEST_F(InternPoolTest, EmptyAndErrors)
+{
+  auto pool = cudf::strings::intern_pool{};
+
+  cudf::test::strings_column_wrapper empty{};
+  auto const ids = pool.intern(cudf::strings_column_view(empty));
+  EXPECT_EQ(ids->size(), 0);
+  EXPECT_EQ(pool.num_keys(), 0);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> bad_ids({0, 1});
+  EXPECT_THROW(pool.decode(bad_ids), cudf::data_type_error);
+}
@@ -987,6 +987,50 @@ TEST_F(StringsSplitTest, PartitionZeroSizeStringsColumns)
   EXPECT_TRUE(results->num_columns() == 0);
 }
 
+TEST_F(StringsSplitTest, SplitToTable)
+{
+  cudf::test::strings_column_wrapper input({"12:3.5:x", "34:0.25:y", "56", "", "78:1.5:z:extra"},
+                                           {true, true, true, false, true});
+  auto sv = cudf::strings_column_view(input);
+
+  auto const types   = std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::INT32},
+                                                    cudf::data_type{cudf::type_id::FLOAT64},
+                                                    cudf::data_type{cudf::type_id::STRING}};
+  auto const results = cudf::strings::split_to_table(sv, cudf::string_scalar(":"), types);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_ints({12, 34, 56, 0, 78},
+                                                                {true, true, true, false, true});
+  cudf::test::fixed_width_column_wrapper<double> expected_floats(
+    {3.5, 0.25, 0., 0., 1.5}, {true, true, false, false, true});
+  cudf::test::strings_column_wrapper expected_strs({"x", "y", "", "", "z:extra"},
+                                                   {true, true, false, false, true});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_ints);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_floats);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), expected_strs);
+
+  // results match split() followed by per-column conversion
+  auto const split_results = cudf::strings::split(sv, cudf::string_scalar(":"), types.size() - 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), split_results->get_column(2));
+}
+
+TEST_F(StringsSplitTest, SplitToTableErrors)
+{
+  cudf::test::strings_column_wrapper input({"1:2"});
+  auto sv = cudf::strings_column_view(input);
+
+  auto const types = std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::INT32}};
+  EXPECT_THROW(cudf::strings::split_to_table(sv, cudf::string_scalar("", false), types),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::strings::split_to_table(sv, cudf::string_scalar(""), types),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::strings::split_to_table(sv, cudf::string_scalar(":"), {}),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::strings::split_to_table(
+                 sv, cudf::string_scalar(":"), {cudf::data_type{cudf::type_id::TIMESTAMP_DAYS}}),
+               cudf::data_type_error);
+}
+
 TEST_F(StringsSplitTest, InvalidParameter)
 {
   cudf::test::strings_column_wrapper input({"string left intentionally blank"});
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/strings/detail/transform_chain.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+struct StringsTransformChainTest : public cudf::test::BaseFixture {};
+
+namespace {
+
+// view transform: remove leading and trailing ASCII spaces
+struct trim_spaces_fn {
+  __device__ cudf::string_view operator()(cudf::string_view d_str) const
+  {
+    auto const* begin = d_str.data();
+    auto const* end   = begin + d_str.size_bytes();
+    while (begin < end && *begin == ' ') {
+      ++begin;
+    }
+    while (end > begin && *(end - 1) == ' ') {
+      --end;
+    }
+    return cudf::string_view{begin, static_cast<cudf::size_type>(end - begin)};
+  }
+};
+
+// view transform: keep only the first max_chars characters
+struct truncate_fn {
+  cudf::size_type max_chars;
+  __device__ cudf::string_view operator()(cudf::string_view d_str) const
+  {
+    return d_str.substr(0, max_chars);
+  }
+};
+
+// writer transform: upper-case ASCII letters while copying
+struct upper_writer_fn {
+  __device__ cudf::size_type operator()(cudf::string_view d_str, char* d_output) const
+  {
+    if (d_output) {
+      for (auto const chr : d_str) {
+        auto byte = static_cast<char>(chr);
+        if (byte >= 'a' && byte <= 'z') { byte = byte - 'a' + 'A'; }
+        *d_output++ = byte;
+      }
+    }
+    return d_str.size_bytes();
+  }
+};
+
+}  // namespace
+
+TEST_F(StringsTransformChainTest, ViewChain)
+{
+  auto const input = cudf::test::strings_column_wrapper(
+    {"  hello world  ", " short", "", "", "abcdefghij  "}, {true, true, false, true, true});
+  auto const view = cudf::strings_column_view(cudf::column_view(input));
+
+  auto const transform = cudf::strings::detail::chain_transforms(trim_spaces_fn{}, truncate_fn{5});
+  auto const results =
+    cudf::strings::detail::transform_strings(view,
+                                             transform,
+                                             cudf::strings::detail::copy_writer_fn{},
+                                             cudf::get_default_stream(),
+                                             cudf::get_current_device_resource_ref());
+
+  auto const expected = cudf::test::strings_column_wrapper({"hello", "short", "", "", "abcde"},
+                                                           {true, true, false, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsTransformChainTest, WriterChain)
+{
+  auto const input = cudf::test::strings_column_wrapper(
+    {"  hello world  ", " short", "", "", "abcdefghij  "}, {true, true, false, true, true});
+  auto const view = cudf::strings_column_view(cudf::column_view(input));
+
+  auto const transform = cudf::strings::detail::chain_transforms(
+    trim_spaces_fn{}, truncate_fn{7}, trim_spaces_fn{});
+  auto const results =
+    cudf::strings::detail::transform_strings(view,
+                                             transform,
+                                             upper_writer_fn{},
+                                             cudf::get_default_stream(),
+                                             cudf::get_current_device_resource_ref());
+
+  auto const expected = cudf::test::strings_column_wrapper({"HELLO W", "SHORT", "", "", "ABCDEFG"},
+                                                           {true, true, false, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/table/chunked_table_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+struct ChunkedTableViewTest : public cudf::test::BaseFixture {};
+
+TEST_F(ChunkedTableViewTest, Construction)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({4, 5});
+  auto const chunks =
+    std::vector<cudf::table_view>{cudf::table_view{{col1}}, cudf::table_view{{col2}}};
+
+  auto const chunked = cudf::chunked_table_view{chunks};
+  EXPECT_EQ(chunked.num_chunks(), 2);
+  EXPECT_EQ(chunked.num_columns(), 1);
+  EXPECT_EQ(chunked.num_rows(), 5);
+  EXPECT_EQ(chunked.row_offsets()[0], 3);
+  EXPECT_EQ(chunked.row_offsets()[1], 5);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> mismatched({6, 7});
+  auto const bad_chunks =
+    std::vector<cudf::table_view>{cudf::table_view{{col1}}, cudf::table_view{{mismatched}}};
+  EXPECT_THROW(cudf::chunked_table_view{bad_chunks}, cudf::data_type_error);
+}
+
+TEST_F(ChunkedTableViewTest, GatherAcrossChunks)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({0, 1, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({3, 4});
+  cudf::test::fixed_width_column_wrapper<int32_t> col3({5, 6, 7, 8});
+  auto const chunks = std::vector<cudf::table_view>{
+    cudf::table_view{{col1}}, cudf::table_view{{col2}}, cudf::table_view{{col3}}};
+  auto const chunked = cudf::chunked_table_view{chunks};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({8, 0, 4, 3, 6, 2});
+  auto const result = cudf::gather(chunked, gather_map);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({8, 0, 4, 3, 6, 2});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), cudf::table_view{{expected}});
+}
+
+TEST_F(ChunkedTableViewTest, GatherStrings)
+{
+  cudf::test::strings_column_wrapper col1({"a", "b"});
+  cudf::test::strings_column_wrapper col2({"c", "d", "e"});
+  auto const chunks =
+    std::vector<cudf::table_view>{cudf::table_view{{col1}}, cudf::table_view{{col2}}};
+  auto const chunked = cudf::chunked_table_view{chunks};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map({4, 1, 2});
+  auto const result = cudf::gather(chunked, gather_map);
+
+  cudf::test::strings_column_wrapper expected({"e", "b", "c"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), cudf::table_view{{expected}});
+}
+
+TEST_F(ChunkedTableViewTest, ApplyBooleanMask)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({0, 1, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({3, 4, 5});
+  auto const chunks =
+    std::vector<cudf::table_view>{cudf::table_view{{col1}}, cudf::table_view{{col2}}};
+  auto const chunked = cudf::chunked_table_view{chunks};
+
+  cudf::test::fixed_width_column_wrapper<bool> mask1({true, false, true});
+  cudf::test::fixed_width_column_wrapper<bool> mask2({false, true, false});
+  auto const mask_chunks =
+    std::vector<cudf::table_view>{cudf::table_view{{mask1}}, cudf::table_view{{mask2}}};
+  auto const mask = cudf::chunked_table_view{mask_chunks};
+
+  auto const result = cudf::apply_boolean_mask(chunked, mask);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({0, 2, 4});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), cudf::table_view{{expected}});
+
+  auto const short_mask = cudf::chunked_table_view{
+    std::vector<cudf::table_view>{cudf::table_view{{mask1}}}};
+  EXPECT_THROW(cudf::apply_boolean_mask(chunked, short_mask), cudf::logic_error);
+}
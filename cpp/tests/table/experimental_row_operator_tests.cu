@@ -21,6 +21,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/sorting.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -293,3 +294,30 @@ TYPED_TEST(NaNTableViewTest, TestEqualityComparatorTwoTableNaNCase)
                        cudf::experimental::row::equality::nan_equal_physical_equality_comparator{});
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(nan_equal_expected, nan_equal_got->view());
 }
+
+TYPED_TEST(TypedTableViewTest, SortedOrderWithPreprocessedTable)
+{
+  using data_col    = cudf::test::fixed_width_column_wrapper<TypeParam>;
+  using strings_col = cudf::test::strings_column_wrapper;
+  using structs_col = cudf::test::structs_column_wrapper;
+
+  auto child0 = data_col{2, 1, 2, 0};
+  auto child1 = strings_col{"bb", "aa", "aa", "cc"};
+  auto const structs = structs_col{{child0, child1}};
+  auto const keys    = data_col{10, 20, 20, 10};
+  auto const input   = cudf::table_view{{keys, structs}};
+
+  auto const column_order = std::vector{cudf::order::ASCENDING, cudf::order::ASCENDING};
+  auto const stream       = cudf::get_default_stream();
+
+  // preprocess once, sort many times
+  auto const preprocessed = cudf::experimental::row::lexicographic::preprocessed_table::create(
+    input, column_order, {}, stream);
+
+  auto const expected = cudf::sorted_order(input, column_order, {});
+  auto const first    = cudf::sorted_order(input, preprocessed);
+  auto const second   = cudf::sorted_order(input, preprocessed);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view(), second->view());
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/detail/utilities/table_device_view_cache.cuh>
+#include <cudf/table/table_view.hpp>
+
+struct TableDeviceViewCacheTest : public cudf::test::BaseFixture {};
+
+TEST_F(TableDeviceViewCacheTest, ReusesSerializedView)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({1, 2, 3});
+  cudf::table_view const table({col});
+
+  cudf::detail::table_device_view_cache cache;
+  auto const& first  = cache.get_or_create(table);
+  auto const& second = cache.get_or_create(table);
+  EXPECT_EQ(&first, &second);
+  EXPECT_EQ(cache.size(), 1);
+
+  // A distinct but shallow-equivalent view of the same columns also hits
+  auto const& third = cache.get_or_create(cudf::table_view({col}));
+  EXPECT_EQ(&first, &third);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST_F(TableDeviceViewCacheTest, DistinctTablesGetDistinctEntries)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({4, 5, 6});
+
+  cudf::detail::table_device_view_cache cache;
+  cache.get_or_create(cudf::table_view({col1}));
+  cache.get_or_create(cudf::table_view({col2}));
+  EXPECT_EQ(cache.size(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
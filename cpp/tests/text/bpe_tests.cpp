@@ -116,6 +116,26 @@ TEST_F(TextBytePairEncoding, BPEAdjacentPairs)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+TEST_F(TextBytePairEncoding, BPELargeMergesTable)
+{
+  // merges table larger than the hot-pair cache so the pairs used here
+  // must be resolved through the full table
+  std::vector<std::string> h_merges;
+  for (int idx = 0; idx < 600; ++idx) {
+    h_merges.push_back("q" + std::to_string(idx) + " r" + std::to_string(idx));
+  }
+  h_merges.insert(h_merges.end(), {"t h", "th e", "e n"});
+  auto mpt = cudf::test::strings_column_wrapper(h_merges.begin(), h_merges.end());
+
+  auto merge_pairs = nvtext::load_merge_pairs(cudf::strings_column_view(mpt));
+
+  cudf::test::strings_column_wrapper input({"then", "nthe", "hen", ""});
+
+  auto results  = nvtext::byte_pair_encoding(cudf::strings_column_view(input), *merge_pairs);
+  auto expected = cudf::test::strings_column_wrapper({"the n", "n the", "h en", ""});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
 TEST_F(TextBytePairEncoding, BPE_Empty)
 {
   auto mpt         = cudf::test::strings_column_wrapper({"i s", "i t"});
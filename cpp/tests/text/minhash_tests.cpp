@@ -20,6 +20,8 @@
 #include <cudf_test/iterator_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <nvtext/minhash.hpp>
@@ -177,6 +179,47 @@ TEST_F(MinHashTest, PermutedManyParameters)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results64, expected64);
 }
 
+TEST_F(MinHashTest, Lsh)
+{
+  auto validity = cudf::test::iterators::null_at(4);
+  auto input    = cudf::test::strings_column_wrapper({"doc one is a duplicate text",
+                                                      "doc one is a duplicate text",
+                                                      "completely different content here",
+                                                      "",
+                                                      ""},
+                                                  validity);
+  auto view     = cudf::strings_column_view(input);
+
+  auto const num_bands = 4;
+  auto const band_size = 8;
+  auto results         = nvtext::minhash_lsh(view, 0, num_bands, band_size, 4);
+  EXPECT_EQ(results->size(), view.size());
+  auto lists = cudf::lists_column_view(results->view());
+  EXPECT_EQ(lists.child().type().id(), cudf::type_id::UINT32);
+
+  // identical rows must produce identical band hashes
+  auto row0 = cudf::slice(results->view(), {0, 1}).front();
+  auto row1 = cudf::slice(results->view(), {1, 2}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(row0, row1);
+
+  // results are deterministic for the same seed
+  auto repeat = nvtext::minhash_lsh(view, 0, num_bands, band_size, 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), repeat->view());
+
+  auto empty = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  results    = nvtext::minhash_lsh(cudf::strings_column_view(empty->view()), 0, 4, 8, 4);
+  EXPECT_EQ(results->size(), 0);
+}
+
+TEST_F(MinHashTest, LshErrors)
+{
+  auto input = cudf::test::strings_column_wrapper({"this string intentionally left blank"});
+  auto view  = cudf::strings_column_view(input);
+  EXPECT_THROW(nvtext::minhash_lsh(view, 0, 0, 8, 4), std::invalid_argument);
+  EXPECT_THROW(nvtext::minhash_lsh(view, 0, 4, 0, 4), std::invalid_argument);
+  EXPECT_THROW(nvtext::minhash_lsh(view, 0, 4, 8, 1), std::invalid_argument);
+}
+
 TEST_F(MinHashTest, EmptyTest)
 {
   auto input   = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
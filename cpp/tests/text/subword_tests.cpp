@@ -438,3 +438,78 @@ TEST(TextSubwordTest, ZeroHashBinCoefficient)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
+
+TEST(TextSubwordTest, TokenizerObject)
+{
+  std::vector<char const*> h_strings{"This is a test.", "This is a test. This is a tést."};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end());
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  uint32_t max_sequence_length = 8;
+  uint32_t stride              = 6;
+
+  auto tokenizer =
+    nvtext::create_subword_tokenizer(*vocab, max_sequence_length, stride, true, false);
+  auto result = nvtext::subword_tokenize(cudf::strings_column_view{strings}, *tokenizer);
+
+  auto expected = nvtext::subword_tokenize(
+    cudf::strings_column_view{strings}, *vocab, max_sequence_length, stride, true, false);
+  EXPECT_EQ(result.nrows_tensor, expected.nrows_tensor);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(),
+                                 expected.tensor_token_ids->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(),
+                                 expected.tensor_attention_mask->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected.tensor_metadata->view());
+
+  // reuse the same tokenizer object for another micro-batch
+  cudf::test::strings_column_wrapper batch2({"A test.", "This is."});
+  auto result2 = nvtext::subword_tokenize(cudf::strings_column_view{batch2}, *tokenizer);
+  auto expected2 = nvtext::subword_tokenize(
+    cudf::strings_column_view{batch2}, *vocab, max_sequence_length, stride, true, false);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result2.tensor_token_ids->view(),
+                                 expected2.tensor_token_ids->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result2.tensor_attention_mask->view(),
+                                 expected2.tensor_attention_mask->view());
+}
+
+TEST(TextSubwordTest, TokenizePairs)
+{
+  cudf::test::strings_column_wrapper first({"This is a test.", ""});
+  cudf::test::strings_column_wrapper second({"A test this is.", "this"});
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  uint32_t max_sequence_length = 12;
+  auto tokenizer =
+    nvtext::create_subword_tokenizer(*vocab, max_sequence_length, max_sequence_length, true, true);
+  auto result = nvtext::subword_tokenize_pairs(
+    cudf::strings_column_view{first}, cudf::strings_column_view{second}, *tokenizer);
+  EXPECT_EQ(result.nrows_tensor, 2u);
+
+  // the separator token id (101) is packed between the two sequences
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_tokens(
+    {2023, 2003, 1037, 3231, 1012, 101, 1037, 3231, 2023, 2003, 1012, 0,
+      101, 2023,    0,    0,    0,   0,    0,    0,    0,    0,    0, 0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_attn(
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+     1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+  cudf::test::fixed_width_column_wrapper<uint32_t> expected_metadata({0, 0, 10, 1, 0, 1});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_token_ids->view(), expected_tokens);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
+
+  // pairs require a truncating tokenizer and equal row counts
+  auto overflow = nvtext::create_subword_tokenizer(*vocab, 12, 12, true, false);
+  EXPECT_THROW(nvtext::subword_tokenize_pairs(
+                 cudf::strings_column_view{first}, cudf::strings_column_view{second}, *overflow),
+               cudf::logic_error);
+  cudf::test::strings_column_wrapper mismatched({"this"});
+  EXPECT_THROW(nvtext::subword_tokenize_pairs(
+                 cudf::strings_column_view{first}, cudf::strings_column_view{mismatched}, *tokenizer),
+               cudf::logic_error);
+}
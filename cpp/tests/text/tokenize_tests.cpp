@@ -272,6 +272,71 @@ TEST_F(TextTokenizeTest, VocabularyLongStrings)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), sliced_expected);
 }
 
+TEST_F(TextTokenizeTest, StaticVocabulary)
+{
+  cudf::test::strings_column_wrapper vocabulary(  // leaving out 'cat' on purpose
+    {"ate", "chased", "cheese", "dog", "fox", "jumped", "mouse", "mousé", "over", "the"});
+  auto vocab = nvtext::load_static_vocabulary(cudf::strings_column_view(vocabulary));
+
+  auto validity = cudf::test::iterators::null_at(5);
+  auto input    = cudf::test::strings_column_wrapper({" the fox jumped over the dog ",
+                                                      " the dog chased the cat",
+                                                      "",
+                                                      "the cat chased the mouse ",
+                                                      "the mousé  ate  cheese",
+                                                      "",
+                                                      "dog"},
+                                                  validity);
+
+  auto input_view = cudf::strings_column_view(input);
+  auto delimiter  = cudf::string_scalar(" ");
+  auto default_id = -7;  // should be the token for the missing 'cat'
+  auto results    = nvtext::tokenize_with_vocabulary(input_view, *vocab, delimiter, default_id);
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::size_type>;
+  // clang-format off
+  LCW expected({LCW{ 9, 4, 5, 8, 9, 3},
+                LCW{ 9, 3, 1, 9,-7},
+                LCW{},
+                LCW{ 9,-7, 1, 9, 6},
+                LCW{ 9, 7, 0, 2},
+                LCW{}, LCW{3}},
+                validity);
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // results should match the default hash-map lookup
+  auto vocab_map = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary));
+  auto expected_map =
+    nvtext::tokenize_with_vocabulary(input_view, *vocab_map, delimiter, default_id);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected_map);
+}
+
+TEST_F(TextTokenizeTest, VocabularyBatch)
+{
+  cudf::test::strings_column_wrapper vocabulary(
+    {"ate", "chased", "cheese", "dog", "fox", "jumped", "mouse", "mousé", "over", "the"});
+  auto vocab = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary));
+
+  auto input1 = cudf::test::strings_column_wrapper({"the fox jumped over the dog", "the cat"});
+  auto input2 = cudf::test::strings_column_wrapper({"the mousé ate cheese", "", "dog"});
+
+  std::vector<cudf::strings_column_view> inputs;
+  inputs.push_back(cudf::strings_column_view(input1));
+  inputs.push_back(cudf::strings_column_view(input2));
+
+  auto delimiter  = cudf::string_scalar(" ");
+  auto default_id = -1;
+  auto results    = nvtext::tokenize_with_vocabulary(inputs, *vocab, delimiter, default_id);
+  ASSERT_EQ(results.size(), inputs.size());
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::size_type>;
+  LCW expected1({LCW{9, 4, 5, 8, 9, 3}, LCW{9, -1}});
+  LCW expected2({LCW{9, 7, 0, 2}, LCW{}, LCW{3}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[0], expected1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[1], expected2);
+}
+
 TEST_F(TextTokenizeTest, TokenizeErrors)
 {
   cudf::test::strings_column_wrapper empty{};
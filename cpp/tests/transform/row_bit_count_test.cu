@@ -768,3 +768,37 @@ TEST_F(RowBitCount, EmptyTable)
     EXPECT_TRUE(result != nullptr && result->size() == 0);
   }
 }
+
+TEST_F(RowBitCount, ConstantRowBitCount)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<double> doubles({1.0, 2.0, 3.0},
+                                                         {true, false, true});
+  cudf::test::structs_column_wrapper structs({ints, doubles});
+
+  cudf::test::fixed_width_column_wrapper<int16_t> shorts({1, 2, 3});
+  auto const table = cudf::table_view({structs, shorts});
+
+  auto const constant_size = cudf::constant_row_bit_count(table);
+  ASSERT_TRUE(constant_size.has_value());
+
+  // must agree with the per-row result of the full computation
+  auto const result = cudf::row_bit_count(table);
+  auto const expected =
+    cudf::test::to_host<cudf::size_type>(result->view()).first.front();
+  EXPECT_EQ(*constant_size, expected);
+}
+
+TEST_F(RowBitCount, ConstantRowBitCountDataDependent)
+{
+  cudf::test::strings_column_wrapper strings({"a", "bb", "ccc"});
+  EXPECT_FALSE(cudf::constant_row_bit_count(cudf::table_view({strings})).has_value());
+
+  cudf::test::lists_column_wrapper<int32_t> lists({{1, 2}, {3}, {}});
+  EXPECT_FALSE(cudf::constant_row_bit_count(cudf::table_view({lists})).has_value());
+
+  // empty table has a (vacuously) constant row size of zero bits
+  auto const empty = cudf::constant_row_bit_count(cudf::table_view{});
+  ASSERT_TRUE(empty.has_value());
+  EXPECT_EQ(*empty, 0);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+
+#include <algorithm>
+
+class InstrumentationTest : public cudf::test::BaseFixture {
+ public:
+  ~InstrumentationTest() override
+  {
+    cudf::set_instrumentation(false);
+    cudf::reset_instrumentation_records();
+  }
+};
+
+TEST_F(InstrumentationTest, EnableGetAndSet)
+{
+  EXPECT_FALSE(cudf::get_instrumentation());
+  cudf::set_instrumentation(true);
+  EXPECT_TRUE(cudf::get_instrumentation());
+  cudf::set_instrumentation(false);
+  EXPECT_FALSE(cudf::get_instrumentation());
+}
+
+TEST_F(InstrumentationTest, RecordsPublicCalls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({3, 1, 2});
+  cudf::table_view input({col});
+
+  cudf::set_instrumentation(true);
+  cudf::reset_instrumentation_records();
+
+  cudf::sorted_order(input);
+  cudf::sorted_order(input);
+
+  auto const records = cudf::get_instrumentation_records();
+  auto const it      = std::find_if(
+    records.begin(), records.end(), [](auto const& record) { return record.name == "sorted_order"; });
+  ASSERT_NE(it, records.end());
+  EXPECT_EQ(it->num_calls, 2);
+  EXPECT_GT(it->total_time.count(), 0);
+
+  cudf::reset_instrumentation_records();
+  EXPECT_TRUE(cudf::get_instrumentation_records().empty());
+}
+
+TEST_F(InstrumentationTest, DisabledRecordsNothing)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col({3, 1, 2});
+  cudf::table_view input({col});
+
+  cudf::reset_instrumentation_records();
+  cudf::sorted_order(input);
+  EXPECT_TRUE(cudf::get_instrumentation_records().empty());
+}
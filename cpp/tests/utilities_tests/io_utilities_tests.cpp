@@ -17,13 +17,50 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <cudf/io/datasource.hpp>
+
 #include <src/io/utilities/base64_utilities.hpp>
 
+#include <utility>
+#include <vector>
+
 using cudf::io::detail::base64_decode;
 using cudf::io::detail::base64_encode;
 
 class IoUtilitiesTest : public cudf::test::BaseFixture {};
 
+TEST(IoUtilitiesTest, InstrumentedDatasource)
+{
+  std::vector<char> const data(1024, 'a');
+  auto source = cudf::io::datasource::create(
+    cudf::host_span<std::byte const>{reinterpret_cast<std::byte const*>(data.data()), data.size()});
+
+  std::vector<std::pair<size_t, size_t>> traced;
+  cudf::io::instrumented_datasource instrumented(
+    std::move(source),
+    [&traced](size_t offset, size_t size, std::chrono::nanoseconds duration, bool is_device_read) {
+      EXPECT_FALSE(is_device_read);
+      traced.emplace_back(offset, size);
+    });
+
+  auto const buf = instrumented.host_read(0, 512);
+  std::vector<uint8_t> dst(256);
+  instrumented.host_read(512, dst.size(), dst.data());
+
+  auto const stats = instrumented.get_statistics();
+  EXPECT_EQ(stats.host.num_reads, 2);
+  EXPECT_EQ(stats.host.bytes_read, buf->size() + dst.size());
+  EXPECT_EQ(stats.device.num_reads, 0);
+  ASSERT_EQ(traced.size(), 2);
+  EXPECT_EQ(traced[0], std::make_pair(size_t{0}, size_t{512}));
+  EXPECT_EQ(traced[1], std::make_pair(size_t{512}, size_t{256}));
+}
+
+TEST(IoUtilitiesTest, InstrumentedDatasourceNullSource)
+{
+  EXPECT_THROW(cudf::io::instrumented_datasource(nullptr), cudf::logic_error);
+}
+
 TEST(IoUtilitiesTest, Base64EncodeAndDecode)
 {
   // a vector of lorem ipsum strings
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/memory_tracking.hpp>
+
+#include <algorithm>
+
+class MemoryTrackingTest : public cudf::test::BaseFixture {};
+
+TEST_F(MemoryTrackingTest, CurrentCallStackOutsideCall)
+{
+  EXPECT_TRUE(cudf::get_current_call_stack().empty());
+}
+
+TEST_F(MemoryTrackingTest, AttributesAllocationsToCall)
+{
+  cudf::call_tracking_resource_adaptor mr{cudf::get_current_device_resource_ref()};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col({3, 1, 2});
+  cudf::table_view input({col});
+  cudf::sorted_order(input, {}, {}, cudf::get_default_stream(), mr);
+
+  auto const records = mr.get_records();
+  auto const it      = std::find_if(records.begin(), records.end(), [](auto const& record) {
+    return record.call_stack.find("sorted_order") != std::string::npos;
+  });
+  ASSERT_NE(it, records.end());
+  EXPECT_GT(it->num_allocations, 0);
+  EXPECT_GT(it->bytes_allocated, 0);
+  EXPECT_GT(it->peak_bytes, 0);
+}
+
+TEST_F(MemoryTrackingTest, ResetClearsRecords)
+{
+  cudf::call_tracking_resource_adaptor mr{cudf::get_current_device_resource_ref()};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col({3, 1, 2});
+  cudf::table_view input({col});
+  {
+    auto const order = cudf::sorted_order(input, {}, {}, cudf::get_default_stream(), mr);
+    mr.reset_records();
+    // The result column is still alive, so its allocation is re-seeded into the records
+    auto const records = mr.get_records();
+    EXPECT_TRUE(std::all_of(
+      records.begin(), records.end(), [](auto const& record) { return record.num_allocations == 0; }));
+  }
+  mr.reset_records();
+  EXPECT_TRUE(mr.get_records().empty());
+}
@@ -101,6 +101,30 @@ TEST_F(PinnedMemoryTest, HostAsPinnedThresholdGetAndSet)
   EXPECT_EQ(cudf::get_allocate_host_as_pinned_threshold(), 12345);
 }
 
+TEST_F(PinnedMemoryTest, PoolStatistics)
+{
+  auto mr           = cudf::get_pinned_memory_resource();
+  auto const stream = cudf::get_default_stream();
+
+  cudf::reset_pinned_pool_statistics();
+  auto const before = cudf::get_pinned_pool_statistics();
+  EXPECT_EQ(before.hits, 0);
+  EXPECT_EQ(before.fallbacks, 0);
+
+  constexpr size_t alloc_size = 1024;
+  auto* const ptr             = mr.allocate_async(alloc_size, stream.value());
+  auto const during           = cudf::get_pinned_pool_statistics();
+  EXPECT_EQ(during.hits, before.hits + 1);
+  EXPECT_EQ(during.current_usage, before.current_usage + alloc_size);
+  EXPECT_GE(during.high_water_mark, during.current_usage);
+
+  mr.deallocate_async(ptr, alloc_size, stream.value());
+  auto const after = cudf::get_pinned_pool_statistics();
+  EXPECT_EQ(after.current_usage, before.current_usage);
+  EXPECT_GE(after.high_water_mark, during.current_usage);
+  stream.synchronize();
+}
+
 TEST_F(PinnedMemoryTest, MakePinnedVector)
 {
   cudf::set_allocate_host_as_pinned_threshold(0);